@@ -0,0 +1,5 @@
+tm_conversion.h: ${unmerged_deps} src/tm_conversion/*.cpp ${merge.out}
+	${hide}echo Merging $@.
+	${hide}${merge.out} src/tm_conversion/main.cpp $@ src/tm_conversion -r
+
+merge.all: tm_conversion.h
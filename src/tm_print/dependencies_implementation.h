@@ -30,13 +30,16 @@
             TMP_INT_BACKEND_CHARCONV           needs C++17/20 standard library, but postprocessing needed after printing
         Floating point values (float, double):
             TMP_FLOAT_BACKEND_CRT              might not do correct rounding, locale dependent
-            TMP_FLOAT_BACKEND_TM_CONVERSION    very inaccurate, hex and scientific printing not implemented yet
+            TMP_FLOAT_BACKEND_TM_CONVERSION    correctly rounded and shortest output, hex printing not implemented yet
             TMP_FLOAT_BACKEND_CHARCONV         needs C++17/20 standard library, probably fast and accurate
+            TMP_FLOAT_BACKEND_BUILTIN          no dependencies, correctly rounded, a negative precision prints the
+                                               shortest representation that round trips
     */
     #if !defined(TMP_INT_BACKEND_CRT) && !defined(TMP_INT_BACKEND_TM_CONVERSION) && !defined(TMP_INT_BACKEND_CHARCONV)
         #define TMP_INT_BACKEND_CRT
     #endif
-    #if !defined(TMP_FLOAT_BACKEND_CRT) && !defined(TMP_FLOAT_BACKEND_TM_CONVERSION) && !defined(TMP_FLOAT_BACKEND_CHARCONV)
+    #if !defined(TMP_FLOAT_BACKEND_CRT) && !defined(TMP_FLOAT_BACKEND_TM_CONVERSION) && !defined(TMP_FLOAT_BACKEND_CHARCONV) \
+        && !defined(TMP_FLOAT_BACKEND_BUILTIN)
         #define TMP_FLOAT_BACKEND_CRT
     #endif
 
@@ -44,7 +47,8 @@
         #error "Only one backend for int is allowed."
     #endif
 
-    #if defined(TMP_FLOAT_BACKEND_CRT) + defined(TMP_FLOAT_BACKEND_TM_CONVERSION) + defined(TMP_FLOAT_BACKEND_CHARCONV) != 1
+    #if defined(TMP_FLOAT_BACKEND_CRT) + defined(TMP_FLOAT_BACKEND_TM_CONVERSION) + defined(TMP_FLOAT_BACKEND_CHARCONV) \
+        + defined(TMP_FLOAT_BACKEND_BUILTIN) != 1
         #error "Only one backend for float is allowed."
     #endif
 
@@ -62,6 +66,10 @@
         #include <cinttypes>
     #endif
 
+    #ifdef TMP_FLOAT_BACKEND_BUILTIN
+        #include "../common/tm_bool.inc"
+    #endif
+
     #if defined(TMP_INT_BACKEND_CHARCONV) || defined(TMP_FLOAT_BACKEND_CHARCONV)
         #define TMP_CHARCONV_INCLUDED
         #include <charconv>
@@ -88,8 +96,27 @@
         #define TMP_TOUPPER toupper
     #endif
 
+    #if !defined(TMP_NO_FD_SINK) && !defined(TMP_WRITE)
+        #ifdef _WIN32
+            #include <io.h>
+            #define TMP_WRITE(fd, data, size) _write((fd), (data), (unsigned int)(size))
+        #else
+            #include <unistd.h>
+            #define TMP_WRITE(fd, data, size) write((fd), (data), (size_t)(size))
+        #endif
+    #endif
+
     // The buffer size used for small buffer optimization, change this by profiling if malloc is a bottleneck.
     #ifndef TMP_SBO_SIZE
         #define TMP_SBO_SIZE 200
     #endif  // !defined( TMP_SBO_SIZE )
+
+    // Printing into FILE* and std::string uses a buffer per thread that is kept between calls if TMP_SCRATCH_ARENA is
+    // defined. Buffers that grew bigger than TMP_SCRATCH_ARENA_MAX_SIZE are freed after the call.
+    #ifdef TMP_SCRATCH_ARENA
+        #include "../common/tm_thread_local.inc"
+        #ifndef TMP_SCRATCH_ARENA_MAX_SIZE
+            #define TMP_SCRATCH_ARENA_MAX_SIZE 65536
+        #endif
+    #endif
 #endif
@@ -0,0 +1,895 @@
+// Float backend without dependencies on the C runtime or the standard library.
+// Output with a precision is correctly rounded (round half to even) for float and double.
+// A negative precision prints the shortest representation that round trips.
+// Shortest output uses Grisu3 and falls back to exact bignum arithmetic when Grisu3 can't decide.
+// Output with a precision uses 128-bit products for common values and exact bignum arithmetic otherwise.
+
+struct tmp_float_parts {
+    uint64_t mantissa;  // Value is mantissa * 2^exponent.
+    int exponent;
+    bool lower_boundary_is_closer;  // Whether the previous value is closer than the next, i.e. at powers of two.
+    bool negative;
+    bool is_inf;
+    bool is_nan;
+};
+
+static tmp_float_parts tmp_decompose_float(double value) {
+    uint64_t bits = 0;
+    TM_MEMCPY(&bits, &value, sizeof(double));
+    const uint64_t fraction = bits & 0xFFFFFFFFFFFFFull;
+    const int biased_exponent = (int)((bits >> 52) & 0x7FF);
+
+    tmp_float_parts result = {};
+    result.negative = (bits >> 63) != 0;
+    if (biased_exponent == 0x7FF) {
+        result.is_inf = (fraction == 0);
+        result.is_nan = (fraction != 0);
+    } else if (biased_exponent == 0) {
+        result.mantissa = fraction;
+        result.exponent = -1074;
+    } else {
+        result.mantissa = fraction | (1ull << 52);
+        result.exponent = biased_exponent - 1075;
+        result.lower_boundary_is_closer = (fraction == 0 && biased_exponent > 1);
+    }
+    return result;
+}
+static tmp_float_parts tmp_decompose_float(float value) {
+    uint32_t bits = 0;
+    TM_MEMCPY(&bits, &value, sizeof(float));
+    const uint32_t fraction = bits & 0x7FFFFFu;
+    const int biased_exponent = (int)((bits >> 23) & 0xFF);
+
+    tmp_float_parts result = {};
+    result.negative = (bits >> 31) != 0;
+    if (biased_exponent == 0xFF) {
+        result.is_inf = (fraction == 0);
+        result.is_nan = (fraction != 0);
+    } else if (biased_exponent == 0) {
+        result.mantissa = fraction;
+        result.exponent = -149;
+    } else {
+        result.mantissa = fraction | (1u << 23);
+        result.exponent = biased_exponent - 150;
+        result.lower_boundary_is_closer = (fraction == 0 && biased_exponent > 1);
+    }
+    return result;
+}
+
+// Decimal digits of a value, value = 0.d1d2d3... * 10^point.
+// There are no leading or trailing zeros in digits, zero has no digits.
+struct tmp_decimal {
+    char* digits;
+    int count;
+    int point;
+};
+
+// Enough for the exact expansion of any double and its rounding boundaries.
+enum { TMP_EXACT_DIGITS_CAPACITY = 780 };
+
+static void tmp_trim_trailing_zeros(tmp_decimal* decimal) {
+    while (decimal->count > 0 && decimal->digits[decimal->count - 1] == '0') --decimal->count;
+    if (decimal->count == 0) decimal->point = 0;
+}
+
+static int tmp_write_digits(char* dest, uint64_t value) {
+    char buffer[20];
+    int count = 0;
+    do {
+        buffer[count++] = (char)('0' + (value % 10));
+        value /= 10;
+    } while (value);
+    for (int i = 0; i < count; ++i) dest[i] = buffer[count - i - 1];
+    return count;
+}
+
+// Sets decimal to value * 10^exponent.
+static void tmp_set_decimal(tmp_decimal* decimal, uint64_t value, int exponent) {
+    if (value == 0) {
+        decimal->count = 0;
+        decimal->point = 0;
+        return;
+    }
+    decimal->count = tmp_write_digits(decimal->digits, value);
+    decimal->point = decimal->count + exponent;
+    tmp_trim_trailing_zeros(decimal);
+}
+
+// Rounds to the first keep digits, ties round to even.
+// Digits are exact, so any digit after a '5' means that the value is above the halfway point.
+static void tmp_round_decimal(tmp_decimal* decimal, int keep) {
+    if (keep >= decimal->count) return;
+
+    bool round_up = false;
+    if (keep >= 0) {
+        char next = decimal->digits[keep];
+        if (next != '5') {
+            round_up = next > '5';
+        } else if (keep + 1 < decimal->count) {
+            round_up = true;
+        } else {
+            round_up = keep > 0 && ((decimal->digits[keep - 1] - '0') & 1);
+        }
+    }
+
+    if (keep <= 0) {
+        // Everything is rounded away, result is either zero or one unit of the rounding position.
+        if (round_up) {
+            decimal->digits[0] = '1';
+            decimal->count = 1;
+            ++decimal->point;
+        } else {
+            decimal->count = 0;
+            decimal->point = 0;
+        }
+        return;
+    }
+
+    decimal->count = keep;
+    if (round_up) {
+        int i = keep - 1;
+        while (i >= 0 && decimal->digits[i] == '9') --i;
+        if (i < 0) {
+            decimal->digits[0] = '1';
+            decimal->count = 1;
+            ++decimal->point;
+            return;
+        }
+        ++decimal->digits[i];
+        decimal->count = i + 1;
+    }
+    tmp_trim_trailing_zeros(decimal);
+}
+
+static int tmp_compare_decimal(const tmp_decimal& a, const tmp_decimal& b) {
+    if (a.count == 0 || b.count == 0) return (int)(a.count != 0) - (int)(b.count != 0);
+    if (a.point != b.point) return (a.point < b.point) ? -1 : 1;
+    const int count = (a.count > b.count) ? a.count : b.count;
+    for (int i = 0; i < count; ++i) {
+        char a_digit = (i < a.count) ? a.digits[i] : '0';
+        char b_digit = (i < b.count) ? b.digits[i] : '0';
+        if (a_digit != b_digit) return (a_digit < b_digit) ? -1 : 1;
+    }
+    return 0;
+}
+
+static const uint64_t tmp_powers_of_10[] = {
+    1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull, 1000000000ull,
+    10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull, 100000000000000ull, 1000000000000000ull,
+    10000000000000000ull, 100000000000000000ull, 1000000000000000000ull, 10000000000000000000ull};
+
+// floor(e * log10(2)), exact for |e| <= 1650.
+static int tmp_floor_log10_pow2(int e) {
+    return (e >= 0) ? ((e * 78913) >> 18) : -((-e * 78913 + (1 << 18) - 1) >> 18);
+}
+
+static int tmp_bit_length(uint64_t value) {
+    int result = 0;
+    while (value) {
+        value >>= 1;
+        ++result;
+    }
+    return result;
+}
+
+struct tmp_uint128 {
+    uint64_t high;
+    uint64_t low;
+};
+
+static tmp_uint128 tmp_multiply_u64(uint64_t a, uint64_t b) {
+    const uint64_t a_low = a & 0xFFFFFFFFu;
+    const uint64_t a_high = a >> 32;
+    const uint64_t b_low = b & 0xFFFFFFFFu;
+    const uint64_t b_high = b >> 32;
+
+    const uint64_t low_low = a_low * b_low;
+    const uint64_t high_low = a_high * b_low;
+    const uint64_t low_high = a_low * b_high;
+    const uint64_t high_high = a_high * b_high;
+
+    const uint64_t cross = (low_low >> 32) + (high_low & 0xFFFFFFFFu) + low_high;
+    tmp_uint128 result = {high_high + (high_low >> 32) + (cross >> 32), (cross << 32) | (low_low & 0xFFFFFFFFu)};
+    return result;
+}
+
+#define MERGE_U128 tmp_uint128
+#define MERGE_MULTIPLY64 tmp_multiply_u64
+#define MERGE_POWERS_OF_FIVE tmp_powers_of_5
+#define MERGE_SCALE_AND_ROUND tmp_scale_and_round
+#include "../common/tm_scale_and_round.inc"
+
+// Arbitrary precision unsigned integer, big enough for mantissa * 5^1076.
+enum { TMP_BIGNUM_CAPACITY = 84 };
+
+struct tmp_bignum {
+    uint32_t words[TMP_BIGNUM_CAPACITY];  // Least significant word first.
+    int size;
+};
+
+static void tmp_bignum_assign(tmp_bignum* bignum, uint64_t value) {
+    bignum->size = 0;
+    while (value) {
+        bignum->words[bignum->size++] = (uint32_t)value;
+        value >>= 32;
+    }
+}
+
+static void tmp_bignum_multiply(tmp_bignum* bignum, uint32_t factor) {
+    uint64_t carry = 0;
+    for (int i = 0; i < bignum->size; ++i) {
+        uint64_t product = (uint64_t)bignum->words[i] * factor + carry;
+        bignum->words[i] = (uint32_t)product;
+        carry = product >> 32;
+    }
+    if (carry) {
+        TM_ASSERT(bignum->size < TMP_BIGNUM_CAPACITY);
+        bignum->words[bignum->size++] = (uint32_t)carry;
+    }
+}
+
+static void tmp_bignum_multiply_pow5(tmp_bignum* bignum, int exponent) {
+    while (exponent >= 13) {
+        tmp_bignum_multiply(bignum, (uint32_t)tmp_powers_of_5[13]);
+        exponent -= 13;
+    }
+    if (exponent > 0) tmp_bignum_multiply(bignum, (uint32_t)tmp_powers_of_5[exponent]);
+}
+
+static void tmp_bignum_shift_left(tmp_bignum* bignum, int bits) {
+    if (bignum->size == 0 || bits == 0) return;
+    const int word_shift = bits / 32;
+    const int bit_shift = bits % 32;
+    TM_ASSERT(bignum->size + word_shift + 1 <= TMP_BIGNUM_CAPACITY);
+
+    if (bit_shift == 0) {
+        for (int i = bignum->size - 1; i >= 0; --i) bignum->words[i + word_shift] = bignum->words[i];
+    } else {
+        bignum->words[bignum->size + word_shift] = bignum->words[bignum->size - 1] >> (32 - bit_shift);
+        for (int i = bignum->size - 1; i > 0; --i) {
+            bignum->words[i + word_shift] =
+                (bignum->words[i] << bit_shift) | (bignum->words[i - 1] >> (32 - bit_shift));
+        }
+        bignum->words[word_shift] = bignum->words[0] << bit_shift;
+        ++bignum->size;
+    }
+    for (int i = 0; i < word_shift; ++i) bignum->words[i] = 0;
+    bignum->size += word_shift;
+    while (bignum->size > 0 && bignum->words[bignum->size - 1] == 0) --bignum->size;
+}
+
+// Divides in place and returns the remainder.
+static uint32_t tmp_bignum_divide(tmp_bignum* bignum, uint32_t divisor) {
+    uint64_t remainder = 0;
+    for (int i = bignum->size - 1; i >= 0; --i) {
+        uint64_t current = (remainder << 32) | bignum->words[i];
+        bignum->words[i] = (uint32_t)(current / divisor);
+        remainder = current % divisor;
+    }
+    while (bignum->size > 0 && bignum->words[bignum->size - 1] == 0) --bignum->size;
+    return (uint32_t)remainder;
+}
+
+// All digits of mantissa * 2^exponent. Negative exponents are computed as mantissa * 5^-exponent * 10^exponent.
+// decimal->digits must have room for TMP_EXACT_DIGITS_CAPACITY digits.
+static void tmp_exact_decimal(uint64_t mantissa, int exponent, tmp_decimal* decimal) {
+    tmp_bignum value;
+    tmp_bignum_assign(&value, mantissa);
+    if (exponent >= 0) {
+        tmp_bignum_shift_left(&value, exponent);
+    } else {
+        tmp_bignum_multiply_pow5(&value, -exponent);
+    }
+
+    // Split into chunks of 9 digits, least significant chunk first.
+    uint32_t chunks[(TMP_EXACT_DIGITS_CAPACITY + 8) / 9];
+    int chunks_count = 0;
+    while (value.size > 0) {
+        TM_ASSERT(chunks_count < (int)(sizeof(chunks) / sizeof(chunks[0])));
+        chunks[chunks_count++] = tmp_bignum_divide(&value, 1000000000u);
+    }
+
+    int count = 0;
+    if (chunks_count > 0) {
+        count = tmp_write_digits(decimal->digits, chunks[chunks_count - 1]);
+        for (int i = chunks_count - 2; i >= 0; --i) {
+            TM_ASSERT(count + 9 <= TMP_EXACT_DIGITS_CAPACITY);
+            uint32_t chunk = chunks[i];
+            for (int j = 8; j >= 0; --j) {
+                decimal->digits[count + j] = (char)('0' + (chunk % 10));
+                chunk /= 10;
+            }
+            count += 9;
+        }
+    }
+    decimal->count = count;
+    decimal->point = count + ((exponent < 0) ? exponent : 0);
+    tmp_trim_trailing_zeros(decimal);
+}
+
+// Rounds to significant_digits significant digits.
+static void tmp_round_to_significant_digits(const tmp_float_parts& parts, int significant_digits,
+                                            tmp_decimal* decimal) {
+    TM_ASSERT(significant_digits > 0);
+    if (parts.mantissa == 0) {
+        tmp_set_decimal(decimal, 0, 0);
+        return;
+    }
+
+    if (significant_digits <= 19) {
+        // Estimated decimal exponent is either exact or one too small.
+        int k = tmp_floor_log10_pow2(parts.exponent + tmp_bit_length(parts.mantissa) - 1);
+        for (int i = 0; i < 2; ++i, ++k) {
+            uint64_t scaled = 0;
+            if (!tmp_scale_and_round(parts.mantissa, parts.exponent, significant_digits - 1 - k, &scaled)) break;
+            if (scaled > tmp_powers_of_10[significant_digits]) continue;
+            tmp_set_decimal(decimal, scaled, k + 1 - significant_digits);
+            return;
+        }
+    }
+
+    tmp_exact_decimal(parts.mantissa, parts.exponent, decimal);
+    tmp_round_decimal(decimal, significant_digits);
+}
+
+// Rounds to fraction_digits digits after the decimal point.
+static void tmp_round_to_fraction_digits(const tmp_float_parts& parts, int fraction_digits, tmp_decimal* decimal) {
+    uint64_t scaled = 0;
+    if (tmp_scale_and_round(parts.mantissa, parts.exponent, fraction_digits, &scaled)) {
+        tmp_set_decimal(decimal, scaled, -fraction_digits);
+        return;
+    }
+
+    tmp_exact_decimal(parts.mantissa, parts.exponent, decimal);
+    if (fraction_digits < decimal->count - decimal->point) tmp_round_decimal(decimal, decimal->point + fraction_digits);
+}
+
+// Grisu3, see "Printing Floating-Point Numbers Quickly and Accurately with Integers" by Florian Loitsch.
+struct tmp_diy_fp {
+    uint64_t f;
+    int e;
+};
+
+static tmp_diy_fp tmp_diy_fp_normalize(tmp_diy_fp value) {
+    TM_ASSERT(value.f != 0);
+    while (!(value.f & 0xFFC0000000000000ull)) {
+        value.f <<= 10;
+        value.e -= 10;
+    }
+    while (!(value.f & 0x8000000000000000ull)) {
+        value.f <<= 1;
+        --value.e;
+    }
+    return value;
+}
+
+// Upper 64 bits of the product, rounded.
+static tmp_diy_fp tmp_diy_fp_multiply(tmp_diy_fp a, tmp_diy_fp b) {
+    tmp_uint128 product = tmp_multiply_u64(a.f, b.f);
+    tmp_diy_fp result = {product.high + (product.low >> 63), a.e + b.e + 64};
+    return result;
+}
+
+struct tmp_cached_power {
+    uint64_t significand;
+    int16_t binary_exponent;
+    int16_t decimal_exponent;
+};
+
+// Normalized 64-bit approximations of 10^-348, 10^-340, ..., 10^340.
+static const tmp_cached_power tmp_cached_powers[] = {
+    {0xFA8FD5A0081C0288ull, -1220, -348},
+    {0xBAAEE17FA23EBF76ull, -1193, -340},
+    {0x8B16FB203055AC76ull, -1166, -332},
+    {0xCF42894A5DCE35EAull, -1140, -324},
+    {0x9A6BB0AA55653B2Dull, -1113, -316},
+    {0xE61ACF033D1A45DFull, -1087, -308},
+    {0xAB70FE17C79AC6CAull, -1060, -300},
+    {0xFF77B1FCBEBCDC4Full, -1034, -292},
+    {0xBE5691EF416BD60Cull, -1007, -284},
+    {0x8DD01FAD907FFC3Cull, -980, -276},
+    {0xD3515C2831559A83ull, -954, -268},
+    {0x9D71AC8FADA6C9B5ull, -927, -260},
+    {0xEA9C227723EE8BCBull, -901, -252},
+    {0xAECC49914078536Dull, -874, -244},
+    {0x823C12795DB6CE57ull, -847, -236},
+    {0xC21094364DFB5637ull, -821, -228},
+    {0x9096EA6F3848984Full, -794, -220},
+    {0xD77485CB25823AC7ull, -768, -212},
+    {0xA086CFCD97BF97F4ull, -741, -204},
+    {0xEF340A98172AACE5ull, -715, -196},
+    {0xB23867FB2A35B28Eull, -688, -188},
+    {0x84C8D4DFD2C63F3Bull, -661, -180},
+    {0xC5DD44271AD3CDBAull, -635, -172},
+    {0x936B9FCEBB25C996ull, -608, -164},
+    {0xDBAC6C247D62A584ull, -582, -156},
+    {0xA3AB66580D5FDAF6ull, -555, -148},
+    {0xF3E2F893DEC3F126ull, -529, -140},
+    {0xB5B5ADA8AAFF80B8ull, -502, -132},
+    {0x87625F056C7C4A8Bull, -475, -124},
+    {0xC9BCFF6034C13053ull, -449, -116},
+    {0x964E858C91BA2655ull, -422, -108},
+    {0xDFF9772470297EBDull, -396, -100},
+    {0xA6DFBD9FB8E5B88Full, -369, -92},
+    {0xF8A95FCF88747D94ull, -343, -84},
+    {0xB94470938FA89BCFull, -316, -76},
+    {0x8A08F0F8BF0F156Bull, -289, -68},
+    {0xCDB02555653131B6ull, -263, -60},
+    {0x993FE2C6D07B7FACull, -236, -52},
+    {0xE45C10C42A2B3B06ull, -210, -44},
+    {0xAA242499697392D3ull, -183, -36},
+    {0xFD87B5F28300CA0Eull, -157, -28},
+    {0xBCE5086492111AEBull, -130, -20},
+    {0x8CBCCC096F5088CCull, -103, -12},
+    {0xD1B71758E219652Cull, -77, -4},
+    {0x9C40000000000000ull, -50, 4},
+    {0xE8D4A51000000000ull, -24, 12},
+    {0xAD78EBC5AC620000ull, 3, 20},
+    {0x813F3978F8940984ull, 30, 28},
+    {0xC097CE7BC90715B3ull, 56, 36},
+    {0x8F7E32CE7BEA5C70ull, 83, 44},
+    {0xD5D238A4ABE98068ull, 109, 52},
+    {0x9F4F2726179A2245ull, 136, 60},
+    {0xED63A231D4C4FB27ull, 162, 68},
+    {0xB0DE65388CC8ADA8ull, 189, 76},
+    {0x83C7088E1AAB65DBull, 216, 84},
+    {0xC45D1DF942711D9Aull, 242, 92},
+    {0x924D692CA61BE758ull, 269, 100},
+    {0xDA01EE641A708DEAull, 295, 108},
+    {0xA26DA3999AEF774Aull, 322, 116},
+    {0xF209787BB47D6B85ull, 348, 124},
+    {0xB454E4A179DD1877ull, 375, 132},
+    {0x865B86925B9BC5C2ull, 402, 140},
+    {0xC83553C5C8965D3Dull, 428, 148},
+    {0x952AB45CFA97A0B3ull, 455, 156},
+    {0xDE469FBD99A05FE3ull, 481, 164},
+    {0xA59BC234DB398C25ull, 508, 172},
+    {0xF6C69A72A3989F5Cull, 534, 180},
+    {0xB7DCBF5354E9BECEull, 561, 188},
+    {0x88FCF317F22241E2ull, 588, 196},
+    {0xCC20CE9BD35C78A5ull, 614, 204},
+    {0x98165AF37B2153DFull, 641, 212},
+    {0xE2A0B5DC971F303Aull, 667, 220},
+    {0xA8D9D1535CE3B396ull, 694, 228},
+    {0xFB9B7CD9A4A7443Cull, 720, 236},
+    {0xBB764C4CA7A44410ull, 747, 244},
+    {0x8BAB8EEFB6409C1Aull, 774, 252},
+    {0xD01FEF10A657842Cull, 800, 260},
+    {0x9B10A4E5E9913129ull, 827, 268},
+    {0xE7109BFBA19C0C9Dull, 853, 276},
+    {0xAC2820D9623BF429ull, 880, 284},
+    {0x80444B5E7AA7CF85ull, 907, 292},
+    {0xBF21E44003ACDD2Dull, 933, 300},
+    {0x8E679C2F5E44FF8Full, 960, 308},
+    {0xD433179D9C8CB841ull, 986, 316},
+    {0x9E19DB92B4E31BA9ull, 1013, 324},
+    {0xEB96BF6EBADF77D9ull, 1039, 332},
+    {0xAF87023B9BF0EE6Bull, 1066, 340},
+};
+
+static const uint32_t tmp_small_powers_of_10[] = {1u,      10u,      100u,      1000u,      10000u,
+                                                  100000u, 1000000u, 10000000u, 100000000u, 1000000000u};
+
+static bool tmp_grisu_round_weed(char* buffer, int length, uint64_t distance_too_high_w, uint64_t unsafe_interval,
+                                 uint64_t rest, uint64_t ten_kappa, uint64_t unit) {
+    const uint64_t small_distance = distance_too_high_w - unit;
+    const uint64_t big_distance = distance_too_high_w + unit;
+    // Move the last digit down as long as the result gets closer to the value.
+    while (rest < small_distance && unsafe_interval - rest >= ten_kappa &&
+           (rest + ten_kappa < small_distance || small_distance - rest >= rest + ten_kappa - small_distance)) {
+        --buffer[length - 1];
+        rest += ten_kappa;
+    }
+    // Fail if the imprecision of the computation doesn't allow to decide which candidate is closest.
+    if (rest < big_distance && unsafe_interval - rest >= ten_kappa &&
+        (rest + ten_kappa < big_distance || big_distance - rest > rest + ten_kappa - big_distance)) {
+        return false;
+    }
+    return (2 * unit <= rest) && (rest <= unsafe_interval - 4 * unit);
+}
+
+static bool tmp_grisu_digit_gen(tmp_diy_fp low, tmp_diy_fp w, tmp_diy_fp high, char* buffer, int* length,
+                                int* kappa) {
+    TM_ASSERT(low.e == w.e && w.e == high.e);
+    TM_ASSERT(w.e >= -60 && w.e <= -32);
+
+    uint64_t unit = 1;
+    const uint64_t too_low = low.f - unit;
+    const uint64_t too_high = high.f + unit;
+    uint64_t unsafe_interval = too_high - too_low;
+
+    const int one_shift = -w.e;
+    const uint64_t one = 1ull << one_shift;
+    uint32_t integrals = (uint32_t)(too_high >> one_shift);
+    uint64_t fractionals = too_high & (one - 1);
+
+    int divisor_exponent_plus_one = 10;
+    while (divisor_exponent_plus_one > 0 && integrals < tmp_small_powers_of_10[divisor_exponent_plus_one - 1]) {
+        --divisor_exponent_plus_one;
+    }
+    uint32_t divisor = (divisor_exponent_plus_one > 0) ? tmp_small_powers_of_10[divisor_exponent_plus_one - 1] : 0;
+
+    *kappa = divisor_exponent_plus_one;
+    *length = 0;
+    while (*kappa > 0) {
+        buffer[(*length)++] = (char)('0' + integrals / divisor);
+        integrals %= divisor;
+        --*kappa;
+        uint64_t rest = ((uint64_t)integrals << one_shift) + fractionals;
+        if (rest < unsafe_interval) {
+            return tmp_grisu_round_weed(buffer, *length, too_high - w.f, unsafe_interval, rest,
+                                        (uint64_t)divisor << one_shift, unit);
+        }
+        divisor /= 10;
+    }
+
+    for (;;) {
+        fractionals *= 10;
+        unit *= 10;
+        unsafe_interval *= 10;
+        buffer[(*length)++] = (char)('0' + (fractionals >> one_shift));
+        fractionals &= one - 1;
+        --*kappa;
+        if (fractionals < unsafe_interval) {
+            return tmp_grisu_round_weed(buffer, *length, (too_high - w.f) * unit, unsafe_interval, fractionals, one,
+                                        unit);
+        }
+        if (*length >= 20) return false;
+    }
+}
+
+static bool tmp_grisu3(const tmp_float_parts& parts, tmp_decimal* decimal) {
+    const uint64_t m = parts.mantissa;
+    const int e = parts.exponent;
+
+    tmp_diy_fp w = tmp_diy_fp_normalize({m, e});
+    tmp_diy_fp plus = tmp_diy_fp_normalize({(m << 1) + 1, e - 1});
+    tmp_diy_fp minus = (parts.lower_boundary_is_closer) ? tmp_diy_fp{(m << 2) - 1, e - 2}
+                                                         : tmp_diy_fp{(m << 1) - 1, e - 1};
+    minus.f <<= minus.e - plus.e;
+    minus.e = plus.e;
+    TM_ASSERT(w.e == plus.e);
+
+    // Find a cached power that brings the exponent of the scaled values into [-60, -32].
+    const int alpha = -60;
+    const int gamma = -32;
+    const int count = (int)(sizeof(tmp_cached_powers) / sizeof(tmp_cached_powers[0]));
+    const int k = -tmp_floor_log10_pow2(-(alpha - (w.e + 64) + 63));
+    int index = (348 + k - 1) / 8 + 1;
+    if (index < 0) index = 0;
+    if (index >= count) index = count - 1;
+    while (index > 0 && w.e + tmp_cached_powers[index].binary_exponent + 64 > gamma) --index;
+    while (index + 1 < count && w.e + tmp_cached_powers[index].binary_exponent + 64 < alpha) ++index;
+    const tmp_cached_power& cached = tmp_cached_powers[index];
+    const tmp_diy_fp power = {cached.significand, cached.binary_exponent};
+
+    int length = 0;
+    int kappa = 0;
+    if (!tmp_grisu_digit_gen(tmp_diy_fp_multiply(minus, power), tmp_diy_fp_multiply(w, power),
+                             tmp_diy_fp_multiply(plus, power), decimal->digits, &length, &kappa)) {
+        return false;
+    }
+    decimal->count = length;
+    decimal->point = length + kappa - cached.decimal_exponent;
+    tmp_trim_trailing_zeros(decimal);
+    return true;
+}
+
+// Exact shortest representation, used when Grisu3 fails.
+// The candidates with n digits next to the value are checked against the exact rounding boundaries for increasing n.
+static void tmp_shortest_exact(const tmp_float_parts& parts, tmp_decimal* decimal) {
+    const uint64_t m = parts.mantissa;
+    const int e = parts.exponent;
+
+    char value_digits[TMP_EXACT_DIGITS_CAPACITY];
+    char low_digits[TMP_EXACT_DIGITS_CAPACITY];
+    char high_digits[TMP_EXACT_DIGITS_CAPACITY];
+    tmp_decimal value = {value_digits, 0, 0};
+    tmp_decimal low = {low_digits, 0, 0};
+    tmp_decimal high = {high_digits, 0, 0};
+    tmp_exact_decimal(m, e, &value);
+    if (parts.lower_boundary_is_closer) {
+        tmp_exact_decimal((m << 2) - 1, e - 2, &low);
+    } else {
+        tmp_exact_decimal((m << 1) - 1, e - 1, &low);
+    }
+    tmp_exact_decimal((m << 1) + 1, e - 1, &high);
+
+    // Boundaries round to the value when parsing if the mantissa is even (round half to even).
+    const bool inclusive = (m & 1) == 0;
+    int n = 1;
+    for (; n < value.count; ++n) {
+        TM_ASSERT(n < 32);
+        tmp_decimal down = {value.digits, n, value.point};
+
+        char up_digits[32];
+        tmp_decimal up = {up_digits, n, value.point};
+        TM_MEMCPY(up_digits, value.digits, (size_t)n);
+        int i = n - 1;
+        while (i >= 0 && up_digits[i] == '9') --i;
+        if (i < 0) {
+            up_digits[0] = '1';
+            up.count = 1;
+            ++up.point;
+        } else {
+            ++up_digits[i];
+            up.count = i + 1;
+        }
+
+        const int down_compare = tmp_compare_decimal(down, low);
+        const int up_compare = tmp_compare_decimal(up, high);
+        const bool down_valid = down_compare > 0 || (inclusive && down_compare == 0);
+        const bool up_valid = up_compare < 0 || (inclusive && up_compare == 0);
+        if (!down_valid && !up_valid) continue;
+
+        bool use_up = up_valid;
+        if (down_valid && up_valid) {
+            // Pick the closer one, ties go to the even digit.
+            const char next = value.digits[n];
+            use_up = next > '5' || (next == '5' && (n + 1 < value.count || ((value.digits[n - 1] - '0') & 1)));
+        }
+        const tmp_decimal& result = (use_up) ? up : down;
+        TM_MEMCPY(decimal->digits, result.digits, (size_t)result.count);
+        decimal->count = result.count;
+        decimal->point = result.point;
+        tmp_trim_trailing_zeros(decimal);
+        return;
+    }
+
+    // The exact value is the shortest representation.
+    TM_MEMCPY(decimal->digits, value.digits, (size_t)value.count);
+    decimal->count = value.count;
+    decimal->point = value.point;
+}
+
+static void tmp_shortest_decimal(const tmp_float_parts& parts, tmp_decimal* decimal) {
+    const uint64_t m = parts.mantissa;
+    const int e = parts.exponent;
+    if (m == 0) {
+        tmp_set_decimal(decimal, 0, 0);
+        return;
+    }
+
+    // Integers below 2^53 print all their digits, since neighbouring values are at most 1 apart.
+    if (e <= 0 && e > -64 && (m & ((1ull << -e) - 1)) == 0) {
+        tmp_set_decimal(decimal, m >> -e, 0);
+        return;
+    }
+
+    if (tmp_grisu3(parts, decimal)) return;
+    tmp_shortest_exact(parts, decimal);
+}
+
+static PrintFormattedResult tmp_print_fixed(char* dest, tm_size_t maxlen, const tmp_decimal& decimal,
+                                            int fraction_digits, bool negative) {
+    const tm_size_t integer_digits = (decimal.point > 0) ? (tm_size_t)decimal.point : 1;
+    const tm_size_t size =
+        (tm_size_t)negative + integer_digits + ((fraction_digits > 0) ? (tm_size_t)fraction_digits + 1 : 0);
+    if (size > maxlen) return {size, TM_ERANGE};
+
+    char* p = dest;
+    if (negative) *p++ = '-';
+    if (decimal.point > 0) {
+        int count = (decimal.point < decimal.count) ? decimal.point : decimal.count;
+        TM_MEMCPY(p, decimal.digits, (size_t)count);
+        p += count;
+        TM_MEMSET(p, '0', (size_t)(decimal.point - count));
+        p += decimal.point - count;
+    } else {
+        *p++ = '0';
+    }
+
+    if (fraction_digits > 0) {
+        *p++ = '.';
+        int leading_zeros = (decimal.point < 0) ? -decimal.point : 0;
+        if (leading_zeros > fraction_digits) leading_zeros = fraction_digits;
+        TM_MEMSET(p, '0', (size_t)leading_zeros);
+        p += leading_zeros;
+
+        int first = (decimal.point > 0) ? decimal.point : 0;
+        int count = (decimal.count > first) ? decimal.count - first : 0;
+        if (count > fraction_digits - leading_zeros) count = fraction_digits - leading_zeros;
+        TM_MEMCPY(p, decimal.digits + first, (size_t)count);
+        p += count;
+
+        int trailing_zeros = fraction_digits - leading_zeros - count;
+        TM_MEMSET(p, '0', (size_t)trailing_zeros);
+        p += trailing_zeros;
+    }
+    TM_ASSERT(p == dest + size);
+    return {size, TM_OK};
+}
+
+static PrintFormattedResult tmp_print_scientific(char* dest, tm_size_t maxlen, const tmp_decimal& decimal,
+                                                 int fraction_digits, bool negative, bool lowercase) {
+    const int exponent = (decimal.count > 0) ? decimal.point - 1 : 0;
+    const uint32_t abs_exponent = (uint32_t)((exponent < 0) ? -exponent : exponent);
+    char exponent_digits[20];
+    int exponent_count = tmp_write_digits(exponent_digits, abs_exponent);
+
+    // Exponent has at least two digits, like printf.
+    const int exponent_padding = (exponent_count < 2) ? 2 - exponent_count : 0;
+    const tm_size_t size = (tm_size_t)negative + 1 + ((fraction_digits > 0) ? (tm_size_t)fraction_digits + 1 : 0) +
+                           2 + (tm_size_t)(exponent_padding + exponent_count);
+    if (size > maxlen) return {size, TM_ERANGE};
+
+    char* p = dest;
+    if (negative) *p++ = '-';
+    *p++ = (decimal.count > 0) ? decimal.digits[0] : '0';
+    if (fraction_digits > 0) {
+        *p++ = '.';
+        int count = (decimal.count > 1) ? decimal.count - 1 : 0;
+        if (count > fraction_digits) count = fraction_digits;
+        TM_MEMCPY(p, decimal.digits + 1, (size_t)count);
+        p += count;
+        TM_MEMSET(p, '0', (size_t)(fraction_digits - count));
+        p += fraction_digits - count;
+    }
+    *p++ = (lowercase) ? 'e' : 'E';
+    *p++ = (exponent < 0) ? '-' : '+';
+    TM_MEMSET(p, '0', (size_t)exponent_padding);
+    p += exponent_padding;
+    TM_MEMCPY(p, exponent_digits, (size_t)exponent_count);
+    p += exponent_count;
+    TM_ASSERT(p == dest + size);
+    return {size, TM_OK};
+}
+
+// Hexadecimal output like printf %a without the "0x" prefix, which is added by PrintFlags::PrependHex.
+// Expects the parts of a double.
+static PrintFormattedResult tmp_print_hex_float(char* dest, tm_size_t maxlen, const tmp_float_parts& parts,
+                                                int precision, bool lowercase) {
+    const int mantissa_digits = 13;
+    uint32_t leading = 0;
+    uint64_t fraction = 0;
+    int exponent = 0;
+    if (parts.mantissa >= (1ull << 52)) {
+        leading = 1;
+        fraction = parts.mantissa & 0xFFFFFFFFFFFFFull;
+        exponent = parts.exponent + 52;
+    } else if (parts.mantissa != 0) {
+        // Subnormals are printed with a leading zero.
+        fraction = parts.mantissa;
+        exponent = -1022;
+    }
+
+    int fraction_digits = precision;
+    if (precision < 0) {
+        fraction_digits = mantissa_digits;
+        while (fraction_digits > 0 && ((fraction >> ((mantissa_digits - fraction_digits) * 4)) & 0xF) == 0) {
+            --fraction_digits;
+        }
+    } else if (precision < mantissa_digits) {
+        const int shift = (mantissa_digits - precision) * 4;
+        const uint64_t remainder = fraction & ((1ull << shift) - 1);
+        const uint64_t half = 1ull << (shift - 1);
+        fraction >>= shift;
+        const uint64_t last = (precision > 0) ? fraction : leading;
+        if (remainder > half || (remainder == half && (last & 1))) {
+            ++fraction;
+            if (fraction >> (precision * 4)) {
+                fraction = 0;
+                ++leading;
+            }
+        }
+    }
+
+    const int significant_digits = (fraction_digits < mantissa_digits) ? fraction_digits : mantissa_digits;
+    const uint32_t abs_exponent = (uint32_t)((exponent < 0) ? -exponent : exponent);
+    char exponent_digits[20];
+    const int exponent_count = tmp_write_digits(exponent_digits, abs_exponent);
+    const tm_size_t size = (tm_size_t)parts.negative + 1 +
+                           ((fraction_digits > 0) ? (tm_size_t)fraction_digits + 1 : 0) + 2 +
+                           (tm_size_t)exponent_count;
+    if (size > maxlen) return {size, TM_ERANGE};
+
+    const char* hex_digits = (lowercase) ? "0123456789abcdef" : "0123456789ABCDEF";
+    char* p = dest;
+    if (parts.negative) *p++ = '-';
+    *p++ = hex_digits[leading];
+    if (fraction_digits > 0) {
+        *p++ = '.';
+        // Fraction is aligned to mantissa_digits digits unless it was rounded to fewer digits.
+        const int fraction_width = (precision >= 0 && precision < mantissa_digits) ? precision : mantissa_digits;
+        for (int i = 0; i < significant_digits; ++i) {
+            *p++ = hex_digits[(fraction >> ((fraction_width - i - 1) * 4)) & 0xF];
+        }
+        TM_MEMSET(p, '0', (size_t)(fraction_digits - significant_digits));
+        p += fraction_digits - significant_digits;
+    }
+    *p++ = (lowercase) ? 'p' : 'P';
+    *p++ = (exponent < 0) ? '-' : '+';
+    TM_MEMCPY(p, exponent_digits, (size_t)exponent_count);
+    p += exponent_count;
+    TM_ASSERT(p == dest + size);
+    return {size, TM_OK};
+}
+
+static PrintFormattedResult tmp_print_non_finite(char* dest, tm_size_t maxlen, const tmp_float_parts& parts,
+                                                 bool uppercase) {
+    const char* str = (parts.is_inf) ? ((uppercase) ? "INF" : "inf") : ((uppercase) ? "NAN" : "nan");
+    const tm_size_t size = (tm_size_t)parts.negative + 3;
+    if (size > maxlen) return {size, TM_ERANGE};
+    char* p = dest;
+    if (parts.negative) *p++ = '-';
+    TM_MEMCPY(p, str, 3);
+    return {size, TM_OK};
+}
+
+static bool tmp_is_hex_float_format(unsigned int flags) {
+    return (flags & PrintFlags::Hex) && !(flags & PrintFlags::Scientific);
+}
+
+static PrintFormattedResult tmp_print_float(char* dest, tm_size_t maxlen, const tmp_float_parts& parts,
+                                            const PrintFormat& format) {
+    TM_ASSERT(!dest || maxlen > 0);
+    TM_ASSERT_VALID_SIZE(maxlen);
+
+    const unsigned int flags = format.flags;
+    const bool lowercase = (flags & PrintFlags::Lowercase) != 0;
+    const bool general = (flags & PrintFlags::General) == PrintFlags::General;
+    const bool scientific = !general && (flags & PrintFlags::Scientific);
+    const bool hex = tmp_is_hex_float_format(flags);
+
+    if (parts.is_inf || parts.is_nan) {
+        const bool uppercase = !lowercase && (flags & (PrintFlags::Scientific | PrintFlags::Hex));
+        return tmp_print_non_finite(dest, maxlen, parts, uppercase);
+    }
+    if (hex) return tmp_print_hex_float(dest, maxlen, parts, format.precision, lowercase);
+
+    char digits[TMP_EXACT_DIGITS_CAPACITY];
+    tmp_decimal decimal = {digits, 0, 0};
+    const int precision = format.precision;
+    const bool trim_zeros = (general || (flags & PrintFlags::Shortest)) && !(flags & PrintFlags::TrailingZeroes);
+
+    bool use_scientific = scientific;
+    int fraction_digits = 0;
+    if (precision < 0) {
+        tmp_shortest_decimal(parts, &decimal);
+        if (general) {
+            // Same choice as printf %g with the default precision.
+            const int exponent = (decimal.count > 0) ? decimal.point - 1 : 0;
+            use_scientific = exponent < -4 || exponent >= 6;
+        }
+        if (!use_scientific && parts.exponent > 0) {
+            // Integers that are too big to be represented exactly print their exact value instead of trailing zeros,
+            // since it is the closest representation with the same length.
+            tmp_exact_decimal(parts.mantissa, parts.exponent, &decimal);
+        }
+        fraction_digits = (use_scientific) ? decimal.count - 1 : decimal.count - decimal.point;
+    } else if (general) {
+        const int significant_digits = (precision > 0) ? precision : 1;
+        tmp_round_to_significant_digits(parts, significant_digits, &decimal);
+        const int exponent = (decimal.count > 0) ? decimal.point - 1 : 0;
+        use_scientific = exponent < -4 || exponent >= significant_digits;
+        fraction_digits = (use_scientific) ? significant_digits - 1 : significant_digits - 1 - exponent;
+    } else if (scientific) {
+        tmp_round_to_significant_digits(parts, precision + 1, &decimal);
+        fraction_digits = precision;
+    } else {
+        tmp_round_to_fraction_digits(parts, precision, &decimal);
+        fraction_digits = precision;
+    }
+
+    if (trim_zeros) {
+        const int needed = (use_scientific) ? decimal.count - 1 : decimal.count - decimal.point;
+        if (fraction_digits > needed) fraction_digits = needed;
+    }
+    if (fraction_digits < 0) fraction_digits = 0;
+
+    if (use_scientific) {
+        return tmp_print_scientific(dest, maxlen, decimal, fraction_digits, parts.negative, lowercase);
+    }
+    return tmp_print_fixed(dest, maxlen, decimal, fraction_digits, parts.negative);
+}
+
+static PrintFormattedResult tmp_print_value(char* dest, tm_size_t maxlen, double value, const PrintFormat& format) {
+    return tmp_print_float(dest, maxlen, tmp_decompose_float(value), format);
+}
+static PrintFormattedResult tmp_print_value(char* dest, tm_size_t maxlen, float value, const PrintFormat& format) {
+    // Hexadecimal output of floats is the same as for doubles, like printf does after promoting float to double.
+    if (tmp_is_hex_float_format(format.flags)) {
+        return tmp_print_float(dest, maxlen, tmp_decompose_float((double)value), format);
+    }
+    return tmp_print_float(dest, maxlen, tmp_decompose_float(value), format);
+}
@@ -25,5 +25,5 @@ static PrintFormattedResult tmp_print_value(char* dest, tm_size_t maxlen, double
     return print_double(dest, maxlen, value, tmp_convert_flags(format.flags), format.precision);
 }
 static PrintFormattedResult tmp_print_value(char* dest, tm_size_t maxlen, float value, const PrintFormat& format) {
-    return print_double(dest, maxlen, (double)value, tmp_convert_flags(format.flags), format.precision);
+    return print_float(dest, maxlen, value, tmp_convert_flags(format.flags), format.precision);
 }
\ No newline at end of file
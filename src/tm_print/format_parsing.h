@@ -0,0 +1,315 @@
+// Format string parsing shared by runtime printing and compile time parsed format strings (see TMP_FMT).
+// These are constexpr when TMP_COMPILE_TIME_FORMAT is defined.
+
+inline TMP_CONSTEXPR14 tm_size_t tmp_scan_decimal_u32(const char* first, const char* last, uint32_t* out) {
+    uint32_t value = 0;
+    const char* p = first;
+    for (; p < last && *p >= '0' && *p <= '9'; ++p) {
+        uint32_t digit = (uint32_t)(*p - '0');
+        // Overflow is treated the same as no digits at all.
+        if (value > (0xFFFFFFFFu - digit) / 10) return 0;
+        value = value * 10 + digit;
+    }
+    if (p != first) *out = value;
+    return (tm_size_t)(p - first);
+}
+
+inline TMP_CONSTEXPR14 tm_size_t tmp_parse_print_format_internal(const char* format_specifiers,
+                                                                 tm_size_t format_specifiers_len, PrintFormat* out) {
+    *out = default_print_format();
+    unsigned int flags = PrintFlags::Default;
+
+    // Pad with spaces by default.
+    flags |= PrintFlags::PadWithSpaces;
+
+    const char* p = format_specifiers;
+    const char* last = p + format_specifiers_len;
+
+    bool pound_specified = false;
+
+    for (bool parseFlags = true; p < last && parseFlags;) {
+        switch (*p) {
+            case '-': {
+                flags |= PrintFlags::LeftJustify;
+                ++p;
+                break;
+            }
+            case '+': {
+                flags |= PrintFlags::Sign;
+                ++p;
+                break;
+            }
+            case ' ': {
+                flags |= PrintFlags::PadWithSpaces;
+                ++p;
+                break;
+            }
+            case '#': {
+                pound_specified = true;
+                ++p;
+                break;
+            }
+            case '0': {
+                flags &= ~PrintFlags::PadWithSpaces;
+                ++p;
+                break;
+            }
+            default: {
+                parseFlags = false;
+                break;
+            }
+        }
+    }
+
+    // Parse width.
+    uint32_t width = (uint32_t)out->width;
+    p += tmp_scan_decimal_u32(p, last, &width);
+    out->width = (int)width;
+
+    // Parse precision.
+    if (p < last && *p == '.') {
+        ++p;
+        uint32_t precision = (uint32_t)out->precision;
+        p += tmp_scan_decimal_u32(p, last, &precision);
+        out->precision = (int)precision;
+    }
+
+    if (p < last) {
+        switch (*p) {
+            case 'x': {
+                flags |= PrintFlags::Lowercase;
+                out->base = 16;
+                if (pound_specified) flags |= PrintFlags::PrependHex;
+                ++p;
+                break;
+            }
+            case 'X': {
+                out->base = 16;
+                if (pound_specified) flags |= PrintFlags::PrependHex;
+                ++p;
+                break;
+            }
+            case 'o': {
+                out->base = 8;
+                if (pound_specified) flags |= PrintFlags::PrependOctal;
+                ++p;
+                break;
+            }
+            case 'b': {
+                flags |= PrintFlags::Lowercase;
+                out->base = 2;
+                if (pound_specified) flags |= PrintFlags::PrependBinary;
+                ++p;
+                break;
+            }
+            case 'B': {
+                out->base = 2;
+                if (pound_specified) flags |= PrintFlags::PrependBinary;
+                ++p;
+                break;
+            }
+            case 'c': {
+                flags |= PrintFlags::Char;
+                ++p;
+                break;
+            }
+
+            // floating point
+            case 'e': {
+                flags |= PrintFlags::Lowercase;
+                flags |= PrintFlags::Scientific;
+                ++p;
+                break;
+            }
+            case 'E': {
+                flags |= PrintFlags::Scientific;
+                ++p;
+                break;
+            }
+            case 'f': {
+                flags |= PrintFlags::TrailingZeroes | PrintFlags::Fixed;
+                ++p;
+                break;
+            }
+            case 'g': {
+                flags |= PrintFlags::Lowercase;
+                flags |= PrintFlags::General;
+                flags |= PrintFlags::Shortest;
+                ++p;
+                break;
+            }
+            case 'G': {
+                flags |= PrintFlags::General;
+                flags |= PrintFlags::Shortest;
+                ++p;
+                break;
+            }
+            case 'a': {
+                flags |= PrintFlags::Lowercase;
+                flags |= PrintFlags::Hex;
+                if (pound_specified) flags |= PrintFlags::PrependHex;
+                ++p;
+                break;
+            }
+            case 'A': {
+                flags |= PrintFlags::Hex;
+                if (pound_specified) flags |= PrintFlags::PrependHex;
+                ++p;
+                break;
+            }
+
+            // Non printf.
+            case 'n': {
+                flags |= PrintFlags::BoolAsNumber;
+                ++p;
+                break;
+            }
+        }
+    }
+
+    out->flags = flags;
+    return (tm_size_t)(p - format_specifiers);
+}
+
+struct tmp_parse_format_result {
+    tm_size_t count;
+    tm_errc ec;
+};
+
+inline TMP_CONSTEXPR14 void tmp_push_format_segment(tmp_parse_format_result* result, tmp_format_segment* out,
+                                                    tm_size_t out_len, const tmp_format_segment& segment) {
+    if (out && result->count < out_len) out[result->count] = segment;
+    ++result->count;
+}
+
+inline TMP_CONSTEXPR14 void tmp_push_format_literal(tmp_parse_format_result* result, tmp_format_segment* out,
+                                                    tm_size_t out_len, const char* format, const char* first,
+                                                    const char* last) {
+    if (first >= last) return;
+    tmp_format_segment segment = {(tm_size_t)(first - format), (tm_size_t)(last - first), -1, PrintFormat{}};
+    tmp_push_format_segment(result, out, out_len, segment);
+}
+
+/*
+Splits a format string into literal runs and placeholders.
+Escaped '{{' and '}}' become part of the literal runs, placeholders without format specifiers use initial_formatting.
+Params:
+    out:     Output segments, can be nullptr to only count the segments.
+    out_len: Capacity of out. Segments that don't fit are counted but not written.
+Result:
+    Number of segments and TM_EINVAL if there are unmatched '{' or '}'.
+*/
+inline TMP_CONSTEXPR14 tmp_parse_format_result tmp_parse_format_segments(const char* format, tm_size_t format_len,
+                                                                         const PrintFormat& initial_formatting,
+                                                                         tmp_format_segment* out, tm_size_t out_len) {
+    tmp_parse_format_result result = {0, TM_OK};
+
+    PrintFormat placeholder_format = initial_formatting;
+    // Sanitize flags.
+    placeholder_format.flags &= ((1u << PrintFlags::Count) - 1);
+
+    uint32_t next_index = 0;
+    const char* first = format;
+    const char* p = format;
+    const char* last = format + format_len;
+    while (p < last) {
+        if (*p != '{' && *p != '}') {
+            ++p;
+            continue;
+        }
+
+        if (p + 1 < last && p[1] == *p) {
+            // Escaped brace, the first brace is kept as part of the literal run.
+            tmp_push_format_literal(&result, out, out_len, format, first, p + 1);
+            p += 2;
+            first = p;
+            continue;
+        }
+        if (*p == '}') {
+            result.ec = TM_EINVAL;
+            return result;
+        }
+
+        tmp_push_format_literal(&result, out, out_len, format, first, p);
+        const char* specifiers = p + 1;
+        const char* specifiers_last = specifiers;
+        while (specifiers_last < last && *specifiers_last != '}') ++specifiers_last;
+        if (specifiers_last >= last) {
+            result.ec = TM_EINVAL;
+            return result;
+        }
+
+        uint32_t index = next_index;
+        tm_size_t index_len = tmp_scan_decimal_u32(specifiers, specifiers_last, &index);
+        if (index_len == 0) ++next_index;
+        specifiers += index_len;
+
+        tmp_format_segment segment = {0, 0, (int)index, placeholder_format};
+        if (specifiers < specifiers_last && *specifiers == ':') {
+            ++specifiers;
+            tmp_parse_print_format_internal(specifiers, (tm_size_t)(specifiers_last - specifiers), &segment.format);
+        }
+        tmp_push_format_segment(&result, out, out_len, segment);
+
+        p = specifiers_last + 1;
+        first = p;
+    }
+    tmp_push_format_literal(&result, out, out_len, format, first, last);
+    return result;
+}
+
+enum tmp_format_check_result {
+    tmp_format_valid,
+    tmp_format_index_out_of_range,
+    tmp_format_type_mismatch,
+};
+
+// Whether the format specifiers of a placeholder make sense for the PrintType of its argument.
+inline TMP_CONSTEXPR14 bool tmp_format_matches_type(const PrintFormat& format, uint64_t type) {
+    // Flags that are set by default are not considered to be specified.
+    const unsigned int flags = format.flags & ~(unsigned int)PrintFlags::Default;
+    const unsigned int float_flags = PrintFlags::Fixed | PrintFlags::Scientific | PrintFlags::Hex;
+    const bool has_base = format.base != 10;
+    switch (type) {
+        case PrintType::Char: {
+            return !(flags & (float_flags | PrintFlags::BoolAsNumber));
+        }
+        case PrintType::Bool: {
+            return !has_base && !(flags & (float_flags | PrintFlags::Char));
+        }
+        case PrintType::Int32:
+        case PrintType::UInt32:
+        case PrintType::Int64:
+        case PrintType::UInt64: {
+            return !(flags & (float_flags | PrintFlags::Char | PrintFlags::BoolAsNumber));
+        }
+        case PrintType::Float:
+        case PrintType::Double: {
+            return !has_base && !(flags & (PrintFlags::Char | PrintFlags::BoolAsNumber));
+        }
+        case PrintType::String:
+        case PrintType::StringView: {
+            return !has_base && !(flags & (float_flags | PrintFlags::Char | PrintFlags::BoolAsNumber));
+        }
+        default: {
+            // Custom printers decide for themselves what to do with format specifiers.
+            return true;
+        }
+    }
+}
+
+// Checks placeholders against the argument types, see PrintArgList::flags and PrintArgList::types.
+inline TMP_CONSTEXPR14 int tmp_check_format_segments(const tmp_format_segment* segments, tm_size_t segments_count,
+                                                     uint64_t types, const unsigned char* extended_types,
+                                                     tm_size_t args_count) {
+    for (tm_size_t i = 0; i < segments_count; ++i) {
+        const tmp_format_segment& segment = segments[i];
+        if (segment.arg_index < 0) continue;
+        if ((tm_size_t)segment.arg_index >= args_count) return tmp_format_index_out_of_range;
+        uint64_t type = (extended_types)
+                            ? extended_types[segment.arg_index]
+                            : ((types >> ((unsigned int)segment.arg_index * PrintType::Bits)) & PrintType::Mask);
+        if (!tmp_format_matches_type(segment.format, type)) return tmp_format_type_mismatch;
+    }
+    return tmp_format_valid;
+}
@@ -247,6 +247,12 @@ static PrintFormattedResult tmp_move_printed_value_and_decorate(char* dest, tm_s
     TM_ASSERT(sizes.size >= sizes.digits);
     TM_ASSERT(sizes.decorated >= sizes.digits);
 
+    if (sizes.size > maxlen) {
+        print_result.size = sizes.size;
+        print_result.ec = TM_ERANGE;
+        return print_result;
+    }
+
     tm_size_t digits_pos = 0;
     if (width <= 0 || (format.flags & PrintFlags::LeftJustify)) {
         digits_pos = sizes.decorated - sizes.digits;
@@ -259,12 +265,6 @@ static PrintFormattedResult tmp_move_printed_value_and_decorate(char* dest, tm_s
             TM_MEMMOVE(dest + digits_pos, dest + sign, sizes.digits);
         }
     }
-
-    if (sizes.size > maxlen) {
-        print_result.size = sizes.size;
-        print_result.ec = TM_ERANGE;
-        return print_result;
-    }
     tmp_print_decoration(dest, maxlen, sizes, format, negative);
     print_result.size = sizes.size;
     return print_result;
@@ -294,6 +294,10 @@ static PrintFormattedResult tmp_move_printed_value_and_decorate(char* dest, tm_s
 #include "float_backend_charconv.cpp"
 #endif  // defined(TMP_FLOAT_BACKEND_CHARCONV)
 
+#ifdef TMP_FLOAT_BACKEND_BUILTIN
+#include "float_backend_builtin.cpp"
+#endif  // defined(TMP_FLOAT_BACKEND_BUILTIN)
+
 template <class T>
 static PrintFormattedResult tmp_print_formatted(char* dest, tm_size_t maxlen, const PrintFormat& format, T value) {
     TM_ASSERT(dest || maxlen == 0);
@@ -310,32 +314,33 @@ static PrintFormattedResult tmp_print_formatted(char* dest, tm_size_t maxlen, co
 
 #include "allocator_context.cpp"
 #include "memory_printer.cpp"
+#include "output_sink.cpp"
+#include "scratch_printer.cpp"
 
 static const char* tmp_find(const char* first, const char* last, char c) {
     return (const char*)TM_MEMCHR(first, c, last - first);
 }
 
-static bool tmp_print_string_escaped(const char* first, const char* last, tmp_memory_printer& printout) {
-    const char* p = first;
-    while ((p = tmp_find(first, last, '}')) != nullptr) {
-        // Print string including '}'.
-        ++p;
-        if (!printout(first, (tm_size_t)(p - first))) return false;
-
-        // Check for unescaped '}'.
-        if (p >= last || *p != '}') {
-            printout.ec = TM_EINVAL;
-            return false;
+// Finds the braces of a format string from left to right, every byte is scanned at most once for each brace.
+struct tmp_brace_finder {
+    const char* last;
+    const char* open = nullptr;  // The next '{' that was found, nullptr if there are none left.
+    bool open_valid = false;
+
+    explicit tmp_brace_finder(const char* last) : last(last) {}
+
+    // Finds the first '{' or '}' in [first, last), first must not be less than in previous calls.
+    const char* find(const char* first) {
+        // The position of the next '{' is remembered, so that literal runs with escaped '}}' in them aren't scanned
+        // for '{' again, '}' is only searched for up to that position.
+        if (!open_valid || (open && open < first)) {
+            open = tmp_find(first, last, '{');
+            open_valid = true;
         }
-        ++p;  // Skip escaped '}'.
-
-        first = p;
+        const char* close = tmp_find(first, (open) ? open : last, '}');
+        return (close) ? close : open;
     }
-    if (first < last) {
-        if (!printout(first, (tm_size_t)(last - first))) return false;
-    }
-    return true;
-}
+};
 
 static void tmp_print_impl(const char* format, size_t format_len, const PrintFormat& initial_formatting,
                            const PrintArgList& args, tmp_memory_printer& printout) {
@@ -346,19 +351,24 @@ static void tmp_print_impl(const char* format, size_t format_len, const PrintFor
     const char* format_last = format + format_len;
     auto index = 0u;
     const char* p = format_first;
-    uint64_t currentArgTypeFlags = args.flags;
-    while ((p = tmp_find(format_first, format_last, '{')) != nullptr) {
-        if (!tmp_print_string_escaped(format_first, p, printout)) return;
-        ++p;
-        if (*p == '{') {
-            if (!printout("{", 1)) return;
-            ++p;
+    tmp_brace_finder braces{format_last};
+    while ((p = braces.find(p)) != nullptr) {
+        if (p + 1 < format_last && p[1] == *p) {
+            // Escaped brace, print the literal run including one of the braces.
+            if (!printout(format_first, (tm_size_t)(p + 1 - format_first))) return;
+            p += 2;
             format_first = p;
             continue;
         }
+        if (*p == '}') {
+            printout.ec = TM_EINVAL;
+            return;
+        }
+        if (p > format_first && !printout(format_first, (tm_size_t)(p - format_first))) return;
+        ++p;
 
         // Parse until '}'.
-        auto next = tmp_find(format_first, format_last, '}');
+        auto next = tmp_find(p, format_last, '}');
         if (!next) {
             printout.ec = TM_EINVAL;
             return;
@@ -367,7 +377,6 @@ static void tmp_print_impl(const char* format, size_t format_len, const PrintFor
         PrintFormat print_format = initial_formatting;
         print_format.flags = format_flags;
         auto current_index = index;
-        auto current_arg_type = currentArgTypeFlags & PrintType::Mask;
         bool index_specified = tmp_parse_format_specifiers(p, (tm_size_t)(next - p), &print_format, &current_index);
         // Check whether specified index in format specifier is valid.
         if (current_index >= args.size) {
@@ -375,13 +384,10 @@ static void tmp_print_impl(const char* format, size_t format_len, const PrintFor
             return;
         }
 
-        if (!index_specified) {
-            ++index;
-            currentArgTypeFlags >>= PrintType::Bits;
-        } else {
-            current_arg_type = (args.flags >> (current_index * PrintType::Bits)) & PrintType::Mask;
-        }
-        format_first = next + 1;
+        if (!index_specified) ++index;
+        auto current_arg_type = tmp_get_arg_type(args, current_index);
+        p = next + 1;
+        format_first = p;
 
         // Check whether current arg type is a valid entry of PrintType.
         // This can happen if there are more unindexed '{}' placeholders than supplied arguments.
@@ -392,180 +398,59 @@ static void tmp_print_impl(const char* format, size_t format_len, const PrintFor
         if (!printout((int)current_arg_type, args.args[current_index], print_format)) return;
     }
     if (format_first < format_last) {
-        if (!tmp_print_string_escaped(format_first, format_last, printout)) return;
+        if (!printout(format_first, (tm_size_t)(format_last - format_first))) return;
     }
 }
 
-}  // anonymous namespace
-
-TMP_DEF tm_size_t tmp_parse_print_format(const char* format_specifiers, tm_size_t format_specifiers_len,
-                                         PrintFormat* out) {
-    TM_ASSERT(format_specifiers || format_specifiers_len == 0);
-    TM_ASSERT(out);
-    TM_ASSERT_VALID_SIZE(format_specifiers_len);
-
-    *out = default_print_format();
-    unsigned int flags = PrintFlags::Default;
-
-    // Pad with spaces by default.
-    flags |= PrintFlags::PadWithSpaces;
-
-    const char* p = format_specifiers;
-    const char* last = p + format_specifiers_len;
-
-    bool pound_specified = false;
-
-    for (bool parseFlags = true; p < last && parseFlags;) {
-        switch (*p) {
-            case '-': {
-                flags |= PrintFlags::LeftJustify;
-                ++p;
-                break;
-            }
-            case '+': {
-                flags |= PrintFlags::Sign;
-                ++p;
-                break;
-            }
-            case ' ': {
-                flags |= PrintFlags::PadWithSpaces;
-                ++p;
-                break;
-            }
-            case '#': {
-                pound_specified = true;
-                ++p;
-                break;
-            }
-            case '0': {
-                flags &= ~PrintFlags::PadWithSpaces;
-                ++p;
-                break;
-            }
-            default: {
-                parseFlags = false;
-                break;
-            }
+static void tmp_print_segments_impl(const char* format, const tmp_format_segment* segments, tm_size_t segments_count,
+                                    const PrintArgList& args, tmp_memory_printer& printout) {
+    for (tm_size_t i = 0; i < segments_count; ++i) {
+        const tmp_format_segment& segment = segments[i];
+        if (segment.arg_index < 0) {
+            if (!printout(format + segment.offset, segment.size)) return;
+            continue;
         }
-    }
-
-    // Parse width.
-    unsigned width = out->width;
-    auto scan_width_result = scan_u32_n(p, (tm_size_t)(last - p), &width, 10);
-    if (scan_width_result.ec == TM_OK) p += scan_width_result.size;
-    out->width = (int)width;
 
-    // Parse precision.
-    if (p < last && *p == '.') {
-        ++p;
-        unsigned precision = out->precision;
-        auto scan_precision_result = scan_u32_n(p, (tm_size_t)(last - p), &precision, 10);
-        if (scan_precision_result.ec == TM_OK) p += scan_precision_result.size;
-        out->precision = (int)precision;
+        // Segments were already validated against the arguments when they were made.
+        TM_ASSERT((unsigned int)segment.arg_index < args.size);
+        auto arg_type = tmp_get_arg_type(args, (unsigned int)segment.arg_index);
+        PrintFormat print_format = segment.format;
+        if (!printout((int)arg_type, args.args[segment.arg_index], print_format)) return;
     }
+}
 
-    if (p < last) {
-        switch (*p) {
-            case 'x': {
-                flags |= PrintFlags::Lowercase;
-                out->base = 16;
-                if (pound_specified) flags |= PrintFlags::PrependHex;
-                ++p;
-                break;
-            }
-            case 'X': {
-                out->base = 16;
-                if (pound_specified) flags |= PrintFlags::PrependHex;
-                ++p;
-                break;
-            }
-            case 'o': {
-                out->base = 8;
-                if (pound_specified) flags |= PrintFlags::PrependOctal;
-                ++p;
-                break;
-            }
-            case 'b': {
-                flags |= PrintFlags::Lowercase;
-                out->base = 2;
-                if (pound_specified) flags |= PrintFlags::PrependBinary;
-                ++p;
-                break;
-            }
-            case 'B': {
-                out->base = 2;
-                if (pound_specified) flags |= PrintFlags::PrependBinary;
-                ++p;
-                break;
-            }
-            case 'c': {
-                flags |= PrintFlags::Char;
-                ++p;
-                break;
-            }
-
-            // floating point
-            case 'e': {
-                flags |= PrintFlags::Lowercase;
-                flags |= PrintFlags::Scientific;
-                ++p;
-                break;
-            }
-            case 'E': {
-                flags |= PrintFlags::Scientific;
-                ++p;
-                break;
-            }
-            case 'f': {
-                flags |= PrintFlags::TrailingZeroes | PrintFlags::Fixed;
-                ++p;
-                break;
-            }
-            case 'g': {
-                flags |= PrintFlags::Lowercase;
-                flags |= PrintFlags::General;
-                flags |= PrintFlags::Shortest;
-                ++p;
-                break;
-            }
-            case 'G': {
-                flags |= PrintFlags::General;
-                flags |= PrintFlags::Shortest;
-                ++p;
-                break;
-            }
-            case 'a': {
-                flags |= PrintFlags::Lowercase;
-                flags |= PrintFlags::Hex;
-                if (pound_specified) flags |= PrintFlags::PrependHex;
-                ++p;
-                break;
-            }
-            case 'A': {
-                flags |= PrintFlags::Hex;
-                if (pound_specified) flags |= PrintFlags::PrependHex;
-                ++p;
-                break;
-            }
-
-            // Non printf.
-            case 'n': {
-                flags |= PrintFlags::BoolAsNumber;
-                ++p;
-                break;
-            }
+static int tmp_snprint_result(tmp_memory_printer& mem, char* dest, tm_size_t len) {
+    if (mem.ec == TM_OK) {
+        // Force null termination, overwriting last character if must be.
+        // This is also the behavior of snprintf, we want to imitate it to minimize surprises.
+        if (mem.remaining()) {
+            *mem.end() = 0;
+        } else {
+            if (dest && len > 0) dest[len - 1] = 0;
         }
+        return (int)mem.size;
     }
+    if (mem.ec == TM_ERANGE) return (int)mem.necessary;
+    return -1;
+}
+
+}  // anonymous namespace
 
-    out->flags = flags;
-    return (tm_size_t)(p - format_specifiers);
+TMP_DEF tm_size_t tmp_parse_print_format(const char* format_specifiers, tm_size_t format_specifiers_len,
+                                         PrintFormat* out) {
+    TM_ASSERT(format_specifiers || format_specifiers_len == 0);
+    TM_ASSERT(out);
+    TM_ASSERT_VALID_SIZE(format_specifiers_len);
+    return tmp_parse_print_format_internal(format_specifiers, format_specifiers_len, out);
 }
 
 #ifndef TMP_NO_CRT_FILE_PRINTING
 TMP_DEF tm_errc tmp_print(FILE* out, const char* format, size_t format_len, const PrintFormat& initial_formatting,
                           const PrintArgList& args) {
     char sbo[TMP_SBO_SIZE];
-    tmp_memory_printer printer = {sbo, TMP_SBO_SIZE, tmp_default_allocator()};
+    tmp_scratch_printer scratch = {sbo, TMP_SBO_SIZE, tmp_default_allocator(),
+                                   tmp_estimate_print_size(format_len, args)};
+    tmp_memory_printer& printer = scratch.printer;
 
     tmp_print_impl(format, format_len, initial_formatting, args, printer);
     fwrite(printer.data, sizeof(char), printer.size, out);
@@ -579,33 +464,175 @@ TMP_DEF int tmp_snprint(char* dest, tm_size_t len, const char* format, size_t fo
     TM_ASSERT(dest || len == 0);
     tmp_memory_printer mem{dest, len};
     tmp_print_impl(format, format_len, initial_formatting, args, mem);
-    if (mem.ec == TM_OK) {
-        // Force null termination, overwriting last character if must be.
-        // This is also the behavior of snprintf, we want to imitate it to minimize surprises.
-        if (mem.remaining()) {
-            *mem.end() = 0;
-        } else {
-            if (dest && len > 0) dest[len - 1] = 0;
-        }
-        return (int)mem.size;
+    return tmp_snprint_result(mem, dest, len);
+}
+
+#ifndef TMP_NO_CRT_FILE_PRINTING
+TMP_DEF tm_errc tmp_print_segments(FILE* out, const char* format, const tmp_format_segment* segments,
+                                   tm_size_t segments_count, const PrintArgList& args) {
+    TM_ASSERT(segments || segments_count == 0);
+    char sbo[TMP_SBO_SIZE];
+    tmp_scratch_printer scratch = {sbo, TMP_SBO_SIZE, tmp_default_allocator(),
+                                   tmp_estimate_print_size(segments, segments_count, args)};
+    tmp_memory_printer& printer = scratch.printer;
+
+    tmp_print_segments_impl(format, segments, segments_count, args, printer);
+    fwrite(printer.data, sizeof(char), printer.size, out);
+    return printer.ec;
+}
+#endif  // !defined(TMP_NO_CRT_FILE_PRINTING)
+
+TMP_DEF int tmp_snprint_segments(char* dest, tm_size_t len, const char* format, const tmp_format_segment* segments,
+                                 tm_size_t segments_count, const PrintArgList& args) {
+    TM_ASSERT_VALID_SIZE(len);
+    TM_ASSERT(dest || len == 0);
+    TM_ASSERT(segments || segments_count == 0);
+    tmp_memory_printer mem{dest, len};
+    tmp_print_segments_impl(format, segments, segments_count, args, mem);
+    return tmp_snprint_result(mem, dest, len);
+}
+
+TMP_DEF tm_errc tmp_print(tmp_output_sink* sink, const char* format, size_t format_len,
+                          const PrintFormat& initial_formatting, const PrintArgList& args) {
+    TM_ASSERT(sink);
+    tm_size_t original_size = sink->size;
+    tmp_memory_printer printer{sink};
+    tmp_print_impl(format, format_len, initial_formatting, args, printer);
+    return tmp_finish_sink_print(sink, printer, original_size);
+}
+
+TMP_DEF tm_errc tmp_print_segments(tmp_output_sink* sink, const char* format, const tmp_format_segment* segments,
+                                   tm_size_t segments_count, const PrintArgList& args) {
+    TM_ASSERT(sink);
+    TM_ASSERT(segments || segments_count == 0);
+    tm_size_t original_size = sink->size;
+    tmp_memory_printer printer{sink};
+    tmp_print_segments_impl(format, segments, segments_count, args, printer);
+    return tmp_finish_sink_print(sink, printer, original_size);
+}
+
+TMP_DEF tmp_compile_format_result tmp_compile_format(const char* format, tm_size_t format_len,
+                                                     const PrintFormat& initial_formatting, uint64_t types,
+                                                     const unsigned char* extended_types, unsigned int args_count) {
+    TM_ASSERT(format || format_len == 0);
+    TM_ASSERT_VALID_SIZE(format_len);
+    TM_ASSERT(extended_types || args_count <= PrintType::Count);
+
+    tmp_compile_format_result result = {{nullptr, nullptr, 0, types, nullptr, args_count}, TM_OK};
+    auto parsed = tmp_parse_format_segments(format, format_len, initial_formatting, nullptr, 0);
+    if (parsed.ec != TM_OK) {
+        result.ec = parsed.ec;
+        return result;
     }
-    if (mem.ec == TM_ERANGE) return (int)mem.necessary;
-    return -1;
+
+    // Segments, extended types and the copy of the format string share one allocation.
+    size_t segments_size = (size_t)parsed.count * sizeof(tmp_format_segment);
+    size_t extended_types_size = (extended_types) ? (size_t)args_count : 0;
+    char* block = (char*)TM_MALLOC(segments_size + extended_types_size + (size_t)format_len + 1,
+                                   alignof(tmp_format_segment));
+    if (!block) {
+        result.ec = TM_ENOMEM;
+        return result;
+    }
+    result.format.segments = (tmp_format_segment*)block;
+    if (extended_types) {
+        result.format.extended_types = (unsigned char*)(block + segments_size);
+        TM_MEMCPY(result.format.extended_types, extended_types, extended_types_size);
+    }
+    result.format.format = block + segments_size + extended_types_size;
+    if (format_len > 0) TM_MEMCPY(result.format.format, format, (size_t)format_len);
+    result.format.format[format_len] = 0;
+    result.format.segments_count = parsed.count;
+    tmp_parse_format_segments(result.format.format, format_len, initial_formatting, result.format.segments,
+                              parsed.count);
+
+    if (tmp_check_format_segments(result.format.segments, parsed.count, types, extended_types, args_count) !=
+        tmp_format_valid) {
+        tmp_destroy_compiled_format(&result.format);
+        result.ec = TM_EINVAL;
+    }
+    return result;
+}
+
+TMP_DEF void tmp_destroy_compiled_format(tmp_compiled_format* format) {
+    TM_ASSERT(format);
+    // Format string and segments are one allocation, segments is the start of it.
+    if (format->segments) TM_FREE(format->segments);
+    format->format = nullptr;
+    format->segments = nullptr;
+    format->extended_types = nullptr;
+    format->segments_count = 0;
+}
+
+TMP_DEF tmp_output_sink tmp_make_buffer_sink(char* buffer, tm_size_t capacity) {
+    TM_ASSERT(buffer || capacity == 0);
+    TM_ASSERT_VALID_SIZE(capacity);
+    return {buffer, 0, capacity, /*write=*/nullptr, /*context=*/nullptr, /*growable=*/false};
+}
+
+TMP_DEF tmp_output_sink tmp_make_growable_sink() {
+    return {/*data=*/nullptr, 0, 0, /*write=*/nullptr, /*context=*/nullptr, /*growable=*/true};
+}
+
+TMP_DEF tmp_output_sink tmp_make_writer_sink(char* buffer, tm_size_t capacity, tmp_sink_write_proc* write,
+                                             void* context) {
+    TM_ASSERT(buffer || capacity == 0);
+    TM_ASSERT_VALID_SIZE(capacity);
+    TM_ASSERT(write);
+    return {buffer, 0, capacity, write, context, /*growable=*/false};
+}
+
+#ifndef TMP_NO_CRT_FILE_PRINTING
+TMP_DEF tmp_output_sink tmp_make_file_sink(FILE* out, char* buffer, tm_size_t capacity) {
+    TM_ASSERT(out);
+    return tmp_make_writer_sink(buffer, capacity, tmp_sink_write_file, out);
+}
+#endif  // !defined(TMP_NO_CRT_FILE_PRINTING)
+
+#ifndef TMP_NO_FD_SINK
+TMP_DEF tmp_output_sink tmp_make_fd_sink(int fd, char* buffer, tm_size_t capacity) {
+    TM_ASSERT(fd >= 0);
+    return tmp_make_writer_sink(buffer, capacity, tmp_sink_write_fd, (void*)(intptr_t)fd);
+}
+#endif  // !defined(TMP_NO_FD_SINK)
+
+TMP_DEF tm_errc tmp_flush_sink(tmp_output_sink* sink) {
+    TM_ASSERT(sink);
+    if (!sink->write || sink->size <= 0) return TM_OK;
+    tm_errc result = sink->write(sink->context, sink->data, sink->size);
+    if (result == TM_OK) sink->size = 0;
+    return result;
+}
+
+TMP_DEF void tmp_destroy_sink(tmp_output_sink* sink) {
+    TM_ASSERT(sink);
+    if (sink->growable && sink->data) TM_FREE(sink->data);
+    sink->data = nullptr;
+    sink->size = 0;
+    sink->capacity = 0;
 }
 
 #ifdef TMP_USE_STL
 TMP_DEF ::std::string tmp_string_format(const char* format, size_t format_len, const PrintFormat& initial_formatting,
                                         const PrintArgList& args) {
     ::std::string result;
-    tmp_memory_printer mem{nullptr, 0, tmp_std_string_allocator(&result)};
-    tmp_print_impl(format, format_len, initial_formatting, args, mem);
-    if (mem.ec == TM_OK) {
-        // Resize resulting string to the actual size consumed by memory printer.
-        // Memory printer will allocate in advance and then might not use all of the capacity.
-        result.resize(mem.size);
-    } else {
-        result.clear();
-    }
+    char sbo[TMP_SBO_SIZE];
+    tmp_scratch_printer scratch = {sbo, TMP_SBO_SIZE, tmp_std_string_allocator(&result),
+                                   tmp_estimate_print_size(format_len, args)};
+    tmp_print_impl(format, format_len, initial_formatting, args, scratch.printer);
+    tmp_finish_string_format(scratch, &result);
+    return result;
+}
+
+TMP_DEF ::std::string tmp_string_format_segments(const char* format, const tmp_format_segment* segments,
+                                                 tm_size_t segments_count, const PrintArgList& args) {
+    TM_ASSERT(segments || segments_count == 0);
+    ::std::string result;
+    char sbo[TMP_SBO_SIZE];
+    tmp_scratch_printer scratch = {sbo, TMP_SBO_SIZE, tmp_std_string_allocator(&result),
+                                   tmp_estimate_print_size(segments, segments_count, args)};
+    tmp_print_segments_impl(format, segments, segments_count, args, scratch.printer);
+    tmp_finish_string_format(scratch, &result);
     return result;
 }
 #endif /* defined(TMP_USE_STL) */
@@ -1,5 +1,5 @@
 /*
-tm_print.h v0.0.22 - public domain - https://github.com/to-miz/tm
+tm_print.h v0.0.28 - public domain - https://github.com/to-miz/tm
 Author: Tolga Mizrak MERGE_YEAR
 
 No warranty; use at your own risk.
@@ -52,6 +52,21 @@ DESCRIPTION
         For bool:
         'n':        Outputs booleans as a number (either '0' or '1').
 
+    Format strings that are string literals can be parsed at compile time by wrapping them in TMP_FMT:
+        print(TMP_FMT("This is a placeholder: {}!"), "Hello");
+    The format string is then split into literal runs and placeholders once at compile time, so printing doesn't need
+    to parse it again. Placeholder indices and format specifiers are checked against the argument types with
+    static_assert, so a specifier like 'x' used on a double is a compile error instead of being silently ignored.
+    Needs C++14 constexpr support, define TMP_NO_COMPILE_TIME_FORMAT to disable it.
+
+    Format strings that are only known at runtime, like ones loaded from configuration files, can be parsed once
+    with compile_format and then printed many times without parsing them again:
+        auto compiled = compile_format<int, double>("{},{:.2f}\n");
+        if (compiled.ec == TM_OK) print(compiled.format, 1, 2.0);
+        tmp_destroy_compiled_format(&compiled.format);
+    The argument types are validated once by compile_format. Printing only checks that the types of the arguments
+    are the ones the format was compiled for.
+
 SWITCHES
     TMP_STRING_WIDTH:
         Represents a function with this signature:
@@ -74,6 +89,18 @@ SWITCHES
         A slightly better implementation can be found in <tm_unicode.h> as tmu_utf8_width_n for UTF-8 encoded strings,
         which uses sensible defaults for widths that are common when displayed.
 
+    TMP_SCRATCH_ARENA:
+        Printing into FILE* handles and std::string first prints into an intermediate buffer, which is the small
+        buffer on the stack or an allocation sized by estimating the output size from the arguments.
+        Define TMP_SCRATCH_ARENA to print into a buffer per thread instead, which is kept between calls so that
+        long output doesn't need to allocate every time. Needs thread_local support.
+        Define TMP_SCRATCH_ARENA_MAX_SIZE to limit how big the kept buffer can get, bigger buffers are freed after
+        the call that needed them (default 64 KiB).
+
+    TMP_NO_FD_SINK:
+        Disables tmp_make_fd_sink, which uses write from <unistd.h> or _write from <io.h> on Windows.
+        Alternatively define TMP_WRITE(fd, data, size) to use a different write function.
+
 ISSUES
     - The tm_conversion/charconv based implementation always outputs '.' as the decimal point character
       regardless of the locale, while the snprintf based output outputs the decimal point based on the
@@ -84,6 +111,16 @@ ISSUES
     - Types that are implicitly convertible to string_view produce errors currently.
 
 HISTORY
+    v0.0.28 19.10.26 Added TMP_SCRATCH_ARENA for printing into a buffer per thread that is reused between calls.
+                     Printing into FILE* and std::string sizes its buffer up front from the arguments.
+    v0.0.27 19.10.26 Added TMP_FLOAT_BACKEND_BUILTIN for correctly rounded and shortest round trip float output
+                     without dependencies.
+    v0.0.26 19.10.26 Lifted the limit of 16 arguments per print call.
+    v0.0.25 19.10.26 Added tmp_compiled_format for parsing format strings at runtime once and printing many times.
+    v0.0.24 19.10.26 Added tmp_output_sink for printing into buffers, files and file descriptors without an
+                     intermediate buffer.
+    v0.0.23 19.10.26 Added TMP_FMT for parsing format strings at compile time.
+                     Fixed escaped '}}' before a placeholder being mistaken for the end of the placeholder.
     v0.0.22 30.05.19 Fixed linking error due to missing inline specifier.
     v0.0.21 30.05.19 Made error codes depend on <errno.h> by default.
     v0.0.20 03.05.19 Added static asserts to sanity check tm_conversion.h backend print flags compatibility.
@@ -158,7 +195,7 @@ HISTORY
 #ifndef _TM_PRINT_H_INCLUDED_14E73C89_58CA_4CC4_9D19_99F0A3D7EA07_
 #define _TM_PRINT_H_INCLUDED_14E73C89_58CA_4CC4_9D19_99F0A3D7EA07_
 
-#define TMP_VERSION 0x00000016u
+#define TMP_VERSION 0x0000001Cu
 
 #include "dependencies_header.h"
 
@@ -167,6 +204,13 @@ HISTORY
     #define TMP_DEFAULT_FLAGS 0u
 #endif
 
+#if !defined(TMP_NO_COMPILE_TIME_FORMAT) && defined(__cpp_constexpr) && __cpp_constexpr >= 201304L
+    #define TMP_COMPILE_TIME_FORMAT
+    #define TMP_CONSTEXPR14 constexpr
+#else
+    #define TMP_CONSTEXPR14
+#endif
+
 // clang-format on
 
 namespace tml {
@@ -205,7 +249,7 @@ struct PrintFormat {
     unsigned int flags;
 };
 
-inline PrintFormat default_print_format() { return PrintFormat{10, 6, 0, PrintFlags::Default}; }
+inline TMP_CONSTEXPR14 PrintFormat default_print_format() { return PrintFormat{10, 6, 0, PrintFlags::Default}; }
 
 namespace PrintType {
 enum Values : uint64_t {
@@ -278,8 +322,24 @@ union PrintValue {
 
 struct PrintArgList {
     PrintValue* args;
-    uint64_t flags;
+    uint64_t flags;  // Types of the first PrintType::Count arguments, PrintType::Bits per argument.
     unsigned int size;
+    // Types of all arguments if there are more than PrintType::Count arguments, nullptr otherwise.
+    const unsigned char* types;
+};
+
+inline uint64_t tmp_get_arg_type(const PrintArgList& args, unsigned int index) {
+    TM_ASSERT(index < args.size);
+    if (args.types) return args.types[index];
+    return (args.flags >> (index * PrintType::Bits)) & PrintType::Mask;
+}
+
+// A preparsed part of a format string, either a run of literal characters or a placeholder.
+struct tmp_format_segment {
+    tm_size_t offset;    // Literal run: Offset into the format string.
+    tm_size_t size;      // Literal run: Length of the run.
+    int arg_index;       // Placeholder: Index of the argument to print, -1 for literal runs.
+    PrintFormat format;  // Placeholder: Format specifiers already resolved.
 };
 
 /*
@@ -290,8 +350,8 @@ Params:
     dest:   Output buffer. Can be nullptr iff len == 0.
     len:    Output buffer length.
     format: Format string. See DESCRIPTION for an explanation of how format strings are structured.
-    args:   Variadic arguments to be used when formatting. There can't be more than PrintFlags::Count
-            variadic arguments (by default this is 16). Use more than one call to snprint when needed instead.
+    args:   Variadic arguments to be used when formatting. Up to PrintType::Count (16) arguments have their types
+            packed into a single integer, more arguments use an additional static array of types.
 Result:
     Return value conforms to ::snprintf.
     Returns used size, if used size is < len.
@@ -336,11 +396,102 @@ TMP_DEF int tmp_snprint(char* dest, tm_size_t len, TM_STRING_VIEW format, const
 TMP_DEF tm_size_t tmp_parse_print_format(const char* format_specifiers, tm_size_t format_specifiers_len,
                                          PrintFormat* out);
 
+/*
+Output sinks:
+Printing into a sink formats directly into the buffer of the sink, without an intermediate buffer and without
+calling into the CRT on every print. Writer sinks only write out buffered output when the buffer is full or when
+tmp_flush_sink is called.
+    tmp_make_buffer_sink:   Prints into a fixed buffer, printing fails with TM_ERANGE when output doesn't fit.
+    tmp_make_growable_sink: Prints into an allocated buffer that grows as needed, free it with tmp_destroy_sink.
+    tmp_make_writer_sink:   Buffers output and calls write when the buffer is full.
+    tmp_make_file_sink:     Writer sink that writes into a FILE* handle, the stdio lock is taken once per flush.
+    tmp_make_fd_sink:       Writer sink that writes into a file descriptor using write, bypassing stdio entirely.
+A failed print leaves the sink as it was, except for writer sinks that already wrote out part of the output.
+Values that don't fit into the buffer of a writer sink at all are printed into a temporary allocation.
+Sinks are not thread safe, use one sink per thread.
+*/
+typedef tm_errc tmp_sink_write_proc(void* context, const char* data, tm_size_t size);
+
+struct tmp_output_sink {
+    char* data;
+    tm_size_t size;  // Amount of buffered output that wasn't written out yet.
+    tm_size_t capacity;
+    tmp_sink_write_proc* write;  // Writes out buffered output, nullptr if the sink doesn't write anywhere.
+    void* context;
+    bool growable;  // Whether data is allocated and owned by the sink.
+};
+
+TMP_DEF tmp_output_sink tmp_make_buffer_sink(char* buffer, tm_size_t capacity);
+TMP_DEF tmp_output_sink tmp_make_growable_sink();
+TMP_DEF tmp_output_sink tmp_make_writer_sink(char* buffer, tm_size_t capacity, tmp_sink_write_proc* write,
+                                             void* context);
+#ifndef TMP_NO_CRT_FILE_PRINTING
+TMP_DEF tmp_output_sink tmp_make_file_sink(FILE* out, char* buffer, tm_size_t capacity);
+#endif
+#ifndef TMP_NO_FD_SINK
+TMP_DEF tmp_output_sink tmp_make_fd_sink(int fd, char* buffer, tm_size_t capacity);
+#endif
+// Writes out buffered output of writer sinks. Does nothing for other sinks.
+TMP_DEF tm_errc tmp_flush_sink(tmp_output_sink* sink);
+// Frees the buffer of growable sinks. Buffered output of writer sinks is not flushed.
+TMP_DEF void tmp_destroy_sink(tmp_output_sink* sink);
+
+TMP_DEF tm_errc tmp_print(tmp_output_sink* sink, const char* format, size_t format_len,
+                          const PrintFormat& initial_formatting, const PrintArgList& args);
+
+// Format string that was parsed at runtime and validated against argument types, see compile_format.
+struct tmp_compiled_format {
+    char* format;  // Copy of the format string, segments point into it.
+    tmp_format_segment* segments;
+    tm_size_t segments_count;
+    uint64_t types;  // Packed argument types that the format was validated against, see PrintArgList::flags.
+    unsigned char* extended_types;  // Types of all arguments if there are more than PrintType::Count arguments.
+    unsigned int args_count;
+};
+
+struct tmp_compile_format_result {
+    tmp_compiled_format format;
+    tm_errc ec;
+};
+
+/*
+Parses a format string into a tmp_compiled_format and validates placeholders against argument types.
+Use the compile_format template instead to get the types from template arguments.
+Params:
+    initial_formatting: Formatting used for placeholders without format specifiers.
+    types:              Packed argument types, see PrintArgList::flags.
+    extended_types:     Types of all arguments if there are more than PrintType::Count, see PrintArgList::types.
+    args_count:         Number of arguments.
+Result:
+    TM_EINVAL if the format string is malformed or doesn't match the argument types, TM_ENOMEM if allocation failed.
+    The compiled format must be freed with tmp_destroy_compiled_format.
+*/
+TMP_DEF tmp_compile_format_result tmp_compile_format(const char* format, tm_size_t format_len,
+                                                     const PrintFormat& initial_formatting, uint64_t types,
+                                                     const unsigned char* extended_types, unsigned int args_count);
+TMP_DEF void tmp_destroy_compiled_format(tmp_compiled_format* format);
+
+// Printing from preparsed format segments, see tmp_parse_format_segments.
+// Segments are not validated against the arguments, this must be done when making the segments.
+#ifndef TMP_NO_CRT_FILE_PRINTING
+TMP_DEF tm_errc tmp_print_segments(FILE* out, const char* format, const tmp_format_segment* segments,
+                                   tm_size_t segments_count, const PrintArgList& args);
+#endif
+TMP_DEF tm_errc tmp_print_segments(tmp_output_sink* sink, const char* format, const tmp_format_segment* segments,
+                                   tm_size_t segments_count, const PrintArgList& args);
+TMP_DEF int tmp_snprint_segments(char* dest, tm_size_t len, const char* format, const tmp_format_segment* segments,
+                                 tm_size_t segments_count, const PrintArgList& args);
+#ifdef TMP_USE_STL
+TMP_DEF ::std::string tmp_string_format_segments(const char* format, const tmp_format_segment* segments,
+                                                 tm_size_t segments_count, const PrintArgList& args);
+#endif
+
 #ifdef TMP_USE_STL
 TMP_DEF ::std::string tmp_string_format(const char* format, size_t format_len, const PrintFormat& initial_formatting,
                                         const PrintArgList& args);
 #endif
 
+#include "format_parsing.h"
 #include "variadic_machinery.h"
 
 }  // namespace tml
@@ -35,17 +35,48 @@ struct tmp_memory_printer {
 
     tmp_allocator_context allocator;
 
+    // When printing into a sink, the printer starts out with the buffer of the sink.
+    tmp_output_sink* sink = nullptr;
+    bool drained = false;
+
     tmp_memory_printer(char* buffer, tm_size_t capacity, tmp_allocator_context allocator)
         : data(buffer), capacity(capacity), can_grow(true), allocator(allocator) {
         TM_ASSERT(allocator.reallocate);
         TM_ASSERT(allocator.destroy);
     }
     tmp_memory_printer(char* buffer, tm_size_t capacity) : data(buffer), capacity(capacity), can_grow(false) {}
+    explicit tmp_memory_printer(tmp_output_sink* sink)
+        : data(sink->data),
+          size(sink->size),
+          capacity(sink->capacity),
+          can_grow(sink->write || sink->growable),
+          owns(sink->growable && sink->data),
+          allocator(tmp_default_allocator()),
+          sink(sink) {}
     ~tmp_memory_printer() {
         if (owns) allocator.destroy(allocator.context, data, capacity);
     }
+    bool drain() {
+        TM_ASSERT(sink && sink->write);
+        if (size <= 0) return true;
+        tm_errc write_result = sink->write(sink->context, data, size);
+        if (write_result != TM_OK) {
+            ec = write_result;
+            return false;
+        }
+        size = 0;
+        drained = true;
+        return true;
+    }
     bool grow(tm_size_t by_at_least = 0) {
         TM_ASSERT(can_grow);
+        if (sink && sink->write && !owns) {
+            // Write out buffered output instead of growing. Only values that don't fit into the buffer of the sink
+            // at all fall back to allocating.
+            tm_size_t buffered = size;
+            if (!drain()) return false;
+            if (buffered > 0 && buffered >= by_at_least) return true;
+        }
         tm_size_t new_capacity = 3 * ((capacity + 2) / 2);
         if (new_capacity < capacity + by_at_least) new_capacity = capacity + by_at_least;
 
@@ -165,7 +196,7 @@ struct tmp_memory_printer {
     bool print_unsigned(T value, PrintFormat& format, bool negative) {
         auto sizes = tmp_get_print_sizes(value, format, negative);
         necessary += sizes.size;
-        if (sizes.size > remaining() && !(can_grow && grow(sizes.size))) {
+        if (sizes.size > remaining() && !(can_grow && grow(sizes.size - remaining()))) {
             if (!can_grow) {
                 ec = TM_ERANGE;
                 return true;
@@ -262,7 +293,7 @@ struct tmp_memory_printer {
                     return false;
                 }
                 if (can_grow && (tm_size_t)print_size > remaining()) {
-                    if (!grow(print_size)) return false;
+                    if (!grow((tm_size_t)print_size - remaining())) return false;
                     print_size = value.custom.customPrint(end(), remaining(), format, value.custom.data);
                 }
                 necessary += (tm_size_t)print_size;
@@ -288,7 +319,17 @@ struct tmp_memory_printer {
                 ec = TM_ERANGE;
                 return true;
             }
-            if (!grow(len)) return false;
+            if (sink && sink->write && !owns && len >= capacity) {
+                // Too big for the buffer of the sink, write it out directly instead of copying.
+                if (!drain()) return false;
+                tm_errc write_result = sink->write(sink->context, str, len);
+                if (write_result != TM_OK) {
+                    ec = write_result;
+                    return false;
+                }
+                return true;
+            }
+            if (!grow(len - remaining())) return false;
         }
         auto rem = remaining();
         auto print_size = TM_MIN(len, rem);
@@ -0,0 +1,52 @@
+#ifndef TMP_NO_CRT_FILE_PRINTING
+static tm_errc tmp_sink_write_file(void* context, const char* data, tm_size_t size) {
+    TM_ASSERT(context);
+    FILE* out = (FILE*)context;
+    if (fwrite(data, sizeof(char), (size_t)size, out) != (size_t)size) return TM_EIO;
+    return TM_OK;
+}
+#endif  // !defined(TMP_NO_CRT_FILE_PRINTING)
+
+#ifndef TMP_NO_FD_SINK
+static tm_errc tmp_sink_write_fd(void* context, const char* data, tm_size_t size) {
+    int fd = (int)(intptr_t)context;
+    while (size > 0) {
+        errno = 0;
+        auto written = TMP_WRITE(fd, data, size);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return (errno != 0) ? errno : TM_EIO;
+        }
+        // Nothing was written without an error, retrying would loop forever.
+        if (written == 0) return TM_EIO;
+        data += written;
+        size -= (tm_size_t)written;
+    }
+    return TM_OK;
+}
+#endif  // !defined(TMP_NO_FD_SINK)
+
+// Hands the buffer of the printer back to the sink after printing.
+static tm_errc tmp_finish_sink_print(tmp_output_sink* sink, tmp_memory_printer& printer, tm_size_t original_size) {
+    if (printer.ec == TM_OK && printer.owns && sink->write) {
+        // Output didn't fit into the buffer of the sink and was printed into an allocated buffer instead.
+        // The buffer of the sink was already drained at that point, so it is safe to write out the allocation.
+        printer.drain();
+    }
+    if (sink->growable) {
+        // The printer took over the allocation of the sink, since it might have reallocated it.
+        sink->data = printer.data;
+        sink->capacity = printer.capacity;
+        printer.owns = false;
+    }
+
+    if (printer.ec == TM_OK) {
+        sink->size = (printer.owns) ? 0 : printer.size;
+    } else if (!printer.drained) {
+        // Nothing was written out yet, so we can discard partial output.
+        sink->size = original_size;
+    } else {
+        sink->size = (printer.owns) ? 0 : printer.size;
+    }
+    return printer.ec;
+}
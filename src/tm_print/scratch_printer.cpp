@@ -0,0 +1,174 @@
+// Rough estimate of how many bytes an argument prints, format is nullptr if the placeholder isn't known yet.
+static tm_size_t tmp_estimate_arg_size(uint64_t type, const PrintValue& value, const PrintFormat* format) {
+    tm_size_t result = 0;
+    bool small_base = format && format->base < 10;
+    switch (type) {
+        case PrintType::Char: {
+            result = 4;
+            break;
+        }
+        case PrintType::Bool: {
+            result = 5;
+            break;
+        }
+        case PrintType::Int32:
+        case PrintType::UInt32: {
+            // Base 2 with prefix and sign, otherwise the digits of INT32_MIN.
+            result = (small_base) ? 35 : 11;
+            break;
+        }
+        case PrintType::Int64:
+        case PrintType::UInt64: {
+            result = (small_base) ? 67 : 20;
+            break;
+        }
+        case PrintType::Float:
+        case PrintType::Double: {
+            // Enough for shortest and scientific output, fixed output of big values needs to grow.
+            result = 24;
+            if (format && format->precision > 0) result += (tm_size_t)format->precision;
+            break;
+        }
+        case PrintType::String: {
+            TM_ASSERT(value.s);
+            result = (tm_size_t)TM_STRLEN(value.s);
+            break;
+        }
+        case PrintType::StringView: {
+            result = (tm_size_t)value.v.size;
+            break;
+        }
+        default: {
+            result = 16;
+            break;
+        }
+    }
+    if (format && format->width > 0 && (tm_size_t)format->width > result) result = (tm_size_t)format->width;
+    return result;
+}
+
+// Widths of runtime format strings are only known while printing, only the argument types are taken into account.
+static tm_size_t tmp_estimate_print_size(size_t format_len, const PrintArgList& args) {
+    tm_size_t result = (tm_size_t)format_len;
+    for (unsigned int i = 0; i < args.size; ++i) {
+        result += tmp_estimate_arg_size(tmp_get_arg_type(args, i), args.args[i], nullptr);
+    }
+    return result;
+}
+
+static tm_size_t tmp_estimate_print_size(const tmp_format_segment* segments, tm_size_t segments_count,
+                                         const PrintArgList& args) {
+    tm_size_t result = 0;
+    for (tm_size_t i = 0; i < segments_count; ++i) {
+        const tmp_format_segment& segment = segments[i];
+        if (segment.arg_index < 0) {
+            result += segment.size;
+            continue;
+        }
+        TM_ASSERT((unsigned int)segment.arg_index < args.size);
+        result += tmp_estimate_arg_size(tmp_get_arg_type(args, (unsigned int)segment.arg_index),
+                                        args.args[segment.arg_index], &segment.format);
+    }
+    return result;
+}
+
+#ifdef TMP_SCRATCH_ARENA
+// Buffer that is kept between calls on the same thread, so that repeated printing doesn't need to allocate.
+struct tmp_scratch_arena {
+    char* data;
+    tm_size_t capacity;
+    bool in_use;  // Custom printers can print recursively, only the outermost call uses the arena.
+
+    ~tmp_scratch_arena() {
+        if (data) TM_FREE(data);
+    }
+};
+static TM_THREAD_LOCAL tmp_scratch_arena tmp_thread_scratch_arena;
+
+static tmp_reallocate_result tmp_allocator_scratch_reallocate(void* context, char* /*old_ptr*/,
+                                                              tm_size_t /*old_size*/, tm_size_t new_size) {
+    TM_ASSERT(context);
+    TM_ASSERT_VALID_SIZE(new_size);
+
+    auto arena = static_cast<tmp_scratch_arena*>(context);
+    char* ptr = nullptr;
+    if (arena->data) {
+        ptr = (char*)TM_REALLOC(arena->data, new_size * sizeof(char), sizeof(char));
+    } else {
+        ptr = (char*)TM_MALLOC(new_size * sizeof(char), sizeof(char));
+    }
+    if (!ptr) return {nullptr, 0};
+    arena->data = ptr;
+    arena->capacity = new_size;
+    return {ptr, new_size};
+}
+// The memory stays with the arena for the next call.
+static void tmp_allocator_scratch_destroy(void* /*context*/, char* /*ptr*/, tm_size_t /*size*/) {}
+
+static tmp_allocator_context tmp_scratch_allocator(tmp_scratch_arena* arena) {
+    return {static_cast<void*>(arena), tmp_allocator_scratch_reallocate, tmp_allocator_scratch_destroy};
+}
+#endif  // defined(TMP_SCRATCH_ARENA)
+
+/*
+Memory printer for output that is copied somewhere else after printing, like into a FILE* or a std::string.
+The buffer is picked before printing using the estimated size, so that most calls allocate at most once:
+The scratch arena of the thread if TMP_SCRATCH_ARENA is defined and no outer call is using it, otherwise
+sbo if the estimated size fits and memory of fallback_allocator sized for the estimate if it doesn't.
+*/
+struct tmp_scratch_printer {
+    tmp_memory_printer printer;
+#ifdef TMP_SCRATCH_ARENA
+    tmp_scratch_arena* arena = nullptr;
+#endif
+
+    tmp_scratch_printer(char* sbo, tm_size_t sbo_size, tmp_allocator_context fallback_allocator,
+                        tm_size_t estimated_size)
+        : printer(sbo, sbo_size, fallback_allocator) {
+#ifdef TMP_SCRATCH_ARENA
+        if (!tmp_thread_scratch_arena.in_use) {
+            arena = &tmp_thread_scratch_arena;
+            arena->in_use = true;
+            printer.data = arena->data;
+            printer.capacity = arena->capacity;
+            printer.owns = true;
+            printer.allocator = tmp_scratch_allocator(arena);
+        }
+#endif
+        if (estimated_size > printer.capacity) printer.grow(estimated_size - printer.capacity);
+    }
+    ~tmp_scratch_printer() {
+#ifdef TMP_SCRATCH_ARENA
+        if (arena) {
+            arena->in_use = false;
+            if (arena->capacity > (tm_size_t)(TMP_SCRATCH_ARENA_MAX_SIZE)) {
+                TM_FREE(arena->data);
+                arena->data = nullptr;
+                arena->capacity = 0;
+            }
+        }
+#endif
+    }
+
+    // Whether the output lives in memory of the fallback allocator.
+    bool in_fallback_memory() const {
+#ifdef TMP_SCRATCH_ARENA
+        if (arena) return false;
+#endif
+        return printer.owns;
+    }
+};
+
+#ifdef TMP_USE_STL
+static void tmp_finish_string_format(tmp_scratch_printer& scratch, ::std::string* result) {
+    const tmp_memory_printer& mem = scratch.printer;
+    if (mem.ec != TM_OK) {
+        result->clear();
+    } else if (scratch.in_fallback_memory()) {
+        // Output was printed into the string itself, trim the capacity the printer allocated in advance.
+        result->resize((size_t)mem.size);
+    } else {
+        result->assign(mem.data, (size_t)mem.size);
+    }
+}
+#endif /* defined(TMP_USE_STL) */
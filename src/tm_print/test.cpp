@@ -6,6 +6,8 @@
 // #define TMP_FLOAT_BACKEND_CRT
 // #define TMP_FLOAT_BACKEND_TM_CONVERSION
 // #define TMP_FLOAT_BACKEND_CHARCONV
+// #define TMP_FLOAT_BACKEND_BUILTIN
+// #define TMP_SCRATCH_ARENA
 
 #if !defined(TM_SIZE_T_DEFINED) && defined(TM_SIZE_T_IS_SIGNED) && TM_SIZE_T_IS_SIGNED == 1
     #define TM_SIZE_T_DEFINED
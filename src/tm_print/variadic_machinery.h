@@ -307,9 +307,25 @@ void fill_print_arg_list(PrintArgList*, const T&, const Types&...) {
 #endif
 inline void fill_print_arg_list(PrintArgList*) {}
 
+// Types of all arguments when they don't fit into PrintArgList::flags.
+template <class... Types>
+struct tmp_type_array {
+    static constexpr const unsigned char values[sizeof...(Types) ? sizeof...(Types) : 1] = {
+        (unsigned char)tmp_type_flags<Types>::value...};
+};
+template <class... Types>
+constexpr const unsigned char tmp_type_array<Types...>::values[sizeof...(Types) ? sizeof...(Types) : 1];
+
+template <class... Types>
+constexpr const unsigned char* tmp_extended_types() {
+    return (sizeof...(Types) > PrintType::Count) ? tmp_type_array<typename std::decay<Types>::type...>::values
+                                                 : nullptr;
+}
+
 template <class... Types>
 void make_print_arg_list(PrintArgList* list, size_t capacity, const Types&... args) {
     list->flags = tmp_type_flags<typename std::decay<Types>::type...>::value;
+    list->types = tmp_extended_types<Types...>();
     list->size = 0;
     fill_print_arg_list(list, args...);
     (void)capacity;
@@ -318,6 +334,7 @@ void make_print_arg_list(PrintArgList* list, size_t capacity, const Types&... ar
 template <class... Types>
 void make_print_arg_list(PrintArgList* list, size_t capacity) {
     list->flags = 0;
+    list->types = nullptr;
     list->size = 0;
     (void)capacity;
     TM_ASSERT(list->size == capacity);
@@ -325,10 +342,9 @@ void make_print_arg_list(PrintArgList* list, size_t capacity) {
 
 // Wrapper to an arguments list array on the stack.
 // The array size is a ternary expression so that the argument list also works with zero arguments.
-#define TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args)                                              \
-    static_assert(sizeof...(args) <= PrintType::Count, "Invalid number of arguments to print"); \
-    PrintValue values[sizeof...(args) ? sizeof...(args) : 1];                                   \
-    PrintArgList arg_list = {values, /*flags=*/0, /*size=*/0};                                  \
+#define TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args)                               \
+    PrintValue values[sizeof...(args) ? sizeof...(args) : 1];                    \
+    PrintArgList arg_list = {values, /*flags=*/0, /*size=*/0, /*types=*/nullptr}; \
     make_print_arg_list(&arg_list, sizeof...(args), args...);
 
 #ifndef TMP_NO_CRT_FILE_PRINTING
@@ -378,6 +394,17 @@ tm_errc print(FILE* out, TM_STRING_VIEW format, const PrintFormat& initial_forma
 #endif  // defined(TM_STRING_VIEW)
 #endif  // TMP_NO_CRT_FILE_PRINTING
 
+template <class... Types>
+tm_errc print(tmp_output_sink* sink, const char* format, const Types&... args) {
+    TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args);
+    return tmp_print(sink, format, TM_STRLEN(format), default_print_format(), arg_list);
+}
+template <class... Types>
+tm_errc print(tmp_output_sink* sink, const char* format, const PrintFormat& initial_formatting, const Types&... args) {
+    TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args);
+    return tmp_print(sink, format, TM_STRLEN(format), initial_formatting, arg_list);
+}
+
 template <class... Types>
 int snprint(char* dest, tm_size_t len, const char* format, const Types&... args) {
     TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args);
@@ -421,6 +448,188 @@ template <class... Types>
 #endif  // defined(TM_STRING_VIEW)
 #endif  // defined(TMP_USE_STL)
 
+template <class... Types>
+tmp_compile_format_result compile_format(const char* format, tm_size_t format_len) {
+    return tmp_compile_format(format, format_len, default_print_format(),
+                              tmp_type_flags<typename std::decay<Types>::type...>::value,
+                              tmp_extended_types<Types...>(), sizeof...(Types));
+}
+template <class... Types>
+tmp_compile_format_result compile_format(const char* format) {
+    return compile_format<Types...>(format, (tm_size_t)TM_STRLEN(format));
+}
+#ifdef TM_STRING_VIEW
+template <class... Types>
+tmp_compile_format_result compile_format(TM_STRING_VIEW format) {
+    return compile_format<Types...>(TM_STRING_VIEW_DATA(format), (tm_size_t)TM_STRING_VIEW_SIZE(format));
+}
+#endif  // defined(TM_STRING_VIEW)
+
+// Printing with a compiled format only checks whether the argument types are the ones the format was compiled for.
+inline bool tmp_compiled_format_matches(const tmp_compiled_format& format, const PrintArgList& args) {
+    if (args.flags != format.types || args.size != format.args_count) return false;
+    // Types beyond PrintType::Count are not part of flags.
+    for (unsigned int i = PrintType::Count; i < args.size; ++i) {
+        if (args.types[i] != format.extended_types[i]) return false;
+    }
+    return true;
+}
+#define TMP_INTERNAL_CHECK_COMPILED_FORMAT(format, arg_list, error) \
+    if (!tmp_compiled_format_matches((format), (arg_list))) return (error);
+
+#ifndef TMP_NO_CRT_FILE_PRINTING
+template <class... Types>
+tm_errc print(const tmp_compiled_format& format, const Types&... args) {
+    TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args);
+    TMP_INTERNAL_CHECK_COMPILED_FORMAT(format, arg_list, TM_EINVAL);
+    return tmp_print_segments(stdout, format.format, format.segments, format.segments_count, arg_list);
+}
+template <class... Types>
+tm_errc print(FILE* out, const tmp_compiled_format& format, const Types&... args) {
+    TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args);
+    TMP_INTERNAL_CHECK_COMPILED_FORMAT(format, arg_list, TM_EINVAL);
+    return tmp_print_segments(out, format.format, format.segments, format.segments_count, arg_list);
+}
+#endif  // TMP_NO_CRT_FILE_PRINTING
+
+template <class... Types>
+tm_errc print(tmp_output_sink* sink, const tmp_compiled_format& format, const Types&... args) {
+    TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args);
+    TMP_INTERNAL_CHECK_COMPILED_FORMAT(format, arg_list, TM_EINVAL);
+    return tmp_print_segments(sink, format.format, format.segments, format.segments_count, arg_list);
+}
+
+template <class... Types>
+int snprint(char* dest, tm_size_t len, const tmp_compiled_format& format, const Types&... args) {
+    TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args);
+    TMP_INTERNAL_CHECK_COMPILED_FORMAT(format, arg_list, -1);
+    return tmp_snprint_segments(dest, len, format.format, format.segments, format.segments_count, arg_list);
+}
+
+#ifdef TMP_USE_STL
+template <class... Types>
+::std::string string_format(const tmp_compiled_format& format, const Types&... args) {
+    TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args);
+    TMP_INTERNAL_CHECK_COMPILED_FORMAT(format, arg_list, ::std::string());
+    return tmp_string_format_segments(format.format, format.segments, format.segments_count, arg_list);
+}
+#endif  // defined(TMP_USE_STL)
+
+#undef TMP_INTERNAL_CHECK_COMPILED_FORMAT
+
+#ifdef TMP_COMPILE_TIME_FORMAT
+// Format string that is parsed at compile time, see TMP_FMT.
+// Str is a type with static constexpr members data() and size() that return the string literal.
+template <class Str>
+struct FormatString {};
+
+template <tm_size_t N>
+struct tmp_format_segment_array {
+    tmp_format_segment data[N];
+};
+
+template <class Str, tm_size_t N>
+constexpr tmp_format_segment_array<N> tmp_make_format_segments() {
+    tmp_format_segment_array<N> result = {};
+    tmp_parse_format_segments(Str::data(), Str::size(), default_print_format(), result.data, N);
+    return result;
+}
+
+template <class Str>
+struct tmp_format_string_segments {
+    static constexpr tmp_parse_format_result parsed =
+        tmp_parse_format_segments(Str::data(), Str::size(), default_print_format(), nullptr, 0);
+    static_assert(parsed.ec == TM_OK, "Invalid format string, there are unmatched '{' or '}'.");
+
+    static constexpr tm_size_t count = parsed.count;
+    typedef tmp_format_segment_array<(count > 0) ? count : 1> array_type;
+    static constexpr array_type segments = tmp_make_format_segments<Str, (count > 0) ? count : 1>();
+};
+template <class Str>
+constexpr tmp_parse_format_result tmp_format_string_segments<Str>::parsed;
+template <class Str>
+constexpr tm_size_t tmp_format_string_segments<Str>::count;
+template <class Str>
+constexpr typename tmp_format_string_segments<Str>::array_type tmp_format_string_segments<Str>::segments;
+
+template <class Format, class... Types>
+struct tmp_format_string_check;
+
+template <class Str, class... Types>
+struct tmp_format_string_check<FormatString<Str>, Types...> {
+    typedef tmp_format_string_segments<Str> format;
+    static constexpr int value =
+        tmp_check_format_segments(format::segments.data, format::count,
+                                  tmp_type_flags<typename std::decay<Types>::type...>::value,
+                                  tmp_extended_types<Types...>(), sizeof...(Types));
+};
+template <class Str, class... Types>
+constexpr int tmp_format_string_check<FormatString<Str>, Types...>::value;
+
+// Validates placeholders against argument types at compile time.
+#define TMP_INTERNAL_CHECK_FORMAT_STRING(Str, Types)                                                            \
+    static_assert(tmp_format_string_check<FormatString<Str>, Types...>::value != tmp_format_index_out_of_range, \
+                  "Format string has more placeholders than arguments or an index is out of range.");           \
+    static_assert(tmp_format_string_check<FormatString<Str>, Types...>::value != tmp_format_type_mismatch,      \
+                  "Format specifier can't be used with the type of its argument.");
+
+#ifndef TMP_NO_CRT_FILE_PRINTING
+template <class Str, class... Types>
+tm_errc print(FormatString<Str>, const Types&... args) {
+    TMP_INTERNAL_CHECK_FORMAT_STRING(Str, Types);
+    TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args);
+    typedef tmp_format_string_segments<Str> format;
+    return tmp_print_segments(stdout, Str::data(), format::segments.data, format::count, arg_list);
+}
+template <class Str, class... Types>
+tm_errc print(FILE* out, FormatString<Str>, const Types&... args) {
+    TMP_INTERNAL_CHECK_FORMAT_STRING(Str, Types);
+    TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args);
+    typedef tmp_format_string_segments<Str> format;
+    return tmp_print_segments(out, Str::data(), format::segments.data, format::count, arg_list);
+}
+#endif  // TMP_NO_CRT_FILE_PRINTING
+
+template <class Str, class... Types>
+tm_errc print(tmp_output_sink* sink, FormatString<Str>, const Types&... args) {
+    TMP_INTERNAL_CHECK_FORMAT_STRING(Str, Types);
+    TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args);
+    typedef tmp_format_string_segments<Str> format;
+    return tmp_print_segments(sink, Str::data(), format::segments.data, format::count, arg_list);
+}
+
+template <class Str, class... Types>
+int snprint(char* dest, tm_size_t len, FormatString<Str>, const Types&... args) {
+    TMP_INTERNAL_CHECK_FORMAT_STRING(Str, Types);
+    TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args);
+    typedef tmp_format_string_segments<Str> format;
+    return tmp_snprint_segments(dest, len, Str::data(), format::segments.data, format::count, arg_list);
+}
+
+#ifdef TMP_USE_STL
+template <class Str, class... Types>
+::std::string string_format(FormatString<Str>, const Types&... args) {
+    TMP_INTERNAL_CHECK_FORMAT_STRING(Str, Types);
+    TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args);
+    typedef tmp_format_string_segments<Str> format;
+    return tmp_string_format_segments(Str::data(), format::segments.data, format::count, arg_list);
+}
+#endif  // defined(TMP_USE_STL)
+
+#undef TMP_INTERNAL_CHECK_FORMAT_STRING
+
+// Makes a FormatString out of a string literal. The string literal is wrapped in a local type, so that it can be
+// passed as a template argument.
+#define TMP_FMT(str)                                                                   \
+    [] {                                                                               \
+        struct tmp_format_literal {                                                    \
+            static constexpr const char* data() { return str; }                        \
+            static constexpr tm_size_t size() { return (tm_size_t)(sizeof(str) - 1); } \
+        };                                                                             \
+        return ::tml::FormatString<tmp_format_literal>{};                              \
+    }()
+#endif  // defined(TMP_COMPILE_TIME_FORMAT)
+
 #undef TMP_INTERNAL_MAKE_ARG_LIST
 
 #ifdef TMP_CUSTOM_PRINTING
@@ -148,6 +148,57 @@ static tmu_write_file_result tmu_write_file_ex_internal(const tmu_tchar* filenam
     return result;
 }
 
+static tm_errc tmu_file_writer_open_t(const tmu_tchar* filename, tm_bool exclusive, void** out) {
+    TM_ASSERT(out);
+
+    const tmu_tchar* mode = TMU_TEXT("wb");
+    if (exclusive) {
+#if defined(TMU_NO_EXCLUSIVE_FOPEN)
+        /* The runtime doesn't know the "x" mode, checking for existence beforehand is the best we can do. */
+        tmu_exists_result exists = tmu_file_exists_t(filename);
+        if (exists.ec != TM_OK) return exists.ec;
+        if (exists.exists) return TM_EEXIST;
+#else
+        mode = TMU_TEXT("wbx");
+#endif
+    }
+
+    errno = 0;
+    FILE* f = tmu_fopen_t(filename, mode);
+    if (!f) return (errno != 0) ? errno : TM_EIO;
+
+    /* Writes are already buffered by tmu_file_writer, no need to buffer them a second time. */
+    setvbuf(f, TM_NULL, _IONBF, 0);
+    *out = f;
+    return TM_OK;
+}
+
+static tm_errc tmu_file_writer_write_t(void* handle, const void* data, tm_size_t size) {
+    TM_ASSERT(handle);
+    FILE* f = (FILE*)handle;
+
+    errno = 0;
+    size_t written = fwrite(data, 1, (size_t)size, f);
+    if (written != (size_t)size || errno != 0 || ferror(f)) return (errno != 0) ? errno : TM_EIO;
+    return TM_OK;
+}
+
+static tm_errc tmu_file_writer_sync_t(void* handle) {
+    TM_ASSERT(handle);
+
+    errno = 0;
+    if (TMU_FSYNC((FILE*)handle) != 0) return (errno != 0) ? errno : TM_EIO;
+    return TM_OK;
+}
+
+static tm_errc tmu_file_writer_close_t(void* handle) {
+    TM_ASSERT(handle);
+
+    errno = 0;
+    if (fclose((FILE*)handle) != 0) return (errno != 0) ? errno : TM_EIO;
+    return TM_OK;
+}
+
 static tm_errc tmu_delete_file_t(const tmu_tchar* filename) {
     tm_errc result = TM_OK;
     if (TMU_REMOVE(filename) != 0) result = (errno != 0) ? errno : TM_EIO;
@@ -191,33 +242,9 @@ static tmu_write_file_result tmu_write_file_ex_t(const tmu_tchar* filename, cons
         return tmu_write_file_ex_internal(filename, data, size, flags);
     }
 
-    tmu_write_file_result result = {0, TM_EIO};
-
-#if 0
-    /* FIXME: Not implemented. */
-    /* Get a temp filename*/
-    char temp_filename_buffer[L_tmpnam + 1];
-    char* temp_filename = TM_NULL;
-    for (int attempts = 0; attempts < 10; ++attempts) {
-        // Try to open up a temporary file. If filename was not unique or another process got it, try again.
-        temp_filename = tmpnam(temp_filename_buffer);
-        if (!temp_filename) {
-            result.ec = TM_EEXIST;
-            break;
-        }
-        result = tmu_write_file_ex_internal(temp_filename, data, size, 0);
-        if (result.ec == TM_EEXIST) {
-            continue;
-        } else {
-            break;
-        }
-    }
-    if (result.ec == TM_OK) {
-        TM_ASSERT(temp_filename);
-        result.ec = tmu_rename_file_ex_t(temp_filename, filename, flags);
-    }
-#endif
-    return result;
+    tmu_file_writer writer = tmu_file_writer_open_internal(filename, flags, /*buffer_capacity=*/0);
+    tmu_file_writer_write(&writer, data, size);
+    return tmu_file_writer_close(&writer);
 }
 
 static tmu_file_timestamp_result tmu_file_timestamp_t(const tmu_tchar* dir) {
@@ -268,5 +295,6 @@ static tm_errc tmu_delete_directory_t(const tmu_tchar* dir) {
 #undef TMU_REMOVE
 #undef TMU_RENAME
 #undef TMU_GETCWD
+#undef TMU_FSYNC
 #undef TMU_FOPEN_READ
 #undef TMU_FOPEN_WRITE
@@ -239,6 +239,198 @@ TMU_DEF void tmu_destroy_contents(tmu_contents* contents) {
     }
 }
 
+static void tmu_file_writer_free_internal(tmu_file_writer* writer) {
+    TM_ASSERT(writer);
+    if (writer->buffer) {
+        TM_ASSERT(writer->buffer_capacity > 0);
+        TMU_FREE(writer->buffer);
+    }
+    if (writer->internal_paths) TMU_FREE(writer->internal_paths);
+    writer->buffer = TM_NULL;
+    writer->buffer_size = 0;
+    writer->buffer_capacity = 0;
+    writer->internal_handle = TM_NULL;
+    writer->internal_paths = TM_NULL;
+}
+
+static tmu_file_writer tmu_file_writer_open_internal(const tmu_tchar* filename, uint32_t flags,
+                                                    tm_size_t buffer_capacity) {
+    TM_ASSERT(filename);
+    TM_ASSERT_VALID_SIZE(buffer_capacity);
+
+    tmu_file_writer result = {TM_OK, 0, flags, TM_NULL, 0, 0, TM_NULL, TM_NULL};
+
+    tm_size_t filename_len = (tm_size_t)TMU_TEXTLEN(filename);
+    if (flags & tmu_create_directory_tree) {
+        result.ec = tmu_create_directory_internal(filename, tmu_get_path_len_internal(filename, filename_len));
+        if (result.ec != TM_OK) return result;
+    }
+
+    if (!(flags & tmu_overwrite)) {
+        tmu_exists_result exists = tmu_file_exists_t(filename);
+        if (exists.ec != TM_OK || exists.exists) {
+            result.ec = (exists.ec != TM_OK) ? exists.ec : TM_EEXIST;
+            return result;
+        }
+    }
+
+    if (buffer_capacity > 0) {
+        result.buffer = (char*)TMU_MALLOC(buffer_capacity * sizeof(char), sizeof(char));
+        if (!result.buffer) {
+            result.ec = TM_ENOMEM;
+            return result;
+        }
+        result.buffer_capacity = buffer_capacity;
+    }
+
+    if (flags & tmu_atomic_write) {
+        /* The temporary file is put next to the destination, so that it can be moved without copying.
+           Layout of internal_paths is "<filename>\0<filename>.tmu_tmpXX\0". */
+        static const char temp_suffix[] = ".tmu_tmp";
+        const tm_size_t temp_suffix_len = (tm_size_t)(sizeof(temp_suffix) - 1);
+        const tm_size_t paths_len = filename_len + 1 + filename_len + temp_suffix_len + 2 + 1;
+
+        tmu_tchar* paths = (tmu_tchar*)TMU_MALLOC(paths_len * sizeof(tmu_tchar), sizeof(tmu_tchar));
+        if (!paths) {
+            tmu_file_writer_free_internal(&result);
+            result.ec = TM_ENOMEM;
+            return result;
+        }
+        result.internal_paths = paths;
+
+        TMU_MEMCPY(paths, filename, (filename_len + 1) * sizeof(tmu_tchar));
+        tmu_tchar* temp_filename = paths + filename_len + 1;
+        TMU_MEMCPY(temp_filename, filename, filename_len * sizeof(tmu_tchar));
+        for (tm_size_t i = 0; i < temp_suffix_len; ++i) {
+            temp_filename[filename_len + i] = (tmu_tchar)temp_suffix[i];
+        }
+        tmu_tchar* digits = temp_filename + filename_len + temp_suffix_len;
+        digits[2] = 0;
+
+        /* Take the first temporary filename that isn't taken yet. The temporary file is created exclusively,
+           so that a file that pops up under the same name concurrently is never clobbered. */
+        result.ec = TM_EEXIST;
+        for (int attempt = 0; attempt < 100 && result.ec == TM_EEXIST; ++attempt) {
+            digits[0] = (tmu_tchar)('0' + attempt / 10);
+            digits[1] = (tmu_tchar)('0' + attempt % 10);
+            result.ec = tmu_file_writer_open_t(temp_filename, /*exclusive=*/TM_TRUE, &result.internal_handle);
+        }
+    } else {
+        result.ec = tmu_file_writer_open_t(filename, /*exclusive=*/!(flags & tmu_overwrite), &result.internal_handle);
+    }
+
+    if (result.ec != TM_OK) {
+        tmu_file_writer_free_internal(&result);
+        return result;
+    }
+
+    if (flags & tmu_write_byte_order_mark) tmu_file_writer_write(&result, tmu_utf8_bom, sizeof(tmu_utf8_bom));
+    return result;
+}
+
+TMU_DEF tmu_file_writer tmu_file_writer_open(const char* filename, uint32_t flags, tm_size_t buffer_capacity) {
+    tmu_file_writer result = {TM_ENOMEM, 0, flags, TM_NULL, 0, 0, TM_NULL, TM_NULL};
+    tmu_platform_path platform_filename;
+    if (tmu_to_platform_path(filename, &platform_filename)) {
+        result = tmu_file_writer_open_internal(platform_filename.path, flags, buffer_capacity);
+        tmu_destroy_platform_path(&platform_filename);
+    }
+    return result;
+}
+
+TMU_DEF tm_errc tmu_file_writer_flush(tmu_file_writer* writer) {
+    TM_ASSERT(writer);
+    if (writer->ec != TM_OK) return writer->ec;
+    if (!writer->internal_handle) return TM_EINVAL;
+
+    if (writer->buffer_size > 0) {
+        writer->ec = tmu_file_writer_write_t(writer->internal_handle, writer->buffer, writer->buffer_size);
+        writer->buffer_size = 0;
+    }
+    return writer->ec;
+}
+
+TMU_DEF tm_errc tmu_file_writer_write(tmu_file_writer* writer, const void* data, tm_size_t size) {
+    TM_ASSERT(writer);
+    TM_ASSERT(data || size == 0);
+    TM_ASSERT_VALID_SIZE(size);
+    TM_ASSERT(writer->buffer_size <= writer->buffer_capacity);
+
+    if (writer->ec != TM_OK) return writer->ec;
+    if (!writer->internal_handle) return TM_EINVAL;
+
+    if (size <= writer->buffer_capacity - writer->buffer_size) {
+        TMU_MEMCPY(writer->buffer + writer->buffer_size, data, size * sizeof(char));
+        writer->buffer_size += size;
+        writer->written += size;
+        return TM_OK;
+    }
+
+    if (tmu_file_writer_flush(writer) != TM_OK) return writer->ec;
+    if (size < writer->buffer_capacity) {
+        TMU_MEMCPY(writer->buffer, data, size * sizeof(char));
+        writer->buffer_size = size;
+    } else {
+        /* Big writes go straight to the file instead of being copied into the buffer first. */
+        writer->ec = tmu_file_writer_write_t(writer->internal_handle, data, size);
+        if (writer->ec != TM_OK) return writer->ec;
+    }
+    writer->written += size;
+    return TM_OK;
+}
+
+TMU_DEF tmu_write_file_result tmu_file_writer_close(tmu_file_writer* writer) {
+    TM_ASSERT(writer);
+
+    tmu_write_file_result result = {0, TM_EINVAL};
+    if (!writer->internal_handle) {
+        if (writer->ec != TM_OK) result.ec = writer->ec;
+        tmu_file_writer_free_internal(writer);
+        return result;
+    }
+
+    result.ec = tmu_file_writer_flush(writer);
+    if (result.ec == TM_OK && (writer->flags & (tmu_atomic_write | tmu_sync_write))) {
+        result.ec = tmu_file_writer_sync_t(writer->internal_handle);
+    }
+    tm_errc close_ec = tmu_file_writer_close_t(writer->internal_handle);
+    if (result.ec == TM_OK) result.ec = close_ec;
+
+    if (writer->internal_paths) {
+        TM_ASSERT(writer->flags & tmu_atomic_write);
+        const tmu_tchar* filename = (const tmu_tchar*)writer->internal_paths;
+        const tmu_tchar* temp_filename = filename + TMU_TEXTLEN(filename) + 1;
+        if (result.ec == TM_OK) {
+            result.ec = tmu_rename_file_ex_t(temp_filename, filename, writer->flags & tmu_overwrite);
+            /* The rename itself is only durable once the directory entry is synced too. */
+            if (result.ec == TM_OK) {
+                result.ec = tmu_sync_parent_directory_t(filename);
+            } else {
+                tmu_delete_file_t(temp_filename);
+            }
+        } else {
+            tmu_delete_file_t(temp_filename);
+        }
+    }
+
+    if (result.ec == TM_OK) result.written = writer->written;
+    writer->ec = result.ec;
+    tmu_file_writer_free_internal(writer);
+    return result;
+}
+
+TMU_DEF void tmu_file_writer_discard(tmu_file_writer* writer) {
+    if (!writer) return;
+    if (writer->internal_handle) {
+        tmu_file_writer_close_t(writer->internal_handle);
+        if (writer->internal_paths) {
+            const tmu_tchar* filename = (const tmu_tchar*)writer->internal_paths;
+            tmu_delete_file_t(filename + TMU_TEXTLEN(filename) + 1);
+        }
+    }
+    tmu_file_writer_free_internal(writer);
+}
+
 TMU_DEF tmu_exists_result tmu_file_exists(const char* filename) {
     tmu_exists_result result = {TM_FALSE, TM_ENOMEM};
     tmu_platform_path platform_filename;
@@ -496,7 +688,7 @@ TMU_DEF void tmu_utf8_destroy_command_line(tmu_utf8_command_line* command_line)
 }
 
 TMU_DEF tmu_opened_dir tmu_open_directory(const char* dir) {
-    tmu_opened_dir result = {TM_ENOMEM, {TM_NULL, TM_FALSE}, {TM_NULL, 0, 0}, TM_NULL};
+    tmu_opened_dir result = {TM_ENOMEM, {TM_NULL, TM_FALSE}, {TM_NULL, 0, 0}, {TM_NULL, 0, 0}, TM_NULL};
     if (!dir) dir = "";
     tmu_platform_path platform_dir;
     if (tmu_to_platform_path(dir, &platform_dir)) {
@@ -506,6 +698,125 @@ TMU_DEF tmu_opened_dir tmu_open_directory(const char* dir) {
     return result;
 }
 
+/* Like tmu_grow_by, but also allocates the initial buffer, since not all TMU_REALLOC implementations accept null. */
+static tm_bool tmu_reserve_by_internal(tmu_contents* contents, tm_size_t amount, tm_size_t min_capacity) {
+    TM_ASSERT(contents);
+    if (!contents->data) {
+        tm_size_t capacity = (amount < min_capacity) ? min_capacity : amount;
+        contents->data = (char*)TMU_MALLOC((size_t)capacity * sizeof(char), sizeof(char));
+        if (!contents->data) return TM_FALSE;
+        contents->size = 0;
+        contents->capacity = capacity;
+        return TM_TRUE;
+    }
+    return tmu_grow_by(contents, amount);
+}
+
+TMU_DEF tm_size_t tmu_read_directory_batch(tmu_opened_dir* dir, tmu_directory_entry* entries,
+                                           tm_size_t entries_capacity, uint32_t flags) {
+    TM_ASSERT(entries || entries_capacity == 0);
+    if (!dir) return 0;
+
+    tmu_contents* names = &dir->internal_names;
+    names->size = 0;
+
+    tm_size_t count = 0;
+    while (count < entries_capacity) {
+        tmu_directory_entry* entry = &entries[count];
+        if (!tmu_read_directory_internal(dir, flags, entry)) break;
+
+        /* Entry names are only valid until the next read, so we copy them into a buffer that lives as long as dir. */
+        tm_size_t name_size = (tm_size_t)TMU_STRLEN(entry->name) + 1;
+        if (!tmu_reserve_by_internal(names, name_size, /*min_capacity=*/entries_capacity * 32)) {
+            dir->ec = TM_ENOMEM;
+            break;
+        }
+        TMU_MEMCPY(names->data + names->size, entry->name, (size_t)name_size * sizeof(char));
+        names->size += name_size;
+        ++count;
+    }
+
+    /* Names buffer might have been reallocated while reading, assign the name pointers only once we are done. */
+    const char* name = names->data;
+    for (tm_size_t i = 0; i < count; ++i) {
+        entries[i].name = name;
+        name += TMU_STRLEN(name) + 1;
+    }
+    return count;
+}
+
+static tm_errc tmu_walk_directory_internal(tmu_contents* path, uint32_t flags, tmu_walk_directory_callback callback,
+                                           void* user_data) {
+    TM_ASSERT(path);
+    TM_ASSERT(path->data);
+
+    tmu_opened_dir dir = tmu_open_directory(path->data);
+    if (dir.ec != TM_OK) {
+        tm_errc ec = dir.ec;
+        tmu_close_directory(&dir);
+        return ec;
+    }
+
+    tm_size_t path_size = path->size;
+    tm_errc ec = TM_OK;
+
+    enum { ENTRIES_CAPACITY = 64 };
+    tmu_directory_entry entries[ENTRIES_CAPACITY];
+    tm_size_t count = 0;
+    while (ec == TM_OK && (count = tmu_read_directory_batch(&dir, entries, ENTRIES_CAPACITY, flags)) != 0) {
+        for (tm_size_t i = 0; i < count; ++i) {
+            const tmu_directory_entry* entry = &entries[i];
+
+            /* Append entry name to path, directories get a trailing slash, if they don't have one already. */
+            tm_size_t name_len = (tm_size_t)TMU_STRLEN(entry->name);
+            path->size = path_size;
+            if (!tmu_grow_by(path, name_len + 2)) {
+                ec = TM_ENOMEM;
+                break;
+            }
+            TMU_MEMCPY(path->data + path->size, entry->name, (size_t)name_len * sizeof(char));
+            path->size += name_len;
+            if (!entry->is_file && (name_len == 0 || entry->name[name_len - 1] != '/')) path->data[path->size++] = '/';
+            path->data[path->size] = 0;
+
+            tmu_walk_action action = callback(user_data, path->data, entry);
+            if (action == tmu_walk_stop) {
+                ec = TM_ECANCELED;
+                break;
+            }
+            if (action == tmu_walk_continue && !entry->is_file) {
+                ec = tmu_walk_directory_internal(path, flags, callback, user_data);
+                if (ec != TM_OK) break;
+            }
+        }
+    }
+    if (ec == TM_OK) ec = dir.ec;
+    tmu_close_directory(&dir);
+
+    path->size = path_size;
+    path->data[path_size] = 0;
+    return ec;
+}
+
+TMU_DEF tm_errc tmu_walk_directory(const char* dir, uint32_t flags, tmu_walk_directory_callback callback,
+                                   void* user_data) {
+    TM_ASSERT(callback);
+    if (!dir) dir = "";
+
+    tm_size_t dir_len = (tm_size_t)TMU_STRLEN(dir);
+    tmu_contents path = {TM_NULL, 0, 0};
+    if (!tmu_reserve_by_internal(&path, dir_len + 2, /*min_capacity=*/260)) return TM_ENOMEM;
+
+    TMU_MEMCPY(path.data, dir, (size_t)dir_len * sizeof(char));
+    path.size = dir_len;
+    if (dir_len > 0 && dir[dir_len - 1] != '/' && dir[dir_len - 1] != '\\') path.data[path.size++] = '/';
+    path.data[path.size] = 0;
+
+    tm_errc ec = tmu_walk_directory_internal(&path, flags, callback, user_data);
+    tmu_destroy_contents(&path);
+    return ec;
+}
+
 #if defined(__cplusplus) && defined(TM_STRING_VIEW)
 
 TMU_DEF tmu_exists_result tmu_file_exists(TM_STRING_VIEW filename) {
@@ -593,6 +904,16 @@ TMU_DEF tmu_write_file_result tmu_write_file_as_utf8_ex(TM_STRING_VIEW filename,
     return result;
 }
 
+TMU_DEF tmu_file_writer tmu_file_writer_open(TM_STRING_VIEW filename, uint32_t flags, tm_size_t buffer_capacity) {
+    tmu_file_writer result = {TM_ENOMEM, 0, flags, TM_NULL, 0, 0, TM_NULL, TM_NULL};
+    tmu_platform_path platform_filename;
+    if (tmu_to_platform_path(filename, &platform_filename)) {
+        result = tmu_file_writer_open_internal(platform_filename.path, flags, buffer_capacity);
+        tmu_destroy_platform_path(&platform_filename);
+    }
+    return result;
+}
+
 TMU_DEF tm_errc tmu_rename_file(TM_STRING_VIEW from, TM_STRING_VIEW to) { return tmu_rename_file_ex(from, to, 0); }
 TMU_DEF tm_errc tmu_rename_file_ex(TM_STRING_VIEW from, TM_STRING_VIEW to, uint32_t flags) {
     tm_errc result = TM_ENOMEM;
@@ -39,11 +39,51 @@ enum {
 
     /* Write file by first writing to a temporary file, then move file into destination. */
     tmu_atomic_write = (1u << 4u),
+
+    /* Flush file contents to disk before closing. Always done for tmu_atomic_write before moving the file. */
+    tmu_sync_write = (1u << 5u),
 };
 TMU_DEF tmu_write_file_result tmu_write_file_ex(const char* filename, const void* data, tm_size_t size, uint32_t flags);
 TMU_DEF tmu_write_file_result tmu_write_file_as_utf8_ex(const char* filename, const char* data, tm_size_t size,
                                                         uint32_t flags);
 
+/*
+Buffered file writer for writing files in pieces without having to hold the whole contents in memory.
+Writes are collected in a buffer of buffer_capacity bytes and written to the file in large chunks.
+Writes that don't fit into the buffer are written directly. A buffer_capacity of 0 disables buffering.
+
+Flags are the same as for tmu_write_file_ex. With tmu_atomic_write, data is written into a newly created
+temporary file in the same directory as filename. On tmu_file_writer_close the temporary file is synced to disk
+and then moved into the destination, so the destination either has the old or the complete new contents.
+On POSIX the directory is synced after the move as well.
+
+The first error is stored in ec, all subsequent writes will return that error without writing anything.
+tmu_file_writer_close must be called to commit the file, tmu_file_writer_discard to abort.
+Both free all resources held by the writer.
+*/
+#ifndef TMU_FILE_WRITER_DEFAULT_BUFFER_SIZE
+    #define TMU_FILE_WRITER_DEFAULT_BUFFER_SIZE (64u * 1024u)
+#endif
+
+typedef struct {
+    tm_errc ec;
+    tm_size_t written; /* Number of bytes written so far, including bytes still in the buffer. */
+    uint32_t flags;
+
+    char* buffer;
+    tm_size_t buffer_size;
+    tm_size_t buffer_capacity;
+
+    void* internal_handle;
+    void* internal_paths; /* Destination and temporary filename when writing atomically. */
+} tmu_file_writer;
+
+TMU_DEF tmu_file_writer tmu_file_writer_open(const char* filename, uint32_t flags, tm_size_t buffer_capacity);
+TMU_DEF tm_errc tmu_file_writer_write(tmu_file_writer* writer, const void* data, tm_size_t size);
+TMU_DEF tm_errc tmu_file_writer_flush(tmu_file_writer* writer);
+TMU_DEF tmu_write_file_result tmu_file_writer_close(tmu_file_writer* writer);
+TMU_DEF void tmu_file_writer_discard(tmu_file_writer* writer);
+
 TMU_DEF tm_errc tmu_rename_file(const char* from, const char* to);
 TMU_DEF tm_errc tmu_rename_file_ex(const char* from, const char* to, uint32_t flags);
 
@@ -67,6 +107,7 @@ typedef struct {
     tmu_read_directory_result internal_result;
 
     tmu_contents internal_buffer;
+    tmu_contents internal_names;
     void* internal;
 } tmu_opened_dir;
 
@@ -77,6 +118,65 @@ TMU_DEF tmu_opened_dir tmu_open_directory(const char* dir);
 TMU_DEF void tmu_close_directory(tmu_opened_dir* dir);
 TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir);
 
+enum {
+    tmu_read_directory_stat = (1u << 0u), /* Also retrieve size and file_time of every entry. */
+};
+
+typedef struct {
+    const char* name;        /* Either filename or directory name. */
+    tm_bool is_file;         /* Whether entry is a file or a directory. */
+    tm_bool has_stat;        /* Whether size and file_time are valid. */
+    uint64_t size;           /* Size of the file in bytes. */
+    tmu_file_time file_time; /* Last write time, see tmu_file_timestamp. */
+} tmu_directory_entry;
+
+/*!
+ * @brief Reads up to entries_capacity entries of an opened directory at once.
+ * Names are stored in a buffer owned by dir and stay valid until the next call to tmu_read_directory_batch or
+ * tmu_close_directory. If entries_capacity is large enough, the amount of function call and allocation overhead per
+ * entry is much smaller than with tmu_read_directory.
+ * On Windows size and file_time are always retrieved, since they are part of the directory listing.
+ * On Unix they are only retrieved if tmu_read_directory_stat is passed, since they need an additional fstatat call
+ * per entry. Entries whose type can't be determined from the directory listing alone are always stat'ed.
+ * @param dir The opened directory.
+ * @param entries Output array of entries.
+ * @param entries_capacity Capacity of the entries array.
+ * @param flags Either 0 or tmu_read_directory_stat.
+ * @return The number of entries read. Returns 0 if there are no more entries or on error. Errors are reported in dir->ec.
+ */
+TMU_DEF tm_size_t tmu_read_directory_batch(tmu_opened_dir* dir, tmu_directory_entry* entries,
+                                           tm_size_t entries_capacity, uint32_t flags);
+
+typedef enum {
+    tmu_walk_continue, /* Continue walking, descends into the entry if it is a directory. */
+    tmu_walk_skip,     /* Do not descend into the entry. */
+    tmu_walk_stop,     /* Stop walking altogether. */
+} tmu_walk_action;
+
+/*!
+ * @brief Callback of tmu_walk_directory.
+ * @param user_data The user_data pointer passed to tmu_walk_directory.
+ * @param path The path of the entry, including the directory passed to tmu_walk_directory. Directory paths end in '/'.
+ * Only valid for the duration of the callback.
+ * @param entry The entry itself.
+ */
+typedef tmu_walk_action (*tmu_walk_directory_callback)(void* user_data, const char* path,
+                                                        const tmu_directory_entry* entry);
+
+/*!
+ * @brief Recursively walks a directory tree, depth first, and calls callback for every entry.
+ * Directories are passed to callback before their contents. Returning tmu_walk_skip from callback for a
+ * directory skips its contents. This can be used to distribute work, i.e. pushing the directory path to a work queue
+ * and calling tmu_walk_directory on it from a different thread.
+ * @param dir The directory to walk.
+ * @param flags Either 0 or tmu_read_directory_stat, see tmu_read_directory_batch.
+ * @param callback The callback to invoke for every entry.
+ * @param user_data Passed through to callback.
+ * @return TM_OK on success, TM_ECANCELED if callback returned tmu_walk_stop, otherwise the first error encountered.
+ */
+TMU_DEF tm_errc tmu_walk_directory(const char* dir, uint32_t flags, tmu_walk_directory_callback callback,
+                                   void* user_data);
+
 #if 0
 typedef enum {
     tmu_path_is_file,
@@ -221,6 +321,7 @@ TMU_DEF tmu_utf8_contents_result tmu_read_file_as_utf8_ex(TM_STRING_VIEW filenam
 TMU_DEF tmu_write_file_result tmu_write_file_as_utf8(TM_STRING_VIEW filename, const char* data, tm_size_t size);
 TMU_DEF tmu_write_file_result tmu_write_file_as_utf8_ex(TM_STRING_VIEW filename, const char* data, tm_size_t size,
                                                         uint32_t flags);
+TMU_DEF tmu_file_writer tmu_file_writer_open(TM_STRING_VIEW filename, uint32_t flags, tm_size_t buffer_capacity);
 
 TMU_DEF tm_errc tmu_rename_file(TM_STRING_VIEW from, TM_STRING_VIEW to);
 TMU_DEF tm_errc tmu_rename_file_ex(TM_STRING_VIEW from, TM_STRING_VIEW to, uint32_t flags);
@@ -43,26 +43,31 @@
 	#define TMU_REMOVE _wremove
 	#define TMU_RENAME _wrename
 	#define TMU_GETCWD _wgetcwd
+	#define TMU_FSYNC(file) _commit(_fileno(file))
+	#if (defined(_MSC_VER) && _MSC_VER < 1900 && !defined(__clang__)) || defined(TMU_TESTING_OLD_MSC)
+		#define TMU_NO_EXCLUSIVE_FOPEN /* Old msvc runtimes don't support the "x" mode of fopen. */
+	#endif
 
 #elif defined(TMU_PLATFORM_UNIX)
 	#ifndef TMU_TESTING
-		#if !defined(_XOPEN_SOURCE) || _XOPEN_SOURCE < 500
+		#if !defined(_XOPEN_SOURCE) || _XOPEN_SOURCE < 700
             #ifdef _XOPEN_SOURCE
                 #undef _XOPEN_SOURCE
             #endif
-            #define _XOPEN_SOURCE 500
+            #define _XOPEN_SOURCE 700
         #endif
-        #if !defined(_POSIX_C_SOURCE) || _POSIX_C_SOURCE < 200112L
+        #if !defined(_POSIX_C_SOURCE) || _POSIX_C_SOURCE < 200809L
             #ifdef _POSIX_C_SOURCE
                 #undef _POSIX_C_SOURCE
             #endif
-            #define _POSIX_C_SOURCE 200112L
+            #define _POSIX_C_SOURCE 200809L
         #endif
         #ifndef _BSD_SOURCE
             #define _BSD_SOURCE
         #endif
-	    #include <unistd.h> /* getcwd */
+	    #include <unistd.h> /* getcwd, fsync */
 		#include <dirent.h> /* Directory reading. */
+		#include <fcntl.h> /* fstatat flags and open. */
 	#endif /* !defined(TMU_TESTING) */
 	#ifdef TMU_USE_CONSOLE
 		#include<stdarg.h> /* Needed for tmu_printf and tmu_fprintf */
@@ -86,6 +91,7 @@
 	#define TMU_REMOVE remove
 	#define TMU_RENAME rename
 	#define TMU_GETCWD getcwd
+	#define TMU_FSYNC(file) fsync(fileno(file))
 
 #endif /* defined(__GNUC__) || defined(__clang__) || defined(__linux__) || defined(TMU_TESTING_UNIX) */
 /* clang-format on */
@@ -5,6 +5,8 @@ static tm_size_t tmu_get_path_len_internal(const tmu_tchar* filename, tm_size_t
 struct tmu_contents_struct;
 static void tmu_to_tmu_path(struct tmu_contents_struct* path, tm_bool is_dir);
 TMU_DEF tm_bool tmu_grow_by(struct tmu_contents_struct* contents, tm_size_t amount);
+static tmu_file_writer tmu_file_writer_open_internal(const tmu_tchar* filename, uint32_t flags,
+                                                    tm_size_t buffer_capacity);
 
 #if defined(_WIN32) && !defined(TMU_TESTING_UNIX)
 struct tmu_platform_path_struct;
@@ -1,5 +1,5 @@
 /*
-tm_unicode.h v0.9.4 - public domain - https://github.com/to-miz/tm
+tm_unicode.h v0.9.14 - public domain - https://github.com/to-miz/tm
 Author: Tolga Mizrak MERGE_YEAR
 
 No warranty; use at your own risk.
@@ -83,7 +83,7 @@ SWITCHES
 
 NOTES
     Compiling with -std=c99 on gcc/clang with file io:
-    You need to additionally pass in -D_XOPEN_SOURCE=500 -D_DEFAULT_SOURCE as options, so that some more advanced
+    You need to additionally pass in -D_XOPEN_SOURCE=700 -D_DEFAULT_SOURCE as options, so that some more advanced
     posix functions are defined in the headers, that are otherwise not defined because of c99.
 
 ISSUES
@@ -91,12 +91,29 @@ ISSUES
       like turkic languages with dotted uppercase I).
     - No conditional special casing support, like for instance FINAL SIGMA
       (sigma character at the end of a word has a different lowercase variant).
-    - tmu_atomic_write not implemented yet for CRT backend.
     - tmu_utf8_width not implemented properly yet, it calculates the width of all codepoints of a string instead of
       calculating the width of display glyphs.
     - Grapheme break detection not implemented yet.
 
 HISTORY    (DD.MM.YY)
+    v0.9.14 19.10.26 Added tmu_detect_encoding, tmu_encoding_unknown now also detects utf16 and utf32 without
+                     byte order mark.
+    v0.9.13 19.10.26 Added tmu_utf8_split_chunks, tmu_utf8_valid_range_parallel and
+                     tmu_utf8_count_codepoints_parallel for processing large buffers on a caller supplied thread pool.
+    v0.9.12 19.10.26 Added tmu_utf8_span_category and tmu_utf8_span_not_category.
+    v0.9.11 19.10.26 Added tmu_utf8_offset_index for codepoint index to byte offset conversions.
+                     Counting codepoints now counts valid ranges 8 octets at a time.
+    v0.9.10 19.10.26 Added tmu_utf8_transcoder for converting chunked input to utf8.
+                     Ascii runs are now validated and converted 8 octets at a time.
+    v0.9.9  19.10.26 Added tmu_utf8_make_sort_key and tmu_utf8_make_sort_key_simple.
+    v0.9.8  19.10.26 Added tmu_utf8_next_word_break and tmu_utf8_next_sentence_break (UAX #29) for Unicode data
+                     generated with the word_break and sentence_break flags.
+    v0.9.7  19.10.26 Added ASCII fast paths to lowercasing, case folding and case insensitive comparisons.
+                     Fixed case insensitive comparisons treating a string as equal to its prefix.
+    v0.9.6  19.10.26 Added tmu_read_directory_batch and tmu_walk_directory.
+                     Fixed tmu_read_directory reporting entries of unknown type as files on Unix.
+    v0.9.5  19.10.26 Added tmu_file_writer for buffered writing of files and tmu_sync_write.
+                     Implemented tmu_atomic_write for CRT backend.
     v0.9.4 19.11.20 Changed the signature of TM_MALLOC to be less restrictive.
     v0.9.3  12.08.20 Removed *_managed functions, use tm_resource_ptr instead for RAII.
     v0.9.2  08.08.20 Added tmu_printf, tmu_vprintf, tmu_fprintf, tmu_vfprintf.
@@ -66,6 +66,12 @@ static tm_bool tmu_to_platform_path_n(const char* path, tm_size_t size, tmu_plat
 }
 #endif
 
+/* Directories can't be synced on Windows, renames are only as durable as the file system makes them. */
+static tm_errc tmu_sync_parent_directory_t(const tmu_tchar* filename) {
+    TM_UNREFERENCED_PARAM(filename);
+    return TM_OK;
+}
+
 TMU_DEF tmu_contents_result tmu_current_working_directory(tm_size_t extra_size) {
     TM_UNREFERENCED_PARAM(extra_size);
     TM_ASSERT_VALID_SIZE(extra_size);
@@ -154,22 +160,25 @@ TMU_DEF void tmu_close_directory(tmu_opened_dir* dir) {
         TMU_FREE(find_data);
     }
     tmu_destroy_contents(&dir->internal_buffer);
+    tmu_destroy_contents(&dir->internal_names);
     memset(dir, 0, sizeof(tmu_opened_dir));
 }
 
-TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir) {
-    if (!dir) return TM_NULL;
-    if (dir->ec != TM_OK) return TM_NULL;
-    if (!dir->internal) return TM_NULL;
+static tm_bool tmu_read_directory_internal(tmu_opened_dir* dir, uint32_t flags, tmu_directory_entry* out) {
+    TM_ASSERT(dir);
+    TM_ASSERT(out);
+    TM_UNREFERENCED_PARAM(flags);
+    if (dir->ec != TM_OK) return TM_FALSE;
+    if (!dir->internal) return TM_FALSE;
 
     struct tmu_internal_find_data* find_data = (struct tmu_internal_find_data*)dir->internal;
     if (find_data->handle == -1) {
         dir->ec = TM_EPERM;
-        return TM_NULL;
+        return TM_FALSE;
     }
     if (!find_data->has_data) {
         dir->ec = find_data->next_ec;
-        return TM_NULL;
+        return TM_FALSE;
     }
 
     /* Skip "." and ".." entries. */
@@ -180,11 +189,10 @@ TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir)
         if (!find_data->has_data) {
             int last_error = errno;
             if (last_error != ENOENT) dir->ec = (tm_errc)last_error;
-            return TM_NULL;
+            return TM_FALSE;
         }
     }
 
-    memset(&dir->internal_result, 0, sizeof(tmu_read_directory_result));
     tmu_utf16_stream stream = tmu_utf16_make_stream(find_data->data.name);
     tmu_conversion_result conv_result
         = tmu_utf8_from_utf16_ex(stream, tmu_validate_error, /*replace_str=*/TM_NULL, 0, /*nullterminate=*/TM_TRUE,
@@ -195,14 +203,14 @@ TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir)
             dir->internal_buffer.data = (char*)TMU_MALLOC((size_t)conv_result.size, sizeof(char));
             if (!dir->internal_buffer.data) {
                 dir->ec = TM_ENOMEM;
-                return TM_NULL;
+                return TM_FALSE;
             }
             dir->internal_buffer.capacity = conv_result.size;
         } else if (dir->internal_buffer.capacity < conv_result.size) {
             dir->internal_buffer.size = 0;
             if (!tmu_grow_by(&dir->internal_buffer, conv_result.size)) {
                 dir->ec = TM_ENOMEM;
-                return TM_NULL;
+                return TM_FALSE;
             }
         }
         TM_ASSERT(dir->internal_buffer.data);
@@ -212,21 +220,38 @@ TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir)
     }
     if (conv_result.ec != TM_OK) {
         dir->ec = conv_result.ec;
-        return TM_NULL;
+        return TM_FALSE;
     }
 
     TM_ASSERT(conv_result.size < dir->internal_buffer.capacity);
     dir->internal_buffer.data[conv_result.size] = 0; /* Always nullterminate. */
     dir->internal_buffer.size = conv_result.size;
 
-    dir->internal_result.is_file = (find_data->data.attrib & _A_SUBDIR) == 0;
-    dir->internal_result.name = dir->internal_buffer.data;
+    out->name = dir->internal_buffer.data;
+    out->is_file = (find_data->data.attrib & _A_SUBDIR) == 0;
+    out->has_stat = TM_TRUE;
+    out->size = (uint64_t)find_data->data.size;
+    out->file_time = (tmu_file_time)find_data->data.time_write;
 
     find_data->has_data = (_wfindnext64(find_data->handle, &find_data->data) == 0);
     if (!find_data->has_data) {
         int last_error = errno;
         if (last_error != ENOENT) find_data->next_ec = (tm_errc)last_error;
     }
+    return TM_TRUE;
+}
+
+TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir) {
+    if (!dir) return TM_NULL;
+
+    tmu_directory_entry entry;
+    if (!tmu_read_directory_internal(dir, /*flags=*/0, &entry)) {
+        memset(&dir->internal_result, 0, sizeof(tmu_read_directory_result));
+        return TM_NULL;
+    }
+
+    dir->internal_result.name = entry.name;
+    dir->internal_result.is_file = entry.is_file;
     return &dir->internal_result;
 }
 
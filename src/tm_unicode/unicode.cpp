@@ -6,6 +6,16 @@
 #define TMU_TRAILING_SURROGATE_MAX 0xDFFFu
 #define TMU_SURROGATE_OFFSET (0x10000u - (0xD800u << 10u) - 0xDC00u)
 #define TMU_INVALID_CODEPOINT 0xFFFFFFFFu
+#define TMU_DETECT_MIN_CONFIDENCE 50
+#define TMU_ASCII_ONES 0x0101010101010101ull
+#define TMU_ASCII_HIGH_BITS (TMU_ASCII_ONES * 0x80)
+
+/* Loads 8 bytes in little endian order, so that str[i] ends up in bits [i * 8, i * 8 + 8). */
+static uint64_t tmu_ascii_load(const char* str) {
+    const uint8_t* p = (const uint8_t*)str;
+    return (uint64_t)p[0] | ((uint64_t)p[1] << 8) | ((uint64_t)p[2] << 16) | ((uint64_t)p[3] << 24) |
+           ((uint64_t)p[4] << 32) | ((uint64_t)p[5] << 40) | ((uint64_t)p[6] << 48) | ((uint64_t)p[7] << 56);
+}
 
 /* Byte order marks for all encodings we can decode. */
 static const unsigned char tmu_utf8_bom[3] = {0xEF, 0xBB, 0xBF};
@@ -573,6 +583,187 @@ static tm_bool tmu_has_utf16_le_bom(tmu_byte_stream stream) {
            (unsigned char)stream.cur[1] == tmu_utf16_le_bom[1];
 }
 
+/*
+Counts zero octets by their position modulo 4 in the first len octets of str.
+Zero octets are found 8 at a time: adding 0x7F to the low 7 bits of an octet sets its high bit unless all bits are
+zero. The resulting flags are accumulated per octet lane and added up every 255 words before the lanes overflow.
+*/
+static void tmu_count_zero_octets(const char* str, tm_size_t len, tm_size_t zeros[4]) {
+    const uint64_t low_bits = TMU_ASCII_ONES * 0x7F;
+    zeros[0] = zeros[1] = zeros[2] = zeros[3] = 0;
+    tm_size_t i = 0;
+    while (len - i >= 8) {
+        uint64_t lanes = 0;
+        for (int words = 0; words < 255 && len - i >= 8; ++words, i += 8) {
+            uint64_t octets = tmu_ascii_load(str + i);
+            lanes += (~(((octets & low_bits) + low_bits) | octets | low_bits)) >> 7;
+        }
+        for (int lane = 0; lane < 8; ++lane) {
+            zeros[lane & 3] += (tm_size_t)((lanes >> (lane * 8)) & 0xFFu);
+        }
+    }
+    for (; i < len; ++i) {
+        if (str[i] == 0) ++zeros[i & 3];
+    }
+}
+
+/* Whether the units are valid utf16, a lead surrogate at the very end is allowed if the sample is partial. */
+static tm_bool tmu_utf16_sample_valid(const char* str, tm_size_t len, uint16_t (*extract)(tmu_byte_stream*),
+                                      tm_bool partial) {
+    tmu_byte_stream bytes = {TM_NULL, TM_NULL};
+    bytes.cur = str;
+    bytes.end = str + len;
+    while (bytes.end - bytes.cur >= 2) {
+        uint32_t unit = extract(&bytes);
+        if (unit >= TMU_TRAILING_SURROGATE_MIN && unit <= TMU_TRAILING_SURROGATE_MAX) return TM_FALSE;
+        if (unit >= TMU_LEAD_SURROGATE_MIN && unit <= TMU_LEAD_SURROGATE_MAX) {
+            if (bytes.end - bytes.cur < 2) return partial;
+            uint32_t trail = extract(&bytes);
+            if (trail < TMU_TRAILING_SURROGATE_MIN || trail > TMU_TRAILING_SURROGATE_MAX) return TM_FALSE;
+        }
+    }
+    return TM_TRUE;
+}
+
+static tm_bool tmu_utf32_sample_valid(const char* str, tm_size_t len, uint32_t (*extract)(tmu_byte_stream*)) {
+    tmu_byte_stream bytes = {TM_NULL, TM_NULL};
+    bytes.cur = str;
+    bytes.end = str + len;
+    while (bytes.end - bytes.cur >= 4) {
+        if (!tmu_is_valid_codepoint(extract(&bytes))) return TM_FALSE;
+    }
+    return TM_TRUE;
+}
+
+static tm_bool tmu_bytes_start_with(const char* str, tm_size_t len, const unsigned char* prefix, tm_size_t prefix_len) {
+    if (len < prefix_len) return TM_FALSE;
+    for (tm_size_t i = 0; i < prefix_len; ++i) {
+        if ((unsigned char)str[i] != prefix[i]) return TM_FALSE;
+    }
+    return TM_TRUE;
+}
+
+/* Partial means that str is only the start of the input, so its length says nothing about the code unit size. */
+static tmu_encoding_detection tmu_detect_encoding_internal(const char* str, tm_size_t len, tm_bool partial) {
+    TM_ASSERT(str || len == 0);
+
+    tmu_encoding_detection result = {tmu_encoding_utf8, 0};
+
+    /* Byte order marks, the utf32le byte order mark starts with the utf16le byte order mark. */
+    if (tmu_bytes_start_with(str, len, tmu_utf8_bom, 3)) {
+        result.encoding = tmu_encoding_utf8_bom;
+        result.confidence = 100;
+        return result;
+    }
+    if (tmu_bytes_start_with(str, len, tmu_utf32_be_bom, 4) || tmu_bytes_start_with(str, len, tmu_utf32_le_bom, 4)) {
+        result.encoding = ((unsigned char)str[0] == 0) ? tmu_encoding_utf32be_bom : tmu_encoding_utf32le_bom;
+        result.confidence = 100;
+        return result;
+    }
+    if (tmu_bytes_start_with(str, len, tmu_utf16_be_bom, 2) || tmu_bytes_start_with(str, len, tmu_utf16_le_bom, 2)) {
+        result.encoding = ((unsigned char)str[0] == 0xFE) ? tmu_encoding_utf16be_bom : tmu_encoding_utf16le_bom;
+        result.confidence = 100;
+        return result;
+    }
+
+    /* Only a sample of the input is inspected, aligned to whole utf32 units. */
+    tm_size_t sample_len = len;
+    if (sample_len > TMU_DETECT_SAMPLE_SIZE) {
+        sample_len = TMU_DETECT_SAMPLE_SIZE;
+        partial = TM_TRUE;
+    }
+    if (partial) sample_len -= sample_len % 4;
+    if (sample_len < 4) return result;
+
+    tm_size_t zeros[4];
+    tmu_count_zero_octets(str, sample_len, zeros);
+
+    /* Utf32: the highest octet of every unit is zero and the second highest mostly is. */
+    tm_size_t units32 = sample_len / 4;
+    if (partial || len % 4 == 0) {
+        if (zeros[3] == units32 && zeros[0] < units32 && zeros[2] * 2 >= units32 &&
+            tmu_utf32_sample_valid(str, sample_len, tmu_extract_u32_le)) {
+            result.encoding = tmu_encoding_utf32le;
+            result.confidence = (int)(50 + (49 * zeros[2]) / units32);
+            return result;
+        }
+        if (zeros[0] == units32 && zeros[3] < units32 && zeros[1] * 2 >= units32 &&
+            tmu_utf32_sample_valid(str, sample_len, tmu_extract_u32_be)) {
+            result.encoding = tmu_encoding_utf32be;
+            result.confidence = (int)(50 + (49 * zeros[1]) / units32);
+            return result;
+        }
+    }
+
+    /* Utf16: ascii and latin text has zero high octets, which are at odd positions for le and even ones for be. */
+    tm_size_t units16 = sample_len / 2;
+    tm_size_t zeros_even = zeros[0] + zeros[2];
+    tm_size_t zeros_odd = zeros[1] + zeros[3];
+    tm_bool utf16_possible = partial || len % 2 == 0;
+    if (utf16_possible) {
+        if (zeros_odd * 4 >= units16 && zeros_even * 16 <= zeros_odd &&
+            tmu_utf16_sample_valid(str, sample_len, tmu_extract_u16_le, partial)) {
+            result.encoding = tmu_encoding_utf16le;
+            result.confidence = (int)(50 + (49 * (zeros_odd - zeros_even)) / units16);
+            return result;
+        }
+        if (zeros_even * 4 >= units16 && zeros_odd * 16 <= zeros_even &&
+            tmu_utf16_sample_valid(str, sample_len, tmu_extract_u16_be, partial)) {
+            result.encoding = tmu_encoding_utf16be;
+            result.confidence = (int)(50 + (49 * (zeros_even - zeros_odd)) / units16);
+            return result;
+        }
+    }
+
+    /* Utf8, the sample may end in the middle of a sequence. */
+    tm_size_t valid = tmu_utf8_valid_range(str, sample_len);
+    if (valid < sample_len && partial && sample_len - valid < 4) {
+        uint32_t c0 = TMU_WIDEN(str[valid]);
+        tm_size_t sequence_size = 0;
+        if ((c0 & 0xE0u) == 0xC0u) {
+            sequence_size = 2;
+        } else if ((c0 & 0xF0u) == 0xE0u) {
+            sequence_size = 3;
+        } else if ((c0 & 0xF8u) == 0xF0u) {
+            sequence_size = 4;
+        }
+        if (sequence_size > sample_len - valid) valid = sample_len;
+    }
+    if (valid == sample_len) {
+        tm_bool has_multibyte = TM_FALSE;
+        tm_size_t i = 0;
+        for (; i + 8 <= sample_len && !has_multibyte; i += 8) {
+            has_multibyte = (tmu_ascii_load(str + i) & TMU_ASCII_HIGH_BITS) != 0;
+        }
+        for (; i < sample_len && !has_multibyte; ++i) {
+            has_multibyte = TMU_WIDEN(str[i]) >= 0x80u;
+        }
+        tm_bool has_zeros = (zeros_even + zeros_odd) != 0;
+        /* Multibyte sequences are unlikely to be valid by accident, pure ascii is also valid in other encodings. */
+        result.confidence = (has_multibyte) ? 100 : 90;
+        if (has_zeros) result.confidence -= 40;
+        return result;
+    }
+
+    /* Not utf8 and no zero octets, might be utf16 text without ascii (cjk for instance). */
+    if (utf16_possible) {
+        tm_bool le = tmu_utf16_sample_valid(str, sample_len, tmu_extract_u16_le, partial);
+        tm_bool be = tmu_utf16_sample_valid(str, sample_len, tmu_extract_u16_be, partial);
+        if (le != be) {
+            result.encoding = (le) ? tmu_encoding_utf16le : tmu_encoding_utf16be;
+            result.confidence = 40;
+            return result;
+        }
+    }
+    return result;
+}
+
+TMU_DEF tmu_encoding_detection tmu_detect_encoding(const void* input, tm_size_t input_len) {
+    TM_ASSERT(input || input_len == 0);
+    TM_ASSERT_VALID_SIZE(input_len);
+    return tmu_detect_encoding_internal((const char*)input, input_len, /*partial=*/TM_FALSE);
+}
+
 static void tmu_output_replace_invalid_utf8(tmu_conversion_output_stream* stream, const char* replace_str,
                                             tm_size_t replace_str_len) {
     tm_size_t cur = 0;
@@ -682,9 +873,38 @@ static tm_bool tmu_convert_bytes_to_utf8_internal(const void* input, tm_size_t i
             tmu_convert_bytes_from_utf16(bytes, tmu_extract_u16_le, validate, replace_str, replace_str_len,
                                          nullterminate, out_stream);
         } else {
-            /* No encoding detected, assume utf8. */
-            out_stream->conversion.original_encoding = tmu_encoding_utf8;
-            converted = TM_FALSE;
+            /* No byte order mark, guess the encoding from the contents and fall back to utf8 if unsure. */
+            tmu_encoding_detection detected =
+                tmu_detect_encoding_internal(bytes.cur, (tm_size_t)(bytes.end - bytes.cur), /*partial=*/TM_FALSE);
+            if (detected.confidence < TMU_DETECT_MIN_CONFIDENCE) detected.encoding = tmu_encoding_utf8;
+            out_stream->conversion.original_encoding = detected.encoding;
+            switch (detected.encoding) {
+                case tmu_encoding_utf32be: {
+                    tmu_convert_bytes_from_utf32(bytes, tmu_extract_u32_be, validate, replace_str, replace_str_len,
+                                                 nullterminate, out_stream);
+                    break;
+                }
+                case tmu_encoding_utf32le: {
+                    tmu_convert_bytes_from_utf32(bytes, tmu_extract_u32_le, validate, replace_str, replace_str_len,
+                                                 nullterminate, out_stream);
+                    break;
+                }
+                case tmu_encoding_utf16be: {
+                    tmu_convert_bytes_from_utf16(bytes, tmu_extract_u16_be, validate, replace_str, replace_str_len,
+                                                 nullterminate, out_stream);
+                    break;
+                }
+                case tmu_encoding_utf16le: {
+                    tmu_convert_bytes_from_utf16(bytes, tmu_extract_u16_le, validate, replace_str, replace_str_len,
+                                                 nullterminate, out_stream);
+                    break;
+                }
+                default: {
+                    out_stream->conversion.original_encoding = tmu_encoding_utf8;
+                    converted = TM_FALSE;
+                    break;
+                }
+            }
         }
 
         return converted;
@@ -926,6 +1146,507 @@ TMU_DEF tmu_conversion_result tmu_utf8_convert_from_bytes(const void* input, tm_
     return out_stream.conversion;
 }
 
+TMU_DEF tmu_utf8_transcoder tmu_utf8_make_transcoder(tmu_encoding encoding, tmu_validate validate,
+                                                     const char* replace_str, tm_size_t replace_str_len) {
+    TM_ASSERT(validate != tmu_validate_replace || (replace_str && replace_str_len > 0));
+    TM_ASSERT(encoding >= tmu_encoding_unknown && encoding <= tmu_encoding_utf32le_bom);
+
+    tmu_utf8_transcoder result;
+    result.encoding = encoding;
+    result.original_encoding = encoding;
+    result.validate = validate;
+    result.replace_str = replace_str;
+    result.replace_str_len = replace_str_len;
+    result.window_size = 0;
+    result.window_pos = 0;
+    result.pending_size = 0;
+    result.bom_checked = TM_FALSE;
+    result.invalid_codepoints_encountered = TM_FALSE;
+    return result;
+}
+
+static tm_bool tmu_transcoder_has_bom(const tmu_utf8_transcoder* transcoder, const unsigned char* bom,
+                                      tm_size_t bom_size) {
+    if (transcoder->window_size < bom_size) return TM_FALSE;
+    for (tm_size_t i = 0; i < bom_size; ++i) {
+        if ((unsigned char)transcoder->window[i] != bom[i]) return TM_FALSE;
+    }
+    return TM_TRUE;
+}
+
+/* How many octets need to be buffered before the byte order mark can be inspected. */
+static tm_size_t tmu_transcoder_bom_size(tmu_encoding encoding) {
+    switch (encoding) {
+        case tmu_encoding_utf8:
+        case tmu_encoding_utf8_bom: {
+            return 3;
+        }
+        case tmu_encoding_utf16be:
+        case tmu_encoding_utf16be_bom:
+        case tmu_encoding_utf16le:
+        case tmu_encoding_utf16le_bom: {
+            return 2;
+        }
+        case tmu_encoding_unknown:
+        case tmu_encoding_utf32be:
+        case tmu_encoding_utf32be_bom:
+        case tmu_encoding_utf32le:
+        case tmu_encoding_utf32le_bom:
+        default: {
+            return 4;
+        }
+    }
+}
+
+/* Inspects the window for a byte order mark, resolves the encoding and skips the byte order mark. */
+static tm_errc tmu_transcoder_check_bom(tmu_utf8_transcoder* transcoder) {
+    typedef struct {
+        tmu_encoding encoding;
+        tmu_encoding encoding_bom;
+        const unsigned char* bom;
+        tm_size_t bom_size;
+    } bom_entry;
+
+    /* Order matters, the utf32le byte order mark starts with the utf16le byte order mark. */
+    static const bom_entry entries[] = {
+        {tmu_encoding_utf8, tmu_encoding_utf8_bom, tmu_utf8_bom, 3},
+        {tmu_encoding_utf32be, tmu_encoding_utf32be_bom, tmu_utf32_be_bom, 4},
+        {tmu_encoding_utf32le, tmu_encoding_utf32le_bom, tmu_utf32_le_bom, 4},
+        {tmu_encoding_utf16be, tmu_encoding_utf16be_bom, tmu_utf16_be_bom, 2},
+        {tmu_encoding_utf16le, tmu_encoding_utf16le_bom, tmu_utf16_le_bom, 2},
+    };
+
+    transcoder->bom_checked = TM_TRUE;
+    if (transcoder->window_size == 0) {
+        /* Empty input, nothing to detect. */
+        transcoder->encoding = tmu_encoding_utf8;
+        if (transcoder->original_encoding == tmu_encoding_unknown) transcoder->original_encoding = tmu_encoding_utf8;
+        return TM_OK;
+    }
+
+    const bom_entry* found = TM_NULL;
+    tm_size_t count = (tm_size_t)(sizeof(entries) / sizeof(entries[0]));
+    for (tm_size_t i = 0; i < count; ++i) {
+        const bom_entry* entry = &entries[i];
+        if (transcoder->encoding == tmu_encoding_unknown) {
+            if (tmu_transcoder_has_bom(transcoder, entry->bom, entry->bom_size)) {
+                found = entry;
+                break;
+            }
+        } else if (transcoder->encoding == entry->encoding || transcoder->encoding == entry->encoding_bom) {
+            if (tmu_transcoder_has_bom(transcoder, entry->bom, entry->bom_size)) {
+                found = entry;
+                break;
+            }
+            if (transcoder->encoding == entry->encoding_bom) {
+                /* Byte order mark expected but not found, error out. */
+                return TM_EINVAL;
+            }
+            transcoder->encoding = entry->encoding;
+            transcoder->original_encoding = entry->encoding;
+            return TM_OK;
+        }
+    }
+
+    if (!found) {
+        /* No encoding detected, assume utf8. */
+        transcoder->encoding = tmu_encoding_utf8;
+        transcoder->original_encoding = tmu_encoding_utf8;
+        return TM_OK;
+    }
+
+    transcoder->encoding = found->encoding;
+    transcoder->original_encoding = found->encoding_bom;
+    transcoder->window_pos = found->bom_size;
+    return TM_OK;
+}
+
+typedef enum {
+    tmu_transcode_ok,
+    tmu_transcode_invalid,
+    tmu_transcode_incomplete, /* More input is needed to decode the sequence. */
+    tmu_transcode_truncated   /* Input ended in the middle of a code unit. */
+} tmu_transcode_status;
+
+typedef struct {
+    tmu_transcode_status status;
+    tm_size_t consumed;
+    uint32_t codepoint;
+} tmu_transcode_decoded;
+
+/* Decodes a single sequence using the same rules as tmu_utf8_convert_from_bytes. */
+static tmu_transcode_decoded tmu_transcode_decode(tmu_encoding encoding, const char* in, tm_size_t in_len,
+                                                  tm_bool final) {
+    TM_ASSERT(in_len > 0);
+
+    tmu_transcode_decoded result = {tmu_transcode_ok, 0, TMU_INVALID_CODEPOINT};
+    switch (encoding) {
+        case tmu_encoding_utf8: {
+            /* Invalid octets are consumed one at a time, same as in tmu_utf8_convert_from_bytes. */
+            result.status = tmu_transcode_invalid;
+            result.consumed = 1;
+
+            uint32_t c0 = TMU_WIDEN(in[0]);
+            tm_size_t sequence_size = 0;
+            if (c0 < 0x80u) {
+                sequence_size = 1;
+            } else if ((c0 & 0xE0u) == 0xC0u) {
+                sequence_size = 2;
+            } else if ((c0 & 0xF0u) == 0xE0u) {
+                sequence_size = 3;
+            } else if ((c0 & 0xF8u) == 0xF0u) {
+                sequence_size = 4;
+            }
+            if (sequence_size == 0 || (c0 & 0xFEu) == 0xC0u || c0 > 0xF4u) break;
+
+            if (in_len >= sequence_size) {
+                if (tmu_utf8_valid_range(in, sequence_size) == sequence_size) {
+                    result.status = tmu_transcode_ok;
+                    result.consumed = sequence_size;
+                }
+                break;
+            }
+
+            /* Sequence continues in the next chunk, only wait for it if the octets so far are well formed. */
+            for (tm_size_t i = 1; i < in_len; ++i) {
+                if ((TMU_WIDEN(in[i]) & 0xC0u) != 0x80u) return result;
+            }
+            if (in_len >= 2) {
+                uint32_t c1 = TMU_WIDEN(in[1]);
+                if (c0 == 0xE0u && c1 < 0xA0u) break; /* Overlong. */
+                if (c0 == 0xEDu && c1 > 0x9Fu) break; /* Surrogate. */
+                if (c0 == 0xF0u && c1 < 0x90u) break; /* Overlong. */
+                if (c0 == 0xF4u && c1 > 0x8Fu) break; /* Invalid codepoints. */
+            }
+            if (!final) result.status = tmu_transcode_incomplete;
+            break;
+        }
+        case tmu_encoding_utf16be:
+        case tmu_encoding_utf16le: {
+            uint16_t (*extract)(tmu_byte_stream*) =
+                (encoding == tmu_encoding_utf16be) ? tmu_extract_u16_be : tmu_extract_u16_le;
+            tmu_byte_stream bytes = {TM_NULL, TM_NULL};
+            bytes.cur = in;
+            bytes.end = in + in_len;
+
+            if (in_len < 2) {
+                result.status = (final) ? tmu_transcode_truncated : tmu_transcode_incomplete;
+                break;
+            }
+
+            uint32_t lead = extract(&bytes);
+            result.consumed = 2;
+            if (lead >= TMU_LEAD_SURROGATE_MIN && lead <= TMU_LEAD_SURROGATE_MAX) {
+                if (in_len < 4) {
+                    result.status = (final) ? tmu_transcode_invalid : tmu_transcode_incomplete;
+                    break;
+                }
+                /* Like tmu_utf8_convert_from_bytes, an unpaired lead surrogate swallows the following code unit. */
+                uint32_t trail = extract(&bytes);
+                result.consumed = 4;
+                if (trail >= TMU_TRAILING_SURROGATE_MIN && trail <= TMU_TRAILING_SURROGATE_MAX) {
+                    result.codepoint = (lead << 10) + trail + TMU_SURROGATE_OFFSET;
+                }
+            } else {
+                result.codepoint = lead;
+            }
+            result.status = (tmu_is_valid_codepoint(result.codepoint)) ? tmu_transcode_ok : tmu_transcode_invalid;
+            break;
+        }
+        case tmu_encoding_utf32be:
+        case tmu_encoding_utf32le: {
+            if (in_len < 4) {
+                result.status = (final) ? tmu_transcode_truncated : tmu_transcode_incomplete;
+                break;
+            }
+            tmu_byte_stream bytes = {TM_NULL, TM_NULL};
+            bytes.cur = in;
+            bytes.end = in + in_len;
+            result.codepoint = (encoding == tmu_encoding_utf32be) ? tmu_extract_u32_be(&bytes)
+                                                                  : tmu_extract_u32_le(&bytes);
+            result.consumed = 4;
+            result.status = (tmu_is_valid_codepoint(result.codepoint)) ? tmu_transcode_ok : tmu_transcode_invalid;
+            break;
+        }
+        default: {
+            TM_ASSERT(0 && "Invalid encoding.");
+            result.status = tmu_transcode_truncated;
+            break;
+        }
+    }
+    return result;
+}
+
+/* Writes the output of a decoded sequence. Returns TM_ERANGE without writing anything if out is too small. */
+static tm_errc tmu_transcode_emit(tmu_utf8_transcoder* transcoder, const tmu_transcode_decoded* decoded,
+                                  const char* in, char* out, tm_size_t out_len, tm_size_t* size) {
+    TM_ASSERT(*size <= out_len);
+    tm_size_t remaining = out_len - *size;
+
+    if (decoded->status == tmu_transcode_ok) {
+        if (transcoder->encoding == tmu_encoding_utf8) {
+            if (decoded->consumed > remaining) return TM_ERANGE;
+            TMU_MEMCPY(out + *size, in, decoded->consumed * sizeof(char));
+            *size += decoded->consumed;
+        } else {
+            tm_size_t write_size = tmu_utf8_encode(decoded->codepoint, out + *size, remaining);
+            if (write_size > remaining) return TM_ERANGE;
+            *size += write_size;
+        }
+        return TM_OK;
+    }
+
+    TM_ASSERT(decoded->status == tmu_transcode_invalid);
+    switch (transcoder->validate) {
+        case tmu_validate_skip: {
+            break;
+        }
+        case tmu_validate_replace: {
+            if (transcoder->replace_str_len > remaining) return TM_ERANGE;
+            TMU_MEMCPY(out + *size, transcoder->replace_str, transcoder->replace_str_len * sizeof(char));
+            *size += transcoder->replace_str_len;
+            break;
+        }
+        case tmu_validate_error:
+        default: {
+            transcoder->invalid_codepoints_encountered = TM_TRUE;
+            return TM_EINVAL;
+        }
+    }
+    transcoder->invalid_codepoints_encountered = TM_TRUE;
+    return TM_OK;
+}
+
+/*
+Converts runs of ascii without decoding. Ascii is detected 8 octets at a time by masking the high bits of every
+code unit, for utf16 that means 4 code units and for utf32 2 code units per 8 octets.
+Returns the number of octets consumed, the number of octets written is derived from the code unit size.
+*/
+static tm_size_t tmu_transcode_ascii(tmu_encoding encoding, const char* in, tm_size_t in_len, char* out,
+                                     tm_size_t out_len) {
+    tm_size_t consumed = 0;
+    switch (encoding) {
+        case tmu_encoding_utf8: {
+            tm_size_t len = (in_len < out_len) ? in_len : out_len;
+            consumed = tmu_utf8_valid_range(in, len);
+            if (consumed) TMU_MEMCPY(out, in, consumed * sizeof(char));
+            break;
+        }
+        case tmu_encoding_utf16be:
+        case tmu_encoding_utf16le: {
+            uint64_t mask = (encoding == tmu_encoding_utf16le) ? 0xFF80FF80FF80FF80ull : 0x80FF80FF80FF80FFull;
+            int shift = (encoding == tmu_encoding_utf16le) ? 0 : 8;
+            tm_size_t written = 0;
+            while (in_len - consumed >= 8 && out_len - written >= 4) {
+                uint64_t units = tmu_ascii_load(in + consumed);
+                if (units & mask) break;
+                for (int i = 0; i < 4; ++i) {
+                    out[written + i] = (char)(uint8_t)(units >> (i * 16 + shift));
+                }
+                consumed += 8;
+                written += 4;
+            }
+            break;
+        }
+        case tmu_encoding_utf32be:
+        case tmu_encoding_utf32le: {
+            uint64_t mask = (encoding == tmu_encoding_utf32le) ? 0xFFFFFF80FFFFFF80ull : 0x80FFFFFF80FFFFFFull;
+            int shift = (encoding == tmu_encoding_utf32le) ? 0 : 24;
+            tm_size_t written = 0;
+            while (in_len - consumed >= 8 && out_len - written >= 2) {
+                uint64_t units = tmu_ascii_load(in + consumed);
+                if (units & mask) break;
+                out[written] = (char)(uint8_t)(units >> shift);
+                out[written + 1] = (char)(uint8_t)(units >> (32 + shift));
+                consumed += 8;
+                written += 2;
+            }
+            break;
+        }
+        default: {
+            TM_ASSERT(0 && "Invalid encoding.");
+            break;
+        }
+    }
+    return consumed;
+}
+
+static tm_size_t tmu_transcode_ascii_written(tmu_encoding encoding, tm_size_t consumed) {
+    switch (encoding) {
+        case tmu_encoding_utf16be:
+        case tmu_encoding_utf16le: {
+            return consumed / 2;
+        }
+        case tmu_encoding_utf32be:
+        case tmu_encoding_utf32le: {
+            return consumed / 4;
+        }
+        default: {
+            return consumed;
+        }
+    }
+}
+
+/*
+Converts in to out, an incomplete sequence at the end is buffered in pending unless final is set.
+Returns the number of octets consumed, ec is set to TM_ERANGE if out is full.
+*/
+static tm_size_t tmu_transcode_run(tmu_utf8_transcoder* transcoder, const char* in, tm_size_t in_len, tm_bool final,
+                                   char* out, tm_size_t out_len, tm_size_t* size, tm_errc* ec) {
+    tm_size_t consumed = 0;
+    while (consumed < in_len) {
+        tm_size_t ascii = tmu_transcode_ascii(transcoder->encoding, in + consumed, in_len - consumed, out + *size,
+                                              out_len - *size);
+        consumed += ascii;
+        *size += tmu_transcode_ascii_written(transcoder->encoding, ascii);
+        if (consumed == in_len) break;
+
+        const char* cur = in + consumed;
+        tm_size_t remaining = in_len - consumed;
+        tmu_transcode_decoded decoded = tmu_transcode_decode(transcoder->encoding, cur, remaining, final);
+        if (decoded.status == tmu_transcode_incomplete) {
+            TM_ASSERT(transcoder->pending_size == 0);
+            TM_ASSERT(remaining < (tm_size_t)sizeof(transcoder->pending));
+            TMU_MEMCPY(transcoder->pending, cur, remaining * sizeof(char));
+            transcoder->pending_size = remaining;
+            consumed = in_len;
+            break;
+        }
+        if (decoded.status == tmu_transcode_truncated) {
+            *ec = TM_EINVAL;
+            break;
+        }
+
+        *ec = tmu_transcode_emit(transcoder, &decoded, cur, out, out_len, size);
+        if (*ec != TM_OK) break;
+        consumed += decoded.consumed;
+    }
+    return consumed;
+}
+
+static tmu_transcode_result tmu_utf8_transcode_internal(tmu_utf8_transcoder* transcoder, const char* in,
+                                                        tm_size_t in_len, tm_bool final, char* out,
+                                                        tm_size_t out_len) {
+    TM_ASSERT(transcoder);
+    TM_ASSERT(in || in_len == 0);
+    TM_ASSERT(out || out_len == 0);
+    TM_ASSERT_VALID_SIZE(in_len);
+    TM_ASSERT_VALID_SIZE(out_len);
+    TM_ASSERT(transcoder->pending_size <= (tm_size_t)sizeof(transcoder->pending));
+    TM_ASSERT(transcoder->window_pos <= transcoder->window_size);
+
+    tmu_transcode_result result = {0, 0, TM_OK};
+
+    if (!transcoder->bom_checked) {
+        /* Buffer enough octets to be able to detect the encoding or the byte order mark. */
+        tm_size_t needed = (transcoder->encoding == tmu_encoding_unknown)
+                               ? (tm_size_t)sizeof(transcoder->window)
+                               : tmu_transcoder_bom_size(transcoder->encoding);
+        TM_ASSERT(transcoder->window_size <= needed);
+        tm_size_t take = needed - transcoder->window_size;
+        if (take > in_len) take = in_len;
+        if (take) TMU_MEMCPY(transcoder->window + transcoder->window_size, in, take * sizeof(char));
+        transcoder->window_size += take;
+        result.consumed = take;
+        if (transcoder->window_size < needed && !final) return result;
+
+        if (transcoder->encoding == tmu_encoding_unknown) {
+            /* A full window is only a partial sample of the input if more input follows, wait until that is known,
+               so that the same encoding is detected as by tmu_utf8_convert_from_bytes. */
+            tm_bool partial = result.consumed < in_len;
+            if (!partial && !final) return result;
+            tmu_encoding_detection detected =
+                tmu_detect_encoding_internal(transcoder->window, transcoder->window_size, partial);
+            transcoder->encoding =
+                (detected.confidence >= TMU_DETECT_MIN_CONFIDENCE) ? detected.encoding : tmu_encoding_utf8;
+        }
+
+        result.ec = tmu_transcoder_check_bom(transcoder);
+        if (result.ec != TM_OK) return result;
+    }
+
+    /* Convert the buffered start of the input first, an incomplete sequence at its end is moved to pending. */
+    if (transcoder->window_pos < transcoder->window_size) {
+        tm_bool at_end = final && result.consumed == in_len;
+        tm_errc ec = TM_OK;
+        tm_size_t consumed = tmu_transcode_run(transcoder, transcoder->window + transcoder->window_pos,
+                                               transcoder->window_size - transcoder->window_pos, at_end, out, out_len,
+                                               &result.size, &ec);
+        transcoder->window_pos += consumed;
+        if (ec != TM_OK) {
+            if (ec == TM_ERANGE) ec = (result.size == 0 && result.consumed == 0 && consumed == 0) ? TM_ERANGE : TM_OK;
+            result.ec = ec;
+            return result;
+        }
+        TM_ASSERT(transcoder->window_pos == transcoder->window_size);
+    }
+
+    /* Convert buffered octets from the previous chunk, topping them up with octets from the input. */
+    while (transcoder->pending_size > 0) {
+        char buffer[sizeof(transcoder->pending)];
+        tm_size_t pending_size = transcoder->pending_size;
+        tm_size_t take = (tm_size_t)sizeof(buffer) - pending_size;
+        if (take > in_len - result.consumed) take = in_len - result.consumed;
+        TMU_MEMCPY(buffer, transcoder->pending, pending_size * sizeof(char));
+        if (take) TMU_MEMCPY(buffer + pending_size, in + result.consumed, take * sizeof(char));
+
+        tm_bool at_end = final && result.consumed + take == in_len;
+        tmu_transcode_decoded decoded = tmu_transcode_decode(transcoder->encoding, buffer, pending_size + take, at_end);
+        if (decoded.status == tmu_transcode_incomplete) {
+            /* All available input is buffered, wait for the next chunk. */
+            TM_ASSERT(result.consumed + take == in_len);
+            TMU_MEMCPY(transcoder->pending, buffer, (pending_size + take) * sizeof(char));
+            transcoder->pending_size = pending_size + take;
+            result.consumed = in_len;
+            return result;
+        }
+        if (decoded.status == tmu_transcode_truncated) {
+            /* There are remaining bytes in the byte stream that we couldn't convert. */
+            result.ec = TM_EINVAL;
+            return result;
+        }
+
+        tm_errc ec = tmu_transcode_emit(transcoder, &decoded, buffer, out, out_len, &result.size);
+        if (ec != TM_OK) {
+            if (ec == TM_ERANGE) ec = (result.size == 0 && result.consumed == 0) ? TM_ERANGE : TM_OK;
+            result.ec = ec;
+            return result;
+        }
+
+        if (decoded.consumed >= pending_size) {
+            result.consumed += decoded.consumed - pending_size;
+            transcoder->pending_size = 0;
+        } else {
+            transcoder->pending_size = pending_size - decoded.consumed;
+            TMU_MEMMOVE(transcoder->pending, transcoder->pending + decoded.consumed,
+                        transcoder->pending_size * sizeof(char));
+        }
+    }
+
+    if (result.consumed < in_len) {
+        tm_errc ec = TM_OK;
+        result.consumed += tmu_transcode_run(transcoder, in + result.consumed, in_len - result.consumed, final, out,
+                                             out_len, &result.size, &ec);
+        if (ec == TM_ERANGE) ec = (result.size == 0 && result.consumed == 0) ? TM_ERANGE : TM_OK;
+        result.ec = ec;
+    }
+    return result;
+}
+
+TMU_DEF tmu_transcode_result tmu_utf8_transcode(tmu_utf8_transcoder* transcoder, const void* input,
+                                                tm_size_t input_len, char* out, tm_size_t out_len) {
+    return tmu_utf8_transcode_internal(transcoder, (const char*)input, input_len, /*final=*/TM_FALSE, out, out_len);
+}
+
+TMU_DEF tmu_transcode_result tmu_utf8_transcode_finish(tmu_utf8_transcoder* transcoder, char* out, tm_size_t out_len) {
+    tmu_transcode_result result =
+        tmu_utf8_transcode_internal(transcoder, /*in=*/TM_NULL, /*in_len=*/0, /*final=*/TM_TRUE, out, out_len);
+    if (result.ec == TM_OK && (transcoder->pending_size > 0 || transcoder->window_pos < transcoder->window_size)) {
+        result.ec = TM_ERANGE;
+    }
+    return result;
+}
+
 TMU_DEF tm_size_t tmu_utf8_valid_range(const char* str, tm_size_t len) {
     /* Checking for legal utf-8 byte sequences according to
        https://www.unicode.org/versions/Unicode11.0.0/ch03.pdf
@@ -934,6 +1655,11 @@ TMU_DEF tm_size_t tmu_utf8_valid_range(const char* str, tm_size_t len) {
     tm_size_t remaining = len;
     while (remaining) {
         tm_size_t i = len - remaining;
+        /* Skip runs of ascii 8 octets at a time. */
+        if (remaining >= 8 && !(tmu_ascii_load(str + i) & TMU_ASCII_HIGH_BITS)) {
+            remaining -= 8;
+            continue;
+        }
         uint32_t c0 = (uint32_t)((uint8_t)str[i]);
         if (c0 < 0x80u) {
             /* Codepoint: 00000000 0xxxxxxx
@@ -1287,6 +2013,49 @@ TMU_DEF int tmu_utf8_compare(const char* a, tm_size_t a_len, const char* b, tm_s
     return 0;
 }
 
+/*
+Counts the octets that start a codepoint, which are all octets that aren't of the form 10xxxxxx.
+The octets are checked 8 at a time: an octet starts a codepoint if bit 7 is clear or bit 6 is set. The resulting
+flags are accumulated per octet lane and summed horizontally every 255 words before the lanes could overflow.
+*/
+static tm_size_t tmu_utf8_count_lead_octets(const char* str, tm_size_t len) {
+    tm_size_t result = 0;
+    tm_size_t i = 0;
+    while (len - i >= 8) {
+        uint64_t lanes = 0;
+        for (int words = 0; words < 255 && len - i >= 8; ++words, i += 8) {
+            uint64_t octets = tmu_ascii_load(str + i);
+            lanes += ((~octets | (octets << 1)) & TMU_ASCII_HIGH_BITS) >> 7;
+        }
+        lanes = (lanes & 0x00FF00FF00FF00FFull) + ((lanes >> 8) & 0x00FF00FF00FF00FFull);
+        result += (tm_size_t)((lanes * 0x0001000100010001ull) >> 48);
+    }
+    for (; i < len; ++i) {
+        if ((TMU_WIDEN(str[i]) & 0xC0u) != 0x80u) ++result;
+    }
+    return result;
+}
+
+/* Returns the offset of the codepoint that comes count codepoints after str[0], or len if there aren't enough. */
+static tm_size_t tmu_utf8_skip_lead_octets(const char* str, tm_size_t len, tm_size_t count) {
+    tm_size_t i = 0;
+    while (len - i >= 8) {
+        uint64_t octets = tmu_ascii_load(str + i);
+        uint64_t lanes = ((~octets | (octets << 1)) & TMU_ASCII_HIGH_BITS) >> 7;
+        tm_size_t leads = (tm_size_t)((lanes * TMU_ASCII_ONES) >> 56);
+        if (leads > count) break;
+        count -= leads;
+        i += 8;
+    }
+    for (; i < len; ++i) {
+        if ((TMU_WIDEN(str[i]) & 0xC0u) != 0x80u) {
+            if (count == 0) return i;
+            --count;
+        }
+    }
+    return len;
+}
+
 TMU_DEF tm_size_t tmu_utf8_count_codepoints(const char* str) {
     return tmu_utf8_count_codepoints_stream(tmu_utf8_make_stream(str));
 }
@@ -1296,8 +2065,332 @@ TMU_DEF tm_size_t tmu_utf8_count_codepoints_n(const char* str, tm_size_t str_len
 TMU_DEF tm_size_t tmu_utf8_count_codepoints_stream(tmu_utf8_stream stream) {
     TM_ASSERT(stream.cur <= stream.end);
     tm_size_t result = 0;
-    uint32_t codepoint = TMU_INVALID_CODEPOINT;
-    while (tmu_utf8_extract(&stream, &codepoint)) ++result;
+    while (stream.cur != stream.end) {
+        /* Valid ranges can be counted without decoding. */
+        tm_size_t remaining = (tm_size_t)(stream.end - stream.cur);
+        tm_size_t valid = tmu_utf8_valid_range(stream.cur, remaining);
+        result += tmu_utf8_count_lead_octets(stream.cur, valid);
+        stream.cur += valid;
+        if (valid == remaining) break;
+
+        /* tmu_utf8_extract is more lenient than tmu_utf8_valid_range, count for as long as it accepts the input. */
+        uint32_t codepoint = TMU_INVALID_CODEPOINT;
+        if (!tmu_utf8_extract(&stream, &codepoint)) break;
+        ++result;
+    }
+    return result;
+}
+
+/*
+Writes checkpoints for every interval-th codepoint in [begin, end), not including the one at begin.
+Returns the number of checkpoints written.
+*/
+static tm_size_t tmu_offset_index_fill(const char* str, tm_size_t begin, tm_size_t end, tm_size_t begin_index,
+                                       tm_size_t interval, tmu_utf8_checkpoint* out) {
+    tm_size_t count = 0;
+    tm_size_t offset = begin;
+    tm_size_t codepoint_index = begin_index;
+    for (;;) {
+        offset += tmu_utf8_skip_lead_octets(str + offset, end - offset, interval);
+        if (offset >= end) break;
+        codepoint_index += interval;
+        out[count].index = codepoint_index;
+        out[count].offset = offset;
+        ++count;
+    }
+    return count;
+}
+
+/* Number of checkpoints that tmu_offset_index_fill writes for a range of codepoint_count codepoints. */
+static tm_size_t tmu_offset_index_fill_count(tm_size_t codepoint_count, tm_size_t interval) {
+    return (codepoint_count > 0) ? ((codepoint_count - 1) / interval) : 0;
+}
+
+/* Index of the last checkpoint with offset <= offset. */
+static tm_size_t tmu_offset_index_find_offset(const tmu_utf8_offset_index* index, tm_size_t offset) {
+    TM_ASSERT(index->count > 0);
+    tm_size_t first = 0;
+    tm_size_t last = index->count;
+    while (last - first > 1) {
+        tm_size_t mid = first + (last - first) / 2;
+        if (index->checkpoints[mid].offset <= offset) {
+            first = mid;
+        } else {
+            last = mid;
+        }
+    }
+    return first;
+}
+
+/* Index of the last checkpoint with index <= codepoint_index. */
+static tm_size_t tmu_offset_index_find_codepoint(const tmu_utf8_offset_index* index, tm_size_t codepoint_index) {
+    TM_ASSERT(index->count > 0);
+    tm_size_t first = 0;
+    tm_size_t last = index->count;
+    while (last - first > 1) {
+        tm_size_t mid = first + (last - first) / 2;
+        if (index->checkpoints[mid].index <= codepoint_index) {
+            first = mid;
+        } else {
+            last = mid;
+        }
+    }
+    return first;
+}
+
+TMU_DEF tmu_utf8_offset_index_result tmu_utf8_make_offset_index(const char* str, tm_size_t str_len,
+                                                                tm_size_t interval) {
+    TM_ASSERT(str || str_len == 0);
+    TM_ASSERT_VALID_SIZE(str_len);
+    TM_ASSERT(interval > 0);
+
+    tmu_utf8_offset_index_result result = {{TM_NULL, 0, 0, 0, 0, 0}, TM_OK};
+
+    tm_size_t codepoints = tmu_utf8_count_lead_octets(str, str_len);
+    tm_size_t capacity = 1 + tmu_offset_index_fill_count(codepoints, interval);
+    tmu_utf8_checkpoint* checkpoints =
+        (tmu_utf8_checkpoint*)TMU_MALLOC(capacity * sizeof(tmu_utf8_checkpoint), sizeof(tm_size_t));
+    if (!checkpoints) {
+        result.ec = TM_ENOMEM;
+        return result;
+    }
+
+    checkpoints[0].index = 0;
+    checkpoints[0].offset = 0;
+    tm_size_t count = 1 + tmu_offset_index_fill(str, 0, str_len, 0, interval, checkpoints + 1);
+    TM_ASSERT(count == capacity);
+
+    result.index.checkpoints = checkpoints;
+    result.index.count = count;
+    result.index.capacity = capacity;
+    result.index.interval = interval;
+    result.index.codepoints = codepoints;
+    result.index.size = str_len;
+    return result;
+}
+
+TMU_DEF void tmu_utf8_destroy_offset_index(tmu_utf8_offset_index* index) {
+    TM_ASSERT(index);
+    if (index->checkpoints) TMU_FREE(index->checkpoints);
+    index->checkpoints = TM_NULL;
+    index->count = 0;
+    index->capacity = 0;
+    index->codepoints = 0;
+    index->size = 0;
+}
+
+TMU_DEF tm_size_t tmu_utf8_offset_index_to_offset(const tmu_utf8_offset_index* index, const char* str,
+                                                  tm_size_t codepoint_index) {
+    TM_ASSERT(index);
+    TM_ASSERT(str || index->size == 0);
+
+    if (codepoint_index >= index->codepoints) return index->size;
+
+    tm_size_t found = tmu_offset_index_find_codepoint(index, codepoint_index);
+    const tmu_utf8_checkpoint* checkpoint = &index->checkpoints[found];
+    return checkpoint->offset + tmu_utf8_skip_lead_octets(str + checkpoint->offset, index->size - checkpoint->offset,
+                                                          codepoint_index - checkpoint->index);
+}
+
+TMU_DEF tm_size_t tmu_utf8_offset_index_to_codepoint(const tmu_utf8_offset_index* index, const char* str,
+                                                     tm_size_t offset) {
+    TM_ASSERT(index);
+    TM_ASSERT(str || index->size == 0);
+
+    if (offset >= index->size) return index->codepoints;
+
+    const tmu_utf8_checkpoint* checkpoint = &index->checkpoints[tmu_offset_index_find_offset(index, offset)];
+    tm_size_t leads = tmu_utf8_count_lead_octets(str + checkpoint->offset, offset + 1 - checkpoint->offset);
+    TM_ASSERT(leads > 0);
+    return checkpoint->index + leads - 1;
+}
+
+TMU_DEF tm_errc tmu_utf8_offset_index_update(tmu_utf8_offset_index* index, const char* str, tm_size_t str_len,
+                                             tm_size_t edit_offset, tm_size_t removed_len, tm_size_t inserted_len) {
+    TM_ASSERT(index);
+    TM_ASSERT(index->count > 0);
+    TM_ASSERT(str || str_len == 0);
+    TM_ASSERT(edit_offset + removed_len <= index->size);
+    TM_ASSERT(str_len == index->size - removed_len + inserted_len);
+
+    /* Checkpoints in [lo + 1, hi) are inside the edited range and get replaced. Checkpoints from hi on are shifted. */
+    tm_size_t edit_end = edit_offset + removed_len;
+    tm_size_t lo = tmu_offset_index_find_offset(index, edit_offset);
+    tm_size_t hi = tmu_offset_index_find_offset(index, (edit_end > edit_offset) ? (edit_end - 1) : edit_offset) + 1;
+    TM_ASSERT(hi > lo);
+
+    tmu_utf8_checkpoint lo_checkpoint = index->checkpoints[lo];
+    tm_size_t region_end = str_len;
+    if (hi < index->count) region_end = index->checkpoints[hi].offset - removed_len + inserted_len;
+
+    tm_size_t region_codepoints = tmu_utf8_count_lead_octets(str + lo_checkpoint.offset,
+                                                             region_end - lo_checkpoint.offset);
+    tm_size_t fill_count = tmu_offset_index_fill_count(region_codepoints, index->interval);
+    tm_size_t new_count = index->count - (hi - lo - 1) + fill_count;
+
+    if (new_count > index->capacity) {
+        tm_size_t new_capacity = index->capacity * 2;
+        if (new_capacity < new_count) new_capacity = new_count;
+        tmu_utf8_checkpoint* new_checkpoints = (tmu_utf8_checkpoint*)TMU_REALLOC(
+            index->checkpoints, new_capacity * sizeof(tmu_utf8_checkpoint), sizeof(tm_size_t));
+        if (!new_checkpoints) return TM_ENOMEM;
+        index->checkpoints = new_checkpoints;
+        index->capacity = new_capacity;
+    }
+
+    tm_size_t new_codepoints = lo_checkpoint.index + region_codepoints;
+    if (hi < index->count) {
+        /* Shift checkpoints after the edit, both their codepoint indices and offsets are relative to hi. */
+        tm_size_t hi_index = index->checkpoints[hi].index;
+        tm_size_t hi_offset = index->checkpoints[hi].offset;
+        tm_size_t tail_count = index->count - hi;
+        TMU_MEMMOVE(index->checkpoints + lo + 1 + fill_count, index->checkpoints + hi,
+                    tail_count * sizeof(tmu_utf8_checkpoint));
+        for (tm_size_t i = lo + 1 + fill_count; i < new_count; ++i) {
+            index->checkpoints[i].index = index->checkpoints[i].index - hi_index + new_codepoints;
+            index->checkpoints[i].offset = index->checkpoints[i].offset - hi_offset + region_end;
+        }
+        new_codepoints = index->codepoints - hi_index + new_codepoints;
+    }
+
+    tm_size_t filled = tmu_offset_index_fill(str, lo_checkpoint.offset, region_end, lo_checkpoint.index,
+                                             index->interval, index->checkpoints + lo + 1);
+    TM_ASSERT(filled == fill_count);
+    TM_UNREFERENCED(filled);
+
+    index->count = new_count;
+    index->codepoints = new_codepoints;
+    index->size = str_len;
+    return TM_OK;
+}
+
+typedef tm_size_t tmu_chunk_end_proc(const char* str, tm_size_t str_len, tm_size_t begin, tm_size_t end);
+
+/* Moves end back to the start of the sequence it points into. */
+static tm_size_t tmu_utf8_codepoint_chunk_end(const char* str, tm_size_t str_len, tm_size_t begin, tm_size_t end) {
+    TM_ASSERT(end < str_len);
+    TM_UNREFERENCED_PARAM(str_len);
+    tm_size_t original_end = end;
+    for (int i = 0; i < 3 && end > begin + 1 && (TMU_WIDEN(str[end]) & 0xC0u) == 0x80u; ++i) --end;
+    /* More than three continuation octets in a row, the octet at original_end is invalid no matter where the chunk
+       starts. Splitting there keeps the preceding codepoint intact, just like in the serial versions. */
+    if ((TMU_WIDEN(str[end]) & 0xC0u) == 0x80u) return original_end;
+    return end;
+}
+
+static tm_size_t tmu_utf8_split_chunks_internal(const char* str, tm_size_t str_len, tm_size_t chunk_size,
+                                                tmu_chunk_end_proc* chunk_end, tmu_utf8_chunk* out,
+                                                tm_size_t out_len) {
+    TM_ASSERT(str || str_len == 0);
+    TM_ASSERT(out || out_len == 0);
+    TM_ASSERT_VALID_SIZE(str_len);
+
+    if (chunk_size < 16) chunk_size = 16;
+
+    tm_size_t count = 0;
+    tm_size_t begin = 0;
+    while (begin < str_len) {
+        tm_size_t end = str_len;
+        if (str_len - begin > chunk_size) end = chunk_end(str, str_len, begin, begin + chunk_size);
+        TM_ASSERT(end > begin);
+        if (count < out_len) {
+            out[count].offset = begin;
+            out[count].size = end - begin;
+        }
+        ++count;
+        begin = end;
+    }
+    return count;
+}
+
+TMU_DEF tm_size_t tmu_utf8_split_chunks(const char* str, tm_size_t str_len, tm_size_t chunk_size, tmu_utf8_chunk* out,
+                                        tm_size_t out_len) {
+    return tmu_utf8_split_chunks_internal(str, str_len, chunk_size, tmu_utf8_codepoint_chunk_end, out, out_len);
+}
+
+typedef struct {
+    const char* str;
+    const tmu_utf8_chunk* chunks;
+    tm_size_t* valid;  /* Valid range of each chunk. */
+    tm_size_t* counts; /* Codepoints in the valid range of each chunk. */
+} tmu_parallel_task_data;
+
+static void tmu_valid_range_task(void* task_data, tm_size_t index) {
+    tmu_parallel_task_data* data = (tmu_parallel_task_data*)task_data;
+    const tmu_utf8_chunk* chunk = &data->chunks[index];
+    data->valid[index] = tmu_utf8_valid_range(data->str + chunk->offset, chunk->size);
+}
+
+static void tmu_count_codepoints_task(void* task_data, tm_size_t index) {
+    tmu_parallel_task_data* data = (tmu_parallel_task_data*)task_data;
+    const tmu_utf8_chunk* chunk = &data->chunks[index];
+    const char* str = data->str + chunk->offset;
+    data->valid[index] = tmu_utf8_valid_range(str, chunk->size);
+    data->counts[index] = tmu_utf8_count_lead_octets(str, data->valid[index]);
+}
+
+/* Splits str into chunks and runs task on every chunk. Returns the number of chunks or 0 on allocation failure. */
+static tm_size_t tmu_utf8_run_parallel(const char* str, tm_size_t str_len, tm_size_t chunk_size,
+                                       tmu_parallel_for_proc* parallel_for, void* user_data, tmu_task_proc* task,
+                                       tmu_parallel_task_data* data) {
+    TM_ASSERT(str || str_len == 0);
+    TM_ASSERT(parallel_for);
+
+    if (chunk_size == 0) chunk_size = 1024 * 1024;
+    tm_size_t count = tmu_utf8_split_chunks(str, str_len, chunk_size, TM_NULL, 0);
+    if (count <= 1) return 0;
+
+    /* Chunks and per chunk results are allocated in a single block, they all consist of tm_size_t members. */
+    tm_size_t element_size = sizeof(tmu_utf8_chunk) + 2 * sizeof(tm_size_t);
+    tmu_utf8_chunk* chunks = (tmu_utf8_chunk*)TMU_MALLOC(count * element_size, sizeof(tm_size_t));
+    if (!chunks) return 0;
+    tmu_utf8_split_chunks(str, str_len, chunk_size, chunks, count);
+
+    data->str = str;
+    data->chunks = chunks;
+    data->valid = (tm_size_t*)(chunks + count);
+    data->counts = data->valid + count;
+    parallel_for(user_data, count, task, data);
+    return count;
+}
+
+TMU_DEF tm_size_t tmu_utf8_valid_range_parallel(const char* str, tm_size_t str_len, tm_size_t chunk_size,
+                                                tmu_parallel_for_proc* parallel_for, void* user_data) {
+    tmu_parallel_task_data data = {TM_NULL, TM_NULL, TM_NULL, TM_NULL};
+    tm_size_t count =
+        tmu_utf8_run_parallel(str, str_len, chunk_size, parallel_for, user_data, tmu_valid_range_task, &data);
+    if (!count) return tmu_utf8_valid_range(str, str_len);
+
+    /* Chunks start on sequence boundaries, so the first chunk that isn't valid contains the first invalid octet. */
+    tm_size_t result = str_len;
+    for (tm_size_t i = 0; i < count; ++i) {
+        if (data.valid[i] != data.chunks[i].size) {
+            result = data.chunks[i].offset + data.valid[i];
+            break;
+        }
+    }
+    TMU_FREE((void*)data.chunks);
+    return result;
+}
+
+TMU_DEF tm_size_t tmu_utf8_count_codepoints_parallel(const char* str, tm_size_t str_len, tm_size_t chunk_size,
+                                                     tmu_parallel_for_proc* parallel_for, void* user_data) {
+    tmu_parallel_task_data data = {TM_NULL, TM_NULL, TM_NULL, TM_NULL};
+    tm_size_t count =
+        tmu_utf8_run_parallel(str, str_len, chunk_size, parallel_for, user_data, tmu_count_codepoints_task, &data);
+    if (!count) return tmu_utf8_count_codepoints_n(str, str_len);
+
+    tm_size_t result = 0;
+    for (tm_size_t i = 0; i < count; ++i) {
+        const tmu_utf8_chunk* chunk = &data.chunks[i];
+        if (data.valid[i] != chunk->size) {
+            /* Invalid input is rare, count the rest serially to get the same result as the serial version. */
+            result += tmu_utf8_count_codepoints_n(str + chunk->offset, str_len - chunk->offset);
+            break;
+        }
+        result += data.counts[i];
+    }
+    TMU_FREE((void*)data.chunks);
     return result;
 }
 
@@ -1318,6 +2411,76 @@ TMU_DEF tm_bool tmu_is_separator(uint32_t codepoint) {
     return tmu_ucd_get_category(codepoint) == tmu_ucd_category_separator;
 }
 TMU_DEF tm_bool tmu_is_whitespace(uint32_t codepoint) { return tmu_ucd_is_whitespace(codepoint) == 1; }
+
+/* Bitmaps of the ascii codepoints belonging to each bit of the tmu_category_* masks, indexed by bit. */
+static const uint64_t tmu_ascii_category_bitmaps[8][2] = {
+    {0x00000000FFFFFFFFull, 0x8000000000000000ull}, /* control */
+    {0x0000000000000000ull, 0x07FFFFFE07FFFFFEull}, /* letter */
+    {0x0000000000000000ull, 0x0000000000000000ull}, /* mark */
+    {0x03FF000000000000ull, 0x0000000000000000ull}, /* number */
+    {0x8C00F7EE00000000ull, 0x28000000B8000001ull}, /* punctuation */
+    {0x7000081000000000ull, 0x5000000140000000ull}, /* symbol */
+    {0x0000000100000000ull, 0x0000000000000000ull}, /* separator */
+    {0x0000000100001000ull, 0x0000000000000000ull}, /* whitespace */
+};
+
+static tm_bool tmu_category_matches(uint32_t codepoint, uint32_t mask) {
+    if (mask & (1u << (uint32_t)tmu_ucd_get_category(codepoint))) return TM_TRUE;
+    return (mask & tmu_category_whitespace) && tmu_ucd_is_whitespace(codepoint);
+}
+
+static tm_size_t tmu_utf8_span_category_internal(tmu_utf8_stream stream, uint32_t mask, tm_bool negate) {
+    TM_ASSERT(stream.cur <= stream.end);
+
+    uint64_t bitmap[2] = {0, 0};
+    for (uint32_t i = 0; i < 8; ++i) {
+        if (mask & (1u << i)) {
+            bitmap[0] |= tmu_ascii_category_bitmaps[i][0];
+            bitmap[1] |= tmu_ascii_category_bitmaps[i][1];
+        }
+    }
+    if (negate) {
+        bitmap[0] = ~bitmap[0];
+        bitmap[1] = ~bitmap[1];
+    }
+
+    const char* start = stream.cur;
+    while (stream.cur != stream.end) {
+        if (stream.end - stream.cur >= 16) {
+            /* Check 16 octets at once, if they are all ascii they can be classified using only the bitmap. */
+            uint64_t high_bits = (tmu_ascii_load(stream.cur) | tmu_ascii_load(stream.cur + 8)) & TMU_ASCII_HIGH_BITS;
+            if (!high_bits) {
+                for (int i = 0; i < 16; ++i) {
+                    uint32_t c = TMU_WIDEN(stream.cur[i]);
+                    if (!((bitmap[c >> 6] >> (c & 63u)) & 1u)) return (tm_size_t)(stream.cur + i - start);
+                }
+                stream.cur += 16;
+                continue;
+            }
+        }
+
+        uint32_t c = TMU_WIDEN(*stream.cur);
+        if (c < 0x80u) {
+            if (!((bitmap[c >> 6] >> (c & 63u)) & 1u)) break;
+            ++stream.cur;
+            continue;
+        }
+
+        tmu_utf8_stream next = stream;
+        uint32_t codepoint = TMU_INVALID_CODEPOINT;
+        if (!tmu_utf8_extract(&next, &codepoint)) break;
+        if (tmu_category_matches(codepoint, mask) == negate) break;
+        stream.cur = next.cur;
+    }
+    return (tm_size_t)(stream.cur - start);
+}
+
+TMU_DEF tm_size_t tmu_utf8_span_category(tmu_utf8_stream stream, uint32_t mask) {
+    return tmu_utf8_span_category_internal(stream, mask, /*negate=*/TM_FALSE);
+}
+TMU_DEF tm_size_t tmu_utf8_span_not_category(tmu_utf8_stream stream, uint32_t mask) {
+    return tmu_utf8_span_category_internal(stream, mask, /*negate=*/TM_TRUE);
+}
 #endif /* TMU_UCD_HAS_CATEGORY */
 
 #if TMU_UCD_HAS_CASE_INFO
@@ -1329,6 +2492,43 @@ TMU_DEF tm_bool tmu_is_caseless(uint32_t codepoint) {
 }
 #endif /* TMU_UCD_HAS_CATEGORY */
 
+#if TMU_UCD_HAS_GRAPHEME_BREAK
+/* Grapheme break classes between which there is always a boundary, regardless of the preceding codepoints. */
+static tm_bool tmu_grapheme_break_is_isolated(tmu_ucd_grapheme_break_enum gb) {
+    return gb == tmu_grapheme_break_other || gb == tmu_grapheme_break_control || gb == tmu_grapheme_break_cr ||
+           gb == tmu_grapheme_break_lf || gb == tmu_grapheme_break_extended_pictographic;
+}
+
+static tm_size_t tmu_utf8_grapheme_chunk_end(const char* str, tm_size_t str_len, tm_size_t begin, tm_size_t end) {
+    tm_size_t fallback = tmu_utf8_codepoint_chunk_end(str, str_len, begin, end);
+    tm_size_t cur = fallback;
+    for (int i = 0; i < 32 && cur > begin + 1; ++i) {
+        tm_size_t prev = tmu_utf8_codepoint_chunk_end(str, str_len, begin, cur - 1);
+
+        uint32_t next_codepoint = TMU_INVALID_CODEPOINT;
+        uint32_t prev_codepoint = TMU_INVALID_CODEPOINT;
+        tmu_utf8_stream next_stream = tmu_utf8_make_stream_n(str + cur, str_len - cur);
+        tmu_utf8_stream prev_stream = tmu_utf8_make_stream_n(str + prev, cur - prev);
+        if (tmu_utf8_extract(&next_stream, &next_codepoint) && tmu_utf8_extract(&prev_stream, &prev_codepoint)) {
+            tmu_ucd_grapheme_break_enum next = tmu_ucd_get_entry(next_codepoint).grapheme_break;
+            tmu_ucd_grapheme_break_enum prev_gb = tmu_ucd_get_entry(prev_codepoint).grapheme_break;
+            /* GB3: CR x LF, every other pair of these classes is a boundary (GB4, GB5, GB999). */
+            if (tmu_grapheme_break_is_isolated(prev_gb) && tmu_grapheme_break_is_isolated(next) &&
+                !(prev_gb == tmu_grapheme_break_cr && next == tmu_grapheme_break_lf)) {
+                return cur;
+            }
+        }
+        cur = prev;
+    }
+    return fallback;
+}
+
+TMU_DEF tm_size_t tmu_utf8_split_chunks_graphemes(const char* str, tm_size_t str_len, tm_size_t chunk_size,
+                                                  tmu_utf8_chunk* out, tm_size_t out_len) {
+    return tmu_utf8_split_chunks_internal(str, str_len, chunk_size, tmu_utf8_grapheme_chunk_end, out, out_len);
+}
+#endif /* TMU_UCD_HAS_GRAPHEME_BREAK */
+
 #if TMU_UCD_HAS_WIDTH
 TMU_DEF int tmu_utf8_width(tmu_utf8_stream stream) {
     TM_ASSERT(stream.cur <= stream.end);
@@ -1350,6 +2550,226 @@ TMU_DEF int tmu_utf8_width_n(const char* str, tm_size_t str_len) {
 }
 #endif
 
+#if TMU_UCD_HAS_WORD_BREAK
+/* Rules are numbered as in UAX #29, "x" means no break and "|" means break. */
+static tm_bool tmu_word_break_is_ignorable(tmu_ucd_word_break_enum wb) {
+    return wb == tmu_word_break_extend || wb == tmu_word_break_format || wb == tmu_word_break_zwj;
+}
+static tm_bool tmu_word_break_is_newline(tmu_ucd_word_break_enum wb) {
+    return wb == tmu_word_break_cr || wb == tmu_word_break_lf || wb == tmu_word_break_newline;
+}
+static tm_bool tmu_word_break_is_ahletter(tmu_ucd_word_break_enum wb) {
+    return wb == tmu_word_break_aletter || wb == tmu_word_break_hebrew_letter;
+}
+static tm_bool tmu_word_break_is_midnumletq(tmu_ucd_word_break_enum wb) {
+    return wb == tmu_word_break_midnumlet || wb == tmu_word_break_single_quote;
+}
+
+/* Returns the next word break property skipping Extend, Format and ZWJ (rule WB4).
+   Returns tmu_word_break_count if there is no next codepoint. */
+static tmu_ucd_word_break_enum tmu_word_break_peek(tmu_utf8_stream stream) {
+    uint32_t codepoint = TMU_INVALID_CODEPOINT;
+    while (tmu_utf8_extract(&stream, &codepoint)) {
+        tmu_ucd_word_break_enum wb = tmu_ucd_get_word_break(codepoint);
+        if (!tmu_word_break_is_ignorable(wb)) return wb;
+    }
+    return tmu_word_break_count;
+}
+
+TMU_DEF const char* tmu_utf8_next_word_break(tmu_utf8_stream stream) {
+    TM_ASSERT(stream.cur <= stream.end);
+
+    uint32_t codepoint = TMU_INVALID_CODEPOINT;
+    if (stream.cur == stream.end) return stream.end;
+    if (!tmu_utf8_extract(&stream, &codepoint)) return stream.cur + 1;
+
+    /* raw is the property of the previous codepoint, last and before_last are the properties of the previous
+       codepoints with Extend, Format and ZWJ skipped. */
+    tmu_ucd_word_break_enum raw = tmu_ucd_get_word_break(codepoint);
+    tmu_ucd_word_break_enum last = raw;
+    tmu_ucd_word_break_enum before_last = tmu_word_break_count;
+    tm_size_t regional_indicators = (raw == tmu_word_break_regional_indicator);
+
+    for (;;) {
+        const char* boundary = stream.cur;
+        if (!tmu_utf8_extract(&stream, &codepoint)) return boundary;
+        tmu_ucd_word_break_enum cur = tmu_ucd_get_word_break(codepoint);
+
+        if (raw == tmu_word_break_cr && cur == tmu_word_break_lf) {
+            /* WB3: CR x LF */
+        } else if (tmu_word_break_is_newline(raw) || tmu_word_break_is_newline(cur)) {
+            /* WB3a, WB3b: Break before and after newlines. */
+            return boundary;
+        } else if (raw == tmu_word_break_zwj && cur == tmu_word_break_extended_pictographic) {
+            /* WB3c: ZWJ x \p{Extended_Pictographic} */
+        } else if (raw == tmu_word_break_wsegspace && cur == tmu_word_break_wsegspace) {
+            /* WB3d: WSegSpace x WSegSpace */
+        } else if (tmu_word_break_is_ignorable(cur)) {
+            /* WB4: X (Extend | Format | ZWJ)* -> X */
+            raw = cur;
+            continue;
+        } else {
+            tm_bool no_break = TM_FALSE;
+            if (tmu_word_break_is_ahletter(last)) {
+                /* WB5, WB9 */
+                no_break = tmu_word_break_is_ahletter(cur) || cur == tmu_word_break_numeric;
+                /* WB6: AHLetter x (MidLetter | MidNumLetQ) AHLetter */
+                if (!no_break && (cur == tmu_word_break_midletter || tmu_word_break_is_midnumletq(cur))) {
+                    no_break = tmu_word_break_is_ahletter(tmu_word_break_peek(stream));
+                }
+                if (!no_break && last == tmu_word_break_hebrew_letter) {
+                    /* WB7a: Hebrew_Letter x Single_Quote */
+                    no_break = (cur == tmu_word_break_single_quote);
+                    /* WB7b: Hebrew_Letter x Double_Quote Hebrew_Letter */
+                    if (cur == tmu_word_break_double_quote) {
+                        no_break = (tmu_word_break_peek(stream) == tmu_word_break_hebrew_letter);
+                    }
+                }
+            } else if (last == tmu_word_break_numeric) {
+                /* WB8, WB10 */
+                no_break = cur == tmu_word_break_numeric || tmu_word_break_is_ahletter(cur);
+                /* WB12: Numeric x (MidNum | MidNumLetQ) Numeric */
+                if (!no_break && (cur == tmu_word_break_midnum || tmu_word_break_is_midnumletq(cur))) {
+                    no_break = (tmu_word_break_peek(stream) == tmu_word_break_numeric);
+                }
+            } else if (last == tmu_word_break_midletter || tmu_word_break_is_midnumletq(last)) {
+                /* WB7: AHLetter (MidLetter | MidNumLetQ) x AHLetter */
+                no_break = tmu_word_break_is_ahletter(before_last) && tmu_word_break_is_ahletter(cur);
+                /* WB11: Numeric (MidNum | MidNumLetQ) x Numeric */
+                if (!no_break && last != tmu_word_break_midletter) {
+                    no_break = before_last == tmu_word_break_numeric && cur == tmu_word_break_numeric;
+                }
+            } else if (last == tmu_word_break_midnum) {
+                /* WB11 */
+                no_break = before_last == tmu_word_break_numeric && cur == tmu_word_break_numeric;
+            } else if (last == tmu_word_break_double_quote) {
+                /* WB7c: Hebrew_Letter Double_Quote x Hebrew_Letter */
+                no_break = before_last == tmu_word_break_hebrew_letter && cur == tmu_word_break_hebrew_letter;
+            } else if (last == tmu_word_break_katakana) {
+                /* WB13 */
+                no_break = (cur == tmu_word_break_katakana);
+            } else if (last == tmu_word_break_extendnumlet) {
+                /* WB13b */
+                no_break = tmu_word_break_is_ahletter(cur) || cur == tmu_word_break_numeric ||
+                           cur == tmu_word_break_katakana;
+            } else if (last == tmu_word_break_regional_indicator) {
+                /* WB15, WB16: Do not break within pairs of regional indicators. */
+                no_break = (cur == tmu_word_break_regional_indicator) && (regional_indicators % 2) == 1;
+            }
+
+            /* WB13a: (AHLetter | Numeric | Katakana | ExtendNumLet) x ExtendNumLet */
+            if (!no_break && cur == tmu_word_break_extendnumlet) {
+                no_break = tmu_word_break_is_ahletter(last) || last == tmu_word_break_numeric ||
+                           last == tmu_word_break_katakana || last == tmu_word_break_extendnumlet;
+            }
+
+            /* WB999: Any | Any */
+            if (!no_break) return boundary;
+        }
+
+        regional_indicators = (cur == tmu_word_break_regional_indicator) ? (regional_indicators + 1) : 0;
+        before_last = last;
+        last = cur;
+        raw = cur;
+    }
+}
+#endif /* TMU_UCD_HAS_WORD_BREAK */
+
+#if TMU_UCD_HAS_SENTENCE_BREAK
+static tm_bool tmu_sentence_break_is_ignorable(tmu_ucd_sentence_break_enum sb) {
+    return sb == tmu_sentence_break_extend || sb == tmu_sentence_break_format;
+}
+static tm_bool tmu_sentence_break_is_para_sep(tmu_ucd_sentence_break_enum sb) {
+    return sb == tmu_sentence_break_sep || sb == tmu_sentence_break_cr || sb == tmu_sentence_break_lf;
+}
+static tm_bool tmu_sentence_break_is_saterm(tmu_ucd_sentence_break_enum sb) {
+    return sb == tmu_sentence_break_sterm || sb == tmu_sentence_break_aterm;
+}
+
+/* SB8: ATerm Close* Sp* x ( !(OLetter | Upper | Lower | ParaSep | SATerm) )* Lower
+   Scans forward starting with current, skipping Extend and Format (rule SB5). */
+static tm_bool tmu_sentence_break_lower_follows(tmu_ucd_sentence_break_enum current, tmu_utf8_stream stream) {
+    uint32_t codepoint = TMU_INVALID_CODEPOINT;
+    for (;;) {
+        if (current == tmu_sentence_break_lower) return TM_TRUE;
+        if (current == tmu_sentence_break_oletter || current == tmu_sentence_break_upper ||
+            tmu_sentence_break_is_para_sep(current) || tmu_sentence_break_is_saterm(current)) {
+            return TM_FALSE;
+        }
+        do {
+            if (!tmu_utf8_extract(&stream, &codepoint)) return TM_FALSE;
+            current = tmu_ucd_get_sentence_break(codepoint);
+        } while (tmu_sentence_break_is_ignorable(current));
+    }
+}
+
+TMU_DEF const char* tmu_utf8_next_sentence_break(tmu_utf8_stream stream) {
+    TM_ASSERT(stream.cur <= stream.end);
+
+    /* States after a sentence terminator, needed for rules SB8 to SB11. */
+    enum { after_none, after_saterm_close, after_saterm_close_sp };
+
+    uint32_t codepoint = TMU_INVALID_CODEPOINT;
+    if (stream.cur == stream.end) return stream.end;
+    if (!tmu_utf8_extract(&stream, &codepoint)) return stream.cur + 1;
+
+    /* raw is the property of the previous codepoint, last and before_last are the properties of the previous
+       codepoints with Extend and Format skipped. */
+    tmu_ucd_sentence_break_enum raw = tmu_ucd_get_sentence_break(codepoint);
+    tmu_ucd_sentence_break_enum last = raw;
+    tmu_ucd_sentence_break_enum before_last = tmu_sentence_break_count;
+    int state = tmu_sentence_break_is_saterm(raw) ? after_saterm_close : after_none;
+    tm_bool is_aterm = (raw == tmu_sentence_break_aterm);
+
+    for (;;) {
+        const char* boundary = stream.cur;
+        if (!tmu_utf8_extract(&stream, &codepoint)) return boundary;
+        tmu_ucd_sentence_break_enum cur = tmu_ucd_get_sentence_break(codepoint);
+
+        if (raw == tmu_sentence_break_cr && cur == tmu_sentence_break_lf) {
+            /* SB3: CR x LF */
+        } else if (tmu_sentence_break_is_para_sep(raw)) {
+            /* SB4: ParaSep | */
+            return boundary;
+        } else if (tmu_sentence_break_is_ignorable(cur)) {
+            /* SB5: X (Extend | Format)* -> X */
+            raw = cur;
+            continue;
+        } else if (last == tmu_sentence_break_aterm && cur == tmu_sentence_break_numeric) {
+            /* SB6: ATerm x Numeric */
+        } else if (last == tmu_sentence_break_aterm && cur == tmu_sentence_break_upper &&
+                   (before_last == tmu_sentence_break_upper || before_last == tmu_sentence_break_lower)) {
+            /* SB7: (Upper | Lower) ATerm x Upper */
+        } else if (state != after_none) {
+            tm_bool no_break = is_aterm && tmu_sentence_break_lower_follows(cur, stream); /* SB8 */
+            /* SB8a: SATerm Close* Sp* x (SContinue | SATerm) */
+            no_break = no_break || cur == tmu_sentence_break_scontinue || tmu_sentence_break_is_saterm(cur);
+            /* SB9: SATerm Close* x (Close | Sp | ParaSep) */
+            no_break = no_break || (state == after_saterm_close && cur == tmu_sentence_break_close);
+            /* SB10: SATerm Close* Sp* x (Sp | ParaSep) */
+            no_break = no_break || cur == tmu_sentence_break_sp || tmu_sentence_break_is_para_sep(cur);
+            /* SB11: SATerm Close* Sp* ParaSep? | */
+            if (!no_break) return boundary;
+        }
+        /* SB998: Any x Any */
+
+        if (tmu_sentence_break_is_saterm(cur)) {
+            state = after_saterm_close;
+            is_aterm = (cur == tmu_sentence_break_aterm);
+        } else if (cur == tmu_sentence_break_close && state == after_saterm_close) {
+            state = after_saterm_close;
+        } else if (cur == tmu_sentence_break_sp && state != after_none) {
+            state = after_saterm_close_sp;
+        } else {
+            state = after_none;
+        }
+        before_last = last;
+        last = cur;
+        raw = cur;
+    }
+}
+#endif /* TMU_UCD_HAS_SENTENCE_BREAK */
+
 typedef struct {
     char* data;
     tm_size_t size;
@@ -1372,6 +2792,143 @@ static void tmu_transform_output_append_codepoint(uint32_t codepoint, tmu_transf
     }
 }
 
+#if TMU_UCD_HAS_SIMPLE_CASE || TMU_UCD_HAS_SIMPLE_CASE_FOLD || TMU_UCD_HAS_FULL_CASE || TMU_UCD_HAS_FULL_CASE_FOLD
+/*
+ASCII fast paths.
+Lowercasing and case folding map exactly 'A'-'Z' to 'a'-'z' in the ASCII range, both for the simple and full variants.
+Runs of ASCII are therefore transformed and compared 8 bytes at a time without decoding or looking up the UCD.
+*/
+static void tmu_ascii_store(uint64_t value, char* out) {
+    for (int i = 0; i < 8; ++i) {
+        out[i] = (char)(uint8_t)(value >> (i * 8));
+    }
+}
+
+/* All bytes of value must be ASCII, so that no addition can carry into the next byte. */
+static uint64_t tmu_ascii_to_lower(uint64_t value) {
+    uint64_t at_least_a = value + TMU_ASCII_ONES * (0x80 - 'A');
+    uint64_t above_z = value + TMU_ASCII_ONES * (0x7F - 'Z');
+    uint64_t is_upper = (at_least_a ^ above_z) & TMU_ASCII_HIGH_BITS;
+    return value | (is_upper >> 2);
+}
+
+static char tmu_ascii_char_to_lower(char c) { return (c >= 'A' && c <= 'Z') ? (char)(c + ('a' - 'A')) : c; }
+
+static tm_size_t tmu_ascii_run_length(const char* cur, const char* end) {
+    const char* first = cur;
+    while (end - cur >= 8 && !(tmu_ascii_load(cur) & TMU_ASCII_HIGH_BITS)) cur += 8;
+    while (cur != end && (uint8_t)*cur < 0x80) ++cur;
+    return (tm_size_t)(cur - first);
+}
+
+/* Consumes the ASCII run at the start of stream and appends it lowercased to out. */
+static void tmu_transform_output_append_ascii_lower(tmu_utf8_stream* stream, tmu_transform_output_stream* out) {
+    const char* cur = stream->cur;
+    const char* end = stream->end;
+    char* data = out->data + out->size;
+    tm_size_t remaining = out->capacity - out->size;
+
+    while (end - cur >= 8 && remaining >= 8) {
+        uint64_t value = tmu_ascii_load(cur);
+        if (value & TMU_ASCII_HIGH_BITS) break;
+        tmu_ascii_store(tmu_ascii_to_lower(value), data);
+        cur += 8;
+        data += 8;
+        remaining -= 8;
+    }
+    while (cur != end && (uint8_t)*cur < 0x80 && remaining > 0) {
+        *data++ = tmu_ascii_char_to_lower(*cur++);
+        --remaining;
+    }
+
+    tm_size_t written = (tm_size_t)(cur - stream->cur);
+    out->size += written;
+    out->result.size += written;
+
+    tm_size_t rest = tmu_ascii_run_length(cur, end);
+    if (rest > 0) {
+        /* Output is full, only count the required size from here on. */
+        out->result.size += rest;
+        out->result.ec = TM_ERANGE;
+        out->data = TM_NULL;
+        out->size = 0;
+        out->capacity = 0;
+        cur += rest;
+    }
+    stream->cur = cur;
+}
+
+/* Skips the common prefix of both streams that is ASCII and equal ignoring case. */
+static void tmu_utf8_skip_ascii_equal_ignore_case(tmu_utf8_stream* a, tmu_utf8_stream* b) {
+    const char* a_cur = a->cur;
+    const char* b_cur = b->cur;
+    const char* a_end = a->end;
+    const char* b_end = b->end;
+
+    while (a_end - a_cur >= 8 && b_end - b_cur >= 8) {
+        uint64_t a_value = tmu_ascii_load(a_cur);
+        uint64_t b_value = tmu_ascii_load(b_cur);
+        if ((a_value | b_value) & TMU_ASCII_HIGH_BITS) break;
+        if (tmu_ascii_to_lower(a_value) != tmu_ascii_to_lower(b_value)) break;
+        a_cur += 8;
+        b_cur += 8;
+    }
+    while (a_cur != a_end && b_cur != b_end && (uint8_t)*a_cur < 0x80 && (uint8_t)*b_cur < 0x80 &&
+           tmu_ascii_char_to_lower(*a_cur) == tmu_ascii_char_to_lower(*b_cur)) {
+        ++a_cur;
+        ++b_cur;
+    }
+    a->cur = a_cur;
+    b->cur = b_cur;
+}
+
+#endif
+
+#if TMU_UCD_HAS_SIMPLE_CASE_FOLD || TMU_UCD_HAS_FULL_CASE_FOLD
+/*
+Numbers in human comparisons saturate at TMU_HUMAN_NUMBER_MAX instead of wrapping around, so that long digit runs
+still order after shorter ones and value + TMU_MAX_UTF32 still fits into an int.
+*/
+#define TMU_HUMAN_NUMBER_MAX (0x7FFFFFFFu - TMU_MAX_UTF32)
+static uint32_t tmu_human_number_append_digit(uint32_t value, uint32_t digit) {
+    TM_ASSERT(digit <= 9);
+    if (value > (TMU_HUMAN_NUMBER_MAX - digit) / 10) return TMU_HUMAN_NUMBER_MAX;
+    return (value * 10) + digit;
+}
+
+/*
+Appends a value returned by tmu_utf8_extract_human(_simple) to a sort key.
+Codepoints are appended as UTF-8, since bytewise order of UTF-8 is the same as codepoint order.
+Numbers are appended as 0xF8 followed by the value in big endian. 0xF8 never appears in UTF-8, so numbers order
+after all codepoints, just like in tmu_utf8_human_compare.
+*/
+static void tmu_sort_key_append(uint32_t value, tmu_transform_output_stream* out) {
+    if (value < TMU_MAX_UTF32 && tmu_is_valid_codepoint(value)) {
+        tmu_transform_output_append_codepoint(value, out);
+        return;
+    }
+
+    value -= TMU_MAX_UTF32;
+    tm_size_t out_size = out->size;
+    tm_size_t remaining = out->capacity - out_size;
+    out->result.size += 5;
+    if (remaining < 5) {
+        out->result.ec = TM_ERANGE;
+        out->data = TM_NULL;
+        out->size = 0;
+        out->capacity = 0;
+    } else {
+        char* p = out->data + out_size;
+        p[0] = (char)0xF8;
+        p[1] = (char)(uint8_t)(value >> 24);
+        p[2] = (char)(uint8_t)(value >> 16);
+        p[3] = (char)(uint8_t)(value >> 8);
+        p[4] = (char)(uint8_t)value;
+        out->size += 5;
+    }
+}
+#endif
+
 #if TMU_UCD_HAS_SIMPLE_CASE
 TMU_DEF tmu_transform_result tmu_utf8_to_upper_simple(const char* str, tm_size_t str_len, char* out,
                                                       tm_size_t out_len) {
@@ -1414,10 +2971,12 @@ TMU_DEF tmu_transform_result tmu_utf8_to_lower_simple(const char* str, tm_size_t
     out_stream.capacity = out_len;
     tmu_utf8_stream stream = tmu_utf8_make_stream_n(str, str_len);
     uint32_t codepoint = TMU_INVALID_CODEPOINT;
+    tmu_transform_output_append_ascii_lower(&stream, &out_stream);
     while (tmu_utf8_extract(&stream, &codepoint)) {
         const tmu_ucd_internal* internal = tmu_get_ucd_internal(codepoint);
         uint32_t transformed = codepoint + internal->simple_lower_offset;
         tmu_transform_output_append_codepoint(transformed, &out_stream);
+        tmu_transform_output_append_ascii_lower(&stream, &out_stream);
     }
     if (out_stream.result.ec == TM_OK && stream.cur != stream.end) {
         out_stream.result.ec = TM_EINVAL;
@@ -1434,10 +2993,12 @@ TMU_DEF tmu_transform_result tmu_utf8_to_case_fold_simple(const char* str, tm_si
     out_stream.capacity = out_len;
     tmu_utf8_stream stream = tmu_utf8_make_stream_n(str, str_len);
     uint32_t codepoint = TMU_INVALID_CODEPOINT;
+    tmu_transform_output_append_ascii_lower(&stream, &out_stream);
     while (tmu_utf8_extract(&stream, &codepoint)) {
         const tmu_ucd_internal* internal = tmu_get_ucd_internal(codepoint);
         uint32_t transformed = codepoint + internal->simple_case_fold_offset;
         tmu_transform_output_append_codepoint(transformed, &out_stream);
+        tmu_transform_output_append_ascii_lower(&stream, &out_stream);
     }
     if (out_stream.result.ec == TM_OK && stream.cur != stream.end) {
         out_stream.result.ec = TM_EINVAL;
@@ -1460,7 +3021,15 @@ TMU_DEF tm_bool tmu_utf8_equals_ignore_case_simple(const char* a, tm_size_t a_le
 
     uint32_t a_cp = TMU_INVALID_CODEPOINT;
     uint32_t b_cp = TMU_INVALID_CODEPOINT;
-    while (tmu_utf8_extract(&a_stream, &a_cp) && tmu_utf8_extract(&b_stream, &b_cp)) {
+    tmu_utf8_skip_ascii_equal_ignore_case(&a_stream, &b_stream);
+    tm_bool a_extracted = TM_FALSE;
+    tm_bool b_extracted = TM_FALSE;
+    for (;;) {
+        /* Extract from both streams unconditionally, so that we can tell whether only one of them ran out. */
+        a_extracted = tmu_utf8_extract(&a_stream, &a_cp);
+        b_extracted = tmu_utf8_extract(&b_stream, &b_cp);
+        if (!a_extracted || !b_extracted) break;
+
         const tmu_ucd_internal* a_internal = tmu_get_ucd_internal(a_cp);
         const tmu_ucd_internal* b_internal = tmu_get_ucd_internal(b_cp);
 
@@ -1468,8 +3037,9 @@ TMU_DEF tm_bool tmu_utf8_equals_ignore_case_simple(const char* a, tm_size_t a_le
         uint32_t b_case_folded = b_cp + b_internal->simple_case_fold_offset;
 
         if (a_case_folded != b_case_folded) return TM_FALSE;
+        tmu_utf8_skip_ascii_equal_ignore_case(&a_stream, &b_stream);
     }
-    return (a_stream.cur == a_stream.end) && (b_stream.cur == b_stream.end);
+    return !a_extracted && !b_extracted && (a_stream.cur == a_stream.end) && (b_stream.cur == b_stream.end);
 }
 
 TMU_DEF int tmu_utf8_compare_ignore_case_simple(const char* a, tm_size_t a_len, const char* b, tm_size_t b_len) {
@@ -1488,7 +3058,14 @@ TMU_DEF int tmu_utf8_compare_ignore_case_simple(const char* a, tm_size_t a_len,
 
     uint32_t a_cp = TMU_INVALID_CODEPOINT;
     uint32_t b_cp = TMU_INVALID_CODEPOINT;
-    while (tmu_utf8_extract(&a_stream, &a_cp) && tmu_utf8_extract(&b_stream, &b_cp)) {
+    tmu_utf8_skip_ascii_equal_ignore_case(&a_stream, &b_stream);
+    tm_bool a_extracted = TM_FALSE;
+    tm_bool b_extracted = TM_FALSE;
+    for (;;) {
+        a_extracted = tmu_utf8_extract(&a_stream, &a_cp);
+        b_extracted = tmu_utf8_extract(&b_stream, &b_cp);
+        if (!a_extracted || !b_extracted) break;
+
         const tmu_ucd_internal* a_internal = tmu_get_ucd_internal(a_cp);
         const tmu_ucd_internal* b_internal = tmu_get_ucd_internal(b_cp);
 
@@ -1497,10 +3074,11 @@ TMU_DEF int tmu_utf8_compare_ignore_case_simple(const char* a, tm_size_t a_len,
 
         int diff = (int)a_case_folded - (int)b_case_folded;
         if (diff != 0) return (diff < 0) ? -1 : 1;
+        tmu_utf8_skip_ascii_equal_ignore_case(&a_stream, &b_stream);
     }
 
-    tm_bool a_is_empty = (a_stream.cur == a_stream.end);
-    tm_bool b_is_empty = (b_stream.cur == b_stream.end);
+    tm_bool a_is_empty = !a_extracted && (a_stream.cur == a_stream.end);
+    tm_bool b_is_empty = !b_extracted && (b_stream.cur == b_stream.end);
     return b_is_empty - a_is_empty;
 }
 
@@ -1523,7 +3101,7 @@ static tm_bool tmu_utf8_extract_human_simple(tmu_utf8_stream* stream, uint32_t*
     /* We can treat the utf8 stream as an ascii stream and go byte by byte, since we are comparing ascii values. */
     uint32_t value = 0;
     while (cur != end && *cur >= '0' && *cur <= '9') {
-        value = (value * 10) + (*cur - '0');
+        value = tmu_human_number_append_digit(value, (uint32_t)(*cur - '0'));
         ++cur;
     }
     stream->cur = cur;
@@ -1550,15 +3128,37 @@ TMU_DEF int tmu_utf8_human_compare_simple(const char* a, tm_size_t a_len, const
 
     uint32_t a_cp = TMU_INVALID_CODEPOINT;
     uint32_t b_cp = TMU_INVALID_CODEPOINT;
-    while (tmu_utf8_extract_human_simple(&a_stream, &a_cp) && tmu_utf8_extract_human_simple(&b_stream, &b_cp)) {
+    tm_bool a_extracted = TM_FALSE;
+    tm_bool b_extracted = TM_FALSE;
+    for (;;) {
+        a_extracted = tmu_utf8_extract_human_simple(&a_stream, &a_cp);
+        b_extracted = tmu_utf8_extract_human_simple(&b_stream, &b_cp);
+        if (!a_extracted || !b_extracted) break;
+
         int diff = (int)a_cp - (int)b_cp;
         if (diff != 0) return (diff < 0) ? -1 : 1;
     }
 
-    tm_bool a_is_empty = (a_stream.cur == a_stream.end);
-    tm_bool b_is_empty = (b_stream.cur == b_stream.end);
+    tm_bool a_is_empty = !a_extracted && (a_stream.cur == a_stream.end);
+    tm_bool b_is_empty = !b_extracted && (b_stream.cur == b_stream.end);
     return b_is_empty - a_is_empty;
 }
+
+TMU_DEF tmu_transform_result tmu_utf8_make_sort_key_simple(const char* str, tm_size_t str_len, char* out,
+                                                           tm_size_t out_len) {
+    tmu_transform_output_stream out_stream = {TM_NULL, 0, 0, {0, TM_OK}};
+    out_stream.data = out;
+    out_stream.capacity = out_len;
+    tmu_utf8_stream stream = tmu_utf8_make_stream_n(str, str_len);
+    uint32_t value = TMU_INVALID_CODEPOINT;
+    while (tmu_utf8_extract_human_simple(&stream, &value)) {
+        tmu_sort_key_append(value, &out_stream);
+    }
+    if (out_stream.result.ec == TM_OK && stream.cur != stream.end) {
+        out_stream.result.ec = TM_EINVAL;
+    }
+    return out_stream.result;
+}
 #endif /* TMU_UCD_HAS_SIMPLE_CASE_FOLD */
 
 #if TMU_UCD_HAS_SIMPLE_CASE_TOGGLE
@@ -1636,6 +3236,7 @@ TMU_DEF tmu_transform_result tmu_utf8_to_lower(const char* str, tm_size_t str_le
     out_stream.capacity = out_len;
     tmu_utf8_stream stream = tmu_utf8_make_stream_n(str, str_len);
     uint32_t codepoint = TMU_INVALID_CODEPOINT;
+    tmu_transform_output_append_ascii_lower(&stream, &out_stream);
     while (tmu_utf8_extract(&stream, &codepoint)) {
         const tmu_ucd_internal* internal = tmu_get_ucd_internal(codepoint);
         if (internal->full_lower_index) {
@@ -1648,6 +3249,7 @@ TMU_DEF tmu_transform_result tmu_utf8_to_lower(const char* str, tm_size_t str_le
             uint32_t transformed = codepoint + internal->simple_lower_offset;
             tmu_transform_output_append_codepoint(transformed, &out_stream);
         }
+        tmu_transform_output_append_ascii_lower(&stream, &out_stream);
     }
     if (out_stream.result.ec == TM_OK && stream.cur != stream.end) {
         out_stream.result.ec = TM_EINVAL;
@@ -1690,6 +3292,7 @@ TMU_DEF tmu_transform_result tmu_utf8_to_case_fold(const char* str, tm_size_t st
     out_stream.capacity = out_len;
     tmu_utf8_stream stream = tmu_utf8_make_stream_n(str, str_len);
     uint32_t codepoint = TMU_INVALID_CODEPOINT;
+    tmu_transform_output_append_ascii_lower(&stream, &out_stream);
     while (tmu_utf8_extract(&stream, &codepoint)) {
         const tmu_ucd_internal* internal = tmu_get_ucd_internal(codepoint);
         if (internal->full_case_fold_index) {
@@ -1702,6 +3305,7 @@ TMU_DEF tmu_transform_result tmu_utf8_to_case_fold(const char* str, tm_size_t st
             uint32_t transformed = codepoint + internal->simple_case_fold_offset;
             tmu_transform_output_append_codepoint(transformed, &out_stream);
         }
+        tmu_transform_output_append_ascii_lower(&stream, &out_stream);
     }
     if (out_stream.result.ec == TM_OK && stream.cur != stream.end) {
         out_stream.result.ec = TM_EINVAL;
@@ -1728,6 +3332,10 @@ static tm_bool tmu_utf8_extract_case_folded(tmu_utf8_case_fold_stream* stream, u
     }
     uint32_t base_codepoint = TMU_INVALID_CODEPOINT;
     if (!tmu_utf8_extract(&stream->base, &base_codepoint)) return TM_FALSE;
+    if (base_codepoint < 0x80) {
+        *codepoint = (uint32_t)(uint8_t)tmu_ascii_char_to_lower((char)base_codepoint);
+        return TM_TRUE;
+    }
     const tmu_ucd_internal* internal = tmu_get_ucd_internal(base_codepoint);
     if (internal->full_case_fold_index) {
         stream->full_case_fold = tmu_codepoint_runs + tmu_full_case_fold_offset + internal->full_case_fold_index;
@@ -1760,11 +3368,19 @@ TMU_DEF tm_bool tmu_utf8_equals_ignore_case(const char* a, tm_size_t a_len, cons
 
     uint32_t a_cp = TMU_INVALID_CODEPOINT;
     uint32_t b_cp = TMU_INVALID_CODEPOINT;
-    while (tmu_utf8_extract_case_folded(&a_cf, &a_cp) && tmu_utf8_extract_case_folded(&b_cf, &b_cp)) {
+    tmu_utf8_skip_ascii_equal_ignore_case(&a_cf.base, &b_cf.base);
+    tm_bool a_extracted = TM_FALSE;
+    tm_bool b_extracted = TM_FALSE;
+    for (;;) {
+        a_extracted = tmu_utf8_extract_case_folded(&a_cf, &a_cp);
+        b_extracted = tmu_utf8_extract_case_folded(&b_cf, &b_cp);
+        if (!a_extracted || !b_extracted) break;
+
         if (a_cp != b_cp) return TM_FALSE;
+        if (!a_cf.full_case_fold && !b_cf.full_case_fold) tmu_utf8_skip_ascii_equal_ignore_case(&a_cf.base, &b_cf.base);
     }
-    return (a_cf.base.cur == a_cf.base.end) && (!a_cf.full_case_fold) && (b_cf.base.cur == b_cf.base.end) &&
-           (!b_cf.full_case_fold);
+    return !a_extracted && !b_extracted && (a_cf.base.cur == a_cf.base.end) && (!a_cf.full_case_fold) &&
+           (b_cf.base.cur == b_cf.base.end) && (!b_cf.full_case_fold);
 }
 
 TMU_DEF int tmu_utf8_compare_ignore_case(const char* a, tm_size_t a_len, const char* b, tm_size_t b_len) {
@@ -1786,13 +3402,21 @@ TMU_DEF int tmu_utf8_compare_ignore_case(const char* a, tm_size_t a_len, const c
 
     uint32_t a_cp = 0;
     uint32_t b_cp = 0;
-    while (tmu_utf8_extract_case_folded(&a_cf, &a_cp) && tmu_utf8_extract_case_folded(&b_cf, &b_cp)) {
+    tmu_utf8_skip_ascii_equal_ignore_case(&a_cf.base, &b_cf.base);
+    tm_bool a_extracted = TM_FALSE;
+    tm_bool b_extracted = TM_FALSE;
+    for (;;) {
+        a_extracted = tmu_utf8_extract_case_folded(&a_cf, &a_cp);
+        b_extracted = tmu_utf8_extract_case_folded(&b_cf, &b_cp);
+        if (!a_extracted || !b_extracted) break;
+
         int diff = (int)a_cp - (int)b_cp;
         if (diff != 0) return (diff < 0) ? -1 : 1;
+        if (!a_cf.full_case_fold && !b_cf.full_case_fold) tmu_utf8_skip_ascii_equal_ignore_case(&a_cf.base, &b_cf.base);
     }
 
-    tm_bool a_is_empty = (a_cf.base.cur == a_cf.base.end) && (!a_cf.full_case_fold);
-    tm_bool b_is_empty = (b_cf.base.cur == b_cf.base.end) && (!b_cf.full_case_fold);
+    tm_bool a_is_empty = !a_extracted && (a_cf.base.cur == a_cf.base.end) && (!a_cf.full_case_fold);
+    tm_bool b_is_empty = !b_extracted && (b_cf.base.cur == b_cf.base.end) && (!b_cf.full_case_fold);
     return b_is_empty - a_is_empty;
 }
 
@@ -1814,7 +3438,7 @@ static tm_bool tmu_utf8_extract_human(tmu_utf8_case_fold_stream* stream, uint32_
     /* We can treat the utf8 stream as an ascii stream and go byte by byte, since we are comparing ascii values. */
     uint32_t value = 0;
     while (cur != end && *cur >= '0' && *cur <= '9') {
-        value = (value * 10) + (*cur - '0');
+        value = tmu_human_number_append_digit(value, (uint32_t)(*cur - '0'));
         ++cur;
     }
     stream->base.cur = cur;
@@ -1844,15 +3468,37 @@ TMU_DEF int tmu_utf8_human_compare(const char* a, tm_size_t a_len, const char* b
 
     uint32_t a_cp = TMU_INVALID_CODEPOINT;
     uint32_t b_cp = TMU_INVALID_CODEPOINT;
-    while (tmu_utf8_extract_human(&a_cf, &a_cp) && tmu_utf8_extract_human(&b_cf, &b_cp)) {
+    tm_bool a_extracted = TM_FALSE;
+    tm_bool b_extracted = TM_FALSE;
+    for (;;) {
+        a_extracted = tmu_utf8_extract_human(&a_cf, &a_cp);
+        b_extracted = tmu_utf8_extract_human(&b_cf, &b_cp);
+        if (!a_extracted || !b_extracted) break;
+
         int diff = (int)a_cp - (int)b_cp;
         if (diff != 0) return (diff < 0) ? -1 : 1;
     }
 
-    tm_bool a_is_empty = (a_cf.base.cur == a_cf.base.end) && (!a_cf.full_case_fold);
-    tm_bool b_is_empty = (b_cf.base.cur == b_cf.base.end) && (!b_cf.full_case_fold);
+    tm_bool a_is_empty = !a_extracted && (a_cf.base.cur == a_cf.base.end) && (!a_cf.full_case_fold);
+    tm_bool b_is_empty = !b_extracted && (b_cf.base.cur == b_cf.base.end) && (!b_cf.full_case_fold);
     return b_is_empty - a_is_empty;
 }
+
+TMU_DEF tmu_transform_result tmu_utf8_make_sort_key(const char* str, tm_size_t str_len, char* out, tm_size_t out_len) {
+    tmu_transform_output_stream out_stream = {TM_NULL, 0, 0, {0, TM_OK}};
+    out_stream.data = out;
+    out_stream.capacity = out_len;
+    tmu_utf8_case_fold_stream cf = {{TM_NULL, TM_NULL}, TM_NULL};
+    cf.base = tmu_utf8_make_stream_n(str, str_len);
+    uint32_t value = TMU_INVALID_CODEPOINT;
+    while (tmu_utf8_extract_human(&cf, &value)) {
+        tmu_sort_key_append(value, &out_stream);
+    }
+    if (out_stream.result.ec == TM_OK && cf.base.cur != cf.base.end) {
+        out_stream.result.ec = TM_EINVAL;
+    }
+    return out_stream.result;
+}
 #endif /* TMU_UCD_HAS_FULL_CASE_FOLD */
 
 #endif /* defined(TMU_UCD_HAS_CASE_INFO) */
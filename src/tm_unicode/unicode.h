@@ -140,6 +140,28 @@ size.
 TMU_DEF tm_bool tmu_utf8_append(uint32_t codepoint, tmu_utf8_output_stream* stream);
 TMU_DEF tm_bool tmu_utf16_append(uint32_t codepoint, tmu_utf16_output_stream* stream);
 
+/* How many octets at the start of the input are sampled to detect the encoding. */
+#define TMU_DETECT_SAMPLE_SIZE 4096
+
+typedef struct {
+    tmu_encoding encoding;
+    int confidence; /* From 0 to 100. */
+} tmu_encoding_detection;
+
+/*
+Detect the encoding of raw bytes.
+A byte order mark is detected with a confidence of 100. Otherwise the first TMU_DETECT_SAMPLE_SIZE octets are
+sampled: zero octets are counted by position to detect utf16/utf32 text, and utf8 validity is checked.
+Input that can't be identified is reported as utf8 with low confidence.
+When converting with tmu_encoding_unknown, the detected encoding is used if the confidence is at least 50.
+Params:
+    input:     Raw input bytes. Can be NULL iff input_len == 0.
+    input_len: Length of the input in bytes.
+Returns:
+    Returns the detected encoding and a confidence score.
+*/
+TMU_DEF tmu_encoding_detection tmu_detect_encoding(const void* input, tm_size_t input_len);
+
 /*
 Convert raw bytes from an untrusted origin to utf8. This function may take ownership of the buffer pointed to
 in the input argument if it already is in utf8 encoding. In that case input will be zeroed out to denote a move
@@ -189,6 +211,94 @@ TMU_DEF tmu_conversion_result tmu_utf8_convert_from_bytes(const void* input, tm_
                                                           tm_size_t replace_str_len, tm_bool nullterminate, char* out,
                                                           tm_size_t out_len);
 
+/*
+Resumable transcoder from raw bytes to utf8, for input that arrives in chunks (files, sockets etc.).
+Partial sequences and byte order mark detection are carried across chunks in the transcoder, so that the
+output is the same as converting the whole input at once with tmu_utf8_convert_from_bytes.
+Memory usage is independent of the input size, output is written into a caller provided buffer.
+If the encoding has to be detected, the first TMU_DETECT_SAMPLE_SIZE octets of the input are buffered in the
+transcoder before any output is produced.
+Usage:
+    tmu_utf8_transcoder transcoder = tmu_utf8_make_transcoder(tmu_encoding_unknown, tmu_validate_replace,
+                                                              "\xEF\xBF\xBD", 3);
+    while ((chunk_len = read_chunk(chunk, sizeof(chunk))) != 0) {
+        const char* cur = chunk;
+        while (chunk_len) {
+            tmu_transcode_result r = tmu_utf8_transcode(&transcoder, cur, chunk_len, out, sizeof(out));
+            if (r.ec != TM_OK) return r.ec;
+            write_output(out, r.size);
+            cur += r.consumed;
+            chunk_len -= r.consumed;
+        }
+    }
+    for (;;) {
+        tmu_transcode_result r = tmu_utf8_transcode_finish(&transcoder, out, sizeof(out));
+        write_output(out, r.size);
+        if (r.ec != TM_ERANGE || r.size == 0) break;
+    }
+*/
+typedef struct {
+    tmu_encoding encoding;          /* Encoding of the input, resolved once the byte order mark was inspected. */
+    tmu_encoding original_encoding; /* Encoding of the input including whether it had a byte order mark. */
+    tmu_validate validate;
+    const char* replace_str;
+    tm_size_t replace_str_len;
+    char window[TMU_DETECT_SAMPLE_SIZE]; /* Start of the input, buffered until the encoding is resolved. */
+    tm_size_t window_size;
+    tm_size_t window_pos; /* How many octets of the window were converted already. */
+    char pending[4];      /* Input octets of an incomplete sequence, carried to the next chunk. */
+    tm_size_t pending_size;
+    tm_bool bom_checked;
+    tm_bool invalid_codepoints_encountered;
+} tmu_utf8_transcoder;
+
+typedef struct {
+    tm_size_t consumed; /* How many octets of the input were consumed, either converted or buffered. */
+    tm_size_t size;     /* How many octets were written to out. */
+    tm_errc ec;
+} tmu_transcode_result;
+
+/*
+Create a transcoder.
+Params:
+    encoding:        The encoding of the input. If the encoding is unknown and should be detected,
+                     pass tmu_encoding_unknown. Without a byte order mark, the encoding is then guessed from the
+                     first TMU_DETECT_SAMPLE_SIZE octets of the input, see tmu_detect_encoding.
+    validate:        How to handle invalid codepoints.
+    replace_str:     String to replace invalid codepoints with. Only used if validate == tmu_validate_replace.
+    replace_str_len: Length of replace_str.
+*/
+TMU_DEF tmu_utf8_transcoder tmu_utf8_make_transcoder(tmu_encoding encoding, tmu_validate validate,
+                                                     const char* replace_str, tm_size_t replace_str_len);
+
+/*
+Convert the next chunk of input to utf8. Output is never nullterminated.
+Params:
+    transcoder: Transcoder created by tmu_utf8_make_transcoder.
+    input:      Next chunk of raw input bytes. Can be NULL iff input_len == 0.
+    input_len:  Length of the input in bytes.
+    out:        Output buffer. Can be NULL iff out_len == 0.
+    out_len:    Length of the buffer specified by out parameter.
+Return:
+    Returns how much input was consumed, how much of out was written and an error code.
+    If out is full, consumed will be less than input_len and the call has to be repeated with the remaining input.
+    Returns TM_ERANGE if out is too small to make any progress.
+    Returns TM_EINVAL if validate == tmu_validate_error and invalid input was encountered or if a byte order mark was
+    expected but not found. The transcoder can't be used after TM_EINVAL was returned.
+*/
+TMU_DEF tmu_transcode_result tmu_utf8_transcode(tmu_utf8_transcoder* transcoder, const void* input,
+                                                tm_size_t input_len, char* out, tm_size_t out_len);
+
+/*
+Convert any remaining buffered input at the end of the input.
+Incomplete sequences are treated as invalid codepoints. Trailing octets that don't make up a whole code unit
+in utf16 or utf32 result in TM_EINVAL.
+Return:
+    Returns TM_ERANGE if out was not big enough to hold all remaining output, in which case the call has to be
+    repeated after consuming out.
+*/
+TMU_DEF tmu_transcode_result tmu_utf8_transcode_finish(tmu_utf8_transcoder* transcoder, char* out, tm_size_t out_len);
+
 TMU_DEF tmu_conversion_result tmu_utf8_from_utf16(tmu_utf16_stream stream, char* out, tm_size_t out_len);
 TMU_DEF tmu_conversion_result tmu_utf16_from_utf8(tmu_utf8_stream stream, tmu_char16* out, tm_size_t out_len);
 
@@ -227,6 +337,121 @@ TMU_DEF tm_size_t tmu_utf8_count_codepoints(const char* str);
 TMU_DEF tm_size_t tmu_utf8_count_codepoints_n(const char* str, tm_size_t str_len);
 TMU_DEF tm_size_t tmu_utf8_count_codepoints_stream(tmu_utf8_stream stream);
 
+/*
+Sparse index for converting between codepoint indices and byte offsets in large utf8 buffers.
+A checkpoint (codepoint index and byte offset) is stored at most every 'interval' codepoints, queries binary search
+the checkpoints and then scan at most one interval forward. The index doesn't keep a pointer to the buffer, the
+current buffer has to be passed to every call.
+The buffer is expected to be valid utf8. Every octet that isn't a continuation octet starts a codepoint.
+*/
+typedef struct {
+    tm_size_t index;  /* Codepoint index. */
+    tm_size_t offset; /* Byte offset of the codepoint. */
+} tmu_utf8_checkpoint;
+
+typedef struct {
+    tmu_utf8_checkpoint* checkpoints;
+    tm_size_t count;
+    tm_size_t capacity;
+    tm_size_t interval;
+    tm_size_t codepoints; /* Number of codepoints in the indexed buffer. */
+    tm_size_t size;       /* Size of the indexed buffer in bytes. */
+} tmu_utf8_offset_index;
+
+typedef struct {
+    tmu_utf8_offset_index index;
+    tm_errc ec;
+} tmu_utf8_offset_index_result;
+
+/*
+Build an index over a utf8 buffer.
+Params:
+    str:      The utf8 buffer. Can be NULL iff str_len == 0.
+    str_len:  Length of the buffer in bytes.
+    interval: Number of codepoints between checkpoints. Must be greater than zero.
+Returns:
+    Returns the index and TM_OK on success, TM_ENOMEM if the checkpoints couldn't be allocated.
+    The index must be destroyed with tmu_utf8_destroy_offset_index.
+*/
+TMU_DEF tmu_utf8_offset_index_result tmu_utf8_make_offset_index(const char* str, tm_size_t str_len,
+                                                                tm_size_t interval);
+TMU_DEF void tmu_utf8_destroy_offset_index(tmu_utf8_offset_index* index);
+
+/*
+Byte offset of the codepoint at codepoint_index. Returns index->size if codepoint_index >= index->codepoints.
+*/
+TMU_DEF tm_size_t tmu_utf8_offset_index_to_offset(const tmu_utf8_offset_index* index, const char* str,
+                                                  tm_size_t codepoint_index);
+/*
+Index of the codepoint that contains the octet at offset. Returns index->codepoints if offset >= index->size.
+*/
+TMU_DEF tm_size_t tmu_utf8_offset_index_to_codepoint(const tmu_utf8_offset_index* index, const char* str,
+                                                     tm_size_t offset);
+
+/*
+Update the index after an edit, without rescanning the whole buffer.
+Only the edited range and the checkpoints surrounding it are rescanned, later checkpoints are shifted.
+Params:
+    index:        The index to update.
+    str:          The buffer after the edit.
+    str_len:      Length of the buffer after the edit.
+    edit_offset:  Byte offset where the edit took place. Must be on a codepoint boundary.
+    removed_len:  How many bytes were removed at edit_offset.
+    inserted_len: How many bytes were inserted at edit_offset.
+Returns:
+    Returns TM_OK on success, TM_ENOMEM if the checkpoints couldn't be reallocated. In that case the index is
+    left unchanged.
+*/
+TMU_DEF tm_errc tmu_utf8_offset_index_update(tmu_utf8_offset_index* index, const char* str, tm_size_t str_len,
+                                             tm_size_t edit_offset, tm_size_t removed_len, tm_size_t inserted_len);
+
+/*
+Processing of large utf8 buffers in parallel.
+This library doesn't create threads itself. Instead the caller supplies a tmu_parallel_for_proc that calls
+task(task_data, i) for every i in [0, count) on its own worker pool and only returns once all tasks are finished.
+The tasks are independent of each other and can run in any order. A serial implementation looks like this:
+    void serial_for(void* user_data, tm_size_t count, tmu_task_proc* task, void* task_data) {
+        for (tm_size_t i = 0; i < count; ++i) task(task_data, i);
+    }
+*/
+typedef void tmu_task_proc(void* task_data, tm_size_t index);
+typedef void tmu_parallel_for_proc(void* user_data, tm_size_t count, tmu_task_proc* task, void* task_data);
+
+typedef struct {
+    tm_size_t offset;
+    tm_size_t size;
+} tmu_utf8_chunk;
+
+/*
+Split a buffer into consecutive chunks of about chunk_size bytes without splitting multibyte sequences.
+Chunks can then be processed independently, for instance by converting each chunk into its own output buffer.
+Params:
+    str:        The utf8 buffer. Can be NULL iff str_len == 0.
+    str_len:    Length of the buffer in bytes.
+    chunk_size: Size of the chunks in bytes. Values less than 16 are treated as 16.
+    out:        Output array of chunks. Can be NULL iff out_len == 0.
+    out_len:    Length of the output array.
+Returns:
+    Returns the number of chunks, of which the first out_len are written to out.
+*/
+TMU_DEF tm_size_t tmu_utf8_split_chunks(const char* str, tm_size_t str_len, tm_size_t chunk_size, tmu_utf8_chunk* out,
+                                        tm_size_t out_len);
+
+/*
+Parallel versions of tmu_utf8_valid_range and tmu_utf8_count_codepoints_n, the results are identical to the serial
+versions. The buffer is split with tmu_utf8_split_chunks, the chunks are processed by parallel_for and the results
+are merged afterwards.
+Params:
+    chunk_size:   Size of the chunks in bytes, pass 0 for a default of 1 MiB.
+    parallel_for: Runs the tasks on a worker pool, see tmu_parallel_for_proc.
+    user_data:    Passed through to parallel_for.
+If the chunk array can't be allocated, the buffer is processed serially on the calling thread.
+*/
+TMU_DEF tm_size_t tmu_utf8_valid_range_parallel(const char* str, tm_size_t str_len, tm_size_t chunk_size,
+                                                tmu_parallel_for_proc* parallel_for, void* user_data);
+TMU_DEF tm_size_t tmu_utf8_count_codepoints_parallel(const char* str, tm_size_t str_len, tm_size_t chunk_size,
+                                                     tmu_parallel_for_proc* parallel_for, void* user_data);
+
 /* The following functions depend on Unicode data being present.
    The default unicode data supplied with this library doesn't supply all of the data supported.
    If more functionality is needed (like transforming strings to uppercase/lowercase etc.), then a different set of
@@ -245,6 +470,31 @@ TMU_DEF tm_bool tmu_is_punctuation(uint32_t codepoint);
 TMU_DEF tm_bool tmu_is_symbol(uint32_t codepoint);
 TMU_DEF tm_bool tmu_is_separator(uint32_t codepoint);
 TMU_DEF tm_bool tmu_is_whitespace(uint32_t codepoint);
+
+/* Category masks for tmu_utf8_span_category. */
+enum {
+    tmu_category_control = (1u << tmu_ucd_category_control),
+    tmu_category_letter = (1u << tmu_ucd_category_letter),
+    tmu_category_mark = (1u << tmu_ucd_category_mark),
+    tmu_category_number = (1u << tmu_ucd_category_number),
+    tmu_category_punctuation = (1u << tmu_ucd_category_punctuation),
+    tmu_category_symbol = (1u << tmu_ucd_category_symbol),
+    tmu_category_separator = (1u << tmu_ucd_category_separator),
+    tmu_category_whitespace = (1u << 7) /* Matches if tmu_is_whitespace returns true. */
+};
+
+/*
+Span the run of codepoints at the start of the stream that match (or don't match) a category mask.
+Runs of ascii are classified 16 octets at a time using bitmaps, only non-ascii codepoints are looked up in the UCD.
+Params:
+    stream: Input stream.
+    mask:   Bitwise or of tmu_category_* values. A codepoint matches if its category or whitespace property is
+            in the mask.
+Returns:
+    Returns the length in bytes of the run. An invalid byte sequence ends the run.
+*/
+TMU_DEF tm_size_t tmu_utf8_span_category(tmu_utf8_stream stream, uint32_t mask);
+TMU_DEF tm_size_t tmu_utf8_span_not_category(tmu_utf8_stream stream, uint32_t mask);
 #endif /* TMU_UCD_HAS_CATEGORY */
 
 #if TMU_UCD_HAS_CASE_INFO
@@ -254,11 +504,40 @@ TMU_DEF tm_bool tmu_is_title(uint32_t codepoint);
 TMU_DEF tm_bool tmu_is_caseless(uint32_t codepoint);
 #endif /* TMU_UCD_HAS_CATEGORY */
 
+#if TMU_UCD_HAS_GRAPHEME_BREAK
+/*
+Like tmu_utf8_split_chunks, but chunks also don't split grapheme clusters.
+Chunks only end where a grapheme cluster boundary is certain without looking further back, i.e. between codepoints
+of the grapheme break classes Other, Control, CR, LF and Extended_Pictographic (except CR LF). If there is no
+such boundary within 32 codepoints of the intended end, the chunk ends at a codepoint boundary instead.
+*/
+TMU_DEF tm_size_t tmu_utf8_split_chunks_graphemes(const char* str, tm_size_t str_len, tm_size_t chunk_size,
+                                                  tmu_utf8_chunk* out, tm_size_t out_len);
+#endif
+
 #if TMU_UCD_HAS_WIDTH
 TMU_DEF int tmu_utf8_width(tmu_utf8_stream stream);
 TMU_DEF int tmu_utf8_width_n(const char* str, tm_size_t str_len);
 #endif
 
+/*
+Text segmentation according to Unicode Standard Annex #29 (https://www.unicode.org/reports/tr29/).
+These require Unicode data generated with the word_break/sentence_break flags of tools/unicode_gen.
+Params:
+    stream: Input stream to segment.
+Returns:
+    Returns a pointer to the next word/sentence boundary after stream.cur, or stream.end if there is none.
+    An invalid byte sequence is treated as a segment of its own.
+    To iterate over all segments, set stream.cur to the returned value until it is equal to stream.end.
+*/
+#if TMU_UCD_HAS_WORD_BREAK
+TMU_DEF const char* tmu_utf8_next_word_break(tmu_utf8_stream stream);
+#endif /* TMU_UCD_HAS_WORD_BREAK */
+
+#if TMU_UCD_HAS_SENTENCE_BREAK
+TMU_DEF const char* tmu_utf8_next_sentence_break(tmu_utf8_stream stream);
+#endif /* TMU_UCD_HAS_SENTENCE_BREAK */
+
 #if TMU_UCD_HAS_SIMPLE_CASE
 TMU_DEF tmu_transform_result tmu_utf8_to_upper_simple(const char* str, tm_size_t str_len, char* out, tm_size_t out_len);
 TMU_DEF tmu_transform_result tmu_utf8_to_title_simple(const char* str, tm_size_t str_len, char* out, tm_size_t out_len);
@@ -272,6 +551,8 @@ TMU_DEF tm_bool tmu_utf8_equals_ignore_case_simple(const char* a, tm_size_t a_le
 TMU_DEF int tmu_utf8_compare_ignore_case_simple(const char* a, tm_size_t a_len, const char* b, tm_size_t b_len);
 /* String comparison for humans. See http://stereopsis.com/strcmp4humans.html. */
 TMU_DEF int tmu_utf8_human_compare_simple(const char* a, tm_size_t a_len, const char* b, tm_size_t b_len);
+TMU_DEF tmu_transform_result tmu_utf8_make_sort_key_simple(const char* str, tm_size_t str_len, char* out,
+                                                           tm_size_t out_len);
 #endif /* TMU_UCD_HAS_SIMPLE_CASE_FOLD */
 
 #if TMU_UCD_HAS_SIMPLE_CASE_TOGGLE
@@ -295,6 +576,20 @@ TMU_DEF tm_bool tmu_utf8_equals_ignore_case(const char* a, tm_size_t a_len, cons
 TMU_DEF int tmu_utf8_compare_ignore_case(const char* a, tm_size_t a_len, const char* b, tm_size_t b_len);
 /* String comparison for humans. See http://stereopsis.com/strcmp4humans.html. */
 TMU_DEF int tmu_utf8_human_compare(const char* a, tm_size_t a_len, const char* b, tm_size_t b_len);
+
+/*
+Transforms a string into a sort key, so that sorting many strings doesn't need to case fold them on every comparison.
+Comparing two sort keys bytewise with tmu_utf8_compare (or any comparison that orders a prefix first) gives the same
+order as comparing the original strings with tmu_utf8_human_compare (tmu_utf8_human_compare_simple for
+tmu_utf8_make_sort_key_simple). Numbers are ordered by their value. Values of 2146369536 (2^31 - 0x110000) and
+above saturate and compare equal to each other, just like in tmu_utf8_human_compare.
+For the order of tmu_utf8_compare_ignore_case, the output of tmu_utf8_to_case_fold already is a valid sort key.
+Returns:
+    Returns the size of the key and TM_OK on success. The key is not nullterminated and not necessarily valid UTF-8.
+    Returns TM_ERANGE and the required size if out_len is too small.
+    Returns TM_EINVAL if str is not valid UTF-8.
+*/
+TMU_DEF tmu_transform_result tmu_utf8_make_sort_key(const char* str, tm_size_t str_len, char* out, tm_size_t out_len);
 #endif /* TMU_UCD_HAS_FULL_CASE_FOLD */
 
 #endif /* defined(TMU_UCD_HAS_CASE_INFO) */
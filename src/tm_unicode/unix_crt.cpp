@@ -25,6 +25,35 @@ static FILE* tmu_freopen_t(const tmu_tchar* filename, const tmu_tchar* mode, FIL
     return freopen(filename, mode, current);
 }
 
+static void tmu_destroy_platform_path(tmu_platform_path* path);
+
+/* Syncs the directory containing filename, so that a file that was just moved into it survives a crash. */
+static tm_errc tmu_sync_parent_directory_t(const tmu_tchar* filename) {
+    tm_size_t dir_len = tmu_get_path_len_internal(filename, /*filename_len=*/0);
+    if (dir_len == 0 && filename[0] == TMU_DIR_DELIM) dir_len = 1;
+
+    tmu_platform_path platform_dir;
+    const tmu_tchar* dir = TMU_TEXT(".");
+    if (dir_len > 0) {
+        dir = tmu_to_platform_path_t(filename, dir_len, &platform_dir);
+        if (!dir) return TM_ENOMEM;
+    }
+
+    tm_errc result = TM_OK;
+    errno = 0;
+    int fd = open(dir, O_RDONLY);
+    if (fd < 0) {
+        result = (errno != 0) ? errno : TM_EIO;
+    } else {
+        /* Some file systems can't sync directories and report EINVAL, there is nothing more we can do there. */
+        if (fsync(fd) != 0 && errno != EINVAL) result = (errno != 0) ? errno : TM_EIO;
+        close(fd);
+    }
+
+    if (dir_len > 0) tmu_destroy_platform_path(&platform_dir);
+    return result;
+}
+
 TMU_DEF tmu_contents_result tmu_current_working_directory(tm_size_t extra_size) {
     TM_ASSERT_VALID_SIZE(extra_size);
 
@@ -174,12 +203,15 @@ TMU_DEF void tmu_close_directory(tmu_opened_dir* dir) {
     if (dir->internal) {
         closedir((DIR*)dir->internal);
     }
+    tmu_destroy_contents(&dir->internal_names);
     memset(dir, 0, sizeof(tmu_opened_dir));
 }
 
-TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir) {
-    if (!dir) return TM_NULL;
-    if (!dir->internal) return TM_NULL;
+static tm_bool tmu_read_directory_internal(tmu_opened_dir* dir, uint32_t flags, tmu_directory_entry* out) {
+    TM_ASSERT(dir);
+    TM_ASSERT(out);
+    if (dir->ec != TM_OK) return TM_FALSE;
+    if (!dir->internal) return TM_FALSE;
     DIR* handle = (DIR*)dir->internal;
 
     struct dirent* entry = TM_NULL;
@@ -189,19 +221,51 @@ TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir)
         if (!entry) {
             int last_error = errno;
             if (last_error != 0) dir->ec = last_error;
-            memset(&dir->internal_result, 0, sizeof(tmu_read_directory_result));
-            return TM_NULL;
+            return TM_FALSE;
         }
 
         /* Skip "." and ".." entries. */
         if ((entry->d_name[0] == '.' && entry->d_name[1] == 0)
             || (entry->d_name[0] == '.' && entry->d_name[1] == '.' && entry->d_name[2] == 0))
             continue;
+
+        out->name = entry->d_name;
+        out->is_file = (entry->d_type != DT_DIR);
+        out->has_stat = TM_FALSE;
+        out->size = 0;
+        out->file_time = 0;
+
+        /* Some filesystems don't fill out d_type, we need to query the type ourselves in that case. */
+        if ((flags & tmu_read_directory_stat) || entry->d_type == DT_UNKNOWN) {
+            TMU_STRUCT_STAT info;
+            errno = 0;
+            if (fstatat(dirfd(handle), entry->d_name, &info, AT_SYMLINK_NOFOLLOW) != 0) {
+                /* Entry was removed between readdir and fstatat. */
+                if (errno == ENOENT) continue;
+                dir->ec = (errno != 0) ? errno : TM_EIO;
+                return TM_FALSE;
+            }
+            out->is_file = !TMU_S_ISDIR(info.st_mode);
+            out->has_stat = TM_TRUE;
+            out->size = (uint64_t)info.st_size;
+            out->file_time = (tmu_file_time)info.st_mtime;
+        }
         break;
     }
+    return TM_TRUE;
+}
+
+TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir) {
+    if (!dir) return TM_NULL;
+
+    tmu_directory_entry entry;
+    if (!tmu_read_directory_internal(dir, /*flags=*/0, &entry)) {
+        memset(&dir->internal_result, 0, sizeof(tmu_read_directory_result));
+        return TM_NULL;
+    }
 
-    dir->internal_result.name = entry->d_name;
-    dir->internal_result.is_file = ((entry->d_type & DT_DIR) == 0);
+    dir->internal_result.name = entry.name;
+    dir->internal_result.is_file = entry.is_file;
     return &dir->internal_result;
 }
 
@@ -331,69 +331,50 @@ static tmu_write_file_result tmu_write_file_ex_t(const WCHAR* filename, const vo
         return tmu_write_file_ex_internal(filename, data, size, flags);
     }
 
-    tmu_write_file_result result = {0, TM_OK};
-
-    tm_size_t filename_len = (tm_size_t)lstrlenW(filename);
-    tm_size_t dir_len = tmu_get_path_len_internal(filename, filename_len);
-    if (flags & tmu_create_directory_tree) {
-        tm_errc ec = tmu_create_directory_internal(filename, dir_len);
-        if (ec != TM_OK) {
-            result.ec = ec;
-            return result;
-        }
-    }
+    tmu_file_writer writer = tmu_file_writer_open_internal(filename, flags, /*buffer_capacity=*/0);
+    tmu_file_writer_write(&writer, data, size);
+    return tmu_file_writer_close(&writer);
+}
 
-    WCHAR* temp_file = TM_NULL;
-    WCHAR temp_file_buffer[MAX_PATH];
-    const tm_size_t temp_file_len = filename_len + 9;
+static tm_errc tmu_file_writer_open_t(const WCHAR* filename, tm_bool exclusive, void** out) {
+    TM_ASSERT(out);
 
-    /* Limitation of GetTempFileNameW, dir_len cannot be bigger than MAX_PATH - 14. */
-    if (dir_len < MAX_PATH - 14) {
-        WCHAR temp_dir[MAX_PATH];
-        TMU_MEMCPY(temp_dir, filename, dir_len * sizeof(WCHAR));
-        temp_dir[dir_len] = 0;
-        if (GetTempFileNameW(temp_dir, TMU_TEXT("tmf"), 0, temp_file_buffer) == 0) {
-            result.ec = TM_EIO;
-            return result;
-        }
+    DWORD creation_flags = (exclusive) ? CREATE_NEW : CREATE_ALWAYS;
+    HANDLE file = CreateFileW(filename, GENERIC_WRITE, 0, TM_NULL, creation_flags, FILE_ATTRIBUTE_NORMAL, TM_NULL);
+    if (file == INVALID_HANDLE_VALUE) return tmu_winerror_to_errc(GetLastError(), TM_EIO);
+    *out = (void*)file;
+    return TM_OK;
+}
 
-        temp_file = temp_file_buffer;
-    } else {
-        /* Fallback to using a simple temp_file. */
-        temp_file = (WCHAR*)TMU_MALLOC(temp_file_len * sizeof(WCHAR), sizeof(WCHAR));
-        if (!temp_file) {
-            result.ec = TM_ENOMEM;
-            return result;
+static tm_errc tmu_file_writer_write_t(void* handle, const void* data, tm_size_t size) {
+    TM_ASSERT(handle);
+    TM_ASSERT(data || size == 0);
+
+    const char* cur = (const char*)data;
+    while (size > 0) {
+        /* WriteFile takes a DWORD as size, write in chunks so that there is no UINT32_MAX limit. */
+        DWORD chunk_size = ((size_t)size > (size_t)0x40000000u) ? (DWORD)0x40000000u : (DWORD)size;
+        DWORD bytes_written = 0;
+        if (!WriteFile((HANDLE)handle, cur, chunk_size, &bytes_written, TM_NULL)) {
+            return tmu_winerror_to_errc(GetLastError(), TM_EIO);
         }
-        TMU_MEMCPY(temp_file, filename, filename_len * sizeof(WCHAR));
-        /* Copy filename ending + null terminator. */
-        TMU_MEMCPY(temp_file + filename_len, TMU_TEXT(".tmu_tmp"), sizeof(WCHAR) * 9);
+        if (bytes_written != chunk_size) return TM_EIO;
+        cur += bytes_written;
+        size -= (tm_size_t)bytes_written;
     }
+    return TM_OK;
+}
 
-    TM_ASSERT(temp_file);
-
-    tmu_write_file_result temp_write_result = tmu_write_file_ex_internal(temp_file, data, size, 0);
-    if (temp_write_result.ec != TM_OK) {
-        result.ec = temp_write_result.ec;
-        if (temp_file != temp_file_buffer) {
-            TMU_FREE(temp_file);
-        }
-        return result;
-    }
+static tm_errc tmu_file_writer_sync_t(void* handle) {
+    TM_ASSERT(handle);
+    if (!FlushFileBuffers((HANDLE)handle)) return tmu_winerror_to_errc(GetLastError(), TM_EIO);
+    return TM_OK;
+}
 
-    DWORD move_flags = MOVEFILE_COPY_ALLOWED;
-    if (flags & tmu_overwrite) move_flags |= MOVEFILE_REPLACE_EXISTING;
-    if (!MoveFileExW(temp_file, filename, move_flags)) {
-        result.ec = tmu_winerror_to_errc(GetLastError(), TM_EIO);
-        if (temp_file != temp_file_buffer) {
-            TMU_FREE(temp_file);
-        }
-        return result;
-    }
-    if (temp_file != temp_file_buffer) {
-        TMU_FREE(temp_file);
-    }
-    return result;
+static tm_errc tmu_file_writer_close_t(void* handle) {
+    TM_ASSERT(handle);
+    if (!CloseHandle((HANDLE)handle)) return tmu_winerror_to_errc(GetLastError(), TM_EIO);
+    return TM_OK;
 }
 
 static tm_errc tmu_rename_file_ex_t(const WCHAR* from, const WCHAR* to, uint32_t flags) {
@@ -408,6 +389,12 @@ static tm_errc tmu_rename_file_ex_t(const WCHAR* from, const WCHAR* to, uint32_t
     return TM_OK;
 }
 
+/* Directories can't be synced on Windows, renames are only as durable as the file system makes them. */
+static tm_errc tmu_sync_parent_directory_t(const WCHAR* filename) {
+    TM_UNREFERENCED_PARAM(filename);
+    return TM_OK;
+}
+
 static tm_errc tmu_delete_file_t(const WCHAR* filename) {
     if (!DeleteFileW(filename)) return tmu_winerror_to_errc(GetLastError(), TM_EIO);
     return TM_OK;
@@ -584,22 +571,25 @@ TMU_DEF void tmu_close_directory(tmu_opened_dir* dir) {
         TMU_FREE(find_data);
     }
     tmu_destroy_contents(&dir->internal_buffer);
+    tmu_destroy_contents(&dir->internal_names);
     ZeroMemory(dir, sizeof(tmu_opened_dir));
 }
 
-TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir) {
-    if (!dir) return TM_NULL;
-    if (dir->ec != TM_OK) return TM_NULL;
-    if (!dir->internal) return TM_NULL;
+static tm_bool tmu_read_directory_internal(tmu_opened_dir* dir, uint32_t flags, tmu_directory_entry* out) {
+    TM_ASSERT(dir);
+    TM_ASSERT(out);
+    TM_UNREFERENCED_PARAM(flags);
+    if (dir->ec != TM_OK) return TM_FALSE;
+    if (!dir->internal) return TM_FALSE;
 
     struct tmu_internal_find_data* find_data = (struct tmu_internal_find_data*)dir->internal;
     if (find_data->handle == INVALID_HANDLE_VALUE) {
         dir->ec = TM_EPERM;
-        return TM_NULL;
+        return TM_FALSE;
     }
     if (!find_data->has_data) {
         dir->ec = find_data->next_ec;
-        return TM_NULL;
+        return TM_FALSE;
     }
 
     /* Skip "." and ".." entries. */
@@ -611,16 +601,15 @@ TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir)
         if (!find_data->has_data) {
             DWORD last_error = GetLastError();
             if (last_error != ERROR_NO_MORE_FILES) dir->ec = tmu_winerror_to_errc(last_error, TM_EPERM);
-            return TM_NULL;
+            return TM_FALSE;
         }
     }
 
-    ZeroMemory(&dir->internal_result, sizeof(tmu_read_directory_result));
     int required_size = WideCharToMultiByte(CP_UTF8, TMU_TO_UTF8_FLAGS, find_data->data.cFileName, -1, TM_NULL, 0,
                                             TM_NULL, TM_NULL);
     if (required_size <= 0) {
         dir->ec = tmu_winerror_to_errc(GetLastError(), TM_EPERM);
-        return TM_NULL;
+        return TM_FALSE;
     }
 
     // Additional size for trailing slash and nullterminator.
@@ -629,14 +618,14 @@ TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir)
         dir->internal_buffer.data = (char*)TMU_MALLOC((size_t)required_size, sizeof(char));
         if (!dir->internal_buffer.data) {
             dir->ec = TM_ENOMEM;
-            return TM_NULL;
+            return TM_FALSE;
         }
         dir->internal_buffer.capacity = (tm_size_t)required_size;
     } else if (dir->internal_buffer.capacity < (tm_size_t)required_size) {
         dir->internal_buffer.size = 0;
         if (!tmu_grow_by(&dir->internal_buffer, (tm_size_t)required_size)) {
             dir->ec = TM_ENOMEM;
-            return TM_NULL;
+            return TM_FALSE;
         }
     }
     TM_ASSERT(dir->internal_buffer.data);
@@ -644,7 +633,7 @@ TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir)
                                         dir->internal_buffer.data, (int)dir->internal_buffer.capacity, TM_NULL, TM_NULL);
     if (real_size <= 0 || real_size >= required_size) {
         dir->ec = tmu_winerror_to_errc(GetLastError(), TM_EPERM);
-        return TM_NULL;
+        return TM_FALSE;
     }
 
     TM_ASSERT((tm_size_t)real_size < dir->internal_buffer.capacity);
@@ -652,14 +641,31 @@ TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir)
     dir->internal_buffer.size = (tm_size_t)real_size;
     tmu_to_tmu_path(&dir->internal_buffer, /*is_dir=*/((find_data->data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0));
 
-    dir->internal_result.is_file = (find_data->data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0;
-    dir->internal_result.name = dir->internal_buffer.data;
+    out->name = dir->internal_buffer.data;
+    out->is_file = (find_data->data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0;
+    out->has_stat = TM_TRUE;
+    out->size = ((uint64_t)find_data->data.nFileSizeHigh << 32u) | (uint64_t)find_data->data.nFileSizeLow;
+    TMU_MEMCPY(&out->file_time, &find_data->data.ftLastWriteTime, sizeof(find_data->data.ftLastWriteTime));
 
     find_data->has_data = FindNextFileW(find_data->handle, &find_data->data);
     if (!find_data->has_data) {
         DWORD last_error = GetLastError();
         if (last_error != ERROR_NO_MORE_FILES) find_data->next_ec = tmu_winerror_to_errc(last_error, TM_EPERM);
     }
+    return TM_TRUE;
+}
+
+TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir) {
+    if (!dir) return TM_NULL;
+
+    tmu_directory_entry entry;
+    if (!tmu_read_directory_internal(dir, /*flags=*/0, &entry)) {
+        ZeroMemory(&dir->internal_result, sizeof(tmu_read_directory_result));
+        return TM_NULL;
+    }
+
+    dir->internal_result.name = entry.name;
+    dir->internal_result.is_file = entry.is_file;
     return &dir->internal_result;
 }
 
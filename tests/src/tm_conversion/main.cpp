@@ -370,6 +370,7 @@ TEST_CASE("Test digits count") {
             for (uint32_t i = 1; i <= 20; i++) {
                 REQUIRE(prev <= val);
                 CHECK(get_digits_count_decimal_u64(val) == i);
+                CHECK(get_digits_count_decimal_u64(val - 1) == ((i > 1) ? (i - 1) : 1));
                 val *= 10;
             }
         }
@@ -528,19 +529,215 @@ TEST_CASE("Test integer printing") {
         check_int_printing(print_u64, buffer, 64, UINT64_MAX, 10, false, TM_OK, "18446744073709551615");
         check_int_printing(print_u64, buffer, 64, UINT64_MAX, 16, false, TM_OK, "FFFFFFFFFFFFFFFF");
     }
+    SUBCASE("Decimal around powers of ten") {
+        // Decimal printing switches between groups of 2, 4, 6 and 8 digits depending on the digits count.
+        char buffer[32];
+        char expected[32];
+        for (uint64_t power = 1; power <= 10000000000000000000ull; power *= 10) {
+            for (uint64_t value : {power - 1, power, power + 1, power * 9 + (power - 1)}) {
+                if (value < power / 10) continue;
+                snprintf(expected, sizeof(expected), "%" PRIu64, value);
+                compare_results(buffer, print_decimal_u64(buffer, 32, value), TM_OK, expected);
+                if (value <= UINT32_MAX) {
+                    compare_results(buffer, print_decimal_u32(buffer, 32, (uint32_t)value), TM_OK, expected);
+                }
+            }
+            if (power > UINT64_MAX / 10) break;
+        }
+    }
+}
+
+template <class T, class ScanFunc>
+void check_int_scanning(ScanFunc scan_func, const char* str, int32_t base, tm_errc expected_ec,
+                        tm_size_t expected_size, T expected_value) {
+    CAPTURE(str);
+    T value = 0;
+    auto result = scan_func(str, (tm_size_t)strlen(str), &value, base);
+    CHECK(result.ec == expected_ec);
+    if (result.ec == TM_OK) {
+        CHECK(result.size == expected_size);
+        CHECK(value == expected_value);
+    }
+}
+
+TEST_CASE("Test integer scanning") {
+    SUBCASE("Base 10 digit runs") {
+        // Base 10 scans 8 digits at once, stopping in the middle of such a run has to work at every position.
+        check_int_scanning<uint64_t>(scan_u64_n, "12345678", 10, TM_OK, 8, 12345678u);
+        check_int_scanning<uint64_t>(scan_u64_n, "1234567/", 10, TM_OK, 7, 1234567u);
+        check_int_scanning<uint64_t>(scan_u64_n, "1234567:", 10, TM_OK, 7, 1234567u);
+        check_int_scanning<uint64_t>(scan_u64_n, "1234\xB5" "678", 10, TM_OK, 4, 1234u);
+        check_int_scanning<uint64_t>(scan_u64_n, "1234 5678", 10, TM_OK, 4, 1234u);
+        check_int_scanning<uint64_t>(scan_u64_n, "/2345678", 10, TM_EINVAL, 0, 0u);
+        check_int_scanning<uint64_t>(scan_u64_n, "1234567890123456", 10, TM_OK, 16, 1234567890123456u);
+        check_int_scanning<uint64_t>(scan_u64_n, "12345678901234567x", 10, TM_OK, 17, 12345678901234567u);
+        check_int_scanning<uint64_t>(scan_u64_n, "00000000000000000000000001", 10, TM_OK, 26, 1u);
+        check_int_scanning<uint64_t>(scan_u64_n, "18446744073709551615", 10, TM_OK, 20, UINT64_MAX);
+        check_int_scanning<uint64_t>(scan_u64_n, "18446744073709551616", 10, TM_ERANGE, 20, 0u);
+        check_int_scanning<uint64_t>(scan_u64_n, "99999999999999999999", 10, TM_ERANGE, 20, 0u);
+        check_int_scanning<int64_t>(scan_i64_n, "-9223372036854775808", 10, TM_OK, 20, INT64_MIN);
+        check_int_scanning<int64_t>(scan_i64_n, "9223372036854775807", 10, TM_OK, 19, INT64_MAX);
+        check_int_scanning<int64_t>(scan_i64_n, "9223372036854775808", 10, TM_ERANGE, 19, 0);
+        check_int_scanning<int64_t>(scan_i64_n, "-12345678.5", 10, TM_OK, 9, -12345678);
+        check_int_scanning<uint32_t>(scan_u32_n, "4294967295", 10, TM_OK, 10, UINT32_MAX);
+        check_int_scanning<uint32_t>(scan_u32_n, "4294967296", 10, TM_ERANGE, 10, 0u);
+        check_int_scanning<int32_t>(scan_i32_n, "-2147483648", 10, TM_OK, 11, INT32_MIN);
+        check_int_scanning<int32_t>(scan_i32_n, "2147483648", 10, TM_ERANGE, 10, 0);
+        check_int_scanning<int32_t>(scan_i32_n, "87654321", 10, TM_OK, 8, 87654321);
+    }
+    SUBCASE("Other bases") {
+        check_int_scanning<uint64_t>(scan_u64_n, "123456701", 8, TM_OK, 9, 0123456701u);
+        check_int_scanning<uint64_t>(scan_u64_n, "ffffffffffffffff", 16, TM_OK, 16, UINT64_MAX);
+        check_int_scanning<uint32_t>(scan_u32_n, "11111111111111111111111111111111", 2, TM_OK, 32, UINT32_MAX);
+    }
+    SUBCASE("Length is respected") {
+        const char* str = "1234567890123456789";
+        for (tm_size_t len = 1; len <= 19; ++len) {
+            uint64_t value = 0;
+            auto result = scan_u64_n(str, len, &value, 10);
+            CHECK(result.ec == TM_OK);
+            CHECK(result.size == len);
+            CHECK(value == strtoull(std::string(str, len).c_str(), nullptr, 10));
+        }
+    }
+    SUBCASE("Random values") {
+        uint64_t state = 0x2545F4914F6CDD1Dull;
+        for (int i = 0; i < 100000; ++i) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            uint64_t expected = state >> (state & 63);
+            char buffer[32];
+            int len = snprintf(buffer, sizeof(buffer), "%" PRIu64 "x", expected);
+            uint64_t value = 0;
+            auto result = scan_u64_n(buffer, (tm_size_t)len, &value, 10);
+            REQUIRE(result.ec == TM_OK);
+            REQUIRE(result.size == (tm_size_t)(len - 1));
+            REQUIRE(value == expected);
+        }
+    }
+}
+
+TEST_CASE("Test array scanning") {
+    SUBCASE("Integers") {
+        const char* str = "1,-2,300000000000,-9223372036854775808\n";
+        int64_t values[8] = {};
+        tm_size_t count = 8;
+        auto result = scan_i64_array(str, (tm_size_t)strlen(str), ',', values, &count, 10);
+        CHECK(result.ec == TM_EINVAL);
+        CHECK(count == 3);
+        CHECK(result.size == 18);
+        CHECK(values[0] == 1);
+        CHECK(values[1] == -2);
+        CHECK(values[2] == 300000000000);
+
+        count = 8;
+        result = scan_i64_array(str, (tm_size_t)strlen(str) - 1, ',', values, &count, 10);
+        CHECK(result.ec == TM_OK);
+        CHECK(count == 4);
+        CHECK(result.size == (tm_size_t)strlen(str) - 1);
+        CHECK(values[3] == INT64_MIN);
+    }
+    SUBCASE("Trailing delimiter and full output") {
+        const char* str = "1\n2\n3\n4\n";
+        uint64_t values[2] = {};
+        tm_size_t count = 2;
+        auto result = scan_u64_array(str, (tm_size_t)strlen(str), '\n', values, &count, 10);
+        CHECK(result.ec == TM_OK);
+        CHECK(count == 2);
+        // Scanning can continue after the delimiter of the last value.
+        CHECK(result.size == 4);
+        CHECK(values[0] == 1);
+        CHECK(values[1] == 2);
+
+        count = 2;
+        result = scan_u64_array(str + 4, (tm_size_t)strlen(str) - 4, '\n', values, &count, 10);
+        CHECK(result.ec == TM_OK);
+        CHECK(count == 2);
+        CHECK(result.size == (tm_size_t)strlen(str) - 4);
+        CHECK(values[0] == 3);
+        CHECK(values[1] == 4);
+    }
+    SUBCASE("Errors") {
+        uint64_t values[4] = {};
+        tm_size_t count = 4;
+        auto result = scan_u64_array("", 0, ',', values, &count, 10);
+        CHECK(result.ec == TM_OK);
+        CHECK(count == 0);
+
+        count = 4;
+        result = scan_u64_array("1,,2", 4, ',', values, &count, 10);
+        CHECK(result.ec == TM_EINVAL);
+        CHECK(count == 1);
+        CHECK(result.size == 2);
+
+        count = 4;
+        result = scan_u64_array("ff;18446744073709551616", 23, ';', values, &count, 16);
+        CHECK(result.ec == TM_ERANGE);
+        CHECK(count == 1);
+        CHECK(result.size == 3);
+        CHECK(values[0] == 255);
+    }
+    SUBCASE("Doubles") {
+        const char* str = "0.5;-1e3;1.25;2";
+        double values[4] = {};
+        tm_size_t count = 4;
+        auto result = scan_double_array(str, (tm_size_t)strlen(str), ';', values, &count, 0);
+        CHECK(result.ec == TM_OK);
+        CHECK(count == 4);
+        CHECK(values[0] == 0.5);
+        CHECK(values[1] == -1000.0);
+        CHECK(values[2] == 1.25);
+        CHECK(values[3] == 2.0);
+    }
+}
+
+TEST_CASE("Test array printing") {
+    char buffer[128];
+    const int64_t signed_values[] = {0, -1, 12345678901, INT64_MIN};
+    compare_results(buffer, print_i64_array(buffer, 128, signed_values, 4, ','), TM_OK,
+                    "0,-1,12345678901,-9223372036854775808");
+    const uint64_t unsigned_values[] = {7, UINT64_MAX};
+    compare_results(buffer, print_u64_array(buffer, 128, unsigned_values, 2, ';'), TM_OK, "7;18446744073709551615");
+    compare_results(buffer, print_u64_array(buffer, 128, unsigned_values, 0, ';'), TM_OK, "");
+    const double double_values[] = {0.1, -2.5, 1e23};
+    compare_results(buffer, print_double_array(buffer, 128, double_values, 3, ',', PF_SCIENTIFIC, -1), TM_OK,
+                    "1E-01,-2.5E+00,1E+23");
+
+    // The separator and every value need to fit.
+    CHECK(print_i64_array(buffer, 6, signed_values, 3, ',').ec == TM_EOVERFLOW);
+    CHECK(print_i64_array(buffer, 15, signed_values, 3, ',').ec == TM_EOVERFLOW);
+    CHECK(print_i64_array(buffer, 16, signed_values, 3, ',').ec == TM_OK);
+    CHECK(print_u64_array(buffer, 2, unsigned_values, 2, ';').ec == TM_EOVERFLOW);
+    CHECK(print_double_array(buffer, 3, double_values, 2, ',', 0, -1).ec == TM_EOVERFLOW);
+    CHECK(print_double_array(buffer, 8, double_values, 2, ',', 0, -1).ec == TM_OK);
+
+    // Like the integer versions, no destination is needed when nothing fits.
+    CHECK(print_i64_array(nullptr, 0, signed_values, 1, ',').ec == TM_EOVERFLOW);
+    CHECK(print_double_array(nullptr, 0, double_values, 1, ',', 0, -1).ec == TM_EOVERFLOW);
+    CHECK(print_double_array(nullptr, 0, double_values, 0, ',', 0, -1).ec == TM_OK);
+
+    // Printed arrays scan back into the same values.
+    uint64_t scanned[2] = {};
+    tm_size_t count = 2;
+    auto printed = print_u64_array(buffer, 128, unsigned_values, 2, ',');
+    REQUIRE(printed.ec == TM_OK);
+    CHECK(scan_u64_array(buffer, printed.size, ',', scanned, &count, 10).ec == TM_OK);
+    CHECK(count == 2);
+    CHECK(scanned[0] == unsigned_values[0]);
+    CHECK(scanned[1] == unsigned_values[1]);
 }
 
 static float lerp(float t, float a, float b) { return a + t * (b - a); }
 static double lerp(double t, double a, double b) { return a + t * (b - a); }
 
 template <class UnsignedType, class PrintFunc, class ScanFunc, class ValueType>
-bool test_roundtrip(PrintFunc print_func, ScanFunc scan_func, ValueType min_val, ValueType max_val) {
+bool test_roundtrip(PrintFunc print_func, ScanFunc scan_func, ValueType min_val, ValueType max_val, int precision) {
     int mismatchCount = 0;
     int closeMismatchCount = 0;
     uint64_t totalTests = 0;
 
     auto print_test = [&](ValueType min, ValueType max, int steps) {
-        const int precision = 14;
         const unsigned flags = PF_TRAILING_ZEROES;
 
         for (auto i = 0; i < steps; ++i) {
@@ -594,9 +791,10 @@ bool test_roundtrip(PrintFunc print_func, ScanFunc scan_func, ValueType min_val,
 
 TEST_CASE("Test float roundtrip") {
     // CHECK(test_roundtrip<uint32_t>(print_float, scan_float_n, -HUGE_VALF, HUGE_VALF));
-    CHECK(test_roundtrip<uint32_t>(print_float, scan_float_n, -1000000000.0f, 1000000000.0f));
-    // We currently expect doubles to not survive a roundtrip. The conversion routines are wildy inaccurate for doubles.
-    CHECK(test_roundtrip<uint64_t>(print_double, scan_double_n, -1000000000.0, 100000000000.0) == false);
+    CHECK(test_roundtrip<uint32_t>(print_float, scan_float_n, -1000000000.0f, 1000000000.0f, 14));
+    // 14 digits after the dot are not enough for small doubles, the shortest representation always is.
+    CHECK(test_roundtrip<uint64_t>(print_double, scan_double_n, -1000000000.0, 100000000000.0, 14) == false);
+    CHECK(test_roundtrip<uint64_t>(print_double, scan_double_n, -1000000000.0, 100000000000.0, -1));
 }
 
 TEST_CASE("Test float accuracy") {
@@ -646,13 +844,285 @@ TEST_CASE("Test float accuracy") {
     CHECK(print_test(0, 1, 10000000));
 }
 
-TEST_CASE("Test float corner cases" * doctest::may_fail(true)) {
+TEST_CASE("Test float corner cases") {
     float value = 0;
     auto result = scan_float("0.0000000000000000000000000000001", &value, 0);
     CHECK(result.ec == TM_OK);
     CHECK(value != 0);
 }
 
+TEST_CASE("Test float printing with precision") {
+    char buffer[512];
+    // Exact values are rounded half to even.
+    check_float_printing(print_double, buffer, 512, 0.125, 0, 2, TM_OK, "0.12");
+    check_float_printing(print_double, buffer, 512, 0.375, 0, 2, TM_OK, "0.38");
+    check_float_printing(print_double, buffer, 512, 2.5, 0, 0, TM_OK, "2");
+    check_float_printing(print_double, buffer, 512, 3.5, 0, 0, TM_OK, "4");
+    check_float_printing(print_double, buffer, 512, 0.5000000000000001, 0, 0, TM_OK, "1");
+    check_float_printing(print_double, buffer, 512, 0.99, 0, 1, TM_OK, "1.0");
+    check_float_printing(print_double, buffer, 512, -9.5, 0, 0, TM_OK, "-10");
+    check_float_printing(print_double, buffer, 512, -0.001, 0, 2, TM_OK, "-0.00");
+
+    // Digits beyond 17 significant digits and values above 1e19 are exact.
+    check_float_printing(print_double, buffer, 512, 0.1, 0, 20, TM_OK, "0.10000000000000000555");
+    check_float_printing(print_double, buffer, 512, 1e20, 0, 0, TM_OK, "100000000000000000000");
+    check_float_printing(print_double, buffer, 512, 1e23, 0, 0, TM_OK, "99999999999999991611392");
+    check_float_printing(print_double, buffer, 512, 18446744073709551616.0, 0, 1, TM_OK, "18446744073709551616.0");
+    check_float_printing(print_double, buffer, 512, 5e-324, 0, 3, TM_OK, "0.000");
+    check_float_printing(print_float, buffer, 512, 0.1f, 0, 10, TM_OK, "0.1000000015");
+    check_float_printing(print_float, buffer, 512, 16777217.0f, 0, 0, TM_OK, "16777216");
+
+    // Scientific notation.
+    check_float_printing(print_double, buffer, 512, 1.0, PF_SCIENTIFIC, 6, TM_OK, "1.000000E+00");
+    check_float_printing(print_double, buffer, 512, 1.125, PF_SCIENTIFIC | PF_LOWERCASE, 2, TM_OK, "1.12e+00");
+    check_float_printing(print_double, buffer, 512, 999.96, PF_SCIENTIFIC | PF_LOWERCASE, 3, TM_OK, "1.000e+03");
+    check_float_printing(print_double, buffer, 512, 1e100, PF_SCIENTIFIC | PF_LOWERCASE, 0, TM_OK, "1e+100");
+    check_float_printing(print_double, buffer, 512, 1e23 * 0.9999, PF_SCIENTIFIC | PF_LOWERCASE, 3, TM_OK,
+                         "9.999e+22");
+    check_float_printing(print_double, buffer, 512, 4.9406564584124654e-324, PF_SCIENTIFIC | PF_LOWERCASE, 1, TM_OK,
+                         "4.9e-324");
+    check_float_printing(print_double, buffer, 512, 0.0, PF_SCIENTIFIC | PF_LOWERCASE, 2, TM_OK, "0.00e+00");
+
+    // General notation, like printf %g with PF_SHORTEST and %#g without.
+    const uint32_t general = PF_FIXED | PF_SCIENTIFIC | PF_LOWERCASE;
+    check_float_printing(print_double, buffer, 512, 0.00001, general | PF_SHORTEST, 6, TM_OK, "1e-05");
+    check_float_printing(print_double, buffer, 512, 0.0001, general | PF_SHORTEST, 6, TM_OK, "0.0001");
+    check_float_printing(print_double, buffer, 512, 123456789.0, general | PF_SHORTEST, 6, TM_OK, "1.23457e+08");
+    check_float_printing(print_double, buffer, 512, 0.1, general | PF_SHORTEST, 3, TM_OK, "0.1");
+    check_float_printing(print_double, buffer, 512, 0.1, general, 3, TM_OK, "0.100");
+
+    // Output that doesn't fit.
+    CHECK(print_double(buffer, 5, 1.5, 0, 4).ec == TM_EOVERFLOW);
+    CHECK(print_double(buffer, 7, 1.5, 0, 4).ec == TM_OK);
+    CHECK(print_double(buffer, 9, 1.5, PF_SCIENTIFIC, 4).ec == TM_EOVERFLOW);
+    CHECK(print_double(buffer, 10, 1.5, PF_SCIENTIFIC, 4).ec == TM_OK);
+}
+
+TEST_CASE("Test float printing shortest") {
+    char buffer[512];
+    check_float_printing(print_double, buffer, 512, 0.1, 0, -1, TM_OK, "0.1");
+    check_float_printing(print_double, buffer, 512, 0.3, 0, -1, TM_OK, "0.3");
+    check_float_printing(print_double, buffer, 512, 1.0 / 3.0, 0, -1, TM_OK, "0.3333333333333333");
+    check_float_printing(print_double, buffer, 512, 2e-7, 0, -1, TM_OK, "0.0000002");
+    check_float_printing(print_double, buffer, 512, 100.0, PF_TRAILING_ZEROES, -1, TM_OK, "100.0");
+    check_float_printing(print_double, buffer, 512, 9007199254740993.0, 0, -1, TM_OK, "9007199254740992");
+    check_float_printing(print_float, buffer, 512, 0.1f, 0, -1, TM_OK, "0.1");
+    check_float_printing(print_float, buffer, 512, 1.0f / 3.0f, 0, -1, TM_OK, "0.33333334");
+
+    // Big integers print their exact value in fixed notation, since every representation has the same length.
+    check_float_printing(print_double, buffer, 512, 1e23, 0, -1, TM_OK, "99999999999999991611392");
+    check_float_printing(print_double, buffer, 512, 1e23, PF_SCIENTIFIC, -1, TM_OK, "1E+23");
+
+    const uint32_t scientific = PF_SCIENTIFIC | PF_LOWERCASE;
+    check_float_printing(print_double, buffer, 512, 5e-324, scientific, -1, TM_OK, "5e-324");
+    check_float_printing(print_double, buffer, 512, 1.7976931348623157e308, scientific, -1, TM_OK,
+                         "1.7976931348623157e+308");
+    check_float_printing(print_double, buffer, 512, 2.2250738585072014e-308, scientific, -1, TM_OK,
+                         "2.2250738585072014e-308");
+    check_float_printing(print_float, buffer, 512, 3.4028235e38f, scientific, -1, TM_OK, "3.4028235e+38");
+    check_float_printing(print_float, buffer, 512, 1.17549435e-38f, scientific, -1, TM_OK, "1.1754944e-38");
+    check_float_printing(print_float, buffer, 512, 1e-45f, scientific, -1, TM_OK, "1e-45");
+
+    const uint32_t general = PF_FIXED | PF_SCIENTIFIC | PF_LOWERCASE;
+    check_float_printing(print_double, buffer, 512, 123456.0, general, -1, TM_OK, "123456");
+    check_float_printing(print_double, buffer, 512, 1234567.0, general, -1, TM_OK, "1.234567e+06");
+    check_float_printing(print_double, buffer, 512, 0.0001234, general, -1, TM_OK, "0.0001234");
+    check_float_printing(print_double, buffer, 512, 0.00001234, general, -1, TM_OK, "1.234e-05");
+}
+
+TEST_CASE("Test double printing roundtrip") {
+    // Shortest output of random doubles scans back to the same value, one digit less does not.
+    // Output with a precision agrees with snprintf, which is correctly rounded.
+    uint64_t state = 0x853C49E6748FEA9Bull;
+    auto next = [&state]() {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    };
+    for (int i = 0; i < 100000; ++i) {
+        uint64_t bits = next();
+        double value = 0;
+        memcpy(&value, &bits, sizeof(value));
+        if (!std::isfinite(value)) continue;
+
+        char buffer[1100];
+        auto result = print_double(buffer, sizeof(buffer), value, PF_SIGNBIT | PF_SCIENTIFIC, -1);
+        CAPTURE(std::string(buffer, result.size));
+        REQUIRE(result.ec == TM_OK);
+        double scanned = 0;
+        REQUIRE(scan_double_n(buffer, result.size, &scanned, 0).ec == TM_OK);
+        REQUIRE(memcmp(&scanned, &value, sizeof(value)) == 0);
+
+        int digits = (int)(strchr(buffer, 'E') - buffer) - (value < 0) - 1;
+        if (digits > 2) {
+            char shorter[64];
+            snprintf(shorter, sizeof(shorter), "%.*e", digits - 3, value);
+            CHECK(strtod(shorter, nullptr) != value);
+        }
+
+        result = print_double(buffer, sizeof(buffer), value, PF_SIGNBIT, -1);
+        REQUIRE(result.ec == TM_OK);
+        REQUIRE(scan_double_n(buffer, result.size, &scanned, 0).ec == TM_OK);
+        REQUIRE(memcmp(&scanned, &value, sizeof(value)) == 0);
+
+        char expected[1100];
+        int precision = (int)(bits % 25);
+        int len = snprintf(expected, sizeof(expected), "%.*e", precision, value);
+        result = print_double(buffer, sizeof(buffer), value, PF_SIGNBIT | PF_SCIENTIFIC | PF_LOWERCASE, precision);
+        CHECK(std::string(buffer, result.size) == std::string(expected, len));
+
+        len = snprintf(expected, sizeof(expected), "%.*f", precision, value);
+        result = print_double(buffer, sizeof(buffer), value, PF_SIGNBIT, precision);
+        CHECK(std::string(buffer, result.size) == std::string(expected, len));
+    }
+}
+
+TEST_CASE("Test float printing exhaustive") {
+    // Every finite float survives the roundtrip through its shortest representation.
+    uint64_t mismatches = 0;
+    for (uint64_t i = 0; i <= UINT32_MAX; ++i) {
+        uint32_t bits = (uint32_t)i;
+        float value = 0;
+        memcpy(&value, &bits, sizeof(value));
+        if (!std::isfinite(value)) continue;
+
+        char buffer[64];
+        auto result = print_float(buffer, 64, value, PF_SIGNBIT, -1);
+        float scanned = 0;
+        auto scan_result = scan_float_n(buffer, result.size, &scanned, 0);
+        if (result.ec != TM_OK || scan_result.ec != TM_OK || memcmp(&scanned, &value, sizeof(value)) != 0) {
+            ++mismatches;
+        }
+    }
+    CHECK(mismatches == 0);
+}
+
+template <class T, class ScanFunc>
+void check_float_scanning(ScanFunc f, const char* str, uint32_t flags, tm_errc expected_ec, tm_size_t expected_size,
+                          T expected_value) {
+    CAPTURE(str);
+    T value = 12345;
+    auto result = f(str, (tm_size_t)strlen(str), &value, flags);
+    CHECK(result.ec == expected_ec);
+    CHECK(result.size == expected_size);
+    if (result.ec == TM_OK) {
+        CHECK(value == expected_value);
+        CHECK(std::signbit(value) == std::signbit(expected_value));
+    } else {
+        CHECK(value == 12345);
+    }
+}
+
+TEST_CASE("Test float scanning") {
+    // Hard cases for correct rounding, values are checked against the compilers conversion of the same literals.
+    check_float_scanning(scan_double_n, "-0", 0, TM_OK, 2, -0.0);
+    check_float_scanning(scan_double_n, "0.1", 0, TM_OK, 3, 0.1);
+    check_float_scanning(scan_double_n, "1e23", 0, TM_OK, 4, 1e23);
+    check_float_scanning(scan_double_n, "9007199254740993", 0, TM_OK, 16, 9007199254740992.0);
+    check_float_scanning(scan_double_n, "9007199254740993.0000000000000000001", 0, TM_OK, 36, 9007199254740994.0);
+    check_float_scanning(scan_double_n, "2.2250738585072011e-308", 0, TM_OK, 23, 2.2250738585072011e-308);
+    check_float_scanning(scan_double_n, "2.2250738585072012e-308", 0, TM_OK, 23, 2.2250738585072012e-308);
+    check_float_scanning(scan_double_n, "4.9406564584124654e-324", 0, TM_OK, 23, 4.9406564584124654e-324);
+    check_float_scanning(scan_double_n, "2.4703282292062328e-324", 0, TM_OK, 23, 4.9406564584124654e-324);
+    check_float_scanning(scan_double_n, "1.7976931348623158e308", 0, TM_OK, 22, 1.7976931348623157e308);
+    check_float_scanning(scan_double_n, "123456789012345678901234567890", 0, TM_OK, 30,
+                         123456789012345678901234567890.0);
+    check_float_scanning(scan_float_n, "1.00000005960464477539062499", 0, TM_OK, 28, 1.0f);
+    check_float_scanning(scan_float_n, "1.000000059604644775390625", 0, TM_OK, 26, 1.0f);
+    check_float_scanning(scan_float_n, "1.00000005960464477539062501", 0, TM_OK, 28, 1.00000012f);
+    check_float_scanning(scan_float_n, "1e-45", 0, TM_OK, 5, 1e-45f);
+    check_float_scanning(scan_float_n, "3.4028235e38", 0, TM_OK, 12, 3.4028235e38f);
+
+    // Exactly halfway between 1 and the next double, the digits after the 768th digit decide the rounding.
+    std::string halfway = "1.00000000000000011102230246251565404236316680908203125";
+    check_float_scanning(scan_double_n, halfway.c_str(), 0, TM_OK, (tm_size_t)halfway.size(), 1.0);
+    halfway += std::string(800, '0');
+    check_float_scanning(scan_double_n, halfway.c_str(), 0, TM_OK, (tm_size_t)halfway.size(), 1.0);
+    halfway += '1';
+    check_float_scanning(scan_double_n, halfway.c_str(), 0, TM_OK, (tm_size_t)halfway.size(), 1.0000000000000002);
+
+    // Syntax.
+    check_float_scanning(scan_double_n, ".5", 0, TM_OK, 2, 0.5);
+    check_float_scanning(scan_double_n, "5.", 0, TM_OK, 2, 5.0);
+    check_float_scanning(scan_double_n, "1e", 0, TM_OK, 1, 1.0);
+    check_float_scanning(scan_double_n, "1e+", 0, TM_OK, 1, 1.0);
+    check_float_scanning(scan_double_n, "1E+2x", 0, TM_OK, 4, 100.0);
+    check_float_scanning(scan_double_n, "0e999999999999", 0, TM_OK, 14, 0.0);
+    check_float_scanning(scan_double_n, ".", 0, TM_EINVAL, 0, 0.0);
+    check_float_scanning(scan_double_n, "-", 0, TM_EINVAL, 0, 0.0);
+    check_float_scanning(scan_double_n, "+1", 0, TM_EINVAL, 0, 0.0);
+    check_float_scanning(scan_double_n, "e5", 0, TM_EINVAL, 0, 0.0);
+
+    // Range errors.
+    check_float_scanning(scan_double_n, "1e309", 0, TM_ERANGE, 5, 0.0);
+    check_float_scanning(scan_double_n, "-1e999999999999", 0, TM_ERANGE, 15, 0.0);
+    check_float_scanning(scan_double_n, "2.4703282292062327e-324", 0, TM_ERANGE, 23, 0.0);
+    check_float_scanning(scan_float_n, "3.5e38", 0, TM_ERANGE, 6, 0.0f);
+    check_float_scanning(scan_float_n, "1e-46", 0, TM_ERANGE, 5, 0.0f);
+}
+
+TEST_CASE("Test float scanning flags") {
+    // Exponent is ignored with PF_FIXED and required with PF_SCIENTIFIC.
+    check_float_scanning(scan_double_n, "1.5e3", PF_FIXED, TM_OK, 3, 1.5);
+    check_float_scanning(scan_double_n, "1.5e3", PF_SCIENTIFIC, TM_OK, 5, 1500.0);
+    check_float_scanning(scan_double_n, "1.5", PF_SCIENTIFIC, TM_EINVAL, 0, 0.0);
+    check_float_scanning(scan_double_n, "1.5e", PF_SCIENTIFIC, TM_EINVAL, 0, 0.0);
+    check_float_scanning(scan_double_n, "1.5", PF_FIXED | PF_SCIENTIFIC, TM_OK, 3, 1.5);
+    check_float_scanning(scan_double_n, "1.5e3", PF_FIXED | PF_SCIENTIFIC, TM_OK, 5, 1500.0);
+
+    // Hexadecimal floats without prefix, exponent is binary.
+    check_float_scanning(scan_double_n, "1p4", PF_HEX, TM_OK, 3, 16.0);
+    check_float_scanning(scan_double_n, "-A.Bp-3", PF_HEX, TM_OK, 7, -0x1.5600000000000p+0);
+    check_float_scanning(scan_double_n, "1.fffffffffffffp1023", PF_HEX, TM_OK, 20, 1.7976931348623157e308);
+    check_float_scanning(scan_double_n, "1.fffffffffffff8p1023", PF_HEX, TM_ERANGE, 21, 0.0);
+    check_float_scanning(scan_double_n, "1p-1074", PF_HEX, TM_OK, 7, 4.9406564584124654e-324);
+    check_float_scanning(scan_double_n, "1p-1075", PF_HEX, TM_ERANGE, 7, 0.0);
+    check_float_scanning(scan_double_n, "1.000000000000000000001p-1075", PF_HEX, TM_OK, 29, 4.9406564584124654e-324);
+    check_float_scanning(scan_double_n, "0.00000000000000000000000001p1", PF_HEX, TM_OK, 30, 0x1p-103);
+    check_float_scanning(scan_double_n, "0x1p4", PF_HEX, TM_OK, 1, 0.0);
+    check_float_scanning(scan_float_n, "1.000001p0", PF_HEX, TM_OK, 10, 1.0f);
+    check_float_scanning(scan_float_n, "1.000003p0", PF_HEX, TM_OK, 10, 1.00000024f);
+    check_float_scanning(scan_float_n, "1.fffffffp0", PF_HEX, TM_OK, 11, 2.0f);
+    check_float_scanning(scan_float_n, "1.5p", PF_HEX | PF_SCIENTIFIC, TM_EINVAL, 0, 0.0f);
+}
+
+TEST_CASE("Test double scanning roundtrip") {
+    // Shortest roundtrip representations, random digits and the nullterminated variant agree with strtod.
+    uint64_t state = 0x9E3779B97F4A7C15ull;
+    auto next = [&state]() {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    };
+    for (int i = 0; i < 100000; ++i) {
+        char buffer[64];
+        uint64_t bits = next() & 0x7FFFFFFFFFFFFFFFull;
+        double value = 0;
+        memcpy(&value, &bits, sizeof(value));
+        if (!std::isfinite(value)) continue;
+        int len = snprintf(buffer, sizeof(buffer), "%.*g", (int)(bits % 17) + 1, value);
+        double expected = strtod(buffer, nullptr);
+
+        double scanned = 0;
+        auto result = scan_double_n(buffer, (tm_size_t)len, &scanned, 0);
+        if ((expected == 0 && value != 0) || std::isinf(expected)) {
+            // Printed with too little precision and underflowed or overflowed.
+            CHECK(result.ec == TM_ERANGE);
+            continue;
+        }
+        CAPTURE(buffer);
+        REQUIRE(result.ec == TM_OK);
+        REQUIRE(result.size == (tm_size_t)len);
+        REQUIRE(scanned == expected);
+
+        double scanned_nullterminated = 0;
+        REQUIRE(scan_double(buffer, &scanned_nullterminated, 0).size == (tm_size_t)len);
+        REQUIRE(scanned_nullterminated == expected);
+    }
+}
+
 TEST_CASE("Test print_hex_bytes") {
     char buffer[512];
     uint8_t bytes[256] = {
@@ -698,4 +1168,54 @@ TEST_CASE("Test print_hex_bytes") {
     CHECK(print_hex_bytes(buffer, 512, bytes, 256, true).ec == TM_OK);
     CHECK(print_hex_bytes(buffer, 512, bytes, 256, true).size == 512);
     CHECK(memcmp(buffer, expected, 512) == 0);
+}
+
+TEST_CASE("Test scan_hex_bytes") {
+    uint8_t bytes[256];
+    for (int i = 0; i < 256; ++i) bytes[i] = (uint8_t)i;
+    char buffer[512];
+    uint8_t scanned[256];
+
+    SUBCASE("Roundtrip") {
+        // Sizes that are not a multiple of the 16 characters scanned at once go through the tail loop.
+        for (tm_size_t size = 0; size <= 256; ++size) {
+            for (tm_bool lowercase : {false, true}) {
+                auto printed = print_hex_bytes(buffer, 512, bytes + 256 - size, size, lowercase);
+                REQUIRE(printed.ec == TM_OK);
+                auto result = scan_hex_bytes(buffer, printed.size, scanned, 256);
+                REQUIRE(result.ec == TM_OK);
+                REQUIRE(result.size == printed.size);
+                REQUIRE(memcmp(scanned, bytes + 256 - size, size) == 0);
+            }
+        }
+        auto result = scan_hex_bytes("00fFaB9c", 8, scanned, 4);
+        CHECK(result.ec == TM_OK);
+        CHECK(scanned[0] == 0x00);
+        CHECK(scanned[1] == 0xFF);
+        CHECK(scanned[2] == 0xAB);
+        CHECK(scanned[3] == 0x9C);
+    }
+    SUBCASE("Error offsets") {
+        // Characters just outside of the digit and letter ranges, at every offset of a 40 character string.
+        for (char invalid : {'/', ':', '@', 'G', '`', 'g', ' ', '\0', (char)0xB0, (char)0xC1}) {
+            for (tm_size_t offset = 0; offset < 40; ++offset) {
+                memset(buffer, 'a', 40);
+                buffer[offset] = invalid;
+                auto result = scan_hex_bytes(buffer, 40, scanned, 20);
+                CHECK(result.ec == TM_EINVAL);
+                CHECK(result.size == offset);
+            }
+        }
+        auto result = scan_hex_bytes("0123456789abcdef0", 17, scanned, 8);
+        CHECK(result.ec == TM_EINVAL);
+        CHECK(result.size == 16);
+        CHECK(memcmp(scanned, "\x01\x23\x45\x67\x89\xab\xcd\xef", 8) == 0);
+    }
+    SUBCASE("Invariants") {
+        CHECK(scan_hex_bytes("", 0, nullptr, 0).ec == TM_OK);
+        CHECK(scan_hex_bytes("abcd", 4, scanned, 1).ec == TM_EOVERFLOW);
+        CHECK(scan_hex_bytes("abcd", 4, scanned, 2).ec == TM_OK);
+        CHECK_ASSERTION_FAILURE(scan_hex_bytes(nullptr, 2, scanned, 1));
+        CHECK_ASSERTION_FAILURE(scan_hex_bytes("ab", 2, nullptr, 1));
+    }
 }
\ No newline at end of file
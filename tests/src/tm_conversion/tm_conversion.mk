@@ -8,7 +8,7 @@ ${tests.tm_conversion.out}: tests/src/tm_conversion/main.cpp tm_conversion.h
 tests.tm_conversion: ${tests.tm_conversion.out} ${tests.tm_conversion.c.out}
 
 tests.tm_conversion.out.fast := ${tests.tm_conversion.out} \
-                                --test-case-exclude="Test float roundtrip,Test float accuracy"
+                                --test-case-exclude="Test float roundtrip,Test float accuracy,Test float printing exhaustive"
 ifeq (${os},windows)
 	# cmd doesn't seem to like forward slashes on commands with arguments
 	tests.tm_conversion.out.fast := $(subst /,\,${tests.tm_conversion.out.fast})
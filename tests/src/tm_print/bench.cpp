@@ -0,0 +1,248 @@
+// Benchmarks tm_print against snprintf and std::to_chars.
+// Compiled once per backend configuration, see bench.tm_print in tests/src/tm_print/tm_print.mk.
+// Every case is run over the same pseudo random values, the fastest of a few runs is reported.
+
+#define TM_CONVERSION_IMPLEMENTATION
+#define TM_PRINT_IMPLEMENTATION
+#define TMP_USE_STL
+#include <tm_print.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cinttypes>
+#include <string>
+#include <vector>
+
+#ifdef TMP_BENCH_CHARCONV
+#include <charconv>
+#endif
+
+#if defined(TMP_INT_BACKEND_CRT)
+#define TMP_BENCH_INT_BACKEND "crt"
+#elif defined(TMP_INT_BACKEND_TM_CONVERSION)
+#define TMP_BENCH_INT_BACKEND "tm_conversion"
+#elif defined(TMP_INT_BACKEND_CHARCONV)
+#define TMP_BENCH_INT_BACKEND "charconv"
+#endif
+
+#if defined(TMP_FLOAT_BACKEND_CRT)
+#define TMP_BENCH_FLOAT_BACKEND "crt"
+#elif defined(TMP_FLOAT_BACKEND_TM_CONVERSION)
+#define TMP_BENCH_FLOAT_BACKEND "tm_conversion"
+#elif defined(TMP_FLOAT_BACKEND_CHARCONV)
+#define TMP_BENCH_FLOAT_BACKEND "charconv"
+#elif defined(TMP_FLOAT_BACKEND_BUILTIN)
+#define TMP_BENCH_FLOAT_BACKEND "builtin"
+#endif
+
+namespace {
+
+const size_t values_count = 100000;
+const int runs_count = 5;
+const size_t buffer_size = 128;
+
+// Keeps the optimizer from throwing away the printed output.
+volatile size_t bench_sink = 0;
+
+// Deterministic so that every configuration prints the exact same values.
+struct random_generator {
+    uint64_t state = 0x9E3779B97F4A7C15ull;
+
+    uint64_t next() {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+};
+
+std::vector<int32_t> make_int32_values() {
+    random_generator rng;
+    std::vector<int32_t> result(values_count);
+    for (auto& value : result) {
+        // Mix of small and large magnitudes, since digit count dominates integer printing.
+        uint64_t bits = rng.next();
+        value = (int32_t)(bits >> (32 + (bits & 31)));
+        if (bits & 0x100) value = -value;
+    }
+    return result;
+}
+
+std::vector<uint64_t> make_uint64_values() {
+    random_generator rng;
+    std::vector<uint64_t> result(values_count);
+    for (auto& value : result) {
+        uint64_t bits = rng.next();
+        value = bits >> (bits & 63);
+    }
+    return result;
+}
+
+std::vector<double> make_double_values() {
+    random_generator rng;
+    std::vector<double> result(values_count);
+    for (auto& value : result) {
+        uint64_t bits = rng.next();
+        // Magnitudes between 1e-3 and 1e+9, large enough to need more than one digit run, small enough for %f.
+        value = (double)(bits >> 11) / (double)(1ull << 53) * 1000.0;
+        switch (bits & 3) {
+            case 0: value *= 1e-5; break;
+            case 1: value *= 1e+6; break;
+            default: break;
+        }
+        if (bits & 4) value = -value;
+    }
+    return result;
+}
+
+struct bench_result {
+    double ns_per_call;
+    double bytes_per_second;
+};
+
+template <class T, class Func>
+bench_result run_bench(const std::vector<T>& values, Func&& func) {
+    double best_ns = 0;
+    size_t bytes = 0;
+    for (int run = 0; run < runs_count; ++run) {
+        size_t run_bytes = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (const T& value : values) run_bytes += func(value);
+        auto end = std::chrono::steady_clock::now();
+        double ns = std::chrono::duration<double, std::nano>(end - start).count();
+        if (run == 0 || ns < best_ns) best_ns = ns;
+        bytes = run_bytes;
+    }
+    bench_sink = bench_sink + bytes;
+    return {best_ns / (double)values.size(), (double)bytes / (best_ns * 1e-9)};
+}
+
+void print_result(const char* case_name, const char* method, const bench_result& result) {
+    printf("%-22s %-16s %10.1f ns/call %10.1f MB/s\n", case_name, method, result.ns_per_call,
+           result.bytes_per_second / (1024.0 * 1024.0));
+}
+
+#ifdef TMP_BENCH_CHARCONV
+template <class T>
+size_t to_chars_baseline(char* buffer, T value) {
+    return (size_t)(std::to_chars(buffer, buffer + buffer_size, value).ptr - buffer);
+}
+#endif
+
+#ifdef TMP_BENCH_CHARCONV_FLOAT
+struct to_chars_float_format {
+    std::chars_format format;
+    int precision;
+};
+
+size_t to_chars_baseline(char* buffer, double value, const to_chars_float_format& format) {
+    auto result = (format.precision < 0)
+                      ? std::to_chars(buffer, buffer + buffer_size, value, format.format)
+                      : std::to_chars(buffer, buffer + buffer_size, value, format.format, format.precision);
+    return (size_t)(result.ptr - buffer);
+}
+#endif
+
+/*
+Runs one entry of the benchmark matrix.
+Params:
+    tm_format:     Format string passed to tm_print.
+    printf_format: Equivalent format string for the snprintf baseline, nullptr if there is no equivalent.
+    to_chars:      Callable for the std::to_chars baseline, no_to_chars if std::to_chars can't produce the same output.
+*/
+template <class T, class ToChars>
+void bench_case(const char* case_name, const char* tm_format, const char* printf_format, const std::vector<T>& values,
+                FILE* file, ToChars to_chars) {
+    char buffer[buffer_size];
+    bench_result snprint_result = run_bench(values, [&](const T& value) {
+        return (size_t)tml::snprint(buffer, (tm_size_t)buffer_size, tm_format, value);
+    });
+    print_result(case_name, "snprint", snprint_result);
+    print_result(case_name, "string_format", run_bench(values, [&](const T& value) {
+                     return tml::string_format(tm_format, value).size();
+                 }));
+    if (file) {
+        // FILE printing doesn't report the amount of bytes written, the output is the same as that of snprint.
+        bench_result result = run_bench(values, [&](const T& value) {
+            tml::print(file, tm_format, value);
+            return (size_t)0;
+        });
+        result.bytes_per_second = snprint_result.bytes_per_second * (snprint_result.ns_per_call / result.ns_per_call);
+        print_result(case_name, "print(FILE*)", result);
+    }
+    if (printf_format) {
+        print_result(case_name, "snprintf", run_bench(values, [&](const T& value) {
+                         return (size_t)snprintf(buffer, buffer_size, printf_format, value);
+                     }));
+    }
+    to_chars(case_name, values, buffer);
+}
+
+struct no_to_chars {
+    template <class T>
+    void operator()(const char*, const std::vector<T>&, char*) const {}
+};
+
+#ifdef TMP_BENCH_CHARCONV
+struct int_to_chars {
+    template <class T>
+    void operator()(const char* case_name, const std::vector<T>& values, char* buffer) const {
+        print_result(case_name, "to_chars",
+                     run_bench(values, [&](const T& value) { return to_chars_baseline(buffer, value); }));
+    }
+};
+#else
+typedef no_to_chars int_to_chars;
+#endif
+
+#ifdef TMP_BENCH_CHARCONV_FLOAT
+struct float_to_chars {
+    to_chars_float_format format;
+
+    void operator()(const char* case_name, const std::vector<double>& values, char* buffer) const {
+        print_result(case_name, "to_chars", run_bench(values, [&](const double& value) {
+                         return to_chars_baseline(buffer, value, format);
+                     }));
+    }
+};
+#define TMP_BENCH_FLOAT_TO_CHARS(format, precision) \
+    float_to_chars { {std::chars_format::format, precision} }
+#else
+#define TMP_BENCH_FLOAT_TO_CHARS(format, precision) \
+    no_to_chars {}
+#endif
+
+}  // namespace
+
+int main() {
+    printf("int backend: %s, float backend: %s\n", TMP_BENCH_INT_BACKEND, TMP_BENCH_FLOAT_BACKEND);
+
+    // Output of FILE printing is thrown away, only the formatting and stdio overhead is measured.
+#ifdef _WIN32
+    FILE* file = fopen("NUL", "wb");
+#else
+    FILE* file = fopen("/dev/null", "wb");
+#endif
+    if (!file) printf("Could not open null device, skipping FILE printing.\n");
+
+    auto int32_values = make_int32_values();
+    auto uint64_values = make_uint64_values();
+    auto double_values = make_double_values();
+
+    bench_case("int32", "{}", "%d", int32_values, file, int_to_chars{});
+    bench_case("int32 width 12", "{:12}", "%12d", int32_values, file, no_to_chars{});
+    bench_case("int32 hex", "{:x}", "%x", int32_values, file, no_to_chars{});
+    bench_case("uint64", "{}", "%" PRIu64, uint64_values, file, int_to_chars{});
+    bench_case("uint64 width 24", "{:024}", "%024" PRIu64, uint64_values, file, no_to_chars{});
+    bench_case("uint64 hex", "{:x}", "%" PRIx64, uint64_values, file, no_to_chars{});
+    bench_case("double", "{}", "%f", double_values, file, TMP_BENCH_FLOAT_TO_CHARS(fixed, 6));
+    bench_case("double .2f", "{:.2f}", "%.2f", double_values, file, TMP_BENCH_FLOAT_TO_CHARS(fixed, 2));
+    bench_case("double .17e", "{:.17e}", "%.17e", double_values, file, TMP_BENCH_FLOAT_TO_CHARS(scientific, 17));
+    bench_case("double width 16.3", "{:16.3}", "%16.3f", double_values, file, no_to_chars{});
+    bench_case("double g", "{:g}", "%g", double_values, file, TMP_BENCH_FLOAT_TO_CHARS(general, 6));
+    bench_case("double a", "{:a}", "%a", double_values, file, TMP_BENCH_FLOAT_TO_CHARS(hex, -1));
+
+    if (file) fclose(file);
+    return (int)(bench_sink & 0);
+}
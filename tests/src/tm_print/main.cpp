@@ -11,6 +11,22 @@
 typedef int tm_size_t;
 #endif  // defined(SIGNED_SIZE_T)
 
+#include <cstdlib>
+
+// Count allocations, so that tests can check that printing doesn't allocate unnecessarily.
+static int allocation_count = 0;
+static void* counting_malloc(size_t size) {
+    ++allocation_count;
+    return malloc(size);
+}
+static void* counting_realloc(void* ptr, size_t new_size) {
+    ++allocation_count;
+    return realloc(ptr, new_size);
+}
+#define TM_MALLOC(size, alignment) counting_malloc((size))
+#define TM_REALLOC(ptr, new_size, new_alignment) counting_realloc((ptr), (new_size))
+#define TM_FREE(ptr) free((ptr))
+
 #define TM_CONVERSION_IMPLEMENTATION
 #define TM_PRINT_IMPLEMENTATION
 #define TMP_CUSTOM_PRINTING
@@ -18,6 +34,9 @@ typedef int tm_size_t;
 #include <tm_print.h>
 
 #include <string_view>
+#include <limits>
+#include <cstdlib>
+#include <cstring>
 
 template <class... Args>
 void check_output(const char* format, const char* expected_string, const Args&... args) {
@@ -68,6 +87,12 @@ TEST_CASE("Test basic printing") {
 TEST_CASE("Test arguments count") {
     // Zero arguments
     check_output("test", "test");
+
+    // More arguments than fit into PrintArgList::flags.
+    check_output("{}{}{}{}{}{}{}{}{}{}{}{}{}{}{}{}|{}|{:.1f}", "0123456789012345|str|1.5", 0, 1, 2, 3, 4, 5, 6, 7, 8,
+                 9, 0, 1, 2, 3, 4, 5, "str", 1.5);
+    check_output("{17:.1f} {16} {0}", "1.5 str 0", 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, "str", 1.5);
+    expect_error("{18}", 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, "str", 1.5);
 }
 
 TEST_CASE("Test format validation") {
@@ -220,6 +245,74 @@ TEST_CASE("Test float scientific format specifiers" * doctest::may_fail(true)) {
     check_output("{:#A}", "0X1.000000P+0", 1.0);
 }
 
+#ifdef TMP_FLOAT_BACKEND_BUILTIN
+TEST_CASE("Test builtin float backend") {
+    // Exact values are rounded half to even.
+    check_output("{:.2f}", "0.12", 0.125);
+    check_output("{:.0f}", "2", 2.5);
+    check_output("{:.0f}", "4", 3.5);
+    check_output("{:.0f}", "1", 0.5000000000000001);
+    check_output("{:.2e}", "1.12e+00", 1.125);
+
+    // Correct rounding beyond 17 significant digits.
+    check_output("{:.20f}", "0.10000000000000000555", 0.1);
+    check_output("{:.17g}", "0.10000000000000001", 0.1);
+    check_output("{:f}", "100000000000000000000.000000", 1e20);
+    check_output("{:.3e}", "9.999e+22", 1e23 * 0.9999);
+    check_output("{:.1e}", "4.9e-324", 4.9406564584124654e-324);
+    check_output("{:.10f}", "0.1000000015", 0.1f);
+
+    check_output("{:e}", "1.000000e+00", 1.0);
+    check_output("{:E}", "1.000000E+00", 1.0);
+    check_output("{:g}", "1e-05", 0.00001);
+    check_output("{:g}", "0.0001", 0.0001);
+    check_output("{:g}", "1.23457e+08", 123456789.0);
+    check_output("{:.3g}", "0.1", 0.1);
+    check_output("{:a}", "1.000000p+0", 1.0);
+    check_output("{:.0a}", "2p+0", 1.5);
+    check_output("{:#A}", "0X1.000000P+0", 1.0);
+
+    check_output("{}", "inf", std::numeric_limits<double>::infinity());
+    check_output("{:E}", "INF", std::numeric_limits<double>::infinity());
+    check_output("{}", "nan", std::numeric_limits<double>::quiet_NaN());
+
+    // A negative precision prints the shortest representation that round trips.
+    auto shortest = [](auto value) {
+        tml::PrintFormat format = tml::default_print_format();
+        format.precision = -1;
+        format.flags = tml::PrintFlags::General | tml::PrintFlags::Lowercase;
+        char buffer[50];
+        int size = tml::snprint(buffer, 50, "{}", format, value);
+        return std::string(buffer, (size >= 0 && size < 50) ? (size_t)size : 0);
+    };
+    CHECK(shortest(0.0) == "0");
+    CHECK(shortest(1.0) == "1");
+    CHECK(shortest(0.1) == "0.1");
+    CHECK(shortest(0.1f) == "0.1");
+    CHECK(shortest(1.0 / 3.0) == "0.3333333333333333");
+    CHECK(shortest(1.0f / 3.0f) == "0.33333334");
+    CHECK(shortest(123456.0) == "123456");
+    CHECK(shortest(1e23) == "1e+23");
+    CHECK(shortest(5e-324) == "5e-324");
+    CHECK(shortest(1.7976931348623157e308) == "1.7976931348623157e+308");
+    CHECK(shortest(2.2250738585072014e-308) == "2.2250738585072014e-308");
+
+    // Shortest output round trips.
+    uint64_t state = 0x853C49E6748FEA9Bull;
+    for (int i = 0; i < 10000; ++i) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        uint64_t bits = state;
+        double value = 0;
+        memcpy(&value, &bits, sizeof(double));
+        if (value != value || value - value != 0) continue;
+
+        auto str = shortest(value);
+        CAPTURE(str);
+        CHECK(strtod(str.c_str(), nullptr) == value);
+    }
+}
+#endif  // defined(TMP_FLOAT_BACKEND_BUILTIN)
+
 TEST_CASE("Test width") {
     check_output("{:10}", "         1", 1);
     check_output("{:10}", "        -1", -1);
@@ -279,6 +372,373 @@ TEST_CASE("Test indexed") {
     check_output("{1} {} {}", "2 1 2", 1, 2);
 }
 
+TEST_CASE("Test output sinks") {
+    SUBCASE("buffer sink") {
+        char buffer[8];
+        auto sink = tml::tmp_make_buffer_sink(buffer, 8);
+        CHECK(tml::print(&sink, "{}-{}", 1, 2) == TM_OK);
+        CHECK(tml::print(&sink, "{}", 345) == TM_OK);
+        CHECK(std::string_view(sink.data, (size_t)sink.size) == "1-2345");
+
+        // Output that doesn't fit leaves the sink unchanged.
+        CHECK(tml::print(&sink, "{}{}", 6, 789) == TM_ERANGE);
+        CHECK(std::string_view(sink.data, (size_t)sink.size) == "1-2345");
+        CHECK(tml::print(&sink, "{:x}", 0xa) == TM_OK);
+        CHECK(std::string_view(sink.data, (size_t)sink.size) == "1-2345a");
+
+        // Formatting errors too.
+        sink.size = 0;
+        CHECK(tml::print(&sink, "a{}{}", 1) == TM_EINVAL);
+        CHECK(sink.size == 0);
+    }
+    SUBCASE("growable sink") {
+        auto sink = tml::tmp_make_growable_sink();
+        std::string expected;
+        for (int i = 0; i < 1000; ++i) {
+            REQUIRE(tml::print(&sink, "{} {:.2f} {}\n", i, i * 0.5, "row") == TM_OK);
+            expected += tml::string_format("{} {:.2f} {}\n", i, i * 0.5, "row");
+        }
+        CHECK(std::string_view(sink.data, (size_t)sink.size) == expected);
+        tml::tmp_destroy_sink(&sink);
+        CHECK(sink.data == nullptr);
+    }
+    SUBCASE("writer sink") {
+        std::string output;
+        auto write = [](void* context, const char* data, tm_size_t size) -> tm_errc {
+            CHECK(size > 0);
+            static_cast<std::string*>(context)->append(data, (size_t)size);
+            return TM_OK;
+        };
+        char buffer[16];
+        auto sink = tml::tmp_make_writer_sink(buffer, 16, write, &output);
+
+        std::string expected;
+        std::string long_string(100, 'x');
+        for (int i = 0; i < 50; ++i) {
+            REQUIRE(tml::print(&sink, "{}:{:10} ", i, i) == TM_OK);
+            expected += tml::string_format("{}:{:10} ", i, i);
+            if (i % 10 == 0) {
+                // Literals, strings and padding that are bigger than the buffer.
+                REQUIRE(tml::print(&sink, "{}|{:-40}|", long_string.c_str(), 1.5) == TM_OK);
+                expected += tml::string_format("{}|{:-40}|", long_string.c_str(), 1.5);
+            }
+        }
+        // Output is only written when the buffer is full.
+        CHECK(output.size() + (size_t)sink.size == expected.size());
+        CHECK(tml::tmp_flush_sink(&sink) == TM_OK);
+        CHECK(sink.size == 0);
+        CHECK(output == expected);
+    }
+    SUBCASE("writer sink allocations") {
+        // Output that fits into the buffer of the sink is written out instead of being printed into an allocation.
+        std::string output;
+        auto write = [](void* context, const char* data, tm_size_t size) -> tm_errc {
+            static_cast<std::string*>(context)->append(data, (size_t)size);
+            return TM_OK;
+        };
+        char buffer[16];
+        auto sink = tml::tmp_make_writer_sink(buffer, 16, write, &output);
+
+        std::string expected;
+        for (int i = 0; i < 100; ++i) {
+            expected += tml::string_format("{}:{:6}|literal|{}", i, i * 1000u, "string");
+        }
+        int allocations_before = allocation_count;
+        for (int i = 0; i < 100; ++i) {
+            REQUIRE(tml::print(&sink, "{}:{:6}|literal|{}", i, i * 1000u, "string") == TM_OK);
+        }
+        CHECK(tml::tmp_flush_sink(&sink) == TM_OK);
+        CHECK(allocation_count == allocations_before);
+        CHECK(output == expected);
+    }
+    SUBCASE("writer sink error") {
+        auto write = [](void*, const char*, tm_size_t) -> tm_errc { return TM_EIO; };
+        char buffer[4];
+        auto sink = tml::tmp_make_writer_sink(buffer, 4, write, nullptr);
+        CHECK(tml::print(&sink, "{}", 12) == TM_OK);
+        CHECK(tml::print(&sink, "{}", 345) == TM_EIO);
+        CHECK(tml::tmp_flush_sink(&sink) == TM_EIO);
+    }
+    SUBCASE("file and fd sinks") {
+        FILE* file = tmpfile();
+        REQUIRE(file);
+        char buffer[64];
+        auto file_sink = tml::tmp_make_file_sink(file, buffer, 64);
+        CHECK(tml::print(&file_sink, "{} {}\n", "file", 1) == TM_OK);
+        CHECK(tml::tmp_flush_sink(&file_sink) == TM_OK);
+        fflush(file);
+
+        auto fd_sink = tml::tmp_make_fd_sink(fileno(file), buffer, 64);
+        CHECK(tml::print(&fd_sink, "{} {}\n", "fd", 2) == TM_OK);
+        CHECK(tml::tmp_flush_sink(&fd_sink) == TM_OK);
+
+        char contents[64] = {};
+        rewind(file);
+        auto read = fread(contents, 1, sizeof(contents), file);
+        fclose(file);
+        CHECK(std::string_view(contents, read) == "file 1\nfd 2\n");
+    }
+}
+
+TEST_CASE("Test output bigger than the small buffer") {
+    std::string long_string(1000, 'x');
+    const char* long_c_string = long_string.c_str();
+    std::string expected = "<" + long_string + "|" + std::string(290, ' ') + "12|" + long_string + ">";
+
+    // Estimated sizes that are too small, fitting and too big have to give the same output.
+    CHECK(tml::string_format("<{}|{:292}|{}>", long_c_string, 12, long_c_string) == expected);
+    CHECK(tml::string_format("{}", 12) == "12");
+    CHECK(tml::string_format("{:400}", 'a').size() == 400);
+    CHECK(tml::string_format("{0}{0}{0}{0}", long_c_string).size() == 4000);
+    CHECK(tml::string_format("{}{}", long_c_string, 1) == long_string + "1");
+
+    auto compiled = tml::compile_format<const char*, int, const char*>("<{}|{:292}|{}>");
+    REQUIRE(compiled.ec == TM_OK);
+    CHECK(tml::string_format(compiled.format, long_c_string, 12, long_c_string) == expected);
+
+    FILE* file = tmpfile();
+    REQUIRE(file);
+    for (int i = 0; i < 3; ++i) {
+        CHECK(tml::print(file, "<{}|{:292}|{}>", long_c_string, 12, long_c_string) == TM_OK);
+        CHECK(tml::print(file, compiled.format, long_c_string, 12, long_c_string) == TM_OK);
+    }
+    std::string contents(expected.size() * 6 + 1, 0);
+    rewind(file);
+    contents.resize(fread(&contents[0], 1, contents.size(), file));
+    fclose(file);
+    std::string expected_contents;
+    for (int i = 0; i < 6; ++i) expected_contents += expected;
+    CHECK(contents == expected_contents);
+
+    tml::tmp_destroy_compiled_format(&compiled.format);
+
+    // Errors don't leave partial output behind.
+    CHECK(tml::string_format("{}{", long_c_string).empty());
+}
+
+TEST_CASE("Test allocations of FILE* and std::string output") {
+    std::string long_string(1000, 'x');
+    const char* long_c_string = long_string.c_str();
+    FILE* file = tmpfile();
+    REQUIRE(file);
+
+    // Output that doesn't fit into the small buffer is sized up front, so a call allocates at most once as long as
+    // the estimate holds. Widths of runtime format strings aren't part of the estimate, those of compiled ones are.
+    auto compiled = tml::compile_format<const char*, int, const char*>("<{}|{:292}|{}>");
+    REQUIRE(compiled.ec == TM_OK);
+    int allocations_before = allocation_count;
+    CHECK(tml::print(file, "<{}|{}|{}>", long_c_string, 12, long_c_string) == TM_OK);
+    CHECK(allocation_count - allocations_before <= 1);
+    allocations_before = allocation_count;
+    CHECK(tml::print(file, compiled.format, long_c_string, 12, long_c_string) == TM_OK);
+    CHECK(allocation_count - allocations_before <= 1);
+
+#ifdef TMP_SCRATCH_ARENA
+    // The arena is kept between calls, so repeated printing doesn't allocate anymore.
+    allocations_before = allocation_count;
+    for (int i = 0; i < 10; ++i) {
+        CHECK(tml::print(file, "<{}|{:292}|{}>", long_c_string, 12, long_c_string) == TM_OK);
+        CHECK(tml::string_format("<{}|{}>", long_c_string, i).size() == 1004);
+        CHECK(tml::string_format("{}", i) == std::to_string(i));
+    }
+    CHECK(allocation_count == allocations_before);
+#endif  // defined(TMP_SCRATCH_ARENA)
+
+    tml::tmp_destroy_compiled_format(&compiled.format);
+    fclose(file);
+}
+
+TEST_CASE("Test compiled formats") {
+    // Compiled formats keep a copy of the format string.
+    std::string format_string = "{} {:x} {0:.1f} {{{}}}";
+    auto compiled = tml::compile_format<double, int, const char*>(format_string.c_str());
+    REQUIRE(compiled.ec == TM_OK);
+    format_string.assign(format_string.size(), '?');
+
+    char buffer[100];
+    for (int i = 0; i < 20; ++i) {
+        auto expected = tml::string_format("{} {:x} {0:.1f} {{{}}}", i * 0.5, i, "row");
+        auto size = tml::snprint(buffer, 100, compiled.format, i * 0.5, i, "row");
+        REQUIRE(size >= 0);
+        CHECK(std::string_view(buffer, (size_t)size) == expected);
+        CHECK(tml::string_format(compiled.format, i * 0.5, i, "row") == expected);
+    }
+    auto expected_size = tml::snprint(nullptr, 0, "{} {:x} {0:.1f} {{{}}}", 1.0, 255, "a");
+    CHECK(tml::snprint(nullptr, 0, compiled.format, 1.0, 255, "a") == expected_size);
+
+    // Arguments must have the types the format was compiled for.
+    CHECK(tml::snprint(buffer, 100, compiled.format, 1, 2, "row") < 0);
+    CHECK(tml::snprint(buffer, 100, compiled.format, 1.0, 2) < 0);
+    CHECK(tml::string_format(compiled.format, 1.0, 2, 3).empty());
+
+    char sink_buffer[32];
+    auto sink = tml::tmp_make_buffer_sink(sink_buffer, 32);
+    CHECK(tml::print(&sink, compiled.format, 2.0, 16, "sink") == TM_OK);
+    CHECK(std::string_view(sink.data, (size_t)sink.size) == tml::string_format("{} 10 2.0 {{sink}}", 2.0));
+
+    tml::tmp_destroy_compiled_format(&compiled.format);
+    CHECK(compiled.format.segments == nullptr);
+
+    // Validation happens when compiling.
+    CHECK(tml::compile_format<int>("{}{}").ec == TM_EINVAL);
+    CHECK(tml::compile_format<int>("{1}").ec == TM_EINVAL);
+    CHECK(tml::compile_format<double>("{:x}").ec == TM_EINVAL);
+    CHECK(tml::compile_format<int>("{").ec == TM_EINVAL);
+    CHECK(tml::compile_format<int>("}").ec == TM_EINVAL);
+
+    // More arguments than fit into PrintArgList::flags, types beyond that must match as well.
+    typedef int I;
+    auto many = tml::compile_format<I, I, I, I, I, I, I, I, I, I, I, I, I, I, I, I, const char*, double>(
+        "{15}|{16}|{17:.1f}");
+    REQUIRE(many.ec == TM_OK);
+    CHECK(tml::string_format(many.format, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, "str", 1.5) ==
+          "15|str|1.5");
+    CHECK(tml::snprint(buffer, 100, many.format, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, "str", 1) < 0);
+    tml::tmp_destroy_compiled_format(&many.format);
+    CHECK(tml::compile_format<I, I, I, I, I, I, I, I, I, I, I, I, I, I, I, I, I>("{16:f}").ec == TM_EINVAL);
+
+    auto empty = tml::compile_format<>("");
+    REQUIRE(empty.ec == TM_OK);
+    CHECK(tml::snprint(buffer, 100, empty.format) == 0);
+    tml::tmp_destroy_compiled_format(&empty.format);
+}
+
+#ifdef TMP_COMPILE_TIME_FORMAT
+template <class Str, class... Args>
+void check_compiled_output(tml::FormatString<Str> format, const char* expected_string, const Args&... args) {
+    const tm_size_t buffer_size = 100;
+    char buffer[buffer_size];
+
+    auto expected = std::string_view(expected_string);
+
+    CAPTURE(Str::data());
+    CAPTURE(expected_string);
+
+    auto needed_size = tml::snprint(nullptr, 0, format, args...);
+    REQUIRE(needed_size >= 0);
+    REQUIRE((size_t)needed_size == expected.size());
+
+    auto result_size = tml::snprint(buffer, buffer_size, format, args...);
+    REQUIRE(result_size >= 0);
+    REQUIRE((tm_size_t)result_size < buffer_size);
+    CHECK(std::string_view(buffer, (size_t)result_size) == expected);
+
+    CHECK(tml::string_format(format, args...) == expected);
+
+    // Compile time parsing must give the same output as parsing at runtime.
+    check_output(Str::data(), expected_string, args...);
+}
+
+TEST_CASE("Test compile time format strings") {
+    check_compiled_output(TMP_FMT(""), "");
+    check_compiled_output(TMP_FMT("test"), "test");
+    check_compiled_output(TMP_FMT("{}"), "1", 1);
+    check_compiled_output(TMP_FMT("a{}b{}c"), "a1b2c", 1, 2);
+    check_compiled_output(TMP_FMT("{:x} {:#X} {:o} {:#b}"), "f 0XF 10 0b1", 15, 15, 8, 1);
+    check_compiled_output(TMP_FMT("{:-10}|{:010}"), "1         |-000000001", 1, -1);
+    check_compiled_output(TMP_FMT("{:f} {:n} {}"), "1.000000 1 TRUE", 1.0, true, true);
+    check_compiled_output(TMP_FMT("{:c}{}"), "a97", 'a', 'a');
+    check_compiled_output(TMP_FMT("{} {}"), "string 1", "string", 1u);
+
+    // Indexed placeholders.
+    check_compiled_output(TMP_FMT("{1} {} {} {0}"), "2 1 2 1", 1, 2);
+
+    // More arguments than fit into PrintArgList::flags.
+    check_compiled_output(TMP_FMT("{}{}{}{}{}{}{}{}{}{}{}{}{}{}{}{}|{}|{:.1f}"), "0123456789012345|str|1.5", 0, 1, 2,
+                          3, 4, 5, 6, 7, 8, 9, 0, 1, 2, 3, 4, 5, "str", 1.5);
+
+    // Escaped braces around placeholders.
+    check_compiled_output(TMP_FMT("{{}}"), "{}");
+    check_compiled_output(TMP_FMT("{{{}}}"), "{1}", 1);
+    check_compiled_output(TMP_FMT("}}{}{{"), "}1{", 1);
+    check_compiled_output(TMP_FMT("test}}test{{test{}"), "test}test{test1", 1);
+
+    // Output that doesn't fit returns the necessary size.
+    char buffer[4];
+    CHECK(tml::snprint(buffer, 4, TMP_FMT("{}{}"), 12, 34) == 4);
+    CHECK(tml::snprint(buffer, 4, TMP_FMT("{}{}"), 1, 2) == 2);
+    CHECK(std::string_view(buffer) == "12");
+
+    char sink_buffer[16];
+    auto sink = tml::tmp_make_buffer_sink(sink_buffer, 16);
+    CHECK(tml::print(&sink, TMP_FMT("{} {:x}"), "sink", 255) == TM_OK);
+    CHECK(std::string_view(sink.data, (size_t)sink.size) == "sink ff");
+}
+
+TEST_CASE("Test compile time format string validation") {
+    using tml::tmp_format_string_check;
+    auto first = TMP_FMT("{}{}");
+    auto indexed = TMP_FMT("{2}");
+    auto hex = TMP_FMT("{:x}");
+    auto fixed = TMP_FMT("{:f}");
+    auto character = TMP_FMT("{:c}");
+    auto boolean = TMP_FMT("{:n}");
+
+    static_assert(tmp_format_string_check<decltype(first), int, int>::value == tml::tmp_format_valid, "");
+    static_assert(tmp_format_string_check<decltype(first), int>::value == tml::tmp_format_index_out_of_range, "");
+    static_assert(tmp_format_string_check<decltype(indexed), int, int>::value == tml::tmp_format_index_out_of_range,
+                  "");
+    static_assert(tmp_format_string_check<decltype(indexed), int, int, int>::value == tml::tmp_format_valid, "");
+
+    static_assert(tmp_format_string_check<decltype(hex), unsigned>::value == tml::tmp_format_valid, "");
+    static_assert(tmp_format_string_check<decltype(hex), char>::value == tml::tmp_format_valid, "");
+    static_assert(tmp_format_string_check<decltype(hex), double>::value == tml::tmp_format_type_mismatch, "");
+    static_assert(tmp_format_string_check<decltype(hex), const char*>::value == tml::tmp_format_type_mismatch, "");
+    static_assert(tmp_format_string_check<decltype(hex), bool>::value == tml::tmp_format_type_mismatch, "");
+
+    static_assert(tmp_format_string_check<decltype(fixed), float>::value == tml::tmp_format_valid, "");
+    static_assert(tmp_format_string_check<decltype(fixed), int>::value == tml::tmp_format_type_mismatch, "");
+
+    static_assert(tmp_format_string_check<decltype(character), char>::value == tml::tmp_format_valid, "");
+    static_assert(tmp_format_string_check<decltype(character), int>::value == tml::tmp_format_type_mismatch, "");
+
+    static_assert(tmp_format_string_check<decltype(boolean), bool>::value == tml::tmp_format_valid, "");
+    static_assert(tmp_format_string_check<decltype(boolean), int>::value == tml::tmp_format_type_mismatch, "");
+
+    // Types beyond the first 16 arguments are checked as well.
+    typedef int I;
+    auto last = TMP_FMT("{16:f}");
+    static_assert(tmp_format_string_check<decltype(last), I, I, I, I, I, I, I, I, I, I, I, I, I, I, I, I,
+                                          double>::value == tml::tmp_format_valid,
+                  "");
+    static_assert(tmp_format_string_check<decltype(last), I, I, I, I, I, I, I, I, I, I, I, I, I, I, I, I,
+                                          int>::value == tml::tmp_format_type_mismatch,
+                  "");
+    static_assert(tmp_format_string_check<decltype(last), I, I, I, I, I, I, I, I, I, I, I, I, I, I, I, I>::value ==
+                      tml::tmp_format_index_out_of_range,
+                  "");
+
+    // Unmatched braces.
+    auto invalid = [](const char* format) {
+        return tml::tmp_parse_format_segments(format, (tm_size_t)strlen(format), tml::default_print_format(), nullptr,
+                                              0)
+            .ec;
+    };
+    CHECK(invalid("{") == TM_EINVAL);
+    CHECK(invalid("}") == TM_EINVAL);
+    CHECK(invalid("{}}") == TM_EINVAL);
+    CHECK(invalid("{{}") == TM_EINVAL);
+    CHECK(invalid("{{}}") == TM_OK);
+
+    // Literal runs are split at escaped braces.
+    constexpr auto parsed = tml::tmp_parse_format_segments("a{{b{1:x}c", 10, tml::default_print_format(), nullptr, 0);
+    static_assert(parsed.ec == TM_OK && parsed.count == 4, "");
+    tml::tmp_format_segment segments[4] = {};
+    tml::tmp_parse_format_segments("a{{b{1:x}c", 10, tml::default_print_format(), segments, 4);
+    CHECK(segments[0].arg_index == -1);
+    CHECK(segments[0].offset == 0);
+    CHECK(segments[0].size == 2);
+    CHECK(segments[1].arg_index == -1);
+    CHECK(segments[1].offset == 3);
+    CHECK(segments[1].size == 1);
+    CHECK(segments[2].arg_index == 1);
+    CHECK(segments[2].format.base == 16);
+    CHECK(segments[3].arg_index == -1);
+    CHECK(segments[3].offset == 9);
+    CHECK(segments[3].size == 1);
+}
+#endif  // defined(TMP_COMPILE_TIME_FORMAT)
+
 // TODO: What is the correct behavior when specifying shortest representation with a given precision?
 #if 0
 TEST_CASE("Test precision with shortest") {
@@ -6,6 +6,10 @@ tests.tm_print.crt.out := ${build_dir}tests.tm_print.crt${exe_ext}
 tests.tm_print.crt_signed_size_t.out := ${build_dir}tests.tm_print.crt_signed_size_t${exe_ext}
 tests.tm_print.tm_conversion.out := ${build_dir}tests.tm_print.tm_conversion${exe_ext}
 tests.tm_print.tm_conversion_signed_size_t.out := ${build_dir}tests.tm_print.tm_conversion_signed_size_t${exe_ext}
+tests.tm_print.scratch_arena.out := ${build_dir}tests.tm_print.scratch_arena${exe_ext}
+tests.tm_print.scratch_arena_signed_size_t.out := ${build_dir}tests.tm_print.scratch_arena_signed_size_t${exe_ext}
+tests.tm_print.builtin_float.out := ${build_dir}tests.tm_print.builtin_float${exe_ext}
+tests.tm_print.builtin_float_signed_size_t.out := ${build_dir}tests.tm_print.builtin_float_signed_size_t${exe_ext}
 tests.tm_print.charconv.out := ${build_dir}tests.tm_print.charconv${exe_ext}
 tests.tm_print.charconv_signed_size_t.out := ${build_dir}tests.tm_print.charconv_signed_size_t${exe_ext}
 
@@ -13,6 +17,10 @@ tests.tm_print.all_configs_deps := ${tests.tm_print.default.out}
 tests.tm_print.all_configs_deps += ${tests.tm_print.crt.out} ${tests.tm_print.crt_signed_size_t.out}
 tests.tm_print.all_configs_deps += ${tests.tm_print.tm_conversion.out}
 tests.tm_print.all_configs_deps += ${tests.tm_print.tm_conversion_signed_size_t.out}
+tests.tm_print.all_configs_deps += ${tests.tm_print.scratch_arena.out}
+tests.tm_print.all_configs_deps += ${tests.tm_print.scratch_arena_signed_size_t.out}
+tests.tm_print.all_configs_deps += ${tests.tm_print.builtin_float.out}
+tests.tm_print.all_configs_deps += ${tests.tm_print.builtin_float_signed_size_t.out}
 
 ${tests.tm_print.default.out}: ${tests.tm_print.deps}
 	${hide}echo Compiling $@.
@@ -38,6 +46,26 @@ ${tests.tm_print.tm_conversion_signed_size_t.out}: ${tests.tm_print.deps}
 	${hide}$(call cxx_compile_and_link, ${tests.tm_print.src}, $@,, \
 	TMP_INT_BACKEND_TM_CONVERSION TMP_FLOAT_BACKEND_TM_CONVERSION SIGNED_SIZE_T)
 
+${tests.tm_print.scratch_arena.out}: ${tests.tm_print.deps}
+	${hide}echo Compiling $@.
+	${hide}$(call cxx_compile_and_link, ${tests.tm_print.src}, $@,, \
+	TMP_INT_BACKEND_TM_CONVERSION TMP_FLOAT_BACKEND_TM_CONVERSION TMP_SCRATCH_ARENA)
+
+${tests.tm_print.scratch_arena_signed_size_t.out}: ${tests.tm_print.deps}
+	${hide}echo Compiling $@.
+	${hide}$(call cxx_compile_and_link, ${tests.tm_print.src}, $@,, \
+	TMP_INT_BACKEND_TM_CONVERSION TMP_FLOAT_BACKEND_TM_CONVERSION TMP_SCRATCH_ARENA SIGNED_SIZE_T)
+
+${tests.tm_print.builtin_float.out}: ${tests.tm_print.deps}
+	${hide}echo Compiling $@.
+	${hide}$(call cxx_compile_and_link, ${tests.tm_print.src}, $@,, \
+	TMP_INT_BACKEND_CRT TMP_FLOAT_BACKEND_BUILTIN)
+
+${tests.tm_print.builtin_float_signed_size_t.out}: ${tests.tm_print.deps}
+	${hide}echo Compiling $@.
+	${hide}$(call cxx_compile_and_link, ${tests.tm_print.src}, $@,, \
+	TMP_INT_BACKEND_CRT TMP_FLOAT_BACKEND_BUILTIN SIGNED_SIZE_T)
+
 ifeq (${HAS_CHARCONV_FLOAT},true)
 tm_print.charconv_float := TMP_FLOAT_BACKEND_CHARCONV
 else
@@ -85,4 +113,77 @@ tests.tm_print.run: tests.tm_print
 	${hide}${tests.tm_print.tm_conversion.out}
 	${hide}echo ---
 	${hide}echo TESTING: tm_conversion backend with signed size_t
-	${hide}${tests.tm_print.tm_conversion_signed_size_t.out}
\ No newline at end of file
+	${hide}${tests.tm_print.tm_conversion_signed_size_t.out}
+	${hide}echo ---
+	${hide}echo TESTING: scratch arena
+	${hide}${tests.tm_print.scratch_arena.out}
+	${hide}echo ---
+	${hide}echo TESTING: scratch arena with signed size_t
+	${hide}${tests.tm_print.scratch_arena_signed_size_t.out}
+	${hide}echo ---
+	${hide}echo TESTING: builtin float backend
+	${hide}${tests.tm_print.builtin_float.out}
+	${hide}echo ---
+	${hide}echo TESTING: builtin float backend with signed size_t
+	${hide}${tests.tm_print.builtin_float_signed_size_t.out}
+# Benchmarks, always built with release options regardless of BUILD, since debug builds are sanitized.
+
+bench.tm_print.src  := tests/src/tm_print/bench.cpp
+bench.tm_print.deps := ${bench.tm_print.src} tm_print.h tm_conversion.h
+
+bench.tm_print.crt.out := ${release_dir}bench.tm_print.crt${exe_ext}
+bench.tm_print.tm_conversion.out := ${release_dir}bench.tm_print.tm_conversion${exe_ext}
+bench.tm_print.builtin_float.out := ${release_dir}bench.tm_print.builtin_float${exe_ext}
+bench.tm_print.charconv.out := ${release_dir}bench.tm_print.charconv${exe_ext}
+
+bench.tm_print.all_configs_deps := ${bench.tm_print.crt.out} ${bench.tm_print.tm_conversion.out}
+bench.tm_print.all_configs_deps += ${bench.tm_print.builtin_float.out}
+
+${release_dir}bench.tm_print.%: private BUILD := release
+${release_dir}bench.tm_print.%: private CXX_INCLUDES += .
+
+ifeq (${HAS_CHARCONV},true)
+bench.tm_print.all_configs_deps += ${bench.tm_print.charconv.out}
+bench.tm_print.defines := TMP_BENCH_CHARCONV
+endif
+ifeq (${HAS_CHARCONV_FLOAT},true)
+bench.tm_print.defines += TMP_BENCH_CHARCONV_FLOAT
+endif
+
+${bench.tm_print.crt.out}: ${bench.tm_print.deps}
+	${hide}echo Compiling $@.
+	${hide}$(call cxx_compile_and_link, ${bench.tm_print.src}, $@,, \
+	TMP_INT_BACKEND_CRT TMP_FLOAT_BACKEND_CRT ${bench.tm_print.defines})
+
+${bench.tm_print.tm_conversion.out}: ${bench.tm_print.deps}
+	${hide}echo Compiling $@.
+	${hide}$(call cxx_compile_and_link, ${bench.tm_print.src}, $@,, \
+	TMP_INT_BACKEND_TM_CONVERSION TMP_FLOAT_BACKEND_TM_CONVERSION ${bench.tm_print.defines})
+
+${bench.tm_print.builtin_float.out}: ${bench.tm_print.deps}
+	${hide}echo Compiling $@.
+	${hide}$(call cxx_compile_and_link, ${bench.tm_print.src}, $@,, \
+	TMP_INT_BACKEND_TM_CONVERSION TMP_FLOAT_BACKEND_BUILTIN ${bench.tm_print.defines})
+
+${bench.tm_print.charconv.out}: ${bench.tm_print.deps}
+	${hide}echo Compiling $@.
+	${hide}$(call cxx_compile_and_link, ${bench.tm_print.src}, $@,, \
+	TMP_INT_BACKEND_CHARCONV ${tm_print.charconv_float} ${bench.tm_print.defines})
+
+bench.tm_print.build: ${bench.tm_print.all_configs_deps}
+
+bench.tm_print: bench.tm_print.build
+	${hide}echo ---
+	${hide}echo BENCHMARK: crt backend
+	${hide}${bench.tm_print.crt.out}
+	${hide}echo ---
+	${hide}echo BENCHMARK: tm_conversion backend
+	${hide}${bench.tm_print.tm_conversion.out}
+	${hide}echo ---
+	${hide}echo BENCHMARK: builtin float backend
+	${hide}${bench.tm_print.builtin_float.out}
+ifeq (${HAS_CHARCONV},true)
+	${hide}echo ---
+	${hide}echo BENCHMARK: charconv backend${tm_print.charconv_without_float}
+	${hide}${bench.tm_print.charconv.out}
+endif
@@ -55,6 +55,18 @@
 #ifdef DT_DIR
     #undef DT_DIR
 #endif
+#ifdef DT_UNKNOWN
+    #undef DT_UNKNOWN
+#endif
+#ifdef dirfd
+    #undef dirfd
+#endif
+#ifdef fstatat
+    #undef fstatat
+#endif
+#ifdef AT_SYMLINK_NOFOLLOW
+    #undef AT_SYMLINK_NOFOLLOW
+#endif
 
 #ifdef readlink
     #undef readlink
@@ -121,6 +133,30 @@
 #ifdef _O_U16TEXT
     #undef _O_U16TEXT
 #endif
+#ifdef _IONBF
+    #undef _IONBF
+#endif
+#ifdef setvbuf
+    #undef setvbuf
+#endif
+#ifdef fileno
+    #undef fileno
+#endif
+#ifdef fsync
+    #undef fsync
+#endif
+#ifdef _commit
+    #undef _commit
+#endif
+#ifdef open
+    #undef open
+#endif
+#ifdef close
+    #undef close
+#endif
+#ifdef O_RDONLY
+    #undef O_RDONLY
+#endif
 // clang-format on
 
 #define TMU_TESTING_CHAR16_DEFINED
@@ -195,10 +231,12 @@ const tchar* test_to_tchar(const char* str) {
     TM_ASSERT(str);
 
     static tchar buffer[10];
-    for (tchar *p = buffer, *end = buffer + 10; p < end && *str; ++p) {
+    tchar* p = buffer;
+    for (tchar* end = buffer + 9; p < end && *str; ++p) {
         *p = (tchar)*str++;
     }
     TM_ASSERT(!*str);
+    *p = 0;
     return buffer;
 }
 tchar test_to_tchar(char c) { return (tchar)c; }
@@ -272,6 +310,8 @@ enum should_fail_enum {
     fail_freopen,
     fail_fwrite,
     fail_fread,
+    fail_fsync,
+    fail_open,
     fail_opendir,
     fail_readdir,
     fail_readlink,
@@ -309,6 +349,7 @@ enum should_fail_enum {
     fail_FindFirstFileW,
     fail_FindClose,
     fail_FindNextFileW,
+    fail_FlushFileBuffers,
     fail_wfindfirst64,
     fail_wfindnext64,
     fail_SetConsoleOutputCP,
@@ -351,9 +392,11 @@ struct file_io_mock {
 
     std::vector<file_io_entry> entries;
     open_file file;
+    bool dir_is_open;
 
     std::vector<tchar> module_filename;
     int readdir_index;
+    bool readdir_unknown_type;
 
     std::vector<char> char_module_filename;
     std::vector<tmu_char16> wchar_module_filename;
@@ -386,12 +429,14 @@ struct file_io_mock {
 
         file = {};
         file.file_io_entry_index = -1;
+        dir_is_open = false;
         char_module_filename.clear();
         wchar_module_filename.clear();
         argv.clear();
         wargv.clear();
         module_filename.clear();
         readdir_index = 0;
+        readdir_unknown_type = false;
 
         entries.clear();
         in.clear();
@@ -477,9 +522,15 @@ open_file* test_fopen(const tchar* filename, const tchar* mode) {
     }
 
     if (*mode == 'b') ++mode;
+    bool is_exclusive = is_writable && *mode == 'x';
 
     auto index = mock.find_file(filename);
 
+    if (is_exclusive && index >= 0) {
+        mock.internal_error = EEXIST;
+        return nullptr;
+    }
+
     if (is_writable) {
     	if (index < 0) {
     		mock.entries.push_back({});
@@ -513,7 +564,7 @@ int test_ferror(open_file* file) {
 	return file->has_error;
 }
 
-void test_fclose(open_file* file) {
+int test_fclose(open_file* file) {
     TM_ASSERT(file);
     TM_ASSERT(file->is_open);
     TM_ASSERT(file->file_io_entry_index >= 0 && (size_t)file->file_io_entry_index < mock.entries.size());
@@ -524,6 +575,17 @@ void test_fclose(open_file* file) {
     }
 
     *file = {};
+    return 0;
+}
+
+#define _IONBF 2
+int test_setvbuf(open_file* file, char* buffer, int mode, size_t size) {
+    TM_ASSERT(file);
+    TM_ASSERT(file->is_open);
+    TM_ASSERT(!buffer);
+    TM_ASSERT(mode == _IONBF);
+    TM_ASSERT(size == 0);
+    return 0;
 }
 
 open_file* test_freopen(const tchar* filename, const tchar* mode, open_file* current) {
@@ -591,6 +653,7 @@ size_t test_fwrite(const void* buffer, size_t element_size, size_t num_elements,
 struct test_stat {
     mock_file_type st_mode;
     uint64_t st_mtime;
+    uint64_t st_size;
 };
 
 int test_stat(const tchar* filename, struct test_stat* out) {
@@ -607,6 +670,7 @@ int test_stat(const tchar* filename, struct test_stat* out) {
 
     out->st_mode = mock.entries[entry_index].type;
     out->st_mtime = 0;
+    out->st_size = mock.entries[entry_index].contents.size();
     return 0;
 }
 
@@ -753,7 +817,10 @@ tchar* test_getcwd(tchar* buf, size_t size) {
 }
 
 /* Posix Directory Reading */
-#define TEST_DT_DIR 1
+#define TEST_DT_UNKNOWN 0
+#define TEST_DT_DIR 4
+#define TEST_DT_REG 8
+#define TEST_AT_SYMLINK_NOFOLLOW 0x100
 
 struct test_dirent {
     unsigned char d_type;
@@ -788,7 +855,11 @@ test_dirent* test_readdir(file_io_mock* handle) {
     const auto* entry = &mock.entries[mock.readdir_index];
     ++mock.readdir_index;
 
-    global_dirent.d_type = (entry->type == mock_file) ? 0 : TEST_DT_DIR;
+    if (mock.readdir_unknown_type) {
+        global_dirent.d_type = TEST_DT_UNKNOWN;
+    } else {
+        global_dirent.d_type = (entry->type == mock_file) ? TEST_DT_REG : TEST_DT_DIR;
+    }
     size_t len = std::min((size_t)256, entry->path.size());
     memcpy(global_dirent.d_name, entry->path.data(), len);
     if (len < 256)
@@ -801,7 +872,21 @@ test_dirent* test_readdir(file_io_mock* handle) {
 void test_closedir(file_io_mock* handle) {
     TM_ASSERT(handle);
     TM_ASSERT(handle == &mock);
-    mock.readdir_index = 0;
+    /* Don't reset readdir_index, so that closing a nested directory doesn't restart reading the outer one. */
+}
+
+int test_dirfd(file_io_mock* handle) {
+    TM_ASSERT(handle);
+    TM_ASSERT(handle == &mock);
+    return 3;
+}
+
+int test_fstatat(int fd, const tchar* name, struct test_stat* out, int flags) {
+    TM_ASSERT(fd == 3);
+    TM_ASSERT(flags == TEST_AT_SYMLINK_NOFOLLOW);
+    (void)fd;
+    (void)flags;
+    return test_stat(name, out);
 }
 
 /* Windows Crt Directory Reading */
@@ -809,12 +894,15 @@ void test_closedir(file_io_mock* handle) {
 
 struct test_wfinddata64_t {
     unsigned attrib;
+    int64_t time_write;
+    int64_t size;
     tmu_char16 name[260];
 };
 
 static void helper_copy_next_index(test_wfinddata64_t* data) {
     memset(data, 0, sizeof(test_wfinddata64_t));
     data->attrib = (mock.entries[mock.readdir_index].type == mock_dir) ? TEST_A_SUBDIR : 0;
+    data->size = (int64_t)mock.entries[mock.readdir_index].contents.size();
     const auto& path = mock.entries[mock.readdir_index].path;
     auto len = std::min(path.size(), (size_t)260);
     memcpy(data->name, path.data(), len * sizeof(tmu_char16));
@@ -1019,11 +1107,39 @@ int test__fileno(open_file* stream) {
     if (stream == &mock.in.file) return 0;
     if (stream == &mock.out.file) return 1;
     if (stream == &mock.err.file) return 2;
+    if (stream == &mock.file) return 3;
     TM_ASSERT(false);
     mock.internal_error = EINVAL;
     return -1;
 }
 
+#define TEST_O_RDONLY 0
+#define TEST_DIR_FD 4
+
+/* Only used to open directories for syncing. */
+int test_open(const tchar* path, int flags) {
+    TM_ASSERT(path);
+    TM_ASSERT(flags == TEST_O_RDONLY);
+    TM_ASSERT(!mock.dir_is_open);
+    if (mock.test_fail(fail_open)) return -1;
+    mock.dir_is_open = true;
+    return TEST_DIR_FD;
+}
+
+int test_close(int fd) {
+    TM_ASSERT(fd == TEST_DIR_FD);
+    TM_ASSERT(mock.dir_is_open);
+    mock.dir_is_open = false;
+    return 0;
+}
+
+int test_fsync(int fd) {
+    TM_ASSERT(fd == 3 || fd == TEST_DIR_FD);
+    TM_ASSERT((fd == 3) ? mock.file.is_open : mock.dir_is_open);
+    if (mock.test_fail(fail_fsync)) return -1;
+    return 0;
+}
+
 #define _O_U16TEXT 1
 
 int test__setmode(int fd, int mode) {
@@ -1055,6 +1171,7 @@ int test__setmode(int fd, int mode) {
 #define fwrite test_fwrite
 #define fclose test_fclose
 #define ferror test_ferror
+#define setvbuf test_setvbuf
 #define strchr test_strchr
 #define wcslen test_strlen
 #define wcschr test_strchr
@@ -1082,7 +1199,16 @@ int test__setmode(int fd, int mode) {
 #define readdir test_readdir
 #define closedir test_closedir
 #define DT_DIR TEST_DT_DIR
+#define DT_UNKNOWN TEST_DT_UNKNOWN
+#define dirfd test_dirfd
+#define fstatat test_fstatat
+#define AT_SYMLINK_NOFOLLOW TEST_AT_SYMLINK_NOFOLLOW
 #define readlink test_readlink
+#define fileno test__fileno
+#define fsync test_fsync
+#define open test_open
+#define close test_close
+#define O_RDONLY TEST_O_RDONLY
 #define ssize_t intptr_t
 
 /* MSVC CRT Mockups */
@@ -1107,4 +1233,5 @@ int test__setmode(int fd, int mode) {
 #define _vsnprintf test__vsnprintf
 #define _isatty test__isatty
 #define _fileno test__fileno
+#define _commit test_fsync
 #define _setmode test__setmode
\ No newline at end of file
@@ -129,6 +129,89 @@ TEST_CASE("renaming") {
     REQUIRE(!to_exists.exists);
 }
 
+TEST_CASE("file writer") {
+    allocation_guard alloc_guard;
+    mock.clear();
+
+    const char* filename = "build/test.txt";
+    const char* pieces[] = {"tmu_test", " file", " data that is bigger than the buffer", "!"};
+    std::string expected;
+    for (auto piece : pieces) expected += piece;
+
+    // Buffered writes.
+    auto writer = tmu_file_writer_open(filename, tmu_overwrite, /*buffer_capacity=*/16);
+    REQUIRE(writer.ec == TM_OK);
+    REQUIRE(mock.file.is_open);
+    for (auto piece : pieces) {
+        REQUIRE(tmu_file_writer_write(&writer, piece, (tm_size_t)strlen(piece)) == TM_OK);
+    }
+    auto result = tmu_file_writer_close(&writer);
+    REQUIRE(result.ec == TM_OK);
+    REQUIRE(result.written == (tm_size_t)expected.size());
+    REQUIRE(!mock.file.is_open);
+    REQUIRE(mock.entries.size() == 1);
+    REQUIRE(std::string(mock.entries[0].contents.begin(), mock.entries[0].contents.end()) == expected);
+
+    // Refuse to overwrite.
+    writer = tmu_file_writer_open(filename, 0, TMU_FILE_WRITER_DEFAULT_BUFFER_SIZE);
+    REQUIRE(writer.ec == TM_EEXIST);
+    REQUIRE(!mock.file.is_open);
+    REQUIRE(tmu_file_writer_close(&writer).ec == TM_EEXIST);
+    writer = tmu_file_writer_open(filename, tmu_atomic_write, TMU_FILE_WRITER_DEFAULT_BUFFER_SIZE);
+    REQUIRE(writer.ec == TM_EEXIST);
+    tmu_file_writer_discard(&writer);
+
+    // Atomic writes don't touch the destination until closed.
+    writer = tmu_file_writer_open(filename, tmu_overwrite | tmu_atomic_write, /*buffer_capacity=*/0);
+    REQUIRE(writer.ec == TM_OK);
+    REQUIRE(tmu_file_writer_write(&writer, "new contents", 12) == TM_OK);
+    REQUIRE(mock.entries.size() == 2);
+    REQUIRE(std::string(mock.entries[0].contents.begin(), mock.entries[0].contents.end()) == expected);
+    result = tmu_file_writer_close(&writer);
+    REQUIRE(result.ec == TM_OK);
+    REQUIRE(result.written == 12);
+    REQUIRE(mock.entries.size() == 1);
+    REQUIRE(tmu_file_exists(filename).exists);
+    REQUIRE(std::string(mock.entries[0].contents.begin(), mock.entries[0].contents.end()) == "new contents");
+
+    // Discarding an atomic write leaves the destination untouched.
+    writer = tmu_file_writer_open(filename, tmu_overwrite | tmu_atomic_write | tmu_write_byte_order_mark, 4);
+    REQUIRE(writer.ec == TM_OK);
+    REQUIRE(writer.written == 3);
+    REQUIRE(tmu_file_writer_write(&writer, "discarded", 9) == TM_OK);
+    tmu_file_writer_discard(&writer);
+    REQUIRE(!mock.file.is_open);
+    REQUIRE(mock.entries.size() == 1);
+    REQUIRE(std::string(mock.entries[0].contents.begin(), mock.entries[0].contents.end()) == "new contents");
+
+    // Atomic write through tmu_write_file_ex.
+    auto write_result = tmu_write_file_ex(filename, "abc", 3, tmu_overwrite | tmu_atomic_write);
+    REQUIRE(write_result.ec == TM_OK);
+    REQUIRE(mock.entries.size() == 1);
+    REQUIRE(std::string(mock.entries[0].contents.begin(), mock.entries[0].contents.end()) == "abc");
+
+    // Temporary files that already exist are left alone, the next free name is taken instead.
+    const char* taken_temp_filename = "build/test.txt.tmu_tmp00";
+    mock.entries.push_back({taken_temp_filename, "not ours", mock_file});
+    write_result = tmu_write_file_ex(filename, "def", 3, tmu_overwrite | tmu_atomic_write);
+    REQUIRE(write_result.ec == TM_OK);
+    REQUIRE(!mock.file.is_open);
+    REQUIRE(!mock.dir_is_open);
+    REQUIRE(mock.entries.size() == 2);
+    {
+        auto contents = tml::make_resource(tmu_read_file(filename));
+        REQUIRE(contents->ec == TM_OK);
+        REQUIRE(std::string(contents->contents.data, contents->contents.size) == "def");
+        auto taken_contents = tml::make_resource(tmu_read_file(taken_temp_filename));
+        REQUIRE(taken_contents->ec == TM_OK);
+        REQUIRE(std::string(taken_contents->contents.data, taken_contents->contents.size) == "not ours");
+    }
+    REQUIRE(tmu_delete_file(taken_temp_filename) == TM_OK);
+
+    REQUIRE(tmu_delete_file(filename) == TM_OK);
+    REQUIRE(mock.entries.empty());
+}
+
 string get_dir(const char* base, const char** dirs, size_t dirs_len) {
     string result = base;
     for (size_t i = 0; i < dirs_len; ++i) {
@@ -334,15 +417,29 @@ TEST_CASE("error reporting") {
     CHECK(tmu_write_file_as_utf8(fn, &test_data, 1).ec == mock_error);
     CHECK(!mock.file.is_open);
 
-#if 0
-    /* Atomic write not implemented yet. */
-    mock.fopen_should_fail_with = mock_error;
-    CHECK(tmu_write_file_ex(fn, &test_data, 1, tmu_atomic_write).ec == mock_error);
-    mock.fwrite_should_fail_with = mock_error;
-    CHECK(tmu_write_file_ex(fn, &test_data, 1, tmu_atomic_write).ec == mock_error);
-    mock.fwrite_should_fail_with = mock_error;
-    CHECK(tmu_write_file_ex(fn, &test_data, 1, tmu_atomic_write).ec == mock_error);
+    mock.file = {};
+    mock.set_fail(fail_fopen, mock_error);
+    CHECK(tmu_write_file_ex(fn, &test_data, 1, tmu_overwrite | tmu_atomic_write).ec == mock_error);
+    CHECK(!mock.file.is_open);
+    CHECK(mock.entries.size() == 2);
+    mock.set_fail(fail_fwrite, mock_error);
+    CHECK(tmu_write_file_ex(fn, &test_data, 1, tmu_overwrite | tmu_atomic_write).ec == mock_error);
+    CHECK(!mock.file.is_open);
+    CHECK(mock.entries.size() == 2);
+    mock.set_fail(fail_fsync, mock_error);
+    CHECK(tmu_write_file_ex(fn, &test_data, 1, tmu_overwrite | tmu_atomic_write).ec == mock_error);
+    CHECK(!mock.file.is_open);
+    CHECK(mock.entries.size() == 2);
+#ifndef USE_MSVC_CRT
+    mock.set_fail(fail_open, mock_error);
+    CHECK(tmu_write_file_ex(fn, &test_data, 1, tmu_overwrite | tmu_atomic_write).ec == mock_error);
+    CHECK(!mock.dir_is_open);
+    CHECK(mock.entries.size() == 2);
 #endif
+    mock.set_fail(fail_rename, mock_error);
+    mock.set_fail(fail_stat, mock_error);
+    CHECK(tmu_write_file_ex(fn, &test_data, 1, tmu_atomic_write).ec == mock_error);
+    CHECK(mock.entries.size() == 2);
 
     mock.set_fail(fail_stat, mock_error);
     CHECK(tmu_rename_file_ex(fn, fn2, 0) == mock_error);
@@ -428,11 +525,15 @@ TEST_CASE("error reporting") {
 
     /* Atomic Write */
     check(fail_MultiByteToWideChar, tmu_write_file_ex(fn, &test_data, sizeof(char), tmu_atomic_write).ec);
-    check(fail_GetTempFileNameW, tmu_write_file_ex(fn, &test_data, sizeof(char), tmu_atomic_write).ec);
     check(fail_CreateFileW, tmu_write_file_ex(fn, &test_data, sizeof(char), 0).ec);
     check(fail_WriteFile, tmu_write_file_ex(fn, &test_data, sizeof(char), 0).ec);
     check(fail_CreateFileW, tmu_write_file_ex(very_long_fn, &test_data, sizeof(char), tmu_atomic_write).ec);
 
+    /* Buffered writer */
+    check(fail_CreateFileW, tmu_file_writer_open(fn2, tmu_atomic_write, 0).ec);
+    check(fail_WriteFile, tmu_write_file_ex(fn2, &test_data, sizeof(char), tmu_atomic_write).ec);
+    check(fail_FlushFileBuffers, tmu_write_file_ex(fn2, &test_data, sizeof(char), tmu_atomic_write).ec);
+
     check(fail_MultiByteToWideChar, tmu_write_file_as_utf8(fn, &test_data, sizeof(char)).ec);
     check(fail_CreateFileW, tmu_write_file_as_utf8(fn, &test_data, sizeof(char)).ec);
     check(fail_WriteFile, tmu_write_file_as_utf8(fn, &test_data, sizeof(char)).ec);
@@ -606,6 +707,99 @@ TEST_CASE("positive directory reading") {
     tmu_close_directory(&dir);
 }
 
+static void push_directory_test_entries() {
+    mock.entries.clear();
+    mock.entries.push_back({".", "", mock_dir});
+    mock.entries.push_back({"..", "", mock_dir});
+    mock.entries.push_back({"a", "", mock_dir});
+    mock.entries.push_back({"b", "", mock_dir});
+    mock.entries.push_back({"c", "contents", mock_file});
+    mock.entries.push_back({"d", "", mock_file});
+    mock.entries.push_back({"e", "", mock_dir});
+}
+
+static std::string_view dir_name(std::string_view name) {
+#if defined(USE_WINDOWS_H)
+    /* Winapi backend reports directories with trailing slashes. */
+    if (!name.empty() && name.back() == '/') name.remove_suffix(1);
+#endif
+    return name;
+}
+
+TEST_CASE("batch directory reading") {
+    allocation_guard alloc_guard;
+
+    SUBCASE("known types") {}
+    SUBCASE("unknown types") { mock.readdir_unknown_type = true; }
+    push_directory_test_entries();
+
+    auto dir = tmu_open_directory("./");
+    REQUIRE(dir.ec == TM_OK);
+
+    tmu_directory_entry entries[3];
+    auto count = tmu_read_directory_batch(&dir, entries, 3, tmu_read_directory_stat);
+    REQUIRE(dir.ec == TM_OK);
+    REQUIRE(count == 3);
+    CHECK(dir_name(entries[0].name) == "a");
+    CHECK(entries[0].is_file == false);
+    CHECK(dir_name(entries[1].name) == "b");
+    CHECK(entries[1].is_file == false);
+    CHECK(std::string_view{entries[2].name} == "c");
+    CHECK(entries[2].is_file == true);
+    CHECK(entries[2].has_stat == true);
+    CHECK(entries[2].size == 8);
+
+    count = tmu_read_directory_batch(&dir, entries, 3, /*flags=*/0);
+    REQUIRE(dir.ec == TM_OK);
+    REQUIRE(count == 2);
+    CHECK(std::string_view{entries[0].name} == "d");
+    CHECK(entries[0].is_file == true);
+    CHECK(dir_name(entries[1].name) == "e");
+    CHECK(entries[1].is_file == false);
+
+    count = tmu_read_directory_batch(&dir, entries, 3, /*flags=*/0);
+    REQUIRE(dir.ec == TM_OK);
+    REQUIRE(count == 0);
+    tmu_close_directory(&dir);
+    mock.readdir_unknown_type = false;
+}
+
+struct walk_data {
+    std::vector<std::string> paths;
+    bool stop_at_d = false;
+};
+
+static tmu_walk_action walk_callback(void* user_data, const char* path, const tmu_directory_entry* entry) {
+    auto data = (walk_data*)user_data;
+    data->paths.push_back(path);
+    if (data->stop_at_d && std::string_view{entry->name} == "d") return tmu_walk_stop;
+    /* Mock returns the same entries for every directory, only descend into "root/a/". */
+    if (std::string_view{path} == "root/a/") return tmu_walk_continue;
+    return tmu_walk_skip;
+}
+
+TEST_CASE("directory walking") {
+    allocation_guard alloc_guard;
+    push_directory_test_entries();
+
+    walk_data data;
+    REQUIRE(tmu_walk_directory("root", /*flags=*/0, walk_callback, &data) == TM_OK);
+    std::vector<std::string> expected = {"root/a/",   "root/a/a/", "root/a/b/", "root/a/c", "root/a/d",
+                                         "root/a/e/", "root/b/",   "root/c",    "root/d",   "root/e/"};
+    CHECK(data.paths == expected);
+
+    data = {};
+    data.stop_at_d = true;
+    REQUIRE(tmu_walk_directory("root/", /*flags=*/0, walk_callback, &data) == TM_ECANCELED);
+    expected = {"root/a/", "root/a/a/", "root/a/b/", "root/a/c", "root/a/d"};
+    CHECK(data.paths == expected);
+
+    data = {};
+    mock.entries.clear();
+    REQUIRE(tmu_walk_directory("root", /*flags=*/0, walk_callback, &data) != TM_OK);
+    CHECK(data.paths.empty());
+}
+
 TEST_CASE("module filename") {
     allocation_guard alloc_guard;
 
@@ -1,6 +1,6 @@
 /* This file was generated using tools/unicode_gen from
    https://github.com/to-miz/tm. Do not modify by hand.
-   Around 238126 bytes (232.54 kilobytes) of data for lookup tables
+   Around 300150 bytes (293.12 kilobytes) of data for lookup tables
    are generated. It was generated using version 13.0.0 of Unicode.*/
 
 #ifdef __cplusplus
@@ -237,437 +237,462 @@ typedef struct {
     int32_t simple_compatibility_offset;
 } tmu_ucd_internal;
 
-/* Unicode data entries: 146520 bytes. */
-static const size_t tmu_ucd_entries_size = 3663;
-static const tmu_ucd_internal tmu_ucd_entries[3663] = {
+/* Unicode data entries: 148800 bytes. */
+static const size_t tmu_ucd_entries_size = 3720;
+static const tmu_ucd_internal tmu_ucd_entries[3720] = {
     {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
     {0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
     {0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
     {64, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
     {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -32, -32, 0, 0, -32, 0, 0},
-    {6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -128},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -136},
-    {5, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -73},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -143},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -128},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -148},
-    {17, 0, 0, 0, 0, 0, 0, 743, 743, 0, 775, 743, 0, 775},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -152},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -136},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -75},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -139},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -140},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, -127, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, -128, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, -129, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, -130, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, -131, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, -132, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, -133, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, -134, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, -135, 0},
-    {17, 0, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -32, -32, 0, 0, -32, -127, 0},
-    {17, 0, 0, 0, 0, 0, 0, -32, -32, 0, 0, -32, -128, 0},
-    {17, 0, 0, 0, 0, 0, 0, -32, -32, 0, 0, -32, -129, 0},
-    {17, 0, 0, 0, 0, 0, 0, -32, -32, 0, 0, -32, -130, 0},
-    {17, 0, 0, 0, 0, 0, 0, -32, -32, 0, 0, -32, -131, 0},
-    {17, 0, 0, 0, 0, 0, 0, -32, -32, 0, 0, -32, -132, 0},
-    {17, 0, 0, 0, 0, 0, 0, -32, -32, 0, 0, -32, -133, 0},
-    {17, 0, 0, 0, 0, 0, 0, -32, -32, 0, 0, -32, -134, 0},
-    {17, 0, 0, 0, 0, 0, 0, -32, -32, 0, 0, -32, -135, 0},
-    {17, 0, 0, 0, 0, 0, 0, 121, 121, 0, 0, 121, -134, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -191, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -160, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -193, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -162, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -195, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -164, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -197, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -166, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -199, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -168, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -201, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -170, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -202, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -171, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -205, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -174, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -207, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -176, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -209, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -178, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -211, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -180, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -213, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -182, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -215, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -184, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -217, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -186, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -219, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -188, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -220, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -189, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -223, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -192, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -225, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -194, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -227, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -196, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -229, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -198, 0},
-    {9, 0, 0, 0, 1, 4, 232, 0, 0, -199, 0, -199, -231, 0},
-    {17, 0, 0, 0, 0, 0, 0, -232, -232, 0, 0, -232, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, -233},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -202},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -234, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -203, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -235, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -204, 0},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -237, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -206, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -239, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -208, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -241, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -210, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, -243},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -212},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -245, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -214, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -247, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -216, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -249, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -218, 0},
-    {17, 0, 4, 4, 0, 7, 4, 0, 0, 0, 0, 0, 0, 371},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -253, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -222, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -255, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -224, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -257, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -226, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -258, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -227, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -260, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -229, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -262, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -231, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -263, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -232, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -265, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -234, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -267, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -236, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -269, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -238, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -270, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -239, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -272, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -241, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -275, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -244, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -277, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -246, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -279, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -248, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -281, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -250, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -283, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -252, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -285, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -254, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -121, -121, -121, -287, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -287, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -256, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -289, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -258, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -291, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -260, 0},
-    {17, 0, 0, 0, 0, 0, 0, -300, -300, 0, -268, -300, 0, -268},
-    {17, 0, 0, 0, 0, 0, 0, 195, 195, 0, 0, 195, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 210, 210, 210, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 206, 206, 206, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 205, 205, 205, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 79, 79, 79, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 202, 202, 202, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 203, 203, 203, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 207, 207, 207, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, 97, 97, 0, 0, 97, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 211, 211, 211, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 209, 209, 209, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, 163, 163, 0, 0, 163, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 213, 213, 213, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, 130, 130, 0, 0, 130, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 214, 214, 214, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -337, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -306, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 218, 218, 218, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -346, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -315, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 217, 217, 217, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 219, 219, 219, 0, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, 56, 56, 0, 0, 56, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 0, -384},
-    {25, 0, 0, 0, 0, 0, 0, -1, 0, 1, 1, 0, 0, -385},
-    {17, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, -2, 0, -354},
-    {9, 0, 0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 0, -379},
-    {25, 0, 0, 0, 0, 0, 0, -1, 0, 1, 1, 0, 0, -380},
-    {17, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, -2, 0, -349},
-    {9, 0, 0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 0, -380},
-    {25, 0, 0, 0, 0, 0, 0, -1, 0, 1, 1, 0, 0, -381},
-    {17, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, -2, 0, -350},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -396, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -365, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -390, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -359, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -386, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -355, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -382, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -351, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -251, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -220, 0},
-    {17, 0, 0, 0, 0, 0, 0, -79, -79, 0, 0, -79, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -282, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -251, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 70, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 70, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -284, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -253, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -415, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -384, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -413, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -382, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -411, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -380, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -2, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -2, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -55, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 163, 0},
-    {17, 0, 7, 7, 0, 10, 7, 0, 0, 0, 0, 0, -390, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 0, -429},
-    {25, 0, 0, 0, 0, 0, 0, -1, 0, 1, 1, 0, 0, -430},
-    {17, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, -2, 0, -399},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -429, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -398, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -97, -97, -97, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -56, -56, -56, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -426, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -395, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -309, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -278, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -310, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -279, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -294, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -263, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -447, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -416, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -449, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -418, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -445, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -414, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -446, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -415, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -448, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -417, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -453, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -422, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -454, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -423, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -470, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -439, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -130, -130, -130, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -485, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -454, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -483, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -452, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -340, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -309, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -343, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -312, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -479, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -448, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -473, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -442, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 10795, 10795, 10795, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -163, -163, -163, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 10792, 10792, 10792, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, 10815, 10815, 0, 0, 10815, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -195, -195, -195, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 69, 69, 69, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 71, 71, 71, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, 10783, 10783, 0, 0, 10783, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, 10780, 10780, 0, 0, 10780, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, 10782, 10782, 0, 0, 10782, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -210, -210, 0, 0, -210, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -206, -206, 0, 0, -206, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -205, -205, 0, 0, -205, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -202, -202, 0, 0, -202, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -203, -203, 0, 0, -203, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, 42319, 42319, 0, 0, 42319, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, 42315, 42315, 0, 0, 42315, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -207, -207, 0, 0, -207, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, 42280, 42280, 0, 0, 42280, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, 42308, 42308, 0, 0, 42308, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -209, -209, 0, 0, -209, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -211, -211, 0, 0, -211, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, 10743, 10743, 0, 0, 10743, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, 42305, 42305, 0, 0, 42305, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, 10749, 10749, 0, 0, 10749, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -213, -213, 0, 0, -213, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -214, -214, 0, 0, -214, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, 10727, 10727, 0, 0, 10727, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -218, -218, 0, 0, -218, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, 42307, 42307, 0, 0, 42307, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, 42282, 42282, 0, 0, 42282, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -69, -69, 0, 0, -69, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -217, -217, 0, 0, -217, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -71, -71, 0, 0, -71, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -219, -219, 0, 0, -219, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, 42261, 42261, 0, 0, 42261, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, 42258, 42258, 0, 0, 42258, 0, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -584},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -577},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -59},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -58},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -53},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -576},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -575},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -696},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -697},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -698},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -699},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -700},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -701},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -629},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -623},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -619},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -79},
+    {70, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, 0, 0},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -32, -32, 0, 0, -32, 0, 0},
+    {0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {6, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -128},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -136},
+    {5, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -73},
+    {0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -143},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -128},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -148},
+    {17, 16, 0, 0, 0, 0, 0, 743, 743, 0, 775, 743, 0, 775},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -152},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -136},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -75},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -139},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -140},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, -127, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, -128, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, -129, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, -130, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, -131, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, -132, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, -133, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, -134, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, -135, 0},
+    {17, 16, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -32, -32, 0, 0, -32, -127, 0},
+    {17, 16, 0, 0, 0, 0, 0, -32, -32, 0, 0, -32, -128, 0},
+    {17, 16, 0, 0, 0, 0, 0, -32, -32, 0, 0, -32, -129, 0},
+    {17, 16, 0, 0, 0, 0, 0, -32, -32, 0, 0, -32, -130, 0},
+    {17, 16, 0, 0, 0, 0, 0, -32, -32, 0, 0, -32, -131, 0},
+    {17, 16, 0, 0, 0, 0, 0, -32, -32, 0, 0, -32, -132, 0},
+    {17, 16, 0, 0, 0, 0, 0, -32, -32, 0, 0, -32, -133, 0},
+    {17, 16, 0, 0, 0, 0, 0, -32, -32, 0, 0, -32, -134, 0},
+    {17, 16, 0, 0, 0, 0, 0, -32, -32, 0, 0, -32, -135, 0},
+    {17, 16, 0, 0, 0, 0, 0, 121, 121, 0, 0, 121, -134, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -191, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -160, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -193, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -162, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -195, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -164, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -197, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -166, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -199, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -168, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -201, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -170, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -202, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -171, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -205, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -174, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -207, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -176, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -209, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -178, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -211, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -180, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -213, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -182, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -215, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -184, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -217, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -186, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -219, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -188, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -220, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -189, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -223, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -192, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -225, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -194, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -227, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -196, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -229, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -198, 0},
+    {9, 16, 0, 0, 1, 4, 232, 0, 0, -199, 0, -199, -231, 0},
+    {17, 16, 0, 0, 0, 0, 0, -232, -232, 0, 0, -232, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, -233},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -202},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -234, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -203, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -235, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -204, 0},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -237, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -206, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -239, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -208, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -241, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -210, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, -243},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -212},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -245, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -214, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -247, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -216, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -249, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -218, 0},
+    {17, 16, 4, 4, 0, 7, 4, 0, 0, 0, 0, 0, 0, 371},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -253, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -222, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -255, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -224, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -257, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -226, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -258, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -227, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -260, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -229, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -262, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -231, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -263, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -232, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -265, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -234, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -267, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -236, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -269, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -238, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -270, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -239, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -272, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -241, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -275, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -244, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -277, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -246, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -279, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -248, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -281, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -250, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -283, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -252, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -285, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -254, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -121, -121, -121, -287, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -287, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -256, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -289, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -258, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -291, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -260, 0},
+    {17, 16, 0, 0, 0, 0, 0, -300, -300, 0, -268, -300, 0, -268},
+    {17, 16, 0, 0, 0, 0, 0, 195, 195, 0, 0, 195, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 210, 210, 210, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 206, 206, 206, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 205, 205, 205, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 79, 79, 79, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 202, 202, 202, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 203, 203, 203, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 207, 207, 207, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, 97, 97, 0, 0, 97, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 211, 211, 211, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 209, 209, 209, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, 163, 163, 0, 0, 163, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 213, 213, 213, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, 130, 130, 0, 0, 130, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 214, 214, 214, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -337, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -306, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 218, 218, 218, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -346, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -315, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 217, 217, 217, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 219, 219, 219, 0, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, 56, 56, 0, 0, 56, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 0, -384},
+    {25, 16, 0, 0, 0, 0, 0, -1, 0, 1, 1, 0, 0, -385},
+    {17, 16, 0, 0, 0, 0, 0, -2, -1, 0, 0, -2, 0, -354},
+    {9, 16, 0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 0, -379},
+    {25, 16, 0, 0, 0, 0, 0, -1, 0, 1, 1, 0, 0, -380},
+    {17, 16, 0, 0, 0, 0, 0, -2, -1, 0, 0, -2, 0, -349},
+    {9, 16, 0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 0, -380},
+    {25, 16, 0, 0, 0, 0, 0, -1, 0, 1, 1, 0, 0, -381},
+    {17, 16, 0, 0, 0, 0, 0, -2, -1, 0, 0, -2, 0, -350},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -396, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -365, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -390, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -359, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -386, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -355, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -382, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -351, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -251, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -220, 0},
+    {17, 16, 0, 0, 0, 0, 0, -79, -79, 0, 0, -79, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -282, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -251, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 70, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 70, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -284, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -253, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -415, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -384, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -413, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -382, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -411, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -380, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -2, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -2, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -55, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 163, 0},
+    {17, 16, 7, 7, 0, 10, 7, 0, 0, 0, 0, 0, -390, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 0, -429},
+    {25, 16, 0, 0, 0, 0, 0, -1, 0, 1, 1, 0, 0, -430},
+    {17, 16, 0, 0, 0, 0, 0, -2, -1, 0, 0, -2, 0, -399},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -429, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -398, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -97, -97, -97, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -56, -56, -56, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -426, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -395, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -309, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -278, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -310, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -279, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -294, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -263, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -447, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -416, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -449, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -418, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -445, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -414, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -446, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -415, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -448, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -417, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -453, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -422, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -454, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -423, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -470, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -439, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -130, -130, -130, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -485, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -454, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -483, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -452, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -340, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -309, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -343, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -312, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -479, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -448, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -473, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -442, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 10795, 10795, 10795, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -163, -163, -163, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 10792, 10792, 10792, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, 10815, 10815, 0, 0, 10815, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -195, -195, -195, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 69, 69, 69, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 71, 71, 71, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, 10783, 10783, 0, 0, 10783, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, 10780, 10780, 0, 0, 10780, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, 10782, 10782, 0, 0, 10782, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -210, -210, 0, 0, -210, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -206, -206, 0, 0, -206, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -205, -205, 0, 0, -205, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -202, -202, 0, 0, -202, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -203, -203, 0, 0, -203, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, 42319, 42319, 0, 0, 42319, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, 42315, 42315, 0, 0, 42315, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -207, -207, 0, 0, -207, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, 42280, 42280, 0, 0, 42280, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, 42308, 42308, 0, 0, 42308, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -209, -209, 0, 0, -209, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -211, -211, 0, 0, -211, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, 10743, 10743, 0, 0, 10743, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, 42305, 42305, 0, 0, 42305, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, 10749, 10749, 0, 0, 10749, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -213, -213, 0, 0, -213, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -214, -214, 0, 0, -214, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, 10727, 10727, 0, 0, 10727, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -218, -218, 0, 0, -218, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, 42307, 42307, 0, 0, 42307, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, 42282, 42282, 0, 0, 42282, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -69, -69, 0, 0, -69, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -217, -217, 0, 0, -217, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -71, -71, 0, 0, -71, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -219, -219, 0, 0, -219, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, 42261, 42261, 0, 0, 42261, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, 42258, 42258, 0, 0, 42258, 0, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -584},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -577},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -59},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -58},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -53},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -576},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -575},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -696},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -697},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -698},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -699},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -700},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -701},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -629},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -623},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -619},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -79},
     {2, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
     {2, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64, 0},
     {2, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -48, 0},
     {2, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -60, 0},
     {2, 5, 0, 0, 0, 0, 0, 84, 84, 0, 116, 0, 0, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -187, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -858},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -835, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 116, 116, 116, 0, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -868},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -733, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 38, 38, 38, 11, 0},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -720, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 13, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 14, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 15, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 64, 64, 64, 19, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 63, 63, 63, 23, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 63, 63, 63, 26, 0},
-    {17, 0, 10, 10, 0, 13, 10, 0, 0, 0, 0, 0, 58, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, -17, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, -6, 0},
-    {17, 0, 0, 0, 0, 0, 0, -38, -38, 0, 0, -38, 5, 0},
-    {17, 0, 0, 0, 0, 0, 0, -37, -37, 0, 0, -37, 8, 0},
-    {17, 0, 0, 0, 0, 0, 0, -37, -37, 0, 0, -37, 9, 0},
-    {17, 0, 0, 0, 0, 0, 0, -37, -37, 0, 0, -37, 10, 0},
-    {17, 0, 14, 14, 0, 17, 14, 0, 0, 0, 0, 0, 27, 0},
-    {17, 0, 0, 0, 0, 0, 0, -31, -31, 0, 1, -31, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -32, -32, 0, 0, -32, -17, 0},
-    {17, 0, 0, 0, 0, 0, 0, -32, -32, 0, 0, -32, -6, 0},
-    {17, 0, 0, 0, 0, 0, 0, -64, -64, 0, 0, -64, -13, 0},
-    {17, 0, 0, 0, 0, 0, 0, -63, -63, 0, 0, -63, -8, 0},
-    {17, 0, 0, 0, 0, 0, 0, -63, -63, 0, 0, -63, -5, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -62, -62, 0, -30, -62, 0, -30},
-    {17, 0, 0, 0, 0, 0, 0, -57, -57, 0, -25, -57, 0, -25},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -45},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0},
-    {17, 0, 0, 0, 0, 0, 0, -47, -47, 0, -15, -47, 0, -15},
-    {17, 0, 0, 0, 0, 0, 0, -54, -54, 0, -22, -54, 0, -22},
-    {17, 0, 0, 0, 0, 0, 0, -8, -8, 0, 0, -8, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -86, -86, 0, -54, -86, 0, -54},
-    {17, 0, 0, 0, 0, 0, 0, -80, -80, 0, -48, -80, 0, -48},
-    {17, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 7, 0, -48},
-    {17, 0, 0, 0, 0, 0, 0, -116, -116, 0, 0, -116, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -60, -60, -60, 0, -92},
-    {17, 0, 0, 0, 0, 0, 0, -96, -96, 0, -64, -96, 0, -64},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, 0, -86},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 80, 80, 80, 21, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 80, 80, 80, 20, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 80, 80, 80, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 80, 80, 80, 16, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 80, 80, 80, -1, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 80, 80, 80, 14, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 80, 80, 80, 11, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, -1, 0},
-    {17, 0, 0, 0, 0, 0, 0, -32, -32, 0, 0, -32, -1, 0},
-    {17, 0, 0, 0, 0, 0, 0, -80, -80, 0, 0, -80, -27, 0},
-    {17, 0, 0, 0, 0, 0, 0, -80, -80, 0, 0, -80, -28, 0},
-    {17, 0, 0, 0, 0, 0, 0, -80, -80, 0, 0, -80, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -80, -80, 0, 0, -80, -32, 0},
-    {17, 0, 0, 0, 0, 0, 0, -80, -80, 0, 0, -80, -1, 0},
-    {17, 0, 0, 0, 0, 0, 0, -80, -80, 0, 0, -80, -34, 0},
-    {17, 0, 0, 0, 0, 0, 0, -80, -80, 0, 0, -80, -37, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15, 15, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -171, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -140, 0},
-    {17, 0, 0, 0, 0, 0, 0, -15, -15, 0, 0, -15, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -192, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -161, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -194, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -163, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -198, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -167, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -204, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -173, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -200, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -169, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -203, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -172, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 48, 48, 48, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -48, -48, 0, 0, -48, 0, 0},
-    {17, 0, 18, 18, 0, 21, 18, 0, 0, 0, 0, 0, 0, -34},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -187, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -858},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -835, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 116, 116, 116, 0, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -868},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -733, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 38, 38, 38, 11, 0},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -720, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 13, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 14, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 15, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 64, 64, 64, 19, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 63, 63, 63, 23, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 63, 63, 63, 26, 0},
+    {17, 16, 10, 10, 0, 13, 10, 0, 0, 0, 0, 0, 58, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, -17, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, -6, 0},
+    {17, 16, 0, 0, 0, 0, 0, -38, -38, 0, 0, -38, 5, 0},
+    {17, 16, 0, 0, 0, 0, 0, -37, -37, 0, 0, -37, 8, 0},
+    {17, 16, 0, 0, 0, 0, 0, -37, -37, 0, 0, -37, 9, 0},
+    {17, 16, 0, 0, 0, 0, 0, -37, -37, 0, 0, -37, 10, 0},
+    {17, 16, 14, 14, 0, 17, 14, 0, 0, 0, 0, 0, 27, 0},
+    {17, 16, 0, 0, 0, 0, 0, -31, -31, 0, 1, -31, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -32, -32, 0, 0, -32, -17, 0},
+    {17, 16, 0, 0, 0, 0, 0, -32, -32, 0, 0, -32, -6, 0},
+    {17, 16, 0, 0, 0, 0, 0, -64, -64, 0, 0, -64, -13, 0},
+    {17, 16, 0, 0, 0, 0, 0, -63, -63, 0, 0, -63, -8, 0},
+    {17, 16, 0, 0, 0, 0, 0, -63, -63, 0, 0, -63, -5, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -62, -62, 0, -30, -62, 0, -30},
+    {17, 16, 0, 0, 0, 0, 0, -57, -57, 0, -25, -57, 0, -25},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -45},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+    {17, 16, 0, 0, 0, 0, 0, -47, -47, 0, -15, -47, 0, -15},
+    {17, 16, 0, 0, 0, 0, 0, -54, -54, 0, -22, -54, 0, -22},
+    {17, 16, 0, 0, 0, 0, 0, -8, -8, 0, 0, -8, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -86, -86, 0, -54, -86, 0, -54},
+    {17, 16, 0, 0, 0, 0, 0, -80, -80, 0, -48, -80, 0, -48},
+    {17, 16, 0, 0, 0, 0, 0, 7, 7, 0, 0, 7, 0, -48},
+    {17, 16, 0, 0, 0, 0, 0, -116, -116, 0, 0, -116, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -60, -60, -60, 0, -92},
+    {17, 16, 0, 0, 0, 0, 0, -96, -96, 0, -64, -96, 0, -64},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, 0, -86},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 80, 80, 80, 21, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 80, 80, 80, 20, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 80, 80, 80, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 80, 80, 80, 16, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 80, 80, 80, -1, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 80, 80, 80, 14, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 80, 80, 80, 11, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, -1, 0},
+    {17, 16, 0, 0, 0, 0, 0, -32, -32, 0, 0, -32, -1, 0},
+    {17, 16, 0, 0, 0, 0, 0, -80, -80, 0, 0, -80, -27, 0},
+    {17, 16, 0, 0, 0, 0, 0, -80, -80, 0, 0, -80, -28, 0},
+    {17, 16, 0, 0, 0, 0, 0, -80, -80, 0, 0, -80, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -80, -80, 0, 0, -80, -32, 0},
+    {17, 16, 0, 0, 0, 0, 0, -80, -80, 0, 0, -80, -1, 0},
+    {17, 16, 0, 0, 0, 0, 0, -80, -80, 0, 0, -80, -34, 0},
+    {17, 16, 0, 0, 0, 0, 0, -80, -80, 0, 0, -80, -37, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 15, 15, 15, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -171, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -140, 0},
+    {17, 16, 0, 0, 0, 0, 0, -15, -15, 0, 0, -15, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -192, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -161, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -194, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -163, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -198, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -167, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -204, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -173, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -200, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -169, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -203, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -172, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 48, 48, 48, 0, 0},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -48, -48, 0, 0, -48, 0, 0},
+    {17, 16, 18, 18, 0, 21, 18, 0, 0, 0, 0, 0, 0, -34},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
     {0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -78},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -46},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0},
-    {2, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -67, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -59, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -51, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -48, 0},
-    {2, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0},
-    {2, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0},
-    {2, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0},
-    {2, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -78},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -46},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+    {2, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -67, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -59, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -51, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -48, 0},
+    {2, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0},
+    {2, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {2, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+    {2, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6, 0},
     {2, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0},
-    {2, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+    {2, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0},
     {1, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {2, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0},
-    {1, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -49},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -50},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41, 0},
+    {2, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -49},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -50},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41, 0},
     {2, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0},
     {2, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 0},
     {2, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59},
@@ -676,3233 +701,3265 @@ static const tmu_ucd_internal tmu_ucd_entries[3663] = {
     {2, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -16, 0},
     {2, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0},
     {2, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41, 0},
-    {2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 7264, 7264, 7264, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, 3008, 0, 0, 0, 3008, 0, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32},
-    {1, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {1, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {1, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 38864, 0, 38864, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 8, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -8, -8, 0, -8, -8, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -6254, -6254, 0, -6222, -6254, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -6253, -6253, 0, -6221, -6253, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -6244, -6244, 0, -6212, -6244, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -6242, -6242, 0, -6210, -6242, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -6243, -6243, 0, -6211, -6243, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -6236, -6236, 0, -6204, -6236, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -6181, -6181, 0, -6180, -6181, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, 35266, 35266, 0, 35267, 35266, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -3008, -3008, -3008, 0, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7403},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7271},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7404},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7076},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7405},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6939},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7406},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7394},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6900},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -68},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7397},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7396},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6897},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6896},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7398},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7395},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7174},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6911},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -60},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6891},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -55},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6571},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6554},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7417},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7409},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7407},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6580},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6567},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6563},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6459},
-    {17, 0, 0, 0, 0, 0, 0, 35332, 35332, 0, 0, 35332, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, 3814, 3814, 0, 0, 3814, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, 35384, 35384, 0, 0, 35384, 0, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6985},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7481},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6984},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7342},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6979},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7482},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6978},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6977},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6974},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6972},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -44},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6923},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6924},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6971},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6973},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6970},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6961},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7178},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6957},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -156},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6958},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7489},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6956},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6663},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7615, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7584, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7616, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7585, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7618, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7587, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7620, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7589, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7489, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7458, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7622, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7591, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7624, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7593, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7626, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7595, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7628, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7597, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7630, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7599, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7426, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7426, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7428, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7428, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7635, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7604, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7637, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7606, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7156, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7156, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7640, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7609, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7641, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7610, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7642, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7611, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7644, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7613, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7646, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7615, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7648, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7617, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7650, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7619, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7651, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7620, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7519, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7488, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7653, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7622, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7655, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7624, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7657, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7626, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7658, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7627, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7662, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7631, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7664, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7633, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7665, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7634, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7667, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7636, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7669, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7638, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7670, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7639, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7672, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7641, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7674, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7643, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7676, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7645, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7543, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7512, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7545, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7514, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7430, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7430, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7684, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7653, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7686, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7655, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7688, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7657, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7692, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7661, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7693, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7662, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7695, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7664, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7434, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7434, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -6, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -6, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7702, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7671, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7704, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7673, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7706, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7675, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7708, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7677, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7709, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7678, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7711, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7680, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7713, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7682, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7440, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7440, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7718, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7687, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7720, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7689, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7721, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7690, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7723, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7692, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7725, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7694, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7727, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7696, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7729, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7698, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7730, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7699, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7732, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7701, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7733, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7702, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7734, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7703, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7736, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7705, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7738, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7707, 0},
-    {17, 0, 21, 21, 0, 24, 21, 0, 0, 0, 0, 0, -7726, 0},
-    {17, 0, 24, 24, 0, 27, 24, 0, 0, 0, 0, 0, -7715, 0},
-    {17, 0, 27, 27, 0, 30, 27, 0, 0, 0, 0, 0, -7713, 0},
-    {17, 0, 30, 30, 0, 33, 30, 0, 0, 0, 0, 0, -7712, 0},
-    {17, 0, 33, 33, 0, 36, 33, 0, 0, 0, 0, 0, 0, -7737},
-    {17, 0, 0, 0, 0, 0, 0, -59, -59, 0, -58, -59, -7452, 0},
-    {9, 0, 0, 0, 0, 1, 0, 0, 0, -7615, -7615, -7615, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7775, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7744, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7777, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7746, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7652, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7621, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7654, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7623, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7656, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7625, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -12, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -12, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7596, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7596, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7598, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7598, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7600, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7600, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7602, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7602, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -22, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -22, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7795, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7764, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7797, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7766, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7799, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7768, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7668, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7637, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -14, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -14, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7807, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7776, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7809, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7778, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7805, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7774, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7678, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7647, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7680, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7649, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7682, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7651, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7482, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7482, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7484, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7484, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7486, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7486, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7488, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7490, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7490, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7823, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7792, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7825, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7794, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7481, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7481, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7483, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7483, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7485, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7485, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7487, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7487, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7489, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7833, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7802, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7835, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7804, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7837, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7806, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7839, 0},
-    {17, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7808, 0},
-    {17, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -6991, 0},
-    {17, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -6992, 0},
-    {17, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -2, 0},
-    {17, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -4, 0},
-    {17, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -6, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7031, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7032, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -2, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -4, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -6, 0},
-    {17, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7003, 0},
-    {17, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7004, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7043, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7044, 0},
-    {17, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7017, 0},
-    {17, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7018, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7057, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7058, 0},
-    {17, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7031, 0},
-    {17, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7032, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7071, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7072, 0},
-    {17, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7041, 0},
-    {17, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7042, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7081, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7082, 0},
-    {17, 0, 36, 36, 0, 39, 36, 0, 0, 0, 0, 0, -7051, 0},
-    {17, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7052, 0},
-    {17, 0, 39, 39, 0, 42, 39, 0, 0, 0, 0, 0, -2, 0},
-    {17, 0, 43, 43, 0, 46, 43, 0, 0, 0, 0, 0, -4, 0},
-    {17, 0, 47, 47, 0, 50, 47, 0, 0, 0, 0, 0, -6, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7092, 0},
-    {17, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7063, 0},
-    {17, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7064, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7103, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7104, 0},
-    {17, 0, 0, 0, 0, 0, 0, 74, 74, 0, 0, 74, -7103, 0},
-    {17, 0, 0, 0, 0, 0, 0, 74, 74, 0, 0, 74, -7109, 0},
-    {17, 0, 0, 0, 0, 0, 0, 86, 86, 0, 0, 86, -7101, 0},
-    {17, 0, 0, 0, 0, 0, 0, 86, 86, 0, 0, 86, -7110, 0},
-    {17, 0, 0, 0, 0, 0, 0, 86, 86, 0, 0, 86, -7111, 0},
-    {17, 0, 0, 0, 0, 0, 0, 100, 100, 0, 0, 100, -7101, 0},
-    {17, 0, 0, 0, 0, 0, 0, 100, 100, 0, 0, 100, -7112, 0},
-    {17, 0, 0, 0, 0, 0, 0, 128, 128, 0, 0, 128, -7097, 0},
-    {17, 0, 0, 0, 0, 0, 0, 128, 128, 0, 0, 128, -7085, 0},
-    {17, 0, 0, 0, 0, 0, 0, 112, 112, 0, 0, 112, -7093, 0},
-    {17, 0, 0, 0, 0, 0, 0, 112, 112, 0, 0, 112, -7086, 0},
-    {17, 0, 0, 0, 0, 0, 0, 126, 126, 0, 0, 126, -7091, 0},
-    {17, 0, 0, 0, 0, 0, 0, 126, 126, 0, 0, 126, -7087, 0},
-    {17, 0, 51, 0, 0, 54, 51, 8, 8, 0, 0, 8, -128, 0},
-    {17, 0, 54, 0, 0, 57, 54, 8, 8, 0, 0, 8, -128, 0},
-    {17, 0, 57, 0, 0, 60, 57, 8, 8, 0, 0, 8, -128, 0},
-    {17, 0, 60, 0, 0, 63, 60, 8, 8, 0, 0, 8, -128, 0},
-    {17, 0, 63, 0, 0, 66, 63, 8, 8, 0, 0, 8, -128, 0},
-    {17, 0, 66, 0, 0, 69, 66, 8, 8, 0, 0, 8, -128, 0},
-    {17, 0, 69, 0, 0, 72, 69, 8, 8, 0, 0, 8, -128, 0},
-    {17, 0, 72, 0, 0, 75, 72, 8, 8, 0, 0, 8, -128, 0},
-    {25, 0, 51, 0, 0, 54, 0, 0, 0, -8, -8, 0, -128, 0},
-    {25, 0, 54, 0, 0, 57, 0, 0, 0, -8, -8, 0, -128, 0},
-    {25, 0, 57, 0, 0, 60, 0, 0, 0, -8, -8, 0, -128, 0},
-    {25, 0, 60, 0, 0, 63, 0, 0, 0, -8, -8, 0, -128, 0},
-    {25, 0, 63, 0, 0, 66, 0, 0, 0, -8, -8, 0, -128, 0},
-    {25, 0, 66, 0, 0, 69, 0, 0, 0, -8, -8, 0, -128, 0},
-    {25, 0, 69, 0, 0, 72, 0, 0, 0, -8, -8, 0, -128, 0},
-    {25, 0, 72, 0, 0, 75, 0, 0, 0, -8, -8, 0, -128, 0},
-    {17, 0, 75, 0, 0, 78, 75, 8, 8, 0, 0, 8, -112, 0},
-    {17, 0, 78, 0, 0, 81, 78, 8, 8, 0, 0, 8, -112, 0},
-    {17, 0, 81, 0, 0, 84, 81, 8, 8, 0, 0, 8, -112, 0},
-    {17, 0, 84, 0, 0, 87, 84, 8, 8, 0, 0, 8, -112, 0},
-    {17, 0, 87, 0, 0, 90, 87, 8, 8, 0, 0, 8, -112, 0},
-    {17, 0, 90, 0, 0, 93, 90, 8, 8, 0, 0, 8, -112, 0},
-    {17, 0, 93, 0, 0, 96, 93, 8, 8, 0, 0, 8, -112, 0},
-    {17, 0, 96, 0, 0, 99, 96, 8, 8, 0, 0, 8, -112, 0},
-    {25, 0, 75, 0, 0, 78, 0, 0, 0, -8, -8, 0, -112, 0},
-    {25, 0, 78, 0, 0, 81, 0, 0, 0, -8, -8, 0, -112, 0},
-    {25, 0, 81, 0, 0, 84, 0, 0, 0, -8, -8, 0, -112, 0},
-    {25, 0, 84, 0, 0, 87, 0, 0, 0, -8, -8, 0, -112, 0},
-    {25, 0, 87, 0, 0, 90, 0, 0, 0, -8, -8, 0, -112, 0},
-    {25, 0, 90, 0, 0, 93, 0, 0, 0, -8, -8, 0, -112, 0},
-    {25, 0, 93, 0, 0, 96, 0, 0, 0, -8, -8, 0, -112, 0},
-    {25, 0, 96, 0, 0, 99, 0, 0, 0, -8, -8, 0, -112, 0},
-    {17, 0, 99, 0, 0, 102, 99, 8, 8, 0, 0, 8, -64, 0},
-    {17, 0, 102, 0, 0, 105, 102, 8, 8, 0, 0, 8, -64, 0},
-    {17, 0, 105, 0, 0, 108, 105, 8, 8, 0, 0, 8, -64, 0},
-    {17, 0, 108, 0, 0, 111, 108, 8, 8, 0, 0, 8, -64, 0},
-    {17, 0, 111, 0, 0, 114, 111, 8, 8, 0, 0, 8, -64, 0},
-    {17, 0, 114, 0, 0, 117, 114, 8, 8, 0, 0, 8, -64, 0},
-    {17, 0, 117, 0, 0, 120, 117, 8, 8, 0, 0, 8, -64, 0},
-    {17, 0, 120, 0, 0, 123, 120, 8, 8, 0, 0, 8, -64, 0},
-    {25, 0, 99, 0, 0, 102, 0, 0, 0, -8, -8, 0, -64, 0},
-    {25, 0, 102, 0, 0, 105, 0, 0, 0, -8, -8, 0, -64, 0},
-    {25, 0, 105, 0, 0, 108, 0, 0, 0, -8, -8, 0, -64, 0},
-    {25, 0, 108, 0, 0, 111, 0, 0, 0, -8, -8, 0, -64, 0},
-    {25, 0, 111, 0, 0, 114, 0, 0, 0, -8, -8, 0, -64, 0},
-    {25, 0, 114, 0, 0, 117, 0, 0, 0, -8, -8, 0, -64, 0},
-    {25, 0, 117, 0, 0, 120, 0, 0, 0, -8, -8, 0, -64, 0},
-    {25, 0, 120, 0, 0, 123, 0, 0, 0, -8, -8, 0, -64, 0},
-    {17, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7167, 0},
-    {17, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7168, 0},
-    {17, 0, 123, 51, 0, 126, 123, 0, 0, 0, 0, 0, -66, 0},
-    {17, 0, 126, 0, 0, 129, 126, 9, 9, 0, 0, 9, -7170, 0},
-    {17, 0, 129, 54, 0, 132, 129, 0, 0, 0, 0, 0, -7176, 0},
-    {17, 0, 132, 57, 0, 135, 132, 0, 0, 0, 0, 0, -7173, 0},
-    {17, 0, 135, 60, 0, 138, 135, 0, 0, 0, 0, 0, -1, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7207, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7208, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -74, -74, -74, -7209, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -74, -74, -74, -7221, 0},
-    {25, 0, 126, 0, 0, 129, 0, 0, 0, -9, -9, 0, -7211, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8093},
-    {17, 0, 0, 0, 0, 0, 0, -7205, -7205, 0, -7173, -7205, -7173, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8095},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8096},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7961, 0},
-    {17, 0, 139, 64, 0, 142, 139, 0, 0, 0, 0, 0, -78, 0},
-    {17, 0, 142, 0, 0, 145, 142, 9, 9, 0, 0, 9, -7180, 0},
-    {17, 0, 145, 67, 0, 148, 145, 0, 0, 0, 0, 0, -7190, 0},
-    {17, 0, 148, 70, 0, 151, 148, 0, 0, 0, 0, 0, -7183, 0},
-    {17, 0, 151, 73, 0, 154, 151, 0, 0, 0, 0, 0, -1, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -86, -86, -86, -7219, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -86, -86, -86, -7233, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -86, -86, -86, -7234, 0},
-    {25, 0, 142, 0, 0, 145, 0, 0, 0, -9, -9, 0, -7221, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -14, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -15, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -16, 0},
-    {17, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7191, 0},
-    {17, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7192, 0},
-    {17, 0, 155, 77, 0, 158, 155, 0, 0, 0, 0, 0, -7176, 0},
-    {17, 0, 10, 10, 0, 13, 10, 0, 0, 0, 0, 0, -7235, 0},
-    {17, 0, 159, 81, 0, 162, 159, 0, 0, 0, 0, 0, -7197, 0},
-    {17, 0, 162, 84, 0, 165, 162, 0, 0, 0, 0, 0, -7181, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7231, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7232, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -100, -100, -100, -7233, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -100, -100, -100, -7249, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0},
-    {17, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7195, 0},
-    {17, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7196, 0},
-    {17, 0, 166, 88, 0, 169, 166, 0, 0, 0, 0, 0, -7191, 0},
-    {17, 0, 14, 14, 0, 17, 14, 0, 0, 0, 0, 0, -7219, 0},
-    {17, 0, 170, 92, 0, 173, 170, 0, 0, 0, 0, 0, -7203, 0},
-    {17, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 7, -7204, 0},
-    {17, 0, 173, 95, 0, 176, 173, 0, 0, 0, 0, 0, -7201, 0},
-    {17, 0, 176, 98, 0, 179, 176, 0, 0, 0, 0, 0, -7196, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7235, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7236, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -112, -112, -112, -7237, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -112, -112, -112, -7261, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7243, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8005, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7273, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8079, 0},
-    {17, 0, 180, 102, 0, 183, 180, 0, 0, 0, 0, 0, -118, 0},
-    {17, 0, 183, 0, 0, 186, 183, 9, 9, 0, 0, 9, -7210, 0},
-    {17, 0, 186, 105, 0, 189, 186, 0, 0, 0, 0, 0, -7206, 0},
-    {17, 0, 189, 108, 0, 192, 189, 0, 0, 0, 0, 0, -7213, 0},
-    {17, 0, 192, 111, 0, 195, 192, 0, 0, 0, 0, 0, -1, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -128, -128, -128, -7257, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -128, -128, -128, -7277, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -126, -126, -126, -7249, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -126, -126, -126, -7276, 0},
-    {25, 0, 183, 0, 0, 186, 0, 0, 0, -9, -9, 0, -7251, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8009, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8158},
-    {70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0},
-    {70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8162},
-    {70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8163},
-    {70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8164},
-    {70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8165},
-    {70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8166},
-    {70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8167},
-    {70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8168},
-    {70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8169},
-    {70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8170},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+    {2, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 7264, 7264, 7264, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, 3008, 0, 0, 0, 3008, 0, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32},
+    {1, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 38864, 0, 38864, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 8, 0, 8, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -8, -8, 0, -8, -8, 0, 0},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -6254, -6254, 0, -6222, -6254, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -6253, -6253, 0, -6221, -6253, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -6244, -6244, 0, -6212, -6244, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -6242, -6242, 0, -6210, -6242, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -6243, -6243, 0, -6211, -6243, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -6236, -6236, 0, -6204, -6236, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -6181, -6181, 0, -6180, -6181, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, 35266, 35266, 0, 35267, 35266, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -3008, -3008, -3008, 0, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7403},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7271},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7404},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7076},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7405},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6939},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7406},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7394},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6900},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -68},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7397},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7396},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6897},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6896},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7398},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7395},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7174},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6911},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -60},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6891},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -55},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6571},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6554},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7417},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7409},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7407},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6580},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6567},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6563},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6459},
+    {17, 16, 0, 0, 0, 0, 0, 35332, 35332, 0, 0, 35332, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, 3814, 3814, 0, 0, 3814, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, 35384, 35384, 0, 0, 35384, 0, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6985},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7481},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6984},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7342},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6979},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7482},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6978},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6977},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6974},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6972},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -44},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6923},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6924},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6971},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6973},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6970},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6961},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7178},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6957},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -156},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6958},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7489},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6956},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6663},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7615, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7584, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7616, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7585, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7618, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7587, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7620, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7589, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7489, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7458, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7622, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7591, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7624, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7593, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7626, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7595, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7628, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7597, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7630, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7599, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7426, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7426, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7428, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7428, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7635, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7604, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7637, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7606, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7156, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7156, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7640, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7609, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7641, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7610, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7642, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7611, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7644, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7613, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7646, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7615, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7648, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7617, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7650, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7619, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7651, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7620, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7519, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7488, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7653, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7622, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7655, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7624, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7657, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7626, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7658, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7627, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7662, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7631, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7664, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7633, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7665, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7634, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7667, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7636, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7669, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7638, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7670, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7639, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7672, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7641, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7674, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7643, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7676, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7645, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7543, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7512, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7545, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7514, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7430, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7430, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7684, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7653, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7686, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7655, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7688, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7657, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7692, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7661, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7693, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7662, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7695, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7664, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7434, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7434, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -6, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -6, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7702, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7671, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7704, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7673, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7706, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7675, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7708, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7677, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7709, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7678, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7711, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7680, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7713, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7682, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7440, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7440, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7718, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7687, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7720, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7689, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7721, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7690, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7723, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7692, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7725, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7694, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7727, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7696, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7729, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7698, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7730, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7699, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7732, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7701, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7733, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7702, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7734, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7703, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7736, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7705, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7738, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7707, 0},
+    {17, 16, 21, 21, 0, 24, 21, 0, 0, 0, 0, 0, -7726, 0},
+    {17, 16, 24, 24, 0, 27, 24, 0, 0, 0, 0, 0, -7715, 0},
+    {17, 16, 27, 27, 0, 30, 27, 0, 0, 0, 0, 0, -7713, 0},
+    {17, 16, 30, 30, 0, 33, 30, 0, 0, 0, 0, 0, -7712, 0},
+    {17, 16, 33, 33, 0, 36, 33, 0, 0, 0, 0, 0, 0, -7737},
+    {17, 16, 0, 0, 0, 0, 0, -59, -59, 0, -58, -59, -7452, 0},
+    {9, 16, 0, 0, 0, 1, 0, 0, 0, -7615, -7615, -7615, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7775, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7744, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7777, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7746, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7652, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7621, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7654, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7623, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7656, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7625, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -12, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -12, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7596, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7596, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7598, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7598, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7600, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7600, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7602, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7602, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -22, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -22, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7795, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7764, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7797, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7766, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7799, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7768, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7668, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7637, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -14, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -14, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7807, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7776, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7809, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7778, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7805, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7774, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7678, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7647, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7680, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7649, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7682, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7651, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7482, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7482, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7484, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7484, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7486, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7486, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7488, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7490, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7490, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7823, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7792, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7825, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7794, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7481, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7481, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7483, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7483, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7485, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7485, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7487, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7487, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7489, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7833, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7802, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7835, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7804, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7837, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7806, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -7839, 0},
+    {17, 16, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -7808, 0},
+    {17, 16, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -6991, 0},
+    {17, 16, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -6992, 0},
+    {17, 16, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -2, 0},
+    {17, 16, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -4, 0},
+    {17, 16, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -6, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7031, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7032, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -2, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -4, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -6, 0},
+    {17, 16, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7003, 0},
+    {17, 16, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7004, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7043, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7044, 0},
+    {17, 16, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7017, 0},
+    {17, 16, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7018, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7057, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7058, 0},
+    {17, 16, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7031, 0},
+    {17, 16, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7032, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7071, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7072, 0},
+    {17, 16, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7041, 0},
+    {17, 16, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7042, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7081, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7082, 0},
+    {17, 16, 36, 36, 0, 39, 36, 0, 0, 0, 0, 0, -7051, 0},
+    {17, 16, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7052, 0},
+    {17, 16, 39, 39, 0, 42, 39, 0, 0, 0, 0, 0, -2, 0},
+    {17, 16, 43, 43, 0, 46, 43, 0, 0, 0, 0, 0, -4, 0},
+    {17, 16, 47, 47, 0, 50, 47, 0, 0, 0, 0, 0, -6, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7092, 0},
+    {17, 16, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7063, 0},
+    {17, 16, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7064, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7103, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7104, 0},
+    {17, 16, 0, 0, 0, 0, 0, 74, 74, 0, 0, 74, -7103, 0},
+    {17, 16, 0, 0, 0, 0, 0, 74, 74, 0, 0, 74, -7109, 0},
+    {17, 16, 0, 0, 0, 0, 0, 86, 86, 0, 0, 86, -7101, 0},
+    {17, 16, 0, 0, 0, 0, 0, 86, 86, 0, 0, 86, -7110, 0},
+    {17, 16, 0, 0, 0, 0, 0, 86, 86, 0, 0, 86, -7111, 0},
+    {17, 16, 0, 0, 0, 0, 0, 100, 100, 0, 0, 100, -7101, 0},
+    {17, 16, 0, 0, 0, 0, 0, 100, 100, 0, 0, 100, -7112, 0},
+    {17, 16, 0, 0, 0, 0, 0, 128, 128, 0, 0, 128, -7097, 0},
+    {17, 16, 0, 0, 0, 0, 0, 128, 128, 0, 0, 128, -7085, 0},
+    {17, 16, 0, 0, 0, 0, 0, 112, 112, 0, 0, 112, -7093, 0},
+    {17, 16, 0, 0, 0, 0, 0, 112, 112, 0, 0, 112, -7086, 0},
+    {17, 16, 0, 0, 0, 0, 0, 126, 126, 0, 0, 126, -7091, 0},
+    {17, 16, 0, 0, 0, 0, 0, 126, 126, 0, 0, 126, -7087, 0},
+    {17, 16, 51, 0, 0, 54, 51, 8, 8, 0, 0, 8, -128, 0},
+    {17, 16, 54, 0, 0, 57, 54, 8, 8, 0, 0, 8, -128, 0},
+    {17, 16, 57, 0, 0, 60, 57, 8, 8, 0, 0, 8, -128, 0},
+    {17, 16, 60, 0, 0, 63, 60, 8, 8, 0, 0, 8, -128, 0},
+    {17, 16, 63, 0, 0, 66, 63, 8, 8, 0, 0, 8, -128, 0},
+    {17, 16, 66, 0, 0, 69, 66, 8, 8, 0, 0, 8, -128, 0},
+    {17, 16, 69, 0, 0, 72, 69, 8, 8, 0, 0, 8, -128, 0},
+    {17, 16, 72, 0, 0, 75, 72, 8, 8, 0, 0, 8, -128, 0},
+    {25, 16, 51, 0, 0, 54, 0, 0, 0, -8, -8, 0, -128, 0},
+    {25, 16, 54, 0, 0, 57, 0, 0, 0, -8, -8, 0, -128, 0},
+    {25, 16, 57, 0, 0, 60, 0, 0, 0, -8, -8, 0, -128, 0},
+    {25, 16, 60, 0, 0, 63, 0, 0, 0, -8, -8, 0, -128, 0},
+    {25, 16, 63, 0, 0, 66, 0, 0, 0, -8, -8, 0, -128, 0},
+    {25, 16, 66, 0, 0, 69, 0, 0, 0, -8, -8, 0, -128, 0},
+    {25, 16, 69, 0, 0, 72, 0, 0, 0, -8, -8, 0, -128, 0},
+    {25, 16, 72, 0, 0, 75, 0, 0, 0, -8, -8, 0, -128, 0},
+    {17, 16, 75, 0, 0, 78, 75, 8, 8, 0, 0, 8, -112, 0},
+    {17, 16, 78, 0, 0, 81, 78, 8, 8, 0, 0, 8, -112, 0},
+    {17, 16, 81, 0, 0, 84, 81, 8, 8, 0, 0, 8, -112, 0},
+    {17, 16, 84, 0, 0, 87, 84, 8, 8, 0, 0, 8, -112, 0},
+    {17, 16, 87, 0, 0, 90, 87, 8, 8, 0, 0, 8, -112, 0},
+    {17, 16, 90, 0, 0, 93, 90, 8, 8, 0, 0, 8, -112, 0},
+    {17, 16, 93, 0, 0, 96, 93, 8, 8, 0, 0, 8, -112, 0},
+    {17, 16, 96, 0, 0, 99, 96, 8, 8, 0, 0, 8, -112, 0},
+    {25, 16, 75, 0, 0, 78, 0, 0, 0, -8, -8, 0, -112, 0},
+    {25, 16, 78, 0, 0, 81, 0, 0, 0, -8, -8, 0, -112, 0},
+    {25, 16, 81, 0, 0, 84, 0, 0, 0, -8, -8, 0, -112, 0},
+    {25, 16, 84, 0, 0, 87, 0, 0, 0, -8, -8, 0, -112, 0},
+    {25, 16, 87, 0, 0, 90, 0, 0, 0, -8, -8, 0, -112, 0},
+    {25, 16, 90, 0, 0, 93, 0, 0, 0, -8, -8, 0, -112, 0},
+    {25, 16, 93, 0, 0, 96, 0, 0, 0, -8, -8, 0, -112, 0},
+    {25, 16, 96, 0, 0, 99, 0, 0, 0, -8, -8, 0, -112, 0},
+    {17, 16, 99, 0, 0, 102, 99, 8, 8, 0, 0, 8, -64, 0},
+    {17, 16, 102, 0, 0, 105, 102, 8, 8, 0, 0, 8, -64, 0},
+    {17, 16, 105, 0, 0, 108, 105, 8, 8, 0, 0, 8, -64, 0},
+    {17, 16, 108, 0, 0, 111, 108, 8, 8, 0, 0, 8, -64, 0},
+    {17, 16, 111, 0, 0, 114, 111, 8, 8, 0, 0, 8, -64, 0},
+    {17, 16, 114, 0, 0, 117, 114, 8, 8, 0, 0, 8, -64, 0},
+    {17, 16, 117, 0, 0, 120, 117, 8, 8, 0, 0, 8, -64, 0},
+    {17, 16, 120, 0, 0, 123, 120, 8, 8, 0, 0, 8, -64, 0},
+    {25, 16, 99, 0, 0, 102, 0, 0, 0, -8, -8, 0, -64, 0},
+    {25, 16, 102, 0, 0, 105, 0, 0, 0, -8, -8, 0, -64, 0},
+    {25, 16, 105, 0, 0, 108, 0, 0, 0, -8, -8, 0, -64, 0},
+    {25, 16, 108, 0, 0, 111, 0, 0, 0, -8, -8, 0, -64, 0},
+    {25, 16, 111, 0, 0, 114, 0, 0, 0, -8, -8, 0, -64, 0},
+    {25, 16, 114, 0, 0, 117, 0, 0, 0, -8, -8, 0, -64, 0},
+    {25, 16, 117, 0, 0, 120, 0, 0, 0, -8, -8, 0, -64, 0},
+    {25, 16, 120, 0, 0, 123, 0, 0, 0, -8, -8, 0, -64, 0},
+    {17, 16, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7167, 0},
+    {17, 16, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7168, 0},
+    {17, 16, 123, 51, 0, 126, 123, 0, 0, 0, 0, 0, -66, 0},
+    {17, 16, 126, 0, 0, 129, 126, 9, 9, 0, 0, 9, -7170, 0},
+    {17, 16, 129, 54, 0, 132, 129, 0, 0, 0, 0, 0, -7176, 0},
+    {17, 16, 132, 57, 0, 135, 132, 0, 0, 0, 0, 0, -7173, 0},
+    {17, 16, 135, 60, 0, 138, 135, 0, 0, 0, 0, 0, -1, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7207, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7208, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -74, -74, -74, -7209, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -74, -74, -74, -7221, 0},
+    {25, 16, 126, 0, 0, 129, 0, 0, 0, -9, -9, 0, -7211, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8093},
+    {17, 16, 0, 0, 0, 0, 0, -7205, -7205, 0, -7173, -7205, -7173, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8095},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8096},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7961, 0},
+    {17, 16, 139, 64, 0, 142, 139, 0, 0, 0, 0, 0, -78, 0},
+    {17, 16, 142, 0, 0, 145, 142, 9, 9, 0, 0, 9, -7180, 0},
+    {17, 16, 145, 67, 0, 148, 145, 0, 0, 0, 0, 0, -7190, 0},
+    {17, 16, 148, 70, 0, 151, 148, 0, 0, 0, 0, 0, -7183, 0},
+    {17, 16, 151, 73, 0, 154, 151, 0, 0, 0, 0, 0, -1, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -86, -86, -86, -7219, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -86, -86, -86, -7233, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -86, -86, -86, -7234, 0},
+    {25, 16, 142, 0, 0, 145, 0, 0, 0, -9, -9, 0, -7221, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -14, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -15, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -16, 0},
+    {17, 16, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7191, 0},
+    {17, 16, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7192, 0},
+    {17, 16, 155, 77, 0, 158, 155, 0, 0, 0, 0, 0, -7176, 0},
+    {17, 16, 10, 10, 0, 13, 10, 0, 0, 0, 0, 0, -7235, 0},
+    {17, 16, 159, 81, 0, 162, 159, 0, 0, 0, 0, 0, -7197, 0},
+    {17, 16, 162, 84, 0, 165, 162, 0, 0, 0, 0, 0, -7181, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7231, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7232, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -100, -100, -100, -7233, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -100, -100, -100, -7249, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0},
+    {17, 16, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7195, 0},
+    {17, 16, 0, 0, 0, 0, 0, 8, 8, 0, 0, 8, -7196, 0},
+    {17, 16, 166, 88, 0, 169, 166, 0, 0, 0, 0, 0, -7191, 0},
+    {17, 16, 14, 14, 0, 17, 14, 0, 0, 0, 0, 0, -7219, 0},
+    {17, 16, 170, 92, 0, 173, 170, 0, 0, 0, 0, 0, -7203, 0},
+    {17, 16, 0, 0, 0, 0, 0, 7, 7, 0, 0, 7, -7204, 0},
+    {17, 16, 173, 95, 0, 176, 173, 0, 0, 0, 0, 0, -7201, 0},
+    {17, 16, 176, 98, 0, 179, 176, 0, 0, 0, 0, 0, -7196, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7235, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -7236, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -112, -112, -112, -7237, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -112, -112, -112, -7261, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7243, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8005, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7273, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8079, 0},
+    {17, 16, 180, 102, 0, 183, 180, 0, 0, 0, 0, 0, -118, 0},
+    {17, 16, 183, 0, 0, 186, 183, 9, 9, 0, 0, 9, -7210, 0},
+    {17, 16, 186, 105, 0, 189, 186, 0, 0, 0, 0, 0, -7206, 0},
+    {17, 16, 189, 108, 0, 192, 189, 0, 0, 0, 0, 0, -7213, 0},
+    {17, 16, 192, 111, 0, 195, 192, 0, 0, 0, 0, 0, -1, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -128, -128, -128, -7257, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -128, -128, -128, -7277, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -126, -126, -126, -7249, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -126, -126, -126, -7276, 0},
+    {25, 16, 183, 0, 0, 186, 0, 0, 0, -9, -9, 0, -7251, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8009, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8158},
+    {70, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+    {70, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8162},
+    {70, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8163},
+    {70, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8164},
+    {70, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8165},
+    {70, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8166},
+    {70, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8167},
+    {70, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8168},
+    {70, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8169},
+    {70, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8170},
+    {0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
     {0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
     {0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8183},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8182},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8184},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8183},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8182},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8184},
     {70, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
     {6, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8207},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2},
-    {4, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8219},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8222},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8200},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8201},
-    {4, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8232},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37},
-    {70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8255},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8256},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8200},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8271},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 407},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8255},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8277},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8209},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8272},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8287},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 391},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8293},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8239},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8236},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8227},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8219},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7739},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8237},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8235},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8234},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8232},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8278},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8351},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8352},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8383},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8275},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8354},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8355},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8055},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8281},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8355},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8387},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8388},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8389},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8358},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8168},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8391},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8392},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8390},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8359},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8392},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8393},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8394},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8395},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8397},
-    {5, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8398},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -7517, -7517, -7517, -7549, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8398},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -8383, -8383, -8383, -8415, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -8262, -8262, -8262, -8294, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8426},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8394},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8427},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 28, 28, 28, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8422},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8389},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7013},
-    {17, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8400},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8437},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7548},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7562},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7595},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7583},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 209},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8449},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8418},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8415},
-    {17, 0, 0, 0, 0, 0, 0, -28, -28, 0, 0, -28, 0, 0},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8479},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8480},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8481},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8482},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8484},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8488},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8485},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8490},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8489},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8487},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8494},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, -8471},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, -8472},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, -8473},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, -8474},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, -8462},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, -8463},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, -8464},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, -8465},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, -8479},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, -8466},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, -8467},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, -8480},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, -8490},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, -8482},
-    {3, 0, 0, 0, 0, 0, 0, -16, -16, 0, 0, 0, 0, -8455},
-    {3, 0, 0, 0, 0, 0, 0, -16, -16, 0, 0, 0, 0, -8456},
-    {3, 0, 0, 0, 0, 0, 0, -16, -16, 0, 0, 0, 0, -8457},
-    {3, 0, 0, 0, 0, 0, 0, -16, -16, 0, 0, 0, 0, -8458},
-    {3, 0, 0, 0, 0, 0, 0, -16, -16, 0, 0, 0, 0, -8446},
-    {3, 0, 0, 0, 0, 0, 0, -16, -16, 0, 0, 0, 0, -8447},
-    {3, 0, 0, 0, 0, 0, 0, -16, -16, 0, 0, 0, 0, -8448},
-    {3, 0, 0, 0, 0, 0, 0, -16, -16, 0, 0, 0, 0, -8449},
-    {3, 0, 0, 0, 0, 0, 0, -16, -16, 0, 0, 0, 0, -8463},
-    {3, 0, 0, 0, 0, 0, 0, -16, -16, 0, 0, 0, 0, -8450},
-    {3, 0, 0, 0, 0, 0, 0, -16, -16, 0, 0, 0, 0, -8451},
-    {3, 0, 0, 0, 0, 0, 0, -16, -16, 0, 0, 0, 0, -8464},
-    {3, 0, 0, 0, 0, 0, 0, -16, -16, 0, 0, 0, 0, -8474},
-    {3, 0, 0, 0, 0, 0, 0, -16, -16, 0, 0, 0, 0, -8466},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8537},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -10, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8739, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8754, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8753, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -100, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -81, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -56, 0},
-    {5, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3295, 0},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9263},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9272},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9273},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9274},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9275},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9276},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9277},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9278},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9279},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9280},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9281},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9292},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9293},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9294},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9295},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9296},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9297},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9298},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9299},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9300},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9301},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9302},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9303},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9304},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9305},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9306},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9307},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9308},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9309},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9310},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9311},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9312},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9313},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9314},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9315},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9316},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9317},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9318},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9319},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9320},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9321},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9332},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9333},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9334},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9335},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9336},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9337},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9338},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9339},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9340},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9341},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9342},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9343},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9344},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9345},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9346},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9347},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9348},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9349},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9350},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9351},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9352},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9353},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9354},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9355},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9356},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9357},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 26, 26, 0, 0, -9333},
-    {5, 14, 0, 0, 0, 0, 0, 0, 0, 26, 26, 0, 0, -9333},
-    {5, 0, 0, 0, 0, 0, 0, -26, -26, 0, 0, 0, 0, -9327},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9402},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2017},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -10810},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -10808},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -10809},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -10743, -10743, -10743, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -3814, -3814, -3814, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -10727, -10727, -10727, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -10795, -10795, 0, 0, -10795, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -10792, -10792, 0, 0, -10792, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -10780, -10780, -10780, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -10749, -10749, -10749, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -10783, -10783, -10783, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -10782, -10782, -10782, 0, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -11282},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -11303},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -10815, -10815, -10815, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -7264, -7264, 0, 0, -7264, 0, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -14},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15662},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28844},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7936},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7975},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7988},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7996},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8021},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8064},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8070},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8089},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8114},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8758},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8795},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8800},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8822},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8841},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8861},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8913},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8933},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8943},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9097},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9190},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9217},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9221},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9250},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9258},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9284},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9296},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9320},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9371},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9388},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9414},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10169},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10699},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10721},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10728},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10738},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10755},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10830},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11306},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11353},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11472},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11494},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11512},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11533},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11586},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11588},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11949},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11958},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11969},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11981},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12096},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12103},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12107},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12223},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12232},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12244},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12251},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12311},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12327},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12344},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12423},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13003},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13048},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13068},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13807},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13811},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13893},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13908},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13920},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13940},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13978},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13982},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14248},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14271},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14302},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15317},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15382},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15404},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15461},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15484},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15492},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15498},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15549},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15553},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15584},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16662},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17108},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17119},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17123},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17126},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17133},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17150},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17151},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17231},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17446},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17450},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17788},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17797},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17846},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17852},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17860},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17867},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17957},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17963},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18190},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18196},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18244},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18260},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18306},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18542},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18548},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18564},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18890},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19015},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19020},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19201},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19287},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19332},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19709},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19841},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20414},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20440},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20496},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20546},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20613},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20623},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20628},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20660},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20735},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20744},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21089},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21095},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21103},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21111},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21126},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21140},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21143},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21221},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21224},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21229},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22209},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22238},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22706},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22717},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22739},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23021},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23033},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23103},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23148},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23714},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23728},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23742},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23776},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23812},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24010},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24021},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24087},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24334},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24364},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24572},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24592},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24596},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24815},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24998},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25122},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25127},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25131},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26064},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26072},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26227},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26380},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26382},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26428},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26532},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26544},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26547},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26553},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26650},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26683},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26688},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26701},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26867},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26917},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26920},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27102},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27104},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27122},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27373},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27420},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27426},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27495},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27504},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27506},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27515},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27544},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27938},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28337},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28346},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28383},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28404},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28411},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28420},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28423},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28462},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28465},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28481},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28485},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28497},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28523},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28537},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28544},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28602},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28616},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28619},
-    {70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12256},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {4, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8969},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8971},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -78, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12411},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12412},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -23},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -76},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8241},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8073},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8242},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8244},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8074},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8230},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8251},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8227},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8252},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8174},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8196},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8273},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8096},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8093},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8092},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8088},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8085},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8084},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8274},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8082},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8081},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8276},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8275},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8271},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8270},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8269},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8267},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8264},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8255},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8249},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8245},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8237},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8195},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8193},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8185},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8184},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8175},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8173},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7278},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7417},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7285},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9542},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7284},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7318},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7283},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17305},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7359},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7294},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7269},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10124},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9618},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7451},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12760},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12761},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12762},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12763},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12764},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12765},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12766},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12767},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12768},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12769},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12770},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12771},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12772},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12773},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12774},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12775},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12776},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12777},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12778},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12779},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12780},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12781},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12782},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12783},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12784},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12785},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12786},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12787},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12788},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12789},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12790},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12792},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12793},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12794},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12795},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12796},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12797},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12798},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12799},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12800},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12801},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12802},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12803},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12804},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12805},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12806},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12807},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12808},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12809},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12810},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12811},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12812},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12813},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12814},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12815},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12816},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12817},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12818},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12819},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12820},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12821},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12822},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12823},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12824},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12825},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12826},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12827},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8971},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11319},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13121},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18760},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12800},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12831},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12832},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12833},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12834},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12835},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12836},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12837},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12838},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12839},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12840},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12841},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12842},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12843},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12844},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8544},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8543},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8542},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8541},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8540},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8539},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8558},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8557},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8556},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8555},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8554},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8553},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8561},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8563},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7040},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7179},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7047},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9304},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7184},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7912},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7037},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7908},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7125},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8376},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13438},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15840},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14760},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13467},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24387},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9360},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13141},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13721},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13431},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18091},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8569},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16356},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23051},
-    {5, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18118},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8220},
-    {5, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18239},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17053},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9944},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24013},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7821},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8402},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14921},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25957},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7280},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7927},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14528},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7014},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7048},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7013},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11071},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8523},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8338},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10477},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10427},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17463},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7252},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23065},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8357},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9836},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12926},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12927},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12928},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12929},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12930},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12931},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12932},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12933},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12934},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12935},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12936},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12937},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12938},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12943},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12952},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12953},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12954},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12932},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12904},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12905},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12931},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -558},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -557},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -556},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -555},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -554},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -553},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -552},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -551},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -550},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -549},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -548},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -547},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -546},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -545},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -544},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -543},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -541},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -540},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -539},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -538},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -536},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -534},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -532},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -530},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -528},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -527},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -526},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -525},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -524},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7141},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -606},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -607},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -608},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -609},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -610},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -611},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -613},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -615},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -616},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -617},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -618},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -619},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -620},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -612},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -605},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -603},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -602},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -604},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -614},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13096},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13105},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13106},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13107},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13108},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13109},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13110},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13111},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13112},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13113},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13114},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13115},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13116},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13117},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13118},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13065},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13070},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13074},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13062},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13075},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13076},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13077},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11000},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12977},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9642},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12944},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13483},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13072},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12230},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13078},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13081},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13120},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13093},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13086},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13082},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13085},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12240},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12241},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13089},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13092},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13128},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13094},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13125},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13132},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12249},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13097},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13101},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13100},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12255},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13103},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13121},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13145},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13119},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13150},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13157},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13123},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12278},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13126},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13124},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13127},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12282},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13130},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13133},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13164},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12288},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13136},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13139},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13170},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13141},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13172},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13153},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13185},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13154},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13187},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13188},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13156},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13186},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13155},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13158},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13159},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13160},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13161},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13191},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13193},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13194},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13190},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13192},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13214},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13231},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13240},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13241},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13242},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13243},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13244},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13245},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13246},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13247},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13248},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13249},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13250},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13251},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13252},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13253},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13254},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13255},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13256},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13257},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13258},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13259},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13208},
-    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41554},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41553},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -35332, -35332, -35332, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -42280, -42280, -42280, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, 48, 48, 0, 0, 48, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -42308, -42308, -42308, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -42319, -42319, -42319, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -42315, -42315, -42315, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -42305, -42305, -42305, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -42258, -42258, -42258, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -42282, -42282, -42282, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -42261, -42261, -42261, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 928, 928, 928, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -48, -48, -48, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -42307, -42307, -42307, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, -35384, -35384, -35384, 0, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42706},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42662},
-    {17, 0, 0, 0, 0, 0, 0, -928, -928, 0, 0, -928, 0, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1077},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43251},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43228},
-    {17, 0, 0, 0, 0, 0, 0, -38864, -38864, 0, -38864, -38864, 0, 0},
-    {1, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {1, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27832, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37389, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27192, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27707, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35379, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43731, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42273, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -22891, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -22892, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40888, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26425, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41860, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40900, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38679, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33445, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31114, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29393, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29015, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28698, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26756, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36626, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35834, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34877, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34105, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29915, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26543, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -24361, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43673, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42407, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36377, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34563, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29426, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -23298, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39889, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35127, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29526, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28608, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38492, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30542, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28936, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39518, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37394, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35776, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34351, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26718, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43431, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42871, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42577, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37996, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36446, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34594, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33356, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31027, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29487, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29402, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27464, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25094, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -24010, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -23360, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32943, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32701, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31645, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30069, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26171, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -23233, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28267, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41059, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39487, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31972, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30919, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34532, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32893, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27782, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25170, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41074, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40169, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36665, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35699, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35391, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31776, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31513, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25350, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42624, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30920, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42872, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42889, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32570, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31641, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30055, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25316, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28122, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38540, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36698, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28255, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43813, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40312, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39246, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34266, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33778, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42572, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32873, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43430, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39357, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43866, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35996, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37873, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31816, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42408, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41230, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33388, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29989, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28357, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36278, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27073, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36074, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38517, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30351, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38357, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33809, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43721, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43023, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42928, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37113, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31892, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30477, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28331, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42634, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42302, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40974, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39574, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37822, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35206, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32859, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25561, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -24349, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -23281, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -23227, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42735, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37573, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36373, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27179, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39706, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38911, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38800, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38135, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35439, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34890, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34059, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32715, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31650, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31016, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27250, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29867, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26999, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26193, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42885, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42746, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42209, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35031, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28894, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28407, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39641, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39342, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38441, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36343, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32104, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34354, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43716, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41648, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40387, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39921, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39312, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34299, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34117, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31253, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31082, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26493, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25276, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25195, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -24988, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43562, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32776, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26627, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25344, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39128, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43828, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43233, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40398, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40318, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37925, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36797, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34802, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33663, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29894, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26951, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -23095, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37693, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25496, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42814, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37453, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37334, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35977, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35631, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34243, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33908, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33123, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31935, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -24946, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43108, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38820, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25435, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43433, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40124, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35820, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27309, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39501, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39061, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37315, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34388, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25430, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42932, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42447, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40314, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37837, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37523, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37178, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36094, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34270, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33795, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31341, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28952, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28935, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26653, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25352, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42668, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35634, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42448, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34846, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34135, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29686, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25422, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -23963, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -23380, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37469, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35882, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30734, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32556, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32472, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32103, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34618, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35170, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28324, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43837, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30408, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42949, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43001, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39771, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38703, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32045, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40575, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36071, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37714, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27340, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29116, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25532, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28799, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39736, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43212, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42061, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41398, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37790, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43063, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34540, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33613, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32988, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32955, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32949, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32908, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25286, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32095, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31329, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29710, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28458, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27117, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26921, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -24891, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -24879, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -24836, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -23673, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26960, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25464, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43650, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43338, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43237, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42858, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42832, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42724, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42137, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42033, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41936, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41465, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41362, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40407, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39337, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39126, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39089, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38990, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38130, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37984, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37810, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37311, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36046, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35884, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35621, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35034, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34344, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33210, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33038, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33028, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33030, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33023, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33018, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33012, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32965, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32788, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32724, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32406, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31843, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31823, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31768, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31464, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31318, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30831, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30692, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30693, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30216, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29008, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28875, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28513, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28049, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27997, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27312, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27183, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25477, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25194, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25135, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39414, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 84098, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30805, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -44106, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43196, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43274, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43763, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43311, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43253, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42927, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42877, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42203, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42276, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41506, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41418, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41274, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41259, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40990, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40793, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39856, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39850, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39707, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39640, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39225, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39296, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39163, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39210, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39065, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39000, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38601, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38514, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38461, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38202, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37917, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37755, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37752, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37694, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36636, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36572, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36182, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35773, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35790, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35704, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35453, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35118, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33526, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34921, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34800, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34678, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34352, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34204, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34152, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33927, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33926, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33756, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33740, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33716, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33631, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33642, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33247, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32763, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32493, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32307, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32084, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31932, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31603, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31405, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30561, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30405, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29500, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29045, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28977, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28962, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28666, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28610, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28656, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28603, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28607, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28625, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28550, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28470, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28089, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27530, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27217, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26923, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26703, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25674, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25572, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25458, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25326, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25291, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25280, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25233, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -24507, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -23346, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 77179, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 77172, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80132, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -48949, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -47803, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -47771, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 87924, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 90618, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 99324, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -23445, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -23371, 0},
-    {17, 0, 196, 115, 0, 199, 196, 0, 0, 0, 0, 0, 0, -64154},
-    {17, 0, 199, 118, 0, 202, 199, 0, 0, 0, 0, 0, 0, -64155},
-    {17, 0, 202, 121, 0, 205, 202, 0, 0, 0, 0, 0, 0, -64156},
-    {17, 0, 205, 124, 0, 208, 205, 0, 0, 0, 0, 0, 0, -64157},
-    {17, 0, 209, 128, 0, 212, 209, 0, 0, 0, 0, 0, 0, -64158},
-    {17, 0, 213, 132, 0, 216, 213, 0, 0, 0, 0, 0, 0, -63878},
-    {17, 0, 213, 132, 0, 216, 213, 0, 0, 0, 0, 0, 0, -64147},
-    {17, 0, 216, 135, 0, 219, 216, 0, 0, 0, 0, 0, 0, -62879},
-    {17, 0, 219, 138, 0, 222, 219, 0, 0, 0, 0, 0, 0, -62880},
-    {17, 0, 222, 141, 0, 225, 222, 0, 0, 0, 0, 0, 0, -62881},
-    {17, 0, 225, 144, 0, 228, 225, 0, 0, 0, 0, 0, 0, -62872},
-    {17, 0, 228, 147, 0, 231, 228, 0, 0, 0, 0, 0, 0, -62883},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62788, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62765, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62782},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62801},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62799},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62793},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62783},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64254},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62785, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62786, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62814, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62815, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62816, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62838, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62843, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62834, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62826, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62847},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62687},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62688},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62679},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62680},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62681},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62682},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62683},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62684},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62685},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62692},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62693},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62694},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62695},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62691},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62701},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62702},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62703},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62704},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62662},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62663},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62664},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62665},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62666},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62667},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62705},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62707},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62708},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62709},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62710},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62711},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62712},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62713},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62714},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62720},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62721},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62706},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62715},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62716},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62696},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62697},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62698},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62699},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62700},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62686},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62758},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62759},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62760},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62761},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62736},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62737},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62739},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62740},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62822},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62747},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62748},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62745},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62746},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62741},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62742},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62743},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62879},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62880},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62916},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62917},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62918},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62919},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62920},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62921},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62922},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62923},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62924},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62925},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62926},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62927},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62928},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62929},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62930},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62931},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62932},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62933},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62768},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62769},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62770},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62771},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62938},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62939},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62940},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62941},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62942},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62943},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62944},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62945},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62946},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62947},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62948},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62949},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62950},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62951},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62952},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62953},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62954},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62955},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62956},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62957},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62958},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62959},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62960},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62961},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62962},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62963},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62964},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62965},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62966},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62967},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62968},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62969},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62970},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62971},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62972},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62973},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62974},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62975},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62976},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62977},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62978},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62979},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62980},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62981},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62982},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62983},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62984},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62985},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62986},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62987},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62988},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62989},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62990},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62991},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62992},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63019},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62996},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64574},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64575},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64576},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64577},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64578},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64579},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63038},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63039},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63040},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63041},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63042},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63043},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63044},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63045},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63046},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63047},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63048},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63049},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63050},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63051},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63052},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63053},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63054},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63055},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63056},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63035},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63036},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63037},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63089},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63090},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63091},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63092},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63093},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63094},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63095},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63096},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63097},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63098},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63099},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63100},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63101},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63102},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63103},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63104},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63105},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63106},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63107},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63108},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63109},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63110},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63111},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63112},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63113},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63114},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63115},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63116},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63117},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63118},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63119},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63120},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63121},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63122},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63123},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63124},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63161},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63162},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63163},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63156},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63157},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63158},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63144},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63145},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63142},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63143},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63154},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63155},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63166},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63167},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63168},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63176},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63177},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63178},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63186},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63187},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63189},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63190},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63184},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63185},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63191},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63192},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63193},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63195},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63194},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63196},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63204},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63205},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63206},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63214},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63215},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63217},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63218},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63212},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63213},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63219},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63220},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63221},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63223},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63222},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63225},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63226},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63227},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63228},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63230},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63233},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63234},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63235},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63236},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63237},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63253},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63254},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63270},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63271},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63272},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63273},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63274},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63275},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63276},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63277},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63278},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63279},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63280},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63281},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63283},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63284},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63285},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63286},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63287},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63288},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63289},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63290},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63291},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63292},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63293},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63294},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63295},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63296},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63297},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63298},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63299},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63300},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63301},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63302},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63303},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63304},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63305},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63306},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63309},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63308},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63311},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63312},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63313},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63314},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63315},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63316},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63317},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63350},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63349},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63351},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63352},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63353},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63354},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63355},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63348},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63336},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63337},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63332},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63333},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63334},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63340},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63344},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63341},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63346},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63345},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63357},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63378},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63360},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63386},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63371},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63376},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63379},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63361},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63419},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63407},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63435},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63436},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63424},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63429},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63422},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63408},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63428},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63439},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63435},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64996},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52752},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64985},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65012},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64983},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52737},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -56819},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -56843},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -56861},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -56863},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64980},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64981},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65037},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64956},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64955},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52773},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52779},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52787},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52791},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52789},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65004},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65003},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -56844},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -56845},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -56846},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65006},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65007},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65008},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65060},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52816},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65049},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65051},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65047},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65078},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -56900},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65073},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64992},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64991},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52809},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65084},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65082},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65079},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65079},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65064},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65063},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65065},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65036},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65093},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65093},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65067},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65104},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63537},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65106},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65108},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65110},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63543},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65112},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63545},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65114},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63547},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65116},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63549},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65118},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63551},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63583},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63584},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63585},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63586},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63587},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63588},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63589},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63590},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63591},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63592},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63593},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63594},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63595},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63596},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63597},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63598},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63599},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63600},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63601},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63602},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63603},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63604},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63605},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63606},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63607},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63608},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63609},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63610},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63611},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63612},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63613},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63614},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63615},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63616},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63617},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63618},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63619},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63620},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63621},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63622},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63623},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63624},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63625},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63626},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63627},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63628},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63629},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63630},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63631},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63632},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63633},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63634},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63635},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63636},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63637},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63638},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63639},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63640},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63641},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63642},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63643},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63644},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63645},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63646},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63647},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63648},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63649},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63650},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63651},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63652},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63653},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63654},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63655},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63656},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63657},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63658},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63665},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63666},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63667},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63668},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63669},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63670},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63671},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63672},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65248},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65248},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65248},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, 0, -65248},
-    {17, 0, 0, 0, 0, 0, 0, -32, -32, 0, 0, -32, 0, -65248},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -54746},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -53087},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -53078},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -53091},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52842},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52852},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52934},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52933},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52932},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52931},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52930},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52873},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52872},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52871},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52908},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52943},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52942},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52941},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52940},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52939},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52938},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52937},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52936},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52935},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52929},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52928},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52926},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52925},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52924},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52923},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52921},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52919},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52917},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52915},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52913},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52912},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52911},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52910},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52909},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52906},
+    {6, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8207},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+    {4, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8219},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8222},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8200},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8201},
+    {4, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8232},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37},
+    {70, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8255},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8256},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8200},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8271},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 407},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8255},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8277},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8209},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8272},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8287},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 391},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8293},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8239},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8236},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8227},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8219},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7739},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8237},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8235},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8234},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8232},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8278},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8351},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8352},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8383},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8275},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8354},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8355},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8055},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8281},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8355},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8387},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8388},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8389},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8358},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8168},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8391},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8392},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8390},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8359},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8392},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8393},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8394},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8395},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8397},
+    {5, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8398},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -7517, -7517, -7517, -7549, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8398},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -8383, -8383, -8383, -8415, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -8262, -8262, -8262, -8294, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8426},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8394},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8427},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 28, 28, 28, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8422},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8389},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7013},
+    {17, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8400},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8437},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7548},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7562},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7595},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7583},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 209},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8449},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8418},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8415},
+    {17, 16, 0, 0, 0, 0, 0, -28, -28, 0, 0, -28, 0, 0},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8479},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8480},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8481},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8482},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8484},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8488},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8485},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8490},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8489},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8487},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8494},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, -8471},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, -8472},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, -8473},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, -8474},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, -8462},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, -8463},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, -8464},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, -8465},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, -8479},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, -8466},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, -8467},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, -8480},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, -8490},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, -8482},
+    {3, 16, 0, 0, 0, 0, 0, -16, -16, 0, 0, 0, 0, -8455},
+    {3, 16, 0, 0, 0, 0, 0, -16, -16, 0, 0, 0, 0, -8456},
+    {3, 16, 0, 0, 0, 0, 0, -16, -16, 0, 0, 0, 0, -8457},
+    {3, 16, 0, 0, 0, 0, 0, -16, -16, 0, 0, 0, 0, -8458},
+    {3, 16, 0, 0, 0, 0, 0, -16, -16, 0, 0, 0, 0, -8446},
+    {3, 16, 0, 0, 0, 0, 0, -16, -16, 0, 0, 0, 0, -8447},
+    {3, 16, 0, 0, 0, 0, 0, -16, -16, 0, 0, 0, 0, -8448},
+    {3, 16, 0, 0, 0, 0, 0, -16, -16, 0, 0, 0, 0, -8449},
+    {3, 16, 0, 0, 0, 0, 0, -16, -16, 0, 0, 0, 0, -8463},
+    {3, 16, 0, 0, 0, 0, 0, -16, -16, 0, 0, 0, 0, -8450},
+    {3, 16, 0, 0, 0, 0, 0, -16, -16, 0, 0, 0, 0, -8451},
+    {3, 16, 0, 0, 0, 0, 0, -16, -16, 0, 0, 0, 0, -8464},
+    {3, 16, 0, 0, 0, 0, 0, -16, -16, 0, 0, 0, 0, -8474},
+    {3, 16, 0, 0, 0, 0, 0, -16, -16, 0, 0, 0, 0, -8466},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8537},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -10, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8739, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8754, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8753, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -100, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -81, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -56, 0},
+    {5, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3295, 0},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9263},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9272},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9273},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9274},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9275},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9276},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9277},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9278},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9279},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9280},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9281},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9292},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9293},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9294},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9295},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9296},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9297},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9298},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9299},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9300},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9301},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9302},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9303},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9304},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9305},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9306},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9307},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9308},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9309},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9310},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9311},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9312},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9313},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9314},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9315},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9316},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9317},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9318},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9319},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9320},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9321},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9332},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9333},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9334},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9335},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9336},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9337},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9338},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9339},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9340},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9341},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9342},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9343},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9344},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9345},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9346},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9347},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9348},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9349},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9350},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9351},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9352},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9353},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9354},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9355},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9356},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9357},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 26, 26, 0, 0, -9333},
+    {5, 30, 0, 0, 0, 0, 0, 0, 0, 26, 26, 0, 0, -9333},
+    {5, 16, 0, 0, 0, 0, 0, -26, -26, 0, 0, 0, 0, -9327},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -9402},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2017},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -10810},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -10808},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -10809},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -10743, -10743, -10743, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -3814, -3814, -3814, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -10727, -10727, -10727, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -10795, -10795, 0, 0, -10795, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -10792, -10792, 0, 0, -10792, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -10780, -10780, -10780, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -10749, -10749, -10749, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -10783, -10783, -10783, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -10782, -10782, -10782, 0, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -11282},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -11303},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -10815, -10815, -10815, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -7264, -7264, 0, 0, -7264, 0, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -14},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15662},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28844},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7936},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7975},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7988},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7996},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8021},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8064},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8070},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8089},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8114},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8758},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8795},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8800},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8822},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8841},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8861},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8913},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8933},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8943},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9097},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9190},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9217},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9221},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9250},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9258},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9284},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9296},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9320},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9371},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9388},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9414},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10169},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10699},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10721},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10728},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10738},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10755},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10830},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11306},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11353},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11472},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11494},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11512},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11533},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11586},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11588},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11949},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11958},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11969},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11981},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12096},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12103},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12107},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12223},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12232},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12244},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12251},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12311},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12327},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12344},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12423},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13003},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13048},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13068},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13807},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13811},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13893},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13908},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13920},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13940},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13978},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13982},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14248},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14271},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14302},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15317},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15382},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15404},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15461},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15484},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15492},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15498},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15549},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15553},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15584},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16662},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17108},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17119},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17123},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17126},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17133},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17150},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17151},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17231},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17446},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17450},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17788},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17797},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17846},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17852},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17860},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17867},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17957},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17963},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18190},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18196},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18244},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18260},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18306},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18542},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18548},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18564},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18890},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19015},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19020},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19201},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19287},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19332},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19709},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19841},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20414},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20440},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20496},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20546},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20613},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20623},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20628},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20660},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20735},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20744},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21089},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21095},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21103},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21111},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21126},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21140},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21143},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21221},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21224},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21229},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22209},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22238},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22706},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22717},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22739},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23021},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23033},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23103},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23148},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23714},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23728},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23742},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23776},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23812},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24010},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24021},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24087},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24334},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24364},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24572},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24592},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24596},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24815},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24998},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25122},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25127},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25131},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26064},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26072},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26227},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26380},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26382},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26428},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26532},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26544},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26547},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26553},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26650},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26683},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26688},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26701},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26867},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26917},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26920},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27102},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27104},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27122},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27373},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27420},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27426},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27495},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27504},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27506},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27515},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27544},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27938},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28337},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28346},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28383},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28404},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28411},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28420},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28423},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28462},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28465},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28481},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28485},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28497},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28523},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28537},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28544},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28602},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28616},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28619},
+    {70, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12256},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8969},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8971},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -78, 0},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12411},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12412},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -23},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -78, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -76},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8241},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8073},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8242},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8244},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8074},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8230},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8251},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8227},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8252},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8174},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8196},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8273},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8096},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8093},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8092},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8088},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8085},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8084},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8274},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8082},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8081},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8276},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8275},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8271},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8270},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8269},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8267},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8264},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8255},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8249},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8245},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8237},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8195},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8193},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8185},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8184},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8175},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8173},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7278},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7417},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7285},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9542},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7284},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7318},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7283},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17305},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7359},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7294},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7269},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10124},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9618},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7451},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12760},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12761},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12762},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12763},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12764},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12765},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12766},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12767},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12768},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12769},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12770},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12771},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12772},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12773},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12774},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12775},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12776},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12777},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12778},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12779},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12780},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12781},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12782},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12783},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12784},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12785},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12786},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12787},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12788},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12789},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12790},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12792},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12793},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12794},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12795},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12796},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12797},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12798},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12799},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12800},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12801},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12802},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12803},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12804},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12805},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12806},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12807},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12808},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12809},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12810},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12811},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12812},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12813},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12814},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12815},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12816},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12817},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12818},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12819},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12820},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12821},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12822},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12823},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12824},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12825},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12826},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12827},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8971},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11319},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13121},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18760},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12800},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12831},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12832},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12833},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12834},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12835},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12836},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12837},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12838},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12839},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12840},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12841},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12842},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12843},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12844},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8544},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8543},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8542},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8541},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8540},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8539},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8558},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8557},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8556},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8555},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8554},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8553},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8561},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8563},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7040},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7179},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7047},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9304},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7184},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7912},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7037},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7908},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7125},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8376},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13438},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15840},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14760},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13467},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24387},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9360},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13141},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13721},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13431},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18091},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8569},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16356},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23051},
+    {5, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18118},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8220},
+    {5, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18239},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17053},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9944},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24013},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7821},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8402},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14921},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25957},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7280},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7927},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14528},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7014},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7048},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7013},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11071},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8523},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8338},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10477},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10427},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17463},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7252},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23065},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8357},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9836},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12926},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12927},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12928},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12929},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12930},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12931},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12932},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12933},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12934},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12935},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12936},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12937},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12938},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12943},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12952},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12953},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12954},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12932},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12904},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12905},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12931},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -558},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -557},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -556},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -555},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -554},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -553},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -552},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -551},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -550},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -549},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -548},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -547},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -546},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -545},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -544},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -543},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -541},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -540},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -539},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -538},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -536},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -534},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -532},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -530},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -528},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -527},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -526},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -525},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -524},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7141},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -606},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -607},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -608},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -609},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -610},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -611},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -613},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -615},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -616},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -617},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -618},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -619},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -620},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -612},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -605},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -603},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -602},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -604},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -614},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13096},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13105},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13106},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13107},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13108},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13109},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13110},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13111},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13112},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13113},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13114},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13115},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13116},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13117},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13118},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13065},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13070},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13074},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13062},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13075},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13076},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13077},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11000},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12977},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9642},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12944},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13483},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13072},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12230},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13078},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13081},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13120},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13093},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13086},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13082},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13085},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12240},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12241},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13089},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13092},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13128},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13094},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13125},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13132},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12249},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13097},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13101},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13100},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12255},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13103},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13121},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13145},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13119},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13150},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13157},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13123},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12278},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13126},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13124},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13127},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12282},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13130},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13133},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13164},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12288},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13136},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13139},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13170},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13141},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13172},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13153},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13185},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13154},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13187},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13188},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13156},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13186},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13155},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13158},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13159},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13160},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13161},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13191},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13193},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13194},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13190},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13192},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13214},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13231},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13240},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13241},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13242},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13243},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13244},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13245},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13246},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13247},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13248},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13249},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13250},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13251},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13252},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13253},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13254},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13255},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13256},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13257},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13258},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13259},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13208},
+    {0, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41554},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41553},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -35332, -35332, -35332, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -42280, -42280, -42280, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, 48, 48, 0, 0, 48, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -42308, -42308, -42308, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -42319, -42319, -42319, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -42315, -42315, -42315, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -42305, -42305, -42305, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -42258, -42258, -42258, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -42282, -42282, -42282, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -42261, -42261, -42261, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 928, 928, 928, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -48, -48, -48, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -42307, -42307, -42307, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, -35384, -35384, -35384, 0, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42706},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42662},
+    {17, 16, 0, 0, 0, 0, 0, -928, -928, 0, 0, -928, 0, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1077},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43251},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43228},
+    {17, 16, 0, 0, 0, 0, 0, -38864, -38864, 0, -38864, -38864, 0, 0},
+    {1, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27832, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37389, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27192, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27707, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35379, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43731, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42273, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -22891, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -22892, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40888, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26425, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41860, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40900, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38679, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33445, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31114, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29393, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29015, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28698, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26756, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36626, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35834, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34877, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34105, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29915, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26543, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -24361, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43673, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42407, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36377, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34563, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29426, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -23298, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39889, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35127, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29526, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28608, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38492, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30542, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28936, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39518, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37394, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35776, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34351, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26718, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43431, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42871, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42577, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37996, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36446, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34594, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33356, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31027, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29487, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29402, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27464, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25094, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -24010, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -23360, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32943, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32701, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31645, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30069, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26171, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -23233, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28267, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41059, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39487, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31972, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30919, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34532, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32893, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27782, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25170, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41074, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40169, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36665, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35699, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35391, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31776, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31513, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25350, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42624, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30920, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42872, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42889, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32570, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31641, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30055, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25316, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28122, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38540, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36698, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28255, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43813, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40312, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39246, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34266, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33778, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42572, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32873, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43430, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39357, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43866, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35996, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37873, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31816, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42408, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41230, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33388, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29989, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28357, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36278, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27073, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36074, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38517, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30351, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38357, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33809, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43721, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43023, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42928, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37113, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31892, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30477, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28331, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42634, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42302, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40974, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39574, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37822, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35206, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32859, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25561, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -24349, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -23281, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -23227, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42735, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37573, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36373, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27179, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39706, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38911, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38800, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38135, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35439, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34890, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34059, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32715, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31650, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31016, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27250, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29867, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26999, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26193, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42885, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42746, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42209, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35031, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28894, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28407, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39641, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39342, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38441, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36343, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32104, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34354, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43716, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41648, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40387, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39921, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39312, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34299, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34117, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31253, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31082, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26493, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25276, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25195, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -24988, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43562, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32776, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26627, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25344, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39128, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43828, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43233, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40398, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40318, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37925, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36797, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34802, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33663, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29894, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26951, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -23095, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37693, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25496, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42814, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37453, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37334, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35977, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35631, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34243, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33908, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33123, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31935, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -24946, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43108, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38820, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25435, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43433, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40124, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35820, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27309, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39501, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39061, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37315, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34388, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25430, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42932, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42447, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40314, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37837, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37523, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37178, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36094, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34270, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33795, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31341, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28952, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28935, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26653, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25352, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42668, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35634, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42448, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34846, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34135, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29686, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25422, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -23963, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -23380, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37469, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35882, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30734, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32556, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32472, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32103, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34618, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35170, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28324, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43837, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30408, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42949, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43001, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39771, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38703, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32045, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40575, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36071, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37714, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27340, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29116, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25532, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28799, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39736, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43212, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42061, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41398, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37790, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43063, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34540, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33613, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32988, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32955, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32949, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32908, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25286, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32095, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31329, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29710, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28458, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27117, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26921, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -24891, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -24879, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -24836, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -23673, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26960, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25464, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43650, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43338, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43237, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42858, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42832, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42724, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42137, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42033, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41936, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41465, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41362, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40407, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39337, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39126, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39089, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38990, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38130, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37984, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37810, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37311, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36046, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35884, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35621, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35034, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34344, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33210, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33038, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33028, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33030, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33023, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33018, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33012, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32965, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32788, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32724, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32406, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31843, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31823, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31768, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31464, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31318, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30831, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30692, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30693, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30216, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29008, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28875, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28513, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28049, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27997, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27312, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27183, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25477, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25194, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25135, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39414, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 84098, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30805, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -44106, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43196, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43274, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43763, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43311, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43253, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42927, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42877, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42203, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42276, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41506, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41418, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41274, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41259, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40990, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40793, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39856, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39850, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39707, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39640, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39225, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39296, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39163, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39210, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39065, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39000, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38601, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38514, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38461, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38202, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37917, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37755, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37752, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37694, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36636, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36572, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36182, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35773, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35790, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35704, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35453, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35118, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33526, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34921, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34800, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34678, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34352, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34204, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34152, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33927, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33926, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33756, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33740, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33716, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33631, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33642, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33247, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32763, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32493, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32307, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32084, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31932, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31603, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31405, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30561, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30405, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29500, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29045, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28977, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28962, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28666, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28610, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28656, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28603, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28607, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28625, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28550, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28470, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28089, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27530, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27217, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26923, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26703, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25674, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25572, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25458, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25326, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25291, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25280, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25233, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -24507, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -23346, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 77179, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 77172, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80132, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -48949, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -47803, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -47771, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 87924, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 90618, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 99324, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -23445, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -23371, 0},
+    {17, 16, 196, 115, 0, 199, 196, 0, 0, 0, 0, 0, 0, -64154},
+    {17, 16, 199, 118, 0, 202, 199, 0, 0, 0, 0, 0, 0, -64155},
+    {17, 16, 202, 121, 0, 205, 202, 0, 0, 0, 0, 0, 0, -64156},
+    {17, 16, 205, 124, 0, 208, 205, 0, 0, 0, 0, 0, 0, -64157},
+    {17, 16, 209, 128, 0, 212, 209, 0, 0, 0, 0, 0, 0, -64158},
+    {17, 16, 213, 132, 0, 216, 213, 0, 0, 0, 0, 0, 0, -63878},
+    {17, 16, 213, 132, 0, 216, 213, 0, 0, 0, 0, 0, 0, -64147},
+    {17, 16, 216, 135, 0, 219, 216, 0, 0, 0, 0, 0, 0, -62879},
+    {17, 16, 219, 138, 0, 222, 219, 0, 0, 0, 0, 0, 0, -62880},
+    {17, 16, 222, 141, 0, 225, 222, 0, 0, 0, 0, 0, 0, -62881},
+    {17, 16, 225, 144, 0, 228, 225, 0, 0, 0, 0, 0, 0, -62872},
+    {17, 16, 228, 147, 0, 231, 228, 0, 0, 0, 0, 0, 0, -62883},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62788, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62765, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62782},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62801},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62799},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62793},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62783},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64254},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62785, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62786, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62814, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62815, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62816, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62838, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62843, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62834, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62826, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62847},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62687},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62688},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62679},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62680},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62681},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62682},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62683},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62684},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62685},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62692},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62693},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62694},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62695},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62691},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62701},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62702},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62703},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62704},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62662},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62663},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62664},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62665},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62666},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62667},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62705},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62707},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62708},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62709},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62710},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62711},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62712},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62713},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62714},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62720},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62721},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62706},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62715},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62716},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62696},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62697},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62698},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62699},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62700},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62686},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62758},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62759},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62760},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62761},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62736},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62737},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62739},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62740},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62822},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62747},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62748},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62745},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62746},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62741},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62742},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62743},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62879},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62880},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62916},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62917},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62918},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62919},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62920},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62921},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62922},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62923},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62924},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62925},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62926},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62927},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62928},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62929},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62930},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62931},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62932},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62933},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62768},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62769},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62770},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62771},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62938},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62939},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62940},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62941},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62942},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62943},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62944},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62945},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62946},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62947},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62948},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62949},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62950},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62951},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62952},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62953},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62954},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62955},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62956},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62957},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62958},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62959},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62960},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62961},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62962},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62963},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62964},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62965},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62966},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62967},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62968},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62969},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62970},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62971},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62972},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62973},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62974},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62975},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62976},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62977},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62978},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62979},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62980},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62981},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62982},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62983},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62984},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62985},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62986},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62987},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62988},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62989},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62990},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62991},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62992},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63019},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62996},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64574},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64575},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64576},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64577},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64578},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64579},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63038},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63039},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63040},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63041},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63042},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63043},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63044},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63045},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63046},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63047},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63048},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63049},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63050},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63051},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63052},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63053},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63054},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63055},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63056},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63035},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63036},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63037},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63089},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63090},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63091},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63092},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63093},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63094},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63095},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63096},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63097},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63098},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63099},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63100},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63101},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63102},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63103},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63104},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63105},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63106},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63107},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63108},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63109},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63110},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63111},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63112},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63113},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63114},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63115},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63116},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63117},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63118},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63119},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63120},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63121},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63122},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63123},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63124},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63161},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63162},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63163},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63156},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63157},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63158},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63144},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63145},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63142},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63143},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63154},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63155},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63166},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63167},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63168},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63176},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63177},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63178},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63186},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63187},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63189},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63190},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63184},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63185},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63191},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63192},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63193},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63195},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63194},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63196},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63204},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63205},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63206},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63214},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63215},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63217},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63218},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63212},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63213},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63219},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63220},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63221},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63223},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63222},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63225},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63226},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63227},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63228},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63230},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63233},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63234},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63235},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63236},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63237},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63253},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63254},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63270},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63271},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63272},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63273},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63274},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63275},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63276},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63277},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63278},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63279},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63280},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63281},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63283},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63284},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63285},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63286},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63287},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63288},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63289},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63290},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63291},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63292},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63293},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63294},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63295},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63296},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63297},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63298},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63299},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63300},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63301},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63302},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63303},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63304},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63305},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63306},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63309},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63308},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63311},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63312},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63313},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63314},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63315},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63316},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63317},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63350},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63349},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63351},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63352},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63353},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63354},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63355},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63348},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63336},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63337},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63332},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63333},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63334},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63340},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63344},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63341},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63346},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63345},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63357},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63378},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63360},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63386},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63371},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63376},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63379},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63361},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63419},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63407},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63435},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63436},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63424},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63429},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63422},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63408},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63428},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63439},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63435},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64996},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52752},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52752},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64985},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64985},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65012},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64983},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52737},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -56819},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -56843},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -56861},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -56863},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64980},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64981},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65037},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64956},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64955},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52773},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52779},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52787},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52791},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52789},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65004},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65003},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -56844},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -56845},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -56846},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65006},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65007},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65008},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65060},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52816},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65060},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65049},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65051},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65047},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65078},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -56900},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65073},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64992},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -64991},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52809},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65084},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65082},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65079},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65079},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65078},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65064},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65063},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65065},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65036},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65093},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65093},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65067},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65104},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63537},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65106},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65108},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65110},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63543},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65112},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63545},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65114},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63547},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65116},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63549},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65118},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63551},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63583},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63584},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63585},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63586},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63587},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63588},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63589},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63590},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63591},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63592},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63593},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63594},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63595},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63596},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63597},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63598},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63599},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63600},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63601},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63602},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63603},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63604},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63605},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63606},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63607},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63608},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63609},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63610},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63611},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63612},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63613},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63614},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63615},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63616},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63617},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63618},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63619},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63620},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63621},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63622},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63623},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63624},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63625},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63626},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63627},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63628},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63629},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63630},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63631},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63632},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63633},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63634},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63635},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63636},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63637},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63638},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63639},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63640},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63641},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63642},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63643},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63644},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63645},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63646},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63647},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63648},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63649},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63650},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63651},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63652},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63653},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63654},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63655},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63656},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63657},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63658},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63665},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63666},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63667},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63668},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63669},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63670},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63671},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63672},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65248},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65248},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65248},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65248},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65248},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65248},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65248},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65248},
+    {3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65248},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65248},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65248},
+    {9, 32, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, 0, -65248},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65248},
+    {17, 32, 0, 0, 0, 0, 0, -32, -32, 0, 0, -32, 0, -65248},
+    {4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -54746},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -53087},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -53078},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -53091},
+    {4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52842},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52852},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52934},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52933},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52932},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52931},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52930},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52873},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52872},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52871},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52908},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52943},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52942},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52941},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52940},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52939},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52938},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52937},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52936},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52935},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52929},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52928},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52926},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52925},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52924},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52923},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52921},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52919},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52917},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52915},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52913},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52912},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52911},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52910},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52909},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52906},
     {1, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52997},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52796},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52848},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52851},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52853},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52855},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52857},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65342},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65334},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65332},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65344},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -57149},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -56038},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -56921},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -55885},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -55843},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -40, -40, 0, 0, -40, 0, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 64, 64, 64, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -64, -64, 0, 0, -64, 0, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52796},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52848},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52851},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52853},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52855},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52857},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65342},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65334},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65332},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -65344},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -57149},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -56038},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -56921},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -55885},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -55843},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -40, -40, 0, 0, -40, 0, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 64, 64, 64, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -64, -64, 0, 0, -64, 0, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6, 0},
     {2, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0},
-    {2, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119743},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119737},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119795},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119789},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119847},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119841},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119899},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119893},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119951},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119945},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120003},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119997},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120055},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120049},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120107},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120101},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120159},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120153},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120211},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120205},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120263},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120257},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120315},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120309},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120367},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120361},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120179},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119918},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119575},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119493},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -111802},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119569},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -111833},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119527},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119564},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119534},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119562},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119535},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119563},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119633},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119551},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -111860},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119627},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -111891},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119585},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119622},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119592},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119620},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119593},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119621},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119691},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119609},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -111918},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119685},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -111949},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119643},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119680},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119650},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119678},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119651},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119679},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119749},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119667},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -111976},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119743},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -112007},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119701},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119738},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119708},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119736},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119709},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119807},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119725},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -112034},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119801},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -112065},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119759},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119796},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119766},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119794},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119767},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119795},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119790},
-    {17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119790},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120734},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120744},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120754},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120764},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120774},
-    {9, 0, 0, 0, 0, 0, 0, 0, 0, 34, 34, 34, 0, 0},
-    {17, 0, 0, 0, 0, 0, 0, -34, -34, 0, 0, -34, 0, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124889},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124886},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124884},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124861},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124890},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124881},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124863},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124871},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124891},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124879},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124892},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124880},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124898},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124896},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124907},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124905},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124904},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124899},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124897},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124846},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124771},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124797},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124848},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124921},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124918},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124893},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124922},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124895},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124903},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124923},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124911},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124924},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124912},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124928},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124939},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124937},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124931},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124929},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124950},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124954},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124927},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124935},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124955},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124956},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124944},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124960},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124969},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124963},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124961},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124835},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124985},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124982},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124957},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124986},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124977},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124959},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124967},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124987},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124975},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124988},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124976},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124992},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125003},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125001},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124995},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124994},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124993},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124942},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125017},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125014},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125012},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124989},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125018},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125009},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124991},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124999},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125019},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125007},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125020},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125008},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125026},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125024},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125035},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125033},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125032},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125027},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125025},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125049},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125046},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125044},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125021},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125050},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125041},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125023},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125031},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125051},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125039},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125052},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125040},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125058},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125056},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125067},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125065},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125064},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125059},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125057},
-    {0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127184},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127185},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127208},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127209},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127210},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127211},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127212},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127213},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127214},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127215},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127216},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127217},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127218},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127219},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127220},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127221},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127222},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127223},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127224},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127225},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127226},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127227},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127228},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127229},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127230},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127231},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127232},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127233},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -114966},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127194},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127191},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127234},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127261},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127262},
-    {5, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127263},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127308},
-    {5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -115077},
-    {5, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -115022},
-    {5, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -115021},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -102341},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -104122},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -106054},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -115020},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -107400},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -104699},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -92211},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -104686},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -107380},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -101369},
-    {5, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -98553},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -101506},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -106447},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -103057},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -106641},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -101487},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -106499},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -95455},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -97539},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -91514},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -104756},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -105964},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -99090},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -102290},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -102099},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -107561},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -107553},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -90593},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -103494},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -107520},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -106043},
-    {5, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -102184},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -91328},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -102366},
-    {5, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -96433},
-    {5, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -96185},
-    {5, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -106028},
-    {5, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -99253},
-    {5, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -101165},
-    {5, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -101167},
-    {5, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -97541},
-    {5, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -106439},
-    {5, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -105604},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -90350},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -115244},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -115245},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -115246},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -115247},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -115248},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -115249},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -115250},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -115251},
-    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -115252},
-    {5, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -103097},
-    {5, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -106082},
+    {2, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119743},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119737},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119795},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119789},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119847},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119841},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119899},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119893},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119951},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119945},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120003},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119997},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120055},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120049},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120107},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120101},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120159},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120153},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120211},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120205},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120263},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120257},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120315},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120309},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120367},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120361},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120179},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119918},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119575},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119493},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -111802},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119569},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -111833},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119527},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119564},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119534},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119562},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119535},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119563},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119633},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119551},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -111860},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119627},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -111891},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119585},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119622},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119592},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119620},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119593},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119621},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119691},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119609},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -111918},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119685},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -111949},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119643},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119680},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119650},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119678},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119651},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119679},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119749},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119667},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -111976},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119743},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -112007},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119701},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119738},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119708},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119736},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119709},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119807},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119725},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -112034},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119801},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -112065},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119759},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119796},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119766},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119794},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119767},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119795},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119790},
+    {17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -119790},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120734},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120744},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120754},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120764},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -120774},
+    {9, 16, 0, 0, 0, 0, 0, 0, 0, 34, 34, 34, 0, 0},
+    {17, 16, 0, 0, 0, 0, 0, -34, -34, 0, 0, -34, 0, 0},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124889},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124886},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124884},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124861},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124890},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124881},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124863},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124871},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124891},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124879},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124892},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124880},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124898},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124896},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124907},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124905},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124904},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124899},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124897},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124846},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124771},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124797},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124848},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124921},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124918},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124893},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124922},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124895},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124903},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124923},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124911},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124924},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124912},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124928},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124939},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124937},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124931},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124929},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124950},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124954},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124927},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124935},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124955},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124956},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124944},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124960},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124969},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124963},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124961},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124835},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124985},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124982},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124957},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124986},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124977},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124959},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124967},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124987},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124975},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124988},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124976},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124992},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125003},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125001},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124995},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124994},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124993},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124942},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125017},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125014},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125012},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124989},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125018},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125009},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124991},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -124999},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125019},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125007},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125020},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125008},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125026},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125024},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125035},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125033},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125032},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125027},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125025},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125049},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125046},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125044},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125021},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125050},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125041},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125023},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125031},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125051},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125039},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125052},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125040},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125058},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125056},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125067},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125065},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125064},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125059},
+    {1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -125057},
+    {0, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127184},
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127185},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127208},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127209},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127210},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127211},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127212},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127213},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127214},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127215},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127216},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127217},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127218},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127219},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127220},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127221},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127222},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127223},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127224},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127225},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127226},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127227},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127228},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127229},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127230},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127231},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127232},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127233},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -114966},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127194},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127191},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127215},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127234},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127261},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127262},
+    {5, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127263},
+    {5, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {5, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -127308},
+    {5, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -115077},
+    {5, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -115022},
+    {5, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -115021},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -102341},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -104122},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -106054},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -115020},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -107400},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -104699},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -92211},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -104686},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -107380},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -101369},
+    {5, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -98553},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -101506},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -106447},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -103057},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -106641},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -101487},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -106499},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -95455},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -97539},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -91514},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -104756},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -105964},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -99090},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -102290},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -102099},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -107561},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -107553},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -90593},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -103494},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -107520},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -106043},
+    {5, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -102184},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -91328},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -102366},
+    {5, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -96433},
+    {5, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -96185},
+    {5, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -106028},
+    {5, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -99253},
+    {5, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -101165},
+    {5, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -101167},
+    {5, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -97541},
+    {5, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -106439},
+    {5, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -105604},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -90350},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -115244},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -115245},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -115246},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -115247},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -115248},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -115249},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -115250},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -115251},
+    {5, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -115252},
+    {5, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -103097},
+    {5, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -106082},
     {5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -129984},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -174531, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -174537, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -174529, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63201, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -174244, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -174167, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -174155, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -174085, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173966, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173936, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173859, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173884, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -181102, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -61907, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173761, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173755, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173740, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173722, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62198, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -181082, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173741, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173704, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62155, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173696, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173684, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -174413, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173678, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173670, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26173, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173608, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173595, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -181056, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173541, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173531, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173488, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173484, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -181007, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173406, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173405, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173379, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173358, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173348, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173332, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173283, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173276, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173268, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173244, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173235, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173234, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173236, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -60936, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165829, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173164, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173144, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -60629, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173134, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173129, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173109, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172958, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173061, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173046, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173015, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172875, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172850, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172784, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172769, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172737, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172738, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172718, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172701, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172694, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172680, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172341, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172614, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172342, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172541, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172507, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173641, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171875, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172164, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172127, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172103, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172234, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172068, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172070, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171948, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -58229, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171880, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171876, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171862, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171843, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171836, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171773, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -57784, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -57719, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171638, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171592, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171581, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171661, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171520, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -180601, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -180588, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171361, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171308, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171309, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -56996, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171178, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171158, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171144, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171133, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -56665, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171123, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171117, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170273, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171091, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -180469, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171031, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171018, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170937, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170989, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -55959, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170809, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170768, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170772, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170756, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170656, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -180308, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170631, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170589, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170569, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170526, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -180262, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -55046, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -180238, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170459, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170457, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170455, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170436, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -21757, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170386, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -54624, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -54625, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161426, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170354, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170355, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -180175, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -50655, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38590, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170295, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170287, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -180152, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170242, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170192, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170183, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170150, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170015, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -180071, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -180102, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169999, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -53712, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169950, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169822, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169819, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169818, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169821, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169776, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169757, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169722, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169737, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169727, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169681, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169662, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169659, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169634, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169624, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169559, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169476, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169442, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169319, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52652, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169340, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169406, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169299, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169273, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169177, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52429, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169117, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169211, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169240, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -179860, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169050, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169030, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169000, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169039, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -179803, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168825, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168797, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -51392, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168680, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168404, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168580, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -179637, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168510, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -179656, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -179693, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173888, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173886, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168505, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161833, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177406, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168385, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168382, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168377, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168317, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168329, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -50458, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -179605, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168165, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168283, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168079, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168029, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -50294, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168022, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168134, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -167890, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -179530, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -167846, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -167750, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -167680, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -167491, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -49737, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -167442, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -179414, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -167374, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -49225, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -167325, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -179364, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -167297, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -167253, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -167227, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -48746, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -56301, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -48639, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -167084, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -48191, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166973, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166960, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -167063, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166889, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166850, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166794, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166849, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166810, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166796, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166784, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -48104, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166867, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166617, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166555, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -179159, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166464, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166469, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -47676, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166677, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166305, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -47538, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -47491, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166220, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166106, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166134, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166138, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -179072, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166093, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166043, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166050, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165997, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62454, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165847, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -46778, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165762, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -46452, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165624, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165612, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165586, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -45851, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165540, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165520, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -45553, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -45331, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165294, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165278, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -178814, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165254, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -178804, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -178805, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165095, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165075, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165055, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165036, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -164968, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -178712, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -164880, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -44287, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -164856, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -44197, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -164808, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -55194, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -164650, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43418, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43396, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43257, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -178498, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -178487, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -164428, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43086, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43088, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43050, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43025, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -164391, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -164392, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -164350, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -178448, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -164287, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -178437, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -178358, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42288, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -164096, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -164035, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -163972, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -178286, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41772, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -163837, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41658, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41616, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -163783, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -163692, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -178217, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -163609, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -163600, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -163596, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40928, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40630, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40631, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -163441, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -178014, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40374, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -163228, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -163226, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177981, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40165, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162964, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177863, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162944, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162950, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162922, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39397, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162825, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177772, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162727, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162669, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162603, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177725, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38730, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38700, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177691, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38556, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162300, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38457, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162275, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162175, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162165, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38049, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37977, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162077, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37846, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162063, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -50721, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177580, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162000, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161920, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177529, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161863, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171729, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37344, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37331, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -50678, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -50670, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161674, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161672, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -158191, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177443, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161534, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161541, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161524, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173791, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161506, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161505, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161496, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161456, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36443, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161459, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161404, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161335, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161262, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161401, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161248, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161207, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161096, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161357, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161239, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161238, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161223, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36206, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35898, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36049, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177276, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160951, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160950, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160916, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34273, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160840, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35457, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177233, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177230, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35327, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35039, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177223, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160611, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160600, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160590, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160589, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160526, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160560, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160427, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160472, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160322, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160404, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160338, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160312, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177128, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160223, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160192, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177097, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160099, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160097, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33630, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -159983, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -159977, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177043, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -159951, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -181519, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33053, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32870, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -176911, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -176903, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -159535, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -159459, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -159303, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -159101, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32043, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -159017, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -158996, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -158907, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -158816, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31401, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -61909, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -158735, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -158751, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -158700, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -61695, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -158474, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -158375, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29684, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -158030, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -157938, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -157907, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29367, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -157899, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -157615, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -157457, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -157550, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -157170, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -157143, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28147, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -156771, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -176218, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -156729, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27770, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -176140, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -156464, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171074, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -156370, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26801, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26589, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -176010, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -176003, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -156186, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26097, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -175946, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25959, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -156147, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -156148, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -156119, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25675, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -155936, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -175824, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -155867, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -155742, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -155716, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -155657, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -175674, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -24281, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -155384, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -155083, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -154895, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -175423, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -175393, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -154792, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -22850, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -175385, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -22797, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -22533, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -22403, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -154458, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -175296, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -154398, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -154394, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -154388, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -154379, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -154373, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -154337, 0},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -21533, 0}
+    {3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -129984},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -174531, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -174537, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -174529, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -63201, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -174244, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -174167, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -174155, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -174085, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173966, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173936, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173859, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173884, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -181102, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -61907, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173761, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173755, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173740, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173722, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62198, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -181082, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173741, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173704, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62155, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173696, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173684, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -174413, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173678, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173670, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26173, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173608, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173595, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -181056, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173541, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173531, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173488, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173484, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -181007, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173406, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173405, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173379, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173358, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173348, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173332, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173283, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173276, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173268, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173244, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173235, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173234, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173236, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -60936, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165829, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173164, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173144, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -60629, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173134, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173129, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173109, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172958, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173061, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173046, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173015, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172875, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172850, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172784, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172769, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172737, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172738, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172718, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172701, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172694, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172680, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172341, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172614, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172342, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172541, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172507, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173641, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171875, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172164, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172127, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172103, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172234, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172068, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -172070, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171948, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -58229, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171880, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171876, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171862, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171843, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171836, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171773, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -57784, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -57719, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171638, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171592, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171581, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171661, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171520, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -180601, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -180588, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171361, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171308, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171309, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -56996, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171178, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171158, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171144, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171133, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -56665, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171123, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171117, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170273, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171091, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -180469, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171031, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171018, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170937, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170989, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -55959, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170809, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170768, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170772, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170756, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170656, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -180308, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170631, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170589, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170569, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170526, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -180262, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -55046, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -180238, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170459, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170457, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170455, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170436, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -21757, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170386, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -54624, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -54625, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161426, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170354, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170355, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -180175, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -50655, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38590, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170295, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170287, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -180152, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170242, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170192, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170183, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170150, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -170015, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -180071, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -180102, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169999, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -53712, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169950, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169822, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169819, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169818, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169821, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169776, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169757, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169722, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169737, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169727, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169681, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169662, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169659, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169634, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169624, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169559, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169476, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169442, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169319, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52652, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169340, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169406, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169299, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169273, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169177, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -52429, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169117, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169211, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169240, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -179860, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169050, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169030, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169000, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -169039, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -179803, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168825, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168797, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -51392, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168680, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168404, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168580, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -179637, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168510, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -179656, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -179693, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173888, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173886, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168505, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161833, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177406, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168385, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168382, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168377, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168317, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168329, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -50458, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -179605, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168165, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168283, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168079, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168029, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -50294, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168022, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -168134, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -167890, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -179530, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -167846, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -167750, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -167680, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -167491, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -49737, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -167442, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -179414, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -167374, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -49225, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -167325, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -179364, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -167297, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -167253, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -167227, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -48746, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -56301, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -48639, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -167084, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -48191, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166973, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166960, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -167063, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166889, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166850, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166794, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166849, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166810, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166796, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166784, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -48104, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166867, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166617, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166555, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -179159, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166464, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166469, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -47676, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166677, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166305, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -47538, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -47491, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166220, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166106, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166134, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166138, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -179072, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166093, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166043, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -166050, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165997, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -62454, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165847, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -46778, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165762, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -46452, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165624, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165612, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165586, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -45851, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165540, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165520, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -45553, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -45331, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165294, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165278, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -178814, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165254, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -178804, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -178805, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165095, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165075, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165055, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -165036, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -164968, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -178712, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -164880, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -44287, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -164856, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -44197, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -164808, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -55194, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -164650, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43418, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43396, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43257, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -178498, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -178487, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -164428, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43086, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43088, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43050, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -43025, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -164391, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -164392, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -164350, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -178448, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -164287, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -178437, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -178358, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -42288, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -164096, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -164035, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -163972, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -178286, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41772, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -163837, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41658, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -41616, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -163783, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -163692, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -178217, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -163609, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -163600, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -163596, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40928, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40630, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40631, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -163441, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -178014, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40374, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -163228, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -163226, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177981, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -40165, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162964, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177863, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162944, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162950, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162922, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -39397, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162825, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177772, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162727, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162669, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162603, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177725, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38730, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38700, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177691, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38556, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162300, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38457, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162275, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162175, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162165, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38049, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37977, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162077, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37846, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162063, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -50721, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177580, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -162000, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161920, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177529, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161863, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171729, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37344, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -37331, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -50678, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -50670, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161674, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161672, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -158191, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177443, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161534, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161541, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161524, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -173791, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161506, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161505, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161496, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161456, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36443, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161459, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161404, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161335, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161262, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161401, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161248, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161207, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161096, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161357, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161239, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161238, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -161223, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36206, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35898, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -36049, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177276, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160951, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160950, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160916, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -34273, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160840, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35457, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177233, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177230, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35327, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -35039, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177223, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160611, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160600, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160590, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160589, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160526, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160560, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160427, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160472, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160322, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160404, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160338, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160312, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177128, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160223, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160192, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177097, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160099, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -160097, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33630, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -159983, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -159977, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -177043, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -159951, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -181519, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -33053, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32870, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -176911, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -176903, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -159535, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -159459, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -159303, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -159101, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -32043, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -159017, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -158996, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -158907, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -158816, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -31401, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -61909, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -158735, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -158751, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -158700, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -61695, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -158474, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -158375, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29684, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -158030, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -157938, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -157907, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29367, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -157899, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -157615, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -157457, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -157550, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -157170, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -157143, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -28147, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -156771, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -176218, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -156729, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27770, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -176140, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -156464, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -171074, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -156370, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26801, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26589, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -176010, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -176003, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -156186, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -26097, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -175946, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25959, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -156147, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -156148, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -156119, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -25675, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -155936, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -175824, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -155867, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -155742, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -155716, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -155657, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -175674, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -24281, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -155384, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -155083, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -154895, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -175423, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -175393, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -154792, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -22850, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -175385, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -22797, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -22533, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -22403, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -154458, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -175296, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -154398, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -154394, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -154388, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -154379, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -154373, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -154337, 0},
+    {1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -21533, 0}
 };
 
 /* Unicode data stage one: 17408 bytes. */
@@ -3957,21 +4014,21 @@ static const uint16_t tmu_ucd_stage_one[8704] = {
     101,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
     102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
     102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,210,
-    105,105,105,105,105,105,105,105,105,211,212,  0,  0,  0,  0,  0,
+    211,211,211,211,211,211,211,211,211,212,213,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    105,105,213,105,105,214,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,215,216,  0,  0,  0,  0,  0,  0,
+    214,211,215,211,211,216,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,217,218,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     73,217,218,219,220,221,222,  0,223,224,225,226,227,228,229,230,
-     73, 73, 73, 73,231,232,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    233,  0,234,  0,  0,235,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     42,236,237,  0,  0,  0,  0,  0,238,239,240,  0,241,242,  0,  0,
-    243,244,245,246,247,248,249,250,251,252,253,254,255,256,257,258,
-    259,260,261,262,263,264, 73,265,248,248,248,248,248,248,248,266,
+     73,219,220,221,222,223,224,  0,225,226,227,228,229,230,231,232,
+     73, 73, 73, 73,233,234,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    235,  0,236,  0,  0,237,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     42,238,239,  0,  0,  0,  0,  0,240,241,242,  0,243,244,  0,  0,
+    245,246,247,248,249,250,251,252,253,254,255,256,257,258,259,260,
+    261,262,263,264,265,266, 73,267,250,250,250,250,250,250,250,268,
     101,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
     102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
     102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
@@ -3992,50 +4049,50 @@ static const uint16_t tmu_ucd_stage_one[8704] = {
     102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
     102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
     102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,267,101,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,268,102,
-    269,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
+    102,102,102,102,102,102,102,102,102,102,102,102,102,269,101,102,
     102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,270,102,102,
+    102,102,102,102,102,102,102,102,102,102,102,102,102,102,270,102,
+    271,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
     102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
+    102,102,102,102,102,102,102,102,102,102,102,102,102,272,102,102,
     102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
     102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,271,102,102,102,102,102,102,102,102,
     102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    272,273,274,275,276,102,102,102,102,102,102,102,102,102,102,277,
+    102,102,102,102,102,102,102,273,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    275,276,277,278,279,274,274,274,274,274,274,274,274,274,274,280,
     101,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
     102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,278,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-    102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,277,
+    102,102,102,102,102,102,281,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,
+    274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,280,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
@@ -4356,8 +4413,8 @@ static const uint16_t tmu_ucd_stage_one[8704] = {
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    279,280,281,282,280,280,280,280,280,280,280,280,280,280,280,280,
-    280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,280,
+    282,283,284,285,283,283,283,283,283,283,283,283,283,283,283,283,
+    283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
@@ -4419,7 +4476,7 @@ static const uint16_t tmu_ucd_stage_one[8704] = {
     131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,
     131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,
     131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,
-    131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,283,
+    131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,286,
     131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,
     131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,
     131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,
@@ -4451,14 +4508,14 @@ static const uint16_t tmu_ucd_stage_one[8704] = {
     131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,
     131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,
     131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,
-    131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,283
+    131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,286
 };
 
-/* Unicode data stage two: 72704 bytes.*/
+/* Unicode data stage two: 73472 bytes.*/
 static const uint32_t tmu_ucd_block_size = 128;
-static const uint32_t tmu_ucd_stage_two_blocks_count = 284;
-static const size_t tmu_ucd_stage_two_size = 36352;
-static const uint16_t tmu_ucd_stage_two[36352] = {
+static const uint32_t tmu_ucd_stage_two_blocks_count = 287;
+static const size_t tmu_ucd_stage_two_size = 36736;
+static const uint16_t tmu_ucd_stage_two[36736] = {
     /* Block 0 */
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
@@ -4469,1150 +4526,1150 @@ static const uint16_t tmu_ucd_stage_two[36352] = {
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 1 */
-      1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  2,  1,  3,  4,  1,  1,
+      1,  1,  1,  1,  1,  1,  1,  1,  1,  2,  3,  4,  5,  6,  1,  1,
       1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
-      5,  6,  6,  6,  7,  6,  6,  6,  6,  6,  6,  7,  6,  6,  6,  6,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  6,  6,  7,  7,  7,  6,
-      6,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
-      9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  6,  6,  6,  7,  6,
-      7, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
-     10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,  6,  7,  6,  7,  1,
+      7,  8,  9, 10, 11, 10, 10, 12, 13, 13, 10, 11, 14, 15, 16, 10,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 18, 19, 11, 11, 11,  8,
+     10, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+     20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 13, 10, 13, 11, 21,
+     11, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+     22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 13, 11, 13, 11,  1,
     /* Block 2 */
+      1,  1,  1,  1,  1, 23,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
       1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
-      1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
-     11,  6,  7,  7,  7,  7,  7,  6, 12, 13, 14,  6,  7,  1, 13, 15,
-      7,  7, 16, 16, 17, 18,  6,  6, 19, 20, 21,  6, 22, 23, 22,  6,
-     24, 25, 26, 27, 28, 29,  9, 29, 28, 29, 30, 31, 28, 29, 30, 31,
-      9, 28, 28, 29, 30, 31, 32,  7,  9, 29, 30, 31, 32, 29,  9, 33,
-     34, 35, 36, 37, 38, 39, 10, 39, 38, 39, 40, 41, 38, 39, 40, 41,
-     10, 38, 38, 39, 40, 41, 42,  7, 10, 39, 40, 41, 42, 39, 10, 43,
+     24, 10, 11, 11, 11, 11, 11, 10, 25, 26, 27, 13, 11, 28, 26, 29,
+     11, 11, 30, 30, 31, 32, 10, 33, 34, 35, 36, 13, 37, 38, 37, 10,
+     39, 40, 41, 42, 43, 44, 20, 44, 43, 44, 45, 46, 43, 44, 45, 46,
+     20, 43, 43, 44, 45, 46, 47, 11, 20, 44, 45, 46, 47, 44, 20, 48,
+     49, 50, 51, 52, 53, 54, 22, 54, 53, 54, 55, 56, 53, 54, 55, 56,
+     22, 53, 53, 54, 55, 56, 57, 11, 22, 54, 55, 56, 57, 54, 22, 58,
     /* Block 3 */
-     44, 45, 46, 47, 48, 49, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
-     58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 68, 69, 70, 71,
-     72, 73, 74, 75, 76, 77, 58, 59, 78, 79, 80, 81, 82, 83, 84, 85,
-     86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99,100,101,
-    102, 58, 59,103,104,105,106,107,108,109, 58, 59,110,111,112,113,
-    114,115, 58, 59,116,117,118,119,120,121,122,123,124,125,126,127,
-    128,129,130,131,132,133, 58, 59,134,135,136,137,138,139,140,141,
-    142,143,144,145,144,145,144,145,146,147,148,149,150,151,152,153,
+     59, 60, 61, 62, 63, 64, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72,
+     73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 83, 84, 85, 86,
+     87, 88, 89, 90, 91, 92, 73, 74, 93, 94, 95, 96, 97, 98, 99,100,
+    101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,
+    117, 73, 74,118,119,120,121,122,123,124, 73, 74,125,126,127,128,
+    129,130, 73, 74,131,132,133,134,135,136,137,138,139,140,141,142,
+    143,144,145,146,147,148, 73, 74,149,150,151,152,153,154,155,156,
+    157,158,159,160,159,160,159,160,161,162,163,164,165,166,167,168,
     /* Block 4 */
-    154,155, 58, 59, 58, 59,156, 58, 59,157,157, 58, 59, 94,158,159,
-    160, 58, 59,157,161,162,163,164, 58, 59,165, 94,163,166,167,168,
-    169,170, 58, 59, 58, 59,171, 58, 59,171, 94, 94, 58, 59,171,172,
-    173,174,174, 58, 59, 58, 59,175, 58, 59, 94,176, 58, 59, 94,177,
-    176,176,176,176,178,179,180,181,182,183,184,185,186,187,188,189,
-    190,191,192,193,194,107,108,195,196,110,111,112,113,197,198,199,
-    200,201,202,203, 58, 59,204,205,206,207,208,209,210,211,212,213,
-    214,215,216,217,218,219,220,221,222,223,224,225,226,227,228,229,
+    169,170, 73, 74, 73, 74,171, 73, 74,172,172, 73, 74,109,173,174,
+    175, 73, 74,172,176,177,178,179, 73, 74,180,109,178,181,182,183,
+    184,185, 73, 74, 73, 74,186, 73, 74,186,109,109, 73, 74,186,187,
+    188,189,189, 73, 74, 73, 74,190, 73, 74,109,191, 73, 74,109,192,
+    191,191,191,191,193,194,195,196,197,198,199,200,201,202,203,204,
+    205,206,207,208,209,122,123,210,211,125,126,127,128,212,213,214,
+    215,216,217,218, 73, 74,219,220,221,222,223,224,225,226,227,228,
+    229,230,231,232,233,234,235,236,237,238,239,240,241,242,243,244,
     /* Block 5 */
-    230,231,232,233,230,231,232,233,230,231,232,233,234,235,230,231,
-    236,237,238,239,230,231,232,233,240,241,242,243, 58, 59,244,245,
-    246, 94, 58, 59, 58, 59,247,248,249,250,251,252,253,254,255,256,
-    210,211,257,258, 94, 94, 94, 94, 94, 94,259, 58, 59,260,261,262,
-    262, 58, 59,263,264,265, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59,
-    266,267,268,269,270, 94,271,271, 94,272, 94,273,274, 94, 94, 94,
-    271,275, 94,276, 94,277,278, 94,279,280,278,281,282, 94, 94,280,
-     94,283,284, 94, 94,285, 94, 94, 94, 94, 94, 94, 94,286, 94, 94,
+    245,246,247,248,245,246,247,248,245,246,247,248,249,250,245,246,
+    251,252,253,254,245,246,247,248,255,256,257,258, 73, 74,259,260,
+    261,109, 73, 74, 73, 74,262,263,264,265,266,267,268,269,270,271,
+    225,226,272,273,109,109,109,109,109,109,274, 73, 74,275,276,277,
+    277, 73, 74,278,279,280, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74,
+    281,282,283,284,285,109,286,286,109,287,109,288,289,109,109,109,
+    286,290,109,291,109,292,293,109,294,295,293,296,297,109,109,295,
+    109,298,299,109,109,300,109,109,109,109,109,109,109,301,109,109,
     /* Block 6 */
-    287, 94,288,287, 94, 94, 94,289,287,290,291,291,292, 94, 94, 94,
-     94, 94,293, 94,176, 94, 94, 94, 94, 94, 94, 94, 94,294,295, 94,
-     94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94,
-    296, 21,296,297,298,299,300,301,302,176,176,176,176,176,176,176,
-    176,176,  7,  7,  7,  7,176,176,176,176,176,176,176,176,176,176,
-    176,176,  7,  7,  7,  7,  7,  7,303,304,305,306,307,308,  7,  7,
-    309,310,311,312,313,  7,  7,  7,  7,  7,  7,  7,176,  7,176,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    302,109,303,302,109,109,109,304,302,305,306,306,307,109,109,109,
+    109,109,308,109,191,109,109,109,109,109,109,109,109,309,310,109,
+    109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,
+    311, 36,311,312,313,314,315,316,317,191,191,191,191,191,191,191,
+    318,318,319,319,319,319,191,191,191,191,191,191,191,191,191,191,
+    191,191,319,319,319,319,319,319,320,321,322,323,324,325,319,319,
+    326,327,328,329,330,319,319,319,319,319,319,319,191,319,191,319,
+    319,319,319,319,319,319,319,319,319,319,319,319,319,319,319,319,
     /* Block 7 */
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    315,315,314,316,317,318,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-     58, 59, 58, 59,319,  7, 58, 59,  0,  0,320,167,167,167,321,322,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    332,332,331,333,334,335,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+     73, 74, 73, 74,336, 11, 73, 74,  0,  0,337,182,182,182,338,339,
     /* Block 8 */
-      0,  0,  0,  0,323,324,325,326,327,328,329,  0,330,  0,331,332,
-    333,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
-      9,  9,  0,  9,  9,  9,  9,  9,  9,  9,334,335,336,337,338,339,
-    340, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
-     10, 10,341, 10, 10, 10, 10, 10, 10, 10,342,343,344,345,346,347,
-    348,349,350,351,352,353,354,355, 58, 59, 58, 59, 58, 59, 58, 59,
-     58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59,
-    356,357,358,359,360,361,  7, 58, 59,362, 58, 59, 94,246,246,246,
+      0,  0,  0,  0,340,341,342,343,344,345,346,  0,347,  0,348,349,
+    350, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+     20, 20,  0, 20, 20, 20, 20, 20, 20, 20,351,352,353,354,355,356,
+    357, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+     22, 22,358, 22, 22, 22, 22, 22, 22, 22,359,360,361,362,363,364,
+    365,366,367,368,369,370,371,372, 73, 74, 73, 74, 73, 74, 73, 74,
+     73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74,
+    373,374,375,376,377,378, 11, 73, 74,379, 73, 74,109,261,261,261,
     /* Block 9 */
-    363,364,365,366,365,365,365,367,365,365,365,365,368,369,363,365,
-      9,  9,  9,  9,  9,  9,  9,  9,  9,370,  9,  9,  9,  9,  9,  9,
-      9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
-     10, 10, 10, 10, 10, 10, 10, 10, 10,371, 10, 10, 10, 10, 10, 10,
-     10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
-    372,373,374,375,374,374,374,376,374,374,374,374,377,378,372,374,
-     58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59,
-     58, 59, 58, 59, 58, 59,210,211, 58, 59, 58, 59, 58, 59, 58, 59,
+    380,381,382,383,382,382,382,384,382,382,382,382,385,386,380,382,
+     20, 20, 20, 20, 20, 20, 20, 20, 20,387, 20, 20, 20, 20, 20, 20,
+     20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+     22, 22, 22, 22, 22, 22, 22, 22, 22,388, 22, 22, 22, 22, 22, 22,
+     22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    389,390,391,392,391,391,391,393,391,391,391,391,394,395,389,391,
+     73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74,
+     73, 74, 73, 74, 73, 74,225,226, 73, 74, 73, 74, 73, 74, 73, 74,
     /* Block 10 */
-     58, 59,  7,314,314,314,314,314,314,314, 58, 59, 58, 59, 58, 59,
-     58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59,
-     58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59,
-     58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59,
-    379,380,381, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59,382,
-    383,384,385,386, 58, 59, 46, 47, 58, 59,210,211,387,388, 52, 53,
-     58, 59, 56, 57,389,390,391,392, 58, 59,210,211, 44, 45,393,394,
-     60, 61, 62, 63, 60, 61, 58, 59, 60, 61, 58, 59, 58, 59, 58, 59,
+     73, 74, 11,331,331,331,331,331,331,331, 73, 74, 73, 74, 73, 74,
+     73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74,
+     73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74,
+     73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74,
+    396,397,398, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74,399,
+    400,401,402,403, 73, 74, 61, 62, 73, 74,225,226,404,405, 67, 68,
+     73, 74, 71, 72,406,407,408,409, 73, 74,225,226, 59, 60,410,411,
+     75, 76, 77, 78, 75, 76, 73, 74, 75, 76, 73, 74, 73, 74, 73, 74,
     /* Block 11 */
-     58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59,
-     58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59,
-     58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59,
-      0,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,
-    395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,
-    395,395,395,395,395,395,395,  0,  0,176,  6,  6,  6,  6,  6,  6,
-     94,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,
-    396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,
+     73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74,
+     73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74,
+     73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74,
+      0,412,412,412,412,412,412,412,412,412,412,412,412,412,412,412,
+    412,412,412,412,412,412,412,412,412,412,412,412,412,412,412,412,
+    412,412,412,412,412,412,412,  0,  0,191,413,413,413, 15,413, 33,
+    109,414,414,414,414,414,414,414,414,414,414,414,414,414,414,414,
+    414,414,414,414,414,414,414,414,414,414,414,414,414,414,414,414,
     /* Block 12 */
-    396,396,396,396,396,396,396,397, 94,  6,  6,  0,  0,  7,  7,  7,
-      0,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,  6,314,
-      6,314,314,  6,314,314,  6,314,  0,  0,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,  0,  0,  0,  0,176,
-    176,176,176,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    414,414,414,414,414,414,414,415,109,416,413,  0,  0, 11, 11, 11,
+      0,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331, 10,331,
+     10,331,331, 10,331,331, 10,331,  0,  0,  0,  0,  0,  0,  0,  0,
+    417,417,417,417,417,417,417,417,417,417,417,417,417,417,417,417,
+    417,417,417,417,417,417,417,417,417,417,417,  0,  0,  0,  0,417,
+    417,417,417,418, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 13 */
-    398,398,398,398,398,398,  7,  7,  7,  6,  6,  7,  6,  6,  7,  7,
-    314,314,314,314,314,314,314,314,314,314,314,  6,  1,  0,  6,  6,
-    176,176,399,400,401,402,401,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  6,  6,  6,  6,176,176,
-    314,176,176,176,176,403,404,405,404,176,176,176,176,176,176,176,
+    419,419,419,419,419,419, 11, 11, 11, 10, 10, 11, 14, 14, 11, 11,
+    331,331,331,331,331,331,331,331,331,331,331, 10, 28,  0,  8,  8,
+    191,191,420,421,422,423,422,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 10,424,425, 10,191,191,
+    331,191,191,191,191,426,427,428,427,191,191,191,191,191,191,191,
     /* Block 14 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    406,176,407,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,407,  6,176,314,314,314,314,314,314,314,398,  7,314,
-    314,314,314,314,314,176,176,314,314,  7,314,314,314,314,176,176,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,176,176,176,  7,  7,176,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    429,191,430,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,430,  8,191,331,331,331,331,331,331,331,419, 11,331,
+    331,331,331,331,331,191,191,331,331, 11,331,331,331,331,191,191,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,191,191,191, 11, 11,191,
     /* Block 15 */
-      6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  0,398,
-    176,314,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,  0,  0,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
+      8,  8,  8, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,  0,419,
+    191,331,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,  0,  0,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
     /* Block 16 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,314,314,314,314,314,314,314,314,314,314,
-    314,176,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,314,314,314,314,314,
-    314,314,314,314,176,176,  7,  6,  6,  6,176,  0,  0,314,  7,  7,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,331,331,331,331,331,331,331,331,331,331,
+    331,191,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,331,331,331,331,331,
+    331,331,331,331,191,191, 11, 10, 14,  8,191,  0,  0,331, 11, 11,
     /* Block 17 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,314,314,314,314,176,314,314,314,314,314,
-    314,314,314,314,176,314,314,314,176,314,314,314,314,314,  0,  0,
-      6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,314,314,314,  0,  0,  6,  0,
-    176,176,176,176,176,176,176,176,176,176,176,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,331,331,331,331,191,331,331,331,331,331,
+    331,331,331,331,191,331,331,331,191,331,331,331,331,331,  0,  0,
+     10, 10, 10, 10, 10, 10, 10,  8, 10,  8, 10, 10, 10,  8,  8,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,331,331,331,  0,  0, 10,  0,
+    191,191,191,191,191,191,191,191,191,191,191,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 18 */
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,  0,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,398,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,  0,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,419,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
     /* Block 19 */
-    314,314,314,408,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,407,176,176,176,176,176,176,
-    176,407,176,176,407,176,176,176,176,176,314,408,314,176,408,408,
-    408,314,314,314,314,314,314,314,314,408,408,408,408,314,408,408,
-    176,314,314,314,314,314,314,314,409,409,409,410,411,411,412,413,
-    176,176,314,314,  6,  6,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      6,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
+    331,331,331,431,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,430,191,191,191,191,191,191,
+    191,430,191,191,430,191,191,191,191,191,331,431,331,191,431,431,
+    431,331,331,331,331,331,331,331,331,431,431,431,431,331,431,431,
+    191,331,331,331,331,331,331,331,432,432,432,433,434,434,435,436,
+    191,191,331,331,  8,  8, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+     10,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
     /* Block 20 */
-    176,314,408,408,  0,176,176,176,176,176,176,176,176,  0,  0,176,
-    176,  0,  0,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,  0,176,176,176,176,176,176,
-    176,  0,176,  0,  0,  0,176,176,176,176,  0,  0,314,176,314,408,
-    408,314,314,314,314,  0,  0,408,408,  0,  0,414,415,314,176,  0,
-      0,  0,  0,  0,  0,  0,  0,314,  0,  0,  0,  0,411,411,  0,413,
-    176,176,314,314,  0,  0,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-    176,176,  7,  7,  8,  8,  8,  8,  8,  8,  7,  7,176,  6,314,  0,
+    191,331,431,431,  0,191,191,191,191,191,191,191,191,  0,  0,191,
+    191,  0,  0,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,  0,191,191,191,191,191,191,
+    191,  0,191,  0,  0,  0,191,191,191,191,  0,  0,331,191,331,431,
+    431,331,331,331,331,  0,  0,431,431,  0,  0,437,438,331,191,  0,
+      0,  0,  0,  0,  0,  0,  0,331,  0,  0,  0,  0,434,434,  0,436,
+    191,191,331,331,  0,  0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    191,191, 11, 11,439,439,439,439,439,439, 11, 11,191, 10,331,  0,
     /* Block 21 */
-      0,314,314,408,  0,176,176,176,176,176,176,  0,  0,  0,  0,176,
-    176,  0,  0,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,  0,176,176,176,176,176,176,
-    176,  0,176,407,  0,176,402,  0,176,176,  0,  0,314,  0,408,408,
-    408,314,314,  0,  0,  0,  0,314,314,  0,  0,314,314,314,  0,  0,
-      0,314,  0,  0,  0,  0,  0,  0,  0,409,409,410,176,  0,412,  0,
-      0,  0,  0,  0,  0,  0,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-    314,314,176,176,176,314,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,331,331,431,  0,191,191,191,191,191,191,  0,  0,  0,  0,191,
+    191,  0,  0,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,  0,191,191,191,191,191,191,
+    191,  0,191,430,  0,191,423,  0,191,191,  0,  0,331,  0,431,431,
+    431,331,331,  0,  0,  0,  0,331,331,  0,  0,331,331,331,  0,  0,
+      0,331,  0,  0,  0,  0,  0,  0,  0,432,432,433,191,  0,435,  0,
+      0,  0,  0,  0,  0,  0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    331,331,191,191,191,331, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 22 */
-      0,314,314,408,  0,176,176,176,176,176,176,176,176,176,  0,176,
-    176,176,  0,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,  0,176,176,176,176,176,176,
-    176,  0,176,176,  0,176,176,176,176,176,  0,  0,314,176,408,408,
-    408,314,314,314,314,314,  0,314,314,408,  0,408,408,314,  0,  0,
-    176,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    176,176,314,314,  0,  0,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      6,  7,  0,  0,  0,  0,  0,  0,  0,176,314,314,314,314,314,314,
+      0,331,331,431,  0,191,191,191,191,191,191,191,191,191,  0,191,
+    191,191,  0,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,  0,191,191,191,191,191,191,
+    191,  0,191,191,  0,191,191,191,191,191,  0,  0,331,191,431,431,
+    431,331,331,331,331,331,  0,331,331,431,  0,431,431,331,  0,  0,
+    191,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,331,331,  0,  0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+     10, 11,  0,  0,  0,  0,  0,  0,  0,191,331,331,331,331,331,331,
     /* Block 23 */
-      0,314,408,408,  0,176,176,176,176,176,176,176,176,  0,  0,176,
-    176,  0,  0,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,  0,176,176,176,176,176,176,
-    176,  0,176,176,  0,176,176,176,176,176,  0,  0,314,176,314,314,
-    408,314,314,314,314,  0,  0,408,416,  0,  0,414,415,314,  0,  0,
-      0,  0,  0,  0,  0,314,314,314,  0,  0,  0,  0,411,411,  0,176,
-    176,176,314,314,  0,  0,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      7,176,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,331,431,431,  0,191,191,191,191,191,191,191,191,  0,  0,191,
+    191,  0,  0,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,  0,191,191,191,191,191,191,
+    191,  0,191,191,  0,191,191,191,191,191,  0,  0,331,191,331,331,
+    431,331,331,331,331,  0,  0,431,440,  0,  0,437,438,331,  0,  0,
+      0,  0,  0,  0,  0,331,331,331,  0,  0,  0,  0,434,434,  0,191,
+    191,191,331,331,  0,  0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+     11,191,439,439,439,439,439,439,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 24 */
-      0,  0,314,176,  0,176,176,176,176,176,176,  0,  0,  0,176,176,
-    176,  0,176,176,417,176,  0,  0,  0,176,176,  0,176,  0,176,176,
-      0,  0,  0,176,176,  0,  0,  0,176,176,176,  0,  0,  0,176,176,
-    176,176,176,176,176,176,176,176,176,176,  0,  0,  0,  0,314,408,
-    314,408,408,  0,  0,  0,408,408,408,  0,414,414,418,314,  0,  0,
-    176,  0,  0,  0,  0,  0,  0,314,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  7,  7,  7,  7,  7,  7,  7,  7,  0,  0,  0,  0,  0,
+      0,  0,331,191,  0,191,191,191,191,191,191,  0,  0,  0,191,191,
+    191,  0,191,191,441,191,  0,  0,  0,191,191,  0,191,  0,191,191,
+      0,  0,  0,191,191,  0,  0,  0,191,191,191,  0,  0,  0,191,191,
+    191,191,191,191,191,191,191,191,191,191,  0,  0,  0,  0,331,431,
+    331,431,431,  0,  0,  0,431,431,431,  0,437,437,442,331,  0,  0,
+    191,  0,  0,  0,  0,  0,  0,331,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    439,439,439, 11, 11, 11, 11, 11, 11, 11, 11,  0,  0,  0,  0,  0,
     /* Block 25 */
-    314,408,408,408,314,176,176,176,176,176,176,176,176,  0,176,176,
-    176,  0,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,  0,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,  0,  0,  0,176,314,314,
-    314,408,408,408,408,  0,314,314,419,  0,314,314,314,314,  0,  0,
-      0,  0,  0,  0,  0,314,314,  0,176,176,176,  0,  0,  0,  0,  0,
-    176,176,314,314,  0,  0,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      0,  0,  0,  0,  0,  0,  0,  6,  8,  8,  8,  8,  8,  8,  8,  7,
+    331,431,431,431,331,191,191,191,191,191,191,191,191,  0,191,191,
+    191,  0,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,  0,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,  0,  0,  0,191,331,331,
+    331,431,431,431,431,  0,331,331,443,  0,331,331,331,331,  0,  0,
+      0,  0,  0,  0,  0,331,331,  0,191,191,191,  0,  0,  0,  0,  0,
+    191,191,331,331,  0,  0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+      0,  0,  0,  0,  0,  0,  0, 10,439,439,439,439,439,439,439, 11,
     /* Block 26 */
-    176,314,408,408,  6,176,176,176,176,176,176,176,176,  0,176,176,
-    176,  0,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,  0,176,176,176,176,176,176,
-    176,176,176,176,  0,176,176,176,176,176,  0,  0,314,176,408,314,
-    416,408,314,408,408,  0,314,416,420,  0,414,416,314,314,  0,  0,
-      0,  0,  0,  0,  0,314,314,  0,  0,  0,  0,  0,  0,  0,176,  0,
-    176,176,314,314,  0,  0,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      0,176,176,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,331,431,431, 10,191,191,191,191,191,191,191,191,  0,191,191,
+    191,  0,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,  0,191,191,191,191,191,191,
+    191,191,191,191,  0,191,191,191,191,191,  0,  0,331,191,431,331,
+    440,431,331,431,431,  0,331,440,444,  0,437,440,331,331,  0,  0,
+      0,  0,  0,  0,  0,331,331,  0,  0,  0,  0,  0,  0,  0,191,  0,
+    191,191,331,331,  0,  0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+      0,191,191,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 27 */
-    314,314,408,408,176,176,176,176,176,176,176,176,176,  0,176,176,
-    176,  0,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,314,314,176,314,408,
-    408,314,314,314,314,  0,408,408,408,  0,414,414,418,314,421,  7,
-      0,  0,  0,  0,176,176,176,314,  8,  8,  8,  8,  8,  8,  8,176,
-    176,176,314,314,  0,  0,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  7,176,176,176,176,176,176,
+    331,331,431,431,191,191,191,191,191,191,191,191,191,  0,191,191,
+    191,  0,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,331,331,191,331,431,
+    431,331,331,331,331,  0,431,431,431,  0,437,437,442,331,445, 11,
+      0,  0,  0,  0,191,191,191,331,439,439,439,439,439,439,439,191,
+    191,191,331,331,  0,  0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    439,439,439,439,439,439,439,439,439, 11,191,191,191,191,191,191,
     /* Block 28 */
-      0,314,408,408,  0,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,  0,  0,  0,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,  0,176,176,176,176,176,176,176,176,176,  0,176,  0,  0,
-    176,176,176,176,176,176,176,  0,  0,  0,314,  0,  0,  0,  0,314,
-    408,408,314,314,314,  0,314,  0,408,408,416,408,422,416,415,314,
-      0,  0,  0,  0,  0,  0,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      0,  0,408,408,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,331,431,431,  0,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,  0,  0,  0,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,  0,191,191,191,191,191,191,191,191,191,  0,191,  0,  0,
+    191,191,191,191,191,191,191,  0,  0,  0,331,  0,  0,  0,  0,331,
+    431,431,331,331,331,  0,331,  0,431,431,440,431,446,440,438,331,
+      0,  0,  0,  0,  0,  0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+      0,  0,431,431, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 29 */
-      0,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,314,176,423,314,314,314,314,314,314,314,  0,  0,  0,  0,  7,
-    176,176,176,176,176,176,176,314,314,314,314,314,314,314,314,  6,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  6,  6,  0,  0,  0,  0,
+      0,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,
+    447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,
+    447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,
+    447,331,447,448,331,331,331,331,331,331,331,  0,  0,  0,  0, 11,
+    447,447,447,447,447,447,447,331,331,331,331,331,331,331,331, 10,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 10, 10,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 30 */
-      0,176,176,  0,176,  0,176,176,176,176,176,  0,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,  0,176,  0,176,176,176,176,176,176,176,176,176,
-    176,314,176,423,314,314,314,314,314,314,314,314,314,176,  0,  0,
-    176,176,176,176,176,  0,176,  0,314,314,314,314,314,314,  0,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,424,425,176,176,
+      0,447,447,  0,447,  0,447,447,447,447,447,  0,447,447,447,447,
+    447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,
+    447,447,447,447,  0,447,  0,447,447,447,447,447,447,447,447,447,
+    447,331,447,448,331,331,331,331,331,331,331,331,331,447,  0,  0,
+    447,447,447,447,447,  0,447,  0,331,331,331,331,331,331,  0,  0,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  0,  0,449,450,447,447,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 31 */
-    176,  7,  7,  7,  6,  6,  6,  6,  6,  6,  6,  6,426,  6,  6,  6,
-      6,  6,  6,  7,  6,  7,  7,  7,314,314,  7,  7,  7,  7,  7,  7,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  7,314,  7,314,  7,314,  6,  6,  6,  6,408,408,
-    176,176,176,407,176,176,176,176,  0,176,176,176,176,407,176,176,
-    176,176,407,176,176,176,176,407,176,176,176,176,407,176,176,176,
-    176,176,176,176,176,176,176,176,176,427,176,176,176,  0,  0,  0,
-      0,314,314,419,314,428,429,430,431,432,314,314,314,314,314,408,
+    191, 11, 11, 11, 10, 10, 10, 10, 10, 10, 10, 10,451, 10, 10, 10,
+     10, 10, 10, 11, 10, 11, 11, 11,331,331, 11, 11, 11, 11, 11, 11,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,439,439,439,439,439,439,
+    439,439,439,439, 11,331, 11,331, 11,331, 13, 13, 13, 13,431,431,
+    191,191,191,430,191,191,191,191,  0,191,191,191,191,430,191,191,
+    191,191,430,191,191,191,191,430,191,191,191,191,430,191,191,191,
+    191,191,191,191,191,191,191,191,191,452,191,191,191,  0,  0,  0,
+      0,331,331,443,331,453,454,455,456,457,331,331,331,331,331,431,
     /* Block 32 */
-    314,433,314,314,314,  6,314,314,176,176,176,176,176,314,314,314,
-    314,314,314,434,314,314,314,314,  0,314,314,314,314,434,314,314,
-    314,314,434,314,314,314,314,434,314,314,314,314,434,314,314,314,
-    314,314,314,314,314,314,314,314,314,435,314,314,314,  0,  7,  7,
-      7,  7,  7,  7,  7,  7,314,  7,  7,  7,  7,  7,  7,  0,  7,  7,
-      6,  6,  6,  6,  6,  7,  7,  7,  7,  6,  6,  0,  0,  0,  0,  0,
+    331,458,331,331,331, 10,331,331,191,191,191,191,191,331,331,331,
+    331,331,331,459,331,331,331,331,  0,331,331,331,331,459,331,331,
+    331,331,459,331,331,331,331,459,331,331,331,331,459,331,331,331,
+    331,331,331,331,331,331,331,331,331,460,331,331,331,  0, 11, 11,
+     11, 11, 11, 11, 11, 11,331, 11, 11, 11, 11, 11, 11,  0, 11, 11,
+     10, 10, 10, 10, 10, 11, 11, 11, 11, 10, 10,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 33 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,407,176,176,176,176,436,436,314,314,314,
-    314,408,314,314,314,314,314,314,436,314,314,408,408,314,314,176,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  6,  6,  6,  6,  6,  6,
-    176,176,176,176,176,176,408,408,314,314,176,176,176,176,314,314,
-    314,176,436,436,436,176,176,436,436,436,436,436,436,436,176,176,
-    176,314,314,314,314,176,176,176,176,176,176,176,176,176,176,176,
+    447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,
+    447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,
+    447,447,447,447,447,447,461,447,447,447,447,462,462,331,331,331,
+    331,431,331,331,331,331,331,331,462,331,331,431,431,331,331,447,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  8,  8, 10, 10, 10, 10,
+    447,447,447,447,447,447,431,431,331,331,447,447,447,447,331,331,
+    331,447,462,462,462,447,447,462,462,462,462,462,462,462,447,447,
+    447,331,331,331,331,447,447,447,447,447,447,447,447,447,447,447,
     /* Block 34 */
-    176,176,314,436,408,314,314,436,436,436,436,436,436,314,176,436,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,436,436,436,314,  7,  7,
-    437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,
-    437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,
-    437,437,437,437,437,437,  0,437,  0,  0,  0,  0,  0,437,  0,  0,
-    438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,
-    438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,
-    438,438,438,438,438,438,438,438,438,438,438,  6,439,438,438,438,
+    447,447,331,462,431,331,331,462,462,462,462,462,462,331,447,462,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,462,462,462,331, 11, 11,
+    463,463,463,463,463,463,463,463,463,463,463,463,463,463,463,463,
+    463,463,463,463,463,463,463,463,463,463,463,463,463,463,463,463,
+    463,463,463,463,463,463,  0,463,  0,  0,  0,  0,  0,463,  0,  0,
+    464,464,464,464,464,464,464,464,464,464,464,464,464,464,464,464,
+    464,464,464,464,464,464,464,464,464,464,464,464,464,464,464,464,
+    464,464,464,464,464,464,464,464,464,464,464, 10,465,464,464,464,
     /* Block 35 */
-    440,440,440,440,440,440,440,440,440,440,440,440,440,440,440,440,
-    440,440,440,440,440,440,440,440,440,440,440,440,440,440,440,440,
-    440,440,440,440,440,440,440,440,440,440,440,440,440,440,440,440,
-    440,440,440,440,440,440,440,440,440,440,440,440,440,440,440,440,
-    440,440,440,440,440,440,440,440,440,440,440,440,440,440,440,440,
-    440,440,440,440,440,440,440,440,440,440,440,440,440,440,440,440,
-    441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,
-    441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,
+    466,466,466,466,466,466,466,466,466,466,466,466,466,466,466,466,
+    466,466,466,466,466,466,466,466,466,466,466,466,466,466,466,466,
+    466,466,466,466,466,466,466,466,466,466,466,466,466,466,466,466,
+    466,466,466,466,466,466,466,466,466,466,466,466,466,466,466,466,
+    466,466,466,466,466,466,466,466,466,466,466,466,466,466,466,466,
+    466,466,466,466,466,466,466,466,466,466,466,466,466,466,466,466,
+    467,467,467,467,467,467,467,467,467,467,467,467,467,467,467,467,
+    467,467,467,467,467,467,467,467,467,467,467,467,467,467,467,467,
     /* Block 36 */
-    441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,
-    441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,
-    441,441,441,441,441,441,441,441,442,442,442,442,442,442,442,442,
-    442,442,442,442,442,442,442,442,442,442,442,442,442,442,442,442,
-    442,442,442,442,442,442,442,442,442,442,442,442,442,442,442,442,
-    442,442,442,442,442,442,442,442,442,442,442,442,442,442,442,442,
-    442,442,442,442,442,442,442,442,442,442,442,442,442,442,442,442,
-    442,442,442,442,442,442,442,442,442,442,442,442,442,442,442,442,
+    467,467,467,467,467,467,467,467,467,467,467,467,467,467,467,467,
+    467,467,467,467,467,467,467,467,467,467,467,467,467,467,467,467,
+    467,467,467,467,467,467,467,467,468,468,468,468,468,468,468,468,
+    468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,
+    468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,
+    468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,
+    468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,
+    468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,
     /* Block 37 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,  0,176,176,176,176,  0,  0,
-    176,176,176,176,176,176,176,  0,176,  0,176,176,176,176,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,  0,191,191,191,191,  0,  0,
+    191,191,191,191,191,191,191,  0,191,  0,191,191,191,191,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
     /* Block 38 */
-    176,176,176,176,176,176,176,176,176,  0,176,176,176,176,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,  0,176,176,176,176,  0,  0,176,176,176,176,176,176,176,  0,
-    176,  0,176,176,176,176,  0,  0,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,  0,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
+    191,191,191,191,191,191,191,191,191,  0,191,191,191,191,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,  0,191,191,191,191,  0,  0,191,191,191,191,191,191,191,  0,
+    191,  0,191,191,191,191,  0,  0,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,  0,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
     /* Block 39 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,  0,176,176,176,176,  0,  0,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,  0,  0,314,314,314,
-      6,  6,  6,  6,  6,  6,  6,  6,  6,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,  0,191,191,191,191,  0,  0,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,  0,  0,331,331,331,
+     10, 10,  8, 10, 10, 10, 10,  8,  8,439,439,439,439,439,439,439,
+    439,439,439,439,439,439,439,439,439,439,439,439,439,  0,  0,  0,
     /* Block 40 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  0,  0,  0,  0,  0,  0,
-    443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,
-    443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,
-    443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,
-    443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,
-    443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,
-    444,444,444,444,444,444,  0,  0,445,445,445,445,445,445,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11,  0,  0,  0,  0,  0,  0,
+    469,469,469,469,469,469,469,469,469,469,469,469,469,469,469,469,
+    469,469,469,469,469,469,469,469,469,469,469,469,469,469,469,469,
+    469,469,469,469,469,469,469,469,469,469,469,469,469,469,469,469,
+    469,469,469,469,469,469,469,469,469,469,469,469,469,469,469,469,
+    469,469,469,469,469,469,469,469,469,469,469,469,469,469,469,469,
+    470,470,470,470,470,470,  0,  0,471,471,471,471,471,471,  0,  0,
     /* Block 41 */
-      6,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
+     10,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
     /* Block 42 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
     /* Block 43 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,  7,  6,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191, 11,  8,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
     /* Block 44 */
-      5,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,  6,  6,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,  6,  6,  6,  8,  8,
-      8,176,176,176,176,176,176,176,176,  0,  0,  0,  0,  0,  0,  0,
+      7,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191, 13, 13,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191, 10, 10, 10,472,472,
+    472,191,191,191,191,191,191,191,191,  0,  0,  0,  0,  0,  0,  0,
     /* Block 45 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,  0,176,176,
-    176,176,314,314,314,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,314,314,314,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,314,314,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,  0,176,176,
-    176,  0,314,314,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,  0,191,191,
+    191,191,331,331,331,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,331,331,331,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,331,331,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,  0,191,191,
+    191,  0,331,331,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 46 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,314,314,408,314,314,314,314,314,314,314,408,408,
-    408,408,408,408,408,408,314,408,408,314,314,314,314,314,314,314,
-    314,314,314,314,  6,  6,  6,176,  6,  6,  6,  7,176,314,  0,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,
+    447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,
+    447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,
+    447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,
+    447,447,447,447,331,331,431,331,331,331,331,331,331,331,431,431,
+    431,431,431,431,431,431,331,431,431,331,331,331,331,331,331,331,
+    331,331,331,331, 10, 10, 10,447, 10, 10, 10, 11,447,331,  0,  0,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  0,  0,  0,  0,  0,  0,
+    439,439,439,439,439,439,439,439,439,439,  0,  0,  0,  0,  0,  0,
     /* Block 47 */
-      6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,314,314,314,  1,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,  0,  0,  0,  0,  0,  0,  0,
+     10, 10, 15,  8, 10, 10, 10, 10, 15,  8, 10,331,331,331, 28,  0,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,  0,  0,  0,  0,  0,  0,  0,
     /* Block 48 */
-    176,176,176,176,176,314,314,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,314,176,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,331,331,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,331,191,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 49 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,  0,
-    314,314,314,408,408,408,408,314,314,408,408,408,  0,  0,  0,  0,
-    408,408,314,408,408,408,408,408,408,314,314,314,  0,  0,  0,  0,
-      7,  0,  0,  0,  6,  6,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,  0,  0,
-    176,176,176,176,176,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,  0,
+    331,331,331,431,431,431,431,331,331,431,431,431,  0,  0,  0,  0,
+    431,431,331,431,431,431,431,431,431,331,331,331,  0,  0,  0,  0,
+     11,  0,  0,  0,  8,  8, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,
+    447,447,447,447,447,447,447,447,447,447,447,447,447,447,  0,  0,
+    447,447,447,447,447,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 50 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,  0,  0,  0,  0,  0,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,
+    447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,
+    447,447,447,447,447,447,447,447,447,447,447,447,  0,  0,  0,  0,
+    447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,
+    447,447,447,447,447,447,447,447,447,447,  0,  0,  0,  0,  0,  0,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,439,  0,  0,  0, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
     /* Block 51 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,314,314,408,408,314,  0,  0,  6,  6,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,408,314,408,314,314,314,314,314,314,314,  0,
-    314,436,314,436,436,314,314,314,314,314,314,314,314,408,408,408,
-    408,408,408,314,314,314,314,314,314,314,314,314,314,  0,  0,314,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,331,331,431,431,331,  0,  0, 10, 10,
+    447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,
+    447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,
+    447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,
+    447,447,447,447,447,431,331,431,331,331,331,331,331,331,331,  0,
+    331,462,331,462,462,331,331,331,331,331,331,331,331,431,431,431,
+    431,431,431,331,331,331,331,331,331,331,331,331,331,  0,  0,331,
     /* Block 52 */
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,
-      6,  6,  6,  6,  6,  6,  6,176,  6,  6,  6,  6,  6,  6,  0,  0,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  0,  0,  0,  0,  0,  0,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  0,  0,  0,  0,  0,  0,
+     10, 10, 10, 10, 10, 10, 10,447,  8,  8,  8,  8, 10, 10,  0,  0,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 53 */
-    314,314,314,314,408,176,407,176,407,176,407,176,407,176,407,176,
-    176,176,407,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,314,314,314,314,314,314,314,416,314,416,408,408,
-    420,420,314,416,408,176,176,176,176,176,176,176,  0,  0,  0,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  6,  6,  6,  6,  6,  6,
-      6,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,314,314,314,314,314,
-    314,314,314,314,  7,  7,  7,  7,  7,  7,  7,  7,  7,  0,  0,  0,
+    331,331,331,331,431,191,430,191,430,191,430,191,430,191,430,191,
+    191,191,430,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,331,331,331,331,331,331,331,440,331,440,431,431,
+    444,444,331,440,431,191,191,191,191,191,191,191,  0,  0,  0,  0,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  8,  8, 10, 10,  8,  8,
+     10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,331,331,331,331,331,
+    331,331,331,331, 11, 11, 11, 11, 11, 11, 11, 11, 11,  0,  0,  0,
     /* Block 54 */
-    314,314,408,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,408,314,314,314,314,408,408,314,314,408,314,314,314,176,176,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,314,408,314,314,408,408,408,314,408,314,
-    314,314,408,408,  0,  0,  0,  0,  0,  0,  0,  0,  6,  6,  6,  6,
+    331,331,431,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,431,331,331,331,331,431,431,331,331,431,331,331,331,191,191,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,331,431,331,331,431,431,431,331,431,331,
+    331,331,431,431,  0,  0,  0,  0,  0,  0,  0,  0, 10, 10, 10, 10,
     /* Block 55 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,408,408,408,408,408,408,408,408,314,314,314,314,
-    314,314,314,314,408,408,314,314,  0,  0,  0,  6,  6,  6,  6,  6,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,176,176,176,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,  6,  6,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,431,431,431,431,431,431,431,431,331,331,331,331,
+    331,331,331,331,431,431,331,331,  0,  0,  0,  8,  8, 10, 10, 10,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  0,  0,  0,191,191,191,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,  8,  8,
     /* Block 56 */
-    446,447,448,449,449,450,451,452,453,  0,  0,  0,  0,  0,  0,  0,
-    454,454,454,454,454,454,454,454,454,454,454,454,454,454,454,454,
-    454,454,454,454,454,454,454,454,454,454,454,454,454,454,454,454,
-    454,454,454,454,454,454,454,454,454,454,454,  0,  0,454,454,454,
-      6,  6,  6,  6,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,
-    314,314,314,  6,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,408,314,314,314,314,314,314,314,176,176,176,176,314,176,176,
-    176,176,176,176,314,176,176,408,314,314,176,  0,  0,  0,  0,  0,
+    473,474,475,476,476,477,478,479,480,  0,  0,  0,  0,  0,  0,  0,
+    481,481,481,481,481,481,481,481,481,481,481,481,481,481,481,481,
+    481,481,481,481,481,481,481,481,481,481,481,481,481,481,481,481,
+    481,481,481,481,481,481,481,481,481,481,481,  0,  0,481,481,481,
+     10, 10, 10, 10, 10, 10, 10, 10,  0,  0,  0,  0,  0,  0,  0,  0,
+    331,331,331, 10,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,431,331,331,331,331,331,331,331,191,191,191,191,331,191,191,
+    191,191,191,191,331,191,191,431,331,331,191,  0,  0,  0,  0,  0,
     /* Block 57 */
-     94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94,
-     94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94,
-     94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94,455,456,457,176,
-    457,457,458,457,457,457,457,457,457,457,457,176,459,460,461,459,
-    457,457,455,462,463,463,464,465,466,466,467,468,468,469,176,466,
-    470,471,470,472,473,473,469,470,470,474,475,465,476,477,477,477,
-    478,478,479,480,481,481,482,482,483,484,484, 94, 94, 94, 94, 94,
-     94, 94, 94, 94, 94, 94, 94, 94,485,486, 94, 94, 94,487, 94, 94,
+    109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,
+    109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,
+    109,109,109,109,109,109,109,109,109,109,109,109,482,483,484,318,
+    484,484,485,484,484,484,484,484,484,484,484,318,486,487,488,486,
+    484,484,482,489,490,490,491,492,493,493,494,495,495,496,318,493,
+    497,498,497,499,500,500,496,497,497,501,502,492,503,504,504,504,
+    505,505,506,507,508,508,509,509,510,511,511,109,109,109,109,109,
+    109,109,109,109,109,109,109,109,512,513,109,109,109,514,109,109,
     /* Block 58 */
-     94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94,488, 94,
-     94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94,489,490,491,492,493,
-    494,495,496,497,498,498,498,499,500,498,501,502,503,504,498,498,
-    498,498,505,506,506,507,508,508,509,510,510,511,512,512,512,513,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,  0,314,314,314,314,314,
+    109,109,109,109,109,109,109,109,109,109,109,109,109,109,515,109,
+    109,109,109,109,109,109,109,109,109,109,109,516,517,518,519,520,
+    521,522,523,524,525,525,525,526,527,525,528,529,530,531,525,525,
+    525,525,532,533,533,534,535,535,536,537,537,538,539,539,539,540,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,  0,331,331,331,331,331,
     /* Block 59 */
-    514,515,516,517,518,519,520,521,522,523,524,525,526,527,528,529,
-    530,531,532,533,534,535,536,537,538,539,540,541,542,543,544,545,
-    546,547,548,549,550,551,552,553,554,555,556,557,558,559,560,561,
-    562,563,564,565,566,567,568,569,210,211,570,571,572,573,574,575,
-    576,577,578,579,580,581,582,583,584,585,586,587,588,589,590,591,
-    536,537,592,593,594,595,596,597,596,597,598,599,210,211,600,601,
-    602,603,604,605,606,607,592,593,608,609,610,611,612,613,614,615,
-    616,617,618,619,620,621,622,623,624,625,624,625,626,627,628,629,
+    541,542,543,544,545,546,547,548,549,550,551,552,553,554,555,556,
+    557,558,559,560,561,562,563,564,565,566,567,568,569,570,571,572,
+    573,574,575,576,577,578,579,580,581,582,583,584,585,586,587,588,
+    589,590,591,592,593,594,595,596,225,226,597,598,599,600,601,602,
+    603,604,605,606,607,608,609,610,611,612,613,614,615,616,617,618,
+    563,564,619,620,621,622,623,624,623,624,625,626,225,226,627,628,
+    629,630,631,632,633,634,619,620,635,636,637,638,639,640,641,642,
+    643,644,645,646,647,648,649,650,651,652,651,652,653,654,655,656,
     /* Block 60 */
-    630,631,632,633,634,635,636,637,638,639,640,641,642,643,644,645,
-    646,647,648,649,650,651,652,653,654,655,656,657, 94, 94,658, 94,
-    659,660,661,662,556,557,663,664,665,666,667,668,669,670,671,672,
-    673,674,675,676,677,678,679,680,681,682,683,684,685,686,687,688,
-    580,581,582,583,584,585,689,690,691,692,693,694,695,696,691,692,
-    586,587,697,698,699,700,701,702,669,670,703,704,705,706,707,708,
-    709,561,710,711,712,713,714,715,716,717,718,719,720,721,722,723,
-    522,724,725,726,727,728,729,730,731,732, 58, 59, 58, 59, 58, 59,
+    657,658,659,660,661,662,663,664,665,666,667,668,669,670,671,672,
+    673,674,675,676,677,678,679,680,681,682,683,684,109,109,685,109,
+    686,687,688,689,583,584,690,691,692,693,694,695,696,697,698,699,
+    700,701,702,703,704,705,706,707,708,709,710,711,712,713,714,715,
+    607,608,609,610,611,612,716,717,718,719,720,721,722,723,718,719,
+    613,614,724,725,726,727,728,729,696,697,730,731,732,733,734,735,
+    736,588,737,738,739,740,741,742,743,744,745,746,747,748,749,750,
+    549,751,752,753,754,755,756,757,758,759, 73, 74, 73, 74, 73, 74,
     /* Block 61 */
-    733,734,735,735,736,736,737,737,738,739,740,740,741,741,742,742,
-    743,744,735,735,736,736,  0,  0,745,746,740,740,741,741,  0,  0,
-    747,748,735,735,736,736,737,737,749,750,740,740,741,741,742,742,
-    751,752,735,735,736,736,737,737,753,754,740,740,741,741,742,742,
-    755,756,735,735,736,736,  0,  0,757,758,740,740,741,741,  0,  0,
-    759,760,761,735,762,736,763,737,  0,764,  0,740,  0,741,  0,742,
-    765,766,735,735,736,736,737,737,767,768,740,740,741,741,742,742,
-    769,770,771,772,771,773,774,775,776,777,778,779,780,781,  0,  0,
+    760,761,762,762,763,763,764,764,765,766,767,767,768,768,769,769,
+    770,771,762,762,763,763,  0,  0,772,773,767,767,768,768,  0,  0,
+    774,775,762,762,763,763,764,764,776,777,767,767,768,768,769,769,
+    778,779,762,762,763,763,764,764,780,781,767,767,768,768,769,769,
+    782,783,762,762,763,763,  0,  0,784,785,767,767,768,768,  0,  0,
+    786,787,788,762,789,763,790,764,  0,791,  0,767,  0,768,  0,769,
+    792,793,762,762,763,763,764,764,794,795,767,767,768,768,769,769,
+    796,797,798,799,798,800,801,802,803,804,805,806,807,808,  0,  0,
     /* Block 62 */
-    782,783,784,785,786,787,788,789,790,791,792,793,794,795,796,797,
-    798,799,800,801,802,803,804,805,806,807,808,809,810,811,812,813,
-    814,815,816,817,818,819,820,821,822,823,824,825,826,827,828,829,
-    830,831,832,833,834,  0,835,836,837,838,839,840,841,842,843,844,
-    845,846,847,848,849,  0,850,851,852,853,852,854,855,856,857,858,
-    859,860,861,862,  0,  0,863,864,865,866,867,868,  0,869,870,871,
-    872,873,874,875,876,877,878,879,880,881,882,883,884,885,886,887,
-      0,  0,888,889,890,  0,891,892,893,894,895,896,897,898,899,  0,
+    809,810,811,812,813,814,815,816,817,818,819,820,821,822,823,824,
+    825,826,827,828,829,830,831,832,833,834,835,836,837,838,839,840,
+    841,842,843,844,845,846,847,848,849,850,851,852,853,854,855,856,
+    857,858,859,860,861,  0,862,863,864,865,866,867,868,869,870,871,
+    872,873,874,875,876,  0,877,878,879,880,879,881,882,883,884,885,
+    886,887,888,889,  0,  0,890,891,892,893,894,895,  0,896,897,898,
+    899,900,901,902,903,904,905,906,907,908,909,910,911,912,913,914,
+      0,  0,915,916,917,  0,918,919,920,921,922,923,924,925,926,  0,
     /* Block 63 */
-    900,900,901,902,903,904,905,906,907,908,909,  1,910,911,  1,  1,
-      6,426,  6,  6,  6,  6,  6,912,  6,  6,  6,  6,  6,  6,  6,  6,
-      6,  6,  6,  6,913,912,914,  6,915,916,  1,  1,  1,  1,  1,917,
-      6,  6,  6,426,918,  6,426,918,  6,  6,  6,  6,919,  6,920,  6,
-      6,  6,  6,  6,  7,  6,  6,921,922,923,  6,  6,  6,  6,  6,  6,
-      6,  6,  7,  6,  6,  6,  6,924,  6,  6,  6,  6,  6,  6,  6,925,
-      1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
-    926,927,  0,  0,926,926,926,926,926,926,928,929,930,931,931,932,
+    927,927,928,929,930,931,932,933,934,935,936,937,938,939, 28, 28,
+     10,451, 10, 15, 15, 10, 10,940,941,941, 13, 13, 13, 13, 13, 13,
+     10, 10, 10, 10,942,940,943, 33,944,945, 28, 28, 28, 28, 28,946,
+     10, 10, 10,451,947, 10,451,947, 10, 13, 13, 10,948,  8,949, 21,
+     21, 10, 10, 10,950, 13, 13,951,952,953, 10, 10, 10, 10, 10, 10,
+     10, 10, 11, 10, 21, 10, 10,954, 10, 10, 10, 10, 10, 10, 10,955,
+     28, 28, 28, 28, 28,  1, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    956,957,  0,  0,956,956,956,956,956,956,958,959,960,961,961,962,
     /* Block 64 */
-    933,933,933,933,933,933,933,933,933,933,934,935,928,936,936,  0,
-    937,938,939,940,941,942,943,943,943,943,944,945,945,  0,  0,  0,
-      7,  7,  7,  7,  7,  7,  7,  7,946,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    963,963,963,963,963,963,963,963,963,963,964,965,958,966,966,  0,
+    967,968,969,970,971,972,973,973,973,973,974,975,975,  0,  0,  0,
+     11, 11, 11, 11, 11, 11, 11, 11,976, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 65 */
-    947,948,949,950,  7,951,952,953,  7,954,955,956,957,958,959,960,
-    961,962,963,964,  7,961,965,  7,  7,966,966,966,967,968,  7,  7,
-    969,969,970,  7,967,  7,971,  7,972,  7,973,974,975,975,  7,976,
-    977,977,978,979,980,981,981,981,981,982,  7,983,984,985,986,987,
-    988,  7,  7,  7,  7,989,990,990,991,991,  7,  7,  7,  7,992,  7,
-    993,994,995,996,996,997,997,997,997,998,999,1000,1001,998,1002,1003,
-    1004,1005,1006,1007,1008,1009,1010,1011,1012,1011,1013,1014,1015,1016,1016,1017,
-    1018,1019,1020,1021,1022,1023,1024,1025,1026,1025,1027,1028,1029,1030,1030,1031,
+    977,978,979,980, 11,981,982,983, 11,984,985,986,987,988,989,990,
+    991,992,993,994, 11,991,995, 11, 11,996,996,996,997,998, 11, 11,
+    999,999,1000, 11,997, 11,1001, 11,1002, 11,1003,1004,1005,1005, 11,1006,
+    1007,1007,1008,1009,1010,1011,1011,1011,1011,1012, 11,1013,1014,1015,1016,1017,
+    1018, 11, 11, 11, 11,1019,1020,1020,1021,1021, 11, 11, 11, 11,1022, 11,
+    1023,1024,1025,1026,1026,1027,1027,1027,1027,1028,1029,1030,1031,1028,1032,1033,
+    1034,1035,1036,1037,1038,1039,1040,1041,1042,1041,1043,1044,1045,1046,1046,1047,
+    1048,1049,1050,1051,1052,1053,1054,1055,1056,1055,1057,1058,1059,1060,1060,1061,
     /* Block 66 */
-      8,  8,  8, 58, 59,  8,  8,  8,  8,1032,  7,  7,  0,  0,  0,  0,
-      7,  7,  7,  7, 13, 13, 13, 13, 13, 13,1033,1034,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7, 13, 13,  7,  7,  7,1035,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,1036,1037,1036,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    472,472,472, 73, 74,472,472,472,472,1062, 11, 11,  0,  0,  0,  0,
+     11, 11, 11, 11, 26, 26, 26, 26, 26, 26,1063,1064, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 26, 26, 11, 11, 11,1065, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,1066,1067,1066,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
     /* Block 67 */
-      7,  7,  7,  7,1038,  7,  7,  7,  7,1038,  7,  7,1038,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,1038,  7,1038,  7,  7,  7,  7,  7,1039,1040,  7,1039,
-    1040,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,1041,  7,  7,1038,  7,  7,1042,  7,1038,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-    1043,  7,1038,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,1044,1045,1046,
-    1047,1047,  7,  7,1042,1042,  7,  7,1042,1042,  7,  7,  7,  7,  7,  7,
+     11, 11, 11, 11,1068, 11, 11, 11, 11,1068, 11, 11,1068, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11,1068, 11,1068, 11, 11, 11, 11, 11,1069,1070, 11,1069,
+    1070, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11,1071, 11, 11,1068, 11, 11,1072, 11,1068, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    1073, 11,1068, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,1074,1075,1076,
+    1077,1077, 11, 11,1072,1072, 11, 11,1072,1072, 11, 11, 11, 11, 11, 11,
     /* Block 68 */
-    1048,1048,  7,  7,1042,1042,  7,  7,1042,1042,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,1033,1041,1041,1049,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-    1050,1050,1051,1051,  7,  7,  7,  7,  7,  7,1052,1052,1052,1052,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    1078,1078, 11, 11,1072,1072, 11, 11,1072,1072, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,1063,1071,1071,1079,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    1080,1080,1081,1081, 11, 11, 11, 11, 11, 11,1082,1082,1082,1082, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
     /* Block 69 */
-      7,  7,  7,  7,  7,  7,  7,  7,  6,  6,  6,  6,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,1053,1053,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7, 13,1054,1054,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+     11, 11, 11, 11, 11, 11, 11, 11, 13, 13, 13, 13, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11,1083,1083, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 26,1084,1084, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
     /* Block 70 */
-      7,  7,  7,  7,  7,  7,  7,  7, 13,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 13,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,1053,1053,1053,1053, 13, 13, 13,
-    1053, 13, 13,1053,  7,  7,  7,  7, 13, 13, 13,  7,  7,  7,  7,  7,
+     11, 11, 11, 11, 11, 11, 11, 11, 26, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 26,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11,1083,1083,1083,1083, 26, 26, 26,
+    1083, 26, 26,1083, 11, 11, 11, 11, 26, 26, 26, 11, 11, 11, 11, 11,
     /* Block 71 */
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  0,  0,  0,  0,  0,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    1055,1055,1055,1055,1055,1055,1055,1055,1055,1056,1057,1058,1059,1060,1061,1062,
-    1063,1064,1065,1065,1066,1067,1068,1069,1070,1071,1072,1073,1074,1075,1076,1077,
+    1085,1085,1085,1085,1085,1085,1085,1085,1085,1086,1087,1088,1089,1090,1091,1092,
+    1093,1094,1095,1095,1096,1097,1098,1099,1100,1101,1102,1103,1104,1105,1106,1107,
     /* Block 72 */
-    1078,1079,1080,1081,1082,1083,1084,1085,1077,1077,1077,1077,1077,1077,1077,1077,
-    1077,1086,1087,1088,1089,1090,1091,1092,1093,1094,1095,1095,1096,1097,1098,1099,
-    1100,1101,1102,1103,1104,1105,1106,1107,1108,1109,1110,1111,1112,1113,1114,1115,
-    1116,1117,1118,1119,1120,1121,1122,1122,1122,1122,1122,1122,1122,1122,1122,1122,
-    1122,1122,1123,1122,1122,1122,1122,1122,1122,1122,1122,1122,1122,1122,1122,1122,
-    1124,1124,1124,1124,1124,1124,1124,1124,1124,1124,1124,1124,1124,1124,1124,1124,
-    1124,1124,1124,1124,1124,1124,1124,1124,1124,1124,1125,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+    1108,1109,1110,1111,1112,1113,1114,1115,1107,1107,1107,1107,1107,1107,1107,1107,
+    1107,1116,1117,1118,1119,1120,1121,1122,1123,1124,1125,1125,1126,1127,1128,1129,
+    1130,1131,1132,1133,1134,1135,1136,1137,1138,1139,1140,1141,1142,1143,1144,1145,
+    1146,1147,1148,1149,1150,1151,1152,1152,1152,1152,1152,1152,1152,1152,1152,1152,
+    1152,1152,1153,1152,1152,1152,1152,1152,1152,1152,1152,1152,1152,1152,1152,1152,
+    1154,1154,1154,1154,1154,1154,1154,1154,1154,1154,1154,1154,1154,1154,1154,1154,
+    1154,1154,1154,1154,1154,1154,1154,1154,1154,1154,1155,439,439,439,439,439,
+    439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,
     /* Block 73 */
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
     /* Block 74 */
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 13, 13,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7, 13,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-     13,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 13, 13,1053,1053,  7,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 26, 26, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 26, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     26, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 26, 26,1083,1083, 11,
     /* Block 75 */
-     13, 13, 13, 13, 13, 13,  7, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13,  7,1053,1053, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13, 13, 13, 13, 13, 13,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,1053,
+     26, 26, 26, 26, 26, 26, 11, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 11,1083,1083, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 26, 26, 26, 26, 26,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,1083,
     /* Block 76 */
-     13, 13, 13, 13, 13, 13,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-     13, 13, 13,1053, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13,1053, 13, 13, 13, 13, 13, 13, 13, 13,1053,1053, 13, 13, 13, 13,
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,1053,1053, 13,
-     13, 13, 13, 13,1053,1053, 13, 13, 13, 13, 13, 13, 13, 13,1053, 13,
-     13, 13, 13, 13,1053, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13,1053, 13, 13, 13, 13, 13,
-     13, 13,1053,1053, 13,1053, 13, 13, 13, 13,1053, 13, 13,1053, 13, 13,
+     26, 26, 26, 26, 26, 26, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     26, 26, 26,1083, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26,1083, 26, 26, 26, 26, 26, 26, 26, 26,1083,1083, 26, 26, 26, 26,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,1083,1083, 26,
+     26, 26, 26, 26,1083,1083, 26, 26, 26, 26, 26, 26, 26, 26,1083, 26,
+     26, 26, 26, 26,1083, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26,1083, 26, 26, 26, 26, 26,
+     26, 26,1083,1083, 26,1083, 26, 26, 26, 26,1083, 26, 26,1083, 26, 26,
     /* Block 77 */
-     13, 13, 13, 13, 13,1053,  7,  7, 13, 13,1053,1053, 13, 13, 13, 13,
-     13, 13, 13,  7, 13,  7, 13,  7,  7,  7,  7,  7,  7, 13,  7,  7,
-      7, 13,  7,  7,  7,  7,  7,  7,1053,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7, 13, 13,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7, 13,  7,  7, 13,  7,  7,  7,  7,1053,  7,1053,  7,
-      7,  7,  7,1053,1053,1053,  7,1053,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7, 13, 13, 13, 13, 13,  6,  6,  6,  6,  6,  6,  6,  6,
-      6,  6,  6,  6,  6,  6,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+     26, 26, 26, 26, 26,1083, 11, 11, 26, 26,1083,1083, 26, 26, 26, 26,
+     26, 26, 26, 11, 26, 11, 26, 11, 11, 11, 11, 11, 11, 26, 11, 11,
+     11, 26, 11, 11, 11, 11, 11, 11,1083, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 26, 26, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 26, 11, 11, 26, 11, 11, 11, 11,1083, 11,1083, 11,
+     11, 11, 11,1083,1083,1083, 11,1083, 11, 11, 11,1156,1156,1156,1156,1156,
+    1156, 11, 11, 26, 26, 26, 26, 26, 13, 13, 13, 13, 13, 13, 13, 13,
+     13, 13, 13, 13, 13, 13,439,439,439,439,439,439,439,439,439,439,
     /* Block 78 */
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  7,1053,1053,1053,  7,  7,  7,  7,  7,  7,  7,  7,
-      7, 13,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-    1053,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,1053,
-      7,  7,  7,  7,  7,  6,  6,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,
+    439,439,439,439, 11,1083,1083,1083, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 26, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    1083, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,1083,
+     11, 11, 11, 11, 11, 13, 13, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
     /* Block 79 */
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7, 13, 13,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 26, 26, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
     /* Block 80 */
-      7,  7,  7,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
-      6,  6,  6,  6,  6,  6,  6,  6,  6,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  6,  6,  6,  6,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  6,  6,  7,  7,
+     11, 11, 11, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+     13, 13, 13, 13, 13, 13, 13, 13, 13, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 13, 13, 13, 13, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 13, 13, 11, 11,
     /* Block 81 */
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,1126,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,1127,1128,1129,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,1157, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11,1158,1159,1160, 11, 11, 11, 11, 11, 11, 11, 11, 11,
     /* Block 82 */
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,1130,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,1161, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
     /* Block 83 */
-      7,  7,  7,  7,  7, 13, 13, 13,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,1053,1053,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-    1053,  7,  7,  7,  7,1053,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  0,  0,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+     11, 11, 11, 11, 11, 26, 26, 26, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,1083,1083, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    1083, 11, 11, 11, 11,1083, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11,  0,  0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
     /* Block 84 */
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  0,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11,  0, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
     /* Block 85 */
-    395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,
-    395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,
-    395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,  0,
-    396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,
-    396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,
-    396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,  0,
-     58, 59,1131,1132,1133,1134,1135, 58, 59, 58, 59, 58, 59,1136,1137,1138,
-    1139, 94, 58, 59, 94, 58, 59, 94, 94, 94, 94, 94,1140,1141,1142,1142,
+    412,412,412,412,412,412,412,412,412,412,412,412,412,412,412,412,
+    412,412,412,412,412,412,412,412,412,412,412,412,412,412,412,412,
+    412,412,412,412,412,412,412,412,412,412,412,412,412,412,412,  0,
+    414,414,414,414,414,414,414,414,414,414,414,414,414,414,414,414,
+    414,414,414,414,414,414,414,414,414,414,414,414,414,414,414,414,
+    414,414,414,414,414,414,414,414,414,414,414,414,414,414,414,  0,
+     73, 74,1162,1163,1164,1165,1166, 73, 74, 73, 74, 73, 74,1167,1168,1169,
+    1170,109, 73, 74,109, 73, 74,109,109,109,109,109,1171,1172,1173,1173,
     /* Block 86 */
-     58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59,
-     58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59,
-     58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59,
-     58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59,
-     58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59,
-     58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59,
-     58, 59, 58, 59, 94,  7,  7,  7,  7,  7,  7, 58, 59, 58, 59,314,
-    314,314, 58, 59,  0,  0,  0,  0,  0,  6,  6,  6,  6,  8,  6,  6,
+     73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74,
+     73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74,
+     73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74,
+     73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74,
+     73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74,
+     73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74,
+     73, 74, 73, 74,109, 11, 11, 11, 11, 11, 11, 73, 74, 73, 74,331,
+    331,331, 73, 74,  0,  0,  0,  0,  0, 10, 10, 10, 10,439, 10, 10,
     /* Block 87 */
-    1143,1143,1143,1143,1143,1143,1143,1143,1143,1143,1143,1143,1143,1143,1143,1143,
-    1143,1143,1143,1143,1143,1143,1143,1143,1143,1143,1143,1143,1143,1143,1143,1143,
-    1143,1143,1143,1143,1143,1143,  0,1143,  0,  0,  0,  0,  0,1143,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,  0,  0,  0,  0,  0,  0,  0,1144,
-      6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,314,
+    1174,1174,1174,1174,1174,1174,1174,1174,1174,1174,1174,1174,1174,1174,1174,1174,
+    1174,1174,1174,1174,1174,1174,1174,1174,1174,1174,1174,1174,1174,1174,1174,1174,
+    1174,1174,1174,1174,1174,1174,  0,1174,  0,  0,  0,  0,  0,1174,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,  0,  0,  0,  0,  0,  0,  0,1175,
+     10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,331,
     /* Block 88 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,  0,176,176,176,176,176,176,176,  0,
-    176,176,176,176,176,176,176,  0,176,176,176,176,176,176,176,  0,
-    176,176,176,176,176,176,176,  0,176,176,176,176,176,176,176,  0,
-    176,176,176,176,176,176,176,  0,176,176,176,176,176,176,176,  0,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,  0,191,191,191,191,191,191,191,  0,
+    191,191,191,191,191,191,191,  0,191,191,191,191,191,191,191,  0,
+    191,191,191,191,191,191,191,  0,191,191,191,191,191,191,191,  0,
+    191,191,191,191,191,191,191,  0,191,191,191,191,191,191,191,  0,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
     /* Block 89 */
-      6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
-      6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
-      6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,176,
-      6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
-      6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
-      7,  7,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 10, 10,
+     10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 13, 13, 10, 10,
+     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 10, 10, 10, 10,  8,191,
+     10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,  8, 10, 10, 10,
+     10, 10, 13, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+     11, 11, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 90 */
-    1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,
-    1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,  0,1145,1145,1145,1145,1146,
-    1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,
-    1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,
-    1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,
-    1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,
-    1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,
-    1145,1145,1145,1147,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,
+    1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,  0,1176,1176,1176,1176,1177,
+    1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,
+    1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,
+    1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,
+    1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,
+    1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,
+    1176,1176,1176,1178,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 91 */
-    1148,1149,1150,1151,1152,1153,1154,1155,1156,1157,1158,1159,1160,1161,1162,1163,
-    1164,1165,1166,1167,1168,1169,1170,1171,1172,1173,1174,1175,1176,1177,1178,1179,
-    1180,1181,1182,1183,1184,1185,1186,1187,1188,1189,1190,1191,1192,1193,1194,1195,
-    1196,1197,1198,1199,1200,1201,1202,1203,1204,1205,1206,1207,1208,1209,1210,1211,
-    1212,1213,1214,1215,1216,1217,1218,1219,1220,1221,1222,1223,1224,1225,1226,1227,
-    1228,1229,1230,1231,1232,1233,1234,1235,1236,1237,1238,1239,1240,1241,1242,1243,
-    1244,1245,1246,1247,1248,1249,1250,1251,1252,1253,1254,1255,1256,1257,1258,1259,
-    1260,1261,1262,1263,1264,1265,1266,1267,1268,1269,1270,1271,1272,1273,1274,1275,
+    1179,1180,1181,1182,1183,1184,1185,1186,1187,1188,1189,1190,1191,1192,1193,1194,
+    1195,1196,1197,1198,1199,1200,1201,1202,1203,1204,1205,1206,1207,1208,1209,1210,
+    1211,1212,1213,1214,1215,1216,1217,1218,1219,1220,1221,1222,1223,1224,1225,1226,
+    1227,1228,1229,1230,1231,1232,1233,1234,1235,1236,1237,1238,1239,1240,1241,1242,
+    1243,1244,1245,1246,1247,1248,1249,1250,1251,1252,1253,1254,1255,1256,1257,1258,
+    1259,1260,1261,1262,1263,1264,1265,1266,1267,1268,1269,1270,1271,1272,1273,1274,
+    1275,1276,1277,1278,1279,1280,1281,1282,1283,1284,1285,1286,1287,1288,1289,1290,
+    1291,1292,1293,1294,1295,1296,1297,1298,1299,1300,1301,1302,1303,1304,1305,1306,
     /* Block 92 */
-    1276,1277,1278,1279,1280,1281,1282,1283,1284,1285,1286,1287,1288,1289,1290,1291,
-    1292,1293,1294,1295,1296,1297,1298,1299,1300,1301,1302,1303,1304,1305,1306,1307,
-    1308,1309,1310,1311,1312,1313,1314,1315,1316,1317,1318,1319,1320,1321,1322,1323,
-    1324,1325,1326,1327,1328,1329,1330,1331,1332,1333,1334,1335,1336,1337,1338,1339,
-    1340,1341,1342,1343,1344,1345,1346,1347,1348,1349,1350,1351,1352,1353,1354,1355,
-    1356,1357,1358,1359,1360,1361,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,  0,  0,  0,  0,
+    1307,1308,1309,1310,1311,1312,1313,1314,1315,1316,1317,1318,1319,1320,1321,1322,
+    1323,1324,1325,1326,1327,1328,1329,1330,1331,1332,1333,1334,1335,1336,1337,1338,
+    1339,1340,1341,1342,1343,1344,1345,1346,1347,1348,1349,1350,1351,1352,1353,1354,
+    1355,1356,1357,1358,1359,1360,1361,1362,1363,1364,1365,1366,1367,1368,1369,1370,
+    1371,1372,1373,1374,1375,1376,1377,1378,1379,1380,1381,1382,1383,1384,1385,1386,
+    1387,1388,1389,1390,1391,1392,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,  0,  0,  0,  0,
     /* Block 93 */
-    1362,1363,1363,1363,1145,1364,1364,1365,1363,1363,1363,1363,1363,1363,1363,1363,
-    1363,1363,1145,1145,1363,1363,1363,1363,1363,1363,1363,1363,1363,1363,1363,1363,
-    1145,1365,1365,1365,1365,1365,1365,1365,1365,1365,314,314,314,314,314,314,
-    1366,1364,1364,1364,1364,1364,1367,1145,1368,1369,1369,1364,1364,1366,1145,  7,
-      0,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1370,1364,1370,1364,
-    1370,1364,1370,1364,1370,1364,1370,1364,1370,1364,1370,1364,1370,1364,1370,1364,
-    1370,1364,1370,1364,1364,1370,1364,1370,1364,1370,1364,1364,1364,1364,1364,1364,
-    1370,1371,1364,1370,1371,1364,1370,1371,1364,1370,1371,1364,1370,1371,1364,1364,
+    1393,1394,1395,1396,1176,1397,1398,1399,1400,1400,1400,1400,1400,1400,1400,1400,
+    1400,1400,1176,1176,1400,1400,1400,1400,1400,1400,1400,1400,1396,1400,1400,1400,
+    1176,1399,1399,1399,1399,1399,1399,1399,1399,1399,331,331,331,331,331,331,
+    1401,1402,1402,1402,1402,1402,1403,1176,1404,1405,1405,1397,1397,1401,1176, 11,
+      0,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1406,1398,1406,1398,
+    1406,1398,1406,1398,1406,1398,1406,1398,1406,1398,1406,1398,1406,1398,1406,1398,
+    1406,1398,1406,1398,1398,1406,1398,1406,1398,1406,1398,1398,1398,1398,1398,1398,
+    1406,1407,1398,1406,1407,1398,1406,1407,1398,1406,1407,1398,1406,1407,1398,1398,
     /* Block 94 */
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
-    1364,1364,1364,1364,1372,1364,1364,  0,  0,314,314,1373,1374,1364,1370,1375,
-    1363,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1370,1364,1370,1364,
-    1370,1364,1370,1364,1370,1364,1370,1364,1370,1364,1370,1364,1370,1364,1370,1364,
-    1370,1364,1370,1364,1364,1370,1364,1370,1364,1370,1364,1364,1364,1364,1364,1364,
-    1370,1371,1364,1370,1371,1364,1370,1371,1364,1370,1371,1364,1370,1371,1364,1364,
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
-    1364,1364,1364,1364,1372,1364,1364,1376,1376,1376,1376,1363,1364,1364,1370,1377,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
+    1398,1398,1398,1398,1408,1398,1398,  0,  0,331,331,1409,1410,1398,1406,1411,
+    1412,1402,1402,1402,1402,1402,1402,1402,1402,1402,1402,1402,1413,1402,1413,1402,
+    1413,1402,1413,1402,1413,1402,1413,1402,1413,1402,1413,1402,1413,1402,1413,1402,
+    1413,1402,1413,1402,1402,1413,1402,1413,1402,1413,1402,1402,1402,1402,1402,1402,
+    1413,1414,1402,1413,1414,1402,1413,1414,1402,1413,1414,1402,1413,1414,1402,1402,
+    1402,1402,1402,1402,1402,1402,1402,1402,1402,1402,1402,1402,1402,1402,1402,1402,
+    1402,1402,1402,1402,1415,1402,1402,1416,1416,1416,1416,1396,1402,1402,1413,1417,
     /* Block 95 */
-      0,  0,  0,  0,  0,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
-      0,1378,1378,1379,1380,1379,1379,1381,1381,1381,1382,1382,1382,1382,1382,1382,
-    1383,1384,1384,1384,1385,1386,1386,1386,1386,1386,1386,1386,1386,1386,1386,1387,
-    1387,1387,1387,1387,1387,1387,1387,1387,1387,1387,1387,1387,1387,1387,1387,1387,
-    1387,1387,1387,1387,1388,1389,1389,1390,1390,1391,1392,1393,1394,1395,1396,1397,
-    1398,1399,1399,1400,1396,1396,1401,1402,1403,1403,1403,1403,1403,1404,1405,1406,
+      0,  0,  0,  0,  0,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,
+    1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,
+    1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,
+      0,1418,1418,1419,1420,1419,1419,1421,1421,1421,1422,1422,1422,1422,1422,1422,
+    1423,1424,1424,1424,1425,1426,1426,1426,1426,1426,1426,1426,1426,1426,1426,1427,
+    1427,1427,1427,1427,1427,1427,1427,1427,1427,1427,1427,1427,1427,1427,1427,1427,
+    1427,1427,1427,1427,1428,1429,1429,1430,1430,1431,1432,1433,1434,1435,1436,1437,
+    1438,1439,1439,1440,1436,1436,1441,1442,1443,1443,1443,1443,1443,1444,1445,1446,
     /* Block 96 */
-    1407,1408,1398,1398,1409,1409,1409,1410,1410,1411,1412,1412,1413,1414,1415,  0,
-    1145,1145,1416,1417,1418,1419,1420,1421,1422,1423,1424,1425,1426,1427,1428,1429,
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
-    1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,
-    1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,
-    1145,1145,1145,1145,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
+    1447,1448,1438,1438,1449,1449,1449,1450,1450,1451,1452,1452,1453,1454,1455,  0,
+    1176,1176,1456,1457,1458,1459,1460,1461,1462,1463,1464,1465,1466,1467,1468,1469,
+    1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,
+    1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,
+    1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,
+    1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,
+    1176,1176,1176,1176,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    1402,1402,1402,1402,1402,1402,1402,1402,1402,1402,1402,1402,1402,1402,1402,1402,
     /* Block 97 */
-    1430,1431,1432,1433,1434,1435,1436,1437,1438,1439,1440,1441,1442,1443,1444,1445,
-    1446,1447,1448,1449,1450,1451,1452,1453,1454,1455,1456,1457,1458,1459,1460,  0,
-    1461,1462,1463,1464,1465,1466,1467,1468,1469,1470,1471,1472,1473,1474,1475,1476,
-    1477,1478,1479,1480,1481,1482,1483,1484,1485,1486,1487,1488,1489,1490,1491,1492,
-    1493,1494,1495,1496,1497,1498,1499,1500,  8,  8,  8,  8,  8,  8,  8,  8,
-    1501,1502,1503,1504,1505,1506,1507,1508,1509,1510,1510,1511,1512,1513,1514,1515,
-    1516,1517,1517,1518,1518,1518,1519,1520,1520,1521,1521,1521,1521,1521,1522,1523,
-    1523,1524,1524,1524,1525,1526,1526,1527,1527,1527,1527,1527,1522,1528,1529,1145,
+    1470,1471,1472,1473,1474,1475,1476,1477,1478,1479,1480,1481,1482,1483,1484,1485,
+    1486,1487,1488,1489,1490,1491,1492,1493,1494,1495,1496,1497,1498,1499,1500,  0,
+    1501,1502,1503,1504,1505,1506,1507,1508,1509,1510,1511,1512,1513,1514,1515,1516,
+    1517,1518,1519,1520,1521,1522,1523,1524,1525,1526,1527,1528,1529,1530,1531,1532,
+    1533,1534,1535,1536,1537,1538,1539,1540,439,439,439,439,439,439,439,439,
+    1541,1542,1543,1544,1545,1546,1547,1548,1549,1550,1550,1551,1552,1553,1554,1555,
+    1556,1557,1557,1558,1558,1558,1559,1560,1560,1561,1561,1561,1561,1561,1562,1563,
+    1563,1564,1564,1564,1565,1566,1566,1567,1567,1567,1567,1567,1562,1568,1569,1176,
     /* Block 98 */
-    1530,1531,1532,1533,1534,1535,1536,1537,1538,1539,1540,1541,1542,1543,1544,1545,
-    1546,1547,1548,1549,1550,1551,1552,1553,1554,1555,1556,1557,1558,1559,1560,1561,
-    1562,1563,1564,1565,1566,1567,1568,1569,1570,1571,1572,1573,1574,1575,1576,1577,
-    1578,1579,1580,1581,1582,1582,1583,1584,1585,1586,1587,1588,1589,1590,1591,1591,
-    1592,1592,1592,1592,1592,1592,1592,1592,1592,1593,1594,1595,1596,1597,1598,1599,
-    1600,1601,1602,1603,1604,1604,1605,1606,1607,1608,1609,1610,1611,1612,1613,1614,
-    1615,1616,1617,1618,1619,1619,1619,1619,1619,1619,1620,1621,1622,1623,1624,1624,
-    1624,1624,1624,1625,1626,1627,1627,1627,1627,1627,1627,1628,1628,1628,1628,1629,
+    1570,1571,1572,1573,1574,1575,1576,1577,1578,1579,1580,1581,1582,1583,1584,1585,
+    1586,1587,1588,1589,1590,1591,1592,1593,1594,1595,1596,1597,1598,1599,1600,1601,
+    1602,1603,1604,1605,1606,1607,1608,1609,1610,1611,1612,1613,1614,1615,1616,1617,
+    1618,1619,1620,1621,1622,1622,1623,1624,1625,1626,1627,1628,1629,1630,1631,1631,
+    1632,1632,1632,1632,1632,1632,1632,1632,1632,1633,1634,1635,1636,1637,1638,1639,
+    1640,1641,1642,1643,1644,1644,1645,1646,1647,1648,1649,1650,1651,1652,1653,1654,
+    1655,1656,1657,1658,1659,1659,1659,1659,1659,1659,1660,1661,1662,1663,1664,1664,
+    1664,1664,1664,1665,1666,1667,1667,1667,1667,1667,1667,1668,1668,1668,1668,1669,
     /* Block 99 */
-    1630,1631,1632,1633,1632,1633,1632,1631,1632,1631,1632,1632,1633,1634,1634,1635,
-    1634,1635,1636,1636,1637,1638,1639,1640,1638,1639,1641,1642,1641,1640,1641,1640,
-    1641,1640,1637,1638,1643,1630,1644,1631,1630,1645,1645,1646,1645,1644,1646,1645,
-    1647,1630,1644,1630,1630,1632,1630,1644,1630,1633,1632,1633,1635,1632,1634,1643,
-    1635,1648,1637,1636,1648,1637,1638,1639,1639,1640,1641,1640,1641,1642,1640,1641,
-    1640,1637,1638,1638,1639,1639,1640,1638,1649,1649,1649,1649,1649,1649,1649,1649,
-    1649,1649,1650,1651,1652,1653,1654,1655,1656,1657,1658,1659,1659,1660,1661,1662,
-    1663,1664,1665,1651,1666,1667,1667,1668,1669,1670,1650,1671,1672,1673,1674,1675,
+    1670,1671,1672,1673,1672,1673,1672,1671,1672,1671,1672,1672,1673,1674,1674,1675,
+    1674,1675,1676,1676,1677,1678,1679,1680,1678,1679,1681,1682,1681,1680,1681,1680,
+    1681,1680,1677,1678,1683,1670,1684,1671,1670,1685,1685,1686,1685,1684,1686,1685,
+    1687,1670,1684,1670,1670,1672,1670,1684,1670,1673,1672,1673,1675,1672,1674,1683,
+    1675,1688,1677,1676,1688,1677,1678,1679,1679,1680,1681,1680,1681,1682,1680,1681,
+    1680,1677,1678,1678,1679,1679,1680,1678,1689,1689,1689,1689,1689,1689,1689,1689,
+    1689,1689,1690,1691,1692,1693,1694,1695,1696,1697,1698,1699,1699,1700,1701,1702,
+    1703,1704,1705,1691,1706,1707,1707,1708,1709,1710,1690,1711,1712,1713,1714,1715,
     /* Block 100 */
-    1676,1668,1677,1678,1679,1659,1658,1680,1681,1682,1683,1684,1685,1686,1687,1688,
-    1689,1690,1691,1692,1680,1693,1694,1652,1695,1652,1696,1697,1698,1659,1652,1651,
-    1662,1653,1656,1655,1699,1657,1660,1659,1660,1700,1701,1702,1703,1660,1661,1662,
-    1680,1704,1705,1706,1707,1708,1709,1710,1711,1712,1710,1711,1713,1714,1715,1716,
-    1717,1718,1719,1720,1719,1721,1722,1723,1724,1725,1721,1722,1726,1725,1722,1724,
-    1724,1703,1727,1728,1728,1729,1730,1731,1729,1732,1733,1729,1732,1734,1735,1736,
-    1737,1737,1737,1737,1737,1737,1737,1737,1737,1738,1739,1740,1741,1742,1743,1744,
-    1745,1746,1747,1747,1748,1749,1750,1751,1752,1753,1754,1755,1756,1756,1757,1758,
+    1716,1708,1717,1718,1719,1699,1698,1720,1721,1722,1723,1724,1725,1726,1727,1728,
+    1729,1730,1731,1732,1720,1733,1734,1692,1735,1692,1736,1737,1738,1699,1692,1691,
+    1702,1693,1696,1695,1739,1697,1700,1699,1700,1740,1741,1742,1743,1700,1701,1702,
+    1720,1744,1745,1746,1747,1748,1749,1750,1751,1752,1750,1751,1753,1754,1755,1756,
+    1757,1758,1759,1760,1759,1761,1762,1763,1764,1765,1761,1762,1766,1765,1762,1764,
+    1764,1743,1767,1768,1768,1769,1770,1771,1769,1772,1773,1769,1772,1774,1775,1776,
+    1777,1777,1777,1777,1777,1777,1777,1777,1777,1778,1779,1780,1781,1782,1783,1784,
+    1785,1786,1787,1787,1788,1789,1790,1791,1792,1793,1794,1795,1796,1796,1797,1798,
     /* Block 101 */
-    1364,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
+    1398,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
     /* Block 102 */
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
     /* Block 103 */
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1364,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1398,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
     /* Block 104 */
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1364,1759,1759,1759,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1398,1800,1800,1800,
     /* Block 105 */
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
+    1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,
+    1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,
+    1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,
+    1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,
+    1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,
+    1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,
+    1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,
+    1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,
     /* Block 106 */
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,  0,  0,  0,
-    1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,
-    1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,
-    1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,
-    1145,1145,1145,1145,1145,1145,1145,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,  6,  6,
+    1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,1397,  0,  0,  0,
+    1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,
+    1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,
+    1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,1176,
+    1176,1176,1176,1176,1176,1176,1176,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191, 10,  8,
     /* Block 107 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,  6,  6,  6,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,176,176,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59,
-     58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59,
-     58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59,176,314,
-    314,314,314,  6,314,314,314,314,314,314,314,314,314,314,  6,176,
+    191,191,191,191,191,191,191,191,191,191,191,191,191, 10,  8,  8,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,191,191,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74,
+     73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74,
+     73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74,191,331,
+    331,331,331, 10,331,331,331,331,331,331,331,331,331,331, 10,191,
     /* Block 108 */
-     58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59,
-     58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59,1760,1761,314,314,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-    314,314,  6,  6,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,
+     73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74,
+     73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74,1801,1802,331,331,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,472,472,472,472,472,472,472,472,472,472,
+    331,331, 10,  8, 10, 10, 10,  8,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 109 */
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,176,176,176,176,176,176,176,176,176,
-      7,  7, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59,
-     94, 94, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59,
-     58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59,
-     58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59,
-     58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59,
-    1762, 94, 94, 94, 94, 94, 94, 94, 94, 58, 59, 58, 59,1763, 58, 59,
+     11, 11, 11, 11, 11, 11, 11, 11,319,319,319,319,319,319,319,319,
+    319,319,319,319,319,319,319,191,191,191,191,191,191,191,191,191,
+    319,319, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74,
+    109,109, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74,
+     73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74,
+     73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74,
+     73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74,
+    1803,109,109,109,109,109,109,109,109, 73, 74, 73, 74,1804, 73, 74,
     /* Block 110 */
-     58, 59, 58, 59, 58, 59, 58, 59,176,  7,  7, 58, 59,1764, 94,176,
-     58, 59, 58, 59,1765, 94, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59,
-     58, 59, 58, 59, 58, 59, 58, 59, 58, 59,1766,1767,1768,1769,1766, 94,
-    1770,1771,1772,1773, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59, 58, 59,
-      0,  0, 58, 59,1774,1775,1776, 58, 59, 58, 59,  0,  0,  0,  0,  0,
+     73, 74, 73, 74, 73, 74, 73, 74,191,319,319, 73, 74,1805,109,191,
+     73, 74, 73, 74,1806,109, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74,
+     73, 74, 73, 74, 73, 74, 73, 74, 73, 74,1807,1808,1809,1810,1807,109,
+    1811,1812,1813,1814, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74,
+      0,  0, 73, 74,1815,1816,1817, 73, 74, 73, 74,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0, 58, 59,176,1777,1778, 94,176,176,176,176,176,
+      0,  0,  0,  0,  0, 73, 74,191,1818,1819,109,191,191,191,191,191,
     /* Block 111 */
-    176,176,314,176,176,176,314,176,176,176,176,314,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,408,408,314,314,408,  7,  7,  7,  7,314,  0,  0,  0,
-      8,  8,  8,  8,  8,  8,  7,  7,  7,  7,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,331,191,191,191,331,191,191,191,191,331,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,431,431,331,331,431, 11, 11, 11, 11,331,  0,  0,  0,
+    439,439,439,439,439,439, 11, 11, 11, 11,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191, 10, 10,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 112 */
-    408,408,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,408,408,408,408,408,408,408,408,408,408,408,408,
-    408,408,408,408,314,314,  0,  0,  0,  0,  0,  0,  0,  0,  6,  6,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,176,176,176,176,176,176,  6,  6,  6,176,  6,176,176,314,
+    431,431,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,431,431,431,431,431,431,431,431,431,431,431,431,
+    431,431,431,431,331,331,  0,  0,  0,  0,  0,  0,  0,  0,  8,  8,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  0,  0,  0,  0,  0,  0,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,191,191,191,191,191,191, 10, 10, 10,191, 10,191,191,331,
     /* Block 113 */
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,314,314,314,314,314,314,314,314,  6,  6,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,314,314,314,314,314,314,314,314,314,
-    314,314,408,408,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,
-    440,440,440,440,440,440,440,440,440,440,440,440,440,440,440,440,
-    440,440,440,440,440,440,440,440,440,440,440,440,440,  0,  0,  0,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,331,331,331,331,331,331,331,331, 10,  8,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,331,331,331,331,331,331,331,331,331,
+    331,331,431,431,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,
+    466,466,466,466,466,466,466,466,466,466,466,466,466,466,466,466,
+    466,466,466,466,466,466,466,466,466,466,466,466,466,  0,  0,  0,
     /* Block 114 */
-    314,314,314,408,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,314,408,408,314,314,314,314,408,408,314,314,408,408,
-    408,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  0,176,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  6,  6,
-    176,176,176,176,176,314,176,176,176,176,176,176,176,176,176,176,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,176,176,176,176,176,  0,
+    331,331,331,431,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,331,431,431,331,331,331,331,431,431,331,331,431,431,
+    431, 10, 10, 10, 10, 10, 10, 10,  8,  8, 10, 10, 10, 10,  0,191,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  0,  0,  0,  0, 10, 10,
+    447,447,447,447,447,331,447,447,447,447,447,447,447,447,447,447,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,447,447,447,447,447,  0,
     /* Block 115 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,314,314,314,314,314,314,408,
-    408,314,314,408,408,314,314,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    176,176,176,314,176,176,176,176,176,176,176,176,314,408,  0,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  6,  6,  6,  6,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,  7,  7,  7,176,436,314,436,176,176,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,331,331,331,331,331,331,431,
+    431,331,331,431,431,331,331,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,331,191,191,191,191,191,191,191,191,331,431,  0,  0,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  0,  0, 10,  8,  8,  8,
+    447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,
+    447,447,447,447,447,447,447, 11, 11, 11,447,462,331,462,447,447,
     /* Block 116 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    314,176,314,314,314,176,176,314,314,176,176,176,176,176,314,314,
-    176,314,176,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,176,176,176,  6,  6,
-    176,176,176,176,176,176,176,176,176,176,176,408,314,314,408,408,
-      6,  6,176,176,176,408,314,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,
+    447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,
+    447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,
+    331,447,331,331,331,447,447,331,331,447,447,447,447,447,331,331,
+    447,331,447,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,447,447,447, 10, 10,
+    191,191,191,191,191,191,191,191,191,191,191,431,331,331,431,431,
+      8,  8,191,191,191,431,331,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 117 */
-      0,176,176,176,176,176,176,  0,  0,176,176,176,176,176,176,  0,
-      0,176,176,176,176,176,176,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,  0,176,176,176,176,176,176,176,  0,
-     94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94,
-     94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94,
-     94, 94, 94,1779, 94, 94, 94, 94, 94, 94, 94,  7,1780,1781,1782,1783,
-     94, 94, 94, 94, 94, 94, 94, 94, 94,1784,  7,  7,  0,  0,  0,  0,
-    1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,
+      0,191,191,191,191,191,191,  0,  0,191,191,191,191,191,191,  0,
+      0,191,191,191,191,191,191,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,  0,191,191,191,191,191,191,191,  0,
+    109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,
+    109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,
+    109,109,109,1820,109,109,109,109,109,109,109,319,1821,1822,1823,1824,
+    109,109,109,109,109,109,109,109,109,1825, 11, 11,  0,  0,  0,  0,
+    1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,
     /* Block 118 */
-    1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,
-    1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,
-    1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,
-    1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,1785,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,408,408,314,408,408,314,408,408,  6,408,314,  0,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,
+    1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,
+    1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,
+    1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,
+    1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,1826,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,431,431,331,431,431,331,431,431,  8,431,331,  0,  0,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  0,  0,  0,  0,  0,  0,
     /* Block 119 */
-    1786,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1788,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1788,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1788,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1788,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
+    1827,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1829,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1829,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1829,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1829,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
     /* Block 120 */
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1788,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1788,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1788,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1788,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1788,1787,1787,1787,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1829,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1829,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1829,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1829,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1829,1828,1828,1828,
     /* Block 121 */
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1788,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1788,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1788,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1788,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1829,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1829,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1829,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1829,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
     /* Block 122 */
-    1787,1787,1787,1787,1787,1787,1787,1787,1788,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1788,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1788,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1788,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1788,1787,1787,1787,1787,1787,1787,1787,
+    1828,1828,1828,1828,1828,1828,1828,1828,1829,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1829,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1829,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1829,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1829,1828,1828,1828,1828,1828,1828,1828,
     /* Block 123 */
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1788,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1788,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1788,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1788,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1829,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1829,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1829,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1829,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
     /* Block 124 */
-    1787,1787,1787,1787,1788,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1788,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1788,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1788,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1788,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
+    1828,1828,1828,1828,1829,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1829,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1829,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1829,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1829,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
     /* Block 125 */
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1788,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1788,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1788,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1788,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1829,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1829,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1829,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1829,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
     /* Block 126 */
-    1788,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1788,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1788,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1788,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1788,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
+    1829,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1829,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1829,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1829,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1829,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
     /* Block 127 */
-    1787,1787,1787,1787,1787,1787,1787,1787,1788,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,1787,
-    1787,1787,1787,1789,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,
-    441,441,441,441,441,441,441,  0,  0,  0,  0,442,442,442,442,442,
-    442,442,442,442,442,442,442,442,442,442,442,442,442,442,442,442,
-    442,442,442,442,442,442,442,442,442,442,442,442,442,442,442,442,
-    442,442,442,442,442,442,442,442,442,442,442,442,  0,  0,  0,  0,
+    1828,1828,1828,1828,1828,1828,1828,1828,1829,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+    1828,1828,1828,1830,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    467,467,467,467,467,467,467,467,467,467,467,467,467,467,467,467,
+    467,467,467,467,467,467,467,  0,  0,  0,  0,468,468,468,468,468,
+    468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,
+    468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,
+    468,468,468,468,468,468,468,468,468,468,468,468,  0,  0,  0,  0,
     /* Block 128 */
-    1790,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    1831,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
@@ -5628,345 +5685,345 @@ static const uint16_t tmu_ucd_stage_two[36352] = {
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,1790,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,1831,
     /* Block 130 */
-    1790,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    1831,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,1790,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,1831,
     /* Block 131 */
-    1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,
-    1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,
-    1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,
-    1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,
-    1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,
-    1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,
-    1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,
-    1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,
+    1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,
+    1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,
+    1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,
+    1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,
+    1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,
+    1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,
+    1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,
+    1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,
     /* Block 132 */
-    1791,1792,1793,1794,1795,1796,1797,1798,1799,1800,1801,1802,1803,1804,1805,1806,
-    1807,1808,1809,1810,1811,1812,1813,1814,1815,1816,1817,1818,1819,1820,1821,1822,
-    1823,1824,1825,1826,1827,1828,1829,1830,1831,1832,1833,1834,1835,1836,1837,1838,
-    1839,1840,1841,1842,1843,1844,1845,1846,1847,1848,1849,1850,1851,1852,1853,1854,
-    1855,1856,1857,1858,1859,1860,1861,1862,1863,1864,1865,1866,1867,1868,1869,1870,
-    1871,1872,1873,1874,1875,1876,1877,1878,1879,1880,1881,1882,1883,1884,1885,1886,
-    1887,1888,1889,1890,1891,1892,1893,1894,1895,1896,1897,1898,1899,1900,1901,1902,
-    1903,1904,1905,1906,1907,1908,1909,1910,1911,1912,1913,1914,1915,1916,1816,1917,
+    1832,1833,1834,1835,1836,1837,1838,1839,1840,1841,1842,1843,1844,1845,1846,1847,
+    1848,1849,1850,1851,1852,1853,1854,1855,1856,1857,1858,1859,1860,1861,1862,1863,
+    1864,1865,1866,1867,1868,1869,1870,1871,1872,1873,1874,1875,1876,1877,1878,1879,
+    1880,1881,1882,1883,1884,1885,1886,1887,1888,1889,1890,1891,1892,1893,1894,1895,
+    1896,1897,1898,1899,1900,1901,1902,1903,1904,1905,1906,1907,1908,1909,1910,1911,
+    1912,1913,1914,1915,1916,1917,1918,1919,1920,1921,1922,1923,1924,1925,1926,1927,
+    1928,1929,1930,1931,1932,1933,1934,1935,1936,1937,1938,1939,1940,1941,1942,1943,
+    1944,1945,1946,1947,1948,1949,1950,1951,1952,1953,1954,1955,1956,1957,1857,1958,
     /* Block 133 */
-    1918,1919,1920,1921,1922,1923,1924,1925,1926,1927,1928,1929,1930,1931,1932,1933,
-    1934,1935,1936,1937,1938,1939,1940,1941,1942,1943,1944,1945,1946,1947,1948,1949,
-    1950,1951,1952,1953,1954,1955,1956,1957,1958,1959,1960,1961,1962,1963,1964,1965,
-    1966,1967,1968,1969,1970,1971,1972,1973,1974,1975,1976,1977,1978,1979,1980,1981,
-    1982,1983,1984,1985,1986,1987,1988,1989,1990,1991,1992,1993,1994,1995,1996,1997,
-    1998,1999,2000,2001,2002,2003,2004,2005,2006,2007,2008,2009,2010,2011,2012,2013,
-    2014,2015,2016,2017,2018,2019,2020,2021,2022,2023,2024,2025,2026,2027,2028,2029,
-    2030,2031,2032,2033,2034,2035,2036,2037,2038,2039,2040,2041,2042,2043,2044,2045,
+    1959,1960,1961,1962,1963,1964,1965,1966,1967,1968,1969,1970,1971,1972,1973,1974,
+    1975,1976,1977,1978,1979,1980,1981,1982,1983,1984,1985,1986,1987,1988,1989,1990,
+    1991,1992,1993,1994,1995,1996,1997,1998,1999,2000,2001,2002,2003,2004,2005,2006,
+    2007,2008,2009,2010,2011,2012,2013,2014,2015,2016,2017,2018,2019,2020,2021,2022,
+    2023,2024,2025,2026,2027,2028,2029,2030,2031,2032,2033,2034,2035,2036,2037,2038,
+    2039,2040,2041,2042,2043,2044,2045,2046,2047,2048,2049,2050,2051,2052,2053,2054,
+    2055,2056,2057,2058,2059,2060,2061,2062,2063,2064,2065,2066,2067,2068,2069,2070,
+    2071,2072,2073,2074,2075,2076,2077,2078,2079,2080,2081,2082,2083,2084,2085,2086,
     /* Block 134 */
-    2046,2047,2048,2049,2050,2051,2052,2053,2054,2055,2056,2057,2058,2059,1364,1364,
-    2060,1364,2061,1364,1364,2062,2063,2064,2065,2066,2067,2068,2069,2070,2071,1364,
-    2072,1364,2073,1364,1364,2074,2075,1364,1364,1364,2076,2077,2078,2079,2080,2081,
-    2082,2083,2084,2085,2086,2087,2088,2089,2090,2091,2092,2093,1978,2094,2095,2096,
-    2097,2098,2099,2100,2101,2102,2103,2104,2105,2028,2106,2107,2108,2109,2110,2111,
-    2112,2113,2114,2114,2115,2116,2117,2118,2119,2120,2121,2122,2123,2124,2125,2126,
-    2127,2128,2129,2073,2130,2131,2132,2133,2134,2135,2136,2137,2138,2139,1759,1759,
-    2140,2141,2142,2143,2144,2145,2146,2147,2148,2149,1948,2088,2150,2151,2152,2153,
+    2087,2088,2089,2090,2091,2092,2093,2094,2095,2096,2097,2098,2099,2100,1398,1398,
+    2101,1398,2102,1398,1398,2103,2104,2105,2106,2107,2108,2109,2110,2111,2112,1398,
+    2113,1398,2114,1398,1398,2115,2116,1398,1398,1398,2117,2118,2119,2120,2121,2122,
+    2123,2124,2125,2126,2127,2128,2129,2130,2131,2132,2133,2134,2019,2135,2136,2137,
+    2138,2139,2140,2141,2142,2143,2144,2145,2146,2069,2147,2148,2149,2150,2151,2152,
+    2153,2154,2155,2155,2156,2157,2158,2159,2160,2161,2162,2163,2164,2165,2166,2167,
+    2168,2169,2170,2114,2171,2172,2173,2174,2175,2176,2177,2178,2179,2180,1800,1800,
+    2181,2182,2183,2184,2185,2186,2187,2188,2189,2190,1989,2129,2191,2192,2193,2194,
     /* Block 135 */
-    2154,2155,2156,2157,2158,2159,1953,2160,2161,2162,2163,2164,2165,2166,2167,2168,
-    2169,2170,2171,2172,2173,2174,2175,2176,2177,2178,2179,2180,2181,2182,2183,2184,
-    2185,2186,2187,2188,2189,2190,2191,2192,2193,2194,2195,2196,2197,2198,2199,2200,
-    2201,2202,2203,2204,2205,2206,2207,2208,2209,2210,2211,2212,2213,2214,2215,2216,
-    2217,2218,2219,2220,2221,2222,2223,2224,2225,2226,2227,2228,2229,2230,2231,2232,
-    2233,2234,2235,2236,2237,2238,2239,2240,2241,2242,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
+    2195,2196,2197,2198,2199,2200,1994,2201,2202,2203,2204,2205,2206,2207,2208,2209,
+    2210,2211,2212,2213,2214,2215,2216,2217,2218,2219,2220,2221,2222,2223,2224,2225,
+    2226,2227,2228,2229,2230,2231,2232,2233,2234,2235,2236,2237,2238,2239,2240,2241,
+    2242,2243,2244,2245,2246,2247,2248,2249,2250,2251,2252,2253,2254,2255,2256,2257,
+    2258,2259,2260,2261,2262,2263,2264,2265,2266,2267,2268,2269,2270,2271,2272,2273,
+    2274,2275,2276,2277,2278,2279,2280,2281,2282,2283,1800,1800,1800,1800,1800,1800,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
     /* Block 136 */
-    2243,2244,2245,2246,2247,2248,2249,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,2250,2251,2252,2253,2254,  0,  0,  0,  0,  0,2255,314,2256,
-    2257,2258,2259,2259,2260,2260,2260,2261,2257,2262,2263,2264,2265,2266,2267,2268,
-    2269,2269,2269,2269,2269,2269,2269,  0,2269,2269,2269,2269,2269,  0,2269,  0,
-    2269,2269,  0,2269,2269,  0,2269,2269,2269,2269,2269,2270,2271,2272,2273,2274,
-    2275,2276,2277,2278,2279,2280,2278,2279,2280,2281,2280,2281,2282,2283,2284,2285,
-    2286,2287,2288,2284,2285,2286,2289,2290,2291,2292,2293,2294,2295,2296,2295,2296,
-    2297,2298,2290,2291,2292,2299,2300,2301,2302,2303,2301,2302,2303,2304,2304,2305,
+    2284,2285,2286,2287,2288,2289,2290,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,2291,2292,2293,2294,2295,  0,  0,  0,  0,  0,2296,331,2297,
+    2298,2299,2300,2300,2301,2301,2301,2302,2298,2303,2304,2305,2306,2307,2308,2309,
+    2310,2310,2310,2310,2310,2310,2310,  0,2310,2310,2310,2310,2310,  0,2310,  0,
+    2310,2310,  0,2310,2310,  0,2310,2310,2310,2310,2310,2311,2312,2313,2314,2315,
+    2316,2317,2318,2319,2320,2321,2319,2320,2321,2322,2321,2322,2323,2324,2325,2326,
+    2327,2328,2329,2325,2326,2327,2330,2331,2332,2333,2334,2335,2336,2337,2336,2337,
+    2338,2339,2331,2332,2333,2340,2341,2342,2343,2344,2342,2343,2344,2345,2345,2346,
     /* Block 137 */
-    2306,2307,2302,2303,2305,2306,2305,2306,2308,2309,2310,2300,2311,2312,2285,2286,
-    2287,2313,2288,2284,2285,2286,2288,2284,2285,2286,2314,2315,2316,2317,2284,2285,
-    2285,2286,2287,2313,2284,2285,2285,2286,2287,2313,2317,2289,2290,2291,2282,2283,
-    2283,2318,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,2319,2320,2321,2322,2323,2324,2325,2326,2325,2326,2327,2325,2326,
-    2328,2329,2330,2331,2326,2332,2333,2334,2335,2336,2337,2338,2339,2340,2341,2342,
-    2343,2344,2345,2346,2347,2348,2349,2350,2351,2352,2353,2354,2355,2356,2357,2358,
+    2347,2348,2343,2344,2346,2347,2346,2347,2349,2350,2351,2341,2352,2353,2326,2327,
+    2328,2354,2329,2325,2326,2327,2329,2325,2326,2327,2355,2356,2357,2358,2325,2326,
+    2326,2327,2328,2354,2325,2326,2326,2327,2328,2354,2358,2330,2331,2332,2323,2324,
+    2324,2359, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,2360,2361,2362,2363,2364,2365,2366,2367,2366,2367,2368,2366,2367,
+    2369,2370,2371,2372,2367,2373,2374,2375,2376,2377,2378,2379,2380,2381,2382,2383,
+    2384,2385,2386,2387,2388,2389,2390,2391,2392,2393,2394,2395,2396,2397,2398,2399,
     /* Block 138 */
-    2359,2360,2361,2362,2363,2362,2363,2364,2365,2366,2367,2366,2367,2368,2369,2370,
-    2371,2371,2372,2373,2374,2374,2375,2375,2376,2376,2377,2378,2374,2375,2376,2377,
-    2376,2377,2377,2378,2379,2380,2380,2381,2381,2381,2382,2382,2383,2377,2378,2379,
-    2380,2381,2382,2382,2383,2384,2385,2385,2386,2387,2388,2389,2390,2391,2392,2392,
-    2393,2394,2395,2396,2397,2397,2398,2399,2400,2401,2402,2402,2403,2404,2405,2406,
-    2407,2407,2408,2409,2410,2408,2409,2410,2411,2412,2413,2414,2414,2415,2416,2417,
-    2418,2419,2420,2421,2422,2423,2424,2425,2426,2427,2426,2427,2428,2429,2430,2431,
-    2430,2431,2432,2433,2434,2435,2435,2436,2437,2438,2439,2440,2441,2442,2442,2443,
+    2400,2401,2402,2403,2404,2403,2404,2405,2406,2407,2408,2407,2408,2409,2410,2411,
+    2412,2412,2413,2414,2415,2415,2416,2416,2417,2417,2418,2419,2415,2416,2417,2418,
+    2417,2418,2418,2419,2420,2421,2421,2422,2422,2422,2423,2423,2424,2418,2419,2420,
+    2421,2422,2423,2423,2424,2425,2426,2426,2427,2428,2429,2430,2431,2432,2433,2433,
+    2434,2435,2436,2437,2438,2438,2439,2440,2441,2442,2443,2443,2444,2445,2446,2447,
+    2448,2448,2449,2450,2451,2449,2450,2451,2452,2453,2454,2455,2455,2456,2457,2458,
+    2459,2460,2461,2462,2463,2464,2465,2466,2467,2468,2467,2468,2469,2470,2471,2472,
+    2471,2472,2473,2474,2475,2476,2476,2477,2478,2479,2480,2481,2482,2483,2483,2484,
     /* Block 139 */
-    2443,2422,2423,2424,2425,2425,2426,2427,2427,2428,2428,2429,2430,2431,2432,2433,
-    2431,2431,2432,2433,2434,2435,2436,2444,2445,2446,2447,2448,2447,2448,2449,2450,
-    2451,2450,2451,2452,2453,2454,2454,2454,2455,2455,2456,2456,2457,2453,2454,2455,
-    2456,2455,2456,2457,2457,2458,2459,2460,2460,2460,2460,2461,2461,2462,2456,2457,
-    2458,2459,2459,2460,2460,2461,2462,2463,2464,2464,2465,2466,2467,2468,2468,2469,
-    2470,2471,2471,2472,2473,2474,2475,2475,2476,2477,2475,2476,2477,2478,2479,2480,
-    2481,2480,2481,2480,2481,2481,2482,2483,2484,2484,2485,2486,2487,2487,2486,2487,
-    2488,2489,2490,2491,2483,2492,2493,2492,2493,2493,2494,2495,2496,2496,2497,2498,
+    2484,2463,2464,2465,2466,2466,2467,2468,2468,2469,2469,2470,2471,2472,2473,2474,
+    2472,2472,2473,2474,2475,2476,2477,2485,2486,2487,2488,2489,2488,2489,2490,2491,
+    2492,2491,2492,2493,2494,2495,2495,2495,2496,2496,2497,2497,2498,2494,2495,2496,
+    2497,2496,2497,2498,2498,2499,2500,2501,2501,2501,2501,2502,2502,2503,2497,2498,
+    2499,2500,2500,2501,2501,2502,2503,2504,2505,2505,2506,2507,2508,2509,2509,2510,
+    2511,2512,2512,2513,2514,2515,2516,2516,2517,2518,2516,2517,2518,2519,2520,2521,
+    2522,2521,2522,2521,2522,2522,2523,2524,2525,2525,2526,2527,2528,2528,2527,2528,
+    2529,2530,2531,2532,2524,2533,2534,2533,2534,2534,2535,2536,2537,2537,2538,2539,
     /* Block 140 */
-    2499,2500,2501,2500,2501,2502,2503,2503,2498,2500,2501,2504,2505,2506,2507,2508,
-    2508,2508,2507,2508,2507,2507,2509,2510,2511,2511,2512,2513,2514,2515,2516,2515,
-    2516,2517,2518,2518,2513,2515,2516,2519,2520,2521,2522,2523,2523,2524,2525,2526,
-    2527,2528,2528,2527,2529,2530,2531,2531,2532,2533,2531,2531,2534,2535,  6,  6,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    2536,2537,2538,2539,2540,2541,2542,2543,2542,2543,2543,2544,2539,2540,2541,2542,
-    2543,2544,2545,2546,2545,2546,2547,2548,2549,2550,2551,2552,2553,2554,2553,2554,
-    2555,2555,2556,2557,2558,2557,2558,2559,2560,2560,2561,2562,2556,2557,2557,2558,
+    2540,2541,2542,2541,2542,2543,2544,2544,2539,2541,2542,2545,2546,2547,2548,2549,
+    2549,2549,2548,2549,2548,2548,2550,2551,2552,2552,2553,2554,2555,2556,2557,2556,
+    2557,2558,2559,2559,2554,2556,2557,2560,2561,2562,2563,2564,2564,2565,2566,2567,
+    2568,2569,2569,2568,2570,2571,2572,2572,2573,2574,2572,2572,2575,2576, 13, 13,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    2577,2578,2579,2580,2581,2582,2583,2584,2583,2584,2584,2585,2580,2581,2582,2583,
+    2584,2585,2586,2587,2586,2587,2588,2589,2590,2591,2592,2593,2594,2595,2594,2595,
+    2596,2596,2597,2598,2599,2598,2599,2600,2601,2601,2602,2603,2597,2598,2598,2599,
     /* Block 141 */
-    2557,2558,2559,2560,2561,2562,2563,2564,2565,2565,2566,2567,2568,2569,2570,2571,
-      0,  0,2572,2573,2572,2574,2575,2576,2577,2578,2579,2580,2577,2578,2581,2582,
-    2581,2583,2584,2585,2586,2585,2586,2587,2582,2588,2581,2582,2589,2590,2591,2592,
-    2593,2594,2595,2596,2597,2598,2599,2588,2597,2588,2581,2584,2584,2583,2600,2600,
-    2587,2601,2602,2601,2603,2604,2605,2606,  0,  0,  0,  0,  0,  0,  0,  0,
+    2598,2599,2600,2601,2602,2603,2604,2605,2606,2606,2607,2608,2609,2610,2611,2612,
+      0,  0,2613,2614,2613,2615,2616,2617,2618,2619,2620,2621,2618,2619,2622,2623,
+    2622,2624,2625,2626,2627,2626,2627,2628,2623,2629,2622,2623,2630,2631,2632,2633,
+    2634,2635,2636,2637,2638,2639,2640,2629,2638,2629,2622,2625,2625,2624,2641,2641,
+    2628,2642,2643,2642,2644,2645,2646,2647,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    2607,2608,2609,2610,2608,2611,2612,2613,2614,2615,2612,2616,2617,  7,  0,  0,
+    2648,2649,2650,2651,2649,2652,2653,2654,2655,2656,2653,2657,2658, 11,  0,  0,
     /* Block 142 */
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    2618,2619,2619,2620,2620,2621,2622,2623,2623,2624,  0,  0,  0,  0,  0,  0,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    2625,2626,2627,2628,2629,2630,2630,2631,2632,2633,2633,2634,2634,2635,2635,2636,
-    2636,2637,2637,2637,2637,1363,1363,2638,2639,2625,2640,2641,2642,2643,2644,2645,
-    2646,2647,2646,  0,2648,2649,2650,2651,2652,2653,2653,2654,2655,2656,2656,2657,
-    2658,2659,2660,2651,2661,2662,2663,  0,2664,2665,2666,2667,  0,  0,  0,  0,
-    2668,2669,2670,176,2671,  0,2672,2673,2674,2675,2676,2677,2678,2679,2680,2681,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    2659,2660,2661,2662,2663,2664,2665,2666,2666,2667,  0,  0,  0,  0,  0,  0,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    2668,2669,2670,2671,2672,2673,2673,2674,2675,2676,2676,2677,2677,2678,2678,2679,
+    2679,2680,2680,2680,2680,1396,1396,2681,2682,2668,2683,2684,2685,2686,2687,2688,
+    2689,2690,2691,  0,2692,2693,2694,2695,2696,2697,2697,2698,2699,2700,2700,2701,
+    2702,2703,2704,2705,2706,2707,2708,  0,2709,2710,2711,2712,  0,  0,  0,  0,
+    2713,2714,2715,191,2716,  0,2717,2718,2719,2720,2721,2722,2723,2724,2725,2726,
     /* Block 143 */
-    2682,2682,2683,2683,2684,2684,2685,2685,2686,2686,2687,2688,2689,2689,2690,2690,
-    2691,2692,2693,2693,2694,2694,2695,2696,2697,2697,2698,2699,2700,2700,2701,2702,
-    2703,2703,2704,2705,2706,2706,2707,2708,2709,2709,2710,2710,2711,2711,2712,2712,
-    2713,2713,2714,2715,2716,2716,2717,2718,2719,2719,2720,2721,2722,2722,2723,2724,
-    2725,2725,2726,2727,2728,2728,2729,2730,2731,2731,2732,2733,2734,2734,2735,2736,
-    2737,2731,2732,2733,2734,2734,2735,2736,2737,2737,2738,2739,2740,2740,2741,2742,
-    2743,2743,2744,2745,2746,2746,2747,2748,2749,2749,2750,2751,2752,2752,2753,2753,
-    2754,2754,2755,2756,2757,2758,2759,2760,2761,2762,2763,2764,2765,  0,  0,  1,
+    2727,2727,2728,2728,2729,2729,2730,2730,2731,2731,2732,2733,2734,2734,2735,2735,
+    2736,2737,2738,2738,2739,2739,2740,2741,2742,2742,2743,2744,2745,2745,2746,2747,
+    2748,2748,2749,2750,2751,2751,2752,2753,2754,2754,2755,2755,2756,2756,2757,2757,
+    2758,2758,2759,2760,2761,2761,2762,2763,2764,2764,2765,2766,2767,2767,2768,2769,
+    2770,2770,2771,2772,2773,2773,2774,2775,2776,2776,2777,2778,2779,2779,2780,2781,
+    2782,2776,2777,2778,2779,2779,2780,2781,2782,2782,2783,2784,2785,2785,2786,2787,
+    2788,2788,2789,2790,2791,2791,2792,2793,2794,2794,2795,2796,2797,2797,2798,2798,
+    2799,2799,2800,2801,2802,2803,2804,2805,2806,2807,2808,2809,2810,  0,  0, 28,
     /* Block 144 */
-      0,2766,2766,2766,2767,2766,2766,2766,2766,2766,2766,2767,2766,2766,2766,2766,
-    2768,2768,2768,2768,2768,2768,2768,2768,2768,2768,2766,2766,2767,2767,2767,2766,
-    2766,2769,2769,2769,2769,2769,2769,2769,2769,2769,2769,2769,2769,2769,2769,2769,
-    2769,2769,2769,2769,2769,2769,2769,2769,2769,2769,2769,2766,2766,2766,2767,2766,
-    2767,2770,2770,2770,2770,2770,2770,2770,2770,2770,2770,2770,2770,2770,2770,2770,
-    2770,2770,2770,2770,2770,2770,2770,2770,2770,2770,2770,2766,2767,2766,2767,2771,
-    2771,2772,2773,2773,2774,2775,2776,2777,2778,2779,2780,2781,2782,2783,2784,2785,
-    2776,2786,2787,2788,2789,2790,2790,2791,2792,2793,2794,2777,2778,2779,2780,2781,
+      0,2811,2812,2812,2813,2812,2812,2814,2815,2815,2812,2813,2816,2817,2818,2812,
+    2819,2819,2819,2819,2819,2819,2819,2819,2819,2819,2820,2821,2813,2813,2813,2811,
+    2812,2822,2822,2822,2822,2822,2822,2822,2822,2822,2822,2822,2822,2822,2822,2822,
+    2822,2822,2822,2822,2822,2822,2822,2822,2822,2822,2822,2815,2812,2815,2813,2823,
+    2813,2824,2824,2824,2824,2824,2824,2824,2824,2824,2824,2824,2824,2824,2824,2824,
+    2824,2824,2824,2824,2824,2824,2824,2824,2824,2824,2824,2815,2813,2815,2813,2825,
+    2825,2826,2827,2827,2828,2829,2830,2831,2832,2833,2834,2835,2836,2837,2838,2839,
+    2830,2840,2841,2842,2843,2844,2844,2845,2846,2847,2848,2831,2832,2833,2834,2835,
     /* Block 145 */
-    2795,2796,2797,2798,2799,2800,2800,2800,2800,2800,2800,2801,2802,2803,2804,2805,
-    2805,2805,2805,2805,2806,2807,2808,2808,2808,2808,2808,2808,2809,2810,2811,2811,
-    2812,2813,2813,2813,2813,2813,2813,2813,2813,2813,2813,2813,2813,2813,2813,2813,
-    2813,2813,2813,2813,2813,2813,2813,2813,2813,2813,2813,2813,2813,2813,2813,  0,
-      0,  0,2814,2814,2814,2814,2814,2814,  0,  0,2815,2815,2815,2815,2815,2815,
-      0,  0,2816,2816,2816,2816,2816,2816,  0,  0,2817,2817,2817,  0,  0,  0,
-    2818,2818,2819,2820,2818,2821,2822,  0,2823,2824,2824,2824,2824,2825,2826,  0,
-      1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  7,  7,  0,  0,
+    2849,2850,2851,2852,2853,2854,2854,2854,2854,2854,2854,2855,2856,2857,2858,2859,
+    2859,2859,2859,2859,2860,2861,2862,2862,2862,2862,2862,2862,2863,2864,2865,2865,
+    2866,2867,2867,2867,2867,2867,2867,2867,2867,2867,2867,2867,2867,2867,2867,2867,
+    2867,2867,2867,2867,2867,2867,2867,2867,2867,2867,2867,2867,2867,2867,2867,  0,
+      0,  0,2868,2868,2868,2868,2868,2868,  0,  0,2869,2869,2869,2869,2869,2869,
+      0,  0,2870,2870,2870,2870,2870,2870,  0,  0,2871,2871,2871,  0,  0,  0,
+    2872,2872,2873,2874,2872,2875,2876,  0,2877,2878,2878,2878,2878,2879,2880,  0,
+      1,  1,  1,  1,  1,  1,  1,  1,  1, 28, 28, 28, 11, 11,  0,  0,
     /* Block 146 */
-    176,176,176,176,176,176,176,176,176,176,176,176,  0,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,  0,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,  0,176,176,  0,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,  0,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,  0,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,  0,191,191,  0,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 147 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,  0,  0,  0,  0,  0,
     /* Block 148 */
-      6,  6,  6,  0,  0,  0,  0,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  0,  0,  0,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  7,  7,  7,  7,  7,  7,  7,
+     10, 10, 10,  0,  0,  0,  0,439,439,439,439,439,439,439,439,439,
+    439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,
+    439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,
+    439,439,439,439,  0,  0,  0, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,
+    472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,
+    472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,
+    472,472,472,472,472,439,439,439,439, 11, 11, 11, 11, 11, 11, 11,
     /* Block 149 */
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  8,  8,  7,  7,  7,  0,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  0,  0,  0,
-      7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11,439,439, 11, 11, 11,  0,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,  0,  0,  0,
+     11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,314,  0,  0,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,331,  0,  0,
     /* Block 150 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    314,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    331,439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,
+    439,439,439,439,439,439,439,439,439,439,439,439,  0,  0,  0,  0,
     /* Block 151 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-      8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,  8,176,176,176,176,176,176,176,176,  8,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,314,314,314,314,314,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    439,439,439,439,  0,  0,  0,  0,  0,  0,  0,  0,  0,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,472,191,191,191,191,191,191,191,191,472,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,331,331,331,331,331,  0,  0,  0,  0,  0,
     /* Block 152 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,  0,  6,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,  0,  0,  0,  0,176,176,176,176,176,176,176,176,
-      6,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,  0, 10,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,  0,  0,  0,  0,191,191,191,191,191,191,191,191,
+     10,472,472,472,472,472,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 153 */
-    2827,2827,2827,2827,2827,2827,2827,2827,2827,2827,2827,2827,2827,2827,2827,2827,
-    2827,2827,2827,2827,2827,2827,2827,2827,2827,2827,2827,2827,2827,2827,2827,2827,
-    2827,2827,2827,2827,2827,2827,2827,2827,2828,2828,2828,2828,2828,2828,2828,2828,
-    2828,2828,2828,2828,2828,2828,2828,2828,2828,2828,2828,2828,2828,2828,2828,2828,
-    2828,2828,2828,2828,2828,2828,2828,2828,2828,2828,2828,2828,2828,2828,2828,2828,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
+    2881,2881,2881,2881,2881,2881,2881,2881,2881,2881,2881,2881,2881,2881,2881,2881,
+    2881,2881,2881,2881,2881,2881,2881,2881,2881,2881,2881,2881,2881,2881,2881,2881,
+    2881,2881,2881,2881,2881,2881,2881,2881,2882,2882,2882,2882,2882,2882,2882,2882,
+    2882,2882,2882,2882,2882,2882,2882,2882,2882,2882,2882,2882,2882,2882,2882,2882,
+    2882,2882,2882,2882,2882,2882,2882,2882,2882,2882,2882,2882,2882,2882,2882,2882,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
     /* Block 154 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,  0,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,
-    2827,2827,2827,2827,2827,2827,2827,2827,2827,2827,2827,2827,2827,2827,2827,2827,
-    2827,2827,2827,2827,2827,2827,2827,2827,2827,2827,2827,2827,2827,2827,2827,2827,
-    2827,2827,2827,2827,  0,  0,  0,  0,2828,2828,2828,2828,2828,2828,2828,2828,
-    2828,2828,2828,2828,2828,2828,2828,2828,2828,2828,2828,2828,2828,2828,2828,2828,
-    2828,2828,2828,2828,2828,2828,2828,2828,2828,2828,2828,2828,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,  0,  0,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  0,  0,  0,  0,  0,  0,
+    2881,2881,2881,2881,2881,2881,2881,2881,2881,2881,2881,2881,2881,2881,2881,2881,
+    2881,2881,2881,2881,2881,2881,2881,2881,2881,2881,2881,2881,2881,2881,2881,2881,
+    2881,2881,2881,2881,  0,  0,  0,  0,2882,2882,2882,2882,2882,2882,2882,2882,
+    2882,2882,2882,2882,2882,2882,2882,2882,2882,2882,2882,2882,2882,2882,2882,2882,
+    2882,2882,2882,2882,2882,2882,2882,2882,2882,2882,2882,2882,  0,  0,  0,  0,
     /* Block 155 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,  0,  0,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 156 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 157 */
-    176,176,176,176,176,176,  0,  0,176,  0,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,  0,176,176,  0,  0,  0,176,  0,  0,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,  0,  6,  8,  8,  8,  8,  8,  8,  8,  8,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,  7,  7,  8,  8,  8,  8,  8,  8,  8,
+    191,191,191,191,191,191,  0,  0,191,  0,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,  0,191,191,  0,  0,  0,191,  0,  0,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,  0, 10,439,439,439,439,439,439,439,439,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191, 11, 11,439,439,439,439,439,439,439,
     /* Block 158 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,  0,
-      0,  0,  0,  0,  0,  0,  0,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,  0,
+      0,  0,  0,  0,  0,  0,  0,439,439,439,439,439,439,439,439,439,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,  0,176,176,  0,  0,  0,  0,  0,  8,  8,  8,  8,  8,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,  0,191,191,  0,  0,  0,  0,  0,439,439,439,439,439,
     /* Block 159 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,  8,  8,  8,  8,  8,  8,  0,  0,  0,  6,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,  0,  0,  0,  0,  0,  6,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,439,439,439,439,439,439,  0,  0,  0, 10,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,  0,  0,  0,  0,  0, 10,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 160 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,  0,  0,  0,  0,  8,  8,176,176,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      0,  0,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,  0,  0,  0,  0,439,439,191,191,
+    439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,
+      0,  0,439,439,439,439,439,439,439,439,439,439,439,439,439,439,
+    439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,
+    439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,
     /* Block 161 */
-    176,314,314,314,  0,314,314,  0,  0,  0,  0,  0,314,314,314,314,
-    176,176,176,176,  0,176,176,176,  0,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,  0,  0,314,314,314,  0,  0,  0,  0,314,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,
-      6,  6,  6,  6,  6,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,  8,  8,  6,
+    191,331,331,331,  0,331,331,  0,  0,  0,  0,  0,331,331,331,331,
+    191,191,191,191,  0,191,191,191,  0,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,  0,  0,331,331,331,  0,  0,  0,  0,331,
+    439,439,439,439,439,439,439,439,439,  0,  0,  0,  0,  0,  0,  0,
+     10, 10, 10, 10, 10, 10,  8,  8, 10,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,439,439, 10,
     /* Block 162 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,  8,  8,  8,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,439,439,439,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,  7,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,314,314,  0,  0,  0,  0,  8,  8,  8,  8,  8,
-      6,  6,  6,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191, 11,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,331,331,  0,  0,  0,  0,439,439,439,439,439,
+     10, 10, 10, 10, 10, 10, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 163 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,  0,  0,  0,  6,  6,  6,  6,  6,  6,  6,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,  0,  0,  8,  8,  8,  8,  8,  8,  8,  8,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,  0,  0,  0,  0,  0,  8,  8,  8,  8,  8,  8,  8,  8,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,  0,  0,  0, 10, 10, 10, 10, 10, 10, 10,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,  0,  0,439,439,439,439,439,439,439,439,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,  0,  0,  0,  0,  0,439,439,439,439,439,439,439,439,
     /* Block 164 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,  0,  0,  0,  0,  0,  0,  0,  6,  6,  6,  6,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  8,  8,  8,  8,  8,  8,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,  0,  0,  0,  0,  0,  0,  0, 10, 10, 10, 10,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,439,439,439,439,439,439,439,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 165 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 166 */
-    2829,2829,2829,2829,2829,2829,2829,2829,2829,2829,2829,2829,2829,2829,2829,2829,
-    2829,2829,2829,2829,2829,2829,2829,2829,2829,2829,2829,2829,2829,2829,2829,2829,
-    2829,2829,2829,2829,2829,2829,2829,2829,2829,2829,2829,2829,2829,2829,2829,2829,
-    2829,2829,2829,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    2830,2830,2830,2830,2830,2830,2830,2830,2830,2830,2830,2830,2830,2830,2830,2830,
-    2830,2830,2830,2830,2830,2830,2830,2830,2830,2830,2830,2830,2830,2830,2830,2830,
-    2830,2830,2830,2830,2830,2830,2830,2830,2830,2830,2830,2830,2830,2830,2830,2830,
-    2830,2830,2830,  0,  0,  0,  0,  0,  0,  0,  8,  8,  8,  8,  8,  8,
+    2883,2883,2883,2883,2883,2883,2883,2883,2883,2883,2883,2883,2883,2883,2883,2883,
+    2883,2883,2883,2883,2883,2883,2883,2883,2883,2883,2883,2883,2883,2883,2883,2883,
+    2883,2883,2883,2883,2883,2883,2883,2883,2883,2883,2883,2883,2883,2883,2883,2883,
+    2883,2883,2883,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    2884,2884,2884,2884,2884,2884,2884,2884,2884,2884,2884,2884,2884,2884,2884,2884,
+    2884,2884,2884,2884,2884,2884,2884,2884,2884,2884,2884,2884,2884,2884,2884,2884,
+    2884,2884,2884,2884,2884,2884,2884,2884,2884,2884,2884,2884,2884,2884,2884,2884,
+    2884,2884,2884,  0,  0,  0,  0,  0,  0,  0,439,439,439,439,439,439,
     /* Block 167 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,314,314,314,314,  0,  0,  0,  0,  0,  0,  0,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,331,331,331,331,  0,  0,  0,  0,  0,  0,  0,  0,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
@@ -5978,157 +6035,157 @@ static const uint16_t tmu_ucd_stage_two[36352] = {
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,
+    439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,
+    439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,  0,
     /* Block 169 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,  0,314,314,  6,  0,  0,
-    176,176,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,  0,331,331, 10,  0,  0,
+    191,191,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 170 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,  8,  8,  8,
-      8,  8,  8,  8,  8,  8,  8,176,  0,  0,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,314,314,314,314,314,314,314,314,314,314,
-    314,  8,  8,  8,  8,  6,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,439,439,439,
+    439,439,439,439,439,439,439,191,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,331,331,331,331,331,331,331,331,331,331,
+    331,439,439,439,439,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 171 */
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,439,439,439,439,439,439,439,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 172 */
-    408,314,408,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,  6,  6,  6,  6,  6,  6,  6,  0,  0,
-      0,  0,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,314,
+    431,331,431,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,  8,  8, 10, 10, 10, 10, 10,  0,  0,
+      0,  0,439,439,439,439,439,439,439,439,439,439,439,439,439,439,
+    439,439,439,439,439,439, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,331,
     /* Block 173 */
-    314,314,408,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,407,176,407,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,2831,176,176,176,176,
-    408,408,408,314,314,314,314,408,408,314,314,  6,  6,398,  6,  6,
-      6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,398,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,  0,  0,  0,  0,  0,  0,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,
+    331,331,431,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,430,191,430,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,2885,191,191,191,191,
+    431,431,431,331,331,331,331,431,431,331,331, 10, 10,419,  8,  8,
+      8,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,419,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,  0,  0,  0,  0,  0,  0,  0,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  0,  0,  0,  0,  0,  0,
     /* Block 174 */
-    314,314,314,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,314,314,314,314,314,408,314,2832,2832,
-    314,314,314,314,314,  0,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      6,  6,  6,  6,176,408,408,176,  0,  0,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,314,  6,  6,176,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    331,331,331,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,331,331,331,331,331,431,331,2886,2886,
+    331,331,331,331,331,  0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+     10,  8,  8,  8,191,431,431,191,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,331, 10, 10,191,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 175 */
-    314,314,408,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,408,408,408,314,314,314,314,314,314,314,314,314,408,
-    408,176,421,421,176,  6,  6,  6,  6,314,314,314,314,  6,408,314,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,176,  6,176,  6,  6,  6,
-      0,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    331,331,431,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,431,431,431,331,331,331,331,331,331,331,331,331,431,
+    431,191,445,445,191,  8,  8, 10, 10,331,331,331,331,  8,431,331,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,191, 10,191, 10,  8,  8,
+      0,439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,
+    439,439,439,439,439,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 176 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,  0,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,408,408,408,314,
-    314,314,408,408,314,408,314,314,  6,  6,  6,  6,  6,  6,314,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,  0,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,431,431,431,331,
+    331,331,431,431,331,431,331,331,  8,  8, 10,  8,  8, 10,331,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 177 */
-    176,176,176,176,176,176,176,  0,176,  0,176,176,176,176,  0,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,  0,176,
-    176,176,176,176,176,176,176,176,176,  6,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,314,
-    408,408,408,314,314,314,314,314,314,314,314,  0,  0,  0,  0,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,  0,191,  0,191,191,191,191,  0,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,  0,191,
+    191,191,191,191,191,191,191,191,191,  8,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,331,
+    431,431,431,331,331,331,331,331,331,331,331,  0,  0,  0,  0,  0,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  0,  0,  0,  0,  0,  0,
     /* Block 178 */
-    314,314,408,408,  0,176,176,176,176,176,176,176,176,  0,  0,176,
-    176,  0,  0,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,  0,176,176,176,176,176,176,
-    176,  0,176,176,  0,176,176,176,176,176,  0,314,314,176,314,408,
-    314,408,408,408,408,  0,  0,408,408,  0,  0,414,415,408,  0,  0,
-    176,  0,  0,  0,  0,  0,  0,314,  0,  0,  0,  0,  0,176,176,176,
-    176,176,408,408,  0,  0,314,314,314,314,314,314,314,  0,  0,  0,
-    314,314,314,314,314,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    331,331,431,431,  0,191,191,191,191,191,191,191,191,  0,  0,191,
+    191,  0,  0,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,  0,191,191,191,191,191,191,
+    191,  0,191,191,  0,191,191,191,191,191,  0,331,331,191,331,431,
+    331,431,431,431,431,  0,  0,431,431,  0,  0,437,438,431,  0,  0,
+    191,  0,  0,  0,  0,  0,  0,331,  0,  0,  0,  0,  0,191,191,191,
+    191,191,431,431,  0,  0,331,331,331,331,331,331,331,  0,  0,  0,
+    331,331,331,331,331,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 179 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,408,408,408,314,314,314,314,314,314,314,314,
-    408,408,314,314,314,408,314,176,176,176,176,  6,  6,  6,  6,  6,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  6,  6,  0,  6,314,176,
-    176,176,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,431,431,431,331,331,331,331,331,331,331,331,
+    431,431,331,331,331,431,331,191,191,191,191,  8,  8, 10, 10, 10,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 10, 10,  0, 10,331,191,
+    191,191,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 180 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    314,408,408,314,314,314,314,314,314,408,314,420,422,314,415,314,
-    314,408,314,314,176,176,  6,176,  0,  0,  0,  0,  0,  0,  0,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    331,431,431,331,331,331,331,331,331,431,331,444,446,331,438,331,
+    331,431,331,331,191,191, 10,191,  0,  0,  0,  0,  0,  0,  0,  0,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 181 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,314,
-    408,408,314,314,314,314,  0,  0,408,408,420,420,314,314,408,314,
-    314,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
-      6,  6,  6,  6,  6,  6,  6,  6,176,176,176,176,314,314,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,331,
+    431,431,331,331,331,331,  0,  0,431,431,444,444,331,331,431,331,
+    331, 10,  8,  8, 10, 10, 10, 10, 10,  8,  8,  8,  8,  8,  8,  8,
+      8,  8,  8,  8,  8,  8,  8,  8,191,191,191,191,331,331,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 182 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    408,408,408,314,314,314,314,314,314,314,314,408,408,314,408,314,
-    314,  6,  6,  6,176,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,
-      6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    431,431,431,331,331,331,331,331,331,331,331,431,431,331,431,331,
+    331,  8,  8, 10,191,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  0,  0,  0,  0,  0,  0,
+     10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 183 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,314,408,314,408,408,
-    314,314,314,314,314,314,408,314,176,  0,  0,  0,  0,  0,  0,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,331,431,331,431,431,
+    331,331,331,331,331,331,431,331,191,  0,  0,  0,  0,  0,  0,  0,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 184 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,  0,  0,314,314,314,
-    408,408,314,314,314,314,408,314,314,314,314,314,  0,  0,  0,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  6,  6,  6,  7,
+    447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,447,
+    447,447,447,447,447,447,447,447,447,447,447,  0,  0,331,331,331,
+    431,431,331,331,331,331,431,331,331,331,331,331,  0,  0,  0,  0,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,439,439,  8,  8,  8, 11,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 185 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,408,408,408,314,
-    314,314,314,314,314,314,314,314,408,314,314,  6,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,431,431,431,331,
+    331,331,331,331,331,331,331,331,431,331,331, 10,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
@@ -6136,79 +6193,79 @@ static const uint16_t tmu_ucd_stage_two[36352] = {
     /* Block 186 */
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
-      9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
-     10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
-     10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,176,
+     20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+     20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+     22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+     22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,439,439,439,439,439,439,
+    439,439,439,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,191,
     /* Block 187 */
-    176,176,176,176,176,176,176,  0,  0,176,  0,  0,176,176,176,176,
-    176,176,176,176,  0,176,176,  0,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    314,408,408,408,408,408,  0,408,422,  0,  0,314,314,408,314,421,
-    408,421,408,314,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,  0,  0,191,  0,  0,191,191,191,191,
+    191,191,191,191,  0,191,191,  0,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    331,431,431,431,431,431,  0,431,446,  0,  0,331,331,431,331,445,
+    431,445,431,331,  8, 10,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 188 */
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,  0,  0,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,408,408,408,314,314,314,314,  0,  0,314,314,408,408,408,408,
-    314,176,  6,176,408,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,  0,  0,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,431,431,431,331,331,331,331,  0,  0,331,331,431,431,431,431,
+    331,191, 10,191,431,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 189 */
-    176,314,314,314,314,314,314,314,314,314,314,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,314,314,314,314,314,314,408,421,314,314,314,314,  6,
-      6,  6,  6,  6,  6,  6,  6,314,  0,  0,  0,  0,  0,  0,  0,  0,
-    176,314,314,314,314,314,314,408,408,314,314,314,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
+    191,331,331,331,331,331,331,331,331,331,331,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,331,331,331,331,331,331,431,445,331,331,331,331, 10,
+     10, 10,  8,  8, 10, 10, 10,331,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,331,331,331,331,331,331,431,431,331,331,331,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
     /* Block 190 */
-    176,176,176,176,421,421,421,421,421,421,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,408,314,314,  6,  6,  6,176,  6,  6,
-      6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,445,445,445,445,445,445,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,431,331,331, 10,  8,  8,191, 10, 10,
+     10, 10, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,  0,  0,  0,  0,  0,  0,  0,
     /* Block 191 */
-    176,176,176,176,176,176,176,176,176,  0,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,408,
-    314,314,314,314,314,314,314,  0,314,314,314,314,314,314,408,314,
-    176,  6,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,
-      6,  6,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
+    191,191,191,191,191,191,191,191,191,  0,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,431,
+    331,331,331,331,331,331,331,  0,331,331,331,331,331,331,431,331,
+    191,  8,  8, 10, 10, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,439,439,439,439,439,439,
+    439,439,439,439,439,439,439,439,439,439,439,439,439,  0,  0,  0,
+     10, 10,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
     /* Block 192 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-      0,  0,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,  0,408,314,314,314,314,314,314,
-    314,408,314,314,408,314,314,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+      0,  0,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,  0,431,331,331,331,331,331,331,
+    331,431,331,331,431,331,331,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 193 */
-    176,176,176,176,176,176,176,  0,176,176,  0,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,314,314,314,314,314,314,  0,  0,  0,314,  0,314,314,  0,314,
-    314,314,314,314,314,314,421,314,  0,  0,  0,  0,  0,  0,  0,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,  0,176,176,  0,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
+    191,191,191,191,191,191,191,  0,191,191,  0,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,331,331,331,331,331,331,  0,  0,  0,331,  0,331,331,  0,331,
+    331,331,331,331,331,331,445,331,  0,  0,  0,  0,  0,  0,  0,  0,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,  0,191,191,  0,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
     /* Block 194 */
-    176,176,176,176,176,176,176,176,176,176,408,408,408,408,408,  0,
-    314,314,  0,408,408,314,408,314,176,  0,  0,  0,  0,  0,  0,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,431,431,431,431,431,  0,
+    331,331,  0,431,431,331,431,331,191,  0,  0,  0,  0,  0,  0,  0,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
@@ -6221,20 +6278,20 @@ static const uint16_t tmu_ucd_stage_two[36352] = {
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,314,314,408,408,  6,  6,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,331,331,431,431,  8,  8,  0,  0,  0,  0,  0,  0,  0,
     /* Block 196 */
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    176,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  8,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,
+    191,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,
+    439,439,439,439,439, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,
     /* Block 197 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
@@ -6242,49 +6299,49 @@ static const uint16_t tmu_ucd_stage_two[36352] = {
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 198 */
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,
-      6,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,
+    472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,
+    472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,
+    472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,
+    472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,
+    472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,
+    472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,  0,
+     10, 10, 10, 10, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 199 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 200 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,  0,
-      1,  1,  1,  1,  1,  1,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,  0,
+     28, 28, 28, 28, 28, 28, 28, 28, 28,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 201 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 202 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,  0,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  6,  6,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,  0,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  0,  0,  0,  0,  8,  8,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 203 */
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
@@ -6292,20 +6349,20 @@ static const uint16_t tmu_ucd_stage_two[36352] = {
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,  0,  0,
-    314,314,314,314,314,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,  0,  0,
+    331,331,331,331,331,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 204 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    314,314,314,314,314,314,314,  6,  6,  6,  6,  6,  7,  7,  7,  7,
-    176,176,176,176,  6,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  8,  8,  8,  8,  8,
-      8,  8,  0,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,  0,  0,  0,  0,  0,176,176,176,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    331,331,331,331,331,331,331,  8,  8, 10, 10, 10, 11, 11, 11, 11,
+    191,191,191,191,  8, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  0,439,439,439,439,439,
+    439,439,  0,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,  0,  0,  0,  0,  0,191,191,191,
     /* Block 205 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
@@ -6318,13 +6375,13 @@ static const uint16_t tmu_ucd_stage_two[36352] = {
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
-      9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
-     10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
-     10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+     20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+     20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+     22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+     22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
     /* Block 207 */
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  8,  8,  8,  6,  6,  6,  6,  0,  0,  0,  0,  0,
+    439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,
+    439,439,439,439,439,439,439, 10,  8, 10, 10,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
@@ -6332,655 +6389,681 @@ static const uint16_t tmu_ucd_stage_two[36352] = {
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 208 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,  0,  0,  0,  0,314,
-    176,408,408,408,408,408,408,408,408,408,408,408,408,408,408,408,
-    408,408,408,408,408,408,408,408,408,408,408,408,408,408,408,408,
-    408,408,408,408,408,408,408,408,408,408,408,408,408,408,408,408,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,  0,  0,  0,  0,331,
+    191,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,
+    431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,
+    431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,
     /* Block 209 */
-    408,408,408,408,408,408,408,408,  0,  0,  0,  0,  0,  0,  0,314,
-    314,314,314,176,176,176,176,176,176,176,176,176,176,176,176,176,
+    431,431,431,431,431,431,431,431,  0,  0,  0,  0,  0,  0,  0,331,
+    331,331,331,191,191,191,191,191,191,191,191,191,191,191,191,191,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    1364,1364,1363,1364,314,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    2833,2833,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    1397,1397,1396,1397,331,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    2887,2887,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 210 */
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1364,  0,  0,  0,  0,  0,  0,  0,  0,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1398,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 211 */
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
-    1364,1364,1364,1364,1364,1364,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
     /* Block 212 */
-    1364,1759,1759,1759,1759,1759,1759,1759,1364,  0,  0,  0,  0,  0,  0,  0,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
+    1398,1398,1398,1398,1398,1398,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    /* Block 213 */
+    1398,1799,1799,1799,1799,1799,1799,1799,1398,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    /* Block 213 */
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    1364,1364,1364,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,1364,1364,1364,1364,  0,  0,  0,  0,  0,  0,  0,  0,
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
     /* Block 214 */
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
-    1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,  0,  0,  0,  0,
+    1402,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
     /* Block 215 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,  0,  0,  0,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    1398,1398,1398,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,1402,1402,1402,1402,  0,  0,  0,  0,  0,  0,  0,  0,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
     /* Block 216 */
-    176,176,176,176,176,176,176,176,176,  0,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,  0,  0,  7,314,314,  6,
-      1,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,
+    1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,1398,  0,  0,  0,  0,
+    /* Block 217 */
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,  0,  0,  0,
+    /* Block 218 */
+    191,191,191,191,191,191,191,191,191,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,  0,  0, 11,331,331,  8,
+     28, 28, 28, 28,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    /* Block 217 */
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    /* Block 218 */
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  0,  0,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,2834,2834,
-    1038,1042,2835,1049,1041,314,408,314,314,314,  7,  7,  7,408,314,314,
-    314,314,314,  1,  1,  1,  1,  1,  1,  1,  1,314,314,314,314,314,
     /* Block 219 */
-    314,314,314,  7,  7,314,314,314,314,314,314,314,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,314,314,314,314,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,1042,1042,1042,1042,1049,
-    1049,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 220 */
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,314,314,314,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11,  0,  0, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,2888,2888,
+    1068,1072,2889,1079,1071,331,431,331,331,331, 11, 11, 11,431,331,331,
+    331,331,331, 28, 28, 28, 28, 28, 28, 28, 28,331,331,331,331,331,
+    /* Block 221 */
+    331,331,331, 11, 11,331,331,331,331,331,331,331, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11,331,331,331,331, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,1072,1072,1072,1072,1079,
+    1079, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    /* Block 222 */
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11,331,331,331, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    /* Block 221 */
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    /* Block 223 */
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    /* Block 222 */
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,
-    /* Block 223 */
-    2836,2836,2836,2836,2836,2836,2836,2836,2836,2836,2836,2836,2836,2836,2836,2836,
-    2836,2836,2836,2836,2836,2836,2836,2836,2836,2836,2837,2837,2837,2837,2837,2837,
-    2837,2837,2837,2837,2837,2837,2837,2837,2837,2837,2837,2837,2837,2837,2837,2837,
-    2837,2837,2837,2837,2838,2838,2838,2838,2838,2838,2838,2838,2838,2838,2838,2838,
-    2838,2838,2838,2838,2838,2838,2838,2838,2838,2838,2838,2838,2838,2838,2839,2839,
-    2839,2839,2839,2839,2839,  0,2839,2839,2839,2839,2839,2839,2839,2839,2839,2839,
-    2839,2839,2839,2839,2839,2839,2839,2839,2840,2840,2840,2840,2840,2840,2840,2840,
-    2840,2840,2840,2840,2840,2840,2840,2840,2840,2840,2840,2840,2840,2840,2840,2840,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,
+    439,439,439,439,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 224 */
-    2840,2840,2841,2841,2841,2841,2841,2841,2841,2841,2841,2841,2841,2841,2841,2841,
-    2841,2841,2841,2841,2841,2841,2841,2841,2841,2841,2841,2841,2842,  0,2842,2842,
-      0,  0,2842,  0,  0,2842,2842,  0,  0,2842,2842,2842,2842,  0,2842,2842,
-    2842,2842,2842,2842,2842,2842,2843,2843,2843,2843,  0,2843,  0,2843,2843,2843,
-    2843,2843,2843,2843,  0,2843,2843,2843,2843,2843,2843,2843,2843,2843,2843,2843,
-    2844,2844,2844,2844,2844,2844,2844,2844,2844,2844,2844,2844,2844,2844,2844,2844,
-    2844,2844,2844,2844,2844,2844,2844,2844,2844,2844,2845,2845,2845,2845,2845,2845,
-    2845,2845,2845,2845,2845,2845,2845,2845,2845,2845,2845,2845,2845,2845,2845,2845,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,
+    439,439,439,439,439,439,439,439,439,  0,  0,  0,  0,  0,  0,  0,
     /* Block 225 */
-    2845,2845,2845,2845,2846,2846,  0,2846,2846,2846,2846,  0,  0,2846,2846,2846,
-    2846,2846,2846,2846,2846,  0,2846,2846,2846,2846,2846,2846,2846,  0,2847,2847,
-    2847,2847,2847,2847,2847,2847,2847,2847,2847,2847,2847,2847,2847,2847,2847,2847,
-    2847,2847,2847,2847,2847,2847,2847,2847,2848,2848,  0,2848,2848,2848,2848,  0,
-    2848,2848,2848,2848,2848,  0,2848,  0,  0,  0,2848,2848,2848,2848,2848,2848,
-    2848,  0,2849,2849,2849,2849,2849,2849,2849,2849,2849,2849,2849,2849,2849,2849,
-    2849,2849,2849,2849,2849,2849,2849,2849,2849,2849,2849,2849,2850,2850,2850,2850,
-    2850,2850,2850,2850,2850,2850,2850,2850,2850,2850,2850,2850,2850,2850,2850,2850,
+    2890,2890,2890,2890,2890,2890,2890,2890,2890,2890,2890,2890,2890,2890,2890,2890,
+    2890,2890,2890,2890,2890,2890,2890,2890,2890,2890,2891,2891,2891,2891,2891,2891,
+    2891,2891,2891,2891,2891,2891,2891,2891,2891,2891,2891,2891,2891,2891,2891,2891,
+    2891,2891,2891,2891,2892,2892,2892,2892,2892,2892,2892,2892,2892,2892,2892,2892,
+    2892,2892,2892,2892,2892,2892,2892,2892,2892,2892,2892,2892,2892,2892,2893,2893,
+    2893,2893,2893,2893,2893,  0,2893,2893,2893,2893,2893,2893,2893,2893,2893,2893,
+    2893,2893,2893,2893,2893,2893,2893,2893,2894,2894,2894,2894,2894,2894,2894,2894,
+    2894,2894,2894,2894,2894,2894,2894,2894,2894,2894,2894,2894,2894,2894,2894,2894,
     /* Block 226 */
-    2850,2850,2850,2850,2850,2850,2851,2851,2851,2851,2851,2851,2851,2851,2851,2851,
-    2851,2851,2851,2851,2851,2851,2851,2851,2851,2851,2851,2851,2851,2851,2851,2851,
-    2852,2852,2852,2852,2852,2852,2852,2852,2852,2852,2852,2852,2852,2852,2852,2852,
-    2852,2852,2852,2852,2852,2852,2852,2852,2852,2852,2853,2853,2853,2853,2853,2853,
-    2853,2853,2853,2853,2853,2853,2853,2853,2853,2853,2853,2853,2853,2853,2853,2853,
-    2853,2853,2853,2853,2854,2854,2854,2854,2854,2854,2854,2854,2854,2854,2854,2854,
-    2854,2854,2854,2854,2854,2854,2854,2854,2854,2854,2854,2854,2854,2854,2855,2855,
-    2855,2855,2855,2855,2855,2855,2855,2855,2855,2855,2855,2855,2855,2855,2855,2855,
+    2894,2894,2895,2895,2895,2895,2895,2895,2895,2895,2895,2895,2895,2895,2895,2895,
+    2895,2895,2895,2895,2895,2895,2895,2895,2895,2895,2895,2895,2896,  0,2896,2896,
+      0,  0,2896,  0,  0,2896,2896,  0,  0,2896,2896,2896,2896,  0,2896,2896,
+    2896,2896,2896,2896,2896,2896,2897,2897,2897,2897,  0,2897,  0,2897,2897,2897,
+    2897,2897,2897,2897,  0,2897,2897,2897,2897,2897,2897,2897,2897,2897,2897,2897,
+    2898,2898,2898,2898,2898,2898,2898,2898,2898,2898,2898,2898,2898,2898,2898,2898,
+    2898,2898,2898,2898,2898,2898,2898,2898,2898,2898,2899,2899,2899,2899,2899,2899,
+    2899,2899,2899,2899,2899,2899,2899,2899,2899,2899,2899,2899,2899,2899,2899,2899,
     /* Block 227 */
-    2855,2855,2855,2855,2855,2855,2855,2855,2856,2856,2856,2856,2856,2856,2856,2856,
-    2856,2856,2856,2856,2856,2856,2856,2856,2856,2856,2856,2856,2856,2856,2856,2856,
-    2856,2856,2857,2857,2857,2857,2857,2857,2857,2857,2857,2857,2857,2857,2857,2857,
-    2857,2857,2857,2857,2857,2857,2857,2857,2857,2857,2857,2857,2858,2858,2858,2858,
-    2858,2858,2858,2858,2858,2858,2858,2858,2858,2858,2858,2858,2858,2858,2858,2858,
-    2858,2858,2858,2858,2858,2858,2859,2859,2859,2859,2859,2859,2859,2859,2859,2859,
-    2859,2859,2859,2859,2859,2859,2859,2859,2859,2859,2859,2859,2859,2859,2859,2859,
-    2860,2860,2860,2860,2860,2860,2860,2860,2860,2860,2860,2860,2860,2860,2860,2860,
+    2899,2899,2899,2899,2900,2900,  0,2900,2900,2900,2900,  0,  0,2900,2900,2900,
+    2900,2900,2900,2900,2900,  0,2900,2900,2900,2900,2900,2900,2900,  0,2901,2901,
+    2901,2901,2901,2901,2901,2901,2901,2901,2901,2901,2901,2901,2901,2901,2901,2901,
+    2901,2901,2901,2901,2901,2901,2901,2901,2902,2902,  0,2902,2902,2902,2902,  0,
+    2902,2902,2902,2902,2902,  0,2902,  0,  0,  0,2902,2902,2902,2902,2902,2902,
+    2902,  0,2903,2903,2903,2903,2903,2903,2903,2903,2903,2903,2903,2903,2903,2903,
+    2903,2903,2903,2903,2903,2903,2903,2903,2903,2903,2903,2903,2904,2904,2904,2904,
+    2904,2904,2904,2904,2904,2904,2904,2904,2904,2904,2904,2904,2904,2904,2904,2904,
     /* Block 228 */
-    2860,2860,2860,2860,2860,2860,2860,2860,2860,2860,2861,2861,2861,2861,2861,2861,
-    2861,2861,2861,2861,2861,2861,2861,2861,2861,2861,2861,2861,2861,2861,2861,2861,
-    2861,2861,2861,2861,2862,2863,  0,  0,2864,2864,2864,2864,2864,2864,2864,2864,
-    2864,2864,2864,2864,2864,2864,2864,2864,2864,2865,2864,2864,2864,2864,2864,2864,
-    2864,2866,2867,2867,2867,2867,2867,2867,2867,2867,2867,2867,2867,2867,2867,2867,
-    2867,2867,2867,2867,2867,2867,2867,2867,2867,2867,2867,2868,2869,2870,2871,2872,
-    2873,2874,2875,2875,2875,2875,2875,2875,2875,2875,2875,2875,2875,2875,2875,2875,
-    2875,2875,2875,2876,2875,2875,2875,2875,2875,2875,2875,2877,2878,2878,2878,2878,
-    /* Block 229 */
-    2878,2878,2878,2878,2878,2878,2878,2878,2878,2878,2878,2878,2878,2878,2878,2878,
-    2878,2878,2878,2878,2878,2879,2880,2881,2882,2883,2884,2885,2886,2886,2886,2886,
-    2886,2886,2886,2886,2886,2886,2886,2886,2886,2886,2886,2886,2886,2887,2886,2886,
-    2886,2886,2886,2886,2886,2888,2889,2889,2889,2889,2889,2889,2889,2889,2889,2889,
-    2889,2889,2889,2889,2889,2889,2889,2889,2889,2889,2889,2889,2889,2889,2889,2890,
-    2891,2892,2893,2894,2895,2896,2897,2897,2897,2897,2897,2897,2897,2897,2897,2897,
-    2897,2897,2897,2897,2897,2897,2897,2898,2897,2897,2897,2897,2897,2897,2897,2899,
-    2900,2900,2900,2900,2900,2900,2900,2900,2900,2900,2900,2900,2900,2900,2900,2900,
-    /* Block 230 */
-    2900,2900,2900,2900,2900,2900,2900,2900,2900,2901,2902,2903,2904,2905,2906,2837,
+    2904,2904,2904,2904,2904,2904,2905,2905,2905,2905,2905,2905,2905,2905,2905,2905,
+    2905,2905,2905,2905,2905,2905,2905,2905,2905,2905,2905,2905,2905,2905,2905,2905,
+    2906,2906,2906,2906,2906,2906,2906,2906,2906,2906,2906,2906,2906,2906,2906,2906,
+    2906,2906,2906,2906,2906,2906,2906,2906,2906,2906,2907,2907,2907,2907,2907,2907,
     2907,2907,2907,2907,2907,2907,2907,2907,2907,2907,2907,2907,2907,2907,2907,2907,
-    2907,2908,2907,2907,2907,2907,2907,2907,2907,2909,2910,2910,2910,2910,2910,2910,
+    2907,2907,2907,2907,2908,2908,2908,2908,2908,2908,2908,2908,2908,2908,2908,2908,
+    2908,2908,2908,2908,2908,2908,2908,2908,2908,2908,2908,2908,2908,2908,2909,2909,
+    2909,2909,2909,2909,2909,2909,2909,2909,2909,2909,2909,2909,2909,2909,2909,2909,
+    /* Block 229 */
+    2909,2909,2909,2909,2909,2909,2909,2909,2910,2910,2910,2910,2910,2910,2910,2910,
     2910,2910,2910,2910,2910,2910,2910,2910,2910,2910,2910,2910,2910,2910,2910,2910,
-    2910,2910,2910,2911,2912,2913,2914,2915,2916,2917,2918,2919,  0,  0,2920,2920,
-    2920,2920,2920,2920,2920,2920,2920,2920,2921,2921,2921,2921,2921,2921,2921,2921,
-    2921,2921,2922,2922,2922,2922,2922,2922,2922,2922,2922,2922,2923,2923,2923,2923,
-    2923,2923,2923,2923,2923,2923,2924,2924,2924,2924,2924,2924,2924,2924,2924,2924,
+    2910,2910,2911,2911,2911,2911,2911,2911,2911,2911,2911,2911,2911,2911,2911,2911,
+    2911,2911,2911,2911,2911,2911,2911,2911,2911,2911,2911,2911,2912,2912,2912,2912,
+    2912,2912,2912,2912,2912,2912,2912,2912,2912,2912,2912,2912,2912,2912,2912,2912,
+    2912,2912,2912,2912,2912,2912,2913,2913,2913,2913,2913,2913,2913,2913,2913,2913,
+    2913,2913,2913,2913,2913,2913,2913,2913,2913,2913,2913,2913,2913,2913,2913,2913,
+    2914,2914,2914,2914,2914,2914,2914,2914,2914,2914,2914,2914,2914,2914,2914,2914,
+    /* Block 230 */
+    2914,2914,2914,2914,2914,2914,2914,2914,2914,2914,2915,2915,2915,2915,2915,2915,
+    2915,2915,2915,2915,2915,2915,2915,2915,2915,2915,2915,2915,2915,2915,2915,2915,
+    2915,2915,2915,2915,2916,2917,  0,  0,2918,2918,2918,2918,2918,2918,2918,2918,
+    2918,2918,2918,2918,2918,2918,2918,2918,2918,2919,2918,2918,2918,2918,2918,2918,
+    2918,2920,2921,2921,2921,2921,2921,2921,2921,2921,2921,2921,2921,2921,2921,2921,
+    2921,2921,2921,2921,2921,2921,2921,2921,2921,2921,2921,2922,2923,2924,2925,2926,
+    2927,2928,2929,2929,2929,2929,2929,2929,2929,2929,2929,2929,2929,2929,2929,2929,
+    2929,2929,2929,2930,2929,2929,2929,2929,2929,2929,2929,2931,2932,2932,2932,2932,
     /* Block 231 */
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,  7,  7,  7,  7,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,  7,  7,  7,
-      7,  7,  7,  7,  7,314,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    2932,2932,2932,2932,2932,2932,2932,2932,2932,2932,2932,2932,2932,2932,2932,2932,
+    2932,2932,2932,2932,2932,2933,2934,2935,2936,2937,2938,2939,2940,2940,2940,2940,
+    2940,2940,2940,2940,2940,2940,2940,2940,2940,2940,2940,2940,2940,2941,2940,2940,
+    2940,2940,2940,2940,2940,2942,2943,2943,2943,2943,2943,2943,2943,2943,2943,2943,
+    2943,2943,2943,2943,2943,2943,2943,2943,2943,2943,2943,2943,2943,2943,2943,2944,
+    2945,2946,2947,2948,2949,2950,2951,2951,2951,2951,2951,2951,2951,2951,2951,2951,
+    2951,2951,2951,2951,2951,2951,2951,2952,2951,2951,2951,2951,2951,2951,2951,2953,
+    2954,2954,2954,2954,2954,2954,2954,2954,2954,2954,2954,2954,2954,2954,2954,2954,
     /* Block 232 */
-      7,  7,  7,  7,314,  7,  7,  6,  6,  6,  6,  6,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,314,314,314,314,314,
-      0,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    2954,2954,2954,2954,2954,2954,2954,2954,2954,2955,2956,2957,2958,2959,2960,2891,
+    2961,2961,2961,2961,2961,2961,2961,2961,2961,2961,2961,2961,2961,2961,2961,2961,
+    2961,2962,2961,2961,2961,2961,2961,2961,2961,2963,2964,2964,2964,2964,2964,2964,
+    2964,2964,2964,2964,2964,2964,2964,2964,2964,2964,2964,2964,2964,2964,2964,2964,
+    2964,2964,2964,2965,2966,2967,2968,2969,2970,2971,2972,2973,  0,  0,2974,2974,
+    2974,2974,2974,2974,2974,2974,2974,2974,2975,2975,2975,2975,2975,2975,2975,2975,
+    2975,2975,2976,2976,2976,2976,2976,2976,2976,2976,2976,2976,2977,2977,2977,2977,
+    2977,2977,2977,2977,2977,2977,2978,2978,2978,2978,2978,2978,2978,2978,2978,2978,
     /* Block 233 */
-    314,314,314,314,314,314,314,  0,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,  0,  0,314,314,314,314,314,
-    314,314,  0,314,314,  0,314,314,314,314,314,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331, 11, 11, 11, 11,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331, 11, 11, 11,
+     11, 11, 11, 11, 11,331, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    /* Block 234 */
+     11, 11, 11, 11,331, 11, 11, 10,  8, 10, 10, 10,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,331,331,331,331,331,
+      0,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    /* Block 234 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,  0,  0,  0,
-    314,314,314,314,314,314,314,176,176,176,176,176,176,176,  0,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,176,  7,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 235 */
+    331,331,331,331,331,331,331,  0,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,  0,  0,331,331,331,331,331,
+    331,331,  0,331,331,  0,331,331,331,331,331,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,314,314,314,314,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  7,
     /* Block 236 */
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
-    176,176,176,176,176,  0,  0,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-    314,314,314,314,314,314,314,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,  0,  0,  0,
+    331,331,331,331,331,331,331,191,191,191,191,191,191,191,  0,  0,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  0,  0,  0,  0,191, 11,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 237 */
-    2925,2925,2925,2925,2925,2925,2925,2925,2925,2925,2925,2925,2925,2925,2925,2925,
-    2925,2925,2925,2925,2925,2925,2925,2925,2925,2925,2925,2925,2925,2925,2925,2925,
-    2925,2925,2926,2926,2926,2926,2926,2926,2926,2926,2926,2926,2926,2926,2926,2926,
-    2926,2926,2926,2926,2926,2926,2926,2926,2926,2926,2926,2926,2926,2926,2926,2926,
-    2926,2926,2926,2926,314,314,314,314,314,314,314,176,  0,  0,  0,  0,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  6,  6,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,331,331,331,331,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  0,  0,  0,  0,  0, 11,
     /* Block 238 */
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+    191,191,191,191,191,  0,  0,439,439,439,439,439,439,439,439,439,
+    331,331,331,331,331,331,331,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    /* Block 239 */
+    2979,2979,2979,2979,2979,2979,2979,2979,2979,2979,2979,2979,2979,2979,2979,2979,
+    2979,2979,2979,2979,2979,2979,2979,2979,2979,2979,2979,2979,2979,2979,2979,2979,
+    2979,2979,2980,2980,2980,2980,2980,2980,2980,2980,2980,2980,2980,2980,2980,2980,
+    2980,2980,2980,2980,2980,2980,2980,2980,2980,2980,2980,2980,2980,2980,2980,2980,
+    2980,2980,2980,2980,331,331,331,331,331,331,331,191,  0,  0,  0,  0,
+     17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  0,  0,  0,  0, 10, 10,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    /* Block 240 */
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-    /* Block 239 */
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  7,  8,  8,  8,
-      7,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    /* Block 240 */
-      0,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  7,  8,
-      8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,
+      0,439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,
+    /* Block 241 */
+    439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,
+    439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,
+    439,439,439,439,439,439,439,439,439,439,439,439, 11,439,439,439,
+     11,439,439,439,439,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    /* Block 241 */
-    2927,2927,2928,2929,  0,2930,2929,2931,2932,2933,2934,2934,2934,2934,2935,2928,
-    2936,2937,2938,2939,2940,2941,2941,2942,2943,2944,2939,2945,2946,2947,2948,2949,
-      0,2950,2951,  0,2952,  0,  0,2953,  0,2954,2955,2955,2955,2955,2956,2951,
-    2957,2958,2959,  0,2960,2961,2961,2962,  0,2963,  0,2964,  0,  0,  0,  0,
-      0,  0,2965,  0,  0,  0,  0,2966,  0,2967,  0,2968,  0,2968,2969,2965,
-      0,2970,2971,  0,2972,  0,  0,2973,  0,2974,  0,2975,  0,2976,  0,2959,
-      0,2977,2978,  0,2979,  0,  0,2980,2981,2982,2983,  0,2983,2983,2984,2978,
-    2985,2986,2987,  0,2988,2989,2989,2990,  0,2991,2992,2993,2994,  0,2952,  0,
     /* Block 242 */
-    2995,2995,2996,2997,2998,2998,2997,2999,3000,3001,  0,3002,3002,3002,3003,2996,
-    3004,3005,3006,3007,3008,3009,3009,3010,3011,3012,3007,3013,  0,  0,  0,  0,
-      0,3014,3015,3016,  0,3017,3016,3018,3019,3020,  0,3021,3021,3021,3022,3015,
-    3023,3024,3025,3026,3027,3028,3028,3029,3030,3031,3026,3032,  0,  0,  0,  0,
+      0,439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,
+    439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,
+    439,439,439,439,439,439,439,439,439,439,439,439,439,439, 11,439,
+    439,439,439,439,439,439,439,439,439,439,439,439,439,439,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      7,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 243 */
-     13, 13, 13, 13,1053, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,3033,3033,3033,3033,
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    2981,2981,2982,2983,  0,2984,2983,2985,2986,2987,2988,2988,2988,2988,2989,2982,
+    2990,2991,2992,2993,2994,2995,2995,2996,2997,2998,2993,2999,3000,3001,3002,3003,
+      0,3004,3005,  0,3006,  0,  0,3007,  0,3008,3009,3009,3009,3009,3010,3005,
+    3011,3012,3013,  0,3014,3015,3015,3016,  0,3017,  0,3018,  0,  0,  0,  0,
+      0,  0,3019,  0,  0,  0,  0,3020,  0,3021,  0,3022,  0,3022,3023,3019,
+      0,3024,3025,  0,3026,  0,  0,3027,  0,3028,  0,3029,  0,3030,  0,3013,
+      0,3031,3032,  0,3033,  0,  0,3034,3035,3036,3037,  0,3037,3037,3038,3032,
+    3039,3040,3041,  0,3042,3043,3043,3044,  0,3045,3046,3047,3048,  0,3006,  0,
     /* Block 244 */
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13, 13,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,3033,
-    3033, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-    3033, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,1053,
-    3033, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13, 13, 13, 13,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
+    3049,3049,3050,3051,3052,3052,3051,3053,3054,3055,  0,3056,3056,3056,3057,3050,
+    3058,3059,3060,3061,3062,3063,3063,3064,3065,3066,3061,3067,  0,  0,  0,  0,
+      0,3068,3069,3070,  0,3071,3070,3072,3073,3074,  0,3075,3075,3075,3076,3069,
+    3077,3078,3079,3080,3081,3082,3082,3083,3084,3085,3080,3086,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     11, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     /* Block 245 */
-    3034,3035,3035,3035,3035,3035,3035,3035,3035,3035,3035,  8,  8, 13, 13, 13,
-    3036,3037,3038,3039,3040,3041,3042,3043,3044,3045,3046,3047,3048,3049,3050,3051,
-    3052,3053,3054,3055,3056,3057,3058,3059,3060,3061,3062,3036,3063,3038,3064, 13,
-    3043,3043,3043,3043,3043,3043,3043,3043,3043,3043,3043,3043,3043,3043,3043,3043,
-    3043,3043,3043,3043,3043,3043,3043,3043,3043,3043,3065,3058,3053,3054,3058,3052,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,3066,3067,3068, 13, 13, 13,
-     13, 13,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 13, 13,
+     26, 26, 26, 26,1083, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,3087,3087,3087,3087,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
     /* Block 246 */
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,1053,  7,
-    3069,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 13,3033,3033,
-    3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    3033,3033,3033,3033,3033,3033,3070,3070,3070,3070,3070,3070,3070,3070,3070,3070,
-    3070,3070,3070,3070,3070,3070,3070,3070,3070,3070,3070,3070,3070,3070,3070,3070,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 26,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,3087,
+    3087, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    3087, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,1083,
+    3087, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 26, 26, 26,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
     /* Block 247 */
-    3071,3072,3073,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    3074,3075,3076,3077,3078,3079,3080,3081,3082,3083,3084,3085,3086,3087,3088,3089,
+    3088,3089,3089,3089,3089,3089,3089,3089,3089,3089,3089,439,439, 26, 26, 26,
     3090,3091,3092,3093,3094,3095,3096,3097,3098,3099,3100,3101,3102,3103,3104,3105,
-    3106,3107,3108,3109,3110,3111,3112,3113,3114,3115,3116,3117,3033,3033,3033,3033,
-    3118,3119,3120,3121,3122,3123,3124,3125,3126,3033,3033,3033,3033,3033,3033,3033,
-    3127,3128,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    1053,1053,1053,1053,1053,1053,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
+    3106,3107,3108,3109,3110,3111,3112,3113,3114,3115,3116,3090,3117,3092,3118, 26,
+    3119,3119,3119,3119,3119,3119,3119,3119,3119,3119,3119,3119,3119,3119,3119,3119,
+    3119,3119,3119,3119,3119,3119,3119,3119,3119,3119,3120,3112,3107,3108,3112,3106,
+    3121,3121,3121,3121,3121,3121,3121,3121,3121,3121,3121,3121,3121,3121,3121,3121,
+    3121,3121,3121,3121,3121,3121,3121,3121,3121,3121,3122,3123,3124, 26, 26, 26,
+    3125,3125,3121,3121,3121,3121,3121,3121,3121,3121,3121,3121,3121,3121,3125,3125,
     /* Block 248 */
-    3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
+    3121,3121,3121,3121,3121,3121,3121,3121,3121,3121, 11, 11, 11, 11,1083, 11,
+    3126,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 26,3087,3087,
+    3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    3087,3087,3087,3087,3087,3087,3127,3127,3127,3127,3127,3127,3127,3127,3127,3127,
+    3127,3127,3127,3127,3127,3127,3127,3127,3127,3127,3127,3127,3127,3127,3127,3127,
     /* Block 249 */
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053, 13,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053, 13,1053,1053,
+    3128,3129,3130,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    3131,3132,3133,3134,3135,3136,3137,3138,3139,3140,3141,3142,3143,3144,3145,3146,
+    3147,3148,3149,3150,3151,3152,3153,3154,3155,3156,3157,3158,3159,3160,3161,3162,
+    3163,3164,3165,3166,3167,3168,3169,3170,3171,3172,3173,3174,3087,3087,3087,3087,
+    3175,3176,3177,3178,3179,3180,3181,3182,3183,3087,3087,3087,3087,3087,3087,3087,
+    3184,3185,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    1083,1083,1083,1083,1083,1083,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
     /* Block 250 */
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053, 13, 13, 13, 13,1053,
-    1053,1053,1053,1053, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053, 13, 13, 13,1053, 13, 13, 13,1053,1053,1053,3129,3129,3129,3129,3129,
+    3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
     /* Block 251 */
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053, 13,
-    1053, 13,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083, 26,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083, 26,1083,1083,
     /* Block 252 */
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053, 13, 13,1053,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083, 26, 26, 26, 26,1083,
+    1083,1083,1083,1083, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083, 26, 26, 26,1083, 26, 26, 26,1083,1083,1083,3186,3186,3186,3186,3186,
     /* Block 253 */
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,  7,  7,
-      7,  7,  7,  7,  7,  7, 13, 13, 13, 13, 13,1053,1053,1053,1053, 13,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13,1053, 13, 13, 13, 13, 13,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083, 26,
+    1083, 26,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
     /* Block 254 */
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13, 13, 13,1053,1053, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13, 13,1053, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,1053,1053,1053,1053,1053,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083, 26, 26,1083,
     /* Block 255 */
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083, 11, 11,
+     11, 11, 11, 11, 11, 11, 26, 26, 26, 26, 26,1083,1083,1083,1083, 26,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26,1083, 26, 26, 26, 26, 26,
     /* Block 256 */
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053, 13, 13, 13, 13, 13, 13,1053, 13, 13, 13,
-    1053,1053,1053, 13, 13,1053,1053,1053,3033,3033,3033,3033,3033,3033,3033,3033,
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,1053,1053,3033,3033,3033,
-     13, 13, 13, 13,1053,1053,1053,1053,1053,1053,1053,1053,1053,3033,3033,3033,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 26, 26,1083,1083, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 26,1083, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,1083,1083,1083,1083,1083,
     /* Block 257 */
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11,1156,1156,1156, 11, 11, 11, 11, 11, 11, 11,
     /* Block 258 */
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7, 13, 13, 13, 13,3033,3033,3033,3033,3033,3033,3033,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,3033,3033,3033,3033,
-    3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083, 26, 26, 26, 26, 26, 26,1083, 26, 26, 26,
+    1083,1083,1083, 26, 26,1083,1083,1083,3087,3087,3087,3087,3087,3087,3087,3087,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,1083,1083,3087,3087,3087,
+     26, 26, 26, 26,1083,1083,1083,1083,1083,1083,1083,1083,1083,3087,3087,3087,
     /* Block 259 */
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,3033,3033,3033,3033,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,3033,3033,3033,3033,3033,3033,3033,3033,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,3033,3033,3033,3033,3033,3033,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
     /* Block 260 */
-      7,  7,  7,  7,  7,  7,  7,  7,3033,3033,3033,3033,3033,3033,3033,3033,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,3033,3033,
-     13, 13,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 26, 26, 26, 26,3087,3087,3087,3087,3087,3087,3087,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,3087,3087,3087,3087,
+    3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
     /* Block 261 */
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,  7,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,  7,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,3033,1053,1053,1053,1053,1053,1053,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,3087,3087,3087,3087,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11,3087,3087,3087,3087,3087,3087,3087,3087,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11,3087,3087,3087,3087,3087,3087,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
     /* Block 262 */
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,3033,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
+     11, 11, 11, 11, 11, 11, 11, 11,3087,3087,3087,3087,3087,3087,3087,3087,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,3087,3087,
+     26, 26,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
     /* Block 263 */
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-     13, 13, 13, 13,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-     13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,3033,3033,
-    1053,1053,1053,1053,1053,3033,3033,3033,1053,1053,1053,3033,3033,3033,3033,3033,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083, 11,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083, 11,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,3087,1083,1083,1083,1083,1083,1083,
     /* Block 264 */
-    1053,1053,1053,1053,1053,1053,1053,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
-    1053,1053,1053,1053,1053,1053,1053,1053,1053,3033,3033,3033,3033,3033,3033,3033,
-    1053,1053,1053,1053,1053,1053,1053,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    1053,1053,1053,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    1053,1053,1053,1053,1053,1053,1053,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,3087,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
     /* Block 265 */
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  0,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
-      7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    3130,3130,3130,3130,3130,3130,3130,3130,3130,3130,  0,  0,  0,  0,  0,  0,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+     26, 26, 26, 26,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+     26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,3087,3087,
+    1083,1083,1083,1083,1083,3087,3087,3087,1083,1083,1083,3087,3087,3087,3087,3087,
     /* Block 266 */
-    3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,
-    3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,3033,  0,  0,
+    1083,1083,1083,1083,1083,1083,1083,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,1083,
+    1083,1083,1083,1083,1083,1083,1083,1083,1083,3087,3087,3087,3087,3087,3087,3087,
+    1083,1083,1083,1083,1083,1083,1083,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    1083,1083,1083,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    1083,1083,1083,1083,1083,1083,1083,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
     /* Block 267 */
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1364,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11,  0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    3187,3187,3187,3187,3187,3187,3187,3187,3187,3187,  0,  0,  0,  0,  0,  0,
     /* Block 268 */
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1364,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1364,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
+    3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,
+    3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,3087,  0,  0,
     /* Block 269 */
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1364,1759,1759,
-    1364,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1398,1800,1800,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
     /* Block 270 */
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1364,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1364,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1398,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
+    1398,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
     /* Block 271 */
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1364,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1398,1800,1800,
+    1398,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
     /* Block 272 */
-    3131,3132,3133,3134,3135,3136,3137,3138,3139,3140,3141,3142,3143,3144,3145,3146,
-    3147,3148,3149,3150,3151,3152,3153,3154,3155,3156,3157,3158,3159,3160,3161,3162,
-    3163,3164,3165,3166,3167,3168,3169,3170,3171,3172,3172,3173,3174,3175,3176,3177,
-    3178,3179,3178,3180,3181,3182,3183,3184,3185,3186,3187,3188,3189,3190,3191,3192,
-    3189,3193,3194,3195,3196,3197,3198,3199,3200,3201,3202,3203,3204,3205,3206,3207,
-    3208,3209,3210,3211,3212,3213,3214,3215,3216,3217,3218,3219,3220,3221,3222,3223,
-    3224,3225,3226,3227,3228,3229,3230,3231,3232,3233,3234,3235,3236,3237,3238,3239,
-    3240,3241,3242,3243,3244,3245,3246,3247,3248,3249,3250,3251,3252,3251,3253,3254,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1398,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
+    1398,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
     /* Block 273 */
-    3255,3256,3256,3257,3258,3259,3260,3261,3262,3263,3264,3265,3266,3267,3268,3269,
-    3270,3271,3272,3273,3274,3275,3276,3277,3278,3279,3280,3281,3282,3283,3284,3285,
-    3286,3287,3288,3289,3290,3291,3292,3293,3294,3295,3296,3297,3298,3299,3300,3301,
-    3302,3303,3304,3305,3306,3307,3308,3309,3310,3311,3312,3313,3314,3315,3316,3317,
-    3318,3319,3320,3321,3322,3323,3324,3325,3326,3327,3328,3329,3330,3331,3332,3333,
-    3334,3335,3336,3337,3330,3338,3339,3340,3341,3342,3343,3344,3345,3346,3347,3348,
-    3349,3350,3351,3352,3353,3354,3355,3356,3357,3358,3359,3360,3361,3362,3363,3364,
-    3365,3366,3367,3368,3369,3370,3370,3371,3372,3373,3374,3375,3376,3377,3378,3379,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1398,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
     /* Block 274 */
-    3380,3381,3382,3383,3384,3385,3386,3387,3388,3389,3390,3391,3392,3393,3394,3395,
-    3396,3397,3398,3399,3400,3401,3402,3403,3404,3405,3406,3407,3408,3409,3410,3411,
-    3412,3413,3414,3415,3416,3417,3418,3419,3420,3421,3422,3423,3424,3425,3426,3427,
-    3428,3429,3430,3431,3432,3433,3434,3435,3436,3437,3438,3439,3440,3441,3442,3443,
-    3444,3445,3446,3447,3448,3449,3449,3450,3451,3452,3453,3454,3455,3456,3457,3458,
-    3459,3460,3461,3462,3463,3464,3465,3466,3467,3468,3469,3470,3471,3472,3473,3474,
-    3475,3476,3477,3478,3479,3480,3481,3482,3483,3484,3485,3486,3487,3488,3489,3490,
-    3491,3492,3493,3494,3495,3496,3497,3498,3499,3500,3501,3502,3503,3504,3505,3506,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
     /* Block 275 */
-    3507,3508,3509,3510,3511,3512,3513,3514,3515,3516,3517,3518,3519,3520,3521,3522,
-    3523,3524,3525,3526,3527,3528,3529,3530,3531,3532,3533,3534,3535,3536,3537,3538,
-    3539,3540,3541,3542,3543,3544,3545,3546,3547,3548,3549,3550,3551,3552,3553,3554,
-    3555,3556,3557,3558,3559,3560,3561,3562,3563,3564,3565,3566,3567,3568,3569,3570,
-    3571,3572,3573,3574,3575,3576,3577,3578,3579,3580,3581,3582,3583,3584,3585,3586,
-    3587,3588,3589,3590,3591,3592,3593,3594,3595,3596,3597,3598,3599,3600,3601,3602,
-    2072,3603,3604,3605,3606,3607,3608,3609,3610,3610,3611,3612,3613,3614,3615,3616,
-    3617,3618,3619,3620,3621,3622,3623,3624,3625,3626,3627,3628,3629,3630,3631,3632,
+    3188,3189,3190,3191,3192,3193,3194,3195,3196,3197,3198,3199,3200,3201,3202,3203,
+    3204,3205,3206,3207,3208,3209,3210,3211,3212,3213,3214,3215,3216,3217,3218,3219,
+    3220,3221,3222,3223,3224,3225,3226,3227,3228,3229,3229,3230,3231,3232,3233,3234,
+    3235,3236,3235,3237,3238,3239,3240,3241,3242,3243,3244,3245,3246,3247,3248,3249,
+    3246,3250,3251,3252,3253,3254,3255,3256,3257,3258,3259,3260,3261,3262,3263,3264,
+    3265,3266,3267,3268,3269,3270,3271,3272,3273,3274,3275,3276,3277,3278,3279,3280,
+    3281,3282,3283,3284,3285,3286,3287,3288,3289,3290,3291,3292,3293,3294,3295,3296,
+    3297,3298,3299,3300,3301,3302,3303,3304,3305,3306,3307,3308,3309,3308,3310,3311,
     /* Block 276 */
-    3633,3634,3635,3636,3637,3638,3639,3640,3641,3642,3643,3644,3645,3646,3647,3648,
-    3649,3650,3651,3652,3653,3654,3655,3656,3657,3658,3659,3660,3661,3662,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
+    3312,3313,3313,3314,3315,3316,3317,3318,3319,3320,3321,3322,3323,3324,3325,3326,
+    3327,3328,3329,3330,3331,3332,3333,3334,3335,3336,3337,3338,3339,3340,3341,3342,
+    3343,3344,3345,3346,3347,3348,3349,3350,3351,3352,3353,3354,3355,3356,3357,3358,
+    3359,3360,3361,3362,3363,3364,3365,3366,3367,3368,3369,3370,3371,3372,3373,3374,
+    3375,3376,3377,3378,3379,3380,3381,3382,3383,3384,3385,3386,3387,3388,3389,3390,
+    3391,3392,3393,3394,3387,3395,3396,3397,3398,3399,3400,3401,3402,3403,3404,3405,
+    3406,3407,3408,3409,3410,3411,3412,3413,3414,3415,3416,3417,3418,3419,3420,3421,
+    3422,3423,3424,3425,3426,3427,3427,3428,3429,3430,3431,3432,3433,3434,3435,3436,
     /* Block 277 */
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,  0,  0,
+    3437,3438,3439,3440,3441,3442,3443,3444,3445,3446,3447,3448,3449,3450,3451,3452,
+    3453,3454,3455,3456,3457,3458,3459,3460,3461,3462,3463,3464,3465,3466,3467,3468,
+    3469,3470,3471,3472,3473,3474,3475,3476,3477,3478,3479,3480,3481,3482,3483,3484,
+    3485,3486,3487,3488,3489,3490,3491,3492,3493,3494,3495,3496,3497,3498,3499,3500,
+    3501,3502,3503,3504,3505,3506,3506,3507,3508,3509,3510,3511,3512,3513,3514,3515,
+    3516,3517,3518,3519,3520,3521,3522,3523,3524,3525,3526,3527,3528,3529,3530,3531,
+    3532,3533,3534,3535,3536,3537,3538,3539,3540,3541,3542,3543,3544,3545,3546,3547,
+    3548,3549,3550,3551,3552,3553,3554,3555,3556,3557,3558,3559,3560,3561,3562,3563,
     /* Block 278 */
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1364,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
-    1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,1759,
+    3564,3565,3566,3567,3568,3569,3570,3571,3572,3573,3574,3575,3576,3577,3578,3579,
+    3580,3581,3582,3583,3584,3585,3586,3587,3588,3589,3590,3591,3592,3593,3594,3595,
+    3596,3597,3598,3599,3600,3601,3602,3603,3604,3605,3606,3607,3608,3609,3610,3611,
+    3612,3613,3614,3615,3616,3617,3618,3619,3620,3621,3622,3623,3624,3625,3626,3627,
+    3628,3629,3630,3631,3632,3633,3634,3635,3636,3637,3638,3639,3640,3641,3642,3643,
+    3644,3645,3646,3647,3648,3649,3650,3651,3652,3653,3654,3655,3656,3657,3658,3659,
+    2113,3660,3661,3662,3663,3664,3665,3666,3667,3667,3668,3669,3670,3671,3672,3673,
+    3674,3675,3676,3677,3678,3679,3680,3681,3682,3683,3684,3685,3686,3687,3688,3689,
     /* Block 279 */
-      1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
-      1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
-    910,910,910,910,910,910,910,910,910,910,910,910,910,910,910,910,
-    910,910,910,910,910,910,910,910,910,910,910,910,910,910,910,910,
-    910,910,910,910,910,910,910,910,910,910,910,910,910,910,910,910,
-    910,910,910,910,910,910,910,910,910,910,910,910,910,910,910,910,
-    910,910,910,910,910,910,910,910,910,910,910,910,910,910,910,910,
-    910,910,910,910,910,910,910,910,910,910,910,910,910,910,910,910,
+    3690,3691,3692,3693,3694,3695,3696,3697,3698,3699,3700,3701,3702,3703,3704,3705,
+    3706,3707,3708,3709,3710,3711,3712,3713,3714,3715,3716,3717,3718,3719,1800,1800,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
     /* Block 280 */
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,  0,  0,
+    /* Block 281 */
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,
+    1799,1799,1799,1799,1799,1799,1799,1799,1799,1799,1398,1800,1800,1800,1800,1800,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
+    1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,1800,
+    /* Block 282 */
+      1, 28,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
       1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+    938,938,938,938,938,938,938,938,938,938,938,938,938,938,938,938,
+    938,938,938,938,938,938,938,938,938,938,938,938,938,938,938,938,
+    938,938,938,938,938,938,938,938,938,938,938,938,938,938,938,938,
+    938,938,938,938,938,938,938,938,938,938,938,938,938,938,938,938,
+    938,938,938,938,938,938,938,938,938,938,938,938,938,938,938,938,
+    938,938,938,938,938,938,938,938,938,938,938,938,938,938,938,938,
+    /* Block 283 */
       1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
       1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
       1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
@@ -6988,33 +7071,34 @@ static const uint16_t tmu_ucd_stage_two[36352] = {
       1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
       1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
       1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
-    /* Block 281 */
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    /* Block 282 */
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
-    314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
       1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
-    /* Block 283 */
-    1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,
-    1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,
-    1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,
-    1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,
-    1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,
-    1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,
-    1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,
-    1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,1790,  0,  0
+    /* Block 284 */
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    /* Block 285 */
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,
+      1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+    /* Block 286 */
+    1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,
+    1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,
+    1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,
+    1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,
+    1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,
+    1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,
+    1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,
+    1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,1831,  0,  0
 };
 
 /*
@@ -7076,14 +7160,3382 @@ static const tmu_ucd_internal* tmu_get_ucd_internal(uint32_t cp) {
     return &tmu_ucd_entries[entry_index];
 }
 
+/* Per-property table for word_break: 16928 bytes. */
+static const uint8_t tmu_word_break_stage_one[1088] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 14, 15, 16, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 17, 13, 13, 13, 13, 13, 13, 13, 13, 18, 19, 
+    20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 13, 13, 14, 30, 13, 13, 
+    13, 31, 13, 13, 13, 13, 13, 13, 13, 13, 32, 33, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 34, 13, 13, 35, 
+    13, 13, 13, 13, 36, 37, 38, 13, 39, 13, 40, 41, 42, 43, 44, 45, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    46, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13
+};
+static const uint16_t tmu_word_break_stage_two[1504] = {
+    0, 1, 2, 3, 4, 5, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 
+    7, 7, 7, 7, 7, 7, 8, 7, 9, 9, 9, 10, 11, 12, 7, 13, 
+    7, 7, 7, 7, 14, 7, 7, 7, 7, 15, 16, 7, 17, 18, 19, 20, 
+    21, 7, 22, 23, 7, 7, 24, 25, 26, 27, 28, 7, 7, 29, 30, 31, 
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 53, 57, 58, 59, 60, 61, 62, 
+    63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 
+    36, 79, 80, 36, 36, 81, 82, 36, 83, 84, 85, 86, 87, 88, 89, 36, 
+    36, 90, 91, 92, 93, 7, 94, 95, 7, 7, 7, 7, 7, 7, 7, 7, 
+    7, 7, 96, 7, 97, 98, 99, 7, 100, 7, 101, 36, 102, 7, 7, 103, 
+    104, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 
+    7, 7, 7, 105, 106, 7, 7, 107, 108, 109, 110, 111, 36, 112, 113, 114, 
+    115, 7, 7, 116, 117, 118, 7, 119, 120, 121, 62, 36, 36, 36, 122, 36, 
+    123, 36, 124, 125, 126, 127, 128, 36, 129, 130, 131, 132, 133, 134, 7, 135, 
+    7, 136, 137, 138, 139, 140, 141, 142, 7, 7, 7, 7, 7, 7, 9, 143, 
+    7, 7, 7, 7, 7, 7, 7, 7, 103, 7, 144, 138, 7, 145, 146, 147, 
+    148, 149, 150, 151, 152, 36, 127, 153, 154, 155, 156, 7, 157, 158, 36, 36, 
+    36, 36, 36, 36, 36, 36, 36, 36, 159, 160, 36, 36, 160, 36, 161, 162, 
+    36, 36, 36, 36, 36, 163, 7, 164, 36, 36, 36, 36, 36, 165, 166, 167, 
+    168, 169, 169, 169, 170, 169, 169, 169, 171, 172, 173, 174, 175, 176, 36, 36, 
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 177, 36, 36, 36, 36, 36, 36, 
+    36, 36, 36, 36, 36, 36, 36, 36, 178, 36, 179, 36, 36, 36, 36, 36, 
+    7, 180, 120, 7, 7, 7, 7, 181, 7, 94, 7, 182, 183, 184, 184, 9, 
+    36, 185, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 
+    186, 187, 36, 36, 188, 189, 189, 190, 191, 15, 7, 7, 192, 7, 36, 193, 
+    36, 36, 36, 36, 194, 36, 193, 195, 189, 189, 196, 36, 36, 36, 36, 36, 
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 
+    7, 7, 7, 7, 197, 36, 198, 138, 7, 7, 7, 7, 7, 7, 7, 7, 
+    199, 200, 7, 201, 202, 7, 7, 203, 204, 7, 7, 7, 7, 7, 205, 206, 
+    207, 208, 7, 209, 210, 130, 211, 212, 30, 213, 214, 215, 40, 216, 217, 218, 
+    7, 219, 220, 221, 36, 222, 223, 224, 225, 226, 7, 227, 7, 7, 7, 228, 
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 229, 230, 231, 
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 
+    36, 36, 36, 36, 36, 36, 36, 36, 232, 233, 234, 7, 7, 235, 236, 7, 
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 138, 198, 7, 237, 7, 238, 239, 
+    240, 241, 242, 243, 7, 7, 7, 244, 245, 2, 3, 246, 247, 120, 248, 249, 
+    250, 251, 252, 36, 7, 7, 7, 253, 36, 36, 7, 254, 36, 36, 36, 255, 
+    36, 36, 36, 36, 215, 7, 256, 128, 7, 257, 258, 259, 138, 7, 260, 36, 
+    7, 7, 7, 7, 138, 261, 262, 231, 7, 263, 7, 264, 36, 36, 36, 36, 
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 183, 119, 238, 36, 36, 36, 36, 
+    265, 266, 119, 183, 120, 36, 36, 267, 119, 268, 36, 36, 7, 8, 36, 36, 
+    269, 270, 36, 215, 215, 36, 85, 271, 7, 119, 119, 272, 235, 36, 36, 36, 
+    7, 7, 273, 36, 7, 272, 7, 272, 7, 274, 36, 36, 36, 36, 36, 36, 
+    36, 36, 36, 36, 7, 275, 36, 36, 215, 276, 277, 36, 36, 198, 278, 183, 
+    133, 279, 280, 281, 133, 282, 283, 284, 133, 285, 286, 287, 133, 216, 288, 36, 
+    289, 290, 36, 36, 291, 139, 292, 293, 294, 295, 296, 297, 36, 36, 36, 36, 
+    7, 298, 299, 300, 7, 27, 301, 36, 36, 36, 36, 36, 7, 302, 303, 36, 
+    7, 27, 304, 36, 7, 305, 114, 36, 306, 307, 36, 36, 36, 36, 36, 36, 
+    7, 308, 36, 36, 36, 7, 7, 309, 310, 311, 312, 36, 36, 313, 314, 315, 
+    316, 317, 318, 7, 319, 36, 7, 116, 36, 36, 36, 36, 36, 36, 36, 36, 
+    320, 321, 322, 323, 324, 325, 36, 36, 326, 327, 328, 329, 330, 114, 36, 36, 
+    36, 36, 36, 36, 36, 36, 36, 331, 36, 36, 36, 36, 36, 332, 36, 36, 
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 268, 36, 36, 36, 
+    7, 7, 7, 192, 7, 7, 7, 7, 7, 7, 264, 36, 36, 36, 36, 36, 
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 
+    7, 333, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 
+    7, 7, 334, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 
+    7, 116, 120, 114, 36, 36, 198, 335, 7, 336, 337, 338, 102, 36, 36, 36, 
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 
+    36, 36, 7, 7, 36, 36, 36, 36, 7, 7, 339, 9, 340, 36, 36, 341, 
+    342, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 343, 36, 36, 36, 36, 
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 
+    7, 7, 7, 344, 345, 346, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 347, 348, 349, 36, 36, 
+    36, 36, 350, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 
+    7, 7, 37, 7, 351, 352, 353, 7, 354, 355, 356, 7, 7, 7, 7, 7, 
+    7, 7, 7, 7, 7, 357, 358, 95, 37, 37, 180, 180, 320, 320, 359, 360, 
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 
+    9, 361, 9, 362, 363, 364, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 
+    365, 366, 36, 36, 36, 36, 36, 36, 7, 367, 368, 36, 36, 36, 36, 36, 
+    36, 36, 36, 36, 36, 36, 7, 369, 36, 36, 36, 36, 36, 36, 36, 36, 
+    7, 7, 7, 7, 7, 7, 370, 36, 7, 7, 371, 36, 36, 36, 36, 36, 
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 
+    353, 372, 373, 374, 375, 376, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 
+    169, 169, 169, 169, 169, 169, 169, 169, 377, 378, 227, 379, 380, 381, 169, 382, 
+    383, 384, 385, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 386, 
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 387, 388, 169, 169, 169, 169, 169, 
+    169, 169, 389, 36, 169, 169, 169, 169, 36, 36, 36, 390, 36, 36, 391, 169, 
+    392, 36, 393, 36, 394, 395, 169, 169, 396, 397, 398, 169, 169, 169, 169, 169, 
+    169, 169, 169, 169, 169, 169, 169, 169, 36, 36, 36, 36, 36, 36, 36, 122, 
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 387, 
+    399, 9, 9, 9, 36, 36, 36, 36, 9, 9, 9, 9, 9, 9, 9, 400, 
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36
+};
+static const uint8_t tmu_word_break_stage_three[12832] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 3, 1, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    18, 0, 12, 0, 0, 0, 0, 11, 0, 0, 0, 0, 15, 0, 13, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 14, 15, 0, 0, 0, 0, 
+    0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 17, 
+    0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 10, 0, 0, 7, 19, 0, 
+    0, 0, 0, 0, 0, 10, 0, 14, 0, 0, 10, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 10, 10, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    10, 10, 10, 10, 10, 0, 10, 10, 0, 0, 10, 10, 10, 10, 15, 10, 
+    0, 0, 0, 0, 0, 0, 10, 14, 10, 10, 10, 0, 10, 0, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 0, 4, 4, 4, 4, 4, 4, 4, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 0, 10, 14, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 15, 10, 0, 0, 0, 0, 0, 
+    0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 
+    0, 4, 4, 0, 4, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 9, 
+    9, 9, 9, 10, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 15, 15, 0, 0, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 7, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 16, 15, 0, 10, 10, 
+    4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 0, 10, 4, 4, 4, 4, 4, 4, 4, 7, 0, 4, 
+    4, 4, 4, 4, 4, 10, 10, 4, 4, 0, 4, 4, 4, 4, 10, 10, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 10, 10, 10, 0, 0, 10, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 
+    10, 4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 10, 10, 0, 0, 15, 0, 10, 0, 0, 4, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 10, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 10, 4, 4, 4, 10, 4, 4, 4, 4, 4, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 7, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 10, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    10, 4, 4, 4, 4, 4, 4, 4, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 4, 4, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 
+    0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 4, 4, 4, 0, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 10, 
+    10, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 
+    10, 0, 10, 0, 0, 0, 10, 10, 10, 10, 0, 0, 4, 10, 4, 4, 
+    4, 4, 4, 4, 4, 0, 0, 4, 4, 0, 0, 4, 4, 4, 10, 0, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 10, 10, 0, 10, 
+    10, 10, 4, 4, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 
+    10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 4, 0, 
+    0, 4, 4, 4, 0, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 10, 
+    10, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 
+    10, 0, 10, 10, 0, 10, 10, 0, 10, 10, 0, 0, 4, 0, 4, 4, 
+    4, 4, 4, 0, 0, 0, 0, 4, 4, 0, 0, 4, 4, 4, 0, 0, 
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 0, 10, 0, 
+    0, 0, 0, 0, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 
+    4, 4, 10, 10, 10, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 4, 4, 4, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 
+    10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 
+    10, 0, 10, 10, 0, 10, 10, 10, 10, 10, 0, 0, 4, 10, 4, 4, 
+    4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4, 0, 0, 
+    10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 4, 4, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 4, 4, 4, 4, 4, 4, 
+    0, 4, 4, 4, 0, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 10, 
+    10, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    4, 4, 4, 4, 4, 0, 0, 4, 4, 0, 0, 4, 4, 4, 0, 0, 
+    0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0, 10, 10, 0, 10, 
+    10, 10, 4, 4, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 
+    0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 4, 10, 0, 10, 10, 10, 10, 10, 10, 0, 0, 0, 10, 10, 
+    10, 0, 10, 10, 10, 10, 0, 0, 0, 10, 10, 0, 10, 0, 10, 10, 
+    0, 0, 0, 10, 10, 0, 0, 0, 10, 10, 10, 0, 0, 0, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 4, 4, 
+    4, 4, 4, 0, 0, 0, 4, 4, 4, 0, 4, 4, 4, 4, 0, 0, 
+    10, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    4, 4, 4, 4, 4, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 
+    10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 10, 4, 4, 
+    4, 4, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4, 4, 0, 0, 
+    0, 0, 0, 0, 0, 4, 4, 0, 10, 10, 10, 0, 0, 0, 0, 0, 
+    10, 10, 4, 4, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 4, 4, 4, 0, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 
+    10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 0, 0, 4, 10, 4, 4, 
+    4, 4, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4, 4, 0, 0, 
+    0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 10, 0, 
+    10, 10, 4, 4, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 
+    0, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    4, 4, 4, 4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 
+    10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 10, 4, 4, 
+    4, 4, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4, 4, 10, 0, 
+    0, 0, 0, 0, 10, 10, 10, 4, 0, 0, 0, 0, 0, 0, 0, 10, 
+    10, 10, 4, 4, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 
+    0, 4, 4, 4, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 4, 0, 0, 0, 0, 4, 
+    4, 4, 4, 4, 4, 0, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 
+    0, 0, 0, 0, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 
+    0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 0, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 4, 0, 4, 0, 0, 0, 0, 4, 4, 
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 
+    0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 0, 4, 4, 10, 10, 10, 10, 10, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 0, 0, 0, 4, 4, 
+    4, 0, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 
+    0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 4, 4, 4, 4, 0, 0, 
+    10, 10, 10, 10, 10, 10, 0, 10, 0, 0, 0, 0, 0, 10, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 0, 10, 0, 10, 10, 10, 10, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 0, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 10, 0, 
+    10, 0, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 0, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 4, 4, 4, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 0, 0, 
+    0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    18, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 
+    10, 10, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 
+    10, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 7, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 4, 4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 10, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    4, 4, 4, 4, 4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    4, 4, 4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 10, 10, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 10, 10, 10, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 10, 10, 10, 10, 4, 10, 10, 
+    10, 10, 10, 10, 4, 10, 10, 4, 4, 4, 10, 0, 0, 0, 0, 0, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 
+    10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 0, 10, 0, 10, 0, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 0, 10, 0, 
+    0, 0, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 
+    10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 
+    0, 0, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 
+    18, 18, 18, 18, 18, 18, 18, 0, 18, 18, 18, 0, 4, 5, 7, 7, 
+    0, 0, 0, 0, 0, 0, 0, 0, 13, 13, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 13, 0, 0, 14, 3, 3, 7, 7, 7, 7, 7, 17, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 17, 
+    17, 0, 0, 0, 15, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 
+    7, 7, 7, 7, 7, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 
+    0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 10, 0, 0, 0, 0, 10, 0, 0, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 0, 10, 0, 0, 0, 10, 10, 10, 10, 10, 0, 0, 
+    0, 0, 19, 0, 10, 0, 10, 0, 10, 0, 10, 10, 10, 10, 0, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 
+    0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 0, 0, 0, 0, 10, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 0, 0, 0, 0, 19, 19, 19, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 19, 19, 0, 
+    19, 19, 19, 19, 19, 19, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 0, 19, 0, 19, 0, 0, 0, 0, 0, 0, 19, 0, 0, 
+    0, 19, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 19, 0, 0, 19, 0, 0, 0, 0, 19, 0, 19, 0, 
+    0, 0, 0, 19, 19, 19, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    19, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 4, 
+    4, 4, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 10, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 0, 
+    10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    18, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 
+    19, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 10, 10, 19, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 8, 8, 0, 0, 0, 
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 
+    0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 19, 0, 19, 0, 0, 0, 0, 0, 0, 
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 
+    8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 10, 10, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 
+    4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 4, 10, 10, 10, 4, 10, 10, 10, 10, 4, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 4, 4, 4, 4, 4, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    4, 4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 10, 10, 10, 10, 10, 10, 0, 0, 0, 10, 0, 10, 10, 4, 
+    10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 4, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 0, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    4, 0, 4, 4, 4, 0, 0, 4, 4, 0, 0, 0, 0, 0, 4, 4, 
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 
+    0, 0, 10, 10, 10, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 0, 
+    0, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 0, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 9, 4, 9, 
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 9, 9, 9, 9, 9, 9, 
+    9, 9, 9, 9, 9, 9, 9, 0, 9, 9, 9, 9, 9, 0, 9, 0, 
+    9, 9, 0, 9, 9, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    15, 0, 0, 14, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    0, 0, 0, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17, 17, 
+    15, 0, 13, 0, 15, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 7, 
+    0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 15, 0, 13, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 14, 15, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4, 4, 
+    0, 0, 10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 
+    0, 0, 10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 0, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 
+    0, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 0, 0, 10, 0, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 0, 10, 10, 0, 0, 0, 10, 0, 0, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 0, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 
+    10, 4, 4, 4, 0, 4, 4, 0, 0, 0, 0, 0, 4, 4, 4, 4, 
+    10, 10, 10, 10, 0, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 0, 0, 4, 4, 4, 0, 0, 0, 0, 4, 
+    10, 10, 10, 10, 10, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 4, 4, 0, 0, 0, 
+    10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 7, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 
+    0, 0, 0, 0, 10, 4, 4, 10, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 4, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    4, 10, 10, 10, 10, 0, 0, 0, 0, 4, 4, 4, 4, 0, 4, 4, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 10, 0, 10, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 4, 0, 
+    10, 10, 10, 10, 10, 10, 10, 0, 10, 0, 10, 10, 10, 10, 0, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    4, 4, 4, 4, 0, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 10, 
+    10, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 
+    10, 0, 10, 10, 0, 10, 10, 10, 10, 10, 0, 4, 4, 10, 4, 4, 
+    4, 4, 4, 4, 4, 0, 0, 4, 4, 0, 0, 4, 4, 4, 0, 0, 
+    10, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 10, 10, 10, 
+    10, 10, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 
+    4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 10, 10, 10, 10, 0, 0, 0, 0, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 4, 10, 
+    10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    4, 4, 4, 4, 10, 10, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 
+    4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 4, 4, 0, 0, 
+    4, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 10, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 
+    10, 10, 10, 10, 10, 10, 10, 0, 0, 10, 0, 0, 10, 10, 10, 10, 
+    10, 10, 10, 10, 0, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    4, 4, 4, 4, 4, 4, 0, 4, 4, 0, 0, 4, 4, 4, 4, 10, 
+    4, 10, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 
+    4, 10, 0, 10, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 10, 4, 4, 4, 4, 0, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 10, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 
+    4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 
+    10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 0, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 4, 4, 4, 4, 4, 4, 0, 0, 0, 4, 0, 4, 4, 0, 4, 
+    4, 4, 4, 4, 4, 4, 10, 4, 0, 0, 0, 0, 0, 0, 0, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 0, 10, 10, 0, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 0, 
+    4, 4, 0, 4, 4, 4, 4, 4, 10, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 
+    4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 4, 
+    10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 4, 
+    4, 4, 4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 0, 10, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 4, 4, 0, 
+    7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 0, 0, 0, 4, 4, 4, 
+    4, 4, 4, 7, 7, 7, 7, 7, 7, 7, 7, 4, 4, 4, 4, 4, 
+    4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 
+    0, 0, 10, 0, 0, 10, 10, 0, 0, 10, 10, 10, 10, 0, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 0, 10, 10, 10, 
+    10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 0, 0, 10, 10, 10, 
+    10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 0, 
+    10, 10, 10, 10, 10, 0, 10, 0, 0, 0, 10, 10, 10, 10, 10, 10, 
+    10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 
+    10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 16, 16, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 
+    0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 
+    4, 4, 0, 4, 4, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 
+    4, 4, 4, 4, 4, 4, 4, 10, 10, 10, 10, 10, 10, 10, 0, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 10, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 10, 0, 0, 0, 0, 
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+    0, 10, 10, 0, 10, 0, 0, 10, 0, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 0, 10, 10, 10, 10, 0, 10, 0, 10, 0, 0, 0, 0, 
+    0, 0, 10, 0, 0, 0, 0, 10, 0, 10, 0, 10, 0, 10, 10, 10, 
+    0, 10, 10, 0, 10, 0, 0, 10, 0, 10, 0, 10, 0, 10, 0, 10, 
+    0, 10, 10, 0, 10, 0, 0, 10, 10, 10, 10, 0, 10, 10, 10, 10, 
+    10, 10, 10, 0, 10, 10, 10, 10, 0, 10, 10, 10, 10, 0, 10, 0, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 
+    0, 10, 10, 10, 0, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 19, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 19, 19, 19, 19, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 19, 0, 
+    0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 
+    0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 
+    0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 19, 19, 19, 19, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 4, 4, 4, 4, 4, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 
+    0, 0, 0, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 19, 19, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 19, 19, 19, 19, 
+    0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static uint32_t tmu_get_word_break_property_internal(uint32_t cp) {
+    if (cp > 0x10FFFF) return 0;
+    uint32_t block_index = ((uint32_t)tmu_word_break_stage_one[cp >> 10] << 5) + ((cp >> 5) & 31);
+    uint32_t offset = cp & 31;
+    return tmu_word_break_stage_three[(uint32_t)tmu_word_break_stage_two[block_index] * 32 + offset];
+}
+
+/* Per-property table for sentence_break: 11808 bytes. */
+static const uint8_t tmu_sentence_break_stage_one[1088] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 13, 13, 
+    13, 13, 13, 14, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 15, 13, 16, 17, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 18, 19, 19, 19, 19, 19, 19, 19, 19, 20, 21, 
+    22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 19, 19, 13, 32, 19, 19, 
+    19, 33, 19, 19, 19, 19, 19, 19, 19, 19, 34, 35, 13, 13, 13, 13, 
+    13, 36, 13, 37, 19, 19, 19, 19, 19, 19, 19, 19, 38, 19, 19, 39, 
+    19, 19, 19, 19, 40, 41, 42, 19, 43, 19, 44, 45, 46, 47, 48, 19, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 49, 13, 13, 13, 50, 51, 13, 
+    13, 13, 13, 52, 13, 13, 13, 13, 13, 13, 53, 19, 19, 19, 54, 19, 
+    13, 13, 13, 13, 55, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    56, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19
+};
+static const uint16_t tmu_sentence_break_stage_two[1824] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 
+    8, 16, 17, 18, 19, 20, 21, 22, 23, 23, 23, 24, 25, 26, 27, 28, 
+    29, 30, 18, 8, 31, 8, 32, 8, 8, 33, 34, 18, 35, 36, 37, 38, 
+    39, 40, 41, 42, 40, 40, 43, 44, 45, 46, 47, 40, 40, 48, 49, 50, 
+    51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 
+    67, 68, 69, 70, 71, 72, 73, 74, 75, 72, 76, 77, 78, 79, 80, 81, 
+    82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 
+    98, 99, 100, 55, 101, 102, 103, 55, 104, 105, 106, 107, 108, 109, 110, 55, 
+    40, 111, 112, 113, 114, 29, 115, 116, 40, 40, 40, 40, 40, 40, 40, 40, 
+    40, 40, 117, 40, 118, 119, 120, 40, 121, 40, 122, 123, 124, 29, 29, 125, 
+    98, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 
+    40, 40, 40, 126, 127, 40, 40, 128, 129, 130, 131, 132, 40, 133, 134, 135, 
+    136, 40, 40, 137, 138, 139, 40, 140, 141, 142, 143, 144, 40, 145, 146, 55, 
+    147, 40, 148, 149, 150, 151, 152, 55, 153, 133, 154, 155, 156, 157, 40, 158, 
+    40, 159, 160, 161, 162, 163, 164, 165, 18, 18, 18, 18, 18, 18, 23, 166, 
+    8, 8, 8, 8, 167, 8, 8, 8, 168, 169, 170, 171, 169, 172, 173, 174, 
+    175, 176, 177, 178, 179, 55, 180, 181, 182, 183, 184, 30, 185, 55, 55, 55, 
+    55, 55, 55, 55, 55, 55, 55, 55, 186, 187, 55, 55, 55, 55, 55, 55, 
+    55, 55, 55, 55, 55, 188, 30, 189, 55, 55, 55, 55, 55, 55, 55, 55, 
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 190, 191, 55, 55, 192, 193, 
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 194, 55, 195, 196, 
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 
+    29, 197, 198, 199, 8, 8, 8, 200, 18, 201, 40, 202, 203, 204, 204, 23, 
+    205, 206, 207, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 
+    208, 209, 98, 40, 210, 98, 40, 116, 211, 212, 40, 40, 213, 40, 55, 214, 
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 55, 55, 
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 215, 
+    40, 40, 40, 40, 216, 55, 214, 217, 40, 40, 40, 40, 40, 40, 40, 40, 
+    218, 219, 8, 220, 221, 40, 40, 222, 223, 224, 8, 225, 226, 227, 228, 229, 
+    230, 231, 40, 232, 233, 133, 234, 235, 49, 236, 237, 215, 59, 238, 239, 240, 
+    40, 241, 242, 243, 40, 244, 245, 246, 247, 248, 249, 250, 18, 18, 40, 251, 
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 252, 253, 254, 
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 
+    55, 55, 55, 55, 55, 55, 55, 55, 40, 40, 40, 40, 40, 40, 40, 40, 
+    40, 40, 40, 255, 40, 40, 256, 55, 257, 258, 259, 40, 40, 260, 261, 40, 
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 262, 214, 40, 263, 40, 264, 265, 
+    266, 267, 268, 269, 40, 40, 40, 270, 271, 2, 272, 273, 274, 141, 275, 276, 
+    277, 278, 279, 55, 40, 40, 40, 280, 55, 55, 40, 281, 55, 55, 55, 282, 
+    55, 55, 55, 55, 215, 40, 283, 152, 40, 284, 285, 286, 287, 40, 288, 55, 
+    29, 289, 290, 40, 287, 291, 292, 293, 40, 294, 40, 295, 55, 55, 55, 55, 
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 203, 140, 264, 55, 55, 55, 55, 
+    296, 297, 140, 203, 141, 55, 55, 298, 140, 256, 55, 55, 40, 299, 55, 55, 
+    300, 301, 302, 215, 215, 55, 106, 303, 40, 140, 140, 304, 260, 55, 55, 55, 
+    40, 40, 305, 55, 29, 306, 18, 307, 40, 308, 55, 55, 55, 55, 55, 55, 
+    55, 55, 55, 55, 40, 309, 55, 55, 215, 310, 311, 55, 55, 214, 312, 203, 
+    156, 313, 314, 315, 156, 316, 317, 318, 156, 319, 320, 321, 156, 238, 322, 55, 
+    323, 324, 55, 55, 325, 326, 327, 328, 329, 330, 331, 332, 55, 55, 55, 55, 
+    40, 333, 334, 335, 40, 46, 336, 55, 55, 55, 55, 55, 40, 337, 338, 55, 
+    40, 46, 339, 55, 40, 340, 135, 55, 122, 341, 55, 55, 55, 55, 55, 55, 
+    40, 342, 55, 55, 55, 29, 18, 343, 344, 345, 346, 55, 55, 347, 348, 349, 
+    350, 351, 352, 40, 353, 55, 40, 137, 55, 55, 55, 55, 55, 55, 55, 55, 
+    354, 355, 356, 357, 358, 359, 55, 55, 360, 361, 362, 363, 364, 135, 55, 55, 
+    55, 55, 55, 55, 55, 55, 55, 365, 55, 55, 55, 55, 55, 366, 55, 55, 
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 256, 55, 55, 55, 
+    40, 40, 40, 213, 40, 40, 40, 40, 40, 40, 295, 55, 55, 55, 55, 55, 
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 
+    40, 367, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 
+    40, 40, 368, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 
+    40, 137, 141, 369, 55, 55, 214, 370, 40, 371, 372, 373, 124, 55, 55, 55, 
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 
+    55, 55, 29, 18, 374, 55, 55, 55, 40, 40, 375, 23, 376, 55, 55, 377, 
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 378, 
+    40, 40, 40, 40, 40, 40, 140, 55, 305, 55, 55, 55, 55, 55, 55, 55, 
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 
+    40, 40, 40, 40, 40, 40, 40, 40, 141, 55, 379, 380, 40, 40, 40, 40, 
+    40, 40, 40, 40, 40, 40, 40, 254, 55, 55, 55, 55, 55, 55, 55, 55, 
+    40, 40, 40, 381, 382, 383, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 384, 385, 386, 55, 55, 
+    55, 55, 387, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 
+    388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 388, 389, 401, 
+    391, 402, 403, 404, 395, 405, 406, 407, 408, 409, 410, 197, 411, 412, 413, 414, 
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 
+    23, 415, 23, 416, 417, 418, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 
+    419, 420, 55, 55, 55, 55, 55, 55, 40, 421, 422, 55, 55, 55, 55, 55, 
+    55, 55, 55, 55, 55, 55, 40, 423, 55, 55, 55, 55, 55, 55, 55, 55, 
+    40, 40, 40, 40, 40, 40, 424, 55, 29, 425, 426, 55, 55, 55, 55, 55, 
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 
+    427, 428, 429, 430, 431, 432, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 433, 434, 434, 435, 55, 55, 55, 
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 
+    55, 55, 55, 436, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 437, 
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 
+    40, 40, 40, 40, 40, 40, 287, 55, 40, 40, 40, 40, 40, 40, 40, 40, 
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 281, 40, 40, 40, 40, 40, 40, 
+    287, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 
+    40, 40, 40, 40, 40, 438, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 439, 
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 
+    287, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 54, 55, 55, 55, 55, 55, 
+    440, 23, 23, 23, 55, 55, 55, 55, 23, 23, 23, 23, 23, 23, 23, 441, 
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55
+};
+static const uint8_t tmu_sentence_break_stage_three[7072] = {
+    0, 0, 0, 0, 96, 98, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    214, 14, 0, 224, 238, 0, 204, 11, 170, 170, 170, 170, 170, 12, 0, 208, 
+    128, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 232, 224, 0, 
+    112, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 231, 224, 0, 
+    0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    6, 0, 0, 0, 0, 231, 80, 0, 0, 0, 112, 0, 0, 231, 0, 0, 
+    136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 8, 136, 136, 136, 120, 
+    119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 7, 119, 119, 119, 119, 
+    120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 
+    120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 135, 135, 135, 135, 
+    135, 135, 135, 135, 119, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 
+    120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 136, 135, 135, 119, 
+    135, 120, 120, 136, 135, 136, 119, 136, 136, 135, 120, 136, 120, 119, 136, 135, 
+    120, 120, 120, 136, 135, 119, 120, 136, 135, 136, 135, 135, 120, 151, 120, 119, 
+    153, 153, 136, 135, 120, 136, 135, 135, 135, 135, 135, 135, 135, 135, 119, 120, 
+    120, 120, 120, 120, 120, 120, 120, 120, 135, 120, 120, 136, 120, 120, 120, 120, 
+    120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 119, 119, 119, 136, 135, 120, 
+    135, 135, 136, 120, 120, 120, 120, 120, 119, 119, 119, 119, 119, 119, 119, 119, 
+    119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 
+    119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 121, 119, 119, 119, 119, 119, 
+    119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 151, 153, 153, 153, 
+    119, 0, 0, 153, 153, 153, 153, 153, 153, 0, 0, 0, 0, 0, 0, 0, 
+    119, 119, 7, 0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 
+    51, 51, 51, 51, 51, 51, 51, 51, 120, 120, 9, 120, 0, 119, 119, 128, 
+    0, 0, 0, 8, 136, 8, 8, 136, 135, 136, 136, 136, 136, 136, 136, 136, 
+    136, 128, 136, 136, 136, 136, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 
+    119, 119, 119, 119, 119, 119, 119, 135, 119, 136, 120, 119, 120, 120, 120, 120, 
+    120, 120, 120, 120, 120, 120, 120, 120, 119, 119, 120, 128, 135, 120, 135, 136, 
+    136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 
+    136, 136, 136, 136, 136, 136, 136, 136, 119, 119, 119, 119, 119, 119, 119, 119, 
+    120, 48, 51, 51, 51, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 
+    136, 135, 135, 135, 135, 135, 135, 119, 120, 120, 120, 120, 120, 120, 120, 120, 
+    120, 120, 120, 120, 120, 120, 120, 120, 128, 136, 136, 136, 136, 136, 136, 136, 
+    136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 8, 144, 0, 192, 0, 
+    119, 119, 119, 119, 215, 0, 0, 0, 48, 51, 51, 51, 51, 51, 51, 51, 
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 48, 
+    48, 3, 51, 48, 0, 0, 0, 0, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 9, 0, 144, 153, 153, 0, 0, 0, 0, 0, 0, 
+    85, 85, 85, 0, 0, 0, 204, 0, 51, 51, 51, 51, 51, 3, 5, 221, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 57, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 
+    170, 170, 170, 170, 170, 160, 10, 153, 147, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 157, 51, 51, 51, 83, 48, 
+    51, 51, 147, 57, 3, 51, 51, 153, 170, 170, 170, 170, 170, 153, 9, 144, 
+    221, 13, 0, 0, 0, 0, 0, 80, 57, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 51, 51, 51, 51, 51, 51, 51, 51, 
+    51, 51, 51, 51, 51, 3, 144, 153, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 51, 51, 51, 51, 51, 147, 0, 0, 0, 0, 0, 0, 0, 
+    170, 170, 170, 170, 170, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 57, 51, 51, 51, 51, 153, 0, 220, 9, 48, 0, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 51, 51, 57, 51, 51, 
+    51, 51, 57, 51, 57, 51, 51, 0, 0, 0, 0, 208, 208, 0, 208, 13, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 57, 51, 0, 0, 
+    153, 153, 153, 153, 153, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 9, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 0, 0, 0, 0, 0, 48, 51, 51, 51, 51, 51, 51, 
+    51, 53, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 
+    51, 51, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 51, 147, 51, 
+    51, 51, 51, 51, 51, 51, 51, 51, 57, 51, 51, 51, 153, 153, 153, 153, 
+    153, 51, 221, 170, 170, 170, 170, 170, 144, 153, 153, 153, 153, 153, 153, 153, 
+    57, 51, 144, 153, 153, 153, 9, 144, 9, 144, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 9, 153, 153, 153, 9, 9, 0, 153, 153, 0, 147, 51, 
+    51, 51, 3, 48, 3, 48, 51, 9, 0, 0, 0, 48, 0, 0, 153, 144, 
+    153, 51, 0, 170, 170, 170, 170, 170, 153, 0, 0, 0, 0, 0, 9, 3, 
+    48, 51, 144, 153, 153, 9, 0, 144, 9, 144, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 9, 153, 153, 153, 9, 153, 144, 9, 153, 0, 3, 51, 
+    51, 3, 0, 48, 3, 48, 51, 0, 48, 0, 0, 0, 144, 153, 9, 9, 
+    0, 0, 0, 170, 170, 170, 170, 170, 51, 153, 57, 0, 0, 0, 0, 0, 
+    48, 51, 144, 153, 153, 153, 153, 144, 153, 144, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 9, 153, 153, 153, 9, 153, 144, 153, 153, 0, 147, 51, 
+    51, 51, 51, 48, 51, 48, 51, 0, 9, 0, 0, 0, 0, 0, 0, 0, 
+    153, 51, 0, 170, 170, 170, 170, 170, 0, 0, 0, 0, 144, 51, 51, 51, 
+    48, 51, 144, 153, 153, 153, 9, 144, 9, 144, 153, 153, 153, 153, 153, 153, 
+    51, 51, 3, 48, 3, 48, 51, 0, 0, 0, 48, 51, 0, 0, 153, 144, 
+    153, 51, 0, 170, 170, 170, 170, 170, 144, 0, 0, 0, 0, 0, 0, 0, 
+    0, 147, 144, 153, 153, 9, 0, 153, 9, 153, 153, 0, 144, 9, 9, 153, 
+    0, 144, 9, 0, 153, 9, 0, 153, 153, 153, 153, 153, 153, 0, 0, 51, 
+    51, 3, 0, 51, 3, 51, 51, 0, 9, 0, 0, 48, 0, 0, 0, 0, 
+    0, 0, 0, 170, 170, 170, 170, 170, 0, 0, 0, 0, 0, 0, 0, 0, 
+    51, 51, 147, 153, 153, 153, 9, 153, 9, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 9, 153, 153, 153, 153, 153, 153, 153, 153, 0, 144, 51, 
+    51, 51, 3, 51, 3, 51, 51, 0, 0, 0, 48, 3, 153, 9, 0, 0, 
+    153, 51, 0, 170, 170, 170, 170, 170, 0, 0, 0, 0, 0, 0, 0, 0, 
+    57, 51, 144, 153, 153, 153, 9, 153, 9, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 9, 153, 153, 153, 153, 153, 144, 153, 153, 0, 147, 51, 
+    51, 51, 3, 51, 3, 51, 51, 0, 0, 0, 48, 3, 0, 0, 0, 9, 
+    153, 51, 0, 170, 170, 170, 170, 170, 144, 9, 0, 0, 0, 0, 0, 0, 
+    51, 51, 153, 153, 153, 153, 9, 153, 9, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 57, 147, 51, 
+    51, 51, 3, 51, 3, 51, 51, 9, 0, 0, 153, 57, 0, 0, 0, 144, 
+    153, 51, 0, 170, 170, 170, 170, 170, 0, 0, 0, 0, 0, 153, 153, 153, 
+    48, 51, 144, 153, 153, 153, 153, 153, 153, 153, 153, 9, 0, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 144, 153, 153, 153, 153, 144, 0, 
+    153, 153, 153, 9, 0, 3, 0, 48, 51, 51, 3, 3, 51, 51, 51, 51, 
+    0, 0, 0, 170, 170, 170, 170, 170, 0, 51, 0, 0, 0, 0, 0, 0, 
+    144, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 57, 153, 51, 51, 51, 3, 0, 0, 
+    153, 153, 153, 57, 51, 51, 51, 3, 170, 170, 170, 170, 170, 0, 0, 0, 
+    144, 9, 9, 153, 153, 9, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 144, 144, 153, 153, 153, 153, 57, 153, 51, 51, 51, 51, 147, 0, 
+    153, 153, 9, 9, 51, 51, 51, 0, 170, 170, 170, 170, 170, 0, 153, 153, 
+    9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 0, 
+    170, 170, 170, 170, 170, 0, 0, 0, 0, 0, 48, 48, 48, 238, 238, 51, 
+    153, 153, 153, 153, 144, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 9, 0, 48, 51, 51, 51, 51, 51, 51, 51, 
+    51, 51, 3, 51, 153, 153, 57, 51, 51, 51, 51, 51, 48, 51, 51, 51, 
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 3, 0, 
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    153, 153, 153, 153, 153, 57, 51, 51, 51, 51, 51, 51, 51, 51, 51, 147, 
+    170, 170, 170, 170, 170, 221, 0, 0, 153, 153, 153, 51, 51, 153, 153, 51, 
+    147, 51, 147, 57, 51, 51, 51, 153, 57, 51, 147, 153, 153, 153, 153, 153, 
+    153, 51, 51, 51, 51, 51, 51, 57, 170, 170, 170, 170, 170, 51, 51, 0, 
+    136, 136, 136, 128, 0, 0, 128, 0, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 9, 153, 153, 
+    153, 153, 153, 153, 9, 153, 153, 0, 153, 153, 153, 9, 9, 153, 153, 0, 
+    153, 153, 153, 153, 9, 153, 153, 0, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 9, 153, 153, 0, 153, 153, 153, 9, 
+    9, 153, 153, 0, 153, 153, 153, 153, 153, 153, 153, 9, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 9, 153, 153, 0, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 9, 48, 51, 
+    0, 13, 0, 208, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    153, 153, 153, 153, 153, 153, 153, 153, 0, 0, 0, 0, 0, 0, 0, 0, 
+    136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 0, 119, 119, 119, 0, 
+    153, 153, 153, 153, 153, 153, 9, 157, 153, 153, 153, 153, 153, 153, 153, 153, 
+    150, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 233, 14, 0, 
+    153, 153, 153, 153, 153, 9, 0, 153, 153, 153, 153, 153, 9, 0, 0, 0, 
+    153, 153, 153, 153, 153, 153, 9, 153, 153, 51, 3, 0, 0, 0, 0, 0, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 51, 211, 13, 0, 0, 0, 0, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 51, 0, 0, 0, 0, 0, 0, 
+    153, 153, 153, 153, 153, 153, 9, 153, 9, 51, 0, 0, 0, 0, 0, 0, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 51, 51, 51, 51, 51, 51, 
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 0, 144, 0, 0, 57, 0, 
+    170, 170, 170, 170, 170, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 220, 0, 0, 220, 48, 51, 5, 170, 170, 170, 170, 170, 0, 0, 0, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 9, 0, 0, 0, 
+    153, 153, 57, 147, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 57, 9, 0, 0, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 0, 0, 0, 0, 0, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 9, 
+    51, 51, 51, 51, 51, 51, 0, 0, 51, 51, 51, 51, 51, 51, 0, 0, 
+    0, 0, 221, 170, 170, 170, 170, 170, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 0, 153, 153, 9, 0, 0, 0, 0, 0, 
+    153, 153, 153, 153, 153, 153, 0, 0, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 0, 0, 0, 170, 170, 170, 170, 170, 0, 0, 0, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 57, 51, 51, 0, 0, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 57, 51, 51, 51, 51, 3, 
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 3, 48, 
+    170, 170, 170, 170, 170, 0, 0, 0, 170, 170, 170, 170, 170, 0, 0, 0, 
+    0, 0, 0, 144, 221, 221, 0, 0, 51, 51, 51, 51, 51, 51, 51, 51, 
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    51, 51, 147, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 
+    51, 51, 147, 153, 153, 153, 0, 0, 170, 170, 170, 170, 170, 221, 0, 221, 
+    0, 0, 0, 0, 0, 48, 51, 51, 51, 51, 0, 0, 0, 0, 0, 0, 
+    51, 147, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 
+    57, 51, 51, 51, 51, 51, 51, 153, 170, 170, 170, 170, 170, 153, 153, 153, 
+    153, 153, 153, 51, 51, 51, 51, 51, 51, 51, 0, 0, 0, 0, 0, 0, 
+    153, 153, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 0, 208, 13, 0, 
+    170, 170, 170, 170, 170, 0, 144, 153, 170, 170, 170, 170, 170, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 221, 
+    119, 119, 119, 119, 7, 0, 0, 0, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 9, 144, 153, 
+    0, 0, 0, 0, 0, 0, 0, 0, 51, 3, 51, 51, 51, 51, 51, 51, 
+    51, 51, 51, 51, 147, 153, 57, 153, 153, 153, 147, 57, 51, 9, 0, 0, 
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 48, 51, 51, 
+    120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 119, 119, 119, 119, 120, 
+    119, 119, 119, 119, 136, 136, 136, 136, 119, 119, 119, 0, 136, 136, 136, 0, 
+    119, 119, 119, 119, 136, 136, 136, 136, 119, 119, 119, 119, 136, 136, 136, 136, 
+    119, 119, 119, 0, 136, 136, 136, 0, 119, 119, 119, 119, 128, 128, 128, 128, 
+    119, 119, 119, 119, 136, 136, 136, 136, 119, 119, 119, 119, 119, 119, 119, 0, 
+    119, 119, 119, 119, 136, 136, 136, 136, 119, 119, 7, 119, 136, 136, 8, 7, 
+    0, 119, 7, 119, 136, 136, 8, 0, 119, 119, 0, 119, 136, 136, 0, 0, 
+    119, 119, 119, 119, 136, 136, 8, 0, 0, 119, 7, 119, 136, 136, 8, 0, 
+    102, 102, 102, 102, 102, 86, 51, 85, 0, 192, 12, 0, 238, 238, 238, 238, 
+    0, 0, 11, 0, 68, 85, 85, 101, 0, 0, 0, 0, 224, 14, 221, 0, 
+    0, 0, 224, 222, 221, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 96, 
+    85, 85, 5, 85, 85, 85, 85, 85, 112, 0, 0, 0, 0, 0, 224, 126, 
+    0, 0, 0, 0, 0, 0, 224, 14, 119, 119, 119, 119, 119, 119, 7, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 51, 51, 51, 51, 51, 51, 51, 51, 
+    51, 51, 51, 51, 51, 51, 51, 51, 3, 0, 0, 0, 0, 0, 0, 0, 
+    0, 8, 0, 128, 0, 135, 136, 119, 136, 120, 128, 0, 128, 136, 136, 0, 
+    0, 0, 8, 8, 8, 136, 136, 112, 136, 136, 151, 153, 121, 0, 119, 136, 
+    0, 0, 128, 119, 119, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 
+    153, 137, 151, 153, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 238, 238, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 224, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 136, 136, 136, 136, 136, 
+    119, 119, 119, 119, 119, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 224, 238, 238, 
+    14, 0, 0, 0, 238, 238, 238, 238, 238, 238, 238, 0, 0, 0, 0, 0, 
+    0, 0, 224, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 238, 238, 238, 238, 238, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 224, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 14, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 238, 238, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 238, 0, 
+    136, 136, 136, 136, 136, 136, 136, 8, 119, 119, 119, 119, 119, 119, 119, 119, 
+    119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 7, 
+    120, 136, 120, 135, 135, 135, 135, 136, 120, 120, 135, 119, 119, 119, 119, 136, 
+    120, 120, 7, 0, 0, 128, 135, 55, 51, 120, 0, 0, 0, 0, 0, 0, 
+    119, 119, 119, 112, 0, 0, 112, 0, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 0, 0, 0, 144, 0, 0, 0, 0, 0, 0, 0, 48, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 9, 0, 0, 0, 0, 
+    153, 153, 153, 9, 153, 153, 153, 9, 153, 153, 153, 9, 153, 153, 153, 9, 
+    238, 238, 238, 238, 238, 238, 238, 0, 0, 0, 0, 0, 0, 0, 238, 0, 
+    238, 238, 238, 238, 238, 0, 0, 157, 0, 0, 0, 0, 0, 0, 13, 0, 
+    0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    198, 13, 144, 153, 238, 238, 238, 238, 238, 0, 238, 238, 238, 238, 224, 238, 
+    144, 153, 153, 153, 153, 51, 51, 51, 144, 153, 153, 0, 153, 153, 9, 0, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 9, 48, 3, 144, 153, 
+    0, 0, 144, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 144, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 9, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 9, 0, 
+    153, 153, 153, 153, 153, 153, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 208, 
+    153, 153, 153, 153, 153, 153, 9, 221, 153, 153, 153, 153, 153, 153, 153, 153, 
+    170, 170, 170, 170, 170, 153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    120, 120, 120, 120, 120, 120, 120, 57, 51, 3, 51, 51, 51, 51, 51, 144, 
+    120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 119, 51, 
+    153, 153, 153, 153, 153, 153, 153, 153, 51, 208, 0, 208, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 153, 153, 153, 153, 
+    0, 120, 120, 120, 120, 120, 120, 120, 119, 120, 120, 120, 120, 120, 120, 120, 
+    120, 120, 120, 120, 120, 120, 120, 120, 119, 119, 119, 119, 135, 135, 135, 120, 
+    120, 120, 120, 120, 9, 128, 135, 151, 120, 120, 119, 120, 120, 120, 120, 120, 
+    120, 120, 120, 120, 120, 136, 136, 120, 136, 136, 120, 120, 120, 120, 120, 120, 
+    0, 120, 136, 136, 135, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 151, 119, 151, 153, 153, 
+    153, 147, 153, 147, 153, 57, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 57, 51, 51, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 0, 221, 0, 0, 0, 0, 
+    51, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 
+    51, 51, 51, 0, 0, 0, 0, 221, 170, 170, 170, 170, 170, 0, 0, 0, 
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 153, 153, 153, 0, 144, 144, 57, 
+    153, 153, 153, 51, 51, 51, 51, 208, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 57, 51, 51, 51, 51, 51, 51, 0, 0, 0, 0, 0, 0, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 57, 51, 51, 51, 51, 51, 51, 
+    3, 0, 0, 0, 221, 0, 0, 144, 170, 170, 170, 170, 170, 0, 0, 0, 
+    153, 153, 57, 153, 153, 153, 153, 153, 170, 170, 170, 170, 170, 153, 153, 9, 
+    153, 153, 153, 153, 57, 51, 51, 51, 51, 51, 51, 3, 0, 0, 0, 0, 
+    153, 57, 153, 153, 153, 153, 51, 0, 170, 170, 170, 170, 170, 0, 208, 221, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 9, 0, 57, 51, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 147, 51, 147, 57, 147, 153, 153, 51, 
+    57, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 153, 0, 
+    153, 153, 153, 153, 153, 57, 51, 51, 221, 153, 57, 3, 0, 0, 0, 0, 
+    144, 153, 153, 9, 144, 153, 153, 9, 144, 153, 153, 9, 0, 0, 0, 0, 
+    153, 153, 153, 9, 153, 153, 153, 9, 119, 119, 119, 119, 119, 119, 119, 119, 
+    119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 7, 119, 119, 
+    119, 119, 119, 119, 151, 0, 0, 0, 119, 119, 119, 119, 119, 119, 119, 119, 
+    153, 57, 51, 51, 51, 211, 51, 0, 170, 170, 170, 170, 170, 0, 0, 0, 
+    153, 153, 0, 0, 0, 0, 0, 0, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 9, 0, 144, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 0, 0, 
+    153, 153, 153, 153, 153, 153, 153, 0, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 0, 0, 0, 
+    119, 119, 119, 7, 0, 0, 0, 0, 0, 112, 119, 119, 0, 0, 144, 147, 
+    153, 153, 153, 153, 9, 153, 153, 153, 153, 153, 153, 9, 153, 153, 9, 9, 
+    153, 144, 9, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 238, 
+    153, 153, 153, 153, 153, 153, 153, 153, 0, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 153, 153, 153, 153, 153, 153, 0, 0, 
+    51, 51, 51, 51, 51, 51, 51, 51, 204, 192, 0, 224, 14, 0, 0, 0, 
+    51, 51, 51, 51, 51, 51, 51, 51, 192, 12, 224, 238, 238, 238, 238, 238, 
+    238, 238, 14, 224, 14, 0, 0, 0, 204, 11, 192, 221, 236, 238, 238, 14, 
+    0, 192, 0, 0, 0, 0, 0, 0, 153, 153, 9, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 9, 80, 
+    208, 0, 0, 0, 238, 0, 204, 11, 170, 170, 170, 170, 170, 12, 0, 208, 
+    112, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 231, 224, 224, 
+    222, 238, 12, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 51, 
+    0, 153, 153, 153, 0, 153, 153, 153, 0, 153, 153, 153, 0, 153, 9, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 85, 0, 0, 
+    153, 153, 153, 153, 153, 153, 144, 153, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 9, 153, 153, 153, 153, 153, 153, 153, 153, 153, 9, 153, 144, 
+    153, 153, 153, 153, 153, 153, 153, 0, 153, 153, 153, 153, 153, 153, 153, 0, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 9, 0, 0, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 9, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 
+    153, 153, 153, 153, 153, 153, 153, 153, 9, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 144, 153, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 9, 0, 0, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 51, 51, 3, 0, 0, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 0, 
+    153, 153, 0, 0, 153, 153, 153, 153, 144, 153, 153, 0, 0, 0, 0, 0, 
+    136, 136, 136, 136, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 
+    119, 119, 119, 119, 119, 119, 119, 119, 153, 153, 153, 153, 153, 153, 153, 153, 
+    170, 170, 170, 170, 170, 0, 0, 0, 136, 136, 136, 136, 136, 136, 136, 136, 
+    136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 0, 0, 119, 119, 119, 119, 
+    119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 0, 0, 
+    153, 153, 153, 153, 0, 0, 0, 0, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    153, 153, 153, 0, 9, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 144, 9, 0, 9, 144, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 9, 153, 0, 0, 0, 0, 0, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 0, 0, 0, 153, 
+    57, 51, 48, 3, 0, 0, 51, 51, 153, 153, 144, 153, 144, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 0, 51, 3, 0, 48, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 221, 0, 0, 0, 0, 
+    153, 153, 57, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 9, 0, 0, 0, 0, 0, 0, 
+    153, 153, 153, 153, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    136, 136, 136, 136, 136, 136, 136, 136, 136, 8, 0, 0, 0, 0, 0, 0, 
+    119, 119, 119, 119, 119, 119, 119, 119, 119, 7, 0, 0, 0, 0, 0, 0, 
+    153, 153, 51, 51, 0, 0, 0, 0, 170, 170, 170, 170, 170, 0, 0, 0, 
+    153, 153, 153, 153, 153, 48, 3, 0, 153, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 144, 0, 0, 0, 0, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 51, 51, 51, 51, 51, 3, 0, 208, 221, 221, 0, 0, 0, 
+    153, 153, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 51, 51, 51, 51, 
+    51, 51, 51, 211, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 170, 170, 170, 170, 170, 0, 0, 0, 0, 0, 0, 0, 48, 
+    153, 153, 153, 153, 153, 153, 153, 153, 51, 51, 51, 51, 51, 3, 80, 221, 
+    221, 0, 0, 0, 0, 0, 80, 0, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 9, 0, 0, 0, 170, 170, 170, 170, 170, 0, 0, 0, 
+    153, 153, 153, 57, 51, 51, 51, 51, 51, 51, 3, 170, 170, 170, 170, 170, 
+    208, 221, 57, 147, 0, 0, 0, 0, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 57, 0, 9, 0, 0, 0, 0, 
+    147, 153, 217, 13, 48, 51, 211, 51, 170, 170, 170, 170, 170, 9, 9, 221, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 144, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 51, 51, 51, 51, 51, 51, 221, 208, 13, 3, 
+    153, 153, 153, 9, 9, 153, 153, 144, 153, 153, 153, 153, 153, 153, 153, 144, 
+    153, 153, 153, 153, 217, 0, 0, 0, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 57, 
+    51, 51, 51, 51, 51, 3, 0, 0, 170, 170, 170, 170, 170, 0, 0, 0, 
+    51, 51, 144, 153, 153, 153, 9, 144, 9, 144, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 9, 153, 153, 153, 9, 153, 144, 153, 153, 48, 147, 51, 
+    51, 51, 3, 48, 3, 48, 51, 0, 9, 0, 0, 48, 0, 0, 144, 153, 
+    153, 51, 0, 51, 51, 51, 3, 0, 51, 51, 3, 0, 0, 0, 0, 0, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 57, 51, 51, 51, 51, 51, 
+    51, 51, 51, 147, 153, 217, 13, 0, 170, 170, 170, 170, 170, 0, 0, 147, 
+    153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    51, 51, 153, 144, 0, 0, 0, 0, 170, 170, 170, 170, 170, 0, 0, 0, 
+    153, 153, 153, 153, 153, 153, 153, 57, 51, 51, 51, 0, 51, 51, 51, 51, 
+    3, 221, 0, 0, 208, 221, 221, 221, 221, 221, 221, 221, 153, 153, 51, 0, 
+    211, 13, 9, 0, 0, 0, 0, 0, 170, 170, 170, 170, 170, 0, 0, 0, 
+    153, 153, 153, 153, 153, 57, 51, 51, 51, 51, 51, 51, 9, 0, 0, 0, 
+    51, 51, 51, 51, 51, 51, 0, 0, 170, 170, 170, 170, 170, 0, 221, 13, 
+    153, 153, 153, 153, 153, 153, 51, 51, 51, 51, 51, 51, 51, 3, 0, 0, 
+    170, 170, 170, 170, 170, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 
+    153, 153, 153, 9, 144, 0, 153, 153, 153, 153, 144, 9, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 51, 51, 51, 48, 3, 48, 51, 147, 
+    147, 51, 13, 13, 0, 0, 0, 0, 170, 170, 170, 170, 170, 0, 0, 0, 
+    153, 153, 153, 153, 0, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 57, 51, 51, 51, 0, 51, 51, 51, 
+    147, 144, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    57, 51, 51, 51, 51, 147, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 57, 51, 51, 51, 57, 51, 3, 
+    0, 221, 0, 48, 0, 0, 0, 0, 57, 51, 51, 51, 51, 51, 153, 153, 
+    153, 153, 153, 153, 153, 51, 51, 51, 51, 51, 51, 51, 51, 208, 157, 0, 
+    153, 153, 153, 153, 9, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 57, 51, 51, 51, 3, 51, 51, 51, 51, 
+    217, 13, 0, 0, 0, 0, 0, 0, 170, 170, 170, 170, 170, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 0, 51, 51, 51, 51, 51, 51, 51, 
+    51, 51, 51, 51, 48, 51, 51, 51, 51, 51, 51, 3, 0, 0, 0, 0, 
+    153, 153, 153, 9, 153, 144, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 153, 153, 153, 57, 51, 51, 3, 0, 3, 51, 48, 
+    51, 51, 51, 57, 0, 0, 0, 0, 170, 170, 170, 170, 170, 0, 0, 0, 
+    153, 153, 153, 144, 9, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 51, 51, 3, 51, 48, 51, 51, 9, 0, 0, 0, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 57, 51, 211, 13, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 
+    153, 153, 153, 153, 153, 153, 153, 9, 85, 85, 85, 85, 5, 0, 0, 0, 
+    153, 153, 153, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    170, 170, 170, 170, 170, 0, 0, 221, 0, 0, 0, 0, 0, 0, 0, 0, 
+    153, 153, 153, 153, 153, 153, 153, 0, 51, 51, 211, 0, 0, 0, 0, 0, 
+    153, 153, 153, 153, 153, 153, 153, 153, 51, 51, 51, 211, 13, 0, 0, 0, 
+    153, 153, 13, 0, 0, 0, 0, 0, 170, 170, 170, 170, 170, 0, 0, 0, 
+    0, 144, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 0, 0, 144, 153, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 
+    153, 153, 153, 153, 153, 9, 0, 48, 57, 51, 51, 51, 51, 51, 51, 51, 
+    51, 51, 51, 51, 0, 0, 0, 48, 51, 147, 153, 153, 153, 153, 153, 153, 
+    153, 144, 3, 0, 0, 0, 0, 0, 51, 0, 0, 0, 0, 0, 0, 0, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 153, 9, 0, 0, 0, 0, 0, 0, 
+    0, 0, 153, 153, 0, 0, 0, 0, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 153, 9, 0, 0, 153, 153, 153, 153, 153, 153, 9, 0, 
+    153, 153, 153, 153, 9, 0, 0, 0, 153, 153, 153, 153, 153, 0, 48, 211, 
+    85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 48, 51, 51, 0, 48, 51, 51, 83, 85, 85, 85, 53, 51, 51, 
+    51, 3, 48, 51, 51, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 51, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 51, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 119, 119, 119, 
+    119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 136, 136, 136, 136, 136, 136, 
+    136, 136, 136, 136, 136, 136, 136, 119, 119, 119, 7, 119, 119, 119, 119, 119, 
+    119, 119, 119, 119, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 
+    136, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 8, 136, 
+    0, 8, 128, 8, 128, 136, 8, 136, 136, 136, 136, 119, 119, 112, 112, 119, 
+    119, 119, 112, 119, 119, 119, 119, 119, 136, 136, 136, 136, 136, 136, 136, 136, 
+    136, 136, 136, 136, 136, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 
+    119, 119, 136, 128, 136, 8, 128, 136, 136, 136, 8, 136, 136, 136, 8, 119, 
+    119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 136, 128, 136, 8, 
+    136, 136, 8, 8, 0, 136, 136, 136, 8, 119, 119, 119, 119, 119, 119, 119, 
+    119, 119, 119, 119, 119, 119, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 
+    136, 136, 136, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 
+    136, 136, 136, 136, 136, 136, 136, 119, 119, 119, 119, 119, 119, 119, 119, 119, 
+    136, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 136, 136, 
+    136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 119, 119, 119, 119, 119, 
+    119, 119, 119, 119, 119, 119, 119, 119, 136, 136, 136, 136, 136, 136, 136, 136, 
+    119, 119, 119, 0, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 
+    8, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 7, 119, 119, 
+    119, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 8, 119, 119, 
+    119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 7, 119, 119, 119, 136, 136, 
+    136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 8, 119, 119, 119, 119, 119, 
+    119, 119, 119, 119, 119, 119, 119, 7, 119, 119, 119, 136, 136, 136, 136, 136, 
+    119, 119, 119, 119, 7, 119, 119, 119, 136, 136, 136, 136, 136, 136, 136, 136, 
+    136, 136, 136, 136, 8, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 
+    119, 7, 119, 119, 119, 120, 0, 170, 170, 170, 170, 170, 170, 170, 170, 170, 
+    170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 3, 0, 48, 51, 51, 
+    51, 51, 51, 51, 51, 51, 3, 0, 0, 0, 48, 0, 0, 0, 0, 0, 
+    0, 0, 3, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 48, 51, 51, 
+    48, 51, 51, 51, 51, 51, 51, 51, 0, 0, 0, 0, 0, 0, 0, 0, 
+    51, 51, 51, 3, 51, 51, 51, 51, 51, 51, 51, 51, 3, 48, 51, 51, 
+    51, 48, 3, 51, 51, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    153, 153, 153, 153, 153, 153, 9, 0, 51, 51, 51, 147, 153, 153, 153, 0, 
+    170, 170, 170, 170, 170, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 
+    153, 153, 153, 153, 153, 153, 51, 51, 170, 170, 170, 170, 170, 0, 0, 0, 
+    153, 153, 9, 0, 0, 0, 0, 0, 51, 51, 51, 3, 0, 0, 0, 0, 
+    136, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 
+    119, 119, 51, 51, 51, 147, 0, 0, 170, 170, 170, 170, 170, 0, 0, 0, 
+    153, 153, 144, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 
+    144, 9, 9, 144, 144, 153, 153, 153, 153, 9, 153, 153, 144, 144, 0, 0, 
+    0, 9, 0, 144, 144, 144, 144, 153, 144, 9, 9, 144, 144, 144, 144, 144, 
+    144, 9, 9, 144, 153, 9, 153, 153, 153, 9, 153, 153, 144, 153, 9, 9, 
+    153, 153, 153, 153, 153, 144, 153, 153, 153, 153, 153, 153, 153, 153, 0, 0, 
+    144, 153, 144, 153, 153, 144, 153, 153, 153, 153, 153, 153, 153, 153, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 136, 136, 136, 136, 136, 136, 136, 136, 
+    136, 136, 136, 136, 136, 0, 0, 0, 136, 136, 136, 136, 136, 136, 136, 136, 
+    136, 136, 136, 136, 136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 238, 14, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 170, 170, 170, 170, 170, 0, 0, 0, 
+    153, 0, 0, 0, 0, 0, 0, 0, 153, 153, 153, 153, 153, 153, 153, 153, 
+    9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    51, 51, 51, 51, 51, 51, 51, 51, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static uint32_t tmu_get_sentence_break_property_internal(uint32_t cp) {
+    if (cp > 0x10FFFF) return 0;
+    uint32_t block_index = ((uint32_t)tmu_sentence_break_stage_one[cp >> 10] << 5) + ((cp >> 5) & 31);
+    uint32_t offset = cp & 31;
+    uint32_t value = tmu_sentence_break_stage_three[(uint32_t)tmu_sentence_break_stage_two[block_index] * 16 + (offset >> 1)];
+    return (value >> ((offset & 1) * 4)) & 15;
+}
+
+/* Per-property table for category: 12288 bytes. */
+static const uint8_t tmu_category_stage_one[1088] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 14, 
+    14, 14, 14, 15, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 16, 17, 18, 19, 13, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 20, 14, 14, 14, 14, 14, 14, 14, 14, 21, 22, 
+    23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 14, 14, 17, 33, 14, 14, 
+    14, 34, 14, 14, 14, 14, 14, 14, 14, 14, 35, 36, 13, 14, 14, 14, 
+    14, 37, 17, 38, 14, 14, 14, 14, 14, 14, 14, 14, 39, 14, 14, 40, 
+    14, 14, 14, 14, 41, 42, 43, 14, 44, 14, 45, 46, 47, 48, 49, 14, 
+    13, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 50, 14, 14, 14, 51, 52, 14, 
+    14, 14, 14, 53, 14, 14, 14, 14, 14, 14, 54, 14, 14, 14, 55, 14, 
+    13, 14, 14, 14, 56, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    57, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14
+};
+static const uint16_t tmu_category_stage_two[1856] = {
+    0, 1, 2, 3, 0, 4, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 
+    6, 6, 6, 6, 6, 6, 7, 8, 9, 9, 9, 10, 11, 12, 6, 13, 
+    6, 6, 6, 6, 14, 6, 6, 6, 6, 15, 16, 6, 17, 18, 19, 20, 
+    21, 6, 22, 23, 6, 6, 24, 25, 26, 27, 28, 6, 6, 29, 30, 31, 
+    32, 33, 34, 35, 0, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 
+    47, 48, 49, 50, 51, 52, 53, 54, 55, 52, 56, 57, 58, 59, 60, 61, 
+    62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 
+    78, 79, 80, 0, 81, 82, 83, 0, 84, 85, 86, 87, 88, 89, 90, 0, 
+    6, 91, 92, 93, 94, 6, 95, 96, 6, 6, 6, 6, 6, 6, 6, 6, 
+    6, 6, 97, 6, 98, 99, 100, 6, 101, 6, 102, 103, 104, 6, 6, 105, 
+    106, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 
+    6, 6, 6, 107, 108, 6, 6, 109, 110, 111, 112, 113, 6, 114, 115, 116, 
+    117, 6, 6, 118, 119, 120, 6, 121, 122, 123, 124, 125, 6, 126, 127, 128, 
+    129, 6, 130, 131, 116, 132, 133, 0, 134, 114, 135, 136, 137, 138, 6, 139, 
+    6, 140, 141, 142, 143, 144, 145, 146, 6, 6, 6, 6, 6, 6, 9, 147, 
+    6, 6, 6, 6, 6, 6, 6, 6, 105, 6, 148, 149, 6, 150, 151, 152, 
+    153, 154, 155, 156, 157, 128, 158, 159, 160, 161, 162, 163, 164, 128, 128, 128, 
+    128, 128, 128, 128, 128, 128, 128, 128, 165, 166, 128, 128, 128, 128, 128, 128, 
+    128, 167, 168, 163, 169, 128, 128, 170, 128, 128, 128, 128, 128, 128, 128, 128, 
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 171, 172, 128, 173, 174, 
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 175, 128, 176, 177, 
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 178, 179, 128, 128, 128, 
+    6, 180, 122, 6, 6, 6, 6, 181, 6, 95, 6, 182, 183, 184, 184, 9, 
+    185, 186, 187, 0, 188, 128, 128, 189, 128, 128, 128, 128, 128, 128, 190, 191, 
+    192, 193, 78, 6, 194, 106, 6, 96, 195, 15, 6, 6, 196, 6, 128, 197, 
+    198, 199, 200, 128, 199, 201, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
+    202, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 203, 128, 128, 
+    202, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 204, 
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 
+    6, 6, 6, 6, 205, 128, 206, 142, 6, 6, 6, 6, 6, 6, 6, 6, 
+    207, 208, 6, 209, 210, 6, 6, 211, 212, 213, 6, 6, 214, 6, 215, 216, 
+    217, 218, 6, 219, 220, 114, 221, 222, 30, 223, 224, 225, 39, 226, 227, 228, 
+    6, 229, 230, 231, 6, 232, 233, 234, 235, 236, 237, 238, 6, 6, 6, 239, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 240, 241, 242, 
+    0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 
+    6, 6, 6, 243, 6, 6, 244, 0, 245, 246, 247, 6, 6, 248, 249, 6, 
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 142, 250, 6, 251, 6, 252, 253, 
+    254, 255, 256, 257, 6, 6, 6, 225, 258, 2, 259, 260, 6, 122, 261, 262, 
+    263, 264, 265, 0, 6, 6, 6, 266, 267, 268, 163, 269, 270, 271, 272, 273, 
+    0, 0, 0, 0, 225, 6, 274, 275, 6, 276, 277, 278, 279, 6, 280, 0, 
+    6, 6, 6, 6, 149, 281, 282, 242, 6, 283, 6, 284, 0, 0, 0, 0, 
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 183, 121, 252, 0, 0, 0, 0, 
+    285, 286, 287, 288, 122, 289, 0, 290, 291, 292, 0, 0, 6, 293, 294, 163, 
+    295, 296, 297, 298, 299, 0, 300, 301, 6, 302, 303, 304, 305, 306, 0, 0, 
+    6, 6, 307, 0, 6, 308, 6, 309, 6, 310, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 311, 6, 312, 0, 0, 299, 313, 314, 0, 0, 250, 315, 183, 
+    137, 316, 317, 318, 137, 319, 320, 321, 137, 322, 323, 324, 137, 226, 325, 326, 
+    327, 328, 0, 0, 329, 330, 331, 332, 333, 334, 335, 336, 0, 0, 0, 0, 
+    6, 337, 338, 339, 6, 27, 340, 0, 0, 0, 0, 0, 6, 341, 342, 0, 
+    6, 27, 343, 344, 6, 345, 346, 0, 102, 347, 0, 0, 0, 0, 0, 0, 
+    6, 348, 0, 0, 0, 6, 6, 349, 350, 351, 352, 0, 0, 353, 354, 355, 
+    356, 357, 358, 6, 359, 360, 6, 118, 0, 0, 0, 0, 0, 0, 0, 0, 
+    361, 362, 363, 364, 365, 366, 0, 0, 367, 368, 369, 370, 371, 346, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 372, 0, 0, 0, 0, 0, 373, 374, 375, 
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 244, 0, 0, 0, 
+    163, 163, 163, 376, 6, 6, 6, 6, 6, 6, 377, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    6, 378, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 
+    6, 6, 379, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 
+    6, 118, 122, 380, 0, 0, 250, 381, 6, 382, 383, 384, 385, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 6, 6, 386, 0, 0, 0, 6, 6, 387, 9, 388, 0, 0, 389, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 390, 
+    6, 6, 6, 6, 6, 6, 121, 0, 391, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    6, 6, 6, 6, 6, 6, 6, 6, 122, 0, 392, 393, 6, 6, 6, 6, 
+    6, 6, 6, 6, 6, 6, 6, 242, 0, 0, 0, 0, 0, 0, 0, 0, 
+    6, 6, 6, 394, 395, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    128, 128, 128, 128, 128, 128, 128, 190, 128, 396, 128, 397, 398, 399, 128, 400, 
+    128, 128, 401, 0, 0, 0, 0, 402, 128, 128, 403, 404, 0, 0, 0, 0, 
+    6, 6, 36, 6, 405, 406, 407, 6, 408, 409, 410, 6, 6, 6, 6, 6, 
+    6, 6, 6, 6, 6, 411, 412, 237, 413, 413, 414, 414, 415, 415, 416, 163, 
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
+    9, 417, 9, 418, 419, 420, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    421, 422, 0, 0, 0, 0, 0, 0, 6, 423, 424, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 6, 425, 0, 0, 0, 0, 0, 0, 0, 0, 
+    6, 6, 6, 6, 6, 6, 426, 0, 6, 6, 427, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 428, 163, 429, 0, 0, 430, 431, 0, 0, 0, 0, 0, 0, 
+    407, 432, 433, 434, 435, 436, 0, 437, 0, 0, 0, 0, 0, 0, 0, 0, 
+    128, 438, 128, 128, 189, 439, 440, 190, 441, 128, 128, 128, 128, 442, 0, 443, 
+    444, 445, 446, 447, 0, 0, 0, 0, 128, 128, 128, 128, 128, 128, 128, 128, 
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
+    128, 128, 128, 128, 128, 128, 448, 449, 128, 128, 128, 189, 128, 128, 450, 451, 
+    438, 128, 452, 128, 453, 454, 0, 0, 128, 128, 128, 455, 128, 128, 456, 128, 
+    128, 128, 189, 457, 458, 459, 460, 0, 128, 128, 128, 128, 461, 128, 168, 462, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 463, 0, 202, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 464, 202, 0, 0, 0, 0, 0, 
+    463, 202, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 202, 
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 
+    149, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 466, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 467, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+static const uint8_t tmu_category_stage_three[7488] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    70, 68, 69, 68, 68, 84, 68, 68, 51, 51, 51, 51, 51, 68, 85, 69, 
+    20, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 65, 68, 69, 
+    21, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 65, 69, 5, 
+    70, 85, 85, 69, 85, 65, 5, 85, 85, 51, 21, 68, 53, 65, 51, 67, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 81, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 85, 85, 17, 17, 17, 17, 17, 17, 85, 85, 85, 85, 85, 85, 85, 
+    17, 17, 81, 85, 85, 85, 81, 81, 85, 85, 85, 85, 85, 85, 85, 85, 
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 
+    34, 34, 34, 34, 34, 34, 34, 34, 17, 17, 81, 17, 0, 17, 17, 20, 
+    0, 0, 85, 65, 17, 1, 1, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 21, 17, 17, 17, 17, 
+    17, 37, 34, 34, 34, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 16, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 1, 16, 68, 68, 68, 
+    17, 17, 17, 17, 65, 4, 80, 85, 32, 34, 34, 34, 34, 34, 34, 34, 
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 36, 
+    36, 66, 34, 36, 0, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 1, 0, 16, 17, 65, 4, 0, 0, 0, 0, 0, 
+    0, 0, 0, 85, 69, 84, 68, 85, 34, 34, 34, 34, 34, 66, 0, 68, 
+    17, 17, 17, 17, 17, 33, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 
+    51, 51, 51, 51, 51, 68, 68, 17, 18, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 20, 34, 34, 34, 2, 37, 
+    34, 34, 18, 33, 82, 34, 34, 17, 51, 51, 51, 51, 51, 17, 81, 21, 
+    68, 68, 68, 68, 68, 68, 68, 0, 33, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 34, 34, 34, 34, 34, 34, 34, 34, 
+    34, 34, 34, 34, 34, 2, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 34, 34, 34, 34, 34, 18, 0, 0, 0, 0, 0, 0, 0, 
+    51, 51, 51, 51, 51, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 33, 34, 34, 34, 34, 17, 69, 68, 1, 32, 85, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 34, 34, 33, 34, 34, 
+    34, 34, 33, 34, 33, 34, 34, 0, 68, 68, 68, 68, 68, 68, 68, 4, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 33, 34, 0, 4, 
+    17, 17, 17, 17, 17, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 1, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 0, 0, 0, 0, 0, 32, 34, 34, 34, 34, 34, 34, 
+    34, 32, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 
+    34, 34, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 34, 18, 34, 
+    34, 34, 34, 34, 34, 34, 34, 34, 33, 34, 34, 34, 17, 17, 17, 17, 
+    17, 34, 68, 51, 51, 51, 51, 51, 20, 17, 17, 17, 17, 17, 17, 17, 
+    33, 34, 16, 17, 17, 17, 1, 16, 1, 16, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 1, 17, 17, 17, 1, 1, 0, 17, 17, 0, 18, 34, 
+    34, 34, 2, 32, 2, 32, 34, 1, 0, 0, 0, 32, 0, 0, 17, 16, 
+    17, 34, 0, 51, 51, 51, 51, 51, 17, 85, 51, 51, 51, 85, 65, 2, 
+    32, 34, 16, 17, 17, 1, 0, 16, 1, 16, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 1, 17, 17, 17, 1, 17, 16, 1, 17, 0, 2, 34, 
+    34, 2, 0, 32, 2, 32, 34, 0, 32, 0, 0, 0, 16, 17, 1, 1, 
+    0, 0, 0, 51, 51, 51, 51, 51, 34, 17, 33, 4, 0, 0, 0, 0, 
+    32, 34, 16, 17, 17, 17, 17, 16, 17, 16, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 1, 17, 17, 17, 1, 17, 16, 17, 17, 0, 18, 34, 
+    34, 34, 34, 32, 34, 32, 34, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    17, 34, 0, 51, 51, 51, 51, 51, 84, 0, 0, 0, 16, 34, 34, 34, 
+    32, 34, 16, 17, 17, 17, 1, 16, 1, 16, 17, 17, 17, 17, 17, 17, 
+    34, 34, 2, 32, 2, 32, 34, 0, 0, 0, 32, 34, 0, 0, 17, 16, 
+    17, 34, 0, 51, 51, 51, 51, 51, 21, 51, 51, 51, 0, 0, 0, 0, 
+    0, 18, 16, 17, 17, 1, 0, 17, 1, 17, 17, 0, 16, 1, 1, 17, 
+    0, 16, 1, 0, 17, 1, 0, 17, 17, 17, 17, 17, 17, 0, 0, 34, 
+    34, 2, 0, 34, 2, 34, 34, 0, 1, 0, 0, 32, 0, 0, 0, 0, 
+    0, 0, 0, 51, 51, 51, 51, 51, 51, 83, 85, 85, 85, 5, 0, 0, 
+    34, 34, 18, 17, 17, 17, 1, 17, 1, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 1, 17, 17, 17, 17, 17, 17, 17, 17, 0, 16, 34, 
+    34, 34, 2, 34, 2, 34, 34, 0, 0, 0, 32, 2, 17, 1, 0, 0, 
+    17, 34, 0, 51, 51, 51, 51, 51, 0, 0, 0, 64, 51, 51, 51, 83, 
+    33, 34, 20, 17, 17, 17, 1, 17, 1, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 1, 17, 17, 17, 17, 17, 16, 17, 17, 0, 18, 34, 
+    34, 34, 2, 34, 2, 34, 34, 0, 0, 0, 32, 2, 0, 0, 0, 1, 
+    17, 34, 0, 51, 51, 51, 51, 51, 16, 1, 0, 0, 0, 0, 0, 0, 
+    34, 34, 17, 17, 17, 17, 1, 17, 1, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 33, 18, 34, 
+    34, 34, 2, 34, 2, 34, 34, 81, 0, 0, 17, 33, 51, 51, 51, 19, 
+    17, 34, 0, 51, 51, 51, 51, 51, 51, 51, 51, 51, 83, 17, 17, 17, 
+    32, 34, 16, 17, 17, 17, 17, 17, 17, 17, 17, 1, 0, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 16, 17, 17, 17, 17, 16, 0, 
+    17, 17, 17, 1, 0, 2, 0, 32, 34, 34, 2, 2, 34, 34, 34, 34, 
+    0, 0, 0, 51, 51, 51, 51, 51, 0, 34, 4, 0, 0, 0, 0, 0, 
+    16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 33, 17, 34, 34, 34, 2, 0, 80, 
+    17, 17, 17, 33, 34, 34, 34, 66, 51, 51, 51, 51, 51, 68, 0, 0, 
+    16, 1, 1, 17, 17, 1, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 16, 16, 17, 17, 17, 17, 33, 17, 34, 34, 34, 34, 18, 0, 
+    17, 17, 1, 1, 34, 34, 34, 0, 51, 51, 51, 51, 51, 0, 17, 17, 
+    81, 85, 68, 68, 68, 68, 68, 68, 68, 84, 84, 85, 34, 85, 85, 85, 
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 37, 37, 37, 68, 68, 34, 
+    17, 17, 17, 17, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 1, 0, 32, 34, 34, 34, 34, 34, 34, 34, 
+    34, 34, 66, 34, 17, 17, 33, 34, 34, 34, 34, 34, 32, 34, 34, 34, 
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 2, 85, 
+    85, 85, 85, 82, 85, 85, 5, 85, 68, 68, 84, 85, 69, 4, 0, 0, 
+    17, 17, 17, 17, 17, 33, 34, 34, 34, 34, 34, 34, 34, 34, 34, 18, 
+    51, 51, 51, 51, 51, 68, 68, 68, 17, 17, 17, 34, 34, 17, 17, 34, 
+    18, 34, 18, 33, 34, 34, 34, 17, 33, 34, 18, 17, 17, 17, 17, 17, 
+    17, 34, 34, 34, 34, 34, 34, 33, 51, 51, 51, 51, 51, 34, 34, 85, 
+    17, 17, 17, 16, 0, 0, 16, 0, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 65, 17, 17, 
+    17, 17, 17, 17, 1, 17, 17, 0, 17, 17, 17, 1, 1, 17, 17, 0, 
+    17, 17, 17, 17, 1, 17, 17, 0, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 1, 17, 17, 0, 17, 17, 17, 1, 
+    1, 17, 17, 0, 17, 17, 17, 17, 17, 17, 17, 1, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 1, 17, 17, 0, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 1, 32, 34, 
+    68, 68, 68, 68, 52, 51, 51, 51, 51, 51, 51, 51, 51, 51, 3, 0, 
+    17, 17, 17, 17, 17, 17, 17, 17, 85, 85, 85, 85, 85, 0, 0, 0, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 17, 17, 17, 0, 
+    20, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 81, 20, 17, 17, 17, 17, 17, 17, 17, 17, 
+    22, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 65, 4, 0, 
+    17, 17, 17, 17, 17, 65, 68, 51, 19, 17, 17, 17, 1, 0, 0, 0, 
+    17, 17, 17, 17, 17, 17, 1, 17, 17, 34, 2, 0, 0, 0, 0, 0, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 34, 66, 4, 0, 0, 0, 0, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 34, 0, 0, 0, 0, 0, 0, 
+    17, 17, 17, 17, 17, 17, 1, 17, 1, 34, 0, 0, 0, 0, 0, 0, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 34, 34, 34, 34, 34, 34, 
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 68, 20, 68, 84, 33, 0, 
+    51, 51, 51, 51, 51, 0, 0, 0, 51, 51, 51, 51, 51, 0, 0, 0, 
+    68, 68, 68, 68, 68, 36, 34, 0, 51, 51, 51, 51, 51, 0, 0, 0, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 1, 0, 0, 0, 
+    17, 17, 33, 18, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 33, 1, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 0, 0, 0, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 1, 
+    34, 34, 34, 34, 34, 34, 0, 0, 34, 34, 34, 34, 34, 34, 0, 0, 
+    5, 0, 68, 51, 51, 51, 51, 51, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 0, 17, 17, 1, 0, 0, 0, 0, 0, 
+    17, 17, 17, 17, 17, 17, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 0, 0, 0, 51, 51, 51, 51, 51, 3, 0, 85, 
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 33, 34, 34, 0, 68, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 33, 34, 34, 34, 34, 2, 
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 2, 32, 
+    68, 68, 68, 20, 68, 68, 68, 0, 34, 34, 34, 34, 34, 34, 34, 34, 
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    34, 34, 18, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    34, 34, 18, 17, 17, 17, 0, 0, 51, 51, 51, 51, 51, 68, 68, 68, 
+    84, 85, 85, 85, 85, 37, 34, 34, 34, 34, 85, 85, 85, 85, 5, 0, 
+    34, 18, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    33, 34, 34, 34, 34, 34, 34, 17, 51, 51, 51, 51, 51, 17, 17, 17, 
+    17, 17, 17, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 68, 68, 
+    17, 17, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 64, 68, 68, 
+    51, 51, 51, 51, 51, 0, 16, 17, 51, 51, 51, 51, 51, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 68, 
+    17, 17, 17, 17, 1, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 1, 16, 17, 
+    68, 68, 68, 68, 0, 0, 0, 0, 34, 66, 34, 34, 34, 34, 34, 34, 
+    34, 34, 34, 34, 18, 17, 33, 17, 17, 17, 18, 33, 34, 1, 0, 0, 
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 32, 34, 34, 
+    17, 17, 17, 0, 17, 17, 17, 0, 17, 17, 17, 17, 16, 16, 16, 16, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 1, 17, 17, 17, 81, 81, 
+    85, 17, 1, 17, 17, 17, 81, 85, 17, 17, 0, 17, 17, 17, 80, 85, 
+    17, 17, 17, 17, 17, 17, 81, 85, 0, 17, 1, 17, 17, 17, 81, 5, 
+    102, 102, 102, 102, 102, 6, 0, 0, 68, 68, 68, 68, 68, 68, 68, 68, 
+    68, 68, 68, 68, 102, 0, 0, 96, 68, 68, 68, 68, 68, 68, 68, 68, 
+    68, 68, 69, 68, 68, 68, 68, 68, 68, 69, 68, 68, 68, 68, 68, 100, 
+    0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 51, 51, 51, 85, 69, 20, 
+    51, 51, 51, 51, 51, 85, 69, 4, 17, 17, 17, 17, 17, 17, 1, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 34, 34, 34, 34, 34, 34, 34, 34, 
+    34, 34, 34, 34, 34, 34, 34, 34, 2, 0, 0, 0, 0, 0, 0, 0, 
+    85, 81, 85, 21, 85, 17, 17, 17, 17, 17, 21, 85, 21, 17, 17, 85, 
+    85, 85, 81, 81, 81, 17, 17, 21, 17, 17, 17, 17, 17, 85, 17, 17, 
+    85, 85, 21, 17, 17, 85, 85, 81, 51, 51, 51, 51, 51, 51, 51, 51, 
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 
+    51, 19, 49, 51, 51, 85, 0, 0, 85, 85, 85, 85, 85, 85, 85, 85, 
+    85, 85, 85, 85, 68, 68, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 
+    85, 85, 85, 85, 69, 84, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 
+    85, 85, 85, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    85, 85, 85, 85, 85, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 85, 85, 
+    85, 85, 85, 85, 85, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 
+    85, 85, 85, 85, 68, 68, 68, 68, 68, 68, 68, 51, 51, 51, 51, 51, 
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 85, 85, 85, 85, 85, 85, 
+    85, 85, 69, 84, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 
+    85, 85, 85, 68, 68, 68, 68, 68, 85, 85, 85, 85, 85, 85, 85, 85, 
+    85, 69, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 84, 85, 85, 85, 
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 68, 68, 85, 85, 
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 68, 85, 
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 85, 85, 85, 85, 85, 
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 80, 85, 85, 85, 85, 
+    17, 17, 17, 17, 17, 17, 17, 1, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 81, 85, 85, 21, 17, 33, 34, 17, 0, 0, 64, 68, 52, 68, 
+    17, 17, 17, 17, 0, 0, 0, 16, 4, 0, 0, 0, 0, 0, 0, 32, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 1, 0, 0, 0, 0, 
+    17, 17, 17, 1, 17, 17, 17, 1, 17, 17, 17, 1, 17, 17, 17, 1, 
+    68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 
+    68, 68, 68, 68, 68, 68, 68, 20, 68, 68, 68, 68, 68, 68, 68, 68, 
+    68, 68, 68, 68, 68, 68, 68, 68, 85, 4, 0, 0, 0, 0, 0, 0, 
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 80, 85, 85, 
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 0, 0, 0, 0, 0, 
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 85, 85, 85, 85, 85, 85, 0, 0, 
+    70, 68, 21, 49, 68, 68, 68, 68, 68, 85, 68, 68, 68, 68, 68, 68, 
+    53, 51, 51, 51, 51, 34, 34, 34, 20, 17, 17, 85, 51, 19, 65, 85, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 1, 32, 82, 21, 17, 
+    0, 0, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 1, 85, 51, 51, 85, 85, 85, 85, 85, 
+    85, 85, 0, 0, 0, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 5, 
+    51, 51, 51, 51, 51, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 
+    85, 85, 85, 85, 51, 51, 51, 51, 53, 51, 51, 51, 51, 51, 51, 51, 
+    85, 85, 85, 85, 85, 85, 85, 85, 53, 51, 51, 51, 51, 51, 51, 51, 
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    17, 17, 17, 17, 17, 17, 1, 0, 85, 85, 85, 85, 85, 85, 85, 85, 
+    85, 85, 85, 5, 0, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 65, 68, 17, 17, 17, 17, 17, 17, 17, 17, 
+    51, 51, 51, 51, 51, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    17, 17, 17, 17, 17, 17, 17, 33, 34, 66, 34, 34, 34, 34, 34, 20, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 34, 
+    17, 17, 17, 51, 51, 51, 51, 51, 34, 68, 68, 68, 0, 0, 0, 0, 
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 21, 17, 17, 17, 17, 
+    85, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 81, 21, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    0, 17, 17, 17, 17, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 17, 17, 17, 17, 17, 
+    17, 18, 17, 18, 17, 33, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 33, 34, 34, 85, 85, 2, 0, 51, 51, 51, 85, 85, 0, 0, 0, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 68, 68, 0, 0, 0, 0, 
+    34, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    34, 34, 34, 0, 0, 0, 0, 68, 51, 51, 51, 51, 51, 0, 0, 0, 
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 17, 17, 17, 68, 20, 20, 33, 
+    17, 17, 17, 34, 34, 34, 34, 68, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 33, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 64, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 1, 0, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 33, 34, 34, 34, 34, 34, 34, 
+    66, 68, 68, 68, 68, 68, 68, 16, 51, 51, 51, 51, 51, 0, 0, 68, 
+    17, 17, 33, 17, 17, 17, 17, 17, 51, 51, 51, 51, 51, 17, 17, 1, 
+    17, 17, 17, 17, 33, 34, 34, 34, 34, 34, 34, 2, 0, 0, 0, 0, 
+    17, 33, 17, 17, 17, 17, 34, 0, 51, 51, 51, 51, 51, 0, 68, 68, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 81, 85, 33, 34, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 18, 34, 18, 33, 18, 17, 17, 34, 
+    33, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 17, 68, 
+    17, 17, 17, 17, 17, 33, 34, 34, 68, 17, 33, 2, 0, 0, 0, 0, 
+    16, 17, 17, 1, 16, 17, 17, 1, 16, 17, 17, 1, 0, 0, 0, 0, 
+    17, 17, 17, 1, 17, 17, 17, 1, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 81, 17, 17, 
+    17, 17, 17, 17, 17, 85, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 33, 34, 34, 34, 66, 34, 0, 51, 51, 51, 51, 51, 0, 0, 0, 
+    0, 16, 0, 0, 0, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 1, 0, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 
+    17, 17, 17, 17, 17, 17, 17, 0, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 0, 
+    17, 17, 17, 1, 0, 0, 0, 0, 0, 16, 17, 17, 0, 0, 16, 18, 
+    17, 17, 17, 17, 81, 17, 17, 17, 17, 17, 17, 1, 17, 17, 1, 1, 
+    17, 16, 1, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 85, 85, 85, 85, 85, 85, 85, 
+    85, 0, 0, 0, 0, 0, 0, 0, 0, 16, 17, 17, 17, 17, 17, 17, 
+    0, 0, 0, 0, 0, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 0, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 17, 17, 17, 17, 17, 17, 85, 0, 
+    34, 34, 34, 34, 34, 34, 34, 34, 68, 68, 68, 68, 68, 0, 0, 0, 
+    34, 34, 34, 34, 34, 34, 34, 34, 68, 68, 68, 68, 68, 68, 68, 68, 
+    68, 68, 68, 68, 68, 68, 68, 68, 68, 4, 68, 68, 68, 68, 68, 68, 
+    68, 69, 85, 5, 84, 68, 0, 0, 17, 17, 1, 17, 17, 17, 17, 17, 
+    64, 68, 69, 68, 68, 84, 68, 68, 51, 51, 51, 51, 51, 68, 85, 69, 
+    21, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 65, 69, 69, 
+    68, 68, 68, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    0, 17, 17, 17, 0, 17, 17, 17, 0, 17, 17, 17, 0, 17, 1, 0, 
+    85, 85, 85, 5, 85, 85, 85, 5, 0, 0, 0, 0, 0, 0, 85, 0, 
+    17, 17, 17, 17, 17, 17, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 1, 17, 17, 17, 17, 17, 17, 17, 17, 17, 1, 17, 16, 
+    17, 17, 17, 17, 17, 17, 17, 0, 17, 17, 17, 17, 17, 17, 17, 0, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 1, 0, 0, 
+    68, 4, 0, 48, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 0, 80, 85, 85, 85, 85, 
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 83, 85, 85, 85, 
+    85, 85, 85, 85, 85, 51, 85, 5, 85, 85, 85, 85, 85, 85, 5, 0, 
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 85, 85, 85, 85, 85, 85, 85, 85, 
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 37, 0, 
+    17, 17, 17, 17, 17, 17, 17, 17, 1, 0, 0, 0, 0, 0, 0, 0, 
+    50, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 0, 0, 
+    51, 51, 0, 0, 0, 0, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    49, 17, 17, 17, 17, 3, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 34, 34, 2, 0, 0, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 64, 
+    17, 17, 0, 0, 17, 17, 17, 17, 52, 51, 51, 0, 0, 0, 0, 0, 
+    51, 51, 51, 51, 51, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 17, 17, 17, 17, 
+    17, 17, 17, 17, 0, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 
+    17, 17, 17, 0, 1, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 16, 1, 0, 1, 16, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 64, 51, 51, 51, 51, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 81, 53, 51, 51, 51, 
+    0, 0, 0, 48, 51, 51, 51, 51, 0, 0, 0, 0, 0, 0, 0, 0, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 1, 17, 0, 0, 48, 51, 51, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 51, 51, 51, 0, 64, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 64, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 51, 17, 
+    51, 51, 51, 51, 51, 51, 51, 51, 0, 51, 51, 51, 51, 51, 51, 51, 
+    33, 34, 32, 2, 0, 0, 34, 34, 17, 17, 16, 17, 16, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 34, 2, 0, 32, 
+    51, 51, 51, 51, 3, 0, 0, 0, 68, 68, 68, 68, 4, 0, 0, 0, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 49, 67, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 49, 51, 
+    17, 17, 17, 17, 21, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 33, 2, 0, 48, 51, 51, 68, 68, 68, 4, 0, 0, 0, 0, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 64, 68, 68, 68, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 51, 51, 51, 51, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 1, 0, 0, 51, 51, 51, 51, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 0, 64, 68, 4, 0, 
+    0, 0, 0, 0, 48, 51, 51, 51, 0, 0, 0, 0, 0, 0, 0, 0, 
+    17, 17, 17, 17, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 1, 0, 0, 0, 0, 0, 0, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 1, 0, 0, 0, 51, 51, 51, 
+    17, 17, 34, 34, 0, 0, 0, 0, 51, 51, 51, 51, 51, 0, 0, 0, 
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 3, 
+    17, 17, 17, 17, 17, 32, 66, 0, 17, 0, 0, 0, 0, 0, 0, 0, 
+    51, 51, 51, 19, 0, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 34, 34, 34, 34, 34, 50, 51, 67, 68, 68, 0, 0, 0, 
+    17, 17, 49, 51, 51, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 34, 34, 34, 34, 
+    34, 34, 34, 66, 68, 68, 68, 0, 0, 51, 51, 51, 51, 51, 51, 51, 
+    51, 51, 51, 51, 51, 51, 51, 51, 0, 0, 0, 0, 0, 0, 0, 32, 
+    17, 17, 17, 17, 17, 17, 17, 17, 34, 34, 34, 34, 34, 66, 4, 68, 
+    68, 0, 0, 0, 0, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 1, 0, 0, 0, 51, 51, 51, 51, 51, 0, 0, 0, 
+    17, 17, 17, 33, 34, 34, 34, 34, 34, 34, 2, 51, 51, 51, 51, 51, 
+    68, 68, 33, 18, 0, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 33, 68, 1, 0, 0, 0, 0, 
+    18, 17, 65, 68, 36, 34, 66, 34, 51, 51, 51, 51, 51, 65, 65, 68, 
+    48, 51, 51, 51, 51, 51, 51, 51, 51, 51, 3, 0, 0, 0, 0, 0, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 16, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 34, 34, 34, 34, 34, 34, 68, 68, 68, 2, 
+    17, 17, 17, 1, 1, 17, 17, 16, 17, 17, 17, 17, 17, 17, 17, 16, 
+    17, 17, 17, 17, 65, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 33, 
+    34, 34, 34, 34, 34, 2, 0, 0, 51, 51, 51, 51, 51, 0, 0, 0, 
+    34, 34, 16, 17, 17, 17, 1, 16, 1, 16, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 1, 17, 17, 17, 1, 17, 16, 17, 17, 32, 18, 34, 
+    34, 34, 2, 32, 2, 32, 34, 0, 1, 0, 0, 32, 0, 0, 16, 17, 
+    17, 34, 0, 34, 34, 34, 2, 0, 34, 34, 2, 0, 0, 0, 0, 0, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 33, 34, 34, 34, 34, 34, 
+    34, 34, 34, 18, 17, 65, 68, 68, 51, 51, 51, 51, 51, 68, 64, 18, 
+    17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    34, 34, 17, 20, 0, 0, 0, 0, 51, 51, 51, 51, 51, 0, 0, 0, 
+    17, 17, 17, 17, 17, 17, 17, 33, 34, 34, 34, 0, 34, 34, 34, 34, 
+    66, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 17, 17, 34, 0, 
+    66, 68, 1, 0, 0, 0, 0, 0, 51, 51, 51, 51, 51, 0, 0, 0, 
+    68, 68, 68, 68, 68, 68, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    17, 17, 17, 17, 17, 33, 34, 34, 34, 34, 34, 34, 1, 0, 0, 0, 
+    51, 51, 51, 51, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    34, 34, 34, 34, 34, 34, 0, 0, 51, 51, 51, 51, 51, 51, 68, 84, 
+    17, 17, 17, 17, 17, 17, 34, 34, 34, 34, 34, 34, 34, 66, 0, 0, 
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 3, 0, 0, 0, 0, 0, 16, 
+    17, 17, 17, 1, 16, 0, 17, 17, 17, 17, 16, 1, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 34, 34, 34, 32, 2, 32, 34, 18, 
+    18, 34, 68, 4, 0, 0, 0, 0, 51, 51, 51, 51, 51, 0, 0, 0, 
+    17, 17, 17, 17, 0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 33, 34, 34, 34, 0, 34, 34, 34, 
+    18, 20, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    33, 34, 34, 34, 34, 18, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 33, 34, 34, 34, 33, 34, 66, 
+    68, 68, 68, 36, 0, 0, 0, 0, 33, 34, 34, 34, 34, 34, 17, 17, 
+    17, 17, 17, 17, 17, 34, 34, 34, 34, 34, 34, 34, 34, 68, 20, 68, 
+    68, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    17, 17, 17, 17, 1, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 33, 34, 34, 34, 2, 34, 34, 34, 34, 
+    65, 68, 68, 0, 0, 0, 0, 0, 51, 51, 51, 51, 51, 51, 51, 51, 
+    51, 51, 51, 51, 51, 51, 3, 0, 68, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 0, 34, 34, 34, 34, 34, 34, 34, 
+    34, 34, 34, 34, 32, 34, 34, 34, 34, 34, 34, 2, 0, 0, 0, 0, 
+    17, 17, 17, 1, 17, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 33, 34, 34, 2, 0, 2, 34, 32, 
+    34, 34, 34, 33, 0, 0, 0, 0, 51, 51, 51, 51, 51, 0, 0, 0, 
+    17, 17, 17, 16, 1, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 34, 34, 2, 34, 32, 34, 34, 1, 0, 0, 0, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 33, 34, 66, 4, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 83, 85, 85, 85, 85, 85, 
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 0, 0, 0, 0, 0, 64, 
+    51, 51, 51, 51, 51, 51, 51, 3, 68, 68, 4, 0, 0, 0, 0, 0, 
+    17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    17, 17, 17, 17, 17, 17, 17, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+    17, 17, 17, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    51, 51, 51, 51, 51, 0, 0, 68, 0, 0, 0, 0, 0, 0, 0, 0, 
+    17, 17, 17, 17, 17, 17, 17, 0, 34, 34, 66, 0, 0, 0, 0, 0, 
+    17, 17, 17, 17, 17, 17, 17, 17, 34, 34, 34, 66, 68, 68, 85, 85, 
+    17, 17, 84, 0, 0, 0, 0, 0, 51, 51, 51, 51, 51, 48, 51, 51, 
+    51, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 16, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 67, 68, 4, 0, 0, 
+    17, 17, 17, 17, 17, 1, 0, 32, 33, 34, 34, 34, 34, 34, 34, 34, 
+    34, 34, 34, 34, 0, 0, 0, 32, 34, 18, 17, 17, 17, 17, 17, 17, 
+    17, 20, 2, 0, 0, 0, 0, 0, 34, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 
+    1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 17, 1, 0, 0, 0, 0, 0, 0, 
+    0, 0, 17, 17, 0, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 1, 0, 0, 17, 17, 17, 17, 17, 17, 1, 0, 
+    17, 17, 17, 17, 1, 0, 0, 0, 17, 17, 17, 17, 17, 0, 37, 66, 
+    85, 85, 85, 5, 80, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 
+    85, 85, 37, 34, 34, 85, 37, 34, 34, 2, 0, 0, 0, 32, 34, 34, 
+    34, 82, 37, 34, 34, 34, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 
+    85, 85, 85, 85, 85, 34, 34, 85, 85, 85, 85, 85, 85, 85, 85, 85, 
+    85, 85, 85, 85, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    85, 34, 82, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 0, 0, 0, 0, 0, 0, 
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 5, 0, 0, 0, 0, 
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 3, 0, 0, 0, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 1, 17, 
+    0, 1, 16, 1, 16, 17, 1, 17, 17, 17, 17, 17, 17, 16, 16, 17, 
+    17, 17, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 16, 17, 1, 16, 17, 17, 17, 1, 17, 17, 17, 1, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 16, 17, 1, 
+    17, 17, 1, 1, 0, 17, 17, 17, 1, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    81, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 81, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 81, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 17, 81, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 81, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 81, 17, 17, 17, 17, 0, 51, 51, 51, 51, 51, 51, 51, 51, 51, 
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 82, 85, 37, 34, 34, 
+    34, 34, 34, 34, 34, 34, 82, 85, 85, 85, 37, 85, 85, 85, 85, 85, 
+    85, 85, 82, 69, 68, 68, 0, 0, 0, 0, 0, 0, 0, 32, 34, 34, 
+    32, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0, 0, 0, 
+    34, 34, 34, 2, 34, 34, 34, 34, 34, 34, 34, 34, 2, 32, 34, 34, 
+    34, 32, 2, 34, 34, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    17, 17, 17, 17, 17, 17, 1, 0, 34, 34, 34, 18, 17, 17, 17, 0, 
+    51, 51, 51, 51, 51, 0, 0, 81, 0, 0, 0, 0, 0, 0, 0, 0, 
+    17, 17, 17, 17, 17, 17, 34, 34, 51, 51, 51, 51, 51, 0, 0, 80, 
+    17, 17, 1, 48, 51, 51, 51, 51, 34, 34, 34, 2, 0, 0, 0, 0, 
+    17, 17, 34, 34, 34, 18, 0, 0, 51, 51, 51, 51, 51, 0, 0, 68, 
+    0, 0, 0, 0, 0, 0, 0, 0, 48, 51, 51, 51, 51, 51, 51, 51, 
+    51, 51, 51, 51, 51, 51, 53, 51, 53, 51, 3, 0, 0, 0, 0, 0, 
+    48, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 
+    51, 51, 51, 51, 51, 51, 51, 53, 51, 51, 51, 51, 51, 51, 51, 0, 
+    16, 1, 1, 16, 16, 17, 17, 17, 17, 1, 17, 17, 16, 16, 0, 0, 
+    0, 1, 0, 16, 16, 16, 16, 17, 16, 1, 1, 16, 16, 16, 16, 16, 
+    16, 1, 1, 16, 17, 1, 17, 17, 17, 1, 17, 17, 16, 17, 1, 1, 
+    17, 17, 17, 17, 17, 16, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 
+    16, 17, 16, 17, 17, 16, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 
+    85, 85, 85, 85, 85, 85, 0, 0, 85, 85, 85, 85, 85, 85, 85, 85, 
+    85, 85, 85, 85, 85, 85, 85, 5, 80, 85, 85, 85, 85, 85, 85, 85, 
+    80, 85, 85, 85, 85, 85, 85, 85, 80, 85, 85, 85, 85, 85, 85, 85, 
+    51, 51, 51, 51, 51, 51, 83, 85, 85, 85, 85, 85, 85, 85, 85, 85, 
+    85, 85, 85, 85, 85, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 
+    85, 5, 0, 0, 0, 0, 0, 0, 85, 85, 85, 85, 85, 85, 85, 85, 
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 0, 
+    85, 85, 85, 85, 5, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 
+    85, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 0, 0, 0, 
+    85, 85, 85, 85, 85, 85, 5, 0, 85, 85, 85, 85, 85, 85, 5, 0, 
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 5, 0, 0, 0, 
+    85, 85, 85, 85, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    85, 85, 85, 85, 0, 0, 0, 0, 85, 85, 85, 85, 85, 0, 0, 0, 
+    85, 85, 85, 85, 0, 0, 0, 0, 85, 85, 85, 85, 85, 85, 85, 85, 
+    85, 85, 85, 85, 85, 85, 85, 0, 85, 0, 0, 0, 0, 0, 0, 0, 
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 5, 85, 85, 85, 
+    85, 85, 85, 85, 85, 85, 80, 85, 85, 85, 85, 85, 85, 85, 85, 85, 
+    85, 85, 85, 85, 85, 85, 85, 0, 85, 85, 5, 0, 85, 5, 0, 0, 
+    85, 85, 85, 5, 0, 0, 0, 0, 85, 85, 85, 85, 85, 85, 85, 85, 
+    85, 85, 85, 85, 5, 0, 0, 0, 85, 85, 85, 5, 0, 0, 0, 0, 
+    85, 5, 0, 0, 0, 0, 0, 0, 85, 85, 85, 5, 0, 0, 0, 0, 
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 5, 85, 85, 85, 85, 85, 85, 
+    0, 0, 0, 0, 0, 0, 0, 0, 51, 51, 51, 51, 51, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+    16, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static uint32_t tmu_get_category_property_internal(uint32_t cp) {
+    if (cp > 0x10FFFF) return 0;
+    uint32_t block_index = ((uint32_t)tmu_category_stage_one[cp >> 10] << 5) + ((cp >> 5) & 31);
+    uint32_t offset = cp & 31;
+    uint32_t value = tmu_category_stage_three[(uint32_t)tmu_category_stage_two[block_index] * 16 + (offset >> 1)];
+    return (value >> ((offset & 1) * 4)) & 15;
+}
+
+/* Per-property table for whitespace: 1272 bytes. */
+static const uint8_t tmu_whitespace_stage_one[1088] = {
+    0, 1, 1, 1, 1, 2, 1, 1, 3, 1, 1, 1, 4, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+static const uint8_t tmu_whitespace_stage_two[160] = {
+    0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    3, 4, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2
+};
+static const uint8_t tmu_whitespace_stage_three[24] = {
+    0, 16, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 255, 7, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 128
+};
+
+static uint32_t tmu_get_whitespace_property_internal(uint32_t cp) {
+    if (cp > 0x10FFFF) return 0;
+    uint32_t block_index = ((uint32_t)tmu_whitespace_stage_one[cp >> 10] << 5) + ((cp >> 5) & 31);
+    uint32_t offset = cp & 31;
+    uint32_t value = tmu_whitespace_stage_three[(uint32_t)tmu_whitespace_stage_two[block_index] * 4 + (offset >> 3)];
+    return (value >> ((offset & 7) * 1)) & 1;
+}
+
+/* Per-property table for case_info: 2448 bytes. */
+static const uint8_t tmu_case_info_stage_one[1088] = {
+    0, 1, 2, 2, 3, 2, 2, 4, 5, 2, 2, 6, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 7, 8, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 9, 10, 
+    2, 11, 2, 12, 2, 2, 13, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 14, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 15, 2, 2, 2, 2, 16, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2
+};
+static const uint8_t tmu_case_info_stage_two[544] = {
+    0, 0, 1, 2, 0, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 
+    6, 14, 15, 16, 17, 18, 0, 0, 0, 0, 0, 19, 20, 21, 22, 23, 
+    24, 25, 16, 6, 26, 6, 27, 6, 6, 28, 29, 16, 30, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 24, 31, 32, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 24, 33, 
+    0, 0, 0, 0, 34, 35, 0, 0, 16, 36, 0, 37, 38, 0, 0, 0, 
+    6, 6, 6, 6, 39, 6, 6, 6, 40, 41, 42, 43, 44, 45, 46, 47, 
+    0, 0, 0, 0, 0, 0, 0, 0, 48, 49, 50, 0, 51, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    24, 52, 53, 54, 6, 6, 6, 55, 16, 56, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 6, 57, 58, 0, 0, 0, 0, 59, 6, 60, 61, 62, 63, 64, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 38, 66, 16, 16, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 67, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 
+    24, 68, 18, 0, 0, 69, 70, 71, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 24, 72, 16, 73, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 24, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 24, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 74, 75, 87, 
+    77, 88, 89, 90, 81, 91, 92, 93, 94, 95, 96, 52, 97, 98, 99, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 24, 100, 101, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+static const uint8_t tmu_case_info_stage_three[816] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 84, 85, 85, 85, 85, 85, 21, 0, 
+    168, 170, 170, 170, 170, 170, 42, 0, 0, 0, 0, 0, 0, 8, 0, 0, 
+    85, 85, 85, 85, 85, 21, 85, 149, 170, 170, 170, 170, 170, 42, 170, 170, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 102, 102, 
+    102, 102, 154, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 101, 166, 
+    150, 89, 86, 90, 101, 89, 169, 101, 153, 89, 166, 89, 86, 102, 41, 169, 
+    0, 109, 219, 102, 102, 102, 102, 154, 153, 153, 153, 153, 182, 89, 153, 153, 
+    153, 153, 153, 153, 153, 170, 90, 150, 102, 149, 153, 153, 170, 170, 170, 170, 
+    170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 168, 170, 170, 
+    170, 170, 170, 170, 0, 0, 0, 0, 0, 0, 0, 0, 153, 144, 128, 74, 
+    0, 16, 21, 81, 86, 85, 85, 85, 69, 85, 85, 170, 170, 170, 170, 170, 
+    170, 170, 170, 106, 90, 169, 153, 153, 153, 153, 153, 153, 170, 73, 150, 86, 
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 170, 170, 170, 170, 
+    9, 0, 144, 153, 153, 153, 153, 153, 101, 102, 102, 166, 153, 153, 153, 153, 
+    153, 153, 153, 153, 84, 85, 85, 85, 85, 85, 85, 85, 85, 21, 0, 0, 
+    170, 170, 2, 0, 0, 0, 0, 0, 85, 69, 0, 4, 170, 170, 170, 170, 
+    170, 170, 170, 170, 170, 170, 42, 168, 85, 85, 85, 85, 85, 5, 170, 10, 
+    170, 170, 2, 0, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 21, 84, 
+    170, 170, 170, 0, 0, 0, 0, 0, 0, 0, 128, 170, 170, 170, 168, 170, 
+    170, 170, 170, 170, 170, 170, 42, 0, 153, 153, 153, 153, 153, 169, 170, 154, 
+    170, 170, 85, 85, 170, 10, 85, 5, 170, 170, 85, 85, 170, 170, 85, 85, 
+    170, 10, 85, 5, 170, 170, 68, 68, 170, 170, 85, 85, 170, 170, 170, 10, 
+    170, 170, 255, 255, 170, 170, 255, 255, 170, 170, 255, 255, 170, 162, 85, 35, 
+    160, 162, 85, 3, 170, 160, 85, 0, 170, 170, 85, 1, 160, 162, 85, 3, 
+    16, 64, 96, 165, 149, 4, 84, 5, 0, 17, 81, 133, 85, 2, 8, 90, 
+    0, 164, 10, 32, 0, 0, 0, 0, 64, 2, 0, 0, 0, 0, 0, 0, 
+    85, 85, 85, 21, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 42, 
+    89, 105, 102, 86, 153, 166, 170, 80, 153, 2, 64, 38, 144, 0, 0, 0, 
+    170, 138, 0, 8, 0, 0, 0, 0, 153, 153, 153, 9, 0, 0, 0, 0, 
+    153, 153, 153, 153, 153, 153, 153, 0, 144, 153, 153, 153, 154, 153, 153, 153, 
+    153, 153, 153, 153, 168, 170, 102, 150, 153, 153, 64, 38, 153, 154, 153, 153, 
+    153, 153, 89, 149, 85, 153, 153, 153, 144, 85, 38, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 36, 32, 0, 0, 0, 0, 0, 170, 170, 170, 170, 
+    170, 170, 2, 0, 170, 170, 170, 170, 170, 42, 0, 0, 128, 170, 0, 0, 
+    85, 85, 170, 170, 170, 170, 170, 170, 0, 0, 0, 0, 85, 85, 85, 85, 
+    85, 85, 85, 85, 85, 0, 170, 170, 170, 170, 170, 170, 170, 170, 170, 0, 
+    85, 85, 85, 85, 21, 0, 0, 0, 170, 170, 170, 170, 42, 0, 0, 0, 
+    85, 85, 85, 85, 85, 85, 165, 170, 170, 170, 170, 170, 170, 85, 85, 85, 
+    85, 85, 85, 165, 170, 162, 170, 170, 170, 170, 85, 85, 85, 85, 85, 85, 
+    165, 170, 170, 170, 170, 170, 170, 81, 16, 20, 84, 81, 85, 165, 138, 168, 
+    170, 168, 170, 170, 85, 85, 85, 85, 85, 85, 165, 170, 170, 170, 170, 170, 
+    170, 69, 21, 84, 85, 81, 85, 161, 170, 170, 170, 170, 170, 170, 69, 21, 
+    85, 17, 80, 85, 161, 170, 170, 170, 170, 170, 170, 85, 85, 85, 85, 85, 
+    85, 165, 170, 170, 170, 170, 170, 170, 85, 85, 85, 165, 170, 170, 170, 170, 
+    165, 170, 170, 170, 170, 170, 170, 85, 85, 85, 85, 85, 85, 165, 170, 170, 
+    170, 170, 170, 170, 85, 85, 85, 85, 170, 10, 85, 85, 85, 85, 85, 85, 
+    161, 170, 170, 170, 170, 170, 42, 170, 90, 85, 85, 85, 85, 85, 21, 170, 
+    170, 170, 170, 170, 170, 162, 170, 85, 85, 85, 85, 85, 85, 161, 170, 170, 
+    170, 170, 170, 42, 170, 90, 85, 85, 170, 170, 162, 170, 85, 85, 85, 85, 
+    85, 85, 161, 170, 170, 170, 170, 170, 42, 170, 154, 0, 0, 0, 0, 0, 
+    165, 170, 170, 170, 170, 170, 170, 170, 170, 0, 0, 0, 0, 0, 0, 0
+};
+
+static uint32_t tmu_get_case_info_property_internal(uint32_t cp) {
+    if (cp > 0x10FFFF) return 0;
+    uint32_t block_index = ((uint32_t)tmu_case_info_stage_one[cp >> 10] << 5) + ((cp >> 5) & 31);
+    uint32_t offset = cp & 31;
+    uint32_t value = tmu_case_info_stage_three[(uint32_t)tmu_case_info_stage_two[block_index] * 8 + (offset >> 2)];
+    return (value >> ((offset & 3) * 2)) & 3;
+}
+
+/* Per-property table for grapheme_break: 6624 bytes. */
+static const uint8_t tmu_grapheme_break_stage_one[1088] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 14, 15, 16, 17, 18, 19, 20, 
+    21, 22, 16, 17, 18, 23, 13, 13, 13, 13, 13, 13, 13, 13, 24, 25, 
+    26, 13, 27, 28, 29, 30, 31, 32, 13, 13, 13, 13, 13, 33, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 34, 35, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 36, 
+    13, 13, 13, 13, 37, 13, 38, 13, 39, 13, 40, 13, 41, 42, 43, 44, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    45, 46, 46, 46, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13
+};
+static const uint8_t tmu_grapheme_break_stage_two[1504] = {
+    0, 1, 1, 2, 3, 4, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 5, 5, 5, 6, 1, 1, 1, 1, 
+    1, 1, 1, 1, 7, 1, 1, 1, 1, 1, 1, 1, 8, 9, 10, 1, 
+    11, 1, 12, 13, 1, 1, 14, 15, 16, 17, 18, 1, 1, 19, 1, 20, 
+    21, 22, 23, 1, 1, 1, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 
+    34, 35, 36, 37, 34, 35, 38, 39, 30, 40, 41, 29, 42, 43, 44, 1, 
+    45, 46, 47, 29, 30, 48, 49, 29, 50, 51, 52, 29, 30, 1, 53, 54, 
+    1, 55, 56, 1, 1, 57, 58, 1, 59, 60, 1, 61, 62, 63, 64, 1, 
+    1, 65, 66, 67, 68, 1, 1, 1, 69, 69, 69, 70, 70, 71, 72, 72, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 73, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 74, 74, 75, 75, 1, 76, 77, 1, 
+    78, 1, 1, 1, 79, 80, 1, 1, 1, 81, 1, 1, 1, 1, 1, 1, 
+    82, 1, 83, 84, 1, 17, 85, 1, 86, 87, 88, 89, 90, 91, 1, 92, 
+    1, 93, 1, 1, 1, 1, 94, 95, 1, 1, 1, 1, 1, 1, 5, 96, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    97, 98, 99, 100, 1, 1, 17, 101, 1, 102, 1, 1, 103, 104, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 105, 106, 1, 1, 106, 1, 107, 108, 
+    1, 1, 1, 1, 1, 1, 109, 1, 1, 1, 1, 1, 1, 110, 111, 112, 
+    113, 114, 114, 114, 115, 114, 114, 114, 116, 117, 118, 119, 120, 121, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 122, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 123, 1, 124, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 125, 1, 1, 1, 126, 1, 1, 1, 5, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 127, 1, 1, 128, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 129, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 130, 46, 1, 1, 131, 1, 1, 1, 1, 1, 1, 1, 1, 
+    132, 133, 1, 1, 134, 135, 136, 137, 1, 138, 139, 140, 26, 141, 142, 143, 
+    1, 144, 145, 146, 1, 147, 148, 149, 1, 1, 1, 1, 1, 1, 1, 150, 
+    151, 152, 153, 154, 155, 156, 157, 151, 152, 153, 154, 155, 156, 157, 151, 152, 
+    153, 154, 155, 156, 157, 151, 152, 153, 154, 155, 156, 157, 151, 152, 153, 154, 
+    155, 156, 157, 151, 152, 153, 154, 155, 156, 157, 151, 152, 153, 154, 155, 156, 
+    157, 151, 152, 153, 154, 155, 156, 157, 151, 152, 153, 154, 155, 156, 157, 151, 
+    152, 153, 154, 155, 156, 157, 151, 152, 153, 154, 155, 156, 157, 151, 152, 153, 
+    154, 155, 156, 157, 151, 152, 153, 154, 155, 156, 157, 151, 152, 153, 154, 155, 
+    156, 157, 151, 152, 153, 154, 155, 156, 157, 151, 152, 153, 154, 155, 156, 157, 
+    151, 152, 153, 154, 155, 156, 157, 151, 152, 153, 154, 155, 156, 157, 151, 152, 
+    153, 154, 155, 156, 157, 151, 152, 153, 154, 155, 156, 157, 151, 152, 153, 154, 
+    155, 156, 157, 151, 152, 153, 154, 155, 156, 157, 151, 152, 153, 154, 155, 156, 
+    157, 151, 152, 153, 154, 155, 156, 157, 151, 152, 153, 154, 155, 156, 157, 151, 
+    152, 153, 154, 155, 156, 157, 151, 152, 153, 154, 155, 156, 157, 151, 152, 153, 
+    154, 155, 156, 157, 151, 152, 153, 154, 155, 156, 157, 151, 152, 153, 154, 155, 
+    156, 157, 151, 152, 153, 154, 155, 156, 157, 151, 152, 153, 154, 155, 156, 157, 
+    156, 157, 151, 152, 153, 154, 155, 156, 157, 151, 152, 153, 154, 155, 156, 157, 
+    151, 152, 153, 154, 155, 156, 157, 151, 152, 153, 154, 155, 156, 158, 159, 160, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 161, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    6, 6, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 46, 1, 1, 162, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 163, 
+    1, 1, 1, 1, 1, 1, 1, 85, 1, 1, 1, 164, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    165, 166, 1, 1, 1, 1, 1, 79, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 167, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 168, 1, 1, 1, 1, 19, 1, 1, 1, 1, 1, 
+    169, 170, 171, 126, 90, 172, 173, 1, 174, 175, 176, 177, 90, 178, 179, 1, 
+    1, 180, 1, 1, 1, 1, 126, 181, 50, 51, 182, 183, 1, 1, 1, 1, 
+    1, 184, 185, 1, 1, 186, 187, 1, 1, 1, 1, 1, 1, 188, 189, 1, 
+    1, 190, 85, 1, 1, 191, 1, 1, 73, 192, 1, 1, 1, 1, 1, 1, 
+    1, 193, 1, 1, 1, 1, 1, 1, 1, 194, 195, 1, 1, 1, 196, 197, 
+    198, 199, 200, 1, 201, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 202, 1, 1, 203, 204, 1, 1, 1, 205, 206, 1, 207, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 208, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 209, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 210, 1, 211, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 212, 213, 214, 1, 1, 215, 
+    1, 1, 1, 1, 216, 217, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 218, 219, 220, 1, 1, 
+    1, 1, 221, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    5, 222, 5, 223, 224, 225, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    226, 227, 1, 1, 1, 1, 1, 1, 1, 211, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 228, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 211, 1, 1, 1, 229, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    114, 114, 114, 114, 114, 114, 114, 114, 230, 107, 1, 231, 232, 233, 114, 234, 
+    235, 236, 237, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 238, 
+    114, 114, 114, 114, 114, 114, 114, 114, 114, 239, 240, 114, 114, 114, 114, 114, 
+    114, 114, 241, 1, 114, 114, 114, 114, 1, 1, 1, 242, 1, 1, 243, 114, 
+    244, 1, 245, 1, 246, 247, 114, 114, 248, 249, 250, 114, 114, 114, 114, 114, 
+    114, 114, 114, 114, 114, 114, 114, 114, 1, 1, 1, 1, 1, 1, 1, 1, 
+    114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 
+    114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 239, 
+    3, 5, 5, 5, 3, 3, 3, 3, 5, 5, 5, 5, 5, 5, 5, 251, 
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3
+};
+static const uint8_t tmu_grapheme_break_stage_three[4032] = {
+    51, 51, 51, 51, 51, 50, 19, 51, 51, 51, 51, 51, 51, 51, 51, 51, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 
+    0, 0, 0, 0, 224, 0, 48, 14, 0, 0, 0, 0, 0, 0, 0, 0, 
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 
+    85, 85, 85, 85, 85, 85, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 80, 85, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 80, 85, 85, 85, 85, 85, 85, 85, 
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 80, 
+    80, 5, 85, 80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    68, 68, 68, 0, 0, 0, 0, 0, 85, 85, 85, 85, 85, 5, 3, 0, 
+    0, 0, 0, 0, 0, 80, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 
+    0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 85, 85, 69, 80, 
+    85, 85, 5, 80, 5, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 64, 80, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 85, 85, 85, 85, 85, 85, 85, 85, 
+    85, 85, 85, 85, 85, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 85, 85, 85, 85, 85, 5, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 80, 85, 85, 85, 85, 0, 0, 0, 0, 80, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 85, 80, 85, 85, 
+    85, 85, 80, 85, 80, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 85, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 85, 85, 85, 85, 85, 85, 
+    85, 84, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 
+    85, 117, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 117, 5, 119, 
+    87, 85, 85, 85, 117, 119, 87, 119, 80, 85, 85, 85, 0, 0, 0, 0, 
+    0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    80, 119, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 117, 
+    87, 85, 5, 112, 7, 112, 87, 0, 0, 0, 0, 80, 0, 0, 0, 0, 
+    0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 
+    80, 117, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 119, 
+    87, 5, 0, 80, 5, 80, 85, 0, 80, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 80, 0, 0, 0, 0, 0, 
+    87, 85, 85, 80, 117, 112, 87, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 85, 85, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 85, 
+    87, 85, 5, 112, 7, 112, 87, 0, 0, 0, 80, 85, 0, 0, 0, 0, 
+    0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 117, 
+    117, 7, 0, 119, 7, 119, 87, 0, 0, 0, 0, 80, 0, 0, 0, 0, 
+    117, 119, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 
+    117, 119, 7, 85, 5, 85, 85, 0, 0, 0, 80, 5, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 87, 
+    119, 117, 7, 117, 7, 119, 85, 0, 0, 0, 80, 5, 0, 0, 0, 0, 
+    85, 119, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 5, 117, 
+    87, 85, 5, 119, 7, 119, 87, 4, 0, 0, 0, 80, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 5, 0, 80, 119, 85, 5, 5, 119, 119, 119, 87, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 119, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 80, 112, 85, 85, 85, 5, 0, 0, 
+    0, 0, 0, 80, 85, 85, 85, 5, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 80, 112, 85, 85, 85, 85, 5, 0, 
+    0, 0, 0, 0, 85, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 80, 80, 0, 0, 119, 
+    0, 0, 0, 0, 0, 0, 0, 0, 80, 85, 85, 85, 85, 85, 85, 117, 
+    85, 85, 5, 85, 0, 0, 80, 85, 85, 85, 85, 85, 80, 85, 85, 85, 
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 5, 0, 
+    0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 80, 85, 117, 85, 85, 85, 80, 117, 87, 5, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 119, 85, 0, 0, 85, 
+    5, 0, 0, 0, 0, 0, 0, 0, 80, 85, 5, 0, 0, 0, 0, 0, 
+    0, 5, 87, 5, 0, 0, 80, 0, 0, 0, 0, 0, 0, 0, 80, 0, 
+    136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 153, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 
+    170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 85, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 5, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 87, 85, 85, 85, 119, 
+    119, 119, 119, 117, 87, 85, 85, 85, 85, 85, 0, 0, 0, 0, 80, 0, 
+    0, 0, 0, 0, 0, 80, 85, 3, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 80, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    85, 117, 119, 87, 117, 119, 0, 0, 119, 117, 119, 119, 87, 85, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 117, 87, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 112, 117, 85, 85, 85, 5, 
+    5, 5, 80, 85, 85, 85, 117, 119, 119, 87, 85, 85, 85, 85, 5, 80, 
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    85, 85, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 85, 85, 117, 117, 119, 
+    119, 117, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 80, 85, 85, 85, 85, 0, 0, 0, 0, 0, 0, 
+    85, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    112, 85, 85, 119, 85, 87, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 117, 85, 119, 87, 87, 85, 119, 0, 0, 0, 0, 0, 0, 
+    0, 0, 119, 119, 119, 119, 85, 85, 85, 85, 119, 85, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 85, 5, 85, 85, 85, 85, 85, 85, 
+    117, 85, 85, 85, 5, 0, 80, 0, 0, 0, 5, 112, 85, 0, 0, 0, 
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 80, 85, 85, 
+    0, 0, 0, 0, 0, 48, 213, 51, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 51, 51, 51, 3, 0, 0, 0, 0, 0, 0, 14, 0, 
+    0, 0, 0, 0, 224, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    51, 51, 51, 51, 51, 51, 51, 51, 0, 0, 0, 0, 0, 0, 0, 0, 
+    85, 85, 85, 85, 85, 85, 85, 85, 5, 0, 0, 0, 0, 0, 0, 0, 
+    0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 224, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 238, 238, 238, 0, 0, 0, 
+    0, 0, 0, 0, 224, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 238, 0, 0, 
+    0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 224, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 224, 238, 238, 238, 238, 238, 0, 0, 238, 14, 0, 0, 
+    0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 238, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 
+    14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 224, 238, 14, 
+    238, 238, 238, 224, 238, 238, 238, 238, 238, 14, 238, 238, 238, 238, 238, 238, 
+    238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 
+    238, 238, 238, 0, 0, 0, 0, 0, 238, 238, 238, 238, 238, 238, 238, 238, 
+    238, 238, 238, 0, 238, 238, 238, 238, 238, 14, 14, 14, 0, 0, 224, 0, 
+    224, 0, 0, 0, 14, 0, 0, 0, 0, 224, 14, 0, 0, 0, 0, 0, 
+    0, 0, 14, 224, 0, 0, 14, 14, 0, 224, 238, 224, 0, 0, 0, 0, 
+    0, 224, 238, 238, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 224, 238, 0, 0, 0, 0, 
+    224, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 224, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 238, 0, 0, 0, 0, 0, 
+    0, 0, 224, 238, 0, 0, 0, 0, 0, 0, 0, 0, 0, 224, 14, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 224, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 80, 85, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 
+    0, 0, 0, 0, 0, 85, 85, 85, 14, 0, 0, 0, 0, 0, 224, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 5, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 224, 224, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 80, 85, 5, 85, 85, 85, 85, 85, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 
+    0, 5, 0, 5, 0, 80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 112, 87, 117, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    119, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 119, 119, 119, 119, 119, 119, 
+    119, 119, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 0, 0, 0, 0, 0, 80, 
+    0, 0, 0, 85, 85, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 80, 85, 85, 85, 85, 85, 119, 0, 0, 0, 0, 0, 0, 
+    136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 8, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 119, 85, 85, 119, 85, 119, 
+    7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 80, 85, 85, 117, 87, 117, 87, 5, 0, 0, 0, 0, 
+    0, 80, 0, 0, 0, 0, 117, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 5, 85, 5, 80, 5, 0, 0, 85, 
+    80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 112, 85, 119, 0, 0, 112, 5, 0, 0, 0, 0, 
+    0, 112, 87, 119, 117, 7, 87, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    203, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 203, 204, 
+    204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 203, 204, 204, 204, 
+    204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 203, 204, 204, 204, 204, 204, 
+    204, 204, 204, 204, 204, 204, 204, 204, 203, 204, 204, 204, 204, 204, 204, 204, 
+    204, 204, 204, 204, 204, 204, 203, 204, 204, 204, 204, 204, 204, 204, 204, 204, 
+    204, 204, 204, 204, 203, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 
+    204, 204, 203, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 
+    204, 204, 0, 0, 0, 0, 0, 0, 153, 153, 153, 153, 153, 153, 153, 153, 
+    153, 153, 153, 9, 0, 160, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 
+    170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 
+    0, 0, 0, 0, 0, 0, 0, 0, 51, 51, 51, 51, 51, 51, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 85, 5, 0, 0, 
+    80, 85, 80, 5, 0, 0, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 5, 0, 80, 
+    0, 0, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 80, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    87, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 85, 85, 85, 
+    85, 85, 85, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 119, 87, 85, 117, 87, 5, 64, 0, 
+    0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    85, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 80, 85, 85, 87, 85, 85, 85, 5, 0, 0, 0, 0, 0, 
+    0, 0, 112, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 112, 119, 85, 85, 85, 85, 117, 
+    7, 68, 0, 0, 80, 85, 5, 87, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 119, 87, 85, 119, 117, 85, 0, 0, 0, 5, 
+    119, 87, 85, 85, 85, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    117, 119, 7, 112, 7, 112, 119, 0, 0, 0, 0, 80, 0, 0, 0, 0, 
+    0, 119, 0, 85, 85, 85, 5, 0, 85, 85, 5, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 112, 119, 85, 85, 85, 85, 
+    119, 85, 117, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 
+    0, 0, 0, 0, 0, 0, 0, 0, 117, 87, 85, 85, 117, 117, 87, 87, 
+    117, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 80, 119, 85, 85, 0, 119, 119, 85, 87, 
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 119, 87, 85, 85, 85, 117, 87, 87, 
+    0, 0, 0, 0, 0, 80, 87, 119, 85, 85, 85, 87, 0, 0, 0, 0, 
+    119, 85, 85, 87, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 119, 87, 85, 85, 85, 85, 87, 5, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 117, 119, 119, 112, 7, 80, 117, 69, 
+    71, 87, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 112, 119, 85, 85, 0, 85, 119, 119, 
+    5, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    80, 85, 85, 85, 85, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 85, 85, 117, 84, 85, 5, 
+    0, 0, 0, 80, 0, 0, 0, 0, 80, 85, 85, 117, 87, 85, 0, 0, 
+    0, 0, 68, 68, 68, 85, 85, 85, 85, 85, 85, 117, 85, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 112, 85, 85, 85, 5, 85, 85, 85, 87, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 85, 85, 85, 85, 85, 85, 
+    85, 85, 85, 85, 112, 85, 85, 85, 117, 85, 87, 5, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 80, 85, 85, 5, 0, 5, 85, 80, 
+    85, 85, 85, 84, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 119, 119, 7, 85, 112, 87, 87, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 117, 7, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 51, 51, 51, 51, 3, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 85, 85, 5, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 85, 85, 85, 5, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 80, 112, 119, 119, 119, 119, 119, 119, 119, 
+    119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 
+    119, 119, 119, 119, 0, 0, 0, 80, 85, 5, 0, 0, 0, 0, 0, 0, 
+    0, 0, 5, 0, 0, 0, 0, 0, 119, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 5, 
+    51, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 80, 87, 85, 0, 112, 85, 85, 53, 51, 51, 51, 83, 85, 85, 
+    85, 5, 80, 85, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 85, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 5, 0, 80, 85, 85, 
+    85, 85, 85, 85, 85, 85, 5, 0, 0, 0, 80, 0, 0, 0, 0, 0, 
+    0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 85, 85, 
+    80, 85, 85, 85, 85, 85, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 
+    85, 85, 85, 5, 85, 85, 85, 85, 85, 85, 85, 85, 5, 80, 85, 85, 
+    85, 80, 5, 85, 85, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 85, 85, 85, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 224, 238, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 238, 238, 238, 0, 0, 0, 0, 0, 0, 238, 
+    0, 0, 0, 0, 0, 0, 0, 14, 224, 238, 238, 238, 238, 14, 0, 0, 
+    0, 0, 0, 0, 0, 0, 224, 238, 238, 238, 238, 238, 238, 238, 238, 238, 
+    238, 238, 238, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 
+    224, 238, 238, 238, 238, 238, 238, 238, 0, 0, 0, 0, 0, 14, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 224, 0, 238, 238, 238, 238, 14, 238, 238, 
+    0, 0, 0, 0, 224, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 
+    238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 94, 85, 85, 
+    238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 0, 
+    0, 0, 0, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 
+    238, 238, 238, 238, 238, 238, 238, 238, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 238, 238, 238, 238, 238, 238, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 224, 238, 238, 238, 238, 238, 
+    0, 0, 0, 0, 0, 0, 238, 238, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 238, 238, 238, 238, 0, 0, 0, 0, 0, 238, 238, 238, 
+    0, 0, 0, 0, 238, 238, 238, 238, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 238, 238, 238, 238, 238, 238, 238, 238, 238, 
+    0, 0, 0, 0, 0, 0, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 
+    238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 14, 238, 238, 
+    238, 238, 238, 224, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 
+    85, 85, 85, 85, 85, 85, 85, 85, 51, 51, 51, 51, 51, 51, 51, 51
+};
+
+static uint32_t tmu_get_grapheme_break_property_internal(uint32_t cp) {
+    if (cp > 0x10FFFF) return 0;
+    uint32_t block_index = ((uint32_t)tmu_grapheme_break_stage_one[cp >> 10] << 5) + ((cp >> 5) & 31);
+    uint32_t offset = cp & 31;
+    uint32_t value = tmu_grapheme_break_stage_three[(uint32_t)tmu_grapheme_break_stage_two[block_index] * 16 + (offset >> 1)];
+    return (value >> ((offset & 1) * 4)) & 15;
+}
+
+/* Per-property table for width: 7608 bytes. */
+static const uint8_t tmu_width_stage_one[1088] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 13, 13, 
+    13, 13, 13, 14, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 15, 16, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 17, 18, 19, 20, 20, 20, 20, 20, 20, 21, 22, 
+    23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 33, 20, 34, 33, 33, 
+    33, 35, 33, 33, 33, 33, 33, 33, 33, 33, 36, 37, 13, 13, 13, 13, 
+    13, 38, 13, 39, 33, 33, 33, 33, 33, 33, 33, 33, 40, 33, 33, 41, 
+    33, 33, 33, 33, 42, 43, 44, 33, 45, 33, 46, 47, 48, 49, 50, 51, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 52, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 52, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 51, 
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 51
+};
+static const uint16_t tmu_width_stage_two[1696] = {
+    0, 1, 1, 2, 0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 4, 5, 6, 1, 1, 
+    1, 1, 1, 1, 7, 1, 1, 1, 1, 8, 9, 1, 10, 11, 12, 13, 
+    14, 1, 15, 8, 1, 1, 16, 17, 18, 19, 20, 1, 1, 21, 1, 22, 
+    23, 24, 25, 15, 0, 26, 27, 0, 28, 29, 30, 31, 32, 33, 34, 35, 
+    36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 
+    68, 69, 70, 0, 71, 72, 73, 0, 74, 75, 76, 77, 78, 79, 80, 0, 
+    1, 81, 82, 83, 84, 1, 85, 1, 86, 86, 86, 1, 1, 1, 1, 1, 
+    1, 1, 87, 1, 88, 89, 90, 1, 91, 1, 92, 93, 94, 1, 1, 95, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 93, 1, 1, 96, 97, 98, 99, 100, 1, 101, 102, 103, 
+    104, 1, 1, 96, 105, 106, 1, 107, 2, 108, 109, 110, 1, 111, 112, 1, 
+    113, 1, 114, 115, 103, 116, 0, 0, 117, 118, 119, 120, 121, 122, 1, 123, 
+    1, 124, 125, 1, 126, 127, 128, 129, 1, 1, 1, 1, 1, 1, 0, 0, 
+    1, 1, 1, 1, 1, 1, 1, 1, 95, 1, 130, 131, 1, 26, 132, 133, 
+    134, 135, 1, 136, 137, 1, 0, 0, 1, 1, 1, 1, 111, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 138, 139, 1, 1, 1, 1, 1, 140, 
+    1, 141, 15, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 142, 
+    143, 1, 144, 145, 146, 147, 148, 149, 150, 151, 152, 1, 153, 154, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 155, 1, 156, 157, 158, 1, 1, 1, 
+    1, 159, 2, 1, 1, 1, 1, 160, 1, 85, 1, 161, 162, 163, 163, 0, 
+    1, 1, 164, 0, 165, 86, 86, 166, 86, 86, 86, 86, 86, 86, 167, 168, 
+    86, 169, 170, 86, 171, 86, 86, 86, 172, 173, 86, 86, 174, 86, 86, 175, 
+    176, 86, 177, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 
+    86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 
+    86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 
+    86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 1, 1, 
+    86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 
+    86, 86, 86, 86, 178, 86, 179, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 180, 1, 181, 131, 1, 1, 182, 1, 1, 1, 1, 1, 1, 183, 184, 
+    185, 186, 1, 187, 1, 1, 188, 189, 1, 190, 191, 192, 28, 193, 194, 195, 
+    1, 196, 197, 198, 1, 199, 200, 201, 202, 203, 1, 111, 1, 1, 1, 204, 
+    86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 
+    86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 205, 206, 207, 
+    208, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 209, 208, 0, 0, 209, 
+    208, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 209, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 86, 86, 86, 86, 86, 86, 86, 86, 
+    86, 86, 86, 86, 86, 86, 86, 86, 210, 211, 212, 1, 1, 1, 213, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 214, 1, 215, 1, 27, 216, 
+    217, 218, 219, 220, 1, 1, 1, 93, 170, 86, 86, 221, 131, 2, 222, 223, 
+    224, 225, 226, 0, 1, 1, 1, 92, 227, 228, 1, 1, 137, 208, 214, 93, 
+    0, 0, 0, 0, 93, 1, 229, 230, 1, 231, 134, 107, 232, 1, 233, 0, 
+    1, 1, 1, 1, 131, 234, 235, 207, 1, 236, 1, 237, 0, 0, 0, 0, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 162, 107, 27, 0, 0, 0, 0, 
+    238, 239, 158, 1, 2, 240, 0, 241, 242, 243, 0, 0, 1, 244, 215, 1, 
+    245, 107, 246, 1, 1, 0, 1, 247, 1, 248, 249, 250, 251, 252, 0, 0, 
+    1, 1, 253, 0, 1, 164, 1, 254, 1, 255, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 2, 1, 256, 0, 0, 1, 236, 257, 0, 0, 214, 180, 162, 
+    258, 187, 259, 19, 121, 260, 261, 262, 28, 263, 236, 264, 121, 265, 266, 267, 
+    268, 269, 0, 0, 270, 234, 2, 271, 44, 272, 273, 274, 0, 0, 0, 0, 
+    1, 187, 275, 276, 1, 277, 278, 0, 0, 0, 0, 0, 1, 279, 230, 0, 
+    1, 280, 281, 282, 1, 283, 284, 0, 92, 285, 0, 0, 0, 0, 0, 0, 
+    1, 286, 0, 0, 0, 1, 1, 287, 288, 289, 290, 0, 0, 291, 292, 293, 
+    294, 295, 296, 1, 297, 298, 1, 96, 0, 0, 0, 0, 0, 0, 0, 0, 
+    299, 300, 301, 302, 19, 303, 0, 0, 304, 229, 305, 306, 307, 284, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 308, 0, 0, 0, 0, 0, 309, 1, 310, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 94, 0, 0, 0, 
+    1, 1, 1, 311, 1, 1, 1, 1, 1, 1, 274, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    1, 312, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 96, 2, 313, 0, 0, 214, 314, 1, 315, 316, 317, 19, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 1, 1, 92, 0, 0, 0, 1, 1, 134, 1, 318, 0, 0, 319, 
+    86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 
+    86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 320, 
+    86, 86, 86, 86, 86, 86, 167, 0, 321, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    86, 86, 86, 86, 86, 86, 86, 86, 176, 0, 322, 323, 86, 86, 86, 86, 
+    86, 86, 86, 86, 86, 86, 86, 324, 0, 0, 0, 0, 0, 0, 0, 0, 
+    1, 1, 1, 325, 326, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    1, 1, 1, 1, 1, 1, 1, 107, 1, 327, 1, 328, 329, 330, 1, 253, 
+    1, 1, 331, 0, 0, 0, 0, 332, 1, 1, 162, 96, 0, 0, 0, 0, 
+    1, 1, 26, 1, 333, 334, 335, 1, 336, 337, 338, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 339, 1, 1, 1, 1, 1, 1, 1, 1, 340, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    0, 341, 0, 342, 343, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 344, 313, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 1, 345, 0, 0, 0, 0, 0, 0, 0, 0, 
+    1, 1, 1, 1, 1, 1, 346, 0, 1, 1, 347, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 348, 1, 349, 0, 0, 68, 131, 0, 0, 0, 0, 0, 0, 
+    335, 350, 351, 352, 353, 354, 0, 355, 0, 0, 0, 0, 0, 0, 0, 0, 
+    356, 1, 1, 1, 1, 1, 357, 1, 1, 1, 1, 1, 358, 1, 1, 1, 
+    359, 360, 361, 362, 1, 1, 1, 1, 86, 363, 86, 364, 365, 86, 366, 367, 
+    86, 368, 369, 86, 86, 86, 86, 370, 86, 371, 372, 373, 374, 356, 1, 375, 
+    86, 86, 376, 1, 86, 86, 377, 378, 1, 1, 1, 1, 1, 1, 1, 379, 
+    1, 1, 1, 1, 1, 1, 1, 1, 380, 381, 382, 383, 86, 86, 384, 86, 
+    1, 1, 1, 385, 386, 387, 388, 1, 1, 1, 1, 1, 389, 1, 15, 305, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 131, 
+    86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 
+    86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 390
+};
+static const uint8_t tmu_width_stage_three[3128] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 85, 85, 85, 85, 85, 85, 85, 85, 
+    85, 85, 85, 85, 85, 85, 85, 21, 85, 85, 85, 81, 85, 85, 85, 85, 
+    0, 0, 0, 0, 85, 85, 80, 85, 0, 85, 21, 81, 85, 85, 85, 85, 
+    69, 85, 85, 85, 85, 85, 85, 85, 21, 0, 80, 85, 85, 85, 85, 85, 
+    85, 85, 85, 85, 84, 85, 85, 85, 85, 85, 85, 85, 85, 21, 84, 85, 
+    85, 85, 21, 84, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 
+    65, 16, 0, 0, 85, 85, 85, 85, 85, 85, 21, 64, 85, 1, 0, 0, 
+    0, 80, 85, 85, 0, 0, 64, 80, 85, 85, 21, 0, 0, 0, 0, 0, 
+    85, 85, 85, 85, 85, 5, 0, 16, 0, 20, 4, 80, 85, 85, 85, 85, 
+    85, 85, 85, 5, 81, 85, 85, 85, 85, 85, 85, 85, 0, 0, 0, 0, 
+    0, 0, 0, 84, 85, 85, 85, 85, 85, 5, 0, 0, 4, 0, 0, 0, 
+    85, 85, 21, 0, 0, 85, 21, 80, 85, 85, 85, 85, 85, 5, 16, 0, 
+    0, 1, 1, 0, 85, 85, 85, 21, 85, 85, 85, 85, 85, 85, 1, 16, 
+    85, 85, 85, 85, 85, 81, 85, 85, 85, 85, 0, 0, 0, 0, 0, 0, 
+    64, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 69, 84, 
+    1, 0, 84, 81, 1, 0, 85, 85, 5, 85, 85, 85, 85, 85, 85, 85, 
+    81, 84, 85, 65, 65, 85, 85, 85, 85, 85, 81, 85, 17, 80, 5, 68, 
+    1, 64, 65, 17, 0, 0, 0, 69, 5, 80, 85, 85, 85, 85, 85, 5, 
+    64, 84, 21, 64, 65, 85, 85, 85, 85, 85, 81, 85, 81, 20, 5, 80, 
+    1, 0, 0, 0, 0, 0, 84, 17, 0, 80, 85, 85, 80, 17, 0, 0, 
+    64, 84, 85, 69, 69, 85, 85, 85, 85, 85, 81, 85, 81, 84, 5, 84, 
+    1, 0, 68, 1, 1, 0, 0, 0, 5, 80, 85, 85, 5, 0, 4, 0, 
+    80, 84, 85, 65, 65, 85, 85, 85, 85, 85, 81, 85, 81, 84, 5, 4, 
+    1, 64, 65, 1, 0, 0, 0, 69, 5, 80, 85, 85, 85, 85, 0, 0, 
+    64, 84, 21, 80, 81, 5, 20, 81, 64, 1, 21, 80, 85, 85, 5, 64, 
+    20, 80, 81, 1, 1, 0, 0, 0, 0, 80, 85, 85, 85, 85, 21, 0, 
+    84, 84, 85, 81, 81, 85, 85, 85, 85, 85, 81, 85, 85, 85, 5, 4, 
+    84, 1, 0, 0, 0, 0, 21, 0, 5, 80, 85, 85, 0, 64, 85, 85, 
+    81, 85, 85, 81, 81, 85, 85, 85, 85, 85, 81, 85, 85, 84, 5, 20, 
+    69, 65, 81, 0, 0, 0, 0, 16, 5, 80, 85, 85, 20, 0, 0, 0, 
+    80, 85, 85, 81, 81, 85, 85, 85, 85, 85, 85, 85, 85, 85, 21, 68, 
+    1, 80, 81, 65, 0, 21, 85, 85, 5, 80, 85, 85, 85, 85, 85, 85, 
+    80, 84, 85, 85, 85, 21, 80, 85, 85, 85, 85, 85, 69, 85, 85, 4, 
+    85, 21, 0, 0, 5, 0, 85, 21, 0, 80, 85, 85, 80, 1, 0, 0, 
+    84, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 81, 0, 0, 64, 
+    85, 21, 0, 64, 85, 85, 85, 0, 20, 81, 21, 85, 85, 85, 85, 85, 
+    85, 68, 85, 85, 81, 0, 0, 4, 85, 17, 0, 0, 85, 85, 5, 85, 
+    85, 85, 85, 85, 85, 85, 80, 85, 85, 85, 85, 85, 85, 17, 81, 85, 
+    85, 85, 84, 85, 85, 85, 85, 85, 85, 85, 85, 1, 0, 0, 0, 64, 
+    0, 4, 85, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 
+    85, 69, 85, 81, 85, 85, 21, 0, 85, 85, 85, 1, 4, 0, 65, 65, 
+    85, 85, 85, 85, 85, 85, 80, 5, 84, 85, 85, 85, 1, 84, 85, 85, 
+    69, 65, 85, 81, 85, 85, 85, 81, 85, 69, 0, 4, 85, 85, 85, 85, 
+    170, 170, 170, 170, 170, 170, 170, 170, 85, 85, 81, 5, 85, 21, 81, 5, 
+    85, 85, 81, 5, 85, 85, 85, 85, 85, 85, 85, 85, 81, 5, 85, 21, 
+    81, 5, 85, 85, 85, 21, 85, 85, 85, 85, 85, 85, 81, 5, 85, 85, 
+    85, 85, 85, 85, 85, 85, 21, 0, 85, 85, 85, 85, 85, 85, 85, 1, 
+    85, 85, 85, 85, 85, 85, 5, 0, 85, 85, 85, 85, 85, 5, 85, 5, 
+    85, 85, 85, 85, 85, 85, 1, 0, 85, 85, 85, 81, 5, 0, 0, 0, 
+    85, 85, 85, 85, 5, 20, 0, 0, 85, 85, 85, 85, 5, 0, 0, 0, 
+    85, 85, 85, 81, 1, 0, 0, 0, 85, 85, 85, 85, 85, 16, 0, 80, 
+    85, 69, 1, 0, 0, 85, 85, 1, 85, 85, 5, 0, 85, 85, 5, 0, 
+    85, 85, 21, 0, 85, 85, 5, 0, 85, 65, 85, 85, 85, 85, 85, 85, 
+    85, 85, 17, 0, 85, 85, 85, 85, 85, 85, 85, 85, 85, 5, 0, 0, 
+    64, 21, 84, 0, 69, 85, 1, 0, 1, 85, 85, 85, 85, 85, 85, 85, 
+    85, 85, 85, 5, 85, 1, 0, 0, 85, 85, 85, 0, 85, 85, 85, 85, 
+    85, 85, 5, 0, 85, 85, 21, 80, 85, 85, 85, 85, 85, 21, 20, 80, 
+    85, 85, 85, 85, 85, 69, 0, 0, 68, 1, 0, 84, 21, 0, 0, 0, 
+    85, 85, 85, 5, 0, 0, 0, 0, 0, 85, 85, 85, 85, 85, 85, 85, 
+    85, 85, 85, 85, 85, 0, 64, 84, 69, 85, 85, 0, 85, 85, 85, 85, 
+    85, 85, 21, 0, 0, 85, 85, 1, 80, 85, 85, 85, 85, 85, 85, 85, 
+    5, 80, 16, 80, 85, 85, 85, 85, 85, 69, 80, 17, 80, 0, 0, 85, 
+    85, 85, 85, 0, 0, 5, 64, 85, 85, 85, 5, 84, 85, 85, 85, 85, 
+    85, 85, 1, 0, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 21, 84, 
+    85, 85, 0, 0, 64, 0, 0, 0, 4, 0, 84, 81, 85, 84, 16, 0, 
+    85, 5, 85, 5, 85, 85, 68, 68, 85, 85, 85, 85, 85, 85, 85, 5, 
+    85, 81, 85, 85, 85, 80, 85, 84, 85, 85, 85, 85, 80, 81, 85, 21, 
+    85, 85, 21, 0, 85, 85, 85, 85, 85, 85, 0, 64, 85, 85, 85, 85, 
+    0, 0, 0, 0, 5, 85, 85, 85, 85, 85, 85, 21, 85, 85, 85, 1, 
+    85, 85, 85, 85, 85, 85, 165, 85, 85, 85, 105, 85, 85, 85, 85, 85, 
+    85, 85, 169, 86, 150, 85, 85, 85, 85, 21, 0, 0, 0, 0, 0, 0, 
+    85, 85, 85, 85, 85, 85, 85, 105, 85, 85, 85, 85, 85, 90, 85, 85, 
+    85, 85, 170, 170, 170, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 149, 
+    85, 85, 85, 85, 149, 85, 85, 85, 89, 85, 165, 85, 85, 85, 85, 105, 
+    85, 90, 85, 101, 85, 86, 85, 85, 85, 85, 101, 85, 165, 89, 101, 89, 
+    85, 89, 165, 85, 85, 85, 85, 85, 85, 85, 86, 85, 85, 85, 85, 85, 
+    85, 85, 85, 102, 149, 154, 85, 85, 85, 85, 85, 85, 85, 169, 85, 85, 
+    85, 85, 85, 85, 86, 85, 85, 149, 85, 85, 85, 85, 85, 85, 149, 86, 
+    85, 85, 85, 85, 86, 89, 85, 85, 85, 85, 85, 85, 85, 80, 85, 85, 
+    85, 85, 85, 85, 85, 69, 85, 85, 85, 85, 85, 21, 85, 85, 85, 85, 
+    85, 85, 85, 21, 80, 0, 84, 85, 85, 85, 0, 64, 1, 0, 0, 0, 
+    85, 85, 85, 85, 85, 21, 0, 0, 85, 21, 85, 21, 85, 21, 85, 21, 
+    85, 85, 85, 85, 21, 0, 0, 0, 170, 170, 170, 170, 170, 170, 138, 170, 
+    170, 170, 170, 170, 170, 0, 0, 0, 170, 170, 170, 170, 170, 10, 0, 0, 
+    0, 0, 0, 0, 170, 170, 170, 0, 170, 170, 10, 0, 170, 170, 170, 106, 
+    168, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 42, 128, 170, 
+    0, 168, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 168, 170, 170, 170, 
+    170, 170, 170, 42, 170, 170, 170, 170, 170, 0, 0, 0, 170, 170, 170, 170, 
+    170, 170, 170, 170, 170, 170, 170, 42, 170, 170, 85, 85, 170, 170, 170, 170, 
+    170, 170, 170, 2, 170, 170, 170, 170, 170, 42, 0, 0, 85, 85, 85, 85, 
+    85, 85, 85, 0, 0, 0, 0, 0, 85, 85, 85, 21, 64, 0, 0, 80, 
+    85, 85, 85, 85, 80, 85, 0, 0, 80, 85, 21, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 84, 85, 85, 69, 69, 21, 85, 85, 85, 85, 85, 
+    85, 65, 85, 0, 85, 85, 5, 0, 85, 85, 85, 85, 85, 85, 0, 0, 
+    85, 0, 0, 80, 85, 85, 5, 0, 0, 0, 0, 0, 80, 85, 85, 21, 
+    85, 5, 0, 80, 85, 85, 85, 85, 85, 21, 0, 0, 80, 0, 0, 64, 
+    170, 170, 170, 170, 170, 170, 170, 2, 85, 85, 85, 85, 21, 5, 80, 80, 
+    85, 85, 85, 69, 85, 85, 5, 80, 85, 81, 85, 85, 85, 85, 85, 21, 
+    85, 85, 1, 64, 65, 1, 0, 0, 21, 85, 85, 4, 85, 85, 5, 85, 
+    85, 85, 85, 85, 85, 85, 85, 84, 85, 85, 85, 85, 4, 20, 84, 5, 
+    17, 0, 0, 0, 0, 0, 64, 85, 85, 85, 85, 80, 85, 5, 0, 0, 
+    84, 21, 84, 21, 84, 21, 0, 0, 85, 21, 85, 21, 85, 85, 85, 85, 
+    85, 81, 84, 1, 85, 85, 5, 0, 170, 0, 0, 0, 85, 85, 85, 85, 
+    85, 21, 64, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 
+    85, 21, 0, 0, 64, 85, 0, 68, 85, 85, 85, 85, 85, 21, 85, 17, 
+    69, 81, 85, 85, 85, 85, 85, 85, 5, 0, 0, 0, 64, 85, 85, 85, 
+    0, 0, 0, 0, 85, 85, 85, 85, 85, 85, 85, 85, 80, 85, 85, 85, 
+    0, 0, 0, 0, 85, 85, 85, 5, 0, 0, 0, 0, 170, 170, 10, 0, 
+    0, 0, 0, 0, 170, 170, 170, 170, 170, 170, 170, 170, 42, 170, 170, 170, 
+    170, 42, 170, 0, 85, 81, 85, 85, 86, 85, 85, 85, 85, 85, 85, 85, 
+    80, 85, 80, 85, 80, 85, 80, 1, 170, 42, 85, 21, 0, 0, 0, 5, 
+    85, 85, 85, 84, 85, 85, 85, 85, 85, 21, 85, 85, 85, 85, 21, 69, 
+    85, 85, 85, 5, 85, 85, 85, 5, 21, 64, 85, 85, 85, 85, 85, 85, 
+    85, 85, 85, 85, 85, 64, 85, 85, 85, 85, 85, 85, 1, 0, 0, 0, 
+    84, 85, 85, 85, 85, 85, 85, 0, 85, 0, 0, 84, 85, 85, 85, 85, 
+    85, 85, 85, 85, 85, 85, 85, 69, 85, 0, 85, 85, 85, 5, 0, 0, 
+    85, 85, 5, 0, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 85, 85, 
+    85, 85, 0, 0, 85, 85, 85, 85, 85, 0, 0, 64, 0, 0, 0, 0, 
+    85, 5, 81, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 69, 1, 65, 
+    0, 64, 85, 85, 0, 0, 0, 0, 85, 85, 85, 85, 21, 5, 64, 85, 
+    85, 85, 85, 85, 85, 85, 85, 64, 85, 85, 85, 85, 85, 85, 5, 64, 
+    85, 85, 85, 85, 85, 85, 0, 85, 1, 0, 0, 0, 85, 84, 84, 85, 
+    85, 85, 1, 0, 85, 85, 1, 0, 85, 1, 64, 85, 85, 21, 0, 0, 
+    85, 85, 85, 85, 85, 5, 84, 85, 85, 85, 85, 85, 85, 5, 85, 85, 
+    85, 85, 85, 85, 21, 0, 85, 85, 85, 85, 85, 85, 5, 0, 84, 1, 
+    0, 0, 84, 85, 0, 0, 0, 0, 85, 85, 1, 0, 0, 0, 0, 0, 
+    85, 85, 85, 85, 21, 0, 80, 85, 85, 0, 0, 0, 85, 85, 5, 0, 
+    85, 85, 5, 4, 5, 0, 0, 0, 85, 5, 0, 0, 84, 85, 5, 0, 
+    81, 85, 85, 85, 85, 85, 85, 85, 0, 64, 85, 5, 80, 85, 85, 85, 
+    85, 85, 85, 85, 21, 64, 65, 81, 5, 0, 0, 0, 85, 85, 85, 85, 
+    85, 85, 1, 0, 85, 85, 5, 0, 85, 21, 0, 1, 0, 80, 85, 85, 
+    85, 85, 85, 85, 21, 21, 0, 0, 85, 85, 85, 85, 85, 5, 0, 64, 
+    5, 85, 1, 20, 85, 85, 85, 85, 84, 85, 85, 85, 85, 1, 0, 0, 
+    85, 85, 85, 85, 69, 85, 85, 85, 85, 85, 85, 21, 80, 4, 85, 5, 
+    85, 21, 81, 69, 85, 85, 85, 69, 21, 0, 0, 0, 85, 85, 5, 0, 
+    85, 85, 81, 85, 81, 84, 5, 68, 84, 65, 65, 5, 1, 0, 0, 84, 
+    85, 0, 0, 0, 0, 0, 0, 0, 5, 68, 85, 85, 85, 85, 85, 68, 
+    5, 0, 0, 0, 0, 0, 0, 0, 85, 85, 85, 85, 20, 0, 68, 17, 
+    4, 85, 0, 0, 85, 85, 5, 0, 85, 85, 85, 21, 5, 0, 85, 16, 
+    85, 85, 85, 85, 21, 0, 64, 17, 84, 1, 0, 0, 85, 85, 5, 0, 
+    85, 85, 85, 1, 0, 0, 0, 0, 85, 85, 21, 81, 0, 16, 1, 0, 
+    85, 85, 5, 0, 0, 0, 0, 0, 5, 16, 0, 0, 85, 85, 85, 85, 
+    85, 85, 85, 21, 0, 0, 65, 0, 85, 85, 85, 85, 21, 0, 0, 64, 
+    85, 21, 4, 85, 85, 20, 85, 85, 85, 85, 85, 85, 84, 69, 1, 4, 
+    17, 21, 0, 0, 85, 85, 5, 0, 85, 85, 80, 85, 85, 85, 85, 85, 
+    85, 85, 85, 85, 85, 0, 0, 85, 84, 1, 0, 0, 0, 0, 0, 0, 
+    1, 0, 64, 85, 85, 85, 85, 85, 85, 85, 85, 85, 21, 0, 4, 64, 
+    85, 21, 0, 0, 1, 64, 1, 85, 85, 0, 0, 0, 0, 64, 80, 85, 
+    21, 0, 0, 0, 0, 0, 0, 0, 85, 85, 81, 85, 85, 85, 85, 85, 
+    85, 85, 85, 85, 0, 0, 0, 16, 85, 5, 0, 0, 85, 85, 85, 85, 
+    85, 85, 85, 1, 85, 85, 85, 85, 0, 0, 4, 0, 4, 1, 0, 0, 
+    85, 21, 69, 85, 85, 85, 85, 85, 0, 0, 0, 0, 85, 85, 5, 0, 
+    85, 69, 81, 85, 85, 85, 85, 85, 85, 85, 85, 21, 64, 17, 1, 0, 
+    85, 85, 85, 85, 21, 84, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+    85, 85, 85, 85, 5, 0, 0, 64, 85, 85, 85, 21, 85, 1, 0, 0, 
+    85, 85, 85, 21, 0, 0, 0, 0, 85, 85, 5, 80, 0, 0, 0, 0, 
+    85, 85, 85, 5, 0, 4, 0, 0, 85, 85, 85, 85, 0, 64, 85, 85, 
+    85, 5, 0, 0, 85, 85, 69, 85, 69, 85, 85, 85, 85, 85, 0, 84, 
+    85, 85, 0, 0, 64, 85, 85, 85, 170, 0, 0, 0, 10, 0, 0, 0, 
+    170, 170, 170, 170, 170, 170, 0, 0, 170, 170, 2, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 42, 0, 0, 0, 0, 170, 0, 0, 170, 170, 170, 170, 
+    170, 170, 170, 170, 170, 170, 170, 0, 85, 85, 21, 0, 85, 85, 85, 1, 
+    85, 85, 1, 0, 85, 85, 5, 65, 85, 21, 84, 85, 85, 85, 85, 85, 
+    85, 17, 80, 5, 0, 0, 0, 0, 64, 1, 0, 85, 85, 85, 85, 85, 
+    85, 85, 5, 80, 85, 85, 85, 85, 5, 4, 0, 0, 0, 0, 0, 0, 
+    85, 85, 85, 85, 85, 0, 0, 0, 85, 85, 85, 85, 85, 85, 85, 81, 
+    16, 20, 84, 81, 85, 85, 69, 84, 85, 84, 85, 85, 85, 85, 85, 85, 
+    85, 69, 21, 84, 85, 81, 85, 81, 85, 85, 85, 85, 85, 85, 69, 21, 
+    85, 17, 80, 85, 81, 85, 85, 85, 85, 5, 85, 85, 85, 85, 85, 85, 
+    85, 85, 85, 80, 85, 85, 85, 85, 0, 0, 0, 0, 0, 64, 21, 0, 
+    0, 0, 0, 84, 85, 81, 85, 85, 85, 84, 85, 0, 0, 0, 0, 0, 
+    85, 85, 85, 1, 0, 64, 85, 5, 85, 85, 85, 0, 85, 85, 5, 64, 
+    85, 65, 85, 85, 0, 0, 0, 0, 85, 0, 64, 0, 85, 85, 5, 80, 
+    0, 0, 0, 0, 84, 85, 85, 85, 85, 85, 85, 85, 85, 1, 0, 0, 
+    20, 65, 84, 85, 21, 85, 68, 0, 16, 64, 68, 84, 20, 65, 68, 68, 
+    20, 65, 21, 85, 21, 85, 84, 17, 85, 85, 69, 85, 85, 85, 85, 0, 
+    84, 84, 69, 85, 85, 85, 85, 0, 0, 0, 0, 0, 5, 0, 0, 0, 
+    85, 86, 85, 85, 85, 85, 85, 85, 85, 85, 85, 149, 85, 85, 85, 85, 
+    85, 85, 85, 101, 169, 170, 106, 85, 106, 85, 85, 85, 170, 170, 170, 170, 
+    170, 170, 170, 170, 170, 170, 170, 85, 170, 170, 86, 85, 90, 85, 85, 85, 
+    170, 90, 85, 85, 85, 85, 85, 85, 86, 85, 85, 169, 170, 154, 170, 170, 
+    170, 170, 170, 170, 170, 170, 170, 166, 170, 170, 170, 170, 170, 85, 85, 85, 
+    170, 170, 106, 149, 170, 85, 85, 85, 170, 170, 170, 170, 86, 86, 42, 0, 
+    170, 170, 170, 170, 170, 170, 170, 106, 166, 170, 170, 170, 170, 170, 170, 170, 
+    170, 170, 170, 170, 170, 170, 170, 150, 170, 170, 170, 170, 170, 170, 170, 90, 
+    85, 85, 149, 106, 170, 170, 170, 170, 170, 170, 85, 85, 85, 85, 101, 85, 
+    85, 85, 85, 85, 85, 105, 85, 85, 85, 85, 85, 85, 85, 85, 149, 170, 
+    170, 170, 170, 170, 85, 85, 85, 85, 170, 90, 85, 86, 106, 169, 85, 85, 
+    85, 85, 149, 86, 85, 170, 170, 86, 170, 170, 170, 85, 85, 85, 85, 85, 
+    85, 85, 85, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 106, 170, 
+    170, 154, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 166, 170, 
+    170, 170, 170, 169, 170, 170, 170, 170, 85, 85, 85, 85, 170, 86, 106, 85, 
+    170, 106, 85, 85, 170, 170, 170, 170, 170, 170, 86, 85, 170, 106, 85, 85, 
+    106, 85, 85, 85, 170, 106, 85, 85, 85, 85, 85, 85, 21, 85, 85, 85, 
+    170, 170, 170, 170, 170, 170, 170, 10
+};
+
+static uint32_t tmu_get_width_property_internal(uint32_t cp) {
+    if (cp > 0x10FFFF) return 0;
+    uint32_t block_index = ((uint32_t)tmu_width_stage_one[cp >> 10] << 5) + ((cp >> 5) & 31);
+    uint32_t offset = cp & 31;
+    uint32_t value = tmu_width_stage_three[(uint32_t)tmu_width_stage_two[block_index] * 8 + (offset >> 2)];
+    return (value >> ((offset & 3) * 2)) & 3;
+}
+
 TMU_UCD_DEF tmu_ucd_entry tmu_ucd_get_entry(uint32_t codepoint) {
     const tmu_ucd_internal* internal = tmu_get_ucd_internal(codepoint);
     tmu_ucd_entry result;
-    result.category = (tmu_ucd_category_enum)((internal->bits0 >> 0) & 7);
-    result.case_info = (tmu_ucd_case_info_enum)((internal->bits0 >> 3) & 3);
+    result.category = (tmu_ucd_category_enum)tmu_get_category_property_internal(codepoint);
+    result.case_info = (tmu_ucd_case_info_enum)tmu_get_case_info_property_internal(codepoint);
     result.grapheme_break =
-        (tmu_ucd_grapheme_break_enum)((internal->bits1 >> 0) & 15);
-    result.width = (int8_t)((internal->bits1 >> 4) & 7);
+        (tmu_ucd_grapheme_break_enum)tmu_get_grapheme_break_property_internal(codepoint);
+    result.width = (int8_t)tmu_get_width_property_internal(codepoint);
     result.simple_upper = codepoint + internal->simple_upper_offset;
     result.simple_title = codepoint + internal->simple_title_offset;
     result.simple_lower = codepoint + internal->simple_lower_offset;
@@ -7104,23 +10556,31 @@ TMU_UCD_DEF tmu_ucd_entry tmu_ucd_get_entry(uint32_t codepoint) {
 }
 
 TMU_UCD_DEF tmu_ucd_category_enum tmu_ucd_get_category(uint32_t codepoint) {
-    const tmu_ucd_internal* internal = tmu_get_ucd_internal(codepoint);
-    return (tmu_ucd_category_enum)((internal->bits0 >> 0) & 7);
+    return (tmu_ucd_category_enum)tmu_get_category_property_internal(codepoint);
 }
 
 TMU_UCD_DEF int tmu_ucd_is_whitespace(uint32_t codepoint) {
-    const tmu_ucd_internal* internal = tmu_get_ucd_internal(codepoint);
-    return (internal->bits0 & 64) != 0;
+    return tmu_get_whitespace_property_internal(codepoint) != 0;
 }
 
 TMU_UCD_DEF tmu_ucd_case_info_enum tmu_ucd_get_case_info(uint32_t codepoint) {
-    const tmu_ucd_internal* internal = tmu_get_ucd_internal(codepoint);
-    return (tmu_ucd_case_info_enum)((internal->bits0 >> 3) & 3);
+    return (tmu_ucd_case_info_enum)tmu_get_case_info_property_internal(codepoint);
+}
+
+TMU_UCD_DEF tmu_ucd_grapheme_break_enum tmu_ucd_get_grapheme_break(uint32_t codepoint) {
+    return (tmu_ucd_grapheme_break_enum)tmu_get_grapheme_break_property_internal(codepoint);
 }
 
 TMU_UCD_DEF int tmu_ucd_get_width(uint32_t codepoint) {
-    const tmu_ucd_internal* internal = tmu_get_ucd_internal(codepoint);
-    return (int)((internal->bits1 >> 4) & 7);
+    return (int)tmu_get_width_property_internal(codepoint);
+}
+
+TMU_UCD_DEF tmu_ucd_word_break_enum tmu_ucd_get_word_break(uint32_t codepoint) {
+    return (tmu_ucd_word_break_enum)tmu_get_word_break_property_internal(codepoint);
+}
+
+TMU_UCD_DEF tmu_ucd_sentence_break_enum tmu_ucd_get_sentence_break(uint32_t codepoint) {
+    return (tmu_ucd_sentence_break_enum)tmu_get_sentence_break_property_internal(codepoint);
 }
 
 #ifdef __cplusplus
@@ -24,6 +24,51 @@ typedef enum {
     tmu_grapheme_break_count
 } tmu_ucd_grapheme_break_enum;
 
+typedef enum {
+    tmu_word_break_other,
+    tmu_word_break_cr,
+    tmu_word_break_lf,
+    tmu_word_break_newline,
+    tmu_word_break_extend,
+    tmu_word_break_zwj,
+    tmu_word_break_regional_indicator,
+    tmu_word_break_format,
+    tmu_word_break_katakana,
+    tmu_word_break_hebrew_letter,
+    tmu_word_break_aletter,
+    tmu_word_break_single_quote,
+    tmu_word_break_double_quote,
+    tmu_word_break_midnumlet,
+    tmu_word_break_midletter,
+    tmu_word_break_midnum,
+    tmu_word_break_numeric,
+    tmu_word_break_extendnumlet,
+    tmu_word_break_wsegspace,
+    tmu_word_break_extended_pictographic,
+
+    tmu_word_break_count
+} tmu_ucd_word_break_enum;
+
+typedef enum {
+    tmu_sentence_break_other,
+    tmu_sentence_break_cr,
+    tmu_sentence_break_lf,
+    tmu_sentence_break_extend,
+    tmu_sentence_break_sep,
+    tmu_sentence_break_format,
+    tmu_sentence_break_sp,
+    tmu_sentence_break_lower,
+    tmu_sentence_break_upper,
+    tmu_sentence_break_oletter,
+    tmu_sentence_break_numeric,
+    tmu_sentence_break_aterm,
+    tmu_sentence_break_scontinue,
+    tmu_sentence_break_sterm,
+    tmu_sentence_break_close,
+
+    tmu_sentence_break_count
+} tmu_ucd_sentence_break_enum;
+
 typedef enum {
     tmu_ucd_case_caseless,
     tmu_ucd_case_upper,
@@ -65,6 +110,9 @@ TMU_UCD_DEF tmu_ucd_category_enum tmu_ucd_get_category(uint32_t codepoint);
 TMU_UCD_DEF int tmu_ucd_is_whitespace(uint32_t codepoint);
 TMU_UCD_DEF tmu_ucd_case_info_enum tmu_ucd_get_case_info(uint32_t codepoint);
 TMU_UCD_DEF int tmu_ucd_get_width(uint32_t codepoint);
+TMU_UCD_DEF tmu_ucd_grapheme_break_enum tmu_ucd_get_grapheme_break(uint32_t codepoint);
+TMU_UCD_DEF tmu_ucd_word_break_enum tmu_ucd_get_word_break(uint32_t codepoint);
+TMU_UCD_DEF tmu_ucd_sentence_break_enum tmu_ucd_get_sentence_break(uint32_t codepoint);
 
 #define TMU_UCD_HAS_CASE_INFO 1
 #define TMU_UCD_HAS_CATEGORY 1
@@ -78,6 +126,8 @@ TMU_UCD_DEF int tmu_ucd_get_width(uint32_t codepoint);
 #define TMU_UCD_HAS_SIMPLE_CASE 1
 #define TMU_UCD_HAS_SIMPLE_CASE_FOLD 1
 #define TMU_UCD_HAS_SIMPLE_CASE_TOGGLE 1
+#define TMU_UCD_HAS_WORD_BREAK 1
+#define TMU_UCD_HAS_SENTENCE_BREAK 1
 
 #ifdef __cplusplus
 }
@@ -123,17 +123,83 @@ TEST_CASE("convert raw bytes") {
     do_test(utf16le_bom, size(utf16le_bom), tmu_encoding_unknown);
     do_test(utf16le_bom, size(utf16le_bom), tmu_encoding_utf16le_bom);
 
-    // Can't detect utf16 without bom.
-    // do_test(utf16le_bom + 2, size(utf16le_bom) - 2, tmu_encoding_unknown);
+    // Utf16 without bom is detected by the zero octets of the ascii part.
+    do_test(utf16le_bom + 2, size(utf16le_bom) - 2, tmu_encoding_unknown);
     do_test(utf16le_bom + 2, size(utf16le_bom) - 2, tmu_encoding_utf16le);
 
     do_test(utf16be_bom, size(utf16be_bom), tmu_encoding_unknown);
     do_test(utf16be_bom, size(utf16be_bom), tmu_encoding_utf16be_bom);
 
-    // do_test(utf16be_bom + 2, size(utf16be_bom) - 2, tmu_encoding_unknown);
+    do_test(utf16be_bom + 2, size(utf16be_bom) - 2, tmu_encoding_unknown);
     do_test(utf16be_bom + 2, size(utf16be_bom) - 2, tmu_encoding_utf16be);
 }
 
+TEST_CASE("detect encoding") {
+    auto detect = [](const void* in, size_t in_len) { return tmu_detect_encoding(in, (tm_size_t)in_len); };
+
+    CHECK(detect(utf8_bom, size(utf8_bom)).encoding == tmu_encoding_utf8_bom);
+    CHECK(detect(utf8_bom, size(utf8_bom)).confidence == 100);
+    CHECK(detect(utf16le_bom, size(utf16le_bom)).encoding == tmu_encoding_utf16le_bom);
+    CHECK(detect(utf16be_bom, size(utf16be_bom)).encoding == tmu_encoding_utf16be_bom);
+
+    auto utf8 = detect(utf8_bom + 3, size(utf8_bom) - 3);
+    CHECK(utf8.encoding == tmu_encoding_utf8);
+    CHECK(utf8.confidence == 100);
+    auto ascii = detect("plain ascii", 11);
+    CHECK(ascii.encoding == tmu_encoding_utf8);
+    CHECK(ascii.confidence >= 50);
+    CHECK(detect("", 0).encoding == tmu_encoding_utf8);
+
+    auto utf16le = detect(utf16le_bom + 2, size(utf16le_bom) - 2);
+    CHECK(utf16le.encoding == tmu_encoding_utf16le);
+    CHECK(utf16le.confidence >= 50);
+    auto utf16be = detect(utf16be_bom + 2, size(utf16be_bom) - 2);
+    CHECK(utf16be.encoding == tmu_encoding_utf16be);
+    CHECK(utf16be.confidence >= 50);
+    // Odd length can't be utf16.
+    CHECK(detect(utf16le_bom + 2, size(utf16le_bom) - 3).encoding == tmu_encoding_utf8);
+
+    vector<uint8_t> utf32le;
+    vector<uint8_t> utf32be;
+    auto stream = tmu_utf8_make_stream_n((const char*)utf8_bom + 3, (tm_size_t)size(utf8_bom) - 3);
+    uint32_t codepoint = 0;
+    while (tmu_utf8_extract(&stream, &codepoint)) {
+        for (int i = 0; i < 4; ++i) {
+            utf32le.push_back((uint8_t)(codepoint >> (i * 8)));
+            utf32be.push_back((uint8_t)(codepoint >> ((3 - i) * 8)));
+        }
+    }
+    CHECK(detect(utf32le.data(), utf32le.size()).encoding == tmu_encoding_utf32le);
+    CHECK(detect(utf32be.data(), utf32be.size()).encoding == tmu_encoding_utf32be);
+
+    // Conversion with unknown encoding uses the detected encoding.
+    char expected[100];
+    char converted[100];
+    auto expected_result = tmu_utf8_convert_from_bytes(utf32be.data(), (tm_size_t)utf32be.size(),
+                                                       tmu_encoding_utf32be, tmu_validate_error, nullptr, 0,
+                                                       /*nullterminate=*/false, expected, (tm_size_t)size(expected));
+    auto converted_result = tmu_utf8_convert_from_bytes(utf32be.data(), (tm_size_t)utf32be.size(),
+                                                        tmu_encoding_unknown, tmu_validate_error, nullptr, 0,
+                                                        /*nullterminate=*/false, converted, (tm_size_t)size(converted));
+    REQUIRE(expected_result.ec == TM_OK);
+    REQUIRE(converted_result.ec == TM_OK);
+    CHECK(converted_result.original_encoding == tmu_encoding_utf32be);
+    CHECK(string_view(converted, (size_t)converted_result.size) == string_view(expected, (size_t)expected_result.size));
+
+    // Same for the streaming transcoder, which buffers the input until the encoding can be detected.
+    auto transcoder = tmu_utf8_make_transcoder(tmu_encoding_unknown, tmu_validate_error, nullptr, 0);
+    auto transcoded = tmu_utf8_transcode(&transcoder, utf16le_bom + 2, (tm_size_t)size(utf16le_bom) - 2, converted,
+                                         (tm_size_t)size(converted));
+    REQUIRE(transcoded.ec == TM_OK);
+    CHECK(transcoded.consumed == (tm_size_t)size(utf16le_bom) - 2);
+    CHECK(transcoded.size == 0);
+    auto finished = tmu_utf8_transcode_finish(&transcoder, converted, (tm_size_t)size(converted));
+    REQUIRE(finished.ec == TM_OK);
+    CHECK(transcoder.original_encoding == tmu_encoding_utf16le);
+    auto expected_utf8 = string_view((const char*)utf8_bom + 3, size(utf8_bom) - 3);
+    CHECK(string_view(converted, (size_t)finished.size) == expected_utf8);
+}
+
 TEST_CASE("nulltermination") {
     {
         const char* empty = "";
@@ -224,6 +290,148 @@ TEST_CASE("invalid unicode") {
     do_test(tmu_validate_replace, "XXXXXXXXXXXXXXX", 15, true);
 }
 
+TEST_CASE("streaming transcoder") {
+    struct transcoded {
+        string output;
+        tm_errc ec;
+        tmu_encoding original_encoding;
+    };
+
+    auto transcode = [](const void* in, size_t in_len, tmu_encoding encoding, tmu_validate validate,
+                        const char* replace_str, size_t chunk_size, size_t out_size) {
+        auto replace_str_len = (replace_str) ? (tm_size_t)strlen(replace_str) : 0;
+        auto transcoder = tmu_utf8_make_transcoder(encoding, validate, replace_str, replace_str_len);
+        transcoded result = {string{}, TM_OK, tmu_encoding_unknown};
+        vector<char> out(out_size);
+
+        const char* cur = (const char*)in;
+        size_t remaining = in_len;
+        while (remaining) {
+            size_t chunk_len = (remaining < chunk_size) ? remaining : chunk_size;
+            while (chunk_len) {
+                auto r = tmu_utf8_transcode(&transcoder, cur, (tm_size_t)chunk_len, out.data(), (tm_size_t)out_size);
+                result.output.append(out.data(), (size_t)r.size);
+                if (r.ec != TM_OK) {
+                    result.ec = r.ec;
+                    return result;
+                }
+                REQUIRE(r.consumed <= chunk_len);
+                cur += r.consumed;
+                chunk_len -= (size_t)r.consumed;
+                remaining -= (size_t)r.consumed;
+            }
+        }
+        for (;;) {
+            auto r = tmu_utf8_transcode_finish(&transcoder, out.data(), (tm_size_t)out_size);
+            result.output.append(out.data(), (size_t)r.size);
+            result.ec = r.ec;
+            if (r.ec != TM_ERANGE) break;
+            REQUIRE(r.size > 0);
+        }
+        result.original_encoding = transcoder.original_encoding;
+        return result;
+    };
+
+    auto do_test = [&](const void* in, size_t in_len, tmu_encoding encoding, tmu_validate validate,
+                       const char* replace_str) {
+        auto replace_str_len = (replace_str) ? (tm_size_t)strlen(replace_str) : 0;
+        auto required = tmu_utf8_convert_from_bytes(in, (tm_size_t)in_len, encoding, validate, replace_str,
+                                                    replace_str_len, /*nullterminate=*/false, nullptr, 0);
+        vector<char> expected((size_t)required.size);
+        auto converted = tmu_utf8_convert_from_bytes(in, (tm_size_t)in_len, encoding, validate, replace_str,
+                                                     replace_str_len, /*nullterminate=*/false, expected.data(),
+                                                     (tm_size_t)expected.size());
+
+        for (size_t chunk_size : {1, 2, 3, 5, 7, 64, 4096}) {
+            for (size_t out_size : {16, 17, 100, 4096}) {
+                auto streamed = transcode(in, in_len, encoding, validate, replace_str, chunk_size, out_size);
+                if (converted.ec == TM_OK) {
+                    REQUIRE(streamed.ec == TM_OK);
+                    REQUIRE(streamed.original_encoding == converted.original_encoding);
+                    REQUIRE(streamed.output == string(expected.data(), (size_t)converted.size));
+                } else {
+                    REQUIRE(streamed.ec == TM_EINVAL);
+                }
+            }
+        }
+    };
+
+    for (auto validate : {tmu_validate_skip, tmu_validate_error, tmu_validate_replace}) {
+        const char* replace_str = (validate == tmu_validate_replace) ? "XXXXXXXXXXXXXXX" : nullptr;
+
+        do_test(utf8_bom, size(utf8_bom), tmu_encoding_unknown, validate, replace_str);
+        do_test(utf8_bom, size(utf8_bom), tmu_encoding_utf8_bom, validate, replace_str);
+        do_test(utf8_bom + 3, size(utf8_bom) - 3, tmu_encoding_utf8, validate, replace_str);
+        do_test(utf8_bom + 3, size(utf8_bom) - 3, tmu_encoding_utf8_bom, validate, replace_str);
+        do_test(utf16le_bom, size(utf16le_bom), tmu_encoding_unknown, validate, replace_str);
+        do_test(utf16le_bom, size(utf16le_bom), tmu_encoding_utf16le_bom, validate, replace_str);
+        do_test(utf16le_bom + 2, size(utf16le_bom) - 2, tmu_encoding_utf16le, validate, replace_str);
+        do_test(utf16be_bom, size(utf16be_bom), tmu_encoding_unknown, validate, replace_str);
+        do_test(utf16be_bom + 2, size(utf16be_bom) - 2, tmu_encoding_utf16be, validate, replace_str);
+        // Trailing odd octet.
+        do_test(utf16be_bom, size(utf16be_bom) - 1, tmu_encoding_utf16be_bom, validate, replace_str);
+
+        // Lone and unpaired surrogates.
+        const uint8_t utf16le_invalid[] = {0x61, 0x00, 0x00, 0xD8, 0x62, 0x00, 0x00, 0xDC, 0x63,
+                                           0x00, 0x3D, 0xD8, 0x00, 0xDE, 0x00, 0xD8};
+        do_test(utf16le_invalid, size(utf16le_invalid), tmu_encoding_utf16le, validate, replace_str);
+
+        // Utf32 in both byte orders, including codepoints outside of the valid range.
+        vector<uint8_t> utf32le = {0xFF, 0xFE, 0x00, 0x00};
+        vector<uint8_t> utf32be = {0x00, 0x00, 0xFE, 0xFF};
+        auto stream = tmu_utf8_make_stream_n((const char*)utf8_bom + 3, (tm_size_t)size(utf8_bom) - 3);
+        uint32_t codepoint = 0;
+        while (tmu_utf8_extract(&stream, &codepoint)) {
+            for (int i = 0; i < 4; ++i) {
+                utf32le.push_back((uint8_t)(codepoint >> (i * 8)));
+                utf32be.push_back((uint8_t)(codepoint >> ((3 - i) * 8)));
+            }
+        }
+        for (uint32_t invalid : {0xD800u, 0x110000u}) {
+            for (int i = 0; i < 4; ++i) {
+                utf32le.push_back((uint8_t)(invalid >> (i * 8)));
+                utf32be.push_back((uint8_t)(invalid >> ((3 - i) * 8)));
+            }
+        }
+        do_test(utf32le.data(), utf32le.size(), tmu_encoding_unknown, validate, replace_str);
+        do_test(utf32le.data() + 4, utf32le.size() - 4, tmu_encoding_utf32le, validate, replace_str);
+        do_test(utf32be.data(), utf32be.size(), tmu_encoding_utf32be_bom, validate, replace_str);
+
+        // Without byte order mark the encoding is detected from the start of the input, not from the first chunk.
+        do_test(utf16le_bom + 2, size(utf16le_bom) - 2, tmu_encoding_unknown, validate, replace_str);
+        do_test(utf16be_bom + 2, size(utf16be_bom) - 2, tmu_encoding_unknown, validate, replace_str);
+        do_test(utf32le.data() + 4, utf32le.size() - 4, tmu_encoding_unknown, validate, replace_str);
+        do_test(utf32be.data() + 4, utf32be.size() - 4, tmu_encoding_unknown, validate, replace_str);
+        const char hello_utf16le[] = "h\0e\0l\0l\0o\0 \0w\0o\0r\0l\0d\0";
+        do_test(hello_utf16le, size(hello_utf16le) - 1, tmu_encoding_unknown, validate, replace_str);
+        const char hello_utf16be[] = "\0h\0e\0l\0l\0o\0 \0w\0o\0r\0l\0d";
+        do_test(hello_utf16be, size(hello_utf16be) - 1, tmu_encoding_unknown, validate, replace_str);
+        const char hello_latin1[] = "h\xE9llo w\xF6rld";
+        do_test(hello_latin1, size(hello_latin1) - 1, tmu_encoding_unknown, validate, replace_str);
+
+        // Longer than the detection window, ascii at the start and utf16 text only after it.
+        string long_utf16le;
+        for (int i = 0; i < 3000; ++i) long_utf16le.append((i < 2100) ? "a\0" : "\x3D\xD8\x00\xDE", (i < 2100) ? 2 : 4);
+        do_test(long_utf16le.data(), long_utf16le.size(), tmu_encoding_unknown, validate, replace_str);
+    }
+
+    auto test_data = read_whole_file("tests/external/data/UTF-8-test.txt");
+    REQUIRE(!test_data.empty());
+    do_test(test_data.data(), test_data.size(), tmu_encoding_unknown, tmu_validate_skip, nullptr);
+    do_test(test_data.data(), test_data.size(), tmu_encoding_unknown, tmu_validate_replace, "_");
+    do_test(test_data.data(), test_data.size(), tmu_encoding_unknown, tmu_validate_error, nullptr);
+
+    // Output buffer too small to hold the replacement string.
+    auto transcoder = tmu_utf8_make_transcoder(tmu_encoding_utf8, tmu_validate_replace, "XXXX", 4);
+    char out[3];
+    auto r = tmu_utf8_transcode(&transcoder, "\xFF", 1, out, 3);
+    REQUIRE(r.ec == TM_OK);
+    REQUIRE(r.consumed == 1);
+    r = tmu_utf8_transcode_finish(&transcoder, out, 3);
+    REQUIRE(r.ec == TM_ERANGE);
+    REQUIRE(r.size == 0);
+}
+
 TEST_CASE("valid unicode bruteforce") {
     auto test_codepoint_utf8 = [](uint32_t codepoint, bool valid) {
         char buffer[10];
@@ -334,6 +542,185 @@ TEST_CASE("codepoints count") {
     REQUIRE(tmu_utf8_count_codepoints(a.data) == 4);
 }
 
+TEST_CASE("codepoints count matches extract") {
+    auto count_by_extract = [](const char* str, size_t len) {
+        auto stream = tmu_utf8_make_stream_n(str, (tm_size_t)len);
+        tm_size_t result = 0;
+        uint32_t codepoint = 0;
+        while (tmu_utf8_extract(&stream, &codepoint)) ++result;
+        return result;
+    };
+
+    // Long enough to cross the lane accumulation limit of the word-wise count.
+    string mixed;
+    for (int i = 0; i < 1000; ++i) {
+        mixed += "ascii text \xC7\xAE\xE2\xBA\x80\xF0\x90\x80\xA0";
+    }
+    for (size_t len : {(size_t)0, (size_t)7, (size_t)8, (size_t)9, (size_t)100, mixed.size()}) {
+        CHECK(tmu_utf8_count_codepoints_n(mixed.data(), (tm_size_t)len) == count_by_extract(mixed.data(), len));
+    }
+
+    auto test_data = read_whole_file("tests/external/data/UTF-8-test.txt");
+    REQUIRE(!test_data.empty());
+    for (size_t start = 0; start < test_data.size(); start += 97) {
+        const char* str = test_data.data() + start;
+        size_t len = test_data.size() - start;
+        CHECK(tmu_utf8_count_codepoints_n(str, (tm_size_t)len) == count_by_extract(str, len));
+    }
+}
+
+TEST_CASE("parallel chunks") {
+    allocation_guard alloc_guard;
+
+    // Runs tasks in reverse order, results must not depend on the order of execution.
+    tmu_parallel_for_proc* reverse_for = [](void* user_data, tm_size_t count, tmu_task_proc* task, void* task_data) {
+        *(tm_size_t*)user_data += count;
+        while (count) task(task_data, --count);
+    };
+
+    auto check_chunks = [](const string& str, const vector<tmu_utf8_chunk>& chunks) {
+        tm_size_t offset = 0;
+        for (auto& chunk : chunks) {
+            REQUIRE(chunk.offset == offset);
+            REQUIRE(chunk.size > 0);
+            REQUIRE(((uint8_t)str[(size_t)chunk.offset] & 0xC0u) != 0x80u);
+            offset += chunk.size;
+        }
+        REQUIRE(offset == (tm_size_t)str.size());
+    };
+
+    string mixed;
+    for (int i = 0; i < 200; ++i) {
+        mixed += "ascii text \xC7\xAE\xE2\xBA\x80\xF0\x90\x80\xA0";
+    }
+    for (tm_size_t chunk_size : {1, 16, 17, 100, 1000}) {
+        vector<tmu_utf8_chunk> chunks(
+            (size_t)tmu_utf8_split_chunks(mixed.data(), (tm_size_t)mixed.size(), chunk_size, nullptr, 0));
+        REQUIRE(tmu_utf8_split_chunks(mixed.data(), (tm_size_t)mixed.size(), chunk_size, chunks.data(),
+                                      (tm_size_t)chunks.size()) == (tm_size_t)chunks.size());
+        check_chunks(mixed, chunks);
+
+        tm_size_t tasks = 0;
+        CHECK(tmu_utf8_valid_range_parallel(mixed.data(), (tm_size_t)mixed.size(), chunk_size, reverse_for, &tasks) ==
+              (tm_size_t)mixed.size());
+        CHECK(tmu_utf8_count_codepoints_parallel(mixed.data(), (tm_size_t)mixed.size(), chunk_size, reverse_for,
+                                                 &tasks) == tmu_utf8_count_codepoints_n(mixed.data(),
+                                                                                        (tm_size_t)mixed.size()));
+        CHECK(tasks == 2 * (tm_size_t)chunks.size());
+    }
+
+    // A stray continuation octet right at the chunk boundary, after a complete 4 octet sequence.
+    string stray_continuation = string(12, 'a') + "\xF0\x90\x80\x80\x80" + string(20, 'a');
+    for (tm_size_t chunk_size : {16, 17}) {
+        tm_size_t tasks = 0;
+        CHECK(tmu_utf8_valid_range(stray_continuation.data(), (tm_size_t)stray_continuation.size()) == 16);
+        CHECK(tmu_utf8_valid_range_parallel(stray_continuation.data(), (tm_size_t)stray_continuation.size(),
+                                            chunk_size, reverse_for, &tasks) == 16);
+        CHECK(tmu_utf8_count_codepoints_parallel(stray_continuation.data(), (tm_size_t)stray_continuation.size(),
+                                                 chunk_size, reverse_for, &tasks) ==
+              tmu_utf8_count_codepoints_n(stray_continuation.data(), (tm_size_t)stray_continuation.size()));
+    }
+
+    auto test_data = read_whole_file("tests/external/data/UTF-8-test.txt");
+    REQUIRE(!test_data.empty());
+    for (tm_size_t chunk_size : {16, 17, 100, 1000, 100000}) {
+        for (size_t start = 0; start < test_data.size(); start += 1001) {
+            const char* str = test_data.data() + start;
+            auto len = (tm_size_t)(test_data.size() - start);
+            tm_size_t tasks = 0;
+            CHECK(tmu_utf8_valid_range_parallel(str, len, chunk_size, reverse_for, &tasks) ==
+                  tmu_utf8_valid_range(str, len));
+            CHECK(tmu_utf8_count_codepoints_parallel(str, len, chunk_size, reverse_for, &tasks) ==
+                  tmu_utf8_count_codepoints_n(str, len));
+        }
+    }
+
+#if TMU_UCD_HAS_GRAPHEME_BREAK
+    // Chunks must not split "e" from the following COMBINING ACUTE ACCENT or CR from LF.
+    string graphemes;
+    for (int i = 0; i < 200; ++i) {
+        graphemes += "e\xCC\x81\xCC\x81\r\nab";
+    }
+    for (tm_size_t chunk_size : {16, 17, 100}) {
+        vector<tmu_utf8_chunk> chunks((size_t)tmu_utf8_split_chunks_graphemes(
+            graphemes.data(), (tm_size_t)graphemes.size(), chunk_size, nullptr, 0));
+        tmu_utf8_split_chunks_graphemes(graphemes.data(), (tm_size_t)graphemes.size(), chunk_size, chunks.data(),
+                                        (tm_size_t)chunks.size());
+        check_chunks(graphemes, chunks);
+        for (auto& chunk : chunks) {
+            char first = graphemes[(size_t)chunk.offset];
+            CHECK((first == 'e' || first == 'a' || first == 'b' || first == '\r'));
+        }
+    }
+#endif
+}
+
+TEST_CASE("offset index") {
+    allocation_guard alloc_guard;
+
+    auto check_index = [](const tmu_utf8_offset_index& index, const string& str) {
+        vector<tm_size_t> offsets;
+        for (size_t i = 0; i < str.size(); ++i) {
+            if (((uint8_t)str[i] & 0xC0u) != 0x80u) offsets.push_back((tm_size_t)i);
+        }
+        REQUIRE(index.codepoints == (tm_size_t)offsets.size());
+        REQUIRE(index.size == (tm_size_t)str.size());
+        for (size_t i = 1; i < (size_t)index.count; ++i) {
+            REQUIRE(index.checkpoints[i].index - index.checkpoints[i - 1].index <= index.interval);
+        }
+        for (size_t i = 0; i < offsets.size(); ++i) {
+            REQUIRE(tmu_utf8_offset_index_to_offset(&index, str.data(), (tm_size_t)i) == offsets[i]);
+        }
+        REQUIRE(tmu_utf8_offset_index_to_offset(&index, str.data(), index.codepoints) == index.size);
+        size_t codepoint_index = 0;
+        for (size_t i = 0; i < str.size(); ++i) {
+            if (codepoint_index + 1 < offsets.size() && offsets[codepoint_index + 1] == (tm_size_t)i) ++codepoint_index;
+            REQUIRE(tmu_utf8_offset_index_to_codepoint(&index, str.data(), (tm_size_t)i) == codepoint_index);
+        }
+        REQUIRE(tmu_utf8_offset_index_to_codepoint(&index, str.data(), index.size) == index.codepoints);
+    };
+
+    const char* pieces[] = {"a", "bc", "\xC7\xAE", "\xE2\xBA\x80", "\xF0\x90\x80\xA0", "ascii text ", ""};
+    for (tm_size_t interval : {1, 3, 16}) {
+        string str;
+        for (int i = 0; i < 50; ++i) str += pieces[i % 6];
+
+        auto made = tmu_utf8_make_offset_index(str.data(), (tm_size_t)str.size(), interval);
+        REQUIRE(made.ec == TM_OK);
+        auto index = made.index;
+        check_index(index, str);
+
+        // Apply edits at codepoint boundaries and check against the expected offsets.
+        uint32_t state = 12345;
+        auto next_random = [&state](uint32_t max) {
+            state = state * 1103515245u + 12345u;
+            return (state >> 8) % max;
+        };
+        for (int edit = 0; edit < 100; ++edit) {
+            auto codepoints = index.codepoints;
+            auto first = next_random((uint32_t)codepoints + 1);
+            auto last = first + next_random((uint32_t)(codepoints - first) + 1) % 8;
+            auto edit_offset = tmu_utf8_offset_index_to_offset(&index, str.data(), first);
+            auto edit_end = tmu_utf8_offset_index_to_offset(&index, str.data(), last);
+            string inserted;
+            for (uint32_t i = 0, count = next_random(4); i < count; ++i) inserted += pieces[next_random(7)];
+
+            str.replace((size_t)edit_offset, (size_t)(edit_end - edit_offset), inserted);
+            REQUIRE(tmu_utf8_offset_index_update(&index, str.data(), (tm_size_t)str.size(), edit_offset,
+                                                 edit_end - edit_offset, (tm_size_t)inserted.size()) == TM_OK);
+            check_index(index, str);
+        }
+
+        // Removing everything.
+        auto size = index.size;
+        str.clear();
+        REQUIRE(tmu_utf8_offset_index_update(&index, str.data(), 0, 0, size, 0) == TM_OK);
+        check_index(index, str);
+
+        tmu_utf8_destroy_offset_index(&index);
+    }
+}
+
 #if TMU_UCD_HAS_SIMPLE_CASE || TMU_UCD_HAS_SIMPLE_CASE_TOGGLE
 TEST_CASE("case transform simple") {
     auto do_test = [](auto transform, const char* str, const char* expected) {
@@ -532,6 +919,59 @@ TEST_CASE("case fold") {
     REQUIRE(tmu_utf8_human_compare(a_fold, a_transform.size, b_fold, b_transform.size) == 0);
 }
 
+#if TMU_UCD_HAS_FULL_CASE
+TEST_CASE("ascii case fast paths") {
+    // Long enough ASCII runs to go through the 8 bytes at a time path, with non-ASCII inbetween.
+    const char* str = "The Quick Brown Fox Jumps \xC3\x84ver The LAZY DOG \xEF\xAC\x80 0123456789 @[`{";
+    const char* lower = "the quick brown fox jumps \xC3\xA4ver the lazy dog \xEF\xAC\x80 0123456789 @[`{";
+    const char* folded = "the quick brown fox jumps \xC3\xA4ver the lazy dog ff 0123456789 @[`{";
+    const tm_size_t str_len = (tm_size_t)strlen(str);
+
+    char buffer[100];
+    auto result = tmu_utf8_to_lower(str, str_len, buffer, 100);
+    REQUIRE(result.ec == TM_OK);
+    REQUIRE(result.size == (tm_size_t)strlen(lower));
+    REQUIRE(memcmp(buffer, lower, result.size * sizeof(char)) == 0);
+
+    result = tmu_utf8_to_case_fold(str, str_len, buffer, 100);
+    REQUIRE(result.ec == TM_OK);
+    REQUIRE(result.size == (tm_size_t)strlen(folded));
+    REQUIRE(memcmp(buffer, folded, result.size * sizeof(char)) == 0);
+
+    // Output too small, the required size must still be reported.
+    for (tm_size_t len = 0; len < 20; ++len) {
+        result = tmu_utf8_to_lower(str, str_len, buffer, len);
+        REQUIRE(result.ec == TM_ERANGE);
+        REQUIRE(result.size == (tm_size_t)strlen(lower));
+        REQUIRE(memcmp(buffer, lower, len * sizeof(char)) == 0);
+    }
+
+    REQUIRE(tmu_utf8_equals_ignore_case(str, str_len, lower, (tm_size_t)strlen(lower)));
+    REQUIRE(tmu_utf8_equals_ignore_case(str, str_len, folded, (tm_size_t)strlen(folded)));
+    REQUIRE(tmu_utf8_compare_ignore_case(str, str_len, folded, (tm_size_t)strlen(folded)) == 0);
+    REQUIRE(!tmu_utf8_equals_ignore_case(str, str_len, folded, (tm_size_t)strlen(folded) - 1));
+    REQUIRE(!tmu_utf8_equals_ignore_case("ab", 2, "A", 1));
+    REQUIRE(tmu_utf8_compare_ignore_case("ab", 2, "A", 1) > 0);
+    REQUIRE(tmu_utf8_compare_ignore_case("A", 1, "ab", 2) < 0);
+    REQUIRE(tmu_utf8_human_compare("ab", 2, "A", 1) > 0);
+
+    // Differences after the first 8 bytes.
+    REQUIRE(tmu_utf8_compare_ignore_case("abcdefghijklmnopQ", 17, "ABCDEFGHIJKLMNOPr", 17) < 0);
+    REQUIRE(tmu_utf8_compare_ignore_case("ABCDEFGHIJKLMNOPr", 17, "abcdefghijklmnopQ", 17) > 0);
+    REQUIRE(tmu_utf8_compare_ignore_case("abcdefghijklmnop", 16, "ABCDEFGHIJKLMNOPr", 17) < 0);
+    REQUIRE(tmu_utf8_compare_ignore_case("abcdefghijklmnop_", 17, "ABCDEFGHIJKLMNOPa", 17) < 0);
+    REQUIRE(!tmu_utf8_equals_ignore_case("abcdefghijklmnop_", 17, "ABCDEFGHIJKLMNOP\x7F", 17));
+#if TMU_UCD_HAS_SIMPLE_CASE_FOLD
+    REQUIRE(tmu_utf8_compare_ignore_case_simple("abcdefghijklmnopQ", 17, "ABCDEFGHIJKLMNOPr", 17) < 0);
+    REQUIRE(tmu_utf8_equals_ignore_case_simple(str, str_len, lower, (tm_size_t)strlen(lower)));
+    REQUIRE(!tmu_utf8_equals_ignore_case_simple(str, str_len, folded, (tm_size_t)strlen(folded)));
+    REQUIRE(!tmu_utf8_equals_ignore_case_simple("ab", 2, "A", 1));
+    REQUIRE(tmu_utf8_compare_ignore_case_simple("ab", 2, "A", 1) > 0);
+    REQUIRE(tmu_utf8_human_compare_simple("ab", 2, "A", 1) > 0);
+#endif /* TMU_UCD_HAS_SIMPLE_CASE_FOLD */
+}
+#endif /* TMU_UCD_HAS_FULL_CASE */
+
 TEST_CASE("human compare") {
     std::string_view strings[] = {"ASD10",    "asd",
                                   "\xC7\xAE",  // 01EE LATIN CAPITAL LETTER EZH WITH CARON
@@ -555,6 +995,79 @@ TEST_CASE("human compare") {
     bool case1 = std::equal(std::begin(strings), std::end(strings), std::begin(expected1));
     REQUIRE((case0 || case1));
 }
+
+TEST_CASE("sort key") {
+    const std::string_view strings[] = {"",
+                                        "asd",
+                                        "ASD",
+                                        "asd1",
+                                        "asd01",
+                                        "ASD2",
+                                        "asd10",
+                                        "asd10b",
+                                        "asdb",
+                                        "a",
+                                        "10",
+                                        "9",
+                                        "Stra\xC3\x9F" "e",  // Straße
+                                        "STRASSE",
+                                        "strasse1",
+                                        "\xC7\xAE",  // 01EE LATIN CAPITAL LETTER EZH WITH CARON
+                                        "\xC7\xAF",  // 01EF LATIN SMALL LETTER EZH WITH CARON
+                                        "\xF0\x9F\x98\x80",
+                                        "file0",
+                                        "file2146369535",
+                                        "file2146369536",
+                                        "file4294967296",
+                                        "file99999999999999999999"};
+
+    auto make_key = [](std::string_view str, auto make_sort_key) {
+        tmu_transform_result size = make_sort_key(str.data(), (tm_size_t)str.size(), nullptr, 0);
+        REQUIRE((size.ec == TM_OK || size.ec == TM_ERANGE));
+        std::string key(size.size, 0);
+        tmu_transform_result result =
+            make_sort_key(str.data(), (tm_size_t)str.size(), key.data(), (tm_size_t)key.size());
+        REQUIRE(result.ec == TM_OK);
+        REQUIRE(result.size == size.size);
+        return key;
+    };
+    auto sign = [](int value) { return (value > 0) - (value < 0); };
+
+    for (auto a : strings) {
+        auto a_key = make_key(a, tmu_utf8_make_sort_key);
+        for (auto b : strings) {
+            auto b_key = make_key(b, tmu_utf8_make_sort_key);
+            CHECK(sign(a_key.compare(b_key)) ==
+                  sign(tmu_utf8_human_compare(a.data(), (tm_size_t)a.size(), b.data(), (tm_size_t)b.size())));
+        }
+    }
+
+#if TMU_UCD_HAS_SIMPLE_CASE_FOLD
+    for (auto a : strings) {
+        auto a_key = make_key(a, tmu_utf8_make_sort_key_simple);
+        for (auto b : strings) {
+            auto b_key = make_key(b, tmu_utf8_make_sort_key_simple);
+            CHECK(sign(a_key.compare(b_key)) ==
+                  sign(tmu_utf8_human_compare_simple(a.data(), (tm_size_t)a.size(), b.data(), (tm_size_t)b.size())));
+        }
+    }
+#endif /* TMU_UCD_HAS_SIMPLE_CASE_FOLD */
+
+    // Long digit runs saturate instead of wrapping around.
+    CHECK(make_key("file4294967296", tmu_utf8_make_sort_key) > make_key("file0", tmu_utf8_make_sort_key));
+    CHECK(make_key("file2146369536", tmu_utf8_make_sort_key) >
+          make_key("file2146369535", tmu_utf8_make_sort_key));
+    CHECK(make_key("file99999999999999999999", tmu_utf8_make_sort_key) ==
+          make_key("file4294967296", tmu_utf8_make_sort_key));
+    CHECK(tmu_utf8_human_compare("file4294967296", 14, "file0", 5) > 0);
+
+    char buffer[3];
+    tmu_transform_result result = tmu_utf8_make_sort_key("a10", 3, buffer, (tm_size_t)sizeof(buffer));
+    CHECK(result.ec == TM_ERANGE);
+    CHECK(result.size == 6);
+    result = tmu_utf8_make_sort_key("a\xFF", 2, buffer, (tm_size_t)sizeof(buffer));
+    CHECK(result.ec == TM_EINVAL);
+}
 #endif /* TMU_UCD_HAS_FULL_CASE_FOLD */
 
 #if TMU_UCD_HAS_CATEGORY
@@ -592,8 +1105,125 @@ TEST_CASE("ucd category") {
     CHECK(tmu_is_symbol(0x0608) == true);  // ARABIC RAY
     CHECK(tmu_is_symbol(0x060F) == true);  // ARABIC SIGN MISRA
 }
+
+TEST_CASE("span category") {
+    // The ascii bitmaps have to agree with the UCD.
+    const uint32_t masks[] = {tmu_category_control,   tmu_category_letter,     tmu_category_mark,
+                              tmu_category_number,    tmu_category_punctuation, tmu_category_symbol,
+                              tmu_category_separator, tmu_category_whitespace};
+    for (uint32_t c = 0; c < 0x80; ++c) {
+        char str[1] = {(char)c};
+        for (uint32_t mask : masks) {
+            bool expected = (mask == tmu_category_whitespace) ? tmu_is_whitespace(c)
+                                                              : (mask == (1u << (uint32_t)tmu_ucd_get_category(c)));
+            CHECK(tmu_utf8_span_category(tmu_utf8_make_stream_n(str, 1), mask) == (tm_size_t)expected);
+            CHECK(tmu_utf8_span_not_category(tmu_utf8_make_stream_n(str, 1), mask) == (tm_size_t)!expected);
+        }
+    }
+
+    auto span = [](const char* str, uint32_t mask) { return tmu_utf8_span_category(tmu_utf8_make_stream(str), mask); };
+    auto span_not = [](const char* str, uint32_t mask) {
+        return tmu_utf8_span_not_category(tmu_utf8_make_stream(str), mask);
+    };
+
+    CHECK(span("", tmu_category_letter) == 0);
+    CHECK(span("abc def", tmu_category_letter) == 3);
+    CHECK(span("identifier_with_more_than_sixteen_chars1 = 0", tmu_category_letter | tmu_category_punctuation) == 39);
+    CHECK(span("identifier_with_more_than_sixteen_chars1 = 0",
+               tmu_category_letter | tmu_category_punctuation | tmu_category_number) == 40);
+    // Tabs and newlines are control characters, they don't have the whitespace property.
+    CHECK(span(" \t\r\n  \t\t         \t\t\tx", tmu_category_whitespace) == 1);
+    CHECK(span(" \t\r\n  \t\t         \t\t\tx", tmu_category_whitespace | tmu_category_control) == 20);
+    // Non-ascii letters inside of long ascii runs.
+    CHECK(span("abcdefghijklmnop\xC3\xA4\xC3\xB6\xC3\xBCqrstuvwxyzabcdefghij!", tmu_category_letter) == 42);
+    // U+3000 IDEOGRAPHIC SPACE is whitespace and a separator.
+    CHECK(span(" \xE3\x80\x80 a", tmu_category_whitespace) == 5);
+    CHECK(span(" \xE3\x80\x80 a", tmu_category_separator) == 5);
+    // Invalid sequences end the span.
+    CHECK(span("abc\xFF" "def", tmu_category_letter) == 3);
+    CHECK(span_not("abc\xFF" "def", tmu_category_whitespace) == 3);
+
+    CHECK(span_not("word1, word2", tmu_category_whitespace) == 6);
+    CHECK(span_not("0123456789012345678901234567890123456789 ", tmu_category_whitespace) == 40);
+    CHECK(span_not("\xE4\xB8\x80\xE4\xBA\x8C\xE4\xB8\x89.", tmu_category_punctuation) == 9);
+}
 #endif /* TMU_UCD_HAS_CATEGORY */
 
+#if TMU_UCD_HAS_WORD_BREAK || TMU_UCD_HAS_SENTENCE_BREAK
+// Runs the boundary tests of a UCD *BreakTest.txt file. Lines look like "÷ 0041 × 0308 ÷ 0020 ÷ # comment", where
+// "÷" marks a boundary and "×" marks a position that is not a boundary.
+template <class NextBreak>
+void check_break_test_file(const char* filename, NextBreak next_break) {
+    auto test_data = read_whole_file(filename);
+    REQUIRE(!test_data.empty());
+
+    const char* divide = "\xC3\xB7";
+    const char* multiply = "\xC3\x97";
+
+    size_t tests_count = 0;
+    string_view remaining(test_data.data(), test_data.size());
+    while (!remaining.empty()) {
+        auto line_end = remaining.find('\n');
+        if (line_end == string_view::npos) line_end = remaining.size();
+        string_view test = remaining.substr(0, line_end);
+        remaining.remove_prefix((line_end < remaining.size()) ? line_end + 1 : line_end);
+
+        auto comment = test.find('#');
+        if (comment != string_view::npos) test = test.substr(0, comment);
+        if (test.empty() || test.find_first_not_of(" \t\r") == string_view::npos) continue;
+        const string_view test_line = test;
+
+        string str;
+        vector<tm_size_t> expected;
+        while (!test.empty()) {
+            if (test[0] == ' ' || test[0] == '\t' || test[0] == '\r') {
+                test.remove_prefix(1);
+            } else if (test.substr(0, 2) == divide || test.substr(0, 2) == multiply) {
+                if (test.substr(0, 2) == divide && !str.empty()) expected.push_back((tm_size_t)str.size());
+                test.remove_prefix(2);
+            } else {
+                uint32_t codepoint = 0;
+                while (!test.empty() && isxdigit((unsigned char)test[0])) {
+                    codepoint = codepoint * 16 + (uint32_t)(isdigit((unsigned char)test[0])
+                                                                ? (test[0] - '0')
+                                                                : (tolower((unsigned char)test[0]) - 'a' + 10));
+                    test.remove_prefix(1);
+                }
+                char buffer[4];
+                auto encoded = tmu_utf8_encode(codepoint, buffer, 4);
+                REQUIRE(encoded > 0);
+                str.append(buffer, (size_t)encoded);
+            }
+        }
+
+        vector<tm_size_t> actual;
+        auto stream = tmu_utf8_make_stream_n(str.data(), (tm_size_t)str.size());
+        while (stream.cur != stream.end) {
+            const char* next = next_break(stream);
+            REQUIRE(next > stream.cur);
+            actual.push_back((tm_size_t)(next - str.data()));
+            stream.cur = next;
+        }
+        INFO(string(test_line));
+        CHECK(actual == expected);
+        ++tests_count;
+    }
+    CHECK(tests_count > 0);
+}
+#endif /* TMU_UCD_HAS_WORD_BREAK || TMU_UCD_HAS_SENTENCE_BREAK */
+
+#if TMU_UCD_HAS_WORD_BREAK
+TEST_CASE("word break conformance") {
+    check_break_test_file("tools/unicode_gen/data/WordBreakTest.txt", tmu_utf8_next_word_break);
+}
+#endif /* TMU_UCD_HAS_WORD_BREAK */
+
+#if TMU_UCD_HAS_SENTENCE_BREAK
+TEST_CASE("sentence break conformance") {
+    check_break_test_file("tools/unicode_gen/data/SentenceBreakTest.txt", tmu_utf8_next_sentence_break);
+}
+#endif /* TMU_UCD_HAS_SENTENCE_BREAK */
+
 #ifndef TMU_NO_FILE_IO
 #include "file_io_tests.cpp"
 #endif
\ No newline at end of file
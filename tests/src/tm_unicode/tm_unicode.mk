@@ -2,6 +2,8 @@
 tests.generated.tm_unicode.flags := case_info \
 									category \
 									grapheme_break \
+									word_break \
+									sentence_break \
 									width \
 									canonical \
 									compatibility \
@@ -11,6 +13,7 @@ tests.generated.tm_unicode.flags := case_info \
 									simple_case \
 									simple_case_fold \
 									simple_case_toggle \
+									per_property_tables \
 									handle_invalid_codepoints
 tests.generated.tm_unicode.options := --prefix=tmu_ \
 --assert=TM_ASSERT \
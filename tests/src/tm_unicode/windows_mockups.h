@@ -101,6 +101,7 @@ void* test_valid_handle = ((void*)1);
 #define CloseHandle test_CloseHandle
 #define CreateDirectoryW test_CreateDirectoryW
 #define WriteFile test_WriteFile
+#define FlushFileBuffers test_FlushFileBuffers
 #define GetTempFileNameW test_GetTempFileNameW
 #define MoveFileExW test_MoveFileExW
 #define DeleteFileW test_DeleteFileW
@@ -317,6 +318,15 @@ bool test_WriteFile(HANDLE handle, const void* buffer, DWORD buffer_len, DWORD*
     return true;
 }
 
+bool test_FlushFileBuffers(HANDLE handle) {
+    TM_ASSERT(handle == &mock.file);
+    TM_ASSERT(mock.file.is_open);
+    TM_ASSERT(mock.file.is_writable);
+
+    if (mock.test_fail(fail_FlushFileBuffers)) return false;
+    return true;
+}
+
 uint32_t test_GetTempFileNameW(const tchar* path, const tchar* prefix, uint32_t unique, tchar* out) {
     TM_ASSERT(path);
     TM_ASSERT(prefix);
@@ -519,12 +529,16 @@ DWORD test_GetModuleFileNameW(HANDLE handle, WCHAR* out, DWORD out_size) {
 
 struct test_WIN32_FIND_DATAW {
     DWORD dwFileAttributes;
+    FILETIME ftLastWriteTime;
+    DWORD nFileSizeHigh;
+    DWORD nFileSizeLow;
     WCHAR cFileName[MAX_PATH];
 };
 
 static void helper_copy_next_index(test_WIN32_FIND_DATAW* data) {
     memset(data, 0, sizeof(test_WIN32_FIND_DATAW));
     data->dwFileAttributes = (mock.entries[mock.readdir_index].type == mock_dir) ? FILE_ATTRIBUTE_DIRECTORY : 0;
+    data->nFileSizeLow = (DWORD)mock.entries[mock.readdir_index].contents.size();
     const auto& path = mock.entries[mock.readdir_index].path;
     auto len = std::min(path.size(), (size_t)MAX_PATH);
     memcpy(data->cFileName, path.data(), len * sizeof(WCHAR));
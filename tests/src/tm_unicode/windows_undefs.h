@@ -246,6 +246,9 @@
 #ifdef WriteFile
     #undef WriteFile
 #endif
+#ifdef FlushFileBuffers
+    #undef FlushFileBuffers
+#endif
 #ifdef WriteConsoleW
     #undef WriteConsoleW
 #endif
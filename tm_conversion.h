@@ -1,5 +1,5 @@
 /*
-tm_conversion.h v0.9.9.9 - public domain - https://github.com/to-miz/tm
+tm_conversion.h v0.9.9.15 - public domain - https://github.com/to-miz/tm
 author: Tolga Mizrak 2016
 
 no warranty; use at your own risk
@@ -18,8 +18,9 @@ USAGE
 PURPOSE
     The conversion functions in this library are designed with flexibility in mind.
     They can be used to implement your own conversion functions (ie C library functions, printf...).
-    Note that the float/double conversion functions are not suitable for release/shipping code,
-    since they lose precision for big numbers (above/below +-1e19, see ISSUES).
+    Scanning floats/doubles is exact, the result is always the correctly rounded value.
+    Printing floats/doubles is exact as well, output with a precision is correctly rounded and output
+    without a precision is the shortest string that scans back to the same value.
 
     There are some switches that enable overloads and convenience functions, those are more
     suited to be used in usage code. See SWITCHES.
@@ -74,28 +75,33 @@ SWITCHES
         TMC_CLAMP_ON_RANGE_ERROR
             If defined to 1 output values of scan will be clamped to nearest max/min value when a
             range error is occured. Otherwise output values are untouched.
+            Floats are clamped to the largest finite value or zero.
         TMC_CHECKED_WIDTH
             If defined, functions that end with _w will validate width while printing.
             This is only needed, if users call directly into these functions.
 
 TODO
     - refactor to get rid of most code duplication
-    - implement PF_FIXED, PF_HEX, PF_GENERAL, PF_SCIENTIFIC, PF_LOWERCASE
+    - implement PF_HEX for printing
 
 ISSUES
-    - PF_FIXED, PF_HEX, PF_GENERAL, PF_SCIENTIFIC, PF_LOWERCASE does nothing at the moment
-    - print_double, print_float don't produce correct decimal strings for values above/below +-1e19.
-      This is because we use floating arithmetic and we lose too much precision when dealing with
-      very big numbers. This could be fixed by using arbitrary precision math, but that pretty much
-      is beyond the scope of this library. Do not use these functions for big numbers if accurate readings are
-      needed.
-      For precision > 9, decimal digits after the 9nth are not correctly rounded, but floating point
-      values survive the roundtrip of print_float -> scan_float exactly at precision 14. This means
-      print_float is safe to use for serializing with precision set to 14.
-      DO NOT USE print_double -> scan_double for serialization of doubles, they are wildly inaccurate.
-    - print_double, print_float need 64 bit arithmetic
+    - PF_HEX does nothing when printing at the moment
 
 HISTORY
+    v0.9.9.15  19.10.26 Added scan_hex_bytes, print_hex_bytes converts 8 bytes at a time.
+    v0.9.9.14  19.10.26 Faster get_digits_count_decimal_* and print_decimal_* using count leading zeroes and
+                        reciprocal multiplication.
+    v0.9.9.13  19.10.26 Added scan_*_array and print_*_array for delimited lists of values.
+    v0.9.9.12  19.10.26 Base 10 scanning in scan_*_n functions reads 8 digits at a time.
+    v0.9.9.11  19.10.26 Rewrote print_double and print_float to be exact, using Schubfach for the shortest
+                        output and a big decimal for output with a precision.
+                        Added PF_FIXED, PF_SCIENTIFIC and general notation support to printing.
+                        Precision -1 now prints the shortest representation that survives a roundtrip.
+                        Max precision is now 1074 instead of 14.
+    v0.9.9.10  19.10.26 Rewrote scan_float and scan_double to be correctly rounded and faster, using
+                        Eisel-Lemire with a big decimal fallback.
+                        Added PF_FIXED, PF_SCIENTIFIC and PF_HEX support to scan_float and scan_double.
+                        Float scanning returns TM_ERANGE instead of TM_EOVERFLOW for big exponents.
     v0.9.9.9   15.02.20 Added checks for INT32_MIN and INT64_MIN to avoid undefined behavior
                         when applying unary minus.
     v0.9.9.8a  10.02.20 Added guards around print_NumberToCharTableUpper so that the tables can be
@@ -310,6 +316,8 @@ int main() {
 // OUTPUT: 3456
 #endif
 
+/* This is a generated file, do not modify directly. You can find the generator files in the src directory. */
+
 /* clang-format off */
 
 #ifdef TM_CONVERSION_IMPLEMENTATION
@@ -354,7 +362,7 @@ int main() {
 #ifndef _TM_CONVERSION_H_INCLUDED_
 #define _TM_CONVERSION_H_INCLUDED_
 
-#define TMC_VERSION 0x00090907u
+#define TMC_VERSION 0x0009090Fu
 
 /* Fixed width ints. Include C version so identifiers are in global namespace. */
 #include <stdint.h>
@@ -481,12 +489,21 @@ A minus sign is only scanned for signed integer types.
 Params:
     nullterminated: A nullterminated input string.
     base:           What base to scan in, valid values are 2 <= base <= 36.
+    flags:          Format of floats, a combination of PF_FIXED, PF_SCIENTIFIC and PF_HEX:
+                        PF_FIXED:      No exponent is scanned.
+                        PF_SCIENTIFIC: An exponent is required.
+                        Neither or both of the above make the exponent optional.
+                        PF_HEX:        Hexadecimal digits without a 0x prefix and a binary exponent
+                                       denoted by p or P, like 1.8p3.
+                    Floats are always rounded to the nearest representable value.
     out:            Output value, will not be modified if an error occurs.
 Return: Number of bytes consumed and error code if any,
     Error Codes:
         TM_OK            No error, size has number of bytes consumed.
         TM_EINVAL        If input string does not denote a number.
         TM_ERANGE        If input string cannot be represented, so result is out of range.
+                         For floats this means the value rounds to infinity or a nonzero value rounds to zero,
+                         size has number of bytes consumed.
 
 The _n variants take a string with a known length (they do not have to be nullterminated), useful
 when scanning in substrings.
@@ -506,10 +523,38 @@ TMC_DEF tmc_conv_result scan_double_n(const char* str, tm_size_t len, double* ou
 TMC_DEF tmc_conv_result scan_bool(const char* nullterminated, tm_bool* out);
 TMC_DEF tmc_conv_result scan_bool_n(const char* str, tm_size_t len, tm_bool* out);
 
+/*
+These functions scan values separated by a delimiter, like a column of a csv file, into an array.
+Scanning stops at the end of the input, once the array is full or at the first value that can't be scanned.
+A delimiter at the end of the input is allowed, so lines of a file can be scanned by using '\n' as the delimiter.
+Params:
+    str:       Input string, does not need to be nullterminated.
+    len:       Length of the input string.
+    delimiter: Character between values.
+    out:       Output array.
+    count:     In: Capacity of out. Out: Number of values scanned into out.
+    base:      See scan_i32.
+    flags:     See scan_float.
+Return: Number of bytes consumed and error code if any.
+        Bytes consumed include the delimiter after the last value, so that scanning can continue at str + size.
+    Error Codes:
+        TM_OK            No error, either all of the input was consumed or out is full.
+        TM_EINVAL        A value does not denote a number or isn't followed by the delimiter.
+                         size is the offset of that value.
+        TM_ERANGE        A value cannot be represented, size is the offset of that value.
+        Entries of out past the scanned count are unspecified.
+*/
+TMC_DEF tmc_conv_result scan_i64_array(const char* str, tm_size_t len, char delimiter, int64_t* out,
+                                       tm_size_t* count, int32_t base);
+TMC_DEF tmc_conv_result scan_u64_array(const char* str, tm_size_t len, char delimiter, uint64_t* out,
+                                       tm_size_t* count, int32_t base);
+TMC_DEF tmc_conv_result scan_double_array(const char* str, tm_size_t len, char delimiter, double* out,
+                                          tm_size_t* count, uint32_t flags);
+
 enum tmc_print_flags TMC_UNDERLYING_U32 {
-    PF_FIXED = (1u << 0u),      /* NOTE: Not implemented yet */
-    PF_SCIENTIFIC = (1u << 1u), /* NOTE: Not implemented yet */
-    PF_HEX = (1u << 2u),        /* NOTE: Not implemented yet */
+    PF_FIXED = (1u << 0u),      /* Both PF_FIXED and PF_SCIENTIFIC denote general notation like printf %g. */
+    PF_SCIENTIFIC = (1u << 1u),
+    PF_HEX = (1u << 2u),        /* NOTE: Only implemented for scanning */
     PF_SHORTEST = (1u << 3u),
     PF_TRAILING_ZEROES = (1u << 4u),
     PF_BOOL_AS_NUMBER = (1u << 5u),
@@ -527,7 +572,9 @@ Params:
     base:      What base to print in, valid values are 2 <= base <= 36.
     lowercase: Whether to print lowercase or uppercase digits when base > 10.
         flags: A combination of tmc_print_flags PF_* that control the printing behavior.
-    precision: How many digits to print after the dot. A value of -1 denotes short(-ish) result.
+    precision: How many digits to print after the dot, significant digits in general notation.
+               A value of -1 denotes the shortest result that scans back to the same value.
+               Trailing zeroes are removed if PF_SHORTEST is set, unless PF_TRAILING_ZEROES is set too.
     value:     Value to be printed.
 Return: Returns number of bytes printed and error code if any.
     Error Codes:
@@ -544,6 +591,23 @@ TMC_DEF tmc_conv_result print_double(char* dest, tm_size_t maxlen, double value,
 TMC_DEF tmc_conv_result print_float(char* dest, tm_size_t maxlen, float value, uint32_t flags, int32_t precision);
 TMC_DEF tmc_conv_result print_bool(char* dest, tm_size_t maxlen, tm_bool value, uint32_t flags);
 
+/*
+These functions print values with a separator between them, like a row or column of a csv file.
+Integers are printed in base 10, flags and precision of doubles are the same as for print_double.
+No separator is printed after the last value.
+Return: Returns number of bytes printed and error code if any.
+    Error Codes:
+        TM_OK            No error, size has number of bytes printed.
+        TM_EOVERFLOW     If buffer denoted by dest and maxlen was not enough for all values.
+                         Returned size equals maxlen.
+*/
+TMC_DEF tmc_conv_result print_i64_array(char* dest, tm_size_t maxlen, const int64_t* values, tm_size_t count,
+                                        char separator);
+TMC_DEF tmc_conv_result print_u64_array(char* dest, tm_size_t maxlen, const uint64_t* values, tm_size_t count,
+                                        char separator);
+TMC_DEF tmc_conv_result print_double_array(char* dest, tm_size_t maxlen, const double* values, tm_size_t count,
+                                           char separator, uint32_t flags, int32_t precision);
+
 /* Specialized printing functions that perform faster than the generic versions from above */
 
 /* Prints base 10 number and returns length and error code if any */
@@ -581,6 +645,22 @@ Return. Returns number of bytes printed and error code if any.
 TMC_DEF tmc_conv_result print_hex_bytes(char* dest, tm_size_t maxlen, const void* bytes, tm_size_t size,
                                         tm_bool lowercase);
 
+/*
+Scans pairs of hex digits into bytes, the inverse of print_hex_bytes. Uppercase and lowercase digits are accepted.
+Params:
+    str:      Input string, does not need to be nullterminated.
+    len:      Length of the input string.
+    out:      Output bytes.
+    out_size: Size of out in bytes, has to be at least len / 2.
+Return: Number of characters consumed and error code if any. The number of bytes written into out is size / 2.
+    Error Codes:
+        TM_OK            No error, all of str was scanned.
+        TM_EINVAL        str contains a character that is not a hex digit or the last digit of a pair is missing.
+                         size is the offset of that character, or len - 1 if len is odd.
+        TM_EOVERFLOW     If out_size is less than len / 2, nothing is written and size is 0.
+*/
+TMC_DEF tmc_conv_result scan_hex_bytes(const char* str, tm_size_t len, void* out, tm_size_t out_size);
+
 /* Get how many digits will be printed for a given number when printed in decimal or hex */
 TMC_DEF tm_size_t get_digits_count_decimal_u64(uint64_t number);
 TMC_DEF tm_size_t get_digits_count_decimal_u32(uint32_t number);
@@ -784,6 +864,21 @@ inline tmc_conv_result tmc::scan(TM_STRING_VIEW str, bool* out) {
     #endif
 #endif /* !defined(TM_ASSERT_VALID_SIZE) */
 
+/* Clinger's fast path when scanning floats needs floating point operations to be evaluated in the precision of
+   their type. */
+#include <float.h>
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+    #define TMC_CLINGER_FAST_PATH 1
+#else
+    #define TMC_CLINGER_FAST_PATH 0
+#endif
+
+#if !defined(__GNUC__) && defined(_MSC_VER) && defined(_M_X64)
+    #include <intrin.h>
+    #pragma intrinsic(_umul128)
+    #pragma intrinsic(_BitScanReverse64)
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -797,7 +892,8 @@ extern "C" {
 #endif
 
 #define TMC_CHAR_TO_INT(x) ((int32_t)((uint8_t)x))
-#define TMC_MAX_PRECISION 14
+/* Enough to print every digit of the smallest subnormal double, further digits would all be zero. */
+#define TMC_MAX_PRECISION 1074
 #define TMC_DEFAULT_BASE 10
 
 #ifdef TMC_CHECKED_WIDTH
@@ -829,6 +925,54 @@ extern "C" {
 #endif
 /* clang-format on */
 
+/*
+ * Base 10 integer scanning reads 8 characters at a time into an uint64_t (SWAR), first character in the lowest byte.
+ * Adding 6 to each byte carries into the high nibble for characters above '9', so the high nibbles of both the
+ * characters and the characters + 6 are 3 only if all characters are digits.
+ * The digits are then combined pairwise by multiplying with powers of ten and shifting:
+ * 8 digits -> 4 values of 2 digits -> 2 values of 4 digits -> 1 value of 8 digits.
+ */
+static uint64_t scan_LoadEightChars(const char* str) {
+    /* Assembled byte by byte to be independent of endianness, compilers turn this into a single load. */
+    const uint8_t* p = (const uint8_t*)str;
+    return (uint64_t)p[0] | ((uint64_t)p[1] << 8) | ((uint64_t)p[2] << 16) | ((uint64_t)p[3] << 24) |
+           ((uint64_t)p[4] << 32) | ((uint64_t)p[5] << 40) | ((uint64_t)p[6] << 48) | ((uint64_t)p[7] << 56);
+}
+
+static tm_bool scan_IsEightDigits(uint64_t chars) {
+    return ((chars & 0xF0F0F0F0F0F0F0F0u) | (((chars + 0x0606060606060606u) & 0xF0F0F0F0F0F0F0F0u) >> 4)) ==
+           0x3333333333333333u;
+}
+
+static uint32_t scan_EightDigitsValue(uint64_t chars) {
+    const uint64_t mask = 0x000000FF000000FFu;
+    const uint64_t mul1 = 100 + (1000000ull << 32);
+    const uint64_t mul2 = 1 + (10000ull << 32);
+    chars -= 0x3030303030303030u;
+    chars = (chars * 10) + (chars >> 8);
+    return (uint32_t)((((chars & mask) * mul1) + (((chars >> 16) & mask) * mul2)) >> 32);
+}
+
+/*
+ * Scans at most maxChunks runs of 8 decimal digits at the start of str into value.
+ * Callers pick maxChunks so that value can't overflow and scan the remaining digits with range checks.
+ * Returns the number of characters scanned, which is a multiple of 8.
+ */
+static tm_size_t scan_DecimalChunks(const char* str, tm_size_t len, int maxChunks, uint64_t* value) {
+    tm_size_t result = 0;
+    uint64_t current = 0;
+    for (; maxChunks > 0 && len - result >= 8; --maxChunks) {
+        uint64_t chars = scan_LoadEightChars(str + result);
+        if (!scan_IsEightDigits(chars)) {
+            break;
+        }
+        current = current * 100000000u + scan_EightDigitsValue(chars);
+        result += 8;
+    }
+    *value = current;
+    return result;
+}
+
 TMC_DEF tmc_conv_result scan_i32(const char* nullterminated, int32_t* out, int32_t base) {
     TM_ASSERT(base >= 2 && base <= 36);
 
@@ -937,6 +1081,14 @@ TMC_DEF tmc_conv_result scan_i32_n(const char* str, tm_size_t len, int32_t* out,
     const utype maxDigit = MAX_VAL % ubase;
     const utype maxValue = MAX_VAL / ubase;
     utype value = 0;
+    if (ubase == 10) {
+        /* Values of up to 8 digits fit, the remaining digits are range checked below. */
+        uint64_t chunks = 0;
+        tm_size_t scanned = scan_DecimalChunks(p, len, 1, &chunks);
+        value = (utype)chunks;
+        p += scanned;
+        len -= scanned;
+    }
     for (; len; ++p, --len) {
         int32_t cp = TMC_CHAR_TO_INT(*p);
         utype digit;
@@ -1058,6 +1210,14 @@ TMC_DEF tmc_conv_result scan_u32_n(const char* str, tm_size_t len, uint32_t* out
     const utype maxValue = UMAX_VAL / ubase;
     const utype maxDigit = UMAX_VAL % ubase;
     utype value = 0;
+    if (ubase == 10) {
+        /* Values of up to 8 digits fit, the remaining digits are range checked below. */
+        uint64_t chunks = 0;
+        tm_size_t scanned = scan_DecimalChunks(p, len, 1, &chunks);
+        value = (utype)chunks;
+        p += scanned;
+        len -= scanned;
+    }
     for (; len; ++p, --len) {
         int32_t cp = TMC_CHAR_TO_INT(*p);
         utype digit;
@@ -1206,6 +1366,14 @@ TMC_DEF tmc_conv_result scan_i64_n(const char* str, tm_size_t len, int64_t* out,
     const utype maxDigit = MAX_VAL % ubase;
     const utype maxValue = MAX_VAL / ubase;
     utype value = 0;
+    if (ubase == 10) {
+        /* Values of up to 16 digits fit, the remaining digits are range checked below. */
+        uint64_t chunks = 0;
+        tm_size_t scanned = scan_DecimalChunks(p, len, 2, &chunks);
+        value = (utype)chunks;
+        p += scanned;
+        len -= scanned;
+    }
     for (; len; ++p, --len) {
         int32_t cp = TMC_CHAR_TO_INT(*p);
         utype digit;
@@ -1328,6 +1496,14 @@ TMC_DEF tmc_conv_result scan_u64_n(const char* str, tm_size_t len, uint64_t* out
     const utype maxValue = UMAX_VAL / ubase;
     const utype maxDigit = UMAX_VAL % ubase;
     utype value = 0;
+    if (ubase == 10) {
+        /* Values of up to 16 digits fit, the remaining digits are range checked below. */
+        uint64_t chunks = 0;
+        tm_size_t scanned = scan_DecimalChunks(p, len, 2, &chunks);
+        value = (utype)chunks;
+        p += scanned;
+        len -= scanned;
+    }
     for (; len; ++p, --len) {
         int32_t cp = TMC_CHAR_TO_INT(*p);
         utype digit;
@@ -1369,423 +1545,1243 @@ TMC_DEF tmc_conv_result scan_u64_n(const char* str, tm_size_t len, uint64_t* out
     result.ec = (rangeError) ? TM_ERANGE : TM_OK;
     return result;
 }
-TMC_DEF tmc_conv_result scan_float(const char* nullterminated, float* out, uint32_t flags) {
-    double val;
-    tmc_conv_result ret = scan_double(nullterminated, &val, flags);
-    if (ret.size && out) {
-        if (ret.ec == TM_OK
-#if TMC_CLAMP_ON_RANGE_ERROR
-            || ret.ec == TM_ERANGE
+/*
+ * Floats in strings follow this format:
+ * 1234.56789e12 or with PF_HEX 1abc.def0p12
+ * We will scan floats like this:
+ * Scan the first 19 significant digits into an uint64_t mantissa w, so that the number is w * 10^q.
+ * If both w and 10^q are exactly representable, a single multiplication or division is correctly rounded
+ * (Clinger's fast path).
+ * Otherwise multiply w with a truncated 128 bit approximation of 5^q (Eisel-Lemire). The product is accurate
+ * enough to decide the correctly rounded result except for very rare cases close to a rounding boundary.
+ * If there were more than 19 significant digits, the number lies between w * 10^q and (w + 1) * 10^q and the
+ * result is only known if both round to the same value.
+ * When the result can't be decided, all digits are converted exactly using a big decimal (slow path).
+ * Hexadecimal floats are exact in binary and only need to be rounded once.
+ */
+
+/* 64 bit helpers, also used when printing floats. */
+typedef struct {
+    uint64_t low;
+    uint64_t high;
+} tmc_U128;
+
+#if defined(__GNUC__) && defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 tmc_uint128_t;
 #endif
-        ) {
-            *out = (float)val;
-        }
-    }
-    return ret;
-}
-TMC_DEF tmc_conv_result scan_float_n(const char* str, tm_size_t len, float* out, uint32_t flags) {
-    double val;
-    tmc_conv_result ret = scan_double_n(str, len, &val, flags);
-    if (ret.size && out) {
-        if (ret.ec == TM_OK
-#if TMC_CLAMP_ON_RANGE_ERROR
-            || ret.ec == TM_ERANGE
+
+static tmc_U128 tmc_Multiply64(uint64_t a, uint64_t b) {
+    tmc_U128 result;
+#if defined(__GNUC__) && defined(__SIZEOF_INT128__)
+    tmc_uint128_t product = (tmc_uint128_t)a * b;
+    result.low = (uint64_t)product;
+    result.high = (uint64_t)(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    result.low = _umul128(a, b, &result.high);
+#else
+    uint64_t aLow = a & 0xFFFFFFFF;
+    uint64_t aHigh = a >> 32;
+    uint64_t bLow = b & 0xFFFFFFFF;
+    uint64_t bHigh = b >> 32;
+    uint64_t lowLow = aLow * bLow;
+    uint64_t lowHigh = aLow * bHigh;
+    uint64_t highLow = aHigh * bLow;
+    /* Can't overflow, since highLow <= (2^32 - 1)^2. */
+    uint64_t middle = (lowLow >> 32) + (lowHigh & 0xFFFFFFFF) + highLow;
+    result.low = (middle << 32) | (lowLow & 0xFFFFFFFF);
+    result.high = (aHigh * bHigh) + (middle >> 32) + (lowHigh >> 32);
 #endif
-        ) {
-            *out = (float)val;
-        }
+    return result;
+}
+
+static int32_t tmc_LeadingZeroes64(uint64_t value) {
+    TM_ASSERT(value != 0);
+#if defined(__GNUC__)
+    return (int32_t)__builtin_clzll(value);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return 63 - (int32_t)index;
+#else
+    int32_t result = 0;
+    if (!(value & 0xFFFFFFFF00000000)) {
+        result += 32;
+        value <<= 32;
     }
-    return ret;
+    if (!(value & 0xFFFF000000000000)) {
+        result += 16;
+        value <<= 16;
+    }
+    if (!(value & 0xFF00000000000000)) {
+        result += 8;
+        value <<= 8;
+    }
+    if (!(value & 0xF000000000000000)) {
+        result += 4;
+        value <<= 4;
+    }
+    if (!(value & 0xC000000000000000)) {
+        result += 2;
+        value <<= 2;
+    }
+    if (!(value & 0x8000000000000000)) {
+        result += 1;
+    }
+    return result;
+#endif
 }
 
-/*
- * Doubles in strings follow this format:
- * 1234.56789e12
- * We will scan doubles like this:
- * Scan the integer part and fractional part of the string marking where the decimal point is.
- * Scan the exponent if it exists.
- * Change where the decimal point is in the string based on the exponent as much as possible given
- * the number of digits and adjust exponent accordingly.
- * Scan the integer and fractional parts as integers and convert to double.
- * Apply exponent to integer part and exponent + decimal point to fractional part and add them
- * together.
- */
-static const int scan_MaxExponent = 511;
+/* Describes the layout of IEEE 754 binary32 and binary64. */
+typedef struct {
+    int32_t mantissaBits;           /* Explicitly stored bits of the mantissa. */
+    int32_t minimumExponent;        /* Negated exponent bias. */
+    int32_t infinitePower;          /* Biased exponent of infinity. */
+    int32_t minExponentRoundToEven; /* Decimal exponents where w * 5^q can be exactly halfway between two floats. */
+    int32_t maxExponentRoundToEven;
+    int32_t smallestPowerOfTen; /* Any 19 digit mantissa times 10^q rounds to zero below this exponent. */
+    int32_t largestPowerOfTen;  /* Any nonzero mantissa times 10^q rounds to infinity above this exponent. */
+} scan_FloatFormat;
+
+static const scan_FloatFormat scan_DoubleFormat = {52, -1023, 0x7FF, -4, 23, -342, 308};
+static const scan_FloatFormat scan_SingleFormat = {23, -127, 0xFF, -17, 10, -65, 38};
+
+/* Result of a conversion in the representation of scan_FloatFormat. */
+typedef struct {
+    uint64_t mantissa; /* Without the implicit leading bit. */
+    int32_t power2;    /* Biased exponent, negative if the result couldn't be decided. */
+} scan_AdjustedMantissa;
+
+/* Number as it was scanned from the string, value is mantissa * 10^exponent or mantissa * 2^exponent if hex. */
+typedef struct {
+    uint64_t mantissa;
+    int64_t exponent;
+    int64_t explicitExponent; /* Exponent after e/E or p/P. */
+    tm_bool negative;
+    tm_bool hex;
+    /* Whether there were more significant digits than fit into mantissa.
+       For hex floats whether any of the dropped bits were nonzero. */
+    tm_bool truncated;
+    const char* integer;
+    tm_size_t integerLength;
+    const char* fraction;
+    tm_size_t fractionLength;
+} scan_FloatDigits;
 
-static tm_size_t scan_LeadingZeroes(const char* str, tm_size_t len) {
-    const char* start = str;
-    while (len && (*str == '0' || *str == '.')) {
-        ++str;
-        --len;
+/*
+Scans the optional exponent of a float, marker is either 'e' or 'p'.
+PF_FIXED disallows an exponent, PF_SCIENTIFIC requires one, neither or both make the exponent optional.
+Returns false if an exponent is required, but there is none.
+*/
+static tm_bool scan_FloatExponent(const char* str, tm_size_t len, uint32_t flags, int32_t marker, tm_size_t* index,
+                                  int64_t* out) {
+    uint32_t format = flags & (PF_FIXED | PF_SCIENTIFIC);
+    *out = 0;
+    if (format == PF_FIXED) {
+        return TM_TRUE;
+    }
+
+    tm_size_t i = *index;
+    if (i < len && (TMC_CHAR_TO_INT(str[i]) | 0x20) == marker) {
+        ++i;
+        tm_bool negative = TM_FALSE;
+        if (i < len && (str[i] == '-' || str[i] == '+')) {
+            negative = str[i] == '-';
+            ++i;
+        }
+        if (i < len && (uint32_t)(TMC_CHAR_TO_INT(str[i]) - '0') <= 9) {
+            int64_t exponent = 0;
+            for (; i < len; ++i) {
+                uint32_t digit = (uint32_t)(TMC_CHAR_TO_INT(str[i]) - '0');
+                if (digit > 9) {
+                    break;
+                }
+                /* Saturate, exponents this big are out of range for any sensible amount of digits. */
+                if (exponent < 0x10000000) {
+                    exponent = exponent * 10 + digit;
+                }
+            }
+            *out = (negative) ? -exponent : exponent;
+            *index = i;
+            return TM_TRUE;
+        }
     }
-    return (tm_size_t)(str - start);
+    /* Without digits the exponent is not part of the number. */
+    return format != PF_SCIENTIFIC;
 }
-static tm_size_t scan_ScanMantissa(const char* str, tm_size_t len, double* out) {
-    /*
-     * There are three ways to scan a string into a double.
-     * Scan directly into a double, using floating arithmetic (slightly slow).
-     * Scan using int64 and convert to double (uint64 might not be available).
-     * Scan using two int32_t's and combine into double (portable and fast).
-     * We will be using the third option.
-     */
 
-    /* Check whether the digits can be represented in a double */
-    if (len > 18) {
-        len = 18;
-        /* overflow */
+static tm_size_t scan_DecimalFloatDigits(const char* str, tm_size_t len, uint32_t flags, scan_FloatDigits* out) {
+    tm_size_t i = 0;
+    uint64_t mantissa = 0;
+    for (; i < len; ++i) {
+        uint32_t digit = (uint32_t)(TMC_CHAR_TO_INT(str[i]) - '0');
+        if (digit > 9) {
+            break;
+        }
+        /* Wraps around if there are too many digits, see below. */
+        mantissa = mantissa * 10 + digit;
+    }
+    out->integer = str;
+    out->integerLength = i;
+    out->fraction = str + i;
+    out->fractionLength = 0;
+    if (i < len && str[i] == '.') {
+        tm_size_t fractionStart = ++i;
+        for (; i < len; ++i) {
+            uint32_t digit = (uint32_t)(TMC_CHAR_TO_INT(str[i]) - '0');
+            if (digit > 9) {
+                break;
+            }
+            mantissa = mantissa * 10 + digit;
+        }
+        out->fraction = str + fractionStart;
+        out->fractionLength = i - fractionStart;
     }
-
-    const char* start = str;
-
-    int32_t highPart = 0;
-    while (len > 9) {
-        int32_t cp = TMC_CHAR_TO_INT(*str);
-        /* Skip dot */
-        if (cp == '.') {
-            ++str;
-            /* We do not decrease len when we encounter the decimal point, because len only counts digits */
-            cp = TMC_CHAR_TO_INT(*str);
-        }
-        highPart = highPart * 10 + (cp - '0');
-        ++str;
-        --len;
+    tm_size_t digitsCount = out->integerLength + out->fractionLength;
+    if (digitsCount == 0) {
+        return 0;
     }
-    int32_t lowPart = 0;
-    while (len) {
-        int32_t cp = TMC_CHAR_TO_INT(*str);
-        /* Skip dot */
-        if (cp == '.') {
-            ++str;
-            /* We do not decrease len when we encounter the decimal point, because len only counts digits */
-            cp = TMC_CHAR_TO_INT(*str);
-        }
-        lowPart = lowPart * 10 + (cp - '0');
-        ++str;
-        --len;
+    if (!scan_FloatExponent(str, len, flags, 'e', &i, &out->explicitExponent)) {
+        return 0;
     }
-    *out = (1.0e9 * highPart) + lowPart;
-    return (tm_size_t)(str - start);
-}
-static double str_Pow10(double value, int exponent) {
-    TM_ASSERT(exponent < scan_MaxExponent);
-    /* We use the exponentiation by squaring algorithm to calculate pow(10, exponent),
-       while using a lookup table for the squared powers of 10 */
-    static const double PowersOfTen[] = {
-        10, 100, 1.0e4, 1.0e8, 1.0e16, 1.0e32, 1.0e64, 1.0e128, 1.0e256,
-    };
 
-    int exponentNegative = exponent < 0;
-    if (exponentNegative) {
-        exponent = -exponent;
+    out->mantissa = mantissa;
+    out->exponent = out->explicitExponent - (int64_t)out->fractionLength;
+    out->hex = TM_FALSE;
+    out->truncated = TM_FALSE;
+
+    if (digitsCount > 19) {
+        /* Leading zeroes are not significant. */
+        tm_size_t leadingZeroes = 0;
+        while (leadingZeroes < out->integerLength && out->integer[leadingZeroes] == '0') {
+            ++leadingZeroes;
+        }
+        if (leadingZeroes == out->integerLength) {
+            tm_size_t fractionZeroes = 0;
+            while (fractionZeroes < out->fractionLength && out->fraction[fractionZeroes] == '0') {
+                ++fractionZeroes;
+            }
+            leadingZeroes += fractionZeroes;
+        }
+
+        if (digitsCount - leadingZeroes > 19) {
+            /* Scan again, stopping after 19 significant digits. */
+            const uint64_t minNineteenDigits = 1000000000000000000;
+            tm_size_t j = 0;
+            mantissa = 0;
+            for (; mantissa < minNineteenDigits && j < out->integerLength; ++j) {
+                mantissa = mantissa * 10 + (uint64_t)(out->integer[j] - '0');
+            }
+            if (mantissa >= minNineteenDigits) {
+                out->exponent = out->explicitExponent + (int64_t)(out->integerLength - j);
+            } else {
+                for (j = 0; mantissa < minNineteenDigits && j < out->fractionLength; ++j) {
+                    mantissa = mantissa * 10 + (uint64_t)(out->fraction[j] - '0');
+                }
+                out->exponent = out->explicitExponent - (int64_t)j;
+            }
+            out->mantissa = mantissa;
+            out->truncated = TM_TRUE;
+        }
     }
+    return i;
+}
 
-    double tenToThePower = 1.0;
-    uint32_t uexp = (uint32_t)exponent; /* Convert to uint32_t for bit twiddling. */
-    for (const double* entry = PowersOfTen; uexp; uexp >>= 1, ++entry) {
-        if (uexp & 0x1) {
-            tenToThePower *= *entry;
+static tm_size_t scan_HexFloatDigits(const char* str, tm_size_t len, uint32_t flags, scan_FloatDigits* out) {
+    tm_size_t i = 0;
+    uint64_t mantissa = 0;
+    int64_t exponent = 0;
+    tm_bool truncated = TM_FALSE;
+    tm_bool fraction = TM_FALSE;
+    tm_size_t digitsCount = 0;
+    for (; i < len; ++i) {
+        int32_t cp = TMC_CHAR_TO_INT(str[i]);
+        uint32_t digit;
+        if (TM_ISDIGIT(cp)) {
+            digit = (uint32_t)(cp - '0');
+        } else if (cp >= 'a' && cp <= 'f') {
+            digit = (uint32_t)(cp - 'a' + 10);
+        } else if (cp >= 'A' && cp <= 'F') {
+            digit = (uint32_t)(cp - 'A' + 10);
+        } else if (cp == '.' && !fraction) {
+            fraction = TM_TRUE;
+            continue;
+        } else {
+            break;
+        }
+        ++digitsCount;
+        if ((mantissa >> 60) == 0) {
+            mantissa = (mantissa << 4) | digit;
+            if (fraction) {
+                exponent -= 4;
+            }
+        } else {
+            /* Only the dropped bits being nonzero matters for rounding. */
+            if (!fraction) {
+                exponent += 4;
+            }
+            truncated |= (digit != 0);
         }
     }
-    if (exponentNegative) {
-        value /= tenToThePower;
-    } else {
-        value *= tenToThePower;
+    if (digitsCount == 0) {
+        return 0;
+    }
+    if (!scan_FloatExponent(str, len, flags, 'p', &i, &out->explicitExponent)) {
+        return 0;
     }
-    return value;
-}
 
-TMC_DEF tmc_conv_result scan_double(const char* nullterminated, double* out, uint32_t flags) {
-    /* TODO: implement flags */
-    (void)flags;
+    out->mantissa = mantissa;
+    out->exponent = exponent + out->explicitExponent;
+    out->hex = TM_TRUE;
+    out->truncated = truncated;
+    out->integer = str;
+    out->integerLength = 0;
+    out->fraction = str;
+    out->fractionLength = 0;
+    return i;
+}
 
+static tmc_conv_result scan_FloatDigitsN(const char* str, tm_size_t len, uint32_t flags, scan_FloatDigits* out) {
     tmc_conv_result result = {0, TM_EINVAL};
 
-    if (!nullterminated) {
+    tm_size_t i = 0;
+    out->negative = TM_FALSE;
+    if (i < len && str[i] == '-') {
+        out->negative = TM_TRUE;
+        ++i;
+    }
+    tm_size_t size = (flags & PF_HEX) ? scan_HexFloatDigits(str + i, len - i, flags, out)
+                                      : scan_DecimalFloatDigits(str + i, len - i, flags, out);
+    if (size == 0) {
         return result;
     }
+    result.size = i + size;
+    result.ec = TM_OK;
+    return result;
+}
 
-    const char* start = nullterminated;
-    const char* p = nullterminated;
+/* Truncated 128 bit values of 5^q for q in [-342, 308], normalized so that the most significant bit is set. */
+static const int32_t scan_SmallestPowerOfFive = -342;
+static const uint64_t scan_PowersOfFive128[] = {
+    0xeef453d6923bd65a, 0x113faa2906a13b3f, 0x9558b4661b6565f8, 0x4ac7ca59a424c507,
+    0xbaaee17fa23ebf76, 0x5d79bcf00d2df649, 0xe95a99df8ace6f53, 0xf4d82c2c107973dc,
+    0x91d8a02bb6c10594, 0x79071b9b8a4be869, 0xb64ec836a47146f9, 0x9748e2826cdee284,
+    0xe3e27a444d8d98b7, 0xfd1b1b2308169b25, 0x8e6d8c6ab0787f72, 0xfe30f0f5e50e20f7,
+    0xb208ef855c969f4f, 0xbdbd2d335e51a935, 0xde8b2b66b3bc4723, 0xad2c788035e61382,
+    0x8b16fb203055ac76, 0x4c3bcb5021afcc31, 0xaddcb9e83c6b1793, 0xdf4abe242a1bbf3d,
+    0xd953e8624b85dd78, 0xd71d6dad34a2af0d, 0x87d4713d6f33aa6b, 0x8672648c40e5ad68,
+    0xa9c98d8ccb009506, 0x680efdaf511f18c2, 0xd43bf0effdc0ba48, 0x0212bd1b2566def2,
+    0x84a57695fe98746d, 0x014bb630f7604b57, 0xa5ced43b7e3e9188, 0x419ea3bd35385e2d,
+    0xcf42894a5dce35ea, 0x52064cac828675b9, 0x818995ce7aa0e1b2, 0x7343efebd1940993,
+    0xa1ebfb4219491a1f, 0x1014ebe6c5f90bf8, 0xca66fa129f9b60a6, 0xd41a26e077774ef6,
+    0xfd00b897478238d0, 0x8920b098955522b4, 0x9e20735e8cb16382, 0x55b46e5f5d5535b0,
+    0xc5a890362fddbc62, 0xeb2189f734aa831d, 0xf712b443bbd52b7b, 0xa5e9ec7501d523e4,
+    0x9a6bb0aa55653b2d, 0x47b233c92125366e, 0xc1069cd4eabe89f8, 0x999ec0bb696e840a,
+    0xf148440a256e2c76, 0xc00670ea43ca250d, 0x96cd2a865764dbca, 0x380406926a5e5728,
+    0xbc807527ed3e12bc, 0xc605083704f5ecf2, 0xeba09271e88d976b, 0xf7864a44c633682e,
+    0x93445b8731587ea3, 0x7ab3ee6afbe0211d, 0xb8157268fdae9e4c, 0x5960ea05bad82964,
+    0xe61acf033d1a45df, 0x6fb92487298e33bd, 0x8fd0c16206306bab, 0xa5d3b6d479f8e056,
+    0xb3c4f1ba87bc8696, 0x8f48a4899877186c, 0xe0b62e2929aba83c, 0x331acdabfe94de87,
+    0x8c71dcd9ba0b4925, 0x9ff0c08b7f1d0b14, 0xaf8e5410288e1b6f, 0x07ecf0ae5ee44dd9,
+    0xdb71e91432b1a24a, 0xc9e82cd9f69d6150, 0x892731ac9faf056e, 0xbe311c083a225cd2,
+    0xab70fe17c79ac6ca, 0x6dbd630a48aaf406, 0xd64d3d9db981787d, 0x092cbbccdad5b108,
+    0x85f0468293f0eb4e, 0x25bbf56008c58ea5, 0xa76c582338ed2621, 0xaf2af2b80af6f24e,
+    0xd1476e2c07286faa, 0x1af5af660db4aee1, 0x82cca4db847945ca, 0x50d98d9fc890ed4d,
+    0xa37fce126597973c, 0xe50ff107bab528a0, 0xcc5fc196fefd7d0c, 0x1e53ed49a96272c8,
+    0xff77b1fcbebcdc4f, 0x25e8e89c13bb0f7a, 0x9faacf3df73609b1, 0x77b191618c54e9ac,
+    0xc795830d75038c1d, 0xd59df5b9ef6a2417, 0xf97ae3d0d2446f25, 0x4b0573286b44ad1d,
+    0x9becce62836ac577, 0x4ee367f9430aec32, 0xc2e801fb244576d5, 0x229c41f793cda73f,
+    0xf3a20279ed56d48a, 0x6b43527578c1110f, 0x9845418c345644d6, 0x830a13896b78aaa9,
+    0xbe5691ef416bd60c, 0x23cc986bc656d553, 0xedec366b11c6cb8f, 0x2cbfbe86b7ec8aa8,
+    0x94b3a202eb1c3f39, 0x7bf7d71432f3d6a9, 0xb9e08a83a5e34f07, 0xdaf5ccd93fb0cc53,
+    0xe858ad248f5c22c9, 0xd1b3400f8f9cff68, 0x91376c36d99995be, 0x23100809b9c21fa1,
+    0xb58547448ffffb2d, 0xabd40a0c2832a78a, 0xe2e69915b3fff9f9, 0x16c90c8f323f516c,
+    0x8dd01fad907ffc3b, 0xae3da7d97f6792e3, 0xb1442798f49ffb4a, 0x99cd11cfdf41779c,
+    0xdd95317f31c7fa1d, 0x40405643d711d583, 0x8a7d3eef7f1cfc52, 0x482835ea666b2572,
+    0xad1c8eab5ee43b66, 0xda3243650005eecf, 0xd863b256369d4a40, 0x90bed43e40076a82,
+    0x873e4f75e2224e68, 0x5a7744a6e804a291, 0xa90de3535aaae202, 0x711515d0a205cb36,
+    0xd3515c2831559a83, 0x0d5a5b44ca873e03, 0x8412d9991ed58091, 0xe858790afe9486c2,
+    0xa5178fff668ae0b6, 0x626e974dbe39a872, 0xce5d73ff402d98e3, 0xfb0a3d212dc8128f,
+    0x80fa687f881c7f8e, 0x7ce66634bc9d0b99, 0xa139029f6a239f72, 0x1c1fffc1ebc44e80,
+    0xc987434744ac874e, 0xa327ffb266b56220, 0xfbe9141915d7a922, 0x4bf1ff9f0062baa8,
+    0x9d71ac8fada6c9b5, 0x6f773fc3603db4a9, 0xc4ce17b399107c22, 0xcb550fb4384d21d3,
+    0xf6019da07f549b2b, 0x7e2a53a146606a48, 0x99c102844f94e0fb, 0x2eda7444cbfc426d,
+    0xc0314325637a1939, 0xfa911155fefb5308, 0xf03d93eebc589f88, 0x793555ab7eba27ca,
+    0x96267c7535b763b5, 0x4bc1558b2f3458de, 0xbbb01b9283253ca2, 0x9eb1aaedfb016f16,
+    0xea9c227723ee8bcb, 0x465e15a979c1cadc, 0x92a1958a7675175f, 0x0bfacd89ec191ec9,
+    0xb749faed14125d36, 0xcef980ec671f667b, 0xe51c79a85916f484, 0x82b7e12780e7401a,
+    0x8f31cc0937ae58d2, 0xd1b2ecb8b0908810, 0xb2fe3f0b8599ef07, 0x861fa7e6dcb4aa15,
+    0xdfbdcece67006ac9, 0x67a791e093e1d49a, 0x8bd6a141006042bd, 0xe0c8bb2c5c6d24e0,
+    0xaecc49914078536d, 0x58fae9f773886e18, 0xda7f5bf590966848, 0xaf39a475506a899e,
+    0x888f99797a5e012d, 0x6d8406c952429603, 0xaab37fd7d8f58178, 0xc8e5087ba6d33b83,
+    0xd5605fcdcf32e1d6, 0xfb1e4a9a90880a64, 0x855c3be0a17fcd26, 0x5cf2eea09a55067f,
+    0xa6b34ad8c9dfc06f, 0xf42faa48c0ea481e, 0xd0601d8efc57b08b, 0xf13b94daf124da26,
+    0x823c12795db6ce57, 0x76c53d08d6b70858, 0xa2cb1717b52481ed, 0x54768c4b0c64ca6e,
+    0xcb7ddcdda26da268, 0xa9942f5dcf7dfd09, 0xfe5d54150b090b02, 0xd3f93b35435d7c4c,
+    0x9efa548d26e5a6e1, 0xc47bc5014a1a6daf, 0xc6b8e9b0709f109a, 0x359ab6419ca1091b,
+    0xf867241c8cc6d4c0, 0xc30163d203c94b62, 0x9b407691d7fc44f8, 0x79e0de63425dcf1d,
+    0xc21094364dfb5636, 0x985915fc12f542e4, 0xf294b943e17a2bc4, 0x3e6f5b7b17b2939d,
+    0x979cf3ca6cec5b5a, 0xa705992ceecf9c42, 0xbd8430bd08277231, 0x50c6ff782a838353,
+    0xece53cec4a314ebd, 0xa4f8bf5635246428, 0x940f4613ae5ed136, 0x871b7795e136be99,
+    0xb913179899f68584, 0x28e2557b59846e3f, 0xe757dd7ec07426e5, 0x331aeada2fe589cf,
+    0x9096ea6f3848984f, 0x3ff0d2c85def7621, 0xb4bca50b065abe63, 0x0fed077a756b53a9,
+    0xe1ebce4dc7f16dfb, 0xd3e8495912c62894, 0x8d3360f09cf6e4bd, 0x64712dd7abbbd95c,
+    0xb080392cc4349dec, 0xbd8d794d96aacfb3, 0xdca04777f541c567, 0xecf0d7a0fc5583a0,
+    0x89e42caaf9491b60, 0xf41686c49db57244, 0xac5d37d5b79b6239, 0x311c2875c522ced5,
+    0xd77485cb25823ac7, 0x7d633293366b828b, 0x86a8d39ef77164bc, 0xae5dff9c02033197,
+    0xa8530886b54dbdeb, 0xd9f57f830283fdfc, 0xd267caa862a12d66, 0xd072df63c324fd7b,
+    0x8380dea93da4bc60, 0x4247cb9e59f71e6d, 0xa46116538d0deb78, 0x52d9be85f074e608,
+    0xcd795be870516656, 0x67902e276c921f8b, 0x806bd9714632dff6, 0x00ba1cd8a3db53b6,
+    0xa086cfcd97bf97f3, 0x80e8a40eccd228a4, 0xc8a883c0fdaf7df0, 0x6122cd128006b2cd,
+    0xfad2a4b13d1b5d6c, 0x796b805720085f81, 0x9cc3a6eec6311a63, 0xcbe3303674053bb0,
+    0xc3f490aa77bd60fc, 0xbedbfc4411068a9c, 0xf4f1b4d515acb93b, 0xee92fb5515482d44,
+    0x991711052d8bf3c5, 0x751bdd152d4d1c4a, 0xbf5cd54678eef0b6, 0xd262d45a78a0635d,
+    0xef340a98172aace4, 0x86fb897116c87c34, 0x9580869f0e7aac0e, 0xd45d35e6ae3d4da0,
+    0xbae0a846d2195712, 0x8974836059cca109, 0xe998d258869facd7, 0x2bd1a438703fc94b,
+    0x91ff83775423cc06, 0x7b6306a34627ddcf, 0xb67f6455292cbf08, 0x1a3bc84c17b1d542,
+    0xe41f3d6a7377eeca, 0x20caba5f1d9e4a93, 0x8e938662882af53e, 0x547eb47b7282ee9c,
+    0xb23867fb2a35b28d, 0xe99e619a4f23aa43, 0xdec681f9f4c31f31, 0x6405fa00e2ec94d4,
+    0x8b3c113c38f9f37e, 0xde83bc408dd3dd04, 0xae0b158b4738705e, 0x9624ab50b148d445,
+    0xd98ddaee19068c76, 0x3badd624dd9b0957, 0x87f8a8d4cfa417c9, 0xe54ca5d70a80e5d6,
+    0xa9f6d30a038d1dbc, 0x5e9fcf4ccd211f4c, 0xd47487cc8470652b, 0x7647c3200069671f,
+    0x84c8d4dfd2c63f3b, 0x29ecd9f40041e073, 0xa5fb0a17c777cf09, 0xf468107100525890,
+    0xcf79cc9db955c2cc, 0x7182148d4066eeb4, 0x81ac1fe293d599bf, 0xc6f14cd848405530,
+    0xa21727db38cb002f, 0xb8ada00e5a506a7c, 0xca9cf1d206fdc03b, 0xa6d90811f0e4851c,
+    0xfd442e4688bd304a, 0x908f4a166d1da663, 0x9e4a9cec15763e2e, 0x9a598e4e043287fe,
+    0xc5dd44271ad3cdba, 0x40eff1e1853f29fd, 0xf7549530e188c128, 0xd12bee59e68ef47c,
+    0x9a94dd3e8cf578b9, 0x82bb74f8301958ce, 0xc13a148e3032d6e7, 0xe36a52363c1faf01,
+    0xf18899b1bc3f8ca1, 0xdc44e6c3cb279ac1, 0x96f5600f15a7b7e5, 0x29ab103a5ef8c0b9,
+    0xbcb2b812db11a5de, 0x7415d448f6b6f0e7, 0xebdf661791d60f56, 0x111b495b3464ad21,
+    0x936b9fcebb25c995, 0xcab10dd900beec34, 0xb84687c269ef3bfb, 0x3d5d514f40eea742,
+    0xe65829b3046b0afa, 0x0cb4a5a3112a5112, 0x8ff71a0fe2c2e6dc, 0x47f0e785eaba72ab,
+    0xb3f4e093db73a093, 0x59ed216765690f56, 0xe0f218b8d25088b8, 0x306869c13ec3532c,
+    0x8c974f7383725573, 0x1e414218c73a13fb, 0xafbd2350644eeacf, 0xe5d1929ef90898fa,
+    0xdbac6c247d62a583, 0xdf45f746b74abf39, 0x894bc396ce5da772, 0x6b8bba8c328eb783,
+    0xab9eb47c81f5114f, 0x066ea92f3f326564, 0xd686619ba27255a2, 0xc80a537b0efefebd,
+    0x8613fd0145877585, 0xbd06742ce95f5f36, 0xa798fc4196e952e7, 0x2c48113823b73704,
+    0xd17f3b51fca3a7a0, 0xf75a15862ca504c5, 0x82ef85133de648c4, 0x9a984d73dbe722fb,
+    0xa3ab66580d5fdaf5, 0xc13e60d0d2e0ebba, 0xcc963fee10b7d1b3, 0x318df905079926a8,
+    0xffbbcfe994e5c61f, 0xfdf17746497f7052, 0x9fd561f1fd0f9bd3, 0xfeb6ea8bedefa633,
+    0xc7caba6e7c5382c8, 0xfe64a52ee96b8fc0, 0xf9bd690a1b68637b, 0x3dfdce7aa3c673b0,
+    0x9c1661a651213e2d, 0x06bea10ca65c084e, 0xc31bfa0fe5698db8, 0x486e494fcff30a62,
+    0xf3e2f893dec3f126, 0x5a89dba3c3efccfa, 0x986ddb5c6b3a76b7, 0xf89629465a75e01c,
+    0xbe89523386091465, 0xf6bbb397f1135823, 0xee2ba6c0678b597f, 0x746aa07ded582e2c,
+    0x94db483840b717ef, 0xa8c2a44eb4571cdc, 0xba121a4650e4ddeb, 0x92f34d62616ce413,
+    0xe896a0d7e51e1566, 0x77b020baf9c81d17, 0x915e2486ef32cd60, 0x0ace1474dc1d122e,
+    0xb5b5ada8aaff80b8, 0x0d819992132456ba, 0xe3231912d5bf60e6, 0x10e1fff697ed6c69,
+    0x8df5efabc5979c8f, 0xca8d3ffa1ef463c1, 0xb1736b96b6fd83b3, 0xbd308ff8a6b17cb2,
+    0xddd0467c64bce4a0, 0xac7cb3f6d05ddbde, 0x8aa22c0dbef60ee4, 0x6bcdf07a423aa96b,
+    0xad4ab7112eb3929d, 0x86c16c98d2c953c6, 0xd89d64d57a607744, 0xe871c7bf077ba8b7,
+    0x87625f056c7c4a8b, 0x11471cd764ad4972, 0xa93af6c6c79b5d2d, 0xd598e40d3dd89bcf,
+    0xd389b47879823479, 0x4aff1d108d4ec2c3, 0x843610cb4bf160cb, 0xcedf722a585139ba,
+    0xa54394fe1eedb8fe, 0xc2974eb4ee658828, 0xce947a3da6a9273e, 0x733d226229feea32,
+    0x811ccc668829b887, 0x0806357d5a3f525f, 0xa163ff802a3426a8, 0xca07c2dcb0cf26f7,
+    0xc9bcff6034c13052, 0xfc89b393dd02f0b5, 0xfc2c3f3841f17c67, 0xbbac2078d443ace2,
+    0x9d9ba7832936edc0, 0xd54b944b84aa4c0d, 0xc5029163f384a931, 0x0a9e795e65d4df11,
+    0xf64335bcf065d37d, 0x4d4617b5ff4a16d5, 0x99ea0196163fa42e, 0x504bced1bf8e4e45,
+    0xc06481fb9bcf8d39, 0xe45ec2862f71e1d6, 0xf07da27a82c37088, 0x5d767327bb4e5a4c,
+    0x964e858c91ba2655, 0x3a6a07f8d510f86f, 0xbbe226efb628afea, 0x890489f70a55368b,
+    0xeadab0aba3b2dbe5, 0x2b45ac74ccea842e, 0x92c8ae6b464fc96f, 0x3b0b8bc90012929d,
+    0xb77ada0617e3bbcb, 0x09ce6ebb40173744, 0xe55990879ddcaabd, 0xcc420a6a101d0515,
+    0x8f57fa54c2a9eab6, 0x9fa946824a12232d, 0xb32df8e9f3546564, 0x47939822dc96abf9,
+    0xdff9772470297ebd, 0x59787e2b93bc56f7, 0x8bfbea76c619ef36, 0x57eb4edb3c55b65a,
+    0xaefae51477a06b03, 0xede622920b6b23f1, 0xdab99e59958885c4, 0xe95fab368e45eced,
+    0x88b402f7fd75539b, 0x11dbcb0218ebb414, 0xaae103b5fcd2a881, 0xd652bdc29f26a119,
+    0xd59944a37c0752a2, 0x4be76d3346f0495f, 0x857fcae62d8493a5, 0x6f70a4400c562ddb,
+    0xa6dfbd9fb8e5b88e, 0xcb4ccd500f6bb952, 0xd097ad07a71f26b2, 0x7e2000a41346a7a7,
+    0x825ecc24c873782f, 0x8ed400668c0c28c8, 0xa2f67f2dfa90563b, 0x728900802f0f32fa,
+    0xcbb41ef979346bca, 0x4f2b40a03ad2ffb9, 0xfea126b7d78186bc, 0xe2f610c84987bfa8,
+    0x9f24b832e6b0f436, 0x0dd9ca7d2df4d7c9, 0xc6ede63fa05d3143, 0x91503d1c79720dbb,
+    0xf8a95fcf88747d94, 0x75a44c6397ce912a, 0x9b69dbe1b548ce7c, 0xc986afbe3ee11aba,
+    0xc24452da229b021b, 0xfbe85badce996168, 0xf2d56790ab41c2a2, 0xfae27299423fb9c3,
+    0x97c560ba6b0919a5, 0xdccd879fc967d41a, 0xbdb6b8e905cb600f, 0x5400e987bbc1c920,
+    0xed246723473e3813, 0x290123e9aab23b68, 0x9436c0760c86e30b, 0xf9a0b6720aaf6521,
+    0xb94470938fa89bce, 0xf808e40e8d5b3e69, 0xe7958cb87392c2c2, 0xb60b1d1230b20e04,
+    0x90bd77f3483bb9b9, 0xb1c6f22b5e6f48c2, 0xb4ecd5f01a4aa828, 0x1e38aeb6360b1af3,
+    0xe2280b6c20dd5232, 0x25c6da63c38de1b0, 0x8d590723948a535f, 0x579c487e5a38ad0e,
+    0xb0af48ec79ace837, 0x2d835a9df0c6d851, 0xdcdb1b2798182244, 0xf8e431456cf88e65,
+    0x8a08f0f8bf0f156b, 0x1b8e9ecb641b58ff, 0xac8b2d36eed2dac5, 0xe272467e3d222f3f,
+    0xd7adf884aa879177, 0x5b0ed81dcc6abb0f, 0x86ccbb52ea94baea, 0x98e947129fc2b4e9,
+    0xa87fea27a539e9a5, 0x3f2398d747b36224, 0xd29fe4b18e88640e, 0x8eec7f0d19a03aad,
+    0x83a3eeeef9153e89, 0x1953cf68300424ac, 0xa48ceaaab75a8e2b, 0x5fa8c3423c052dd7,
+    0xcdb02555653131b6, 0x3792f412cb06794d, 0x808e17555f3ebf11, 0xe2bbd88bbee40bd0,
+    0xa0b19d2ab70e6ed6, 0x5b6aceaeae9d0ec4, 0xc8de047564d20a8b, 0xf245825a5a445275,
+    0xfb158592be068d2e, 0xeed6e2f0f0d56712, 0x9ced737bb6c4183d, 0x55464dd69685606b,
+    0xc428d05aa4751e4c, 0xaa97e14c3c26b886, 0xf53304714d9265df, 0xd53dd99f4b3066a8,
+    0x993fe2c6d07b7fab, 0xe546a8038efe4029, 0xbf8fdb78849a5f96, 0xde98520472bdd033,
+    0xef73d256a5c0f77c, 0x963e66858f6d4440, 0x95a8637627989aad, 0xdde7001379a44aa8,
+    0xbb127c53b17ec159, 0x5560c018580d5d52, 0xe9d71b689dde71af, 0xaab8f01e6e10b4a6,
+    0x9226712162ab070d, 0xcab3961304ca70e8, 0xb6b00d69bb55c8d1, 0x3d607b97c5fd0d22,
+    0xe45c10c42a2b3b05, 0x8cb89a7db77c506a, 0x8eb98a7a9a5b04e3, 0x77f3608e92adb242,
+    0xb267ed1940f1c61c, 0x55f038b237591ed3, 0xdf01e85f912e37a3, 0x6b6c46dec52f6688,
+    0x8b61313bbabce2c6, 0x2323ac4b3b3da015, 0xae397d8aa96c1b77, 0xabec975e0a0d081a,
+    0xd9c7dced53c72255, 0x96e7bd358c904a21, 0x881cea14545c7575, 0x7e50d64177da2e54,
+    0xaa242499697392d2, 0xdde50bd1d5d0b9e9, 0xd4ad2dbfc3d07787, 0x955e4ec64b44e864,
+    0x84ec3c97da624ab4, 0xbd5af13bef0b113e, 0xa6274bbdd0fadd61, 0xecb1ad8aeacdd58e,
+    0xcfb11ead453994ba, 0x67de18eda5814af2, 0x81ceb32c4b43fcf4, 0x80eacf948770ced7,
+    0xa2425ff75e14fc31, 0xa1258379a94d028d, 0xcad2f7f5359a3b3e, 0x096ee45813a04330,
+    0xfd87b5f28300ca0d, 0x8bca9d6e188853fc, 0x9e74d1b791e07e48, 0x775ea264cf55347e,
+    0xc612062576589dda, 0x95364afe032a819e, 0xf79687aed3eec551, 0x3a83ddbd83f52205,
+    0x9abe14cd44753b52, 0xc4926a9672793543, 0xc16d9a0095928a27, 0x75b7053c0f178294,
+    0xf1c90080baf72cb1, 0x5324c68b12dd6339, 0x971da05074da7bee, 0xd3f6fc16ebca5e04,
+    0xbce5086492111aea, 0x88f4bb1ca6bcf585, 0xec1e4a7db69561a5, 0x2b31e9e3d06c32e6,
+    0x9392ee8e921d5d07, 0x3aff322e62439fd0, 0xb877aa3236a4b449, 0x09befeb9fad487c3,
+    0xe69594bec44de15b, 0x4c2ebe687989a9b4, 0x901d7cf73ab0acd9, 0x0f9d37014bf60a11,
+    0xb424dc35095cd80f, 0x538484c19ef38c95, 0xe12e13424bb40e13, 0x2865a5f206b06fba,
+    0x8cbccc096f5088cb, 0xf93f87b7442e45d4, 0xafebff0bcb24aafe, 0xf78f69a51539d749,
+    0xdbe6fecebdedd5be, 0xb573440e5a884d1c, 0x89705f4136b4a597, 0x31680a88f8953031,
+    0xabcc77118461cefc, 0xfdc20d2b36ba7c3e, 0xd6bf94d5e57a42bc, 0x3d32907604691b4d,
+    0x8637bd05af6c69b5, 0xa63f9a49c2c1b110, 0xa7c5ac471b478423, 0x0fcf80dc33721d54,
+    0xd1b71758e219652b, 0xd3c36113404ea4a9, 0x83126e978d4fdf3b, 0x645a1cac083126ea,
+    0xa3d70a3d70a3d70a, 0x3d70a3d70a3d70a4, 0xcccccccccccccccc, 0xcccccccccccccccd,
+    0x8000000000000000, 0x0000000000000000, 0xa000000000000000, 0x0000000000000000,
+    0xc800000000000000, 0x0000000000000000, 0xfa00000000000000, 0x0000000000000000,
+    0x9c40000000000000, 0x0000000000000000, 0xc350000000000000, 0x0000000000000000,
+    0xf424000000000000, 0x0000000000000000, 0x9896800000000000, 0x0000000000000000,
+    0xbebc200000000000, 0x0000000000000000, 0xee6b280000000000, 0x0000000000000000,
+    0x9502f90000000000, 0x0000000000000000, 0xba43b74000000000, 0x0000000000000000,
+    0xe8d4a51000000000, 0x0000000000000000, 0x9184e72a00000000, 0x0000000000000000,
+    0xb5e620f480000000, 0x0000000000000000, 0xe35fa931a0000000, 0x0000000000000000,
+    0x8e1bc9bf04000000, 0x0000000000000000, 0xb1a2bc2ec5000000, 0x0000000000000000,
+    0xde0b6b3a76400000, 0x0000000000000000, 0x8ac7230489e80000, 0x0000000000000000,
+    0xad78ebc5ac620000, 0x0000000000000000, 0xd8d726b7177a8000, 0x0000000000000000,
+    0x878678326eac9000, 0x0000000000000000, 0xa968163f0a57b400, 0x0000000000000000,
+    0xd3c21bcecceda100, 0x0000000000000000, 0x84595161401484a0, 0x0000000000000000,
+    0xa56fa5b99019a5c8, 0x0000000000000000, 0xcecb8f27f4200f3a, 0x0000000000000000,
+    0x813f3978f8940984, 0x4000000000000000, 0xa18f07d736b90be5, 0x5000000000000000,
+    0xc9f2c9cd04674ede, 0xa400000000000000, 0xfc6f7c4045812296, 0x4d00000000000000,
+    0x9dc5ada82b70b59d, 0xf020000000000000, 0xc5371912364ce305, 0x6c28000000000000,
+    0xf684df56c3e01bc6, 0xc732000000000000, 0x9a130b963a6c115c, 0x3c7f400000000000,
+    0xc097ce7bc90715b3, 0x4b9f100000000000, 0xf0bdc21abb48db20, 0x1e86d40000000000,
+    0x96769950b50d88f4, 0x1314448000000000, 0xbc143fa4e250eb31, 0x17d955a000000000,
+    0xeb194f8e1ae525fd, 0x5dcfab0800000000, 0x92efd1b8d0cf37be, 0x5aa1cae500000000,
+    0xb7abc627050305ad, 0xf14a3d9e40000000, 0xe596b7b0c643c719, 0x6d9ccd05d0000000,
+    0x8f7e32ce7bea5c6f, 0xe4820023a2000000, 0xb35dbf821ae4f38b, 0xdda2802c8a800000,
+    0xe0352f62a19e306e, 0xd50b2037ad200000, 0x8c213d9da502de45, 0x4526f422cc340000,
+    0xaf298d050e4395d6, 0x9670b12b7f410000, 0xdaf3f04651d47b4c, 0x3c0cdd765f114000,
+    0x88d8762bf324cd0f, 0xa5880a69fb6ac800, 0xab0e93b6efee0053, 0x8eea0d047a457a00,
+    0xd5d238a4abe98068, 0x72a4904598d6d880, 0x85a36366eb71f041, 0x47a6da2b7f864750,
+    0xa70c3c40a64e6c51, 0x999090b65f67d924, 0xd0cf4b50cfe20765, 0xfff4b4e3f741cf6d,
+    0x82818f1281ed449f, 0xbff8f10e7a8921a4, 0xa321f2d7226895c7, 0xaff72d52192b6a0d,
+    0xcbea6f8ceb02bb39, 0x9bf4f8a69f764490, 0xfee50b7025c36a08, 0x02f236d04753d5b4,
+    0x9f4f2726179a2245, 0x01d762422c946590, 0xc722f0ef9d80aad6, 0x424d3ad2b7b97ef5,
+    0xf8ebad2b84e0d58b, 0xd2e0898765a7deb2, 0x9b934c3b330c8577, 0x63cc55f49f88eb2f,
+    0xc2781f49ffcfa6d5, 0x3cbf6b71c76b25fb, 0xf316271c7fc3908a, 0x8bef464e3945ef7a,
+    0x97edd871cfda3a56, 0x97758bf0e3cbb5ac, 0xbde94e8e43d0c8ec, 0x3d52eeed1cbea317,
+    0xed63a231d4c4fb27, 0x4ca7aaa863ee4bdd, 0x945e455f24fb1cf8, 0x8fe8caa93e74ef6a,
+    0xb975d6b6ee39e436, 0xb3e2fd538e122b44, 0xe7d34c64a9c85d44, 0x60dbbca87196b616,
+    0x90e40fbeea1d3a4a, 0xbc8955e946fe31cd, 0xb51d13aea4a488dd, 0x6babab6398bdbe41,
+    0xe264589a4dcdab14, 0xc696963c7eed2dd1, 0x8d7eb76070a08aec, 0xfc1e1de5cf543ca2,
+    0xb0de65388cc8ada8, 0x3b25a55f43294bcb, 0xdd15fe86affad912, 0x49ef0eb713f39ebe,
+    0x8a2dbf142dfcc7ab, 0x6e3569326c784337, 0xacb92ed9397bf996, 0x49c2c37f07965404,
+    0xd7e77a8f87daf7fb, 0xdc33745ec97be906, 0x86f0ac99b4e8dafd, 0x69a028bb3ded71a3,
+    0xa8acd7c0222311bc, 0xc40832ea0d68ce0c, 0xd2d80db02aabd62b, 0xf50a3fa490c30190,
+    0x83c7088e1aab65db, 0x792667c6da79e0fa, 0xa4b8cab1a1563f52, 0x577001b891185938,
+    0xcde6fd5e09abcf26, 0xed4c0226b55e6f86, 0x80b05e5ac60b6178, 0x544f8158315b05b4,
+    0xa0dc75f1778e39d6, 0x696361ae3db1c721, 0xc913936dd571c84c, 0x03bc3a19cd1e38e9,
+    0xfb5878494ace3a5f, 0x04ab48a04065c723, 0x9d174b2dcec0e47b, 0x62eb0d64283f9c76,
+    0xc45d1df942711d9a, 0x3ba5d0bd324f8394, 0xf5746577930d6500, 0xca8f44ec7ee36479,
+    0x9968bf6abbe85f20, 0x7e998b13cf4e1ecb, 0xbfc2ef456ae276e8, 0x9e3fedd8c321a67e,
+    0xefb3ab16c59b14a2, 0xc5cfe94ef3ea101e, 0x95d04aee3b80ece5, 0xbba1f1d158724a12,
+    0xbb445da9ca61281f, 0x2a8a6e45ae8edc97, 0xea1575143cf97226, 0xf52d09d71a3293bd,
+    0x924d692ca61be758, 0x593c2626705f9c56, 0xb6e0c377cfa2e12e, 0x6f8b2fb00c77836c,
+    0xe498f455c38b997a, 0x0b6dfb9c0f956447, 0x8edf98b59a373fec, 0x4724bd4189bd5eac,
+    0xb2977ee300c50fe7, 0x58edec91ec2cb657, 0xdf3d5e9bc0f653e1, 0x2f2967b66737e3ed,
+    0x8b865b215899f46c, 0xbd79e0d20082ee74, 0xae67f1e9aec07187, 0xecd8590680a3aa11,
+    0xda01ee641a708de9, 0xe80e6f4820cc9495, 0x884134fe908658b2, 0x3109058d147fdcdd,
+    0xaa51823e34a7eede, 0xbd4b46f0599fd415, 0xd4e5e2cdc1d1ea96, 0x6c9e18ac7007c91a,
+    0x850fadc09923329e, 0x03e2cf6bc604ddb0, 0xa6539930bf6bff45, 0x84db8346b786151c,
+    0xcfe87f7cef46ff16, 0xe612641865679a63, 0x81f14fae158c5f6e, 0x4fcb7e8f3f60c07e,
+    0xa26da3999aef7749, 0xe3be5e330f38f09d, 0xcb090c8001ab551c, 0x5cadf5bfd3072cc5,
+    0xfdcb4fa002162a63, 0x73d9732fc7c8f7f6, 0x9e9f11c4014dda7e, 0x2867e7fddcdd9afa,
+    0xc646d63501a1511d, 0xb281e1fd541501b8, 0xf7d88bc24209a565, 0x1f225a7ca91a4226,
+    0x9ae757596946075f, 0x3375788de9b06958, 0xc1a12d2fc3978937, 0x0052d6b1641c83ae,
+    0xf209787bb47d6b84, 0xc0678c5dbd23a49a, 0x9745eb4d50ce6332, 0xf840b7ba963646e0,
+    0xbd176620a501fbff, 0xb650e5a93bc3d898, 0xec5d3fa8ce427aff, 0xa3e51f138ab4cebe,
+    0x93ba47c980e98cdf, 0xc66f336c36b10137, 0xb8a8d9bbe123f017, 0xb80b0047445d4184,
+    0xe6d3102ad96cec1d, 0xa60dc059157491e5, 0x9043ea1ac7e41392, 0x87c89837ad68db2f,
+    0xb454e4a179dd1877, 0x29babe4598c311fb, 0xe16a1dc9d8545e94, 0xf4296dd6fef3d67a,
+    0x8ce2529e2734bb1d, 0x1899e4a65f58660c, 0xb01ae745b101e9e4, 0x5ec05dcff72e7f8f,
+    0xdc21a1171d42645d, 0x76707543f4fa1f73, 0x899504ae72497eba, 0x6a06494a791c53a8,
+    0xabfa45da0edbde69, 0x0487db9d17636892, 0xd6f8d7509292d603, 0x45a9d2845d3c42b6,
+    0x865b86925b9bc5c2, 0x0b8a2392ba45a9b2, 0xa7f26836f282b732, 0x8e6cac7768d7141e,
+    0xd1ef0244af2364ff, 0x3207d795430cd926, 0x8335616aed761f1f, 0x7f44e6bd49e807b8,
+    0xa402b9c5a8d3a6e7, 0x5f16206c9c6209a6, 0xcd036837130890a1, 0x36dba887c37a8c0f,
+    0x802221226be55a64, 0xc2494954da2c9789, 0xa02aa96b06deb0fd, 0xf2db9baa10b7bd6c,
+    0xc83553c5c8965d3d, 0x6f92829494e5acc7, 0xfa42a8b73abbf48c, 0xcb772339ba1f17f9,
+    0x9c69a97284b578d7, 0xff2a760414536efb, 0xc38413cf25e2d70d, 0xfef5138519684aba,
+    0xf46518c2ef5b8cd1, 0x7eb258665fc25d69, 0x98bf2f79d5993802, 0xef2f773ffbd97a61,
+    0xbeeefb584aff8603, 0xaafb550ffacfd8fa, 0xeeaaba2e5dbf6784, 0x95ba2a53f983cf38,
+    0x952ab45cfa97a0b2, 0xdd945a747bf26183, 0xba756174393d88df, 0x94f971119aeef9e4,
+    0xe912b9d1478ceb17, 0x7a37cd5601aab85d, 0x91abb422ccb812ee, 0xac62e055c10ab33a,
+    0xb616a12b7fe617aa, 0x577b986b314d6009, 0xe39c49765fdf9d94, 0xed5a7e85fda0b80b,
+    0x8e41ade9fbebc27d, 0x14588f13be847307, 0xb1d219647ae6b31c, 0x596eb2d8ae258fc8,
+    0xde469fbd99a05fe3, 0x6fca5f8ed9aef3bb, 0x8aec23d680043bee, 0x25de7bb9480d5854,
+    0xada72ccc20054ae9, 0xaf561aa79a10ae6a, 0xd910f7ff28069da4, 0x1b2ba1518094da04,
+    0x87aa9aff79042286, 0x90fb44d2f05d0842, 0xa99541bf57452b28, 0x353a1607ac744a53,
+    0xd3fa922f2d1675f2, 0x42889b8997915ce8, 0x847c9b5d7c2e09b7, 0x69956135febada11,
+    0xa59bc234db398c25, 0x43fab9837e699095, 0xcf02b2c21207ef2e, 0x94f967e45e03f4bb,
+    0x8161afb94b44f57d, 0x1d1be0eebac278f5, 0xa1ba1ba79e1632dc, 0x6462d92a69731732,
+    0xca28a291859bbf93, 0x7d7b8f7503cfdcfe, 0xfcb2cb35e702af78, 0x5cda735244c3d43e,
+    0x9defbf01b061adab, 0x3a0888136afa64a7, 0xc56baec21c7a1916, 0x088aaa1845b8fdd0,
+    0xf6c69a72a3989f5b, 0x8aad549e57273d45, 0x9a3c2087a63f6399, 0x36ac54e2f678864b,
+    0xc0cb28a98fcf3c7f, 0x84576a1bb416a7dd, 0xf0fdf2d3f3c30b9f, 0x656d44a2a11c51d5,
+    0x969eb7c47859e743, 0x9f644ae5a4b1b325, 0xbc4665b596706114, 0x873d5d9f0dde1fee,
+    0xeb57ff22fc0c7959, 0xa90cb506d155a7ea, 0x9316ff75dd87cbd8, 0x09a7f12442d588f2,
+    0xb7dcbf5354e9bece, 0x0c11ed6d538aeb2f, 0xe5d3ef282a242e81, 0x8f1668c8a86da5fa,
+    0x8fa475791a569d10, 0xf96e017d694487bc, 0xb38d92d760ec4455, 0x37c981dcc395a9ac,
+    0xe070f78d3927556a, 0x85bbe253f47b1417, 0x8c469ab843b89562, 0x93956d7478ccec8e,
+    0xaf58416654a6babb, 0x387ac8d1970027b2, 0xdb2e51bfe9d0696a, 0x06997b05fcc0319e,
+    0x88fcf317f22241e2, 0x441fece3bdf81f03, 0xab3c2fddeeaad25a, 0xd527e81cad7626c3,
+    0xd60b3bd56a5586f1, 0x8a71e223d8d3b074, 0x85c7056562757456, 0xf6872d5667844e49,
+    0xa738c6bebb12d16c, 0xb428f8ac016561db, 0xd106f86e69d785c7, 0xe13336d701beba52,
+    0x82a45b450226b39c, 0xecc0024661173473, 0xa34d721642b06084, 0x27f002d7f95d0190,
+    0xcc20ce9bd35c78a5, 0x31ec038df7b441f4, 0xff290242c83396ce, 0x7e67047175a15271,
+    0x9f79a169bd203e41, 0x0f0062c6e984d386, 0xc75809c42c684dd1, 0x52c07b78a3e60868,
+    0xf92e0c3537826145, 0xa7709a56ccdf8a82, 0x9bbcc7a142b17ccb, 0x88a66076400bb691,
+    0xc2abf989935ddbfe, 0x6acff893d00ea435, 0xf356f7ebf83552fe, 0x0583f6b8c4124d43,
+    0x98165af37b2153de, 0xc3727a337a8b704a, 0xbe1bf1b059e9a8d6, 0x744f18c0592e4c5c,
+    0xeda2ee1c7064130c, 0x1162def06f79df73, 0x9485d4d1c63e8be7, 0x8addcb5645ac2ba8,
+    0xb9a74a0637ce2ee1, 0x6d953e2bd7173692, 0xe8111c87c5c1ba99, 0xc8fa8db6ccdd0437,
+    0x910ab1d4db9914a0, 0x1d9c9892400a22a2, 0xb54d5e4a127f59c8, 0x2503beb6d00cab4b,
+    0xe2a0b5dc971f303a, 0x2e44ae64840fd61d, 0x8da471a9de737e24, 0x5ceaecfed289e5d2,
+    0xb10d8e1456105dad, 0x7425a83e872c5f47, 0xdd50f1996b947518, 0xd12f124e28f77719,
+    0x8a5296ffe33cc92f, 0x82bd6b70d99aaa6f, 0xace73cbfdc0bfb7b, 0x636cc64d1001550b,
+    0xd8210befd30efa5a, 0x3c47f7e05401aa4e, 0x8714a775e3e95c78, 0x65acfaec34810a71,
+    0xa8d9d1535ce3b396, 0x7f1839a741a14d0d, 0xd31045a8341ca07c, 0x1ede48111209a050,
+    0x83ea2b892091e44d, 0x934aed0aab460432, 0xa4e4b66b68b65d60, 0xf81da84d5617853f,
+    0xce1de40642e3f4b9, 0x36251260ab9d668e, 0x80d2ae83e9ce78f3, 0xc1d72b7c6b426019,
+    0xa1075a24e4421730, 0xb24cf65b8612f81f, 0xc94930ae1d529cfc, 0xdee033f26797b627,
+    0xfb9b7cd9a4a7443c, 0x169840ef017da3b1, 0x9d412e0806e88aa5, 0x8e1f289560ee864e,
+    0xc491798a08a2ad4e, 0xf1a6f2bab92a27e2, 0xf5b5d7ec8acb58a2, 0xae10af696774b1db,
+    0x9991a6f3d6bf1765, 0xacca6da1e0a8ef29, 0xbff610b0cc6edd3f, 0x17fd090a58d32af3,
+    0xeff394dcff8a948e, 0xddfc4b4cef07f5b0, 0x95f83d0a1fb69cd9, 0x4abdaf101564f98e,
+    0xbb764c4ca7a4440f, 0x9d6d1ad41abe37f1, 0xea53df5fd18d5513, 0x84c86189216dc5ed,
+    0x92746b9be2f8552c, 0x32fd3cf5b4e49bb4, 0xb7118682dbb66a77, 0x3fbc8c33221dc2a1,
+    0xe4d5e82392a40515, 0x0fabaf3feaa5334a, 0x8f05b1163ba6832d, 0x29cb4d87f2a7400e,
+    0xb2c71d5bca9023f8, 0x743e20e9ef511012, 0xdf78e4b2bd342cf6, 0x914da9246b255416,
+    0x8bab8eefb6409c1a, 0x1ad089b6c2f7548e, 0xae9672aba3d0c320, 0xa184ac2473b529b1,
+    0xda3c0f568cc4f3e8, 0xc9e5d72d90a2741e, 0x8865899617fb1871, 0x7e2fa67c7a658892,
+    0xaa7eebfb9df9de8d, 0xddbb901b98feeab7, 0xd51ea6fa85785631, 0x552a74227f3ea565,
+    0x8533285c936b35de, 0xd53a88958f87275f, 0xa67ff273b8460356, 0x8a892abaf368f137,
+    0xd01fef10a657842c, 0x2d2b7569b0432d85, 0x8213f56a67f6b29b, 0x9c3b29620e29fc73,
+    0xa298f2c501f45f42, 0x8349f3ba91b47b8f, 0xcb3f2f7642717713, 0x241c70a936219a73,
+    0xfe0efb53d30dd4d7, 0xed238cd383aa0110, 0x9ec95d1463e8a506, 0xf4363804324a40aa,
+    0xc67bb4597ce2ce48, 0xb143c6053edcd0d5, 0xf81aa16fdc1b81da, 0xdd94b7868e94050a,
+    0x9b10a4e5e9913128, 0xca7cf2b4191c8326, 0xc1d4ce1f63f57d72, 0xfd1c2f611f63a3f0,
+    0xf24a01a73cf2dccf, 0xbc633b39673c8cec, 0x976e41088617ca01, 0xd5be0503e085d813,
+    0xbd49d14aa79dbc82, 0x4b2d8644d8a74e18, 0xec9c459d51852ba2, 0xddf8e7d60ed1219e,
+    0x93e1ab8252f33b45, 0xcabb90e5c942b503, 0xb8da1662e7b00a17, 0x3d6a751f3b936243,
+    0xe7109bfba19c0c9d, 0x0cc512670a783ad4, 0x906a617d450187e2, 0x27fb2b80668b24c5,
+    0xb484f9dc9641e9da, 0xb1f9f660802dedf6, 0xe1a63853bbd26451, 0x5e7873f8a0396973,
+    0x8d07e33455637eb2, 0xdb0b487b6423e1e8, 0xb049dc016abc5e5f, 0x91ce1a9a3d2cda62,
+    0xdc5c5301c56b75f7, 0x7641a140cc7810fb, 0x89b9b3e11b6329ba, 0xa9e904c87fcb0a9d,
+    0xac2820d9623bf429, 0x546345fa9fbdcd44, 0xd732290fbacaf133, 0xa97c177947ad4095,
+    0x867f59a9d4bed6c0, 0x49ed8eabcccc485d, 0xa81f301449ee8c70, 0x5c68f256bfff5a74,
+    0xd226fc195c6a2f8c, 0x73832eec6fff3111, 0x83585d8fd9c25db7, 0xc831fd53c5ff7eab,
+    0xa42e74f3d032f525, 0xba3e7ca8b77f5e55, 0xcd3a1230c43fb26f, 0x28ce1bd2e55f35eb,
+    0x80444b5e7aa7cf85, 0x7980d163cf5b81b3, 0xa0555e361951c366, 0xd7e105bcc332621f,
+    0xc86ab5c39fa63440, 0x8dd9472bf3fefaa7, 0xfa856334878fc150, 0xb14f98f6f0feb951,
+    0x9c935e00d4b9d8d2, 0x6ed1bf9a569f33d3, 0xc3b8358109e84f07, 0x0a862f80ec4700c8,
+    0xf4a642e14c6262c8, 0xcd27bb612758c0fa, 0x98e7e9cccfbd7dbd, 0x8038d51cb897789c,
+    0xbf21e44003acdd2c, 0xe0470a63e6bd56c3, 0xeeea5d5004981478, 0x1858ccfce06cac74,
+    0x95527a5202df0ccb, 0x0f37801e0c43ebc8, 0xbaa718e68396cffd, 0xd30560258f54e6ba,
+    0xe950df20247c83fd, 0x47c6b82ef32a2069, 0x91d28b7416cdd27e, 0x4cdc331d57fa5441,
+    0xb6472e511c81471d, 0xe0133fe4adf8e952, 0xe3d8f9e563a198e5, 0x58180fddd97723a6,
+    0x8e679c2f5e44ff8f, 0x570f09eaa7ea7648
+};
 
-    int negative = 0;
-    if (*p == '-') {
-        negative = 1;
-        ++p;
+/* Eisel-Lemire: Converts w * 10^q into the nearest float, power2 is negative if the result couldn't be decided. */
+static scan_AdjustedMantissa scan_EiselLemire(const scan_FloatFormat* format, int64_t q, uint64_t w) {
+    scan_AdjustedMantissa result = {0, 0};
+    if (w == 0 || q < format->smallestPowerOfTen) {
+        return result;
+    }
+    if (q > format->largestPowerOfTen) {
+        result.power2 = format->infinitePower;
+        return result;
     }
 
-    /* Scan integer and frational parts */
-    int decimalPos = -1;
-    int mantissaLength = 0;
-    int integerLength = 0;
-    int fractionalLength = 0;
-    for (const char* s = p;; ++s, ++mantissaLength) {
-        int32_t cp = TMC_CHAR_TO_INT(*s);
-        if (cp == '.' && decimalPos < 0) {
-            decimalPos = mantissaLength + 1;
-            integerLength = mantissaLength;
-        } else if (!TM_ISDIGIT(cp)) {
-            break;
+    int32_t leadingZeroes = tmc_LeadingZeroes64(w);
+    w <<= leadingZeroes;
+
+    /* Only the upper bits of the product are needed, the lower half of 5^q is only multiplied in
+       if the upper bits could be off by one. */
+    const uint64_t* powerOfFive = &scan_PowersOfFive128[2 * (q - scan_SmallestPowerOfFive)];
+    const uint64_t precisionMask = (uint64_t)0xFFFFFFFFFFFFFFFF >> (format->mantissaBits + 3);
+    tmc_U128 product = tmc_Multiply64(w, powerOfFive[0]);
+    if ((product.high & precisionMask) == precisionMask) {
+        tmc_U128 lowerProduct = tmc_Multiply64(w, powerOfFive[1]);
+        product.low += lowerProduct.high;
+        if (lowerProduct.high > product.low) {
+            ++product.high;
         }
     }
-    if (decimalPos < 0 && mantissaLength == 0) {
+    /* Powers of five in [-27, 55] are exact, otherwise the truncated product might be off by one. */
+    if (product.low == 0xFFFFFFFFFFFFFFFF && (q < -27 || q > 55)) {
+        result.power2 = -1;
         return result;
     }
-    if (decimalPos < 0) {
-        decimalPos = mantissaLength;
-        fractionalLength = 0;
-        integerLength = mantissaLength;
-    } else {
-        fractionalLength = mantissaLength - decimalPos;
-    }
-
-    /* Scan exponent */
-    const char* pExp = p + mantissaLength;
-    int exponentNegative = 0;
-    int exponent = 0;
-    if (*pExp == 'e' || *pExp == 'E') {
-        ++pExp;
-        if (*pExp == '-') {
-            exponentNegative = 1;
-            ++pExp;
-        } else if (*pExp == '+') {
-            ++pExp;
-        }
-        if (TM_ISDIGIT(TMC_CHAR_TO_INT(*pExp))) {
-            tmc_conv_result exponentResult = scan_i32(pExp, &exponent, 10);
-            pExp += exponentResult.size;
-            if (exponentResult.ec != TM_OK) {
-                exponentResult.size = (tm_size_t)(pExp - start);
-                return exponentResult;
-            }
-            if (exponent > scan_MaxExponent) {
-#if TMC_CLAMP_ON_RANGE_ERROR
-                exponent = scan_MaxExponent;
-#else
-                result.size = (tm_size_t)(pExp - start);
-                result.ec = TM_EOVERFLOW;
-                return result;
-#endif
-            }
-        } else {
-            pExp = p + mantissaLength;
-        }
-    }
 
-    /* Adjust integerLength and fractionalLength based on exponent */
-    if (exponentNegative) {
-        if (integerLength > exponent) {
-            integerLength -= exponent;
-            fractionalLength += exponent;
-            exponent = 0;
-        } else {
-            exponent -= integerLength;
-            fractionalLength += integerLength;
-            integerLength = 0;
-        }
-        exponent = -exponent;
-    } else {
-        if (fractionalLength > exponent) {
-            fractionalLength -= exponent;
-            integerLength += exponent;
-            exponent = 0;
-        } else {
-            exponent -= fractionalLength;
-            integerLength += fractionalLength;
-            fractionalLength = 0;
+    int32_t upperBit = (int32_t)(product.high >> 63);
+    int32_t shift = upperBit + 64 - format->mantissaBits - 3;
+    result.mantissa = product.high >> shift;
+    /* floor(log2(10^q)) + 63 */
+    int32_t power = (((152170 + 65536) * (int32_t)q) >> 16) + 63;
+    result.power2 = power + upperBit - leadingZeroes - format->minimumExponent;
+
+    if (result.power2 <= 0) {
+        /* Subnormal, shift out the bits below the smallest exponent. */
+        if (-result.power2 + 1 >= 64) {
+            result.mantissa = 0;
+            result.power2 = 0;
+            return result;
         }
+        result.mantissa >>= -result.power2 + 1;
+        result.mantissa += (result.mantissa & 1);
+        result.mantissa >>= 1;
+        /* Rounding up can result in the smallest normal number. */
+        result.power2 = (result.mantissa < ((uint64_t)1 << format->mantissaBits)) ? 0 : 1;
+        result.mantissa &= ~((uint64_t)1 << format->mantissaBits);
+        return result;
     }
 
-    if (out) {
-        double integerPart = 0;
-        double fractionalPart = 0;
-        tm_size_t leadingZeroes = scan_LeadingZeroes(p, integerLength);
-        if (leadingZeroes < (tm_size_t)integerLength) {
-            p += leadingZeroes;
-            integerLength -= (int)leadingZeroes;
-            p += scan_ScanMantissa(p, integerLength, &integerPart);
-        } else {
-            p += integerLength;
+    /* If only zeroes were shifted out, w * 10^q is exactly halfway between two floats and we round to even.
+       This can only happen if 5^q fits into 64 bits. */
+    if (product.low <= 1 && q >= format->minExponentRoundToEven && q <= format->maxExponentRoundToEven &&
+        (result.mantissa & 3) == 1) {
+        if ((result.mantissa << shift) == product.high) {
+            result.mantissa &= ~(uint64_t)1;
         }
-        scan_ScanMantissa(p, fractionalLength, &fractionalPart);
-        fractionalPart = str_Pow10(fractionalPart, -fractionalLength);
+    }
 
-        double value = str_Pow10(integerPart + fractionalPart, exponent);
-        *out = (negative) ? (-value) : (value);
+    result.mantissa += (result.mantissa & 1);
+    result.mantissa >>= 1;
+    if (result.mantissa >= ((uint64_t)2 << format->mantissaBits)) {
+        result.mantissa = ((uint64_t)1 << format->mantissaBits);
+        ++result.power2;
+    }
+    result.mantissa &= ~((uint64_t)1 << format->mantissaBits);
+    if (result.power2 >= format->infinitePower) {
+        result.mantissa = 0;
+        result.power2 = format->infinitePower;
     }
-    result.size = (tm_size_t)(pExp - start);
-    result.ec = TM_OK;
     return result;
 }
-TMC_DEF tmc_conv_result scan_double_n(const char* str, tm_size_t len, double* out, uint32_t flags) {
-    /* TODO: implement flags */
-    (void)flags;
 
-    TM_ASSERT_VALID_SIZE(len);
-    TM_ASSERT(str || len == 0);
+/* Rounds mantissa * 2^exponent to the nearest float, truncated denotes whether there are nonzero bits below. */
+static scan_AdjustedMantissa scan_RoundBinary(const scan_FloatFormat* format, uint64_t mantissa, int64_t exponent,
+                                              tm_bool truncated) {
+    scan_AdjustedMantissa result = {0, 0};
+    if (mantissa == 0) {
+        return result;
+    }
 
-    tmc_conv_result result = {0, TM_EINVAL};
+    int32_t leadingZeroes = tmc_LeadingZeroes64(mantissa);
+    mantissa <<= leadingZeroes;
+    exponent -= leadingZeroes;
 
-    if (len <= 0) {
+    /* The most significant bit of mantissa is the implicit leading bit of the result. */
+    int64_t power2 = exponent + 63 - format->minimumExponent;
+    if (power2 >= format->infinitePower) {
+        result.power2 = format->infinitePower;
         return result;
     }
+    int64_t shift = 63 - format->mantissaBits;
+    if (power2 <= 0) {
+        /* Subnormals have less bits of precision. */
+        shift += 1 - power2;
+        power2 = 0;
+    }
 
-    const char* start = str;
-    const char* p = str;
+    uint64_t kept = 0;
+    if (shift < 64) {
+        uint64_t rest = mantissa & (((uint64_t)1 << shift) - 1);
+        uint64_t halfway = (uint64_t)1 << (shift - 1);
+        kept = mantissa >> shift;
+        if (rest > halfway || (rest == halfway && (truncated || (kept & 1)))) {
+            ++kept;
+        }
+    } else if (shift == 64) {
+        /* Value is at least halfway to the smallest subnormal. */
+        kept = (mantissa != ((uint64_t)1 << 63) || truncated) ? 1 : 0;
+    }
+
+    if (power2 == 0) {
+        /* Rounding up can result in the smallest normal number. */
+        power2 = (kept < ((uint64_t)1 << format->mantissaBits)) ? 0 : 1;
+    } else if (kept >= ((uint64_t)2 << format->mantissaBits)) {
+        kept >>= 1;
+        ++power2;
+        if (power2 >= format->infinitePower) {
+            result.power2 = format->infinitePower;
+            return result;
+        }
+    }
+    result.mantissa = kept & (((uint64_t)1 << format->mantissaBits) - 1);
+    result.power2 = (int32_t)power2;
+    return result;
+}
 
-    int negative = 0;
-    if (*p == '-') {
-        negative = 1;
+/* Slow path, big decimal number with enough digits to represent any float exactly, also used when printing.
+   See "Number Parsing at a Gigabyte per Second" by Daniel Lemire and "Simple Decimal Conversion" in Go's strconv. */
+#define TMC_MAX_DECIMAL_DIGITS 768
+#define TMC_DECIMAL_POINT_RANGE 2047
+
+typedef struct {
+    uint32_t count;
+    int32_t decimalPoint; /* Value is 0.digits * 10^decimalPoint. */
+    tm_bool truncated;    /* Whether nonzero digits were dropped after the stored digits. */
+    uint8_t digits[TMC_MAX_DECIMAL_DIGITS];
+} tmc_Decimal;
+
+static void tmc_DecimalPush(tmc_Decimal* decimal, uint8_t digit) {
+    if (decimal->count < TMC_MAX_DECIMAL_DIGITS) {
+        decimal->digits[decimal->count++] = digit;
+    } else if (digit != 0) {
+        decimal->truncated = TM_TRUE;
+    }
+}
+
+static void tmc_DecimalTrim(tmc_Decimal* decimal) {
+    while (decimal->count > 0 && decimal->digits[decimal->count - 1] == 0) {
+        --decimal->count;
+    }
+}
+
+static void scan_DecimalFromDigits(const scan_FloatDigits* digits, tmc_Decimal* out) {
+    out->count = 0;
+    out->truncated = TM_FALSE;
+
+    const char* p = digits->integer;
+    const char* last = p + digits->integerLength;
+    while (p < last && *p == '0') {
         ++p;
-        --len;
+    }
+    int64_t decimalPoint = (int64_t)(last - p);
+    for (; p < last; ++p) {
+        tmc_DecimalPush(out, (uint8_t)(*p - '0'));
     }
 
-    /* Scan integer and frational parts */
-    int decimalPos = -1;
-    int mantissaLength = 0;
-    int integerLength = 0;
-    int fractionalLength = 0;
-    for (const char* s = p; len; ++s, ++mantissaLength, --len) {
-        int32_t cp = TMC_CHAR_TO_INT(*s);
-        if (cp == '.' && decimalPos < 0) {
-            decimalPos = mantissaLength + 1;
-            integerLength = mantissaLength;
-        } else if (!TM_ISDIGIT(cp)) {
-            break;
+    p = digits->fraction;
+    last = p + digits->fractionLength;
+    if (out->count == 0) {
+        for (; p < last && *p == '0'; ++p) {
+            --decimalPoint;
         }
     }
-    if (decimalPos < 0 && mantissaLength == 0) {
-        return result;
+    for (; p < last; ++p) {
+        tmc_DecimalPush(out, (uint8_t)(*p - '0'));
     }
-    if (decimalPos < 0) {
-        decimalPos = mantissaLength;
-        fractionalLength = 0;
-        integerLength = mantissaLength;
-    } else {
-        fractionalLength = mantissaLength - decimalPos;
+    tmc_DecimalTrim(out);
+
+    /* Anything outside of this range is zero or infinity, see scan_DecimalToFloat. */
+    decimalPoint += digits->explicitExponent;
+    if (decimalPoint < -100000) {
+        decimalPoint = -100000;
+    } else if (decimalPoint > 100000) {
+        decimalPoint = 100000;
     }
+    out->decimalPoint = (int32_t)decimalPoint;
+}
 
-    /* Scan exponent */
-    const char* pExp = p + mantissaLength;
-    int exponentNegative = 0;
-    int exponent = 0;
-    if (len && (*pExp == 'e' || *pExp == 'E')) {
-        ++pExp;
-        --len;
-        if (len && *pExp == '-') {
-            exponentNegative = 1;
-            ++pExp;
-            --len;
-        } else if (len && *pExp == '+') {
-            ++pExp;
-            --len;
-        }
-        if (len && TM_ISDIGIT(TMC_CHAR_TO_INT(*pExp))) {
-            tmc_conv_result exponentResult = scan_i32_n(pExp, len, &exponent, 10);
-            pExp += exponentResult.size;
-            if (exponentResult.ec != TM_OK) {
-                exponentResult.size = (tm_size_t)(pExp - start);
-                return exponentResult;
-            }
-            if (exponent > scan_MaxExponent) {
-#if TMC_CLAMP_ON_RANGE_ERROR
-                exponent = scan_MaxExponent;
-#else
-                result.size = (tm_size_t)(pExp - start);
-                result.ec = TM_EOVERFLOW;
-                return result;
-#endif
-            }
+/* Divides by 2^shift. */
+static void tmc_DecimalRightShift(tmc_Decimal* decimal, uint32_t shift) {
+    uint32_t readIndex = 0;
+    uint32_t writeIndex = 0;
+    uint64_t n = 0;
+    while ((n >> shift) == 0) {
+        if (readIndex < decimal->count) {
+            n = (10 * n) + decimal->digits[readIndex++];
+        } else if (n == 0) {
+            return;
         } else {
-            pExp = p + mantissaLength;
+            while ((n >> shift) == 0) {
+                n = 10 * n;
+                ++readIndex;
+            }
+            break;
+        }
+    }
+    decimal->decimalPoint -= (int32_t)(readIndex - 1);
+    if (decimal->decimalPoint < -TMC_DECIMAL_POINT_RANGE) {
+        decimal->count = 0;
+        decimal->decimalPoint = 0;
+        decimal->truncated = TM_FALSE;
+        return;
+    }
+
+    uint64_t mask = ((uint64_t)1 << shift) - 1;
+    while (readIndex < decimal->count) {
+        uint8_t digit = (uint8_t)(n >> shift);
+        n = (10 * (n & mask)) + decimal->digits[readIndex++];
+        decimal->digits[writeIndex++] = digit;
+    }
+    while (n > 0) {
+        uint8_t digit = (uint8_t)(n >> shift);
+        n = 10 * (n & mask);
+        if (writeIndex < TMC_MAX_DECIMAL_DIGITS) {
+            decimal->digits[writeIndex++] = digit;
+        } else if (digit > 0) {
+            decimal->truncated = TM_TRUE;
         }
     }
+    decimal->count = writeIndex;
+    tmc_DecimalTrim(decimal);
+}
 
-    /* Adjust integerLength and fractionalLength based on exponent */
-    if (exponentNegative) {
-        if (integerLength > exponent) {
-            integerLength -= exponent;
-            fractionalLength += exponent;
-            exponent = 0;
-        } else {
-            exponent -= integerLength;
-            fractionalLength += integerLength;
-            integerLength = 0;
+/* Multiplies by 2^shift. */
+static void tmc_DecimalLeftShift(tmc_Decimal* decimal, uint32_t shift) {
+    if (decimal->count == 0) {
+        return;
+    }
+    /* Multiplying by 2^shift adds either floor(shift * log10(2)) or one more digit. */
+    uint32_t added = ((shift * 1233) >> 12) + 1;
+    uint32_t end = decimal->count + added;
+    uint32_t writeIndex = end;
+    uint64_t n = 0;
+    for (uint32_t readIndex = decimal->count; readIndex > 0;) {
+        n += (uint64_t)decimal->digits[--readIndex] << shift;
+        uint64_t quotient = n / 10;
+        uint64_t remainder = n - (10 * quotient);
+        if (--writeIndex < TMC_MAX_DECIMAL_DIGITS) {
+            decimal->digits[writeIndex] = (uint8_t)remainder;
+        } else if (remainder > 0) {
+            decimal->truncated = TM_TRUE;
         }
-        exponent = -exponent;
-    } else {
-        if (fractionalLength > exponent) {
-            fractionalLength -= exponent;
-            integerLength += exponent;
-            exponent = 0;
-        } else {
-            exponent -= fractionalLength;
-            integerLength += fractionalLength;
-            fractionalLength = 0;
+        n = quotient;
+    }
+    while (n > 0) {
+        uint64_t quotient = n / 10;
+        uint64_t remainder = n - (10 * quotient);
+        if (--writeIndex < TMC_MAX_DECIMAL_DIGITS) {
+            decimal->digits[writeIndex] = (uint8_t)remainder;
+        } else if (remainder > 0) {
+            decimal->truncated = TM_TRUE;
         }
+        n = quotient;
     }
 
-    if (out) {
-        double integerPart = 0;
-        double fractionalPart = 0;
-        tm_size_t leadingZeroes = scan_LeadingZeroes(p, integerLength);
-        if (leadingZeroes < (tm_size_t)integerLength) {
-            p += leadingZeroes;
-            integerLength -= (int)leadingZeroes;
-            p += scan_ScanMantissa(p, integerLength, &integerPart);
-        } else {
-            p += integerLength;
+    /* The estimate of added digits was one too many if the first digit wasn't written. */
+    if (end > TMC_MAX_DECIMAL_DIGITS) {
+        end = TMC_MAX_DECIMAL_DIGITS;
+    }
+    if (writeIndex > 0) {
+        for (uint32_t i = writeIndex; i < end; ++i) {
+            decimal->digits[i - writeIndex] = decimal->digits[i];
         }
-        scan_ScanMantissa(p, fractionalLength, &fractionalPart);
-        fractionalPart = str_Pow10(fractionalPart, -fractionalLength);
-
-        double value = str_Pow10(integerPart + fractionalPart, exponent);
-        *out = (negative) ? (-value) : (value);
     }
-    result.size = (tm_size_t)(pExp - start);
-    result.ec = TM_OK;
-    return result;
+    decimal->count = end - writeIndex;
+    decimal->decimalPoint += (int32_t)(added - writeIndex);
+    tmc_DecimalTrim(decimal);
 }
 
-TMC_DEF tmc_conv_result tmc_print_string(char* dest, tm_size_t maxlen, const char* src, tm_size_t srclen) {
-    tmc_conv_result result;
-    if (maxlen < srclen) {
-        result.size = maxlen;
-        result.ec = TM_EOVERFLOW;
-    } else {
-        result.size = srclen;
-        result.ec = TM_OK;
+/* Integer part of the decimal, rounded to nearest even. */
+static uint64_t scan_DecimalRound(const tmc_Decimal* decimal) {
+    if (decimal->count == 0 || decimal->decimalPoint < 0) {
+        return 0;
     }
-    TM_ASSERT(dest);
-    TM_ASSERT(src);
-    TM_ASSERT(result.size > 0);
-    TM_MEMCPY(dest, src, result.size);
-    return result;
-}
-
-#if defined(TM_IMPLEMENT_STRNICMP)
-static int32_t tm_strnicmp(const char* a, const char* b, tm_size_t maxlen) {
-    TM_ASSERT_VALID_SIZE(maxlen);
-    while (*a && *b && maxlen--) {
-        int32_t aUpper = TM_TOUPPER(TMC_CHAR_TO_INT(*a));
-        int32_t bUpper = TM_TOUPPER(TMC_CHAR_TO_INT(*b));
-        if (aUpper != bUpper) {
-            break;
+    if (decimal->decimalPoint > 18) {
+        return UINT64_MAX;
+    }
+    uint32_t decimalPoint = (uint32_t)decimal->decimalPoint;
+    uint64_t n = 0;
+    for (uint32_t i = 0; i < decimalPoint; ++i) {
+        n = (10 * n) + ((i < decimal->count) ? decimal->digits[i] : 0);
+    }
+    tm_bool roundUp = TM_FALSE;
+    if (decimalPoint < decimal->count) {
+        roundUp = decimal->digits[decimalPoint] >= 5;
+        if (decimal->digits[decimalPoint] == 5 && decimalPoint + 1 == decimal->count) {
+            /* Exactly halfway, round to even. */
+            roundUp = decimal->truncated || (decimalPoint > 0 && (decimal->digits[decimalPoint - 1] & 1));
         }
-        ++a;
-        ++b;
     }
-    if (!maxlen) {
-        return 0;
+    if (roundUp) {
+        ++n;
     }
-    int32_t aUpper = TM_TOUPPER(TMC_CHAR_TO_INT(*a));
-    int32_t bUpper = TM_TOUPPER(TMC_CHAR_TO_INT(*b));
-    return aUpper - bUpper;
+    return n;
 }
-#endif /* defined(TM_IMPLEMENT_STRNICMP) */
 
-TMC_DEF tmc_conv_result scan_bool(const char* nullterminated, tm_bool* out) {
-    tmc_conv_result result = {0, TM_EINVAL};
-    if (!nullterminated) {
+static scan_AdjustedMantissa scan_DecimalToFloat(const scan_FloatFormat* format, tmc_Decimal* decimal) {
+    /* Shift amounts that bring 10^n closest to 1. */
+    static const uint8_t DecimalShifts[] = {0, 3, 6, 9, 13, 16, 19, 23, 26, 29, 33, 36, 39, 43, 46, 49, 53, 56, 59};
+    const uint32_t ShiftsCount = (uint32_t)(sizeof(DecimalShifts) / sizeof(DecimalShifts[0]));
+    const uint32_t MaxShift = 60;
+
+    scan_AdjustedMantissa result = {0, 0};
+    if (decimal->count == 0 || decimal->decimalPoint < -324) {
+        return result;
+    }
+    if (decimal->decimalPoint >= 310) {
+        result.power2 = format->infinitePower;
+        return result;
+    }
+
+    /* Shift into [1/2, 1). */
+    int32_t exponent = 0;
+    while (decimal->decimalPoint > 0) {
+        uint32_t n = (uint32_t)decimal->decimalPoint;
+        uint32_t shift = (n < ShiftsCount) ? DecimalShifts[n] : MaxShift;
+        tmc_DecimalRightShift(decimal, shift);
+        if (decimal->decimalPoint < -TMC_DECIMAL_POINT_RANGE) {
+            return result;
+        }
+        exponent += (int32_t)shift;
+    }
+    while (decimal->decimalPoint <= 0) {
+        uint32_t shift;
+        if (decimal->decimalPoint == 0) {
+            if (decimal->digits[0] >= 5) {
+                break;
+            }
+            shift = (decimal->digits[0] < 2) ? 2 : 1;
+        } else {
+            uint32_t n = (uint32_t)(-decimal->decimalPoint);
+            shift = (n < ShiftsCount) ? DecimalShifts[n] : MaxShift;
+        }
+        tmc_DecimalLeftShift(decimal, shift);
+        if (decimal->decimalPoint > TMC_DECIMAL_POINT_RANGE) {
+            result.power2 = format->infinitePower;
+            return result;
+        }
+        exponent -= (int32_t)shift;
+    }
+
+    /* Floats are in [1, 2). */
+    --exponent;
+    while (format->minimumExponent + 1 > exponent) {
+        uint32_t n = (uint32_t)(format->minimumExponent + 1 - exponent);
+        if (n > MaxShift) {
+            n = MaxShift;
+        }
+        tmc_DecimalRightShift(decimal, n);
+        exponent += (int32_t)n;
+    }
+    if (exponent - format->minimumExponent >= format->infinitePower) {
+        result.power2 = format->infinitePower;
+        return result;
+    }
+
+    const uint32_t mantissaBitsWithLeadingBit = (uint32_t)format->mantissaBits + 1;
+    tmc_DecimalLeftShift(decimal, mantissaBitsWithLeadingBit);
+    uint64_t mantissa = scan_DecimalRound(decimal);
+    if (mantissa >= ((uint64_t)1 << mantissaBitsWithLeadingBit)) {
+        /* Rounding overflowed into the next power of two. */
+        tmc_DecimalRightShift(decimal, 1);
+        ++exponent;
+        mantissa = scan_DecimalRound(decimal);
+        if (exponent - format->minimumExponent >= format->infinitePower) {
+            result.power2 = format->infinitePower;
+            return result;
+        }
+    }
+    result.power2 = exponent - format->minimumExponent;
+    if (mantissa < ((uint64_t)1 << format->mantissaBits)) {
+        /* Subnormal. */
+        --result.power2;
+    }
+    result.mantissa = mantissa & (((uint64_t)1 << format->mantissaBits) - 1);
+    return result;
+}
+
+static scan_AdjustedMantissa scan_SlowPath(const scan_FloatFormat* format, const scan_FloatDigits* digits) {
+    tmc_Decimal decimal;
+    scan_DecimalFromDigits(digits, &decimal);
+    return scan_DecimalToFloat(format, &decimal);
+}
+
+/*
+Converts scanned digits into the bits of the nearest float.
+Returns TM_ERANGE if the value is out of range, out is then the largest finite value or zero.
+Sign is not part of the result.
+*/
+static tm_errc scan_FloatBits(const scan_FloatFormat* format, const scan_FloatDigits* digits, uint64_t* out) {
+    scan_AdjustedMantissa result;
+    if (digits->hex) {
+        result = scan_RoundBinary(format, digits->mantissa, digits->exponent, digits->truncated);
+    } else {
+        result = scan_EiselLemire(format, digits->exponent, digits->mantissa);
+        if (digits->truncated && result.power2 >= 0) {
+            /* Actual value lies between w and w + 1. */
+            scan_AdjustedMantissa upper = scan_EiselLemire(format, digits->exponent, digits->mantissa + 1);
+            if (upper.mantissa != result.mantissa || upper.power2 != result.power2) {
+                result.power2 = -1;
+            }
+        }
+        if (result.power2 < 0) {
+            result = scan_SlowPath(format, digits);
+        }
+    }
+
+    tm_errc ec = TM_OK;
+    if (result.power2 >= format->infinitePower) {
+        ec = TM_ERANGE;
+        result.mantissa = ((uint64_t)1 << format->mantissaBits) - 1;
+        result.power2 = format->infinitePower - 1;
+    } else if (digits->mantissa != 0 && result.power2 == 0 && result.mantissa == 0) {
+        ec = TM_ERANGE;
+    }
+    *out = result.mantissa | ((uint64_t)result.power2 << format->mantissaBits);
+    return ec;
+}
+
+static tm_bool scan_FastPathDouble(const scan_FloatDigits* digits, double* out) {
+#if TMC_CLINGER_FAST_PATH
+    static const double PowersOfTen[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                         1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    if (!digits->hex && !digits->truncated && digits->exponent >= -22 && digits->exponent <= 22 &&
+        digits->mantissa <= ((uint64_t)1 << 53)) {
+        double value = (double)digits->mantissa;
+        if (digits->exponent < 0) {
+            value /= PowersOfTen[-digits->exponent];
+        } else {
+            value *= PowersOfTen[digits->exponent];
+        }
+        *out = value;
+        return TM_TRUE;
+    }
+#else
+    (void)digits;
+    (void)out;
+#endif
+    return TM_FALSE;
+}
+
+static tm_bool scan_FastPathFloat(const scan_FloatDigits* digits, float* out) {
+#if TMC_CLINGER_FAST_PATH
+    static const float PowersOfTen[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+    if (!digits->hex && !digits->truncated && digits->exponent >= -10 && digits->exponent <= 10 &&
+        digits->mantissa <= ((uint64_t)1 << 24)) {
+        float value = (float)digits->mantissa;
+        if (digits->exponent < 0) {
+            value /= PowersOfTen[-digits->exponent];
+        } else {
+            value *= PowersOfTen[digits->exponent];
+        }
+        *out = value;
+        return TM_TRUE;
+    }
+#else
+    (void)digits;
+    (void)out;
+#endif
+    return TM_FALSE;
+}
+
+/* Nullterminated strings are scanned with the _n variants, scanning stops at the nullterminator. */
+#define TMC_NULLTERMINATED_LEN ((tm_size_t)0x7FFFFFFF)
+
+TMC_DEF tmc_conv_result scan_float(const char* nullterminated, float* out, uint32_t flags) {
+    if (!nullterminated) {
+        tmc_conv_result result = {0, TM_EINVAL};
+        return result;
+    }
+    return scan_float_n(nullterminated, TMC_NULLTERMINATED_LEN, out, flags);
+}
+TMC_DEF tmc_conv_result scan_float_n(const char* str, tm_size_t len, float* out, uint32_t flags) {
+    TM_ASSERT_VALID_SIZE(len);
+    TM_ASSERT(str || len == 0);
+
+    scan_FloatDigits digits;
+    tmc_conv_result result = scan_FloatDigitsN(str, len, flags, &digits);
+    if (result.ec != TM_OK) {
+        return result;
+    }
+
+    float value;
+    if (!scan_FastPathFloat(&digits, &value)) {
+        uint64_t bits = 0;
+        result.ec = scan_FloatBits(&scan_SingleFormat, &digits, &bits);
+        uint32_t bits32 = (uint32_t)bits;
+        TM_MEMCPY(&value, &bits32, sizeof(value));
+    }
+    if (out) {
+        if (result.ec == TM_OK
+#if TMC_CLAMP_ON_RANGE_ERROR
+            || result.ec == TM_ERANGE
+#endif
+        ) {
+            *out = (digits.negative) ? -value : value;
+        }
+    }
+    return result;
+}
+
+TMC_DEF tmc_conv_result scan_double(const char* nullterminated, double* out, uint32_t flags) {
+    if (!nullterminated) {
+        tmc_conv_result result = {0, TM_EINVAL};
+        return result;
+    }
+    return scan_double_n(nullterminated, TMC_NULLTERMINATED_LEN, out, flags);
+}
+TMC_DEF tmc_conv_result scan_double_n(const char* str, tm_size_t len, double* out, uint32_t flags) {
+    TM_ASSERT_VALID_SIZE(len);
+    TM_ASSERT(str || len == 0);
+
+    scan_FloatDigits digits;
+    tmc_conv_result result = scan_FloatDigitsN(str, len, flags, &digits);
+    if (result.ec != TM_OK) {
+        return result;
+    }
+
+    double value;
+    if (!scan_FastPathDouble(&digits, &value)) {
+        uint64_t bits = 0;
+        result.ec = scan_FloatBits(&scan_DoubleFormat, &digits, &bits);
+        TM_MEMCPY(&value, &bits, sizeof(value));
+    }
+    if (out) {
+        if (result.ec == TM_OK
+#if TMC_CLAMP_ON_RANGE_ERROR
+            || result.ec == TM_ERANGE
+#endif
+        ) {
+            *out = (digits.negative) ? -value : value;
+        }
+    }
+    return result;
+}
+
+TMC_DEF tmc_conv_result tmc_print_string(char* dest, tm_size_t maxlen, const char* src, tm_size_t srclen) {
+    tmc_conv_result result;
+    if (maxlen < srclen) {
+        result.size = maxlen;
+        result.ec = TM_EOVERFLOW;
+    } else {
+        result.size = srclen;
+        result.ec = TM_OK;
+    }
+    TM_ASSERT(dest);
+    TM_ASSERT(src);
+    TM_ASSERT(result.size > 0);
+    TM_MEMCPY(dest, src, result.size);
+    return result;
+}
+
+#if defined(TM_IMPLEMENT_STRNICMP)
+static int32_t tm_strnicmp(const char* a, const char* b, tm_size_t maxlen) {
+    TM_ASSERT_VALID_SIZE(maxlen);
+    while (*a && *b && maxlen--) {
+        int32_t aUpper = TM_TOUPPER(TMC_CHAR_TO_INT(*a));
+        int32_t bUpper = TM_TOUPPER(TMC_CHAR_TO_INT(*b));
+        if (aUpper != bUpper) {
+            break;
+        }
+        ++a;
+        ++b;
+    }
+    if (!maxlen) {
+        return 0;
+    }
+    int32_t aUpper = TM_TOUPPER(TMC_CHAR_TO_INT(*a));
+    int32_t bUpper = TM_TOUPPER(TMC_CHAR_TO_INT(*b));
+    return aUpper - bUpper;
+}
+#endif /* defined(TM_IMPLEMENT_STRNICMP) */
+
+TMC_DEF tmc_conv_result scan_bool(const char* nullterminated, tm_bool* out) {
+    tmc_conv_result result = {0, TM_EINVAL};
+    if (!nullterminated) {
         return result;
     }
     if (*nullterminated == '1') {
@@ -1851,6 +2847,75 @@ TMC_DEF tmc_conv_result scan_bool_n(const char* str, tm_size_t len, tm_bool* out
     return result;
 }
 
+/*
+Values scanned by the array functions have to be followed by the delimiter or the end of the input.
+The scanning functions already stop at the delimiter, so there is no need to search for it.
+*/
+static tm_bool scan_ArrayNext(const char* str, tm_size_t len, char delimiter, tm_size_t* index) {
+    if (*index < len) {
+        if (str[*index] != delimiter) {
+            return TM_FALSE;
+        }
+        ++*index;
+    }
+    return TM_TRUE;
+}
+
+/* Scans one element of an array into out[index], param is the base or the flags of the element type. */
+typedef tmc_conv_result scan_ArrayElementFunc(const char* str, tm_size_t len, void* out, tm_size_t index,
+                                              uint32_t param);
+
+static tmc_conv_result scan_ArrayElementI64(const char* str, tm_size_t len, void* out, tm_size_t index,
+                                            uint32_t param) {
+    return scan_i64_n(str, len, (int64_t*)out + index, (int32_t)param);
+}
+static tmc_conv_result scan_ArrayElementU64(const char* str, tm_size_t len, void* out, tm_size_t index,
+                                            uint32_t param) {
+    return scan_u64_n(str, len, (uint64_t*)out + index, (int32_t)param);
+}
+static tmc_conv_result scan_ArrayElementDouble(const char* str, tm_size_t len, void* out, tm_size_t index,
+                                               uint32_t param) {
+    return scan_double_n(str, len, (double*)out + index, param);
+}
+
+static tmc_conv_result scan_Array(const char* str, tm_size_t len, char delimiter, void* out, tm_size_t* count,
+                                  scan_ArrayElementFunc* scan_element, uint32_t param) {
+    TM_ASSERT_VALID_SIZE(len);
+    TM_ASSERT(str || len == 0);
+    TM_ASSERT(count);
+    TM_ASSERT(out || *count == 0);
+
+    tmc_conv_result result = {0, TM_OK};
+    tm_size_t scanned = 0;
+    for (; scanned < *count && result.size < len; ++scanned) {
+        tmc_conv_result value = scan_element(str + result.size, len - result.size, out, scanned, param);
+        tm_size_t next = result.size + value.size;
+        if (value.ec == TM_OK && !scan_ArrayNext(str, len, delimiter, &next)) {
+            value.ec = TM_EINVAL;
+        }
+        if (value.ec != TM_OK) {
+            result.ec = value.ec;
+            break;
+        }
+        result.size = next;
+    }
+    *count = scanned;
+    return result;
+}
+
+TMC_DEF tmc_conv_result scan_i64_array(const char* str, tm_size_t len, char delimiter, int64_t* out,
+                                       tm_size_t* count, int32_t base) {
+    return scan_Array(str, len, delimiter, out, count, scan_ArrayElementI64, (uint32_t)base);
+}
+TMC_DEF tmc_conv_result scan_u64_array(const char* str, tm_size_t len, char delimiter, uint64_t* out,
+                                       tm_size_t* count, int32_t base) {
+    return scan_Array(str, len, delimiter, out, count, scan_ArrayElementU64, (uint32_t)base);
+}
+TMC_DEF tmc_conv_result scan_double_array(const char* str, tm_size_t len, char delimiter, double* out,
+                                          tm_size_t* count, uint32_t flags) {
+    return scan_Array(str, len, delimiter, out, count, scan_ArrayElementDouble, flags);
+}
+
 /* print implementation */
 
 TMC_DEF tmc_conv_result print_bool(char* dest, tm_size_t maxlen, tm_bool value, uint32_t flags) {
@@ -1886,116 +2951,111 @@ static const char print_DoubleDigitsToCharTable[200] = {
     '0', '8', '1', '8', '2', '8', '3', '8', '4', '8', '5', '8', '6', '8', '7', '8', '8', '8', '9', '9', '0', '9', '1',
     '9', '2', '9', '3', '9', '4', '9', '5', '9', '6', '9', '7', '9', '8', '9', '9'};
 
-static const double print_PowersOfTen[] = {1,     10,    100,    1.0e3,  1.0e4,  1.0e5,  1.0e6, 1.0e7,
-                                           1.0e8, 1.0e9, 1.0e10, 1.0e11, 1.0e12, 1.0e13, 1.0e14};
-/* magnitude is the number of digits before decimal point */
-static int32_t print_magnitude(double value) {
-    /* calculate integer based log10 */
-    int32_t n = 0;
-    if (value < 0) {
-        value = -value;
-    }
-    while (value >= 10) {
-        if (value >= 1.0e32) {
-            n += 32;
-            value /= 1.0e32;
-        }
-        if (value >= 1.0e16) {
-            n += 16;
-            value /= 1.0e16;
-        }
-        if (value >= 1.0e8) {
-            n += 8;
-            value /= 1.0e8;
-        }
-        if (value >= 1.0e4) {
-            n += 4;
-            value /= 1.0e4;
-        }
-        if (value >= 1.0e2) {
-            n += 2;
-            value /= 1.0e2;
-        }
-        if (value >= 1.0e1) {
-            n += 1;
-            value /= 1.0e1;
-        }
-    }
+static const uint64_t tmc_PowersOfTenU64[] = {1,
+                                              10,
+                                              100,
+                                              1000,
+                                              10000,
+                                              100000,
+                                              1000000,
+                                              10000000,
+                                              100000000,
+                                              1000000000,
+                                              10000000000ull,
+                                              100000000000ull,
+                                              1000000000000ull,
+                                              10000000000000ull,
+                                              100000000000000ull,
+                                              1000000000000000ull,
+                                              10000000000000000ull,
+                                              100000000000000000ull,
+                                              1000000000000000000ull,
+                                              10000000000000000000ull};
 
-    /* return magnitude = log10(value) + 1 */
-    return n + 1;
+/*
+ * The number of bits approximates the number of digits, since log10(2^bits) = bits * log10(2) and
+ * 1233 / 4096 is slightly above log10(2). The approximation is off by at most one, which the table corrects.
+ */
+TMC_DEF tm_size_t get_digits_count_decimal_u64(uint64_t number) {
+    /* Zero has one digit, setting the lowest bit never crosses a power of ten. */
+    number |= 1;
+    uint32_t bits = (uint32_t)(64 - tmc_LeadingZeroes64(number));
+    uint32_t digits = (bits * 1233) >> 12;
+    return (tm_size_t)(digits + 1 - (number < tmc_PowersOfTenU64[digits]));
+}
+TMC_DEF tm_size_t get_digits_count_decimal_u32(uint32_t number) {
+    return get_digits_count_decimal_u64(number);
 }
 
-static const uint32_t tmc_UintPowerOfTen[] = {10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+/*
+ * Decimal printing writes pairs of digits from print_DoubleDigitsToCharTable.
+ * Instead of dividing by 100 for every pair, the leading digits of a value with up to 8 digits are turned into
+ * a 32.32 fixed point number using a multiplication with a reciprocal power of ten. Every following pair is then
+ * the integer part of the fraction multiplied by 100 (see "Faster integer formatting" by James Anhalt III).
+ * The reciprocals are rounded up, so that the fractions never end up below their exact values.
+ */
+static void print_DigitPair(char* dest, uint64_t fixed) {
+    uint32_t index = (uint32_t)(fixed >> 32) * 2;
+    TM_ASSERT(index < 200);
+    dest[0] = print_DoubleDigitsToCharTable[index];
+    dest[1] = print_DoubleDigitsToCharTable[index + 1];
+}
 
-TMC_DEF tm_size_t get_digits_count_decimal_u64(uint64_t number) {
-    const uint64_t P01 = 10;
-    const uint64_t P02 = 100;
-    const uint64_t P03 = 1000;
-    const uint64_t P04 = 10000;
-    const uint64_t P05 = 100000;
-    const uint64_t P06 = 1000000;
-    const uint64_t P07 = 10000000;
-    const uint64_t P08 = 100000000;
-    const uint64_t P09 = 1000000000;
-    const uint64_t P10 = 10000000000;
-    const uint64_t P11 = 100000000000;
-    const uint64_t P12 = 1000000000000;
-    if (number < P01) {
-        return 1;
-    }
-    if (number < P02) {
-        return 2;
-    }
-    if (number < P03) {
-        return 3;
-    }
-    if (number < P12) {
-        if (number < P08) {
-            if (number < P06) {
-                if (number < P04) {
-                    return 4;
-                }
-                return 5 + (number >= P05);
-            }
-            return 7 + (number >= P07);
-        }
-        if (number < P10) {
-            return 9 + (number >= P09);
-        }
-        return 11 + (number >= P11);
-    }
-    return 12 + get_digits_count_decimal_u64(number / P12);
+static uint64_t print_NextDigitPair(uint64_t fixed) { return (fixed & 0xFFFFFFFFu) * 100; }
+
+/* Prints exactly 8 digits, including leading zeroes. */
+static void print_EightDigits(char* dest, uint32_t value) {
+    TM_ASSERT(value < 100000000);
+    /* 281474977 = ceil(2^48 / 10^6), shifting right by 16 leaves value / 10^6 with a 32 bit fraction. */
+    uint64_t fixed = (((uint64_t)value * 281474977u) >> 16) + 1;
+    print_DigitPair(dest, fixed);
+    fixed = print_NextDigitPair(fixed);
+    print_DigitPair(dest + 2, fixed);
+    fixed = print_NextDigitPair(fixed);
+    print_DigitPair(dest + 4, fixed);
+    fixed = print_NextDigitPair(fixed);
+    print_DigitPair(dest + 6, fixed);
 }
-TMC_DEF tm_size_t get_digits_count_decimal_u32(uint32_t number) {
-    const uint32_t P01 = 10;
-    const uint32_t P02 = 100;
-    const uint32_t P03 = 1000;
-    const uint32_t P04 = 10000;
-    const uint32_t P05 = 100000;
-    const uint32_t P06 = 1000000;
-    const uint32_t P07 = 10000000;
-    const uint32_t P08 = 100000000;
-    const uint32_t P09 = 1000000000;
-    if (number < P01) {
-        return 1;
-    }
-    if (number < P02) {
-        return 2;
-    }
-    if (number < P03) {
-        return 3;
-    }
-    if (number < P08) {
-        if (number < P06) {
-            if (number < P04) {
-                return 4;
-            }
-            return 5 + (number >= P05);
-        }
-        return 7 + (number >= P07);
+
+/*
+Prints a value below 10^8 that has exactly digits digits.
+If more digits follow, the remaining pairs of the value are written without a loop. That can write up to 6
+characters past dest + digits, which is fine as long as the following digits are written afterwards.
+*/
+static void print_LeadingDigits(char* dest, uint32_t value, tm_size_t digits, tm_bool moreDigitsFollow) {
+    /* Turns value into a fixed point number whose integer part are the first one or two digits, indexed by digits.
+       ceil(2^32 / 10^2), ceil(2^32 / 10^4) and ceil(2^48 / 10^6), the latter shifted right by 16 and rounded up. */
+    static const uint64_t multipliers[] = {0,        4294967296u, 4294967296u, 42949673u, 42949673u,
+                                           429497u,  429497u,     281474977u,  281474977u};
+    static const uint8_t shifts[] = {0, 0, 0, 0, 0, 0, 0, 16, 16};
+    static const uint8_t increments[] = {0, 0, 0, 0, 0, 0, 0, 1, 1};
+    TM_ASSERT(digits >= 1 && digits <= 8);
+    TM_ASSERT(digits == get_digits_count_decimal_u32(value));
+
+    uint64_t fixed = (((uint64_t)value * multipliers[digits]) >> shifts[digits]) + increments[digits];
+    /* An odd number of digits starts with a single digit. Both writes go to dest[0] in that case, so that there is
+       no branch on the parity and nothing is written past dest + digits. */
+    tm_size_t odd = digits & 1;
+    uint32_t index = (uint32_t)(fixed >> 32) * 2;
+    TM_ASSERT(index < 200);
+    dest[0] = print_DoubleDigitsToCharTable[index + odd];
+    dest[1 - odd] = print_DoubleDigitsToCharTable[index + 1];
+    dest += 2 - odd;
+    if (moreDigitsFollow) {
+        /* Pairs past the value are garbage, but they are still valid indices and get overwritten later. */
+        fixed = print_NextDigitPair(fixed);
+        print_DigitPair(dest, fixed);
+        fixed = print_NextDigitPair(fixed);
+        print_DigitPair(dest + 2, fixed);
+        fixed = print_NextDigitPair(fixed);
+        print_DigitPair(dest + 4, fixed);
+        return;
+    }
+    for (digits = (digits - 1) / 2; digits > 0; --digits) {
+        fixed = print_NextDigitPair(fixed);
+        print_DigitPair(dest, fixed);
+        dest += 2;
     }
-    return 9 + (number >= P09);
 }
 
 TMC_DEF tmc_conv_result print_decimal_u32_w(char* dest, tm_size_t maxlen, tm_size_t width, uint32_t value) {
@@ -2011,38 +3071,22 @@ TMC_DEF tmc_conv_result print_decimal_u32_w(char* dest, tm_size_t maxlen, tm_siz
         result.ec = TM_EOVERFLOW;
         return result;
     }
-
-    result.size = width;
-    char* p = dest + width - 1;
-    while (value >= 100 TMC_CW(&& width >= 2)) {
-        uint32_t index = (value % 100) * 2;
-        TM_ASSERT(index < 200);
-        value /= 100;
-        *p = print_DoubleDigitsToCharTable[index + 1];
-        *(p - 1) = print_DoubleDigitsToCharTable[index];
-        p -= 2;
-        TMC_CW(width -= 2);
-    }
-
 #ifdef TMC_CHECKED_WIDTH
-    if ((value < 10 && width != 1) || (value >= 10 && width != 2)) {
+    if (width != get_digits_count_decimal_u32(value)) {
         result.size = maxlen;
         result.ec = TM_EOVERFLOW;
         return result;
     }
 #endif
 
-    /* Handle last 1-2 digits */
-    if (value < 10) {
-        *p = (char)('0' + (uint32_t)value);
+    result.size = width;
+    if (width <= 8) {
+        print_LeadingDigits(dest, value, width, TM_FALSE);
     } else {
-        TM_ASSERT(value < 100);
-        uint32_t index = (uint32_t)value * 2;
-        TM_ASSERT(index < 200);
-        *p = print_DoubleDigitsToCharTable[index + 1];
-        *(p - 1) = print_DoubleDigitsToCharTable[index];
+        uint32_t high = value / 100000000;
+        print_LeadingDigits(dest, high, width - 8, TM_TRUE);
+        print_EightDigits(dest + width - 8, value - high * 100000000);
     }
-
     return result;
 }
 TMC_DEF tmc_conv_result print_decimal_u64_w(char* dest, tm_size_t maxlen, tm_size_t width, uint64_t value) {
@@ -2059,38 +3103,29 @@ TMC_DEF tmc_conv_result print_decimal_u64_w(char* dest, tm_size_t maxlen, tm_siz
         result.ec = TM_EOVERFLOW;
         return result;
     }
-
-    result.size = width;
-    char* p = dest + width - 1;
-    while (value >= 100 TMC_CW(&& width >= 2)) {
-        uint32_t index = (uint32_t)(value % 100) * 2;
-        TM_ASSERT(index < 200);
-        value /= 100;
-        *p = print_DoubleDigitsToCharTable[index + 1];
-        *(p - 1) = print_DoubleDigitsToCharTable[index];
-        p -= 2;
-        TMC_CW(width -= 2);
-    }
-
 #ifdef TMC_CHECKED_WIDTH
-    if ((value < 10 && width != 1) || (value >= 10 && width != 2)) {
+    if (width != get_digits_count_decimal_u64(value)) {
         result.size = maxlen;
         result.ec = TM_EOVERFLOW;
         return result;
     }
 #endif
 
-    /* Handle last 1-2 digits */
-    if (value < 10) {
-        *p = (char)('0' + (uint32_t)value);
+    result.size = width;
+    if (width <= 8) {
+        print_LeadingDigits(dest, (uint32_t)value, width, TM_FALSE);
+    } else if (width <= 16) {
+        uint64_t high = value / 100000000;
+        print_LeadingDigits(dest, (uint32_t)high, width - 8, TM_TRUE);
+        print_EightDigits(dest + width - 8, (uint32_t)(value - high * 100000000));
     } else {
-        TM_ASSERT(value < 100);
-        uint32_t index = (uint32_t)value * 2;
-        TM_ASSERT(index < 200);
-        *p = print_DoubleDigitsToCharTable[index + 1];
-        *(p - 1) = print_DoubleDigitsToCharTable[index];
+        uint64_t high = value / 10000000000000000ull;
+        uint64_t low = value - high * 10000000000000000ull;
+        uint64_t middle = low / 100000000;
+        print_LeadingDigits(dest, (uint32_t)high, width - 16, TM_TRUE);
+        print_EightDigits(dest + width - 16, (uint32_t)middle);
+        print_EightDigits(dest + width - 8, (uint32_t)(low - middle * 100000000));
     }
-
     return result;
 }
 
@@ -2298,6 +3333,36 @@ TMC_DEF tmc_conv_result print_hex_u64_w(char* dest, tm_size_t maxlen, tm_size_t
     return result;
 }
 
+/*
+ * Hex conversion of byte arrays works on 8 characters in an uint64_t at a time (SWAR), like decimal scanning.
+ * Printing spreads the nibbles of 4 bytes into 8 bytes of the uint64_t. Adding 6 to each nibble carries into bit 4
+ * only for nibbles above 9, which selects the offset to the letters.
+ * Scanning validates all 8 characters at once by comparing every byte against the digit and letter ranges,
+ * adding (0x80 - bound) to a byte below 0x80 sets its high bit if it is at least bound. Pairs of nibbles are then
+ * combined and packed into 4 bytes. If a chunk contains an invalid character, the character by character loop finds
+ * its exact offset.
+ */
+static void print_StoreEightChars(char* dest, uint64_t chars) {
+    /* Stored byte by byte to be independent of endianness, compilers turn this into a single store. */
+    dest[0] = (char)(chars & 0xFF);
+    dest[1] = (char)((chars >> 8) & 0xFF);
+    dest[2] = (char)((chars >> 16) & 0xFF);
+    dest[3] = (char)((chars >> 24) & 0xFF);
+    dest[4] = (char)((chars >> 32) & 0xFF);
+    dest[5] = (char)((chars >> 40) & 0xFF);
+    dest[6] = (char)((chars >> 48) & 0xFF);
+    dest[7] = (char)((chars >> 56) & 0xFF);
+}
+
+static void print_HexFourBytes(char* dest, const uint8_t* bytes, uint64_t letterOffset) {
+    uint64_t spread = (uint64_t)bytes[0] | ((uint64_t)bytes[1] << 16) | ((uint64_t)bytes[2] << 32) |
+                      ((uint64_t)bytes[3] << 48);
+    /* The high nibble of every byte is printed first, so it goes into the lower byte of each 16 bit lane. */
+    uint64_t nibbles = ((spread >> 4) & 0x000F000F000F000Fu) | ((spread & 0x000F000F000F000Fu) << 8);
+    uint64_t letters = ((nibbles + 0x0606060606060606u) >> 4) & 0x0101010101010101u;
+    print_StoreEightChars(dest, nibbles + 0x3030303030303030u + letters * letterOffset);
+}
+
 TMC_DEF tmc_conv_result print_hex_bytes(char* dest, tm_size_t maxlen, const void* bytes, tm_size_t size,
                                         tm_bool lowercase) {
     TM_ASSERT_VALID_SIZE(maxlen);
@@ -2313,11 +3378,17 @@ TMC_DEF tmc_conv_result print_hex_bytes(char* dest, tm_size_t maxlen, const void
     }
     result.size = needed_size;
 
+    const uint8_t* first = (const uint8_t*)bytes;
+    const uint8_t* last = first + size;
+    const uint64_t letterOffset = (uint64_t)(((lowercase) ? 'a' : 'A') - '0' - 10);
+    for (; last - first >= 8; first += 8, dest += 16) {
+        print_HexFourBytes(dest, first, letterOffset);
+        print_HexFourBytes(dest + 8, first + 4, letterOffset);
+    }
+
     const char* table = (lowercase) ? (print_NumberToCharTableLower) : (print_NumberToCharTableUpper);
-    const char* first = (const char*)bytes;
-    const char* last = first + size;
     while (first < last) {
-        uint8_t value = (uint8_t)*first;
+        uint8_t value = *first;
         *(dest + 1) = table[value & 0x0F];
         *dest = table[(value >> 4) & 0x0F];
         dest += 2;
@@ -2327,6 +3398,94 @@ TMC_DEF tmc_conv_result print_hex_bytes(char* dest, tm_size_t maxlen, const void
     return result;
 }
 
+/* Decodes 8 hex digits into 4 bytes, returns false if any of the characters is not a hex digit. */
+static tm_bool scan_HexEightChars(uint64_t chars, uint8_t* out) {
+    const uint64_t highBits = 0x8080808080808080u;
+    if (chars & highBits) {
+        return TM_FALSE;
+    }
+    /* '0' <= c <= '9' and 'a' <= (c | 0x20) <= 'f'. */
+    uint64_t digits = (chars + 0x5050505050505050u) & ~(chars + 0x4646464646464646u);
+    uint64_t lower = chars | 0x2020202020202020u;
+    uint64_t letters = (lower + 0x1F1F1F1F1F1F1F1Fu) & ~(lower + 0x1919191919191919u) & highBits;
+    if (((digits | letters) & highBits) != highBits) {
+        return TM_FALSE;
+    }
+
+    uint64_t nibbles = (chars & 0x0F0F0F0F0F0F0F0Fu) + (letters >> 7) * 9;
+    /* The first character of a pair is the high nibble and lives in the lower byte of each 16 bit lane. */
+    uint64_t values = ((nibbles & 0x000F000F000F000Fu) << 4) | ((nibbles >> 8) & 0x000F000F000F000Fu);
+    values = (values | (values >> 8)) & 0x0000FFFF0000FFFFu;
+    values = (values | (values >> 16)) & 0xFFFFFFFFu;
+    out[0] = (uint8_t)(values & 0xFF);
+    out[1] = (uint8_t)((values >> 8) & 0xFF);
+    out[2] = (uint8_t)((values >> 16) & 0xFF);
+    out[3] = (uint8_t)((values >> 24) & 0xFF);
+    return TM_TRUE;
+}
+
+static int32_t scan_HexDigit(char c) {
+    int32_t cp = TMC_CHAR_TO_INT(c);
+    if (TM_ISDIGIT(cp)) {
+        return cp - '0';
+    }
+    if (cp >= 'A' && cp <= 'F') {
+        return cp - 'A' + 10;
+    }
+    if (cp >= 'a' && cp <= 'f') {
+        return cp - 'a' + 10;
+    }
+    return -1;
+}
+
+TMC_DEF tmc_conv_result scan_hex_bytes(const char* str, tm_size_t len, void* out, tm_size_t out_size) {
+    TM_ASSERT_VALID_SIZE(len);
+    TM_ASSERT(str || len == 0);
+    TM_ASSERT_VALID_SIZE(out_size);
+    TM_ASSERT(out || out_size == 0);
+
+    tmc_conv_result result = {0, TM_OK};
+    if (len / 2 > out_size) {
+        result.ec = TM_EOVERFLOW;
+        return result;
+    }
+
+    uint8_t* dest = (uint8_t*)out;
+    tm_size_t i = 0;
+    for (; len - i >= 16; i += 16, dest += 8) {
+        if (!scan_HexEightChars(scan_LoadEightChars(str + i), dest) ||
+            !scan_HexEightChars(scan_LoadEightChars(str + i + 8), dest + 4)) {
+            break;
+        }
+    }
+    for (; i < len; i += 2, ++dest) {
+        int32_t high = scan_HexDigit(str[i]);
+        if (high < 0) {
+            result.size = i;
+            result.ec = TM_EINVAL;
+            return result;
+        }
+        if (i + 1 >= len) {
+            break;
+        }
+        int32_t low = scan_HexDigit(str[i + 1]);
+        if (low < 0) {
+            result.size = i + 1;
+            result.ec = TM_EINVAL;
+            return result;
+        }
+        *dest = (uint8_t)((high << 4) | low);
+    }
+    if (i < len) {
+        /* Last digit of the pair is missing. */
+        result.size = len - 1;
+        result.ec = TM_EINVAL;
+        return result;
+    }
+    result.size = len;
+    return result;
+}
+
 TMC_DEF tmc_conv_result print_hex_i32(char* dest, tm_size_t maxlen, int32_t value, tm_bool lowercase) {
     TM_ASSERT_VALID_SIZE(maxlen);
     TM_ASSERT(dest || maxlen == 0);
@@ -2558,175 +3717,885 @@ static tmc_conv_result tmc_print_zero_padded_u64(char* dest, tm_size_t maxlen, t
     }
     return tmc_combine_conv_results(result, print_decimal_u64_w(dest, maxlen, count, value));
 }
-TMC_DEF tmc_conv_result print_double(char* dest, tm_size_t maxlen, double value, uint32_t flags, int32_t precision) {
-    TM_ASSERT(dest);
-    TM_ASSERT_VALID_SIZE(maxlen);
-    if (maxlen <= 0) {
-        tmc_conv_result result = {0, TM_EOVERFLOW};
-        return result;
+/*
+ * Printing floats:
+ * The shortest representation that round trips uses Schubfach, see "The Schubfach way to render doubles" by
+ * Raffaello Giulietti. The decimals that round to the float form an interval, its bounds are computed with 128 bit
+ * approximations of powers of ten that are exact enough to always find the shortest decimal inside the interval,
+ * or the closest one if there is more than one.
+ * Output with a precision is correctly rounded, ties round to even. If the value scaled by a power of ten fits into
+ * 64 bits it is rounded using a 128 bit product, otherwise all digits are generated exactly with the big decimal
+ * from scanning. Neither needs any memory besides the stack.
+ */
+
+/* Value is mantissa * 2^exponent. */
+typedef struct {
+    uint64_t mantissa;
+    int32_t exponent;
+    tm_bool lowerBoundaryIsCloser; /* Whether the next smaller float is closer than the next bigger one. */
+} print_BinaryFloat;
+
+static print_BinaryFloat print_DecomposeDouble(double value) {
+    uint64_t bits = 0;
+    TM_MEMCPY(&bits, &value, sizeof(bits));
+    uint64_t fraction = bits & (((uint64_t)1 << 52) - 1);
+    int32_t biasedExponent = (int32_t)((bits >> 52) & 0x7FF);
+
+    print_BinaryFloat result;
+    if (biasedExponent == 0) {
+        result.mantissa = fraction;
+        result.exponent = -1074;
+        result.lowerBoundaryIsCloser = TM_FALSE;
+    } else {
+        result.mantissa = fraction | ((uint64_t)1 << 52);
+        result.exponent = biasedExponent - 1075;
+        result.lowerBoundaryIsCloser = fraction == 0 && biasedExponent > 1;
     }
+    return result;
+}
 
-    tm_size_t start = maxlen;
-    if (((flags & PF_SIGNBIT) && TM_SIGNBIT(value)) || (value < 0)) {
-        *dest++ = '-';
-        --maxlen;
-        value = -value;
-        if (maxlen <= 0) {
-            tmc_conv_result result = {start - maxlen, TM_EOVERFLOW};
-            return result;
-        }
+static print_BinaryFloat print_DecomposeFloat(float value) {
+    uint32_t bits = 0;
+    TM_MEMCPY(&bits, &value, sizeof(bits));
+    uint32_t fraction = bits & (((uint32_t)1 << 23) - 1);
+    int32_t biasedExponent = (int32_t)((bits >> 23) & 0xFF);
+
+    print_BinaryFloat result;
+    if (biasedExponent == 0) {
+        result.mantissa = fraction;
+        result.exponent = -149;
+        result.lowerBoundaryIsCloser = TM_FALSE;
+    } else {
+        result.mantissa = fraction | ((uint32_t)1 << 23);
+        result.exponent = biasedExponent - 150;
+        result.lowerBoundaryIsCloser = fraction == 0 && biasedExponent > 1;
+    }
+    return result;
+}
+
+/* Sets decimal to value * 10^exponent. */
+static void print_DecimalFromU64(tmc_Decimal* decimal, uint64_t value, int32_t exponent) {
+    uint8_t reversed[20];
+    uint32_t count = 0;
+    while (value > 0) {
+        reversed[count++] = (uint8_t)(value % 10);
+        value /= 10;
+    }
+    for (uint32_t i = 0; i < count; ++i) {
+        decimal->digits[i] = reversed[count - i - 1];
+    }
+    decimal->count = count;
+    decimal->decimalPoint = (count > 0) ? (int32_t)count + exponent : 0;
+    decimal->truncated = TM_FALSE;
+    tmc_DecimalTrim(decimal);
+}
+
+/* All digits of value, a float has at most 767 significant digits, so none are truncated. */
+static void print_ExactDecimal(print_BinaryFloat value, tmc_Decimal* out) {
+    /* Shift amounts are limited to 60, see tmc_DecimalLeftShift and tmc_DecimalRightShift. */
+    const int32_t MaxShift = 60;
+    print_DecimalFromU64(out, value.mantissa, 0);
+    for (int32_t exponent = value.exponent; exponent > 0; exponent -= MaxShift) {
+        tmc_DecimalLeftShift(out, (uint32_t)((exponent < MaxShift) ? exponent : MaxShift));
+    }
+    for (int32_t exponent = -value.exponent; exponent > 0; exponent -= MaxShift) {
+        tmc_DecimalRightShift(out, (uint32_t)((exponent < MaxShift) ? exponent : MaxShift));
+    }
+    TM_ASSERT(!out->truncated);
+}
+
+/* Rounds to the first keep digits, ties round to even.
+   The digits are exact, so any digit after a 5 means that the value is above halfway. */
+static void print_DecimalRound(tmc_Decimal* decimal, int32_t keep) {
+    if (keep >= (int32_t)decimal->count) {
+        return;
     }
 
-    if (TM_ISNAN(value)) {
-        tmc_conv_result result = {start - maxlen, TM_OK};
-        if (flags & PF_LOWERCASE) {
-            return tmc_combine_conv_results(result, tmc_print_string(dest, maxlen, "nan", 3));
+    tm_bool roundUp = TM_FALSE;
+    if (keep >= 0) {
+        uint8_t next = decimal->digits[keep];
+        if (next != 5) {
+            roundUp = next > 5;
+        } else if (keep + 1 < (int32_t)decimal->count || decimal->truncated) {
+            roundUp = TM_TRUE;
         } else {
-            return tmc_combine_conv_results(result, tmc_print_string(dest, maxlen, "NAN", 3));
+            roundUp = keep > 0 && (decimal->digits[keep - 1] & 1);
         }
     }
-    if (TM_ISINF(value)) {
-        tmc_conv_result result = {start - maxlen, TM_OK};
-        if (flags & PF_LOWERCASE) {
-            return tmc_combine_conv_results(result, tmc_print_string(dest, maxlen, "inf", 3));
+    decimal->truncated = TM_FALSE;
+
+    if (keep <= 0) {
+        /* Every digit is rounded away, result is either zero or one unit of the rounding position. */
+        if (roundUp) {
+            decimal->digits[0] = 1;
+            decimal->count = 1;
+            ++decimal->decimalPoint;
         } else {
-            return tmc_combine_conv_results(result, tmc_print_string(dest, maxlen, "INF", 3));
+            decimal->count = 0;
+            decimal->decimalPoint = 0;
         }
+        return;
     }
 
-    tm_bool keep_short = (precision < 0) || (flags & PF_SHORTEST);
-    TMC_DEBUG(printf("keep_short is: %d\n", keep_short));
-    if (keep_short) {
-        precision = TMC_MAX_PRECISION;
-    } else {
-        flags |= PF_TRAILING_ZEROES;
-        if (precision > TMC_MAX_PRECISION) {
-            precision = TMC_MAX_PRECISION;
+    decimal->count = (uint32_t)keep;
+    if (roundUp) {
+        int32_t i = keep - 1;
+        while (i >= 0 && decimal->digits[i] == 9) {
+            --i;
+        }
+        if (i < 0) {
+            decimal->digits[0] = 1;
+            decimal->count = 1;
+            ++decimal->decimalPoint;
+            return;
         }
+        ++decimal->digits[i];
+        decimal->count = (uint32_t)i + 1;
     }
+    tmc_DecimalTrim(decimal);
+}
+
+/* floor(value / 2^shift), without relying on right shifts of negative values. */
+static int32_t print_FloorDivPow2(int32_t value, int32_t shift) {
+    return (value >= 0) ? (value >> shift) : -((-value + ((int32_t)1 << shift) - 1) >> shift);
+}
 
-    /* quick and dirty method to convert double value to decimal string
-       produces wrong results for very big numbers > around 1e18 */
+/* floor(log10(2^exponent)) */
+static int32_t print_FloorLog10Pow2(int32_t exponent) { return print_FloorDivPow2(exponent * 1262611, 22); }
 
-    /* check for rollover due to precision */
-    double rollover = value + str_Pow10(0.5, -precision);
-    if ((uint64_t)rollover > (uint64_t)value) {
-        value += 1;
+/*
+Scaling of binary floating point values by powers of ten with a single 128-bit product, shared by the float printing
+of tm_conversion and the builtin float backend of tm_print.
+The 128-bit type is expected to have uint64_t members low and high.
+*/
+
+/* 5^0 up to 5^27, the biggest power of five that fits into 63 bits. */
+static const uint64_t print_PowersOfFive[] = {
+    1, 5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125, 9765625, 48828125, 244140625, 1220703125, 6103515625ull,
+    30517578125ull, 152587890625ull, 762939453125ull, 3814697265625ull, 19073486328125ull, 95367431640625ull,
+    476837158203125ull, 2384185791015625ull, 11920928955078125ull, 59604644775390625ull, 298023223876953125ull,
+    1490116119384765625ull, 7450580596923828125ull};
+
+/*
+Computes mantissa * 2^exponent * 10^power rounded to the nearest integer, ties round to even.
+Fails if power is out of range of the fast path or if the result doesn't fit into 64 bits.
+*/
+static tm_bool print_ScaleAndRound(uint64_t mantissa, int32_t exponent, int32_t power, uint64_t* out) {
+    if (power < 0 || power > 27) {
+        return TM_FALSE;
     }
 
-    int32_t magnitude = print_magnitude(value);
-    if (magnitude >= scan_MaxExponent) {
-#ifdef TMC_CLAMP_ON_RANGE_ERROR
-        magnitude = scan_MaxExponent - 1;
-#else
-        return {0, TM_EOVERFLOW};
-#endif
+    /* mantissa < 2^53 and 5^27 < 2^63, so the product fits into 116 bits. */
+    tmc_U128 product = tmc_Multiply64(mantissa, print_PowersOfFive[power]);
+    int32_t shift = exponent + power;
+    if (shift >= 0) {
+        if (product.high != 0 || shift >= 64 || (shift > 0 && (product.low >> (64 - shift)) != 0)) {
+            return TM_FALSE;
+        }
+        *out = product.low << shift;
+        return TM_TRUE;
     }
-    tm_size_t printWidth = 0;
-    while (magnitude > 0 && maxlen > 0) {
-        double part;
-        if (magnitude > TMC_MAX_PRECISION) {
-            part = str_Pow10(value, -(magnitude - TMC_MAX_PRECISION));
-            value -= str_Pow10((double)((uint64_t)part), magnitude - TMC_MAX_PRECISION);
-        } else {
-            part = value;
-            value -= (double)((uint64_t)value);
-            printWidth = magnitude;
-        }
-        uint64_t digits = (uint64_t)part;
-        tmc_conv_result interm = tmc_print_zero_padded_u64(dest, maxlen, printWidth, digits);
-        printWidth = TMC_MAX_PRECISION;
-        magnitude -= TMC_MAX_PRECISION;
-        maxlen -= interm.size;
-        dest += interm.size;
-        if (interm.ec != TM_OK) {
-            tmc_conv_result result = {start - maxlen, interm.ec};
-            return result;
+
+    int32_t rightShift = -shift;
+    if (rightShift >= 117) {
+        /* Product is below half of the rounding unit. */
+        *out = 0;
+        return TM_TRUE;
+    }
+
+    uint64_t quotient;
+    tmc_U128 remainder = {0, 0};
+    tmc_U128 half = {0, 0};
+    if (rightShift < 64) {
+        if ((product.high >> rightShift) != 0) {
+            return TM_FALSE;
         }
+        quotient = (product.low >> rightShift) | (product.high << (64 - rightShift));
+        remainder.low = product.low & (((uint64_t)1 << rightShift) - 1);
+        half.low = (uint64_t)1 << (rightShift - 1);
+    } else if (rightShift == 64) {
+        quotient = product.high;
+        remainder.low = product.low;
+        half.low = (uint64_t)1 << 63;
+    } else {
+        quotient = product.high >> (rightShift - 64);
+        remainder.high = product.high & (((uint64_t)1 << (rightShift - 64)) - 1);
+        remainder.low = product.low;
+        half.high = (uint64_t)1 << (rightShift - 65);
     }
-    if (magnitude > 0 && maxlen <= 0) {
-        tmc_conv_result result = {start - maxlen, TM_EOVERFLOW};
-        return result;
+
+    tm_bool aboveHalf = remainder.high > half.high || (remainder.high == half.high && remainder.low > half.low);
+    tm_bool isHalf = remainder.high == half.high && remainder.low == half.low;
+    if (aboveHalf || (isHalf && (quotient & 1))) {
+        if (quotient == UINT64_MAX) {
+            return TM_FALSE;
+        }
+        ++quotient;
     }
-    double fractionalPart = value;
+    *out = quotient;
+    return TM_TRUE;
+}
 
-    tm_errc ec = TM_OK;
-    if (precision > 0) {
-        printWidth = precision;
-        /* fractionalPart is positive, so we can round by adding 0.5 before truncating
-           this might produce wrong rounding, but matches MSVC's printf rounding */
-        uint64_t fractionalDigits = (uint64_t)((fractionalPart * print_PowersOfTen[precision]) + 0.5);
-        if (fractionalDigits) {
-            if (maxlen <= 0) {
-                tmc_conv_result result = {start - maxlen, TM_EOVERFLOW};
-                return result;
-            }
-            *dest++ = '.';
-            --maxlen;
-            if (maxlen <= 0) {
-                tmc_conv_result result = {start - maxlen, TM_EOVERFLOW};
-                return result;
-            }
-            if (!(flags & PF_TRAILING_ZEROES) || keep_short) {
-                /* get rid of trailing zeroes */
-                for (;;) {
-                    uint64_t digit = fractionalDigits % 10;
-                    if (!digit) {
-                        fractionalDigits /= 10;
-                        --printWidth;
-                    } else {
-                        break;
-                    }
-                }
-            }
-            /* check whether we got rid of all digits when trimming trailing zeroes */
-            if (printWidth <= 0) {
-                /* output a zero manually in that case */
-                TM_ASSERT(maxlen > 0);
-                *dest++ = '0';
-                --maxlen;
-            } else {
-                tmc_conv_result fractionalResult =
-                    tmc_print_zero_padded_u64(dest, maxlen, printWidth, fractionalDigits);
-                maxlen -= fractionalResult.size;
-                dest += fractionalResult.size;
-                if (fractionalResult.ec != TM_OK) {
-                    tmc_conv_result result = {start - maxlen, fractionalResult.ec};
-                    return result;
-                }
-            }
-        } else if (flags & PF_TRAILING_ZEROES) {
-            if (maxlen <= 0) {
-                tmc_conv_result result = {start - maxlen, TM_EOVERFLOW};
-                return result;
+/* Rounds to fractionDigits digits after the decimal point. */
+static void print_FixedDecimal(print_BinaryFloat value, int32_t fractionDigits, tmc_Decimal* out) {
+    uint64_t scaled = 0;
+    if (print_ScaleAndRound(value.mantissa, value.exponent, fractionDigits, &scaled)) {
+        print_DecimalFromU64(out, scaled, -fractionDigits);
+        return;
+    }
+    print_ExactDecimal(value, out);
+    if (fractionDigits < (int32_t)out->count - out->decimalPoint) {
+        print_DecimalRound(out, out->decimalPoint + fractionDigits);
+    }
+}
+
+/* Rounds to significantDigits significant digits. */
+static void print_SignificantDecimal(print_BinaryFloat value, int32_t significantDigits, tmc_Decimal* out) {
+    TM_ASSERT(significantDigits > 0);
+    if (value.mantissa == 0) {
+        print_DecimalFromU64(out, 0, 0);
+        return;
+    }
+
+    if (significantDigits <= 19) {
+        /* Estimated decimal exponent is either exact or one too small. */
+        int32_t k = print_FloorLog10Pow2(value.exponent + 63 - tmc_LeadingZeroes64(value.mantissa));
+        for (int32_t i = 0; i < 2; ++i, ++k) {
+            uint64_t scaled = 0;
+            if (!print_ScaleAndRound(value.mantissa, value.exponent, significantDigits - 1 - k, &scaled)) {
+                break;
             }
-            *dest++ = '.';
-            --maxlen;
-            if (maxlen <= 0) {
-                tmc_conv_result result = {start - maxlen, TM_EOVERFLOW};
-                return result;
+            if (scaled > tmc_PowersOfTenU64[significantDigits]) {
+                continue;
             }
+            print_DecimalFromU64(out, scaled, k + 1 - significantDigits);
+            return;
+        }
+    }
 
-            if (keep_short) {
-                *dest++ = '0';
-                --maxlen;
-            } else {
-                if (maxlen < (tm_size_t)precision) {
-                    precision = (int32_t)maxlen;
-                    ec = TM_EOVERFLOW;
-                }
+    print_ExactDecimal(value, out);
+    print_DecimalRound(out, significantDigits);
+}
+
+/* g = floor(10^k * 2^r) + 1 for 10^-292 up to 10^324, where r is chosen so that 2^127 <= g < 2^128.
+   High 64 bits first. */
+static const int32_t print_SmallestPowerOfTen = -292;
+static const uint64_t print_PowersOfTen128[] = {
+    0xff77b1fcbebcdc4f, 0x25e8e89c13bb0f7b, 0x9faacf3df73609b1, 0x77b191618c54e9ad,
+    0xc795830d75038c1d, 0xd59df5b9ef6a2418, 0xf97ae3d0d2446f25, 0x4b0573286b44ad1e,
+    0x9becce62836ac577, 0x4ee367f9430aec33, 0xc2e801fb244576d5, 0x229c41f793cda740,
+    0xf3a20279ed56d48a, 0x6b43527578c11110, 0x9845418c345644d6, 0x830a13896b78aaaa,
+    0xbe5691ef416bd60c, 0x23cc986bc656d554, 0xedec366b11c6cb8f, 0x2cbfbe86b7ec8aa9,
+    0x94b3a202eb1c3f39, 0x7bf7d71432f3d6aa, 0xb9e08a83a5e34f07, 0xdaf5ccd93fb0cc54,
+    0xe858ad248f5c22c9, 0xd1b3400f8f9cff69, 0x91376c36d99995be, 0x23100809b9c21fa2,
+    0xb58547448ffffb2d, 0xabd40a0c2832a78b, 0xe2e69915b3fff9f9, 0x16c90c8f323f516d,
+    0x8dd01fad907ffc3b, 0xae3da7d97f6792e4, 0xb1442798f49ffb4a, 0x99cd11cfdf41779d,
+    0xdd95317f31c7fa1d, 0x40405643d711d584, 0x8a7d3eef7f1cfc52, 0x482835ea666b2573,
+    0xad1c8eab5ee43b66, 0xda3243650005eed0, 0xd863b256369d4a40, 0x90bed43e40076a83,
+    0x873e4f75e2224e68, 0x5a7744a6e804a292, 0xa90de3535aaae202, 0x711515d0a205cb37,
+    0xd3515c2831559a83, 0x0d5a5b44ca873e04, 0x8412d9991ed58091, 0xe858790afe9486c3,
+    0xa5178fff668ae0b6, 0x626e974dbe39a873, 0xce5d73ff402d98e3, 0xfb0a3d212dc81290,
+    0x80fa687f881c7f8e, 0x7ce66634bc9d0b9a, 0xa139029f6a239f72, 0x1c1fffc1ebc44e81,
+    0xc987434744ac874e, 0xa327ffb266b56221, 0xfbe9141915d7a922, 0x4bf1ff9f0062baa9,
+    0x9d71ac8fada6c9b5, 0x6f773fc3603db4aa, 0xc4ce17b399107c22, 0xcb550fb4384d21d4,
+    0xf6019da07f549b2b, 0x7e2a53a146606a49, 0x99c102844f94e0fb, 0x2eda7444cbfc426e,
+    0xc0314325637a1939, 0xfa911155fefb5309, 0xf03d93eebc589f88, 0x793555ab7eba27cb,
+    0x96267c7535b763b5, 0x4bc1558b2f3458df, 0xbbb01b9283253ca2, 0x9eb1aaedfb016f17,
+    0xea9c227723ee8bcb, 0x465e15a979c1cadd, 0x92a1958a7675175f, 0x0bfacd89ec191eca,
+    0xb749faed14125d36, 0xcef980ec671f667c, 0xe51c79a85916f484, 0x82b7e12780e7401b,
+    0x8f31cc0937ae58d2, 0xd1b2ecb8b0908811, 0xb2fe3f0b8599ef07, 0x861fa7e6dcb4aa16,
+    0xdfbdcece67006ac9, 0x67a791e093e1d49b, 0x8bd6a141006042bd, 0xe0c8bb2c5c6d24e1,
+    0xaecc49914078536d, 0x58fae9f773886e19, 0xda7f5bf590966848, 0xaf39a475506a899f,
+    0x888f99797a5e012d, 0x6d8406c952429604, 0xaab37fd7d8f58178, 0xc8e5087ba6d33b84,
+    0xd5605fcdcf32e1d6, 0xfb1e4a9a90880a65, 0x855c3be0a17fcd26, 0x5cf2eea09a550680,
+    0xa6b34ad8c9dfc06f, 0xf42faa48c0ea481f, 0xd0601d8efc57b08b, 0xf13b94daf124da27,
+    0x823c12795db6ce57, 0x76c53d08d6b70859, 0xa2cb1717b52481ed, 0x54768c4b0c64ca6f,
+    0xcb7ddcdda26da268, 0xa9942f5dcf7dfd0a, 0xfe5d54150b090b02, 0xd3f93b35435d7c4d,
+    0x9efa548d26e5a6e1, 0xc47bc5014a1a6db0, 0xc6b8e9b0709f109a, 0x359ab6419ca1091c,
+    0xf867241c8cc6d4c0, 0xc30163d203c94b63, 0x9b407691d7fc44f8, 0x79e0de63425dcf1e,
+    0xc21094364dfb5636, 0x985915fc12f542e5, 0xf294b943e17a2bc4, 0x3e6f5b7b17b2939e,
+    0x979cf3ca6cec5b5a, 0xa705992ceecf9c43, 0xbd8430bd08277231, 0x50c6ff782a838354,
+    0xece53cec4a314ebd, 0xa4f8bf5635246429, 0x940f4613ae5ed136, 0x871b7795e136be9a,
+    0xb913179899f68584, 0x28e2557b59846e40, 0xe757dd7ec07426e5, 0x331aeada2fe589d0,
+    0x9096ea6f3848984f, 0x3ff0d2c85def7622, 0xb4bca50b065abe63, 0x0fed077a756b53aa,
+    0xe1ebce4dc7f16dfb, 0xd3e8495912c62895, 0x8d3360f09cf6e4bd, 0x64712dd7abbbd95d,
+    0xb080392cc4349dec, 0xbd8d794d96aacfb4, 0xdca04777f541c567, 0xecf0d7a0fc5583a1,
+    0x89e42caaf9491b60, 0xf41686c49db57245, 0xac5d37d5b79b6239, 0x311c2875c522ced6,
+    0xd77485cb25823ac7, 0x7d633293366b828c, 0x86a8d39ef77164bc, 0xae5dff9c02033198,
+    0xa8530886b54dbdeb, 0xd9f57f830283fdfd, 0xd267caa862a12d66, 0xd072df63c324fd7c,
+    0x8380dea93da4bc60, 0x4247cb9e59f71e6e, 0xa46116538d0deb78, 0x52d9be85f074e609,
+    0xcd795be870516656, 0x67902e276c921f8c, 0x806bd9714632dff6, 0x00ba1cd8a3db53b7,
+    0xa086cfcd97bf97f3, 0x80e8a40eccd228a5, 0xc8a883c0fdaf7df0, 0x6122cd128006b2ce,
+    0xfad2a4b13d1b5d6c, 0x796b805720085f82, 0x9cc3a6eec6311a63, 0xcbe3303674053bb1,
+    0xc3f490aa77bd60fc, 0xbedbfc4411068a9d, 0xf4f1b4d515acb93b, 0xee92fb5515482d45,
+    0x991711052d8bf3c5, 0x751bdd152d4d1c4b, 0xbf5cd54678eef0b6, 0xd262d45a78a0635e,
+    0xef340a98172aace4, 0x86fb897116c87c35, 0x9580869f0e7aac0e, 0xd45d35e6ae3d4da1,
+    0xbae0a846d2195712, 0x8974836059cca10a, 0xe998d258869facd7, 0x2bd1a438703fc94c,
+    0x91ff83775423cc06, 0x7b6306a34627ddd0, 0xb67f6455292cbf08, 0x1a3bc84c17b1d543,
+    0xe41f3d6a7377eeca, 0x20caba5f1d9e4a94, 0x8e938662882af53e, 0x547eb47b7282ee9d,
+    0xb23867fb2a35b28d, 0xe99e619a4f23aa44, 0xdec681f9f4c31f31, 0x6405fa00e2ec94d5,
+    0x8b3c113c38f9f37e, 0xde83bc408dd3dd05, 0xae0b158b4738705e, 0x9624ab50b148d446,
+    0xd98ddaee19068c76, 0x3badd624dd9b0958, 0x87f8a8d4cfa417c9, 0xe54ca5d70a80e5d7,
+    0xa9f6d30a038d1dbc, 0x5e9fcf4ccd211f4d, 0xd47487cc8470652b, 0x7647c32000696720,
+    0x84c8d4dfd2c63f3b, 0x29ecd9f40041e074, 0xa5fb0a17c777cf09, 0xf468107100525891,
+    0xcf79cc9db955c2cc, 0x7182148d4066eeb5, 0x81ac1fe293d599bf, 0xc6f14cd848405531,
+    0xa21727db38cb002f, 0xb8ada00e5a506a7d, 0xca9cf1d206fdc03b, 0xa6d90811f0e4851d,
+    0xfd442e4688bd304a, 0x908f4a166d1da664, 0x9e4a9cec15763e2e, 0x9a598e4e043287ff,
+    0xc5dd44271ad3cdba, 0x40eff1e1853f29fe, 0xf7549530e188c128, 0xd12bee59e68ef47d,
+    0x9a94dd3e8cf578b9, 0x82bb74f8301958cf, 0xc13a148e3032d6e7, 0xe36a52363c1faf02,
+    0xf18899b1bc3f8ca1, 0xdc44e6c3cb279ac2, 0x96f5600f15a7b7e5, 0x29ab103a5ef8c0ba,
+    0xbcb2b812db11a5de, 0x7415d448f6b6f0e8, 0xebdf661791d60f56, 0x111b495b3464ad22,
+    0x936b9fcebb25c995, 0xcab10dd900beec35, 0xb84687c269ef3bfb, 0x3d5d514f40eea743,
+    0xe65829b3046b0afa, 0x0cb4a5a3112a5113, 0x8ff71a0fe2c2e6dc, 0x47f0e785eaba72ac,
+    0xb3f4e093db73a093, 0x59ed216765690f57, 0xe0f218b8d25088b8, 0x306869c13ec3532d,
+    0x8c974f7383725573, 0x1e414218c73a13fc, 0xafbd2350644eeacf, 0xe5d1929ef90898fb,
+    0xdbac6c247d62a583, 0xdf45f746b74abf3a, 0x894bc396ce5da772, 0x6b8bba8c328eb784,
+    0xab9eb47c81f5114f, 0x066ea92f3f326565, 0xd686619ba27255a2, 0xc80a537b0efefebe,
+    0x8613fd0145877585, 0xbd06742ce95f5f37, 0xa798fc4196e952e7, 0x2c48113823b73705,
+    0xd17f3b51fca3a7a0, 0xf75a15862ca504c6, 0x82ef85133de648c4, 0x9a984d73dbe722fc,
+    0xa3ab66580d5fdaf5, 0xc13e60d0d2e0ebbb, 0xcc963fee10b7d1b3, 0x318df905079926a9,
+    0xffbbcfe994e5c61f, 0xfdf17746497f7053, 0x9fd561f1fd0f9bd3, 0xfeb6ea8bedefa634,
+    0xc7caba6e7c5382c8, 0xfe64a52ee96b8fc1, 0xf9bd690a1b68637b, 0x3dfdce7aa3c673b1,
+    0x9c1661a651213e2d, 0x06bea10ca65c084f, 0xc31bfa0fe5698db8, 0x486e494fcff30a63,
+    0xf3e2f893dec3f126, 0x5a89dba3c3efccfb, 0x986ddb5c6b3a76b7, 0xf89629465a75e01d,
+    0xbe89523386091465, 0xf6bbb397f1135824, 0xee2ba6c0678b597f, 0x746aa07ded582e2d,
+    0x94db483840b717ef, 0xa8c2a44eb4571cdd, 0xba121a4650e4ddeb, 0x92f34d62616ce414,
+    0xe896a0d7e51e1566, 0x77b020baf9c81d18, 0x915e2486ef32cd60, 0x0ace1474dc1d122f,
+    0xb5b5ada8aaff80b8, 0x0d819992132456bb, 0xe3231912d5bf60e6, 0x10e1fff697ed6c6a,
+    0x8df5efabc5979c8f, 0xca8d3ffa1ef463c2, 0xb1736b96b6fd83b3, 0xbd308ff8a6b17cb3,
+    0xddd0467c64bce4a0, 0xac7cb3f6d05ddbdf, 0x8aa22c0dbef60ee4, 0x6bcdf07a423aa96c,
+    0xad4ab7112eb3929d, 0x86c16c98d2c953c7, 0xd89d64d57a607744, 0xe871c7bf077ba8b8,
+    0x87625f056c7c4a8b, 0x11471cd764ad4973, 0xa93af6c6c79b5d2d, 0xd598e40d3dd89bd0,
+    0xd389b47879823479, 0x4aff1d108d4ec2c4, 0x843610cb4bf160cb, 0xcedf722a585139bb,
+    0xa54394fe1eedb8fe, 0xc2974eb4ee658829, 0xce947a3da6a9273e, 0x733d226229feea33,
+    0x811ccc668829b887, 0x0806357d5a3f5260, 0xa163ff802a3426a8, 0xca07c2dcb0cf26f8,
+    0xc9bcff6034c13052, 0xfc89b393dd02f0b6, 0xfc2c3f3841f17c67, 0xbbac2078d443ace3,
+    0x9d9ba7832936edc0, 0xd54b944b84aa4c0e, 0xc5029163f384a931, 0x0a9e795e65d4df12,
+    0xf64335bcf065d37d, 0x4d4617b5ff4a16d6, 0x99ea0196163fa42e, 0x504bced1bf8e4e46,
+    0xc06481fb9bcf8d39, 0xe45ec2862f71e1d7, 0xf07da27a82c37088, 0x5d767327bb4e5a4d,
+    0x964e858c91ba2655, 0x3a6a07f8d510f870, 0xbbe226efb628afea, 0x890489f70a55368c,
+    0xeadab0aba3b2dbe5, 0x2b45ac74ccea842f, 0x92c8ae6b464fc96f, 0x3b0b8bc90012929e,
+    0xb77ada0617e3bbcb, 0x09ce6ebb40173745, 0xe55990879ddcaabd, 0xcc420a6a101d0516,
+    0x8f57fa54c2a9eab6, 0x9fa946824a12232e, 0xb32df8e9f3546564, 0x47939822dc96abfa,
+    0xdff9772470297ebd, 0x59787e2b93bc56f8, 0x8bfbea76c619ef36, 0x57eb4edb3c55b65b,
+    0xaefae51477a06b03, 0xede622920b6b23f2, 0xdab99e59958885c4, 0xe95fab368e45ecee,
+    0x88b402f7fd75539b, 0x11dbcb0218ebb415, 0xaae103b5fcd2a881, 0xd652bdc29f26a11a,
+    0xd59944a37c0752a2, 0x4be76d3346f04960, 0x857fcae62d8493a5, 0x6f70a4400c562ddc,
+    0xa6dfbd9fb8e5b88e, 0xcb4ccd500f6bb953, 0xd097ad07a71f26b2, 0x7e2000a41346a7a8,
+    0x825ecc24c873782f, 0x8ed400668c0c28c9, 0xa2f67f2dfa90563b, 0x728900802f0f32fb,
+    0xcbb41ef979346bca, 0x4f2b40a03ad2ffba, 0xfea126b7d78186bc, 0xe2f610c84987bfa9,
+    0x9f24b832e6b0f436, 0x0dd9ca7d2df4d7ca, 0xc6ede63fa05d3143, 0x91503d1c79720dbc,
+    0xf8a95fcf88747d94, 0x75a44c6397ce912b, 0x9b69dbe1b548ce7c, 0xc986afbe3ee11abb,
+    0xc24452da229b021b, 0xfbe85badce996169, 0xf2d56790ab41c2a2, 0xfae27299423fb9c4,
+    0x97c560ba6b0919a5, 0xdccd879fc967d41b, 0xbdb6b8e905cb600f, 0x5400e987bbc1c921,
+    0xed246723473e3813, 0x290123e9aab23b69, 0x9436c0760c86e30b, 0xf9a0b6720aaf6522,
+    0xb94470938fa89bce, 0xf808e40e8d5b3e6a, 0xe7958cb87392c2c2, 0xb60b1d1230b20e05,
+    0x90bd77f3483bb9b9, 0xb1c6f22b5e6f48c3, 0xb4ecd5f01a4aa828, 0x1e38aeb6360b1af4,
+    0xe2280b6c20dd5232, 0x25c6da63c38de1b1, 0x8d590723948a535f, 0x579c487e5a38ad0f,
+    0xb0af48ec79ace837, 0x2d835a9df0c6d852, 0xdcdb1b2798182244, 0xf8e431456cf88e66,
+    0x8a08f0f8bf0f156b, 0x1b8e9ecb641b5900, 0xac8b2d36eed2dac5, 0xe272467e3d222f40,
+    0xd7adf884aa879177, 0x5b0ed81dcc6abb10, 0x86ccbb52ea94baea, 0x98e947129fc2b4ea,
+    0xa87fea27a539e9a5, 0x3f2398d747b36225, 0xd29fe4b18e88640e, 0x8eec7f0d19a03aae,
+    0x83a3eeeef9153e89, 0x1953cf68300424ad, 0xa48ceaaab75a8e2b, 0x5fa8c3423c052dd8,
+    0xcdb02555653131b6, 0x3792f412cb06794e, 0x808e17555f3ebf11, 0xe2bbd88bbee40bd1,
+    0xa0b19d2ab70e6ed6, 0x5b6aceaeae9d0ec5, 0xc8de047564d20a8b, 0xf245825a5a445276,
+    0xfb158592be068d2e, 0xeed6e2f0f0d56713, 0x9ced737bb6c4183d, 0x55464dd69685606c,
+    0xc428d05aa4751e4c, 0xaa97e14c3c26b887, 0xf53304714d9265df, 0xd53dd99f4b3066a9,
+    0x993fe2c6d07b7fab, 0xe546a8038efe402a, 0xbf8fdb78849a5f96, 0xde98520472bdd034,
+    0xef73d256a5c0f77c, 0x963e66858f6d4441, 0x95a8637627989aad, 0xdde7001379a44aa9,
+    0xbb127c53b17ec159, 0x5560c018580d5d53, 0xe9d71b689dde71af, 0xaab8f01e6e10b4a7,
+    0x9226712162ab070d, 0xcab3961304ca70e9, 0xb6b00d69bb55c8d1, 0x3d607b97c5fd0d23,
+    0xe45c10c42a2b3b05, 0x8cb89a7db77c506b, 0x8eb98a7a9a5b04e3, 0x77f3608e92adb243,
+    0xb267ed1940f1c61c, 0x55f038b237591ed4, 0xdf01e85f912e37a3, 0x6b6c46dec52f6689,
+    0x8b61313bbabce2c6, 0x2323ac4b3b3da016, 0xae397d8aa96c1b77, 0xabec975e0a0d081b,
+    0xd9c7dced53c72255, 0x96e7bd358c904a22, 0x881cea14545c7575, 0x7e50d64177da2e55,
+    0xaa242499697392d2, 0xdde50bd1d5d0b9ea, 0xd4ad2dbfc3d07787, 0x955e4ec64b44e865,
+    0x84ec3c97da624ab4, 0xbd5af13bef0b113f, 0xa6274bbdd0fadd61, 0xecb1ad8aeacdd58f,
+    0xcfb11ead453994ba, 0x67de18eda5814af3, 0x81ceb32c4b43fcf4, 0x80eacf948770ced8,
+    0xa2425ff75e14fc31, 0xa1258379a94d028e, 0xcad2f7f5359a3b3e, 0x096ee45813a04331,
+    0xfd87b5f28300ca0d, 0x8bca9d6e188853fd, 0x9e74d1b791e07e48, 0x775ea264cf55347e,
+    0xc612062576589dda, 0x95364afe032a819e, 0xf79687aed3eec551, 0x3a83ddbd83f52205,
+    0x9abe14cd44753b52, 0xc4926a9672793543, 0xc16d9a0095928a27, 0x75b7053c0f178294,
+    0xf1c90080baf72cb1, 0x5324c68b12dd6339, 0x971da05074da7bee, 0xd3f6fc16ebca5e04,
+    0xbce5086492111aea, 0x88f4bb1ca6bcf585, 0xec1e4a7db69561a5, 0x2b31e9e3d06c32e6,
+    0x9392ee8e921d5d07, 0x3aff322e62439fd0, 0xb877aa3236a4b449, 0x09befeb9fad487c3,
+    0xe69594bec44de15b, 0x4c2ebe687989a9b4, 0x901d7cf73ab0acd9, 0x0f9d37014bf60a11,
+    0xb424dc35095cd80f, 0x538484c19ef38c95, 0xe12e13424bb40e13, 0x2865a5f206b06fba,
+    0x8cbccc096f5088cb, 0xf93f87b7442e45d4, 0xafebff0bcb24aafe, 0xf78f69a51539d749,
+    0xdbe6fecebdedd5be, 0xb573440e5a884d1c, 0x89705f4136b4a597, 0x31680a88f8953031,
+    0xabcc77118461cefc, 0xfdc20d2b36ba7c3e, 0xd6bf94d5e57a42bc, 0x3d32907604691b4d,
+    0x8637bd05af6c69b5, 0xa63f9a49c2c1b110, 0xa7c5ac471b478423, 0x0fcf80dc33721d54,
+    0xd1b71758e219652b, 0xd3c36113404ea4a9, 0x83126e978d4fdf3b, 0x645a1cac083126ea,
+    0xa3d70a3d70a3d70a, 0x3d70a3d70a3d70a4, 0xcccccccccccccccc, 0xcccccccccccccccd,
+    0x8000000000000000, 0x0000000000000001, 0xa000000000000000, 0x0000000000000001,
+    0xc800000000000000, 0x0000000000000001, 0xfa00000000000000, 0x0000000000000001,
+    0x9c40000000000000, 0x0000000000000001, 0xc350000000000000, 0x0000000000000001,
+    0xf424000000000000, 0x0000000000000001, 0x9896800000000000, 0x0000000000000001,
+    0xbebc200000000000, 0x0000000000000001, 0xee6b280000000000, 0x0000000000000001,
+    0x9502f90000000000, 0x0000000000000001, 0xba43b74000000000, 0x0000000000000001,
+    0xe8d4a51000000000, 0x0000000000000001, 0x9184e72a00000000, 0x0000000000000001,
+    0xb5e620f480000000, 0x0000000000000001, 0xe35fa931a0000000, 0x0000000000000001,
+    0x8e1bc9bf04000000, 0x0000000000000001, 0xb1a2bc2ec5000000, 0x0000000000000001,
+    0xde0b6b3a76400000, 0x0000000000000001, 0x8ac7230489e80000, 0x0000000000000001,
+    0xad78ebc5ac620000, 0x0000000000000001, 0xd8d726b7177a8000, 0x0000000000000001,
+    0x878678326eac9000, 0x0000000000000001, 0xa968163f0a57b400, 0x0000000000000001,
+    0xd3c21bcecceda100, 0x0000000000000001, 0x84595161401484a0, 0x0000000000000001,
+    0xa56fa5b99019a5c8, 0x0000000000000001, 0xcecb8f27f4200f3a, 0x0000000000000001,
+    0x813f3978f8940984, 0x4000000000000001, 0xa18f07d736b90be5, 0x5000000000000001,
+    0xc9f2c9cd04674ede, 0xa400000000000001, 0xfc6f7c4045812296, 0x4d00000000000001,
+    0x9dc5ada82b70b59d, 0xf020000000000001, 0xc5371912364ce305, 0x6c28000000000001,
+    0xf684df56c3e01bc6, 0xc732000000000001, 0x9a130b963a6c115c, 0x3c7f400000000001,
+    0xc097ce7bc90715b3, 0x4b9f100000000001, 0xf0bdc21abb48db20, 0x1e86d40000000001,
+    0x96769950b50d88f4, 0x1314448000000001, 0xbc143fa4e250eb31, 0x17d955a000000001,
+    0xeb194f8e1ae525fd, 0x5dcfab0800000001, 0x92efd1b8d0cf37be, 0x5aa1cae500000001,
+    0xb7abc627050305ad, 0xf14a3d9e40000001, 0xe596b7b0c643c719, 0x6d9ccd05d0000001,
+    0x8f7e32ce7bea5c6f, 0xe4820023a2000001, 0xb35dbf821ae4f38b, 0xdda2802c8a800001,
+    0xe0352f62a19e306e, 0xd50b2037ad200001, 0x8c213d9da502de45, 0x4526f422cc340001,
+    0xaf298d050e4395d6, 0x9670b12b7f410001, 0xdaf3f04651d47b4c, 0x3c0cdd765f114001,
+    0x88d8762bf324cd0f, 0xa5880a69fb6ac801, 0xab0e93b6efee0053, 0x8eea0d047a457a01,
+    0xd5d238a4abe98068, 0x72a4904598d6d881, 0x85a36366eb71f041, 0x47a6da2b7f864751,
+    0xa70c3c40a64e6c51, 0x999090b65f67d925, 0xd0cf4b50cfe20765, 0xfff4b4e3f741cf6e,
+    0x82818f1281ed449f, 0xbff8f10e7a8921a5, 0xa321f2d7226895c7, 0xaff72d52192b6a0e,
+    0xcbea6f8ceb02bb39, 0x9bf4f8a69f764491, 0xfee50b7025c36a08, 0x02f236d04753d5b5,
+    0x9f4f2726179a2245, 0x01d762422c946591, 0xc722f0ef9d80aad6, 0x424d3ad2b7b97ef6,
+    0xf8ebad2b84e0d58b, 0xd2e0898765a7deb3, 0x9b934c3b330c8577, 0x63cc55f49f88eb30,
+    0xc2781f49ffcfa6d5, 0x3cbf6b71c76b25fc, 0xf316271c7fc3908a, 0x8bef464e3945ef7b,
+    0x97edd871cfda3a56, 0x97758bf0e3cbb5ad, 0xbde94e8e43d0c8ec, 0x3d52eeed1cbea318,
+    0xed63a231d4c4fb27, 0x4ca7aaa863ee4bde, 0x945e455f24fb1cf8, 0x8fe8caa93e74ef6b,
+    0xb975d6b6ee39e436, 0xb3e2fd538e122b45, 0xe7d34c64a9c85d44, 0x60dbbca87196b617,
+    0x90e40fbeea1d3a4a, 0xbc8955e946fe31ce, 0xb51d13aea4a488dd, 0x6babab6398bdbe42,
+    0xe264589a4dcdab14, 0xc696963c7eed2dd2, 0x8d7eb76070a08aec, 0xfc1e1de5cf543ca3,
+    0xb0de65388cc8ada8, 0x3b25a55f43294bcc, 0xdd15fe86affad912, 0x49ef0eb713f39ebf,
+    0x8a2dbf142dfcc7ab, 0x6e3569326c784338, 0xacb92ed9397bf996, 0x49c2c37f07965405,
+    0xd7e77a8f87daf7fb, 0xdc33745ec97be907, 0x86f0ac99b4e8dafd, 0x69a028bb3ded71a4,
+    0xa8acd7c0222311bc, 0xc40832ea0d68ce0d, 0xd2d80db02aabd62b, 0xf50a3fa490c30191,
+    0x83c7088e1aab65db, 0x792667c6da79e0fb, 0xa4b8cab1a1563f52, 0x577001b891185939,
+    0xcde6fd5e09abcf26, 0xed4c0226b55e6f87, 0x80b05e5ac60b6178, 0x544f8158315b05b5,
+    0xa0dc75f1778e39d6, 0x696361ae3db1c722, 0xc913936dd571c84c, 0x03bc3a19cd1e38ea,
+    0xfb5878494ace3a5f, 0x04ab48a04065c724, 0x9d174b2dcec0e47b, 0x62eb0d64283f9c77,
+    0xc45d1df942711d9a, 0x3ba5d0bd324f8395, 0xf5746577930d6500, 0xca8f44ec7ee3647a,
+    0x9968bf6abbe85f20, 0x7e998b13cf4e1ecc, 0xbfc2ef456ae276e8, 0x9e3fedd8c321a67f,
+    0xefb3ab16c59b14a2, 0xc5cfe94ef3ea101f, 0x95d04aee3b80ece5, 0xbba1f1d158724a13,
+    0xbb445da9ca61281f, 0x2a8a6e45ae8edc98, 0xea1575143cf97226, 0xf52d09d71a3293be,
+    0x924d692ca61be758, 0x593c2626705f9c57, 0xb6e0c377cfa2e12e, 0x6f8b2fb00c77836d,
+    0xe498f455c38b997a, 0x0b6dfb9c0f956448, 0x8edf98b59a373fec, 0x4724bd4189bd5ead,
+    0xb2977ee300c50fe7, 0x58edec91ec2cb658, 0xdf3d5e9bc0f653e1, 0x2f2967b66737e3ee,
+    0x8b865b215899f46c, 0xbd79e0d20082ee75, 0xae67f1e9aec07187, 0xecd8590680a3aa12,
+    0xda01ee641a708de9, 0xe80e6f4820cc9496, 0x884134fe908658b2, 0x3109058d147fdcde,
+    0xaa51823e34a7eede, 0xbd4b46f0599fd416, 0xd4e5e2cdc1d1ea96, 0x6c9e18ac7007c91b,
+    0x850fadc09923329e, 0x03e2cf6bc604ddb1, 0xa6539930bf6bff45, 0x84db8346b786151d,
+    0xcfe87f7cef46ff16, 0xe612641865679a64, 0x81f14fae158c5f6e, 0x4fcb7e8f3f60c07f,
+    0xa26da3999aef7749, 0xe3be5e330f38f09e, 0xcb090c8001ab551c, 0x5cadf5bfd3072cc6,
+    0xfdcb4fa002162a63, 0x73d9732fc7c8f7f7, 0x9e9f11c4014dda7e, 0x2867e7fddcdd9afb,
+    0xc646d63501a1511d, 0xb281e1fd541501b9, 0xf7d88bc24209a565, 0x1f225a7ca91a4227,
+    0x9ae757596946075f, 0x3375788de9b06959, 0xc1a12d2fc3978937, 0x0052d6b1641c83af,
+    0xf209787bb47d6b84, 0xc0678c5dbd23a49b, 0x9745eb4d50ce6332, 0xf840b7ba963646e1,
+    0xbd176620a501fbff, 0xb650e5a93bc3d899, 0xec5d3fa8ce427aff, 0xa3e51f138ab4cebf,
+    0x93ba47c980e98cdf, 0xc66f336c36b10138, 0xb8a8d9bbe123f017, 0xb80b0047445d4185,
+    0xe6d3102ad96cec1d, 0xa60dc059157491e6, 0x9043ea1ac7e41392, 0x87c89837ad68db30,
+    0xb454e4a179dd1877, 0x29babe4598c311fc, 0xe16a1dc9d8545e94, 0xf4296dd6fef3d67b,
+    0x8ce2529e2734bb1d, 0x1899e4a65f58660d, 0xb01ae745b101e9e4, 0x5ec05dcff72e7f90,
+    0xdc21a1171d42645d, 0x76707543f4fa1f74, 0x899504ae72497eba, 0x6a06494a791c53a9,
+    0xabfa45da0edbde69, 0x0487db9d17636893, 0xd6f8d7509292d603, 0x45a9d2845d3c42b7,
+    0x865b86925b9bc5c2, 0x0b8a2392ba45a9b3, 0xa7f26836f282b732, 0x8e6cac7768d7141f,
+    0xd1ef0244af2364ff, 0x3207d795430cd927, 0x8335616aed761f1f, 0x7f44e6bd49e807b9,
+    0xa402b9c5a8d3a6e7, 0x5f16206c9c6209a7, 0xcd036837130890a1, 0x36dba887c37a8c10,
+    0x802221226be55a64, 0xc2494954da2c978a, 0xa02aa96b06deb0fd, 0xf2db9baa10b7bd6d,
+    0xc83553c5c8965d3d, 0x6f92829494e5acc8, 0xfa42a8b73abbf48c, 0xcb772339ba1f17fa,
+    0x9c69a97284b578d7, 0xff2a760414536efc, 0xc38413cf25e2d70d, 0xfef5138519684abb,
+    0xf46518c2ef5b8cd1, 0x7eb258665fc25d6a, 0x98bf2f79d5993802, 0xef2f773ffbd97a62,
+    0xbeeefb584aff8603, 0xaafb550ffacfd8fb, 0xeeaaba2e5dbf6784, 0x95ba2a53f983cf39,
+    0x952ab45cfa97a0b2, 0xdd945a747bf26184, 0xba756174393d88df, 0x94f971119aeef9e5,
+    0xe912b9d1478ceb17, 0x7a37cd5601aab85e, 0x91abb422ccb812ee, 0xac62e055c10ab33b,
+    0xb616a12b7fe617aa, 0x577b986b314d600a, 0xe39c49765fdf9d94, 0xed5a7e85fda0b80c,
+    0x8e41ade9fbebc27d, 0x14588f13be847308, 0xb1d219647ae6b31c, 0x596eb2d8ae258fc9,
+    0xde469fbd99a05fe3, 0x6fca5f8ed9aef3bc, 0x8aec23d680043bee, 0x25de7bb9480d5855,
+    0xada72ccc20054ae9, 0xaf561aa79a10ae6b, 0xd910f7ff28069da4, 0x1b2ba1518094da05,
+    0x87aa9aff79042286, 0x90fb44d2f05d0843, 0xa99541bf57452b28, 0x353a1607ac744a54,
+    0xd3fa922f2d1675f2, 0x42889b8997915ce9, 0x847c9b5d7c2e09b7, 0x69956135febada12,
+    0xa59bc234db398c25, 0x43fab9837e699096, 0xcf02b2c21207ef2e, 0x94f967e45e03f4bc,
+    0x8161afb94b44f57d, 0x1d1be0eebac278f6, 0xa1ba1ba79e1632dc, 0x6462d92a69731733,
+    0xca28a291859bbf93, 0x7d7b8f7503cfdcff, 0xfcb2cb35e702af78, 0x5cda735244c3d43f,
+    0x9defbf01b061adab, 0x3a0888136afa64a8, 0xc56baec21c7a1916, 0x088aaa1845b8fdd1,
+    0xf6c69a72a3989f5b, 0x8aad549e57273d46, 0x9a3c2087a63f6399, 0x36ac54e2f678864c,
+    0xc0cb28a98fcf3c7f, 0x84576a1bb416a7de, 0xf0fdf2d3f3c30b9f, 0x656d44a2a11c51d6,
+    0x969eb7c47859e743, 0x9f644ae5a4b1b326, 0xbc4665b596706114, 0x873d5d9f0dde1fef,
+    0xeb57ff22fc0c7959, 0xa90cb506d155a7eb, 0x9316ff75dd87cbd8, 0x09a7f12442d588f3,
+    0xb7dcbf5354e9bece, 0x0c11ed6d538aeb30, 0xe5d3ef282a242e81, 0x8f1668c8a86da5fb,
+    0x8fa475791a569d10, 0xf96e017d694487bd, 0xb38d92d760ec4455, 0x37c981dcc395a9ad,
+    0xe070f78d3927556a, 0x85bbe253f47b1418, 0x8c469ab843b89562, 0x93956d7478ccec8f,
+    0xaf58416654a6babb, 0x387ac8d1970027b3, 0xdb2e51bfe9d0696a, 0x06997b05fcc0319f,
+    0x88fcf317f22241e2, 0x441fece3bdf81f04, 0xab3c2fddeeaad25a, 0xd527e81cad7626c4,
+    0xd60b3bd56a5586f1, 0x8a71e223d8d3b075, 0x85c7056562757456, 0xf6872d5667844e4a,
+    0xa738c6bebb12d16c, 0xb428f8ac016561dc, 0xd106f86e69d785c7, 0xe13336d701beba53,
+    0x82a45b450226b39c, 0xecc0024661173474, 0xa34d721642b06084, 0x27f002d7f95d0191,
+    0xcc20ce9bd35c78a5, 0x31ec038df7b441f5, 0xff290242c83396ce, 0x7e67047175a15272,
+    0x9f79a169bd203e41, 0x0f0062c6e984d387, 0xc75809c42c684dd1, 0x52c07b78a3e60869,
+    0xf92e0c3537826145, 0xa7709a56ccdf8a83, 0x9bbcc7a142b17ccb, 0x88a66076400bb692,
+    0xc2abf989935ddbfe, 0x6acff893d00ea436, 0xf356f7ebf83552fe, 0x0583f6b8c4124d44,
+    0x98165af37b2153de, 0xc3727a337a8b704b, 0xbe1bf1b059e9a8d6, 0x744f18c0592e4c5d,
+    0xeda2ee1c7064130c, 0x1162def06f79df74, 0x9485d4d1c63e8be7, 0x8addcb5645ac2ba9,
+    0xb9a74a0637ce2ee1, 0x6d953e2bd7173693, 0xe8111c87c5c1ba99, 0xc8fa8db6ccdd0438,
+    0x910ab1d4db9914a0, 0x1d9c9892400a22a3, 0xb54d5e4a127f59c8, 0x2503beb6d00cab4c,
+    0xe2a0b5dc971f303a, 0x2e44ae64840fd61e, 0x8da471a9de737e24, 0x5ceaecfed289e5d3,
+    0xb10d8e1456105dad, 0x7425a83e872c5f48, 0xdd50f1996b947518, 0xd12f124e28f7771a,
+    0x8a5296ffe33cc92f, 0x82bd6b70d99aaa70, 0xace73cbfdc0bfb7b, 0x636cc64d1001550c,
+    0xd8210befd30efa5a, 0x3c47f7e05401aa4f, 0x8714a775e3e95c78, 0x65acfaec34810a72,
+    0xa8d9d1535ce3b396, 0x7f1839a741a14d0e, 0xd31045a8341ca07c, 0x1ede48111209a051,
+    0x83ea2b892091e44d, 0x934aed0aab460433, 0xa4e4b66b68b65d60, 0xf81da84d56178540,
+    0xce1de40642e3f4b9, 0x36251260ab9d668f, 0x80d2ae83e9ce78f3, 0xc1d72b7c6b42601a,
+    0xa1075a24e4421730, 0xb24cf65b8612f820, 0xc94930ae1d529cfc, 0xdee033f26797b628,
+    0xfb9b7cd9a4a7443c, 0x169840ef017da3b2, 0x9d412e0806e88aa5, 0x8e1f289560ee864f,
+    0xc491798a08a2ad4e, 0xf1a6f2bab92a27e3, 0xf5b5d7ec8acb58a2, 0xae10af696774b1dc,
+    0x9991a6f3d6bf1765, 0xacca6da1e0a8ef2a, 0xbff610b0cc6edd3f, 0x17fd090a58d32af4,
+    0xeff394dcff8a948e, 0xddfc4b4cef07f5b1, 0x95f83d0a1fb69cd9, 0x4abdaf101564f98f,
+    0xbb764c4ca7a4440f, 0x9d6d1ad41abe37f2, 0xea53df5fd18d5513, 0x84c86189216dc5ee,
+    0x92746b9be2f8552c, 0x32fd3cf5b4e49bb5, 0xb7118682dbb66a77, 0x3fbc8c33221dc2a2,
+    0xe4d5e82392a40515, 0x0fabaf3feaa5334b, 0x8f05b1163ba6832d, 0x29cb4d87f2a7400f,
+    0xb2c71d5bca9023f8, 0x743e20e9ef511013, 0xdf78e4b2bd342cf6, 0x914da9246b255417,
+    0x8bab8eefb6409c1a, 0x1ad089b6c2f7548f, 0xae9672aba3d0c320, 0xa184ac2473b529b2,
+    0xda3c0f568cc4f3e8, 0xc9e5d72d90a2741f, 0x8865899617fb1871, 0x7e2fa67c7a658893,
+    0xaa7eebfb9df9de8d, 0xddbb901b98feeab8, 0xd51ea6fa85785631, 0x552a74227f3ea566,
+    0x8533285c936b35de, 0xd53a88958f872760, 0xa67ff273b8460356, 0x8a892abaf368f138,
+    0xd01fef10a657842c, 0x2d2b7569b0432d86, 0x8213f56a67f6b29b, 0x9c3b29620e29fc74,
+    0xa298f2c501f45f42, 0x8349f3ba91b47b90, 0xcb3f2f7642717713, 0x241c70a936219a74,
+    0xfe0efb53d30dd4d7, 0xed238cd383aa0111, 0x9ec95d1463e8a506, 0xf4363804324a40ab,
+    0xc67bb4597ce2ce48, 0xb143c6053edcd0d6, 0xf81aa16fdc1b81da, 0xdd94b7868e94050b,
+    0x9b10a4e5e9913128, 0xca7cf2b4191c8327, 0xc1d4ce1f63f57d72, 0xfd1c2f611f63a3f1,
+    0xf24a01a73cf2dccf, 0xbc633b39673c8ced, 0x976e41088617ca01, 0xd5be0503e085d814,
+    0xbd49d14aa79dbc82, 0x4b2d8644d8a74e19, 0xec9c459d51852ba2, 0xddf8e7d60ed1219f,
+    0x93e1ab8252f33b45, 0xcabb90e5c942b504, 0xb8da1662e7b00a17, 0x3d6a751f3b936244,
+    0xe7109bfba19c0c9d, 0x0cc512670a783ad5, 0x906a617d450187e2, 0x27fb2b80668b24c6,
+    0xb484f9dc9641e9da, 0xb1f9f660802dedf7, 0xe1a63853bbd26451, 0x5e7873f8a0396974,
+    0x8d07e33455637eb2, 0xdb0b487b6423e1e9, 0xb049dc016abc5e5f, 0x91ce1a9a3d2cda63,
+    0xdc5c5301c56b75f7, 0x7641a140cc7810fc, 0x89b9b3e11b6329ba, 0xa9e904c87fcb0a9e,
+    0xac2820d9623bf429, 0x546345fa9fbdcd45, 0xd732290fbacaf133, 0xa97c177947ad4096,
+    0x867f59a9d4bed6c0, 0x49ed8eabcccc485e, 0xa81f301449ee8c70, 0x5c68f256bfff5a75,
+    0xd226fc195c6a2f8c, 0x73832eec6fff3112, 0x83585d8fd9c25db7, 0xc831fd53c5ff7eac,
+    0xa42e74f3d032f525, 0xba3e7ca8b77f5e56, 0xcd3a1230c43fb26f, 0x28ce1bd2e55f35ec,
+    0x80444b5e7aa7cf85, 0x7980d163cf5b81b4, 0xa0555e361951c366, 0xd7e105bcc3326220,
+    0xc86ab5c39fa63440, 0x8dd9472bf3fefaa8, 0xfa856334878fc150, 0xb14f98f6f0feb952,
+    0x9c935e00d4b9d8d2, 0x6ed1bf9a569f33d4, 0xc3b8358109e84f07, 0x0a862f80ec4700c9,
+    0xf4a642e14c6262c8, 0xcd27bb612758c0fb, 0x98e7e9cccfbd7dbd, 0x8038d51cb897789d,
+    0xbf21e44003acdd2c, 0xe0470a63e6bd56c4, 0xeeea5d5004981478, 0x1858ccfce06cac75,
+    0x95527a5202df0ccb, 0x0f37801e0c43ebc9, 0xbaa718e68396cffd, 0xd30560258f54e6bb,
+    0xe950df20247c83fd, 0x47c6b82ef32a206a, 0x91d28b7416cdd27e, 0x4cdc331d57fa5442,
+    0xb6472e511c81471d, 0xe0133fe4adf8e953, 0xe3d8f9e563a198e5, 0x58180fddd97723a7,
+    0x8e679c2f5e44ff8f, 0x570f09eaa7ea7649, 0xb201833b35d63f73, 0x2cd2cc6551e513db,
+    0xde81e40a034bcf4f, 0xf8077f7ea65e58d2, 0x8b112e86420f6191, 0xfb04afaf27faf783,
+    0xadd57a27d29339f6, 0x79c5db9af1f9b564, 0xd94ad8b1c7380874, 0x18375281ae7822bd,
+    0x87cec76f1c830548, 0x8f2293910d0b15b6, 0xa9c2794ae3a3c69a, 0xb2eb3875504ddb23,
+    0xd433179d9c8cb841, 0x5fa60692a46151ec, 0x849feec281d7f328, 0xdbc7c41ba6bcd334,
+    0xa5c7ea73224deff3, 0x12b9b522906c0801, 0xcf39e50feae16bef, 0xd768226b34870a01,
+    0x81842f29f2cce375, 0xe6a1158300d46641, 0xa1e53af46f801c53, 0x60495ae3c1097fd1,
+    0xca5e89b18b602368, 0x385bb19cb14bdfc5, 0xfcf62c1dee382c42, 0x46729e03dd9ed7b6,
+    0x9e19db92b4e31ba9, 0x6c07a2c26a8346d2};
+
+/* (g * cp) / 2^128, with the lowest bit set if the result is not an integer.
+   g is bigger than the actual power of ten by less than 1, so a result that is an integer has at most 1 in the
+   bits below the result. */
+static uint64_t print_RoundToOdd(const uint64_t* g, uint64_t cp) {
+    tmc_U128 low = tmc_Multiply64(g[1], cp);
+    tmc_U128 high = tmc_Multiply64(g[0], cp);
+    high.low += low.high;
+    if (high.low < low.high) {
+        ++high.high;
+    }
+    return high.high | (high.low > 1);
+}
+
+/* Shortest decimal that rounds to value, see the paper for the details. */
+static void print_ShortestDecimal(print_BinaryFloat value, tmc_Decimal* out) {
+    uint64_t c = value.mantissa;
+    int32_t q = value.exponent;
+    if (c == 0) {
+        print_DecimalFromU64(out, 0, 0);
+        return;
+    }
+
+    /* Integers that fit into the mantissa need all of their digits, neighbouring floats are at most 1 apart. */
+    if (q <= 0 && q > -64 && (c & (((uint64_t)1 << -q) - 1)) == 0) {
+        print_DecimalFromU64(out, c >> -q, 0);
+        return;
+    }
+
+    /* Value and the bounds of the rounding interval times 4, so that they are integers. */
+    uint64_t cbl = 4 * c - 2 + (uint64_t)value.lowerBoundaryIsCloser;
+    uint64_t cb = 4 * c;
+    uint64_t cbr = 4 * c + 2;
+
+    /* k = floor(log10(2^q)), or floor(log10(3/4 * 2^q)) if the lower boundary is closer.
+       h = q + floor(log2(10^-k)) + 1 is between 1 and 4. */
+    int32_t k = print_FloorDivPow2(q * 1262611 - ((value.lowerBoundaryIsCloser) ? 524031 : 0), 22);
+    int32_t h = q + print_FloorDivPow2(-k * 1741647, 19) + 1;
+    TM_ASSERT(-k >= print_SmallestPowerOfTen && -k <= 324);
+    TM_ASSERT(h >= 1 && h <= 4);
+
+    const uint64_t* g = &print_PowersOfTen128[2 * (-k - print_SmallestPowerOfTen)];
+    uint64_t vbl = print_RoundToOdd(g, cbl << h);
+    uint64_t vb = print_RoundToOdd(g, cb << h);
+    uint64_t vbr = print_RoundToOdd(g, cbr << h);
+
+    /* Bounds are part of the interval if the mantissa is even, since ties round to even when scanning. */
+    tm_bool isEven = (c & 1) == 0;
+    uint64_t lower = vbl + !isEven;
+    uint64_t upper = vbr - !isEven;
+
+    /* Try one digit less first, if only one of the two candidates is inside, it is the shortest. */
+    uint64_t s = vb >> 2;
+    if (s >= 10) {
+        uint64_t sp = s / 10;
+        tm_bool upInside = lower <= 40 * sp;
+        tm_bool wpInside = 40 * sp + 40 <= upper;
+        if (upInside != wpInside) {
+            print_DecimalFromU64(out, (wpInside) ? sp + 1 : sp, k + 1);
+            return;
+        }
+    }
+
+    tm_bool uInside = lower <= 4 * s;
+    tm_bool wInside = 4 * s + 4 <= upper;
+    if (uInside != wInside) {
+        print_DecimalFromU64(out, (wInside) ? s + 1 : s, k);
+        return;
+    }
+
+    /* Both are inside, pick the closer one. */
+    uint64_t mid = 4 * s + 2;
+    tm_bool roundUp = vb > mid || (vb == mid && (s & 1));
+    print_DecimalFromU64(out, (roundUp) ? s + 1 : s, k);
+}
+
+static tmc_conv_result print_NonFinite(char* dest, tm_size_t maxlen, tm_bool negative, tm_bool isNan, uint32_t flags) {
+    const char* str = NULL;
+    if (flags & PF_LOWERCASE) {
+        str = (isNan) ? "nan" : "inf";
+    } else {
+        str = (isNan) ? "NAN" : "INF";
+    }
+
+    tm_size_t size = (tm_size_t)negative + 3;
+    if (size > maxlen) {
+        tmc_conv_result result = {maxlen, TM_EOVERFLOW};
+        return result;
+    }
+    if (negative) {
+        *dest++ = '-';
+    }
+    TM_MEMCPY(dest, str, 3);
+    tmc_conv_result result = {size, TM_OK};
+    return result;
+}
 
-                TM_MEMSET(dest, '0', precision);
-                maxlen -= precision;
+static tmc_conv_result print_FormatFloat(char* dest, tm_size_t maxlen, print_BinaryFloat value, tm_bool negative,
+                                         uint32_t flags, int32_t precision) {
+    uint32_t format = flags & (PF_FIXED | PF_SCIENTIFIC);
+    tm_bool general = format == (PF_FIXED | PF_SCIENTIFIC);
+    tm_bool scientific = format == PF_SCIENTIFIC;
+    if (precision > TMC_MAX_PRECISION) {
+        precision = TMC_MAX_PRECISION;
+    }
+
+    tmc_Decimal decimal;
+    int32_t fractionDigits = 0;
+    if (precision < 0) {
+        print_ShortestDecimal(value, &decimal);
+        if (general) {
+            /* Same choice as printf %g with the default precision. */
+            int32_t exponent = (decimal.count > 0) ? decimal.decimalPoint - 1 : 0;
+            scientific = exponent < -4 || exponent >= 6;
+        }
+        if (!scientific && value.exponent > 0) {
+            /* Every fixed representation of a big integer has the same length, so the exact value is the closest
+               representation that round trips. */
+            print_ExactDecimal(value, &decimal);
+        }
+        fractionDigits = (int32_t)decimal.count - ((scientific) ? 1 : decimal.decimalPoint);
+        if (fractionDigits <= 0) {
+            fractionDigits = (flags & PF_TRAILING_ZEROES) ? 1 : 0;
+        }
+    } else {
+        if (general) {
+            int32_t significantDigits = (precision > 0) ? precision : 1;
+            print_SignificantDecimal(value, significantDigits, &decimal);
+            int32_t exponent = (decimal.count > 0) ? decimal.decimalPoint - 1 : 0;
+            scientific = exponent < -4 || exponent >= significantDigits;
+            fractionDigits = (scientific) ? significantDigits - 1 : significantDigits - 1 - exponent;
+        } else if (scientific) {
+            print_SignificantDecimal(value, precision + 1, &decimal);
+            fractionDigits = precision;
+        } else {
+            print_FixedDecimal(value, precision, &decimal);
+            fractionDigits = precision;
+        }
+        if ((flags & PF_SHORTEST) && !(flags & PF_TRAILING_ZEROES)) {
+            int32_t needed = (int32_t)decimal.count - ((scientific) ? 1 : decimal.decimalPoint);
+            if (fractionDigits > needed) {
+                fractionDigits = (needed > 0) ? needed : 0;
             }
         }
     }
 
-    tmc_conv_result result = {start - maxlen, ec};
+    int32_t exponent = 0;
+    tm_size_t exponentSize = 0;
+    tm_size_t integerSize = 1;
+    if (scientific) {
+        exponent = (decimal.count > 0) ? decimal.decimalPoint - 1 : 0;
+        exponentSize = 2 + get_digits_count_decimal_u32((uint32_t)((exponent < 0) ? -exponent : exponent));
+        /* Exponent has at least two digits, like printf. */
+        if (exponentSize < 4) {
+            exponentSize = 4;
+        }
+    } else if (decimal.count > 0 && decimal.decimalPoint > 0) {
+        integerSize = (tm_size_t)decimal.decimalPoint;
+    }
+    tm_size_t size = (tm_size_t)negative + integerSize + exponentSize;
+    if (fractionDigits > 0) {
+        size += (tm_size_t)fractionDigits + 1;
+    }
+    if (size > maxlen) {
+        tmc_conv_result result = {maxlen, TM_EOVERFLOW};
+        return result;
+    }
+
+    char* p = dest;
+    if (negative) {
+        *p++ = '-';
+    }
+    /* Digits are written relative to the decimal point, digits outside of decimal are zeroes. */
+    int32_t point = (scientific) ? 1 : decimal.decimalPoint;
+    if (point > 0) {
+        for (int32_t i = 0; i < point; ++i) {
+            *p++ = (i < (int32_t)decimal.count) ? (char)('0' + decimal.digits[i]) : '0';
+        }
+    } else {
+        *p++ = '0';
+    }
+    if (fractionDigits > 0) {
+        *p++ = '.';
+        for (int32_t i = point; i < point + fractionDigits; ++i) {
+            *p++ = (i >= 0 && i < (int32_t)decimal.count) ? (char)('0' + decimal.digits[i]) : '0';
+        }
+    }
+    if (scientific) {
+        *p++ = (flags & PF_LOWERCASE) ? 'e' : 'E';
+        *p++ = (exponent < 0) ? '-' : '+';
+        tm_size_t exponentDigits = exponentSize - 2;
+        p += tmc_print_zero_padded_u64(p, exponentDigits, exponentDigits,
+                                       (uint64_t)((exponent < 0) ? -exponent : exponent)).size;
+    }
+    TM_ASSERT(p == dest + size);
+
+    tmc_conv_result result = {size, TM_OK};
     return result;
 }
-tmc_conv_result print_float(char* dest, tm_size_t maxlen, float value, uint32_t flags, int32_t precision) {
-    return print_double(dest, maxlen, (double)value, flags, precision);
+
+TMC_DEF tmc_conv_result print_double(char* dest, tm_size_t maxlen, double value, uint32_t flags, int32_t precision) {
+    TM_ASSERT(dest);
+    TM_ASSERT_VALID_SIZE(maxlen);
+
+    tm_bool negative = ((flags & PF_SIGNBIT) && TM_SIGNBIT(value)) || (value < 0);
+    if (TM_ISNAN(value) || TM_ISINF(value)) {
+        return print_NonFinite(dest, maxlen, negative, TM_ISNAN(value), flags);
+    }
+    return print_FormatFloat(dest, maxlen, print_DecomposeDouble(value), negative, flags, precision);
+}
+TMC_DEF tmc_conv_result print_float(char* dest, tm_size_t maxlen, float value, uint32_t flags, int32_t precision) {
+    TM_ASSERT(dest);
+    TM_ASSERT_VALID_SIZE(maxlen);
+
+    tm_bool negative = ((flags & PF_SIGNBIT) && TM_SIGNBIT(value)) || (value < 0);
+    if (TM_ISNAN(value) || TM_ISINF(value)) {
+        return print_NonFinite(dest, maxlen, negative, TM_ISNAN(value), flags);
+    }
+    return print_FormatFloat(dest, maxlen, print_DecomposeFloat(value), negative, flags, precision);
+}
+
+TMC_DEF tmc_conv_result print_i64_array(char* dest, tm_size_t maxlen, const int64_t* values, tm_size_t count,
+                                        char separator) {
+    TM_ASSERT_VALID_SIZE(maxlen);
+    TM_ASSERT(dest || maxlen == 0);
+    TM_ASSERT(values || count == 0);
+
+    tmc_conv_result result = {0, TM_OK};
+    for (tm_size_t i = 0; i < count; ++i) {
+        int64_t value = values[i];
+        uint64_t magnitude = (value < 0) ? (0 - (uint64_t)value) : (uint64_t)value;
+        /* The digits count is needed anyway, so the whole value and separator are checked against maxlen at once. */
+        tm_size_t digits = get_digits_count_decimal_u64(magnitude);
+        tm_size_t size = digits + (value < 0) + (i + 1 < count);
+        if (size > maxlen - result.size) {
+            result.size = maxlen;
+            result.ec = TM_EOVERFLOW;
+            return result;
+        }
+        char* p = dest + result.size;
+        if (value < 0) {
+            *p++ = '-';
+        }
+        print_decimal_u64_w(p, digits, digits, magnitude);
+        if (i + 1 < count) {
+            p[digits] = separator;
+        }
+        result.size += size;
+    }
+    return result;
+}
+TMC_DEF tmc_conv_result print_u64_array(char* dest, tm_size_t maxlen, const uint64_t* values, tm_size_t count,
+                                        char separator) {
+    TM_ASSERT_VALID_SIZE(maxlen);
+    TM_ASSERT(dest || maxlen == 0);
+    TM_ASSERT(values || count == 0);
+
+    tmc_conv_result result = {0, TM_OK};
+    for (tm_size_t i = 0; i < count; ++i) {
+        tm_size_t digits = get_digits_count_decimal_u64(values[i]);
+        tm_size_t size = digits + (i + 1 < count);
+        if (size > maxlen - result.size) {
+            result.size = maxlen;
+            result.ec = TM_EOVERFLOW;
+            return result;
+        }
+        char* p = dest + result.size;
+        print_decimal_u64_w(p, digits, digits, values[i]);
+        if (i + 1 < count) {
+            p[digits] = separator;
+        }
+        result.size += size;
+    }
+    return result;
+}
+TMC_DEF tmc_conv_result print_double_array(char* dest, tm_size_t maxlen, const double* values, tm_size_t count,
+                                           char separator, uint32_t flags, int32_t precision) {
+    TM_ASSERT_VALID_SIZE(maxlen);
+    TM_ASSERT(dest || maxlen == 0);
+    TM_ASSERT(values || count == 0);
+
+    tmc_conv_result result = {0, TM_OK};
+    for (tm_size_t i = 0; i < count; ++i) {
+        /* print_double needs a destination, so a full (or missing) buffer is handled here. */
+        if (result.size >= maxlen) {
+            result.size = maxlen;
+            result.ec = TM_EOVERFLOW;
+            return result;
+        }
+        tmc_conv_result value = print_double(dest + result.size, maxlen - result.size, values[i], flags, precision);
+        if (value.ec != TM_OK) {
+            result.size = maxlen;
+            result.ec = value.ec;
+            return result;
+        }
+        result.size += value.size;
+        if (i + 1 < count) {
+            if (result.size >= maxlen) {
+                result.size = maxlen;
+                result.ec = TM_EOVERFLOW;
+                return result;
+            }
+            dest[result.size++] = separator;
+        }
+    }
+    return result;
 }
 
 #if defined(_MSC_VER) && !defined(__cplusplus)
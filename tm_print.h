@@ -1,5 +1,5 @@
 /*
-tm_print.h v0.0.22 - public domain - https://github.com/to-miz/tm
+tm_print.h v0.0.28 - public domain - https://github.com/to-miz/tm
 Author: Tolga Mizrak 2020
 
 No warranty; use at your own risk.
@@ -52,6 +52,21 @@ DESCRIPTION
         For bool:
         'n':        Outputs booleans as a number (either '0' or '1').
 
+    Format strings that are string literals can be parsed at compile time by wrapping them in TMP_FMT:
+        print(TMP_FMT("This is a placeholder: {}!"), "Hello");
+    The format string is then split into literal runs and placeholders once at compile time, so printing doesn't need
+    to parse it again. Placeholder indices and format specifiers are checked against the argument types with
+    static_assert, so a specifier like 'x' used on a double is a compile error instead of being silently ignored.
+    Needs C++14 constexpr support, define TMP_NO_COMPILE_TIME_FORMAT to disable it.
+
+    Format strings that are only known at runtime, like ones loaded from configuration files, can be parsed once
+    with compile_format and then printed many times without parsing them again:
+        auto compiled = compile_format<int, double>("{},{:.2f}\n");
+        if (compiled.ec == TM_OK) print(compiled.format, 1, 2.0);
+        tmp_destroy_compiled_format(&compiled.format);
+    The argument types are validated once by compile_format. Printing only checks that the types of the arguments
+    are the ones the format was compiled for.
+
 SWITCHES
     TMP_STRING_WIDTH:
         Represents a function with this signature:
@@ -74,6 +89,18 @@ SWITCHES
         A slightly better implementation can be found in <tm_unicode.h> as tmu_utf8_width_n for UTF-8 encoded strings,
         which uses sensible defaults for widths that are common when displayed.
 
+    TMP_SCRATCH_ARENA:
+        Printing into FILE* handles and std::string first prints into an intermediate buffer, which is the small
+        buffer on the stack or an allocation sized by estimating the output size from the arguments.
+        Define TMP_SCRATCH_ARENA to print into a buffer per thread instead, which is kept between calls so that
+        long output doesn't need to allocate every time. Needs thread_local support.
+        Define TMP_SCRATCH_ARENA_MAX_SIZE to limit how big the kept buffer can get, bigger buffers are freed after
+        the call that needed them (default 64 KiB).
+
+    TMP_NO_FD_SINK:
+        Disables tmp_make_fd_sink, which uses write from <unistd.h> or _write from <io.h> on Windows.
+        Alternatively define TMP_WRITE(fd, data, size) to use a different write function.
+
 ISSUES
     - The tm_conversion/charconv based implementation always outputs '.' as the decimal point character
       regardless of the locale, while the snprintf based output outputs the decimal point based on the
@@ -84,6 +111,16 @@ ISSUES
     - Types that are implicitly convertible to string_view produce errors currently.
 
 HISTORY
+    v0.0.28 19.10.26 Added TMP_SCRATCH_ARENA for printing into a buffer per thread that is reused between calls.
+                     Printing into FILE* and std::string sizes its buffer up front from the arguments.
+    v0.0.27 19.10.26 Added TMP_FLOAT_BACKEND_BUILTIN for correctly rounded and shortest round trip float output
+                     without dependencies.
+    v0.0.26 19.10.26 Lifted the limit of 16 arguments per print call.
+    v0.0.25 19.10.26 Added tmp_compiled_format for parsing format strings at runtime once and printing many times.
+    v0.0.24 19.10.26 Added tmp_output_sink for printing into buffers, files and file descriptors without an
+                     intermediate buffer.
+    v0.0.23 19.10.26 Added TMP_FMT for parsing format strings at compile time.
+                     Fixed escaped '}}' before a placeholder being mistaken for the end of the placeholder.
     v0.0.22 30.05.19 Fixed linking error due to missing inline specifier.
     v0.0.21 30.05.19 Made error codes depend on <errno.h> by default.
     v0.0.20 03.05.19 Added static asserts to sanity check tm_conversion.h backend print flags compatibility.
@@ -195,13 +232,16 @@ HISTORY
             TMP_INT_BACKEND_CHARCONV           needs C++17/20 standard library, but postprocessing needed after printing
         Floating point values (float, double):
             TMP_FLOAT_BACKEND_CRT              might not do correct rounding, locale dependent
-            TMP_FLOAT_BACKEND_TM_CONVERSION    very inaccurate, hex and scientific printing not implemented yet
+            TMP_FLOAT_BACKEND_TM_CONVERSION    correctly rounded and shortest output, hex printing not implemented yet
             TMP_FLOAT_BACKEND_CHARCONV         needs C++17/20 standard library, probably fast and accurate
+            TMP_FLOAT_BACKEND_BUILTIN          no dependencies, correctly rounded, a negative precision prints the
+                                               shortest representation that round trips
     */
     #if !defined(TMP_INT_BACKEND_CRT) && !defined(TMP_INT_BACKEND_TM_CONVERSION) && !defined(TMP_INT_BACKEND_CHARCONV)
         #define TMP_INT_BACKEND_CRT
     #endif
-    #if !defined(TMP_FLOAT_BACKEND_CRT) && !defined(TMP_FLOAT_BACKEND_TM_CONVERSION) && !defined(TMP_FLOAT_BACKEND_CHARCONV)
+    #if !defined(TMP_FLOAT_BACKEND_CRT) && !defined(TMP_FLOAT_BACKEND_TM_CONVERSION) && !defined(TMP_FLOAT_BACKEND_CHARCONV) \
+        && !defined(TMP_FLOAT_BACKEND_BUILTIN)
         #define TMP_FLOAT_BACKEND_CRT
     #endif
 
@@ -209,7 +249,8 @@ HISTORY
         #error "Only one backend for int is allowed."
     #endif
 
-    #if defined(TMP_FLOAT_BACKEND_CRT) + defined(TMP_FLOAT_BACKEND_TM_CONVERSION) + defined(TMP_FLOAT_BACKEND_CHARCONV) != 1
+    #if defined(TMP_FLOAT_BACKEND_CRT) + defined(TMP_FLOAT_BACKEND_TM_CONVERSION) + defined(TMP_FLOAT_BACKEND_CHARCONV) \
+        + defined(TMP_FLOAT_BACKEND_BUILTIN) != 1
         #error "Only one backend for float is allowed."
     #endif
 
@@ -227,6 +268,22 @@ HISTORY
         #include <cinttypes>
     #endif
 
+    #ifdef TMP_FLOAT_BACKEND_BUILTIN
+        /* Native bools, override by defining TM_BOOL_DEFINED yourself before including this file. */
+        #ifndef TM_BOOL_DEFINED
+            #define TM_BOOL_DEFINED
+            #ifdef __cplusplus
+                typedef bool tm_bool;
+                #define TM_TRUE true
+                #define TM_FALSE false
+            #else
+                typedef _Bool tm_bool;
+                #define TM_TRUE 1
+                #define TM_FALSE 0
+            #endif
+        #endif /* !defined(TM_BOOL_DEFINED) */
+    #endif
+
     #if defined(TMP_INT_BACKEND_CHARCONV) || defined(TMP_FLOAT_BACKEND_CHARCONV)
         #define TMP_CHARCONV_INCLUDED
         #include <charconv>
@@ -253,17 +310,48 @@ HISTORY
         #define TMP_TOUPPER toupper
     #endif
 
+    #if !defined(TMP_NO_FD_SINK) && !defined(TMP_WRITE)
+        #ifdef _WIN32
+            #include <io.h>
+            #define TMP_WRITE(fd, data, size) _write((fd), (data), (unsigned int)(size))
+        #else
+            #include <unistd.h>
+            #define TMP_WRITE(fd, data, size) write((fd), (data), (size_t)(size))
+        #endif
+    #endif
+
     // The buffer size used for small buffer optimization, change this by profiling if malloc is a bottleneck.
     #ifndef TMP_SBO_SIZE
         #define TMP_SBO_SIZE 200
     #endif  // !defined( TMP_SBO_SIZE )
+
+    // Printing into FILE* and std::string uses a buffer per thread that is kept between calls if TMP_SCRATCH_ARENA is
+    // defined. Buffers that grew bigger than TMP_SCRATCH_ARENA_MAX_SIZE are freed after the call.
+    #ifdef TMP_SCRATCH_ARENA
+        #ifndef TM_THREAD_LOCAL
+            #ifdef __cplusplus
+                #define TM_THREAD_LOCAL thread_local
+            #elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_THREADS__)
+                #define TM_THREAD_LOCAL _Thread_local
+            #elif defined(__GNUC__) || defined(__clang__) || defined(__MINGW32__) || defined(__SUNPRO_C) || defined(__xlC__)
+                #define TM_THREAD_LOCAL __thread
+            #elif defined(_WIN32) && (defined(_MSC_VER) || defined(__ICL) || defined(__DMC__) || defined(__BORLANDC__))
+                #define TM_THREAD_LOCAL __declspec(thread)
+            #else
+                #error "Unsupported platform for TM_THREAD_LOCAL"
+            #endif
+        #endif
+        #ifndef TMP_SCRATCH_ARENA_MAX_SIZE
+            #define TMP_SCRATCH_ARENA_MAX_SIZE 65536
+        #endif
+    #endif
 #endif
 
 
 #ifndef _TM_PRINT_H_INCLUDED_14E73C89_58CA_4CC4_9D19_99F0A3D7EA07_
 #define _TM_PRINT_H_INCLUDED_14E73C89_58CA_4CC4_9D19_99F0A3D7EA07_
 
-#define TMP_VERSION 0x00000016u
+#define TMP_VERSION 0x0000001Cu
 
 /* assert */
 #ifndef TM_ASSERT
@@ -334,6 +422,13 @@ HISTORY
     #define TMP_DEFAULT_FLAGS 0u
 #endif
 
+#if !defined(TMP_NO_COMPILE_TIME_FORMAT) && defined(__cpp_constexpr) && __cpp_constexpr >= 201304L
+    #define TMP_COMPILE_TIME_FORMAT
+    #define TMP_CONSTEXPR14 constexpr
+#else
+    #define TMP_CONSTEXPR14
+#endif
+
 // clang-format on
 
 namespace tml {
@@ -372,7 +467,7 @@ struct PrintFormat {
     unsigned int flags;
 };
 
-inline PrintFormat default_print_format() { return PrintFormat{10, 6, 0, PrintFlags::Default}; }
+inline TMP_CONSTEXPR14 PrintFormat default_print_format() { return PrintFormat{10, 6, 0, PrintFlags::Default}; }
 
 namespace PrintType {
 enum Values : uint64_t {
@@ -445,8 +540,24 @@ union PrintValue {
 
 struct PrintArgList {
     PrintValue* args;
-    uint64_t flags;
+    uint64_t flags;  // Types of the first PrintType::Count arguments, PrintType::Bits per argument.
     unsigned int size;
+    // Types of all arguments if there are more than PrintType::Count arguments, nullptr otherwise.
+    const unsigned char* types;
+};
+
+inline uint64_t tmp_get_arg_type(const PrintArgList& args, unsigned int index) {
+    TM_ASSERT(index < args.size);
+    if (args.types) return args.types[index];
+    return (args.flags >> (index * PrintType::Bits)) & PrintType::Mask;
+}
+
+// A preparsed part of a format string, either a run of literal characters or a placeholder.
+struct tmp_format_segment {
+    tm_size_t offset;    // Literal run: Offset into the format string.
+    tm_size_t size;      // Literal run: Length of the run.
+    int arg_index;       // Placeholder: Index of the argument to print, -1 for literal runs.
+    PrintFormat format;  // Placeholder: Format specifiers already resolved.
 };
 
 /*
@@ -457,8 +568,8 @@ Params:
     dest:   Output buffer. Can be nullptr iff len == 0.
     len:    Output buffer length.
     format: Format string. See DESCRIPTION for an explanation of how format strings are structured.
-    args:   Variadic arguments to be used when formatting. There can't be more than PrintFlags::Count
-            variadic arguments (by default this is 16). Use more than one call to snprint when needed instead.
+    args:   Variadic arguments to be used when formatting. Up to PrintType::Count (16) arguments have their types
+            packed into a single integer, more arguments use an additional static array of types.
 Result:
     Return value conforms to ::snprintf.
     Returns used size, if used size is < len.
@@ -503,11 +614,417 @@ TMP_DEF int tmp_snprint(char* dest, tm_size_t len, TM_STRING_VIEW format, const
 TMP_DEF tm_size_t tmp_parse_print_format(const char* format_specifiers, tm_size_t format_specifiers_len,
                                          PrintFormat* out);
 
+/*
+Output sinks:
+Printing into a sink formats directly into the buffer of the sink, without an intermediate buffer and without
+calling into the CRT on every print. Writer sinks only write out buffered output when the buffer is full or when
+tmp_flush_sink is called.
+    tmp_make_buffer_sink:   Prints into a fixed buffer, printing fails with TM_ERANGE when output doesn't fit.
+    tmp_make_growable_sink: Prints into an allocated buffer that grows as needed, free it with tmp_destroy_sink.
+    tmp_make_writer_sink:   Buffers output and calls write when the buffer is full.
+    tmp_make_file_sink:     Writer sink that writes into a FILE* handle, the stdio lock is taken once per flush.
+    tmp_make_fd_sink:       Writer sink that writes into a file descriptor using write, bypassing stdio entirely.
+A failed print leaves the sink as it was, except for writer sinks that already wrote out part of the output.
+Values that don't fit into the buffer of a writer sink at all are printed into a temporary allocation.
+Sinks are not thread safe, use one sink per thread.
+*/
+typedef tm_errc tmp_sink_write_proc(void* context, const char* data, tm_size_t size);
+
+struct tmp_output_sink {
+    char* data;
+    tm_size_t size;  // Amount of buffered output that wasn't written out yet.
+    tm_size_t capacity;
+    tmp_sink_write_proc* write;  // Writes out buffered output, nullptr if the sink doesn't write anywhere.
+    void* context;
+    bool growable;  // Whether data is allocated and owned by the sink.
+};
+
+TMP_DEF tmp_output_sink tmp_make_buffer_sink(char* buffer, tm_size_t capacity);
+TMP_DEF tmp_output_sink tmp_make_growable_sink();
+TMP_DEF tmp_output_sink tmp_make_writer_sink(char* buffer, tm_size_t capacity, tmp_sink_write_proc* write,
+                                             void* context);
+#ifndef TMP_NO_CRT_FILE_PRINTING
+TMP_DEF tmp_output_sink tmp_make_file_sink(FILE* out, char* buffer, tm_size_t capacity);
+#endif
+#ifndef TMP_NO_FD_SINK
+TMP_DEF tmp_output_sink tmp_make_fd_sink(int fd, char* buffer, tm_size_t capacity);
+#endif
+// Writes out buffered output of writer sinks. Does nothing for other sinks.
+TMP_DEF tm_errc tmp_flush_sink(tmp_output_sink* sink);
+// Frees the buffer of growable sinks. Buffered output of writer sinks is not flushed.
+TMP_DEF void tmp_destroy_sink(tmp_output_sink* sink);
+
+TMP_DEF tm_errc tmp_print(tmp_output_sink* sink, const char* format, size_t format_len,
+                          const PrintFormat& initial_formatting, const PrintArgList& args);
+
+// Format string that was parsed at runtime and validated against argument types, see compile_format.
+struct tmp_compiled_format {
+    char* format;  // Copy of the format string, segments point into it.
+    tmp_format_segment* segments;
+    tm_size_t segments_count;
+    uint64_t types;  // Packed argument types that the format was validated against, see PrintArgList::flags.
+    unsigned char* extended_types;  // Types of all arguments if there are more than PrintType::Count arguments.
+    unsigned int args_count;
+};
+
+struct tmp_compile_format_result {
+    tmp_compiled_format format;
+    tm_errc ec;
+};
+
+/*
+Parses a format string into a tmp_compiled_format and validates placeholders against argument types.
+Use the compile_format template instead to get the types from template arguments.
+Params:
+    initial_formatting: Formatting used for placeholders without format specifiers.
+    types:              Packed argument types, see PrintArgList::flags.
+    extended_types:     Types of all arguments if there are more than PrintType::Count, see PrintArgList::types.
+    args_count:         Number of arguments.
+Result:
+    TM_EINVAL if the format string is malformed or doesn't match the argument types, TM_ENOMEM if allocation failed.
+    The compiled format must be freed with tmp_destroy_compiled_format.
+*/
+TMP_DEF tmp_compile_format_result tmp_compile_format(const char* format, tm_size_t format_len,
+                                                     const PrintFormat& initial_formatting, uint64_t types,
+                                                     const unsigned char* extended_types, unsigned int args_count);
+TMP_DEF void tmp_destroy_compiled_format(tmp_compiled_format* format);
+
+// Printing from preparsed format segments, see tmp_parse_format_segments.
+// Segments are not validated against the arguments, this must be done when making the segments.
+#ifndef TMP_NO_CRT_FILE_PRINTING
+TMP_DEF tm_errc tmp_print_segments(FILE* out, const char* format, const tmp_format_segment* segments,
+                                   tm_size_t segments_count, const PrintArgList& args);
+#endif
+TMP_DEF tm_errc tmp_print_segments(tmp_output_sink* sink, const char* format, const tmp_format_segment* segments,
+                                   tm_size_t segments_count, const PrintArgList& args);
+TMP_DEF int tmp_snprint_segments(char* dest, tm_size_t len, const char* format, const tmp_format_segment* segments,
+                                 tm_size_t segments_count, const PrintArgList& args);
+#ifdef TMP_USE_STL
+TMP_DEF ::std::string tmp_string_format_segments(const char* format, const tmp_format_segment* segments,
+                                                 tm_size_t segments_count, const PrintArgList& args);
+#endif
+
 #ifdef TMP_USE_STL
 TMP_DEF ::std::string tmp_string_format(const char* format, size_t format_len, const PrintFormat& initial_formatting,
                                         const PrintArgList& args);
 #endif
 
+// Format string parsing shared by runtime printing and compile time parsed format strings (see TMP_FMT).
+// These are constexpr when TMP_COMPILE_TIME_FORMAT is defined.
+
+inline TMP_CONSTEXPR14 tm_size_t tmp_scan_decimal_u32(const char* first, const char* last, uint32_t* out) {
+    uint32_t value = 0;
+    const char* p = first;
+    for (; p < last && *p >= '0' && *p <= '9'; ++p) {
+        uint32_t digit = (uint32_t)(*p - '0');
+        // Overflow is treated the same as no digits at all.
+        if (value > (0xFFFFFFFFu - digit) / 10) return 0;
+        value = value * 10 + digit;
+    }
+    if (p != first) *out = value;
+    return (tm_size_t)(p - first);
+}
+
+inline TMP_CONSTEXPR14 tm_size_t tmp_parse_print_format_internal(const char* format_specifiers,
+                                                                 tm_size_t format_specifiers_len, PrintFormat* out) {
+    *out = default_print_format();
+    unsigned int flags = PrintFlags::Default;
+
+    // Pad with spaces by default.
+    flags |= PrintFlags::PadWithSpaces;
+
+    const char* p = format_specifiers;
+    const char* last = p + format_specifiers_len;
+
+    bool pound_specified = false;
+
+    for (bool parseFlags = true; p < last && parseFlags;) {
+        switch (*p) {
+            case '-': {
+                flags |= PrintFlags::LeftJustify;
+                ++p;
+                break;
+            }
+            case '+': {
+                flags |= PrintFlags::Sign;
+                ++p;
+                break;
+            }
+            case ' ': {
+                flags |= PrintFlags::PadWithSpaces;
+                ++p;
+                break;
+            }
+            case '#': {
+                pound_specified = true;
+                ++p;
+                break;
+            }
+            case '0': {
+                flags &= ~PrintFlags::PadWithSpaces;
+                ++p;
+                break;
+            }
+            default: {
+                parseFlags = false;
+                break;
+            }
+        }
+    }
+
+    // Parse width.
+    uint32_t width = (uint32_t)out->width;
+    p += tmp_scan_decimal_u32(p, last, &width);
+    out->width = (int)width;
+
+    // Parse precision.
+    if (p < last && *p == '.') {
+        ++p;
+        uint32_t precision = (uint32_t)out->precision;
+        p += tmp_scan_decimal_u32(p, last, &precision);
+        out->precision = (int)precision;
+    }
+
+    if (p < last) {
+        switch (*p) {
+            case 'x': {
+                flags |= PrintFlags::Lowercase;
+                out->base = 16;
+                if (pound_specified) flags |= PrintFlags::PrependHex;
+                ++p;
+                break;
+            }
+            case 'X': {
+                out->base = 16;
+                if (pound_specified) flags |= PrintFlags::PrependHex;
+                ++p;
+                break;
+            }
+            case 'o': {
+                out->base = 8;
+                if (pound_specified) flags |= PrintFlags::PrependOctal;
+                ++p;
+                break;
+            }
+            case 'b': {
+                flags |= PrintFlags::Lowercase;
+                out->base = 2;
+                if (pound_specified) flags |= PrintFlags::PrependBinary;
+                ++p;
+                break;
+            }
+            case 'B': {
+                out->base = 2;
+                if (pound_specified) flags |= PrintFlags::PrependBinary;
+                ++p;
+                break;
+            }
+            case 'c': {
+                flags |= PrintFlags::Char;
+                ++p;
+                break;
+            }
+
+            // floating point
+            case 'e': {
+                flags |= PrintFlags::Lowercase;
+                flags |= PrintFlags::Scientific;
+                ++p;
+                break;
+            }
+            case 'E': {
+                flags |= PrintFlags::Scientific;
+                ++p;
+                break;
+            }
+            case 'f': {
+                flags |= PrintFlags::TrailingZeroes | PrintFlags::Fixed;
+                ++p;
+                break;
+            }
+            case 'g': {
+                flags |= PrintFlags::Lowercase;
+                flags |= PrintFlags::General;
+                flags |= PrintFlags::Shortest;
+                ++p;
+                break;
+            }
+            case 'G': {
+                flags |= PrintFlags::General;
+                flags |= PrintFlags::Shortest;
+                ++p;
+                break;
+            }
+            case 'a': {
+                flags |= PrintFlags::Lowercase;
+                flags |= PrintFlags::Hex;
+                if (pound_specified) flags |= PrintFlags::PrependHex;
+                ++p;
+                break;
+            }
+            case 'A': {
+                flags |= PrintFlags::Hex;
+                if (pound_specified) flags |= PrintFlags::PrependHex;
+                ++p;
+                break;
+            }
+
+            // Non printf.
+            case 'n': {
+                flags |= PrintFlags::BoolAsNumber;
+                ++p;
+                break;
+            }
+        }
+    }
+
+    out->flags = flags;
+    return (tm_size_t)(p - format_specifiers);
+}
+
+struct tmp_parse_format_result {
+    tm_size_t count;
+    tm_errc ec;
+};
+
+inline TMP_CONSTEXPR14 void tmp_push_format_segment(tmp_parse_format_result* result, tmp_format_segment* out,
+                                                    tm_size_t out_len, const tmp_format_segment& segment) {
+    if (out && result->count < out_len) out[result->count] = segment;
+    ++result->count;
+}
+
+inline TMP_CONSTEXPR14 void tmp_push_format_literal(tmp_parse_format_result* result, tmp_format_segment* out,
+                                                    tm_size_t out_len, const char* format, const char* first,
+                                                    const char* last) {
+    if (first >= last) return;
+    tmp_format_segment segment = {(tm_size_t)(first - format), (tm_size_t)(last - first), -1, PrintFormat{}};
+    tmp_push_format_segment(result, out, out_len, segment);
+}
+
+/*
+Splits a format string into literal runs and placeholders.
+Escaped '{{' and '}}' become part of the literal runs, placeholders without format specifiers use initial_formatting.
+Params:
+    out:     Output segments, can be nullptr to only count the segments.
+    out_len: Capacity of out. Segments that don't fit are counted but not written.
+Result:
+    Number of segments and TM_EINVAL if there are unmatched '{' or '}'.
+*/
+inline TMP_CONSTEXPR14 tmp_parse_format_result tmp_parse_format_segments(const char* format, tm_size_t format_len,
+                                                                         const PrintFormat& initial_formatting,
+                                                                         tmp_format_segment* out, tm_size_t out_len) {
+    tmp_parse_format_result result = {0, TM_OK};
+
+    PrintFormat placeholder_format = initial_formatting;
+    // Sanitize flags.
+    placeholder_format.flags &= ((1u << PrintFlags::Count) - 1);
+
+    uint32_t next_index = 0;
+    const char* first = format;
+    const char* p = format;
+    const char* last = format + format_len;
+    while (p < last) {
+        if (*p != '{' && *p != '}') {
+            ++p;
+            continue;
+        }
+
+        if (p + 1 < last && p[1] == *p) {
+            // Escaped brace, the first brace is kept as part of the literal run.
+            tmp_push_format_literal(&result, out, out_len, format, first, p + 1);
+            p += 2;
+            first = p;
+            continue;
+        }
+        if (*p == '}') {
+            result.ec = TM_EINVAL;
+            return result;
+        }
+
+        tmp_push_format_literal(&result, out, out_len, format, first, p);
+        const char* specifiers = p + 1;
+        const char* specifiers_last = specifiers;
+        while (specifiers_last < last && *specifiers_last != '}') ++specifiers_last;
+        if (specifiers_last >= last) {
+            result.ec = TM_EINVAL;
+            return result;
+        }
+
+        uint32_t index = next_index;
+        tm_size_t index_len = tmp_scan_decimal_u32(specifiers, specifiers_last, &index);
+        if (index_len == 0) ++next_index;
+        specifiers += index_len;
+
+        tmp_format_segment segment = {0, 0, (int)index, placeholder_format};
+        if (specifiers < specifiers_last && *specifiers == ':') {
+            ++specifiers;
+            tmp_parse_print_format_internal(specifiers, (tm_size_t)(specifiers_last - specifiers), &segment.format);
+        }
+        tmp_push_format_segment(&result, out, out_len, segment);
+
+        p = specifiers_last + 1;
+        first = p;
+    }
+    tmp_push_format_literal(&result, out, out_len, format, first, last);
+    return result;
+}
+
+enum tmp_format_check_result {
+    tmp_format_valid,
+    tmp_format_index_out_of_range,
+    tmp_format_type_mismatch,
+};
+
+// Whether the format specifiers of a placeholder make sense for the PrintType of its argument.
+inline TMP_CONSTEXPR14 bool tmp_format_matches_type(const PrintFormat& format, uint64_t type) {
+    // Flags that are set by default are not considered to be specified.
+    const unsigned int flags = format.flags & ~(unsigned int)PrintFlags::Default;
+    const unsigned int float_flags = PrintFlags::Fixed | PrintFlags::Scientific | PrintFlags::Hex;
+    const bool has_base = format.base != 10;
+    switch (type) {
+        case PrintType::Char: {
+            return !(flags & (float_flags | PrintFlags::BoolAsNumber));
+        }
+        case PrintType::Bool: {
+            return !has_base && !(flags & (float_flags | PrintFlags::Char));
+        }
+        case PrintType::Int32:
+        case PrintType::UInt32:
+        case PrintType::Int64:
+        case PrintType::UInt64: {
+            return !(flags & (float_flags | PrintFlags::Char | PrintFlags::BoolAsNumber));
+        }
+        case PrintType::Float:
+        case PrintType::Double: {
+            return !has_base && !(flags & (PrintFlags::Char | PrintFlags::BoolAsNumber));
+        }
+        case PrintType::String:
+        case PrintType::StringView: {
+            return !has_base && !(flags & (float_flags | PrintFlags::Char | PrintFlags::BoolAsNumber));
+        }
+        default: {
+            // Custom printers decide for themselves what to do with format specifiers.
+            return true;
+        }
+    }
+}
+
+// Checks placeholders against the argument types, see PrintArgList::flags and PrintArgList::types.
+inline TMP_CONSTEXPR14 int tmp_check_format_segments(const tmp_format_segment* segments, tm_size_t segments_count,
+                                                     uint64_t types, const unsigned char* extended_types,
+                                                     tm_size_t args_count) {
+    for (tm_size_t i = 0; i < segments_count; ++i) {
+        const tmp_format_segment& segment = segments[i];
+        if (segment.arg_index < 0) continue;
+        if ((tm_size_t)segment.arg_index >= args_count) return tmp_format_index_out_of_range;
+        uint64_t type = (extended_types)
+                            ? extended_types[segment.arg_index]
+                            : ((types >> ((unsigned int)segment.arg_index * PrintType::Bits)) & PrintType::Mask);
+        if (!tmp_format_matches_type(segment.format, type)) return tmp_format_type_mismatch;
+    }
+    return tmp_format_valid;
+}
+
 template <class... Types>
 struct tmp_type_flags;
 
@@ -817,9 +1334,25 @@ void fill_print_arg_list(PrintArgList*, const T&, const Types&...) {
 #endif
 inline void fill_print_arg_list(PrintArgList*) {}
 
+// Types of all arguments when they don't fit into PrintArgList::flags.
+template <class... Types>
+struct tmp_type_array {
+    static constexpr const unsigned char values[sizeof...(Types) ? sizeof...(Types) : 1] = {
+        (unsigned char)tmp_type_flags<Types>::value...};
+};
+template <class... Types>
+constexpr const unsigned char tmp_type_array<Types...>::values[sizeof...(Types) ? sizeof...(Types) : 1];
+
+template <class... Types>
+constexpr const unsigned char* tmp_extended_types() {
+    return (sizeof...(Types) > PrintType::Count) ? tmp_type_array<typename std::decay<Types>::type...>::values
+                                                 : nullptr;
+}
+
 template <class... Types>
 void make_print_arg_list(PrintArgList* list, size_t capacity, const Types&... args) {
     list->flags = tmp_type_flags<typename std::decay<Types>::type...>::value;
+    list->types = tmp_extended_types<Types...>();
     list->size = 0;
     fill_print_arg_list(list, args...);
     (void)capacity;
@@ -828,6 +1361,7 @@ void make_print_arg_list(PrintArgList* list, size_t capacity, const Types&... ar
 template <class... Types>
 void make_print_arg_list(PrintArgList* list, size_t capacity) {
     list->flags = 0;
+    list->types = nullptr;
     list->size = 0;
     (void)capacity;
     TM_ASSERT(list->size == capacity);
@@ -835,10 +1369,9 @@ void make_print_arg_list(PrintArgList* list, size_t capacity) {
 
 // Wrapper to an arguments list array on the stack.
 // The array size is a ternary expression so that the argument list also works with zero arguments.
-#define TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args)                                              \
-    static_assert(sizeof...(args) <= PrintType::Count, "Invalid number of arguments to print"); \
-    PrintValue values[sizeof...(args) ? sizeof...(args) : 1];                                   \
-    PrintArgList arg_list = {values, /*flags=*/0, /*size=*/0};                                  \
+#define TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args)                               \
+    PrintValue values[sizeof...(args) ? sizeof...(args) : 1];                    \
+    PrintArgList arg_list = {values, /*flags=*/0, /*size=*/0, /*types=*/nullptr}; \
     make_print_arg_list(&arg_list, sizeof...(args), args...);
 
 #ifndef TMP_NO_CRT_FILE_PRINTING
@@ -888,6 +1421,17 @@ tm_errc print(FILE* out, TM_STRING_VIEW format, const PrintFormat& initial_forma
 #endif  // defined(TM_STRING_VIEW)
 #endif  // TMP_NO_CRT_FILE_PRINTING
 
+template <class... Types>
+tm_errc print(tmp_output_sink* sink, const char* format, const Types&... args) {
+    TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args);
+    return tmp_print(sink, format, TM_STRLEN(format), default_print_format(), arg_list);
+}
+template <class... Types>
+tm_errc print(tmp_output_sink* sink, const char* format, const PrintFormat& initial_formatting, const Types&... args) {
+    TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args);
+    return tmp_print(sink, format, TM_STRLEN(format), initial_formatting, arg_list);
+}
+
 template <class... Types>
 int snprint(char* dest, tm_size_t len, const char* format, const Types&... args) {
     TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args);
@@ -931,6 +1475,188 @@ template <class... Types>
 #endif  // defined(TM_STRING_VIEW)
 #endif  // defined(TMP_USE_STL)
 
+template <class... Types>
+tmp_compile_format_result compile_format(const char* format, tm_size_t format_len) {
+    return tmp_compile_format(format, format_len, default_print_format(),
+                              tmp_type_flags<typename std::decay<Types>::type...>::value,
+                              tmp_extended_types<Types...>(), sizeof...(Types));
+}
+template <class... Types>
+tmp_compile_format_result compile_format(const char* format) {
+    return compile_format<Types...>(format, (tm_size_t)TM_STRLEN(format));
+}
+#ifdef TM_STRING_VIEW
+template <class... Types>
+tmp_compile_format_result compile_format(TM_STRING_VIEW format) {
+    return compile_format<Types...>(TM_STRING_VIEW_DATA(format), (tm_size_t)TM_STRING_VIEW_SIZE(format));
+}
+#endif  // defined(TM_STRING_VIEW)
+
+// Printing with a compiled format only checks whether the argument types are the ones the format was compiled for.
+inline bool tmp_compiled_format_matches(const tmp_compiled_format& format, const PrintArgList& args) {
+    if (args.flags != format.types || args.size != format.args_count) return false;
+    // Types beyond PrintType::Count are not part of flags.
+    for (unsigned int i = PrintType::Count; i < args.size; ++i) {
+        if (args.types[i] != format.extended_types[i]) return false;
+    }
+    return true;
+}
+#define TMP_INTERNAL_CHECK_COMPILED_FORMAT(format, arg_list, error) \
+    if (!tmp_compiled_format_matches((format), (arg_list))) return (error);
+
+#ifndef TMP_NO_CRT_FILE_PRINTING
+template <class... Types>
+tm_errc print(const tmp_compiled_format& format, const Types&... args) {
+    TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args);
+    TMP_INTERNAL_CHECK_COMPILED_FORMAT(format, arg_list, TM_EINVAL);
+    return tmp_print_segments(stdout, format.format, format.segments, format.segments_count, arg_list);
+}
+template <class... Types>
+tm_errc print(FILE* out, const tmp_compiled_format& format, const Types&... args) {
+    TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args);
+    TMP_INTERNAL_CHECK_COMPILED_FORMAT(format, arg_list, TM_EINVAL);
+    return tmp_print_segments(out, format.format, format.segments, format.segments_count, arg_list);
+}
+#endif  // TMP_NO_CRT_FILE_PRINTING
+
+template <class... Types>
+tm_errc print(tmp_output_sink* sink, const tmp_compiled_format& format, const Types&... args) {
+    TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args);
+    TMP_INTERNAL_CHECK_COMPILED_FORMAT(format, arg_list, TM_EINVAL);
+    return tmp_print_segments(sink, format.format, format.segments, format.segments_count, arg_list);
+}
+
+template <class... Types>
+int snprint(char* dest, tm_size_t len, const tmp_compiled_format& format, const Types&... args) {
+    TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args);
+    TMP_INTERNAL_CHECK_COMPILED_FORMAT(format, arg_list, -1);
+    return tmp_snprint_segments(dest, len, format.format, format.segments, format.segments_count, arg_list);
+}
+
+#ifdef TMP_USE_STL
+template <class... Types>
+::std::string string_format(const tmp_compiled_format& format, const Types&... args) {
+    TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args);
+    TMP_INTERNAL_CHECK_COMPILED_FORMAT(format, arg_list, ::std::string());
+    return tmp_string_format_segments(format.format, format.segments, format.segments_count, arg_list);
+}
+#endif  // defined(TMP_USE_STL)
+
+#undef TMP_INTERNAL_CHECK_COMPILED_FORMAT
+
+#ifdef TMP_COMPILE_TIME_FORMAT
+// Format string that is parsed at compile time, see TMP_FMT.
+// Str is a type with static constexpr members data() and size() that return the string literal.
+template <class Str>
+struct FormatString {};
+
+template <tm_size_t N>
+struct tmp_format_segment_array {
+    tmp_format_segment data[N];
+};
+
+template <class Str, tm_size_t N>
+constexpr tmp_format_segment_array<N> tmp_make_format_segments() {
+    tmp_format_segment_array<N> result = {};
+    tmp_parse_format_segments(Str::data(), Str::size(), default_print_format(), result.data, N);
+    return result;
+}
+
+template <class Str>
+struct tmp_format_string_segments {
+    static constexpr tmp_parse_format_result parsed =
+        tmp_parse_format_segments(Str::data(), Str::size(), default_print_format(), nullptr, 0);
+    static_assert(parsed.ec == TM_OK, "Invalid format string, there are unmatched '{' or '}'.");
+
+    static constexpr tm_size_t count = parsed.count;
+    typedef tmp_format_segment_array<(count > 0) ? count : 1> array_type;
+    static constexpr array_type segments = tmp_make_format_segments<Str, (count > 0) ? count : 1>();
+};
+template <class Str>
+constexpr tmp_parse_format_result tmp_format_string_segments<Str>::parsed;
+template <class Str>
+constexpr tm_size_t tmp_format_string_segments<Str>::count;
+template <class Str>
+constexpr typename tmp_format_string_segments<Str>::array_type tmp_format_string_segments<Str>::segments;
+
+template <class Format, class... Types>
+struct tmp_format_string_check;
+
+template <class Str, class... Types>
+struct tmp_format_string_check<FormatString<Str>, Types...> {
+    typedef tmp_format_string_segments<Str> format;
+    static constexpr int value =
+        tmp_check_format_segments(format::segments.data, format::count,
+                                  tmp_type_flags<typename std::decay<Types>::type...>::value,
+                                  tmp_extended_types<Types...>(), sizeof...(Types));
+};
+template <class Str, class... Types>
+constexpr int tmp_format_string_check<FormatString<Str>, Types...>::value;
+
+// Validates placeholders against argument types at compile time.
+#define TMP_INTERNAL_CHECK_FORMAT_STRING(Str, Types)                                                            \
+    static_assert(tmp_format_string_check<FormatString<Str>, Types...>::value != tmp_format_index_out_of_range, \
+                  "Format string has more placeholders than arguments or an index is out of range.");           \
+    static_assert(tmp_format_string_check<FormatString<Str>, Types...>::value != tmp_format_type_mismatch,      \
+                  "Format specifier can't be used with the type of its argument.");
+
+#ifndef TMP_NO_CRT_FILE_PRINTING
+template <class Str, class... Types>
+tm_errc print(FormatString<Str>, const Types&... args) {
+    TMP_INTERNAL_CHECK_FORMAT_STRING(Str, Types);
+    TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args);
+    typedef tmp_format_string_segments<Str> format;
+    return tmp_print_segments(stdout, Str::data(), format::segments.data, format::count, arg_list);
+}
+template <class Str, class... Types>
+tm_errc print(FILE* out, FormatString<Str>, const Types&... args) {
+    TMP_INTERNAL_CHECK_FORMAT_STRING(Str, Types);
+    TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args);
+    typedef tmp_format_string_segments<Str> format;
+    return tmp_print_segments(out, Str::data(), format::segments.data, format::count, arg_list);
+}
+#endif  // TMP_NO_CRT_FILE_PRINTING
+
+template <class Str, class... Types>
+tm_errc print(tmp_output_sink* sink, FormatString<Str>, const Types&... args) {
+    TMP_INTERNAL_CHECK_FORMAT_STRING(Str, Types);
+    TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args);
+    typedef tmp_format_string_segments<Str> format;
+    return tmp_print_segments(sink, Str::data(), format::segments.data, format::count, arg_list);
+}
+
+template <class Str, class... Types>
+int snprint(char* dest, tm_size_t len, FormatString<Str>, const Types&... args) {
+    TMP_INTERNAL_CHECK_FORMAT_STRING(Str, Types);
+    TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args);
+    typedef tmp_format_string_segments<Str> format;
+    return tmp_snprint_segments(dest, len, Str::data(), format::segments.data, format::count, arg_list);
+}
+
+#ifdef TMP_USE_STL
+template <class Str, class... Types>
+::std::string string_format(FormatString<Str>, const Types&... args) {
+    TMP_INTERNAL_CHECK_FORMAT_STRING(Str, Types);
+    TMP_INTERNAL_MAKE_ARG_LIST(arg_list, args);
+    typedef tmp_format_string_segments<Str> format;
+    return tmp_string_format_segments(Str::data(), format::segments.data, format::count, arg_list);
+}
+#endif  // defined(TMP_USE_STL)
+
+#undef TMP_INTERNAL_CHECK_FORMAT_STRING
+
+// Makes a FormatString out of a string literal. The string literal is wrapped in a local type, so that it can be
+// passed as a template argument.
+#define TMP_FMT(str)                                                                   \
+    [] {                                                                               \
+        struct tmp_format_literal {                                                    \
+            static constexpr const char* data() { return str; }                        \
+            static constexpr tm_size_t size() { return (tm_size_t)(sizeof(str) - 1); } \
+        };                                                                             \
+        return ::tml::FormatString<tmp_format_literal>{};                              \
+    }()
+#endif  // defined(TMP_COMPILE_TIME_FORMAT)
+
 #undef TMP_INTERNAL_MAKE_ARG_LIST
 
 #ifdef TMP_CUSTOM_PRINTING
@@ -1235,6 +1961,12 @@ static PrintFormattedResult tmp_move_printed_value_and_decorate(char* dest, tm_s
     TM_ASSERT(sizes.size >= sizes.digits);
     TM_ASSERT(sizes.decorated >= sizes.digits);
 
+    if (sizes.size > maxlen) {
+        print_result.size = sizes.size;
+        print_result.ec = TM_ERANGE;
+        return print_result;
+    }
+
     tm_size_t digits_pos = 0;
     if (width <= 0 || (format.flags & PrintFlags::LeftJustify)) {
         digits_pos = sizes.decorated - sizes.digits;
@@ -1247,12 +1979,6 @@ static PrintFormattedResult tmp_move_printed_value_and_decorate(char* dest, tm_s
             TM_MEMMOVE(dest + digits_pos, dest + sign, sizes.digits);
         }
     }
-
-    if (sizes.size > maxlen) {
-        print_result.size = sizes.size;
-        print_result.ec = TM_ERANGE;
-        return print_result;
-    }
     tmp_print_decoration(dest, maxlen, sizes, format, negative);
     print_result.size = sizes.size;
     return print_result;
@@ -1541,7 +2267,7 @@ static PrintFormattedResult tmp_print_value(char* dest, tm_size_t maxlen, double
     return print_double(dest, maxlen, value, tmp_convert_flags(format.flags), format.precision);
 }
 static PrintFormattedResult tmp_print_value(char* dest, tm_size_t maxlen, float value, const PrintFormat& format) {
-    return print_double(dest, maxlen, (double)value, tmp_convert_flags(format.flags), format.precision);
+    return print_float(dest, maxlen, value, tmp_convert_flags(format.flags), format.precision);
 }
 #endif  // defined(TMP_FLOAT_BACKEND_TM_CONVERSION)
 
@@ -1594,161 +2320,1158 @@ static PrintFormattedResult tmp_print_value(char* dest, tm_size_t maxlen, float
 }
 #endif  // defined(TMP_FLOAT_BACKEND_CHARCONV)
 
-template <class T>
-static PrintFormattedResult tmp_print_formatted(char* dest, tm_size_t maxlen, const PrintFormat& format, T value) {
-    TM_ASSERT(dest || maxlen == 0);
-    TM_ASSERT_VALID_SIZE(maxlen);
-
-    if (maxlen <= 0) return {maxlen, TM_EOVERFLOW};
-    TM_ASSERT(dest);
+#ifdef TMP_FLOAT_BACKEND_BUILTIN
+// Float backend without dependencies on the C runtime or the standard library.
+// Output with a precision is correctly rounded (round half to even) for float and double.
+// A negative precision prints the shortest representation that round trips.
+// Shortest output uses Grisu3 and falls back to exact bignum arithmetic when Grisu3 can't decide.
+// Output with a precision uses 128-bit products for common values and exact bignum arithmetic otherwise.
+
+struct tmp_float_parts {
+    uint64_t mantissa;  // Value is mantissa * 2^exponent.
+    int exponent;
+    bool lower_boundary_is_closer;  // Whether the previous value is closer than the next, i.e. at powers of two.
+    bool negative;
+    bool is_inf;
+    bool is_nan;
+};
 
-    auto pair = tmp_make_unsigned(value);
-    bool sign = pair.negative || ((format.flags & PrintFlags::Sign) != 0);
-    auto result = tmp_print_value(dest + sign, maxlen - sign, pair.value, format);
-    return tmp_move_printed_value_and_decorate(dest, maxlen, format, result, pair.negative);
+static tmp_float_parts tmp_decompose_float(double value) {
+    uint64_t bits = 0;
+    TM_MEMCPY(&bits, &value, sizeof(double));
+    const uint64_t fraction = bits & 0xFFFFFFFFFFFFFull;
+    const int biased_exponent = (int)((bits >> 52) & 0x7FF);
+
+    tmp_float_parts result = {};
+    result.negative = (bits >> 63) != 0;
+    if (biased_exponent == 0x7FF) {
+        result.is_inf = (fraction == 0);
+        result.is_nan = (fraction != 0);
+    } else if (biased_exponent == 0) {
+        result.mantissa = fraction;
+        result.exponent = -1074;
+    } else {
+        result.mantissa = fraction | (1ull << 52);
+        result.exponent = biased_exponent - 1075;
+        result.lower_boundary_is_closer = (fraction == 0 && biased_exponent > 1);
+    }
+    return result;
+}
+static tmp_float_parts tmp_decompose_float(float value) {
+    uint32_t bits = 0;
+    TM_MEMCPY(&bits, &value, sizeof(float));
+    const uint32_t fraction = bits & 0x7FFFFFu;
+    const int biased_exponent = (int)((bits >> 23) & 0xFF);
+
+    tmp_float_parts result = {};
+    result.negative = (bits >> 31) != 0;
+    if (biased_exponent == 0xFF) {
+        result.is_inf = (fraction == 0);
+        result.is_nan = (fraction != 0);
+    } else if (biased_exponent == 0) {
+        result.mantissa = fraction;
+        result.exponent = -149;
+    } else {
+        result.mantissa = fraction | (1u << 23);
+        result.exponent = biased_exponent - 150;
+        result.lower_boundary_is_closer = (fraction == 0 && biased_exponent > 1);
+    }
+    return result;
 }
 
-struct tmp_reallocate_result {
-    char* ptr;
-    tm_size_t size;
+// Decimal digits of a value, value = 0.d1d2d3... * 10^point.
+// There are no leading or trailing zeros in digits, zero has no digits.
+struct tmp_decimal {
+    char* digits;
+    int count;
+    int point;
 };
 
-struct tmp_allocator_context {
-    void* context;
-    tmp_reallocate_result (*reallocate)(void* context, char* old_ptr, tm_size_t old_size, tm_size_t new_size);
-    void (*destroy)(void* context, char* ptr, tm_size_t size);
-};
+// Enough for the exact expansion of any double and its rounding boundaries.
+enum { TMP_EXACT_DIGITS_CAPACITY = 780 };
 
-static tmp_reallocate_result tmp_allocator_default_reallocate(void* /*context*/, char* old_ptr, tm_size_t old_size,
-                                                              tm_size_t new_size) {
-    TM_ASSERT_VALID_SIZE(new_size);
+static void tmp_trim_trailing_zeros(tmp_decimal* decimal) {
+    while (decimal->count > 0 && decimal->digits[decimal->count - 1] == '0') --decimal->count;
+    if (decimal->count == 0) decimal->point = 0;
+}
 
-    tmp_reallocate_result result = {nullptr, 0};
-    if (old_ptr && old_size > 0) {
-        result.ptr = (char*)TM_REALLOC(old_ptr, new_size * sizeof(char), sizeof(char));
-    } else {
-        result.ptr = (char*)TM_MALLOC(new_size * sizeof(char), sizeof(char));
+static int tmp_write_digits(char* dest, uint64_t value) {
+    char buffer[20];
+    int count = 0;
+    do {
+        buffer[count++] = (char)('0' + (value % 10));
+        value /= 10;
+    } while (value);
+    for (int i = 0; i < count; ++i) dest[i] = buffer[count - i - 1];
+    return count;
+}
+
+// Sets decimal to value * 10^exponent.
+static void tmp_set_decimal(tmp_decimal* decimal, uint64_t value, int exponent) {
+    if (value == 0) {
+        decimal->count = 0;
+        decimal->point = 0;
+        return;
     }
-    result.size = (result.ptr) ? new_size : 0;
-    return result;
+    decimal->count = tmp_write_digits(decimal->digits, value);
+    decimal->point = decimal->count + exponent;
+    tmp_trim_trailing_zeros(decimal);
 }
-static void tmp_allocator_default_destroy(void* /*context*/, char* ptr, tm_size_t size) {
-    (void)size;
-    TM_FREE(ptr);
+
+// Rounds to the first keep digits, ties round to even.
+// Digits are exact, so any digit after a '5' means that the value is above the halfway point.
+static void tmp_round_decimal(tmp_decimal* decimal, int keep) {
+    if (keep >= decimal->count) return;
+
+    bool round_up = false;
+    if (keep >= 0) {
+        char next = decimal->digits[keep];
+        if (next != '5') {
+            round_up = next > '5';
+        } else if (keep + 1 < decimal->count) {
+            round_up = true;
+        } else {
+            round_up = keep > 0 && ((decimal->digits[keep - 1] - '0') & 1);
+        }
+    }
+
+    if (keep <= 0) {
+        // Everything is rounded away, result is either zero or one unit of the rounding position.
+        if (round_up) {
+            decimal->digits[0] = '1';
+            decimal->count = 1;
+            ++decimal->point;
+        } else {
+            decimal->count = 0;
+            decimal->point = 0;
+        }
+        return;
+    }
+
+    decimal->count = keep;
+    if (round_up) {
+        int i = keep - 1;
+        while (i >= 0 && decimal->digits[i] == '9') --i;
+        if (i < 0) {
+            decimal->digits[0] = '1';
+            decimal->count = 1;
+            ++decimal->point;
+            return;
+        }
+        ++decimal->digits[i];
+        decimal->count = i + 1;
+    }
+    tmp_trim_trailing_zeros(decimal);
 }
 
-static tmp_allocator_context tmp_default_allocator() {
-    return {nullptr, tmp_allocator_default_reallocate, tmp_allocator_default_destroy};
+static int tmp_compare_decimal(const tmp_decimal& a, const tmp_decimal& b) {
+    if (a.count == 0 || b.count == 0) return (int)(a.count != 0) - (int)(b.count != 0);
+    if (a.point != b.point) return (a.point < b.point) ? -1 : 1;
+    const int count = (a.count > b.count) ? a.count : b.count;
+    for (int i = 0; i < count; ++i) {
+        char a_digit = (i < a.count) ? a.digits[i] : '0';
+        char b_digit = (i < b.count) ? b.digits[i] : '0';
+        if (a_digit != b_digit) return (a_digit < b_digit) ? -1 : 1;
+    }
+    return 0;
 }
 
-#ifdef TMP_USE_STL
-static tmp_reallocate_result tmp_allocator_std_string_reallocate(void* context, char* /*old_ptr*/,
-                                                                 tm_size_t /*old_size*/, tm_size_t new_size) {
-    TM_ASSERT(context);
-    TM_ASSERT_VALID_SIZE(new_size);
+static const uint64_t tmp_powers_of_10[] = {
+    1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull, 1000000000ull,
+    10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull, 100000000000000ull, 1000000000000000ull,
+    10000000000000000ull, 100000000000000000ull, 1000000000000000000ull, 10000000000000000000ull};
 
-    auto str = static_cast<::std::string*>(context);
-#if 1
-    // We use two resizes, first to allocate memory, second to make use of all memory allocated.
-    str->resize((size_t)new_size);
-    str->resize(str->capacity());
-    // TODO: This requires C++17, maybe use &((*str)[0]) instead, which isn't guaranteed to be contiguous?
-    return {str->data(), (tm_size_t)str->size()};
-#else
-    str->resize((size_t)new_size);
-    return {str->data(), new_size};
-#endif
+// floor(e * log10(2)), exact for |e| <= 1650.
+static int tmp_floor_log10_pow2(int e) {
+    return (e >= 0) ? ((e * 78913) >> 18) : -((-e * 78913 + (1 << 18) - 1) >> 18);
 }
-static void tmp_allocator_std_string_destroy(void* /*context*/, char* /*ptr*/, tm_size_t /*size*/) {}
 
-static tmp_allocator_context tmp_std_string_allocator(::std::string* out) {
-    return {static_cast<void*>(out), tmp_allocator_std_string_reallocate, tmp_allocator_std_string_destroy};
+static int tmp_bit_length(uint64_t value) {
+    int result = 0;
+    while (value) {
+        value >>= 1;
+        ++result;
+    }
+    return result;
 }
-#endif /* defined(TMP_USE_STL) */
-/* See SWITCHES for how to redefine this. */
-#ifndef TMP_STRING_WIDTH
-#define TMP_STRING_WIDTH(str, str_len) (int)(str_len)
-#endif
 
-static PrintFormattedResult tmp_get_print_size(char*, tm_size_t, bool value, const PrintFormat& format) {
-    // '0' or '1' are just a single byte.
-    if (format.flags & PrintFlags::BoolAsNumber) return {1, TM_OK};
-    // The strings "true" and "false" are 4 and 5 bytes.
-    return {(tm_size_t)((value) ? 4 : 5), TM_OK};
-}
+struct tmp_uint128 {
+    uint64_t high;
+    uint64_t low;
+};
 
-template <class T>
-static PrintFormattedResult tmp_get_print_size(char* dest, tm_size_t maxlen, T value, const PrintFormat& format) {
-    // FIXME: This will fail for floating point numbers that need more than TMP_SBO_SIZE characters when supplied dest
-    // buffer isn't big enough. Should be very rare, but might be unexpected and lead to bugs.
-    // Should we allocate memory in that case?
+static tmp_uint128 tmp_multiply_u64(uint64_t a, uint64_t b) {
+    const uint64_t a_low = a & 0xFFFFFFFFu;
+    const uint64_t a_high = a >> 32;
+    const uint64_t b_low = b & 0xFFFFFFFFu;
+    const uint64_t b_high = b >> 32;
 
-    char buffer[(TMP_SBO_SIZE)];
-    if (maxlen < (tm_size_t)(TMP_SBO_SIZE)) {
-        dest = buffer;
-        maxlen = (tm_size_t)(TMP_SBO_SIZE);
-    }
-    return tmp_print_formatted(dest, maxlen, format, value);
+    const uint64_t low_low = a_low * b_low;
+    const uint64_t high_low = a_high * b_low;
+    const uint64_t low_high = a_low * b_high;
+    const uint64_t high_high = a_high * b_high;
+
+    const uint64_t cross = (low_low >> 32) + (high_low & 0xFFFFFFFFu) + low_high;
+    tmp_uint128 result = {high_high + (high_low >> 32) + (cross >> 32), (cross << 32) | (low_low & 0xFFFFFFFFu)};
+    return result;
 }
 
-struct tmp_memory_printer {
-    char* data;
-    tm_size_t size = 0;
-    tm_size_t necessary = 0;
-    tm_size_t capacity;
-    bool can_grow;
-    bool owns = false;
-    tm_errc ec = TM_OK;
+/*
+Scaling of binary floating point values by powers of ten with a single 128-bit product, shared by the float printing
+of tm_conversion and the builtin float backend of tm_print.
+The 128-bit type is expected to have uint64_t members low and high.
+*/
 
-    tmp_allocator_context allocator;
+/* 5^0 up to 5^27, the biggest power of five that fits into 63 bits. */
+static const uint64_t tmp_powers_of_5[] = {
+    1, 5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125, 9765625, 48828125, 244140625, 1220703125, 6103515625ull,
+    30517578125ull, 152587890625ull, 762939453125ull, 3814697265625ull, 19073486328125ull, 95367431640625ull,
+    476837158203125ull, 2384185791015625ull, 11920928955078125ull, 59604644775390625ull, 298023223876953125ull,
+    1490116119384765625ull, 7450580596923828125ull};
 
-    tmp_memory_printer(char* buffer, tm_size_t capacity, tmp_allocator_context allocator)
-        : data(buffer), capacity(capacity), can_grow(true), allocator(allocator) {
-        TM_ASSERT(allocator.reallocate);
-        TM_ASSERT(allocator.destroy);
+/*
+Computes mantissa * 2^exponent * 10^power rounded to the nearest integer, ties round to even.
+Fails if power is out of range of the fast path or if the result doesn't fit into 64 bits.
+*/
+static tm_bool tmp_scale_and_round(uint64_t mantissa, int32_t exponent, int32_t power, uint64_t* out) {
+    if (power < 0 || power > 27) {
+        return TM_FALSE;
     }
-    tmp_memory_printer(char* buffer, tm_size_t capacity) : data(buffer), capacity(capacity), can_grow(false) {}
-    ~tmp_memory_printer() {
-        if (owns) allocator.destroy(allocator.context, data, capacity);
+
+    /* mantissa < 2^53 and 5^27 < 2^63, so the product fits into 116 bits. */
+    tmp_uint128 product = tmp_multiply_u64(mantissa, tmp_powers_of_5[power]);
+    int32_t shift = exponent + power;
+    if (shift >= 0) {
+        if (product.high != 0 || shift >= 64 || (shift > 0 && (product.low >> (64 - shift)) != 0)) {
+            return TM_FALSE;
+        }
+        *out = product.low << shift;
+        return TM_TRUE;
     }
-    bool grow(tm_size_t by_at_least = 0) {
-        TM_ASSERT(can_grow);
-        tm_size_t new_capacity = 3 * ((capacity + 2) / 2);
-        if (new_capacity < capacity + by_at_least) new_capacity = capacity + by_at_least;
 
-        char* new_data = nullptr;
-        if (owns) {
-            auto reallocate_result = allocator.reallocate(allocator.context, data, capacity, new_capacity);
-            new_data = reallocate_result.ptr;
-            new_capacity = reallocate_result.size;
-        } else {
-            auto reallocate_result = allocator.reallocate(allocator.context, nullptr, 0, new_capacity);
-            new_data = reallocate_result.ptr;
-            new_capacity = reallocate_result.size;
+    int32_t rightShift = -shift;
+    if (rightShift >= 117) {
+        /* Product is below half of the rounding unit. */
+        *out = 0;
+        return TM_TRUE;
+    }
 
-            if (new_data && data && size > 0) {
-                TM_MEMCPY(new_data, data, size * sizeof(char));
-            }
+    uint64_t quotient;
+    tmp_uint128 remainder = {0, 0};
+    tmp_uint128 half = {0, 0};
+    if (rightShift < 64) {
+        if ((product.high >> rightShift) != 0) {
+            return TM_FALSE;
         }
-        if (!new_data) {
-            ec = TM_ENOMEM;
-            return false;
+        quotient = (product.low >> rightShift) | (product.high << (64 - rightShift));
+        remainder.low = product.low & (((uint64_t)1 << rightShift) - 1);
+        half.low = (uint64_t)1 << (rightShift - 1);
+    } else if (rightShift == 64) {
+        quotient = product.high;
+        remainder.low = product.low;
+        half.low = (uint64_t)1 << 63;
+    } else {
+        quotient = product.high >> (rightShift - 64);
+        remainder.high = product.high & (((uint64_t)1 << (rightShift - 64)) - 1);
+        remainder.low = product.low;
+        half.high = (uint64_t)1 << (rightShift - 65);
+    }
+
+    tm_bool aboveHalf = remainder.high > half.high || (remainder.high == half.high && remainder.low > half.low);
+    tm_bool isHalf = remainder.high == half.high && remainder.low == half.low;
+    if (aboveHalf || (isHalf && (quotient & 1))) {
+        if (quotient == UINT64_MAX) {
+            return TM_FALSE;
         }
-        data = new_data;
-        capacity = new_capacity;
-        owns = true;
-        return true;
+        ++quotient;
     }
-    tm_size_t remaining() {
-        TM_ASSERT(size <= capacity);
-        return capacity - size;
+    *out = quotient;
+    return TM_TRUE;
+}
+
+// Arbitrary precision unsigned integer, big enough for mantissa * 5^1076.
+enum { TMP_BIGNUM_CAPACITY = 84 };
+
+struct tmp_bignum {
+    uint32_t words[TMP_BIGNUM_CAPACITY];  // Least significant word first.
+    int size;
+};
+
+static void tmp_bignum_assign(tmp_bignum* bignum, uint64_t value) {
+    bignum->size = 0;
+    while (value) {
+        bignum->words[bignum->size++] = (uint32_t)value;
+        value >>= 32;
     }
-    char* end() { return data + size; }
+}
 
-    template <class T>
-    bool print_value(T value, PrintFormat& format) {
-        PrintFormattedResult result = {};
-        if (ec == TM_OK) {
+static void tmp_bignum_multiply(tmp_bignum* bignum, uint32_t factor) {
+    uint64_t carry = 0;
+    for (int i = 0; i < bignum->size; ++i) {
+        uint64_t product = (uint64_t)bignum->words[i] * factor + carry;
+        bignum->words[i] = (uint32_t)product;
+        carry = product >> 32;
+    }
+    if (carry) {
+        TM_ASSERT(bignum->size < TMP_BIGNUM_CAPACITY);
+        bignum->words[bignum->size++] = (uint32_t)carry;
+    }
+}
+
+static void tmp_bignum_multiply_pow5(tmp_bignum* bignum, int exponent) {
+    while (exponent >= 13) {
+        tmp_bignum_multiply(bignum, (uint32_t)tmp_powers_of_5[13]);
+        exponent -= 13;
+    }
+    if (exponent > 0) tmp_bignum_multiply(bignum, (uint32_t)tmp_powers_of_5[exponent]);
+}
+
+static void tmp_bignum_shift_left(tmp_bignum* bignum, int bits) {
+    if (bignum->size == 0 || bits == 0) return;
+    const int word_shift = bits / 32;
+    const int bit_shift = bits % 32;
+    TM_ASSERT(bignum->size + word_shift + 1 <= TMP_BIGNUM_CAPACITY);
+
+    if (bit_shift == 0) {
+        for (int i = bignum->size - 1; i >= 0; --i) bignum->words[i + word_shift] = bignum->words[i];
+    } else {
+        bignum->words[bignum->size + word_shift] = bignum->words[bignum->size - 1] >> (32 - bit_shift);
+        for (int i = bignum->size - 1; i > 0; --i) {
+            bignum->words[i + word_shift] =
+                (bignum->words[i] << bit_shift) | (bignum->words[i - 1] >> (32 - bit_shift));
+        }
+        bignum->words[word_shift] = bignum->words[0] << bit_shift;
+        ++bignum->size;
+    }
+    for (int i = 0; i < word_shift; ++i) bignum->words[i] = 0;
+    bignum->size += word_shift;
+    while (bignum->size > 0 && bignum->words[bignum->size - 1] == 0) --bignum->size;
+}
+
+// Divides in place and returns the remainder.
+static uint32_t tmp_bignum_divide(tmp_bignum* bignum, uint32_t divisor) {
+    uint64_t remainder = 0;
+    for (int i = bignum->size - 1; i >= 0; --i) {
+        uint64_t current = (remainder << 32) | bignum->words[i];
+        bignum->words[i] = (uint32_t)(current / divisor);
+        remainder = current % divisor;
+    }
+    while (bignum->size > 0 && bignum->words[bignum->size - 1] == 0) --bignum->size;
+    return (uint32_t)remainder;
+}
+
+// All digits of mantissa * 2^exponent. Negative exponents are computed as mantissa * 5^-exponent * 10^exponent.
+// decimal->digits must have room for TMP_EXACT_DIGITS_CAPACITY digits.
+static void tmp_exact_decimal(uint64_t mantissa, int exponent, tmp_decimal* decimal) {
+    tmp_bignum value;
+    tmp_bignum_assign(&value, mantissa);
+    if (exponent >= 0) {
+        tmp_bignum_shift_left(&value, exponent);
+    } else {
+        tmp_bignum_multiply_pow5(&value, -exponent);
+    }
+
+    // Split into chunks of 9 digits, least significant chunk first.
+    uint32_t chunks[(TMP_EXACT_DIGITS_CAPACITY + 8) / 9];
+    int chunks_count = 0;
+    while (value.size > 0) {
+        TM_ASSERT(chunks_count < (int)(sizeof(chunks) / sizeof(chunks[0])));
+        chunks[chunks_count++] = tmp_bignum_divide(&value, 1000000000u);
+    }
+
+    int count = 0;
+    if (chunks_count > 0) {
+        count = tmp_write_digits(decimal->digits, chunks[chunks_count - 1]);
+        for (int i = chunks_count - 2; i >= 0; --i) {
+            TM_ASSERT(count + 9 <= TMP_EXACT_DIGITS_CAPACITY);
+            uint32_t chunk = chunks[i];
+            for (int j = 8; j >= 0; --j) {
+                decimal->digits[count + j] = (char)('0' + (chunk % 10));
+                chunk /= 10;
+            }
+            count += 9;
+        }
+    }
+    decimal->count = count;
+    decimal->point = count + ((exponent < 0) ? exponent : 0);
+    tmp_trim_trailing_zeros(decimal);
+}
+
+// Rounds to significant_digits significant digits.
+static void tmp_round_to_significant_digits(const tmp_float_parts& parts, int significant_digits,
+                                            tmp_decimal* decimal) {
+    TM_ASSERT(significant_digits > 0);
+    if (parts.mantissa == 0) {
+        tmp_set_decimal(decimal, 0, 0);
+        return;
+    }
+
+    if (significant_digits <= 19) {
+        // Estimated decimal exponent is either exact or one too small.
+        int k = tmp_floor_log10_pow2(parts.exponent + tmp_bit_length(parts.mantissa) - 1);
+        for (int i = 0; i < 2; ++i, ++k) {
+            uint64_t scaled = 0;
+            if (!tmp_scale_and_round(parts.mantissa, parts.exponent, significant_digits - 1 - k, &scaled)) break;
+            if (scaled > tmp_powers_of_10[significant_digits]) continue;
+            tmp_set_decimal(decimal, scaled, k + 1 - significant_digits);
+            return;
+        }
+    }
+
+    tmp_exact_decimal(parts.mantissa, parts.exponent, decimal);
+    tmp_round_decimal(decimal, significant_digits);
+}
+
+// Rounds to fraction_digits digits after the decimal point.
+static void tmp_round_to_fraction_digits(const tmp_float_parts& parts, int fraction_digits, tmp_decimal* decimal) {
+    uint64_t scaled = 0;
+    if (tmp_scale_and_round(parts.mantissa, parts.exponent, fraction_digits, &scaled)) {
+        tmp_set_decimal(decimal, scaled, -fraction_digits);
+        return;
+    }
+
+    tmp_exact_decimal(parts.mantissa, parts.exponent, decimal);
+    if (fraction_digits < decimal->count - decimal->point) tmp_round_decimal(decimal, decimal->point + fraction_digits);
+}
+
+// Grisu3, see "Printing Floating-Point Numbers Quickly and Accurately with Integers" by Florian Loitsch.
+struct tmp_diy_fp {
+    uint64_t f;
+    int e;
+};
+
+static tmp_diy_fp tmp_diy_fp_normalize(tmp_diy_fp value) {
+    TM_ASSERT(value.f != 0);
+    while (!(value.f & 0xFFC0000000000000ull)) {
+        value.f <<= 10;
+        value.e -= 10;
+    }
+    while (!(value.f & 0x8000000000000000ull)) {
+        value.f <<= 1;
+        --value.e;
+    }
+    return value;
+}
+
+// Upper 64 bits of the product, rounded.
+static tmp_diy_fp tmp_diy_fp_multiply(tmp_diy_fp a, tmp_diy_fp b) {
+    tmp_uint128 product = tmp_multiply_u64(a.f, b.f);
+    tmp_diy_fp result = {product.high + (product.low >> 63), a.e + b.e + 64};
+    return result;
+}
+
+struct tmp_cached_power {
+    uint64_t significand;
+    int16_t binary_exponent;
+    int16_t decimal_exponent;
+};
+
+// Normalized 64-bit approximations of 10^-348, 10^-340, ..., 10^340.
+static const tmp_cached_power tmp_cached_powers[] = {
+    {0xFA8FD5A0081C0288ull, -1220, -348},
+    {0xBAAEE17FA23EBF76ull, -1193, -340},
+    {0x8B16FB203055AC76ull, -1166, -332},
+    {0xCF42894A5DCE35EAull, -1140, -324},
+    {0x9A6BB0AA55653B2Dull, -1113, -316},
+    {0xE61ACF033D1A45DFull, -1087, -308},
+    {0xAB70FE17C79AC6CAull, -1060, -300},
+    {0xFF77B1FCBEBCDC4Full, -1034, -292},
+    {0xBE5691EF416BD60Cull, -1007, -284},
+    {0x8DD01FAD907FFC3Cull, -980, -276},
+    {0xD3515C2831559A83ull, -954, -268},
+    {0x9D71AC8FADA6C9B5ull, -927, -260},
+    {0xEA9C227723EE8BCBull, -901, -252},
+    {0xAECC49914078536Dull, -874, -244},
+    {0x823C12795DB6CE57ull, -847, -236},
+    {0xC21094364DFB5637ull, -821, -228},
+    {0x9096EA6F3848984Full, -794, -220},
+    {0xD77485CB25823AC7ull, -768, -212},
+    {0xA086CFCD97BF97F4ull, -741, -204},
+    {0xEF340A98172AACE5ull, -715, -196},
+    {0xB23867FB2A35B28Eull, -688, -188},
+    {0x84C8D4DFD2C63F3Bull, -661, -180},
+    {0xC5DD44271AD3CDBAull, -635, -172},
+    {0x936B9FCEBB25C996ull, -608, -164},
+    {0xDBAC6C247D62A584ull, -582, -156},
+    {0xA3AB66580D5FDAF6ull, -555, -148},
+    {0xF3E2F893DEC3F126ull, -529, -140},
+    {0xB5B5ADA8AAFF80B8ull, -502, -132},
+    {0x87625F056C7C4A8Bull, -475, -124},
+    {0xC9BCFF6034C13053ull, -449, -116},
+    {0x964E858C91BA2655ull, -422, -108},
+    {0xDFF9772470297EBDull, -396, -100},
+    {0xA6DFBD9FB8E5B88Full, -369, -92},
+    {0xF8A95FCF88747D94ull, -343, -84},
+    {0xB94470938FA89BCFull, -316, -76},
+    {0x8A08F0F8BF0F156Bull, -289, -68},
+    {0xCDB02555653131B6ull, -263, -60},
+    {0x993FE2C6D07B7FACull, -236, -52},
+    {0xE45C10C42A2B3B06ull, -210, -44},
+    {0xAA242499697392D3ull, -183, -36},
+    {0xFD87B5F28300CA0Eull, -157, -28},
+    {0xBCE5086492111AEBull, -130, -20},
+    {0x8CBCCC096F5088CCull, -103, -12},
+    {0xD1B71758E219652Cull, -77, -4},
+    {0x9C40000000000000ull, -50, 4},
+    {0xE8D4A51000000000ull, -24, 12},
+    {0xAD78EBC5AC620000ull, 3, 20},
+    {0x813F3978F8940984ull, 30, 28},
+    {0xC097CE7BC90715B3ull, 56, 36},
+    {0x8F7E32CE7BEA5C70ull, 83, 44},
+    {0xD5D238A4ABE98068ull, 109, 52},
+    {0x9F4F2726179A2245ull, 136, 60},
+    {0xED63A231D4C4FB27ull, 162, 68},
+    {0xB0DE65388CC8ADA8ull, 189, 76},
+    {0x83C7088E1AAB65DBull, 216, 84},
+    {0xC45D1DF942711D9Aull, 242, 92},
+    {0x924D692CA61BE758ull, 269, 100},
+    {0xDA01EE641A708DEAull, 295, 108},
+    {0xA26DA3999AEF774Aull, 322, 116},
+    {0xF209787BB47D6B85ull, 348, 124},
+    {0xB454E4A179DD1877ull, 375, 132},
+    {0x865B86925B9BC5C2ull, 402, 140},
+    {0xC83553C5C8965D3Dull, 428, 148},
+    {0x952AB45CFA97A0B3ull, 455, 156},
+    {0xDE469FBD99A05FE3ull, 481, 164},
+    {0xA59BC234DB398C25ull, 508, 172},
+    {0xF6C69A72A3989F5Cull, 534, 180},
+    {0xB7DCBF5354E9BECEull, 561, 188},
+    {0x88FCF317F22241E2ull, 588, 196},
+    {0xCC20CE9BD35C78A5ull, 614, 204},
+    {0x98165AF37B2153DFull, 641, 212},
+    {0xE2A0B5DC971F303Aull, 667, 220},
+    {0xA8D9D1535CE3B396ull, 694, 228},
+    {0xFB9B7CD9A4A7443Cull, 720, 236},
+    {0xBB764C4CA7A44410ull, 747, 244},
+    {0x8BAB8EEFB6409C1Aull, 774, 252},
+    {0xD01FEF10A657842Cull, 800, 260},
+    {0x9B10A4E5E9913129ull, 827, 268},
+    {0xE7109BFBA19C0C9Dull, 853, 276},
+    {0xAC2820D9623BF429ull, 880, 284},
+    {0x80444B5E7AA7CF85ull, 907, 292},
+    {0xBF21E44003ACDD2Dull, 933, 300},
+    {0x8E679C2F5E44FF8Full, 960, 308},
+    {0xD433179D9C8CB841ull, 986, 316},
+    {0x9E19DB92B4E31BA9ull, 1013, 324},
+    {0xEB96BF6EBADF77D9ull, 1039, 332},
+    {0xAF87023B9BF0EE6Bull, 1066, 340},
+};
+
+static const uint32_t tmp_small_powers_of_10[] = {1u,      10u,      100u,      1000u,      10000u,
+                                                  100000u, 1000000u, 10000000u, 100000000u, 1000000000u};
+
+static bool tmp_grisu_round_weed(char* buffer, int length, uint64_t distance_too_high_w, uint64_t unsafe_interval,
+                                 uint64_t rest, uint64_t ten_kappa, uint64_t unit) {
+    const uint64_t small_distance = distance_too_high_w - unit;
+    const uint64_t big_distance = distance_too_high_w + unit;
+    // Move the last digit down as long as the result gets closer to the value.
+    while (rest < small_distance && unsafe_interval - rest >= ten_kappa &&
+           (rest + ten_kappa < small_distance || small_distance - rest >= rest + ten_kappa - small_distance)) {
+        --buffer[length - 1];
+        rest += ten_kappa;
+    }
+    // Fail if the imprecision of the computation doesn't allow to decide which candidate is closest.
+    if (rest < big_distance && unsafe_interval - rest >= ten_kappa &&
+        (rest + ten_kappa < big_distance || big_distance - rest > rest + ten_kappa - big_distance)) {
+        return false;
+    }
+    return (2 * unit <= rest) && (rest <= unsafe_interval - 4 * unit);
+}
+
+static bool tmp_grisu_digit_gen(tmp_diy_fp low, tmp_diy_fp w, tmp_diy_fp high, char* buffer, int* length,
+                                int* kappa) {
+    TM_ASSERT(low.e == w.e && w.e == high.e);
+    TM_ASSERT(w.e >= -60 && w.e <= -32);
+
+    uint64_t unit = 1;
+    const uint64_t too_low = low.f - unit;
+    const uint64_t too_high = high.f + unit;
+    uint64_t unsafe_interval = too_high - too_low;
+
+    const int one_shift = -w.e;
+    const uint64_t one = 1ull << one_shift;
+    uint32_t integrals = (uint32_t)(too_high >> one_shift);
+    uint64_t fractionals = too_high & (one - 1);
+
+    int divisor_exponent_plus_one = 10;
+    while (divisor_exponent_plus_one > 0 && integrals < tmp_small_powers_of_10[divisor_exponent_plus_one - 1]) {
+        --divisor_exponent_plus_one;
+    }
+    uint32_t divisor = (divisor_exponent_plus_one > 0) ? tmp_small_powers_of_10[divisor_exponent_plus_one - 1] : 0;
+
+    *kappa = divisor_exponent_plus_one;
+    *length = 0;
+    while (*kappa > 0) {
+        buffer[(*length)++] = (char)('0' + integrals / divisor);
+        integrals %= divisor;
+        --*kappa;
+        uint64_t rest = ((uint64_t)integrals << one_shift) + fractionals;
+        if (rest < unsafe_interval) {
+            return tmp_grisu_round_weed(buffer, *length, too_high - w.f, unsafe_interval, rest,
+                                        (uint64_t)divisor << one_shift, unit);
+        }
+        divisor /= 10;
+    }
+
+    for (;;) {
+        fractionals *= 10;
+        unit *= 10;
+        unsafe_interval *= 10;
+        buffer[(*length)++] = (char)('0' + (fractionals >> one_shift));
+        fractionals &= one - 1;
+        --*kappa;
+        if (fractionals < unsafe_interval) {
+            return tmp_grisu_round_weed(buffer, *length, (too_high - w.f) * unit, unsafe_interval, fractionals, one,
+                                        unit);
+        }
+        if (*length >= 20) return false;
+    }
+}
+
+static bool tmp_grisu3(const tmp_float_parts& parts, tmp_decimal* decimal) {
+    const uint64_t m = parts.mantissa;
+    const int e = parts.exponent;
+
+    tmp_diy_fp w = tmp_diy_fp_normalize({m, e});
+    tmp_diy_fp plus = tmp_diy_fp_normalize({(m << 1) + 1, e - 1});
+    tmp_diy_fp minus = (parts.lower_boundary_is_closer) ? tmp_diy_fp{(m << 2) - 1, e - 2}
+                                                         : tmp_diy_fp{(m << 1) - 1, e - 1};
+    minus.f <<= minus.e - plus.e;
+    minus.e = plus.e;
+    TM_ASSERT(w.e == plus.e);
+
+    // Find a cached power that brings the exponent of the scaled values into [-60, -32].
+    const int alpha = -60;
+    const int gamma = -32;
+    const int count = (int)(sizeof(tmp_cached_powers) / sizeof(tmp_cached_powers[0]));
+    const int k = -tmp_floor_log10_pow2(-(alpha - (w.e + 64) + 63));
+    int index = (348 + k - 1) / 8 + 1;
+    if (index < 0) index = 0;
+    if (index >= count) index = count - 1;
+    while (index > 0 && w.e + tmp_cached_powers[index].binary_exponent + 64 > gamma) --index;
+    while (index + 1 < count && w.e + tmp_cached_powers[index].binary_exponent + 64 < alpha) ++index;
+    const tmp_cached_power& cached = tmp_cached_powers[index];
+    const tmp_diy_fp power = {cached.significand, cached.binary_exponent};
+
+    int length = 0;
+    int kappa = 0;
+    if (!tmp_grisu_digit_gen(tmp_diy_fp_multiply(minus, power), tmp_diy_fp_multiply(w, power),
+                             tmp_diy_fp_multiply(plus, power), decimal->digits, &length, &kappa)) {
+        return false;
+    }
+    decimal->count = length;
+    decimal->point = length + kappa - cached.decimal_exponent;
+    tmp_trim_trailing_zeros(decimal);
+    return true;
+}
+
+// Exact shortest representation, used when Grisu3 fails.
+// The candidates with n digits next to the value are checked against the exact rounding boundaries for increasing n.
+static void tmp_shortest_exact(const tmp_float_parts& parts, tmp_decimal* decimal) {
+    const uint64_t m = parts.mantissa;
+    const int e = parts.exponent;
+
+    char value_digits[TMP_EXACT_DIGITS_CAPACITY];
+    char low_digits[TMP_EXACT_DIGITS_CAPACITY];
+    char high_digits[TMP_EXACT_DIGITS_CAPACITY];
+    tmp_decimal value = {value_digits, 0, 0};
+    tmp_decimal low = {low_digits, 0, 0};
+    tmp_decimal high = {high_digits, 0, 0};
+    tmp_exact_decimal(m, e, &value);
+    if (parts.lower_boundary_is_closer) {
+        tmp_exact_decimal((m << 2) - 1, e - 2, &low);
+    } else {
+        tmp_exact_decimal((m << 1) - 1, e - 1, &low);
+    }
+    tmp_exact_decimal((m << 1) + 1, e - 1, &high);
+
+    // Boundaries round to the value when parsing if the mantissa is even (round half to even).
+    const bool inclusive = (m & 1) == 0;
+    int n = 1;
+    for (; n < value.count; ++n) {
+        TM_ASSERT(n < 32);
+        tmp_decimal down = {value.digits, n, value.point};
+
+        char up_digits[32];
+        tmp_decimal up = {up_digits, n, value.point};
+        TM_MEMCPY(up_digits, value.digits, (size_t)n);
+        int i = n - 1;
+        while (i >= 0 && up_digits[i] == '9') --i;
+        if (i < 0) {
+            up_digits[0] = '1';
+            up.count = 1;
+            ++up.point;
+        } else {
+            ++up_digits[i];
+            up.count = i + 1;
+        }
+
+        const int down_compare = tmp_compare_decimal(down, low);
+        const int up_compare = tmp_compare_decimal(up, high);
+        const bool down_valid = down_compare > 0 || (inclusive && down_compare == 0);
+        const bool up_valid = up_compare < 0 || (inclusive && up_compare == 0);
+        if (!down_valid && !up_valid) continue;
+
+        bool use_up = up_valid;
+        if (down_valid && up_valid) {
+            // Pick the closer one, ties go to the even digit.
+            const char next = value.digits[n];
+            use_up = next > '5' || (next == '5' && (n + 1 < value.count || ((value.digits[n - 1] - '0') & 1)));
+        }
+        const tmp_decimal& result = (use_up) ? up : down;
+        TM_MEMCPY(decimal->digits, result.digits, (size_t)result.count);
+        decimal->count = result.count;
+        decimal->point = result.point;
+        tmp_trim_trailing_zeros(decimal);
+        return;
+    }
+
+    // The exact value is the shortest representation.
+    TM_MEMCPY(decimal->digits, value.digits, (size_t)value.count);
+    decimal->count = value.count;
+    decimal->point = value.point;
+}
+
+static void tmp_shortest_decimal(const tmp_float_parts& parts, tmp_decimal* decimal) {
+    const uint64_t m = parts.mantissa;
+    const int e = parts.exponent;
+    if (m == 0) {
+        tmp_set_decimal(decimal, 0, 0);
+        return;
+    }
+
+    // Integers below 2^53 print all their digits, since neighbouring values are at most 1 apart.
+    if (e <= 0 && e > -64 && (m & ((1ull << -e) - 1)) == 0) {
+        tmp_set_decimal(decimal, m >> -e, 0);
+        return;
+    }
+
+    if (tmp_grisu3(parts, decimal)) return;
+    tmp_shortest_exact(parts, decimal);
+}
+
+static PrintFormattedResult tmp_print_fixed(char* dest, tm_size_t maxlen, const tmp_decimal& decimal,
+                                            int fraction_digits, bool negative) {
+    const tm_size_t integer_digits = (decimal.point > 0) ? (tm_size_t)decimal.point : 1;
+    const tm_size_t size =
+        (tm_size_t)negative + integer_digits + ((fraction_digits > 0) ? (tm_size_t)fraction_digits + 1 : 0);
+    if (size > maxlen) return {size, TM_ERANGE};
+
+    char* p = dest;
+    if (negative) *p++ = '-';
+    if (decimal.point > 0) {
+        int count = (decimal.point < decimal.count) ? decimal.point : decimal.count;
+        TM_MEMCPY(p, decimal.digits, (size_t)count);
+        p += count;
+        TM_MEMSET(p, '0', (size_t)(decimal.point - count));
+        p += decimal.point - count;
+    } else {
+        *p++ = '0';
+    }
+
+    if (fraction_digits > 0) {
+        *p++ = '.';
+        int leading_zeros = (decimal.point < 0) ? -decimal.point : 0;
+        if (leading_zeros > fraction_digits) leading_zeros = fraction_digits;
+        TM_MEMSET(p, '0', (size_t)leading_zeros);
+        p += leading_zeros;
+
+        int first = (decimal.point > 0) ? decimal.point : 0;
+        int count = (decimal.count > first) ? decimal.count - first : 0;
+        if (count > fraction_digits - leading_zeros) count = fraction_digits - leading_zeros;
+        TM_MEMCPY(p, decimal.digits + first, (size_t)count);
+        p += count;
+
+        int trailing_zeros = fraction_digits - leading_zeros - count;
+        TM_MEMSET(p, '0', (size_t)trailing_zeros);
+        p += trailing_zeros;
+    }
+    TM_ASSERT(p == dest + size);
+    return {size, TM_OK};
+}
+
+static PrintFormattedResult tmp_print_scientific(char* dest, tm_size_t maxlen, const tmp_decimal& decimal,
+                                                 int fraction_digits, bool negative, bool lowercase) {
+    const int exponent = (decimal.count > 0) ? decimal.point - 1 : 0;
+    const uint32_t abs_exponent = (uint32_t)((exponent < 0) ? -exponent : exponent);
+    char exponent_digits[20];
+    int exponent_count = tmp_write_digits(exponent_digits, abs_exponent);
+
+    // Exponent has at least two digits, like printf.
+    const int exponent_padding = (exponent_count < 2) ? 2 - exponent_count : 0;
+    const tm_size_t size = (tm_size_t)negative + 1 + ((fraction_digits > 0) ? (tm_size_t)fraction_digits + 1 : 0) +
+                           2 + (tm_size_t)(exponent_padding + exponent_count);
+    if (size > maxlen) return {size, TM_ERANGE};
+
+    char* p = dest;
+    if (negative) *p++ = '-';
+    *p++ = (decimal.count > 0) ? decimal.digits[0] : '0';
+    if (fraction_digits > 0) {
+        *p++ = '.';
+        int count = (decimal.count > 1) ? decimal.count - 1 : 0;
+        if (count > fraction_digits) count = fraction_digits;
+        TM_MEMCPY(p, decimal.digits + 1, (size_t)count);
+        p += count;
+        TM_MEMSET(p, '0', (size_t)(fraction_digits - count));
+        p += fraction_digits - count;
+    }
+    *p++ = (lowercase) ? 'e' : 'E';
+    *p++ = (exponent < 0) ? '-' : '+';
+    TM_MEMSET(p, '0', (size_t)exponent_padding);
+    p += exponent_padding;
+    TM_MEMCPY(p, exponent_digits, (size_t)exponent_count);
+    p += exponent_count;
+    TM_ASSERT(p == dest + size);
+    return {size, TM_OK};
+}
+
+// Hexadecimal output like printf %a without the "0x" prefix, which is added by PrintFlags::PrependHex.
+// Expects the parts of a double.
+static PrintFormattedResult tmp_print_hex_float(char* dest, tm_size_t maxlen, const tmp_float_parts& parts,
+                                                int precision, bool lowercase) {
+    const int mantissa_digits = 13;
+    uint32_t leading = 0;
+    uint64_t fraction = 0;
+    int exponent = 0;
+    if (parts.mantissa >= (1ull << 52)) {
+        leading = 1;
+        fraction = parts.mantissa & 0xFFFFFFFFFFFFFull;
+        exponent = parts.exponent + 52;
+    } else if (parts.mantissa != 0) {
+        // Subnormals are printed with a leading zero.
+        fraction = parts.mantissa;
+        exponent = -1022;
+    }
+
+    int fraction_digits = precision;
+    if (precision < 0) {
+        fraction_digits = mantissa_digits;
+        while (fraction_digits > 0 && ((fraction >> ((mantissa_digits - fraction_digits) * 4)) & 0xF) == 0) {
+            --fraction_digits;
+        }
+    } else if (precision < mantissa_digits) {
+        const int shift = (mantissa_digits - precision) * 4;
+        const uint64_t remainder = fraction & ((1ull << shift) - 1);
+        const uint64_t half = 1ull << (shift - 1);
+        fraction >>= shift;
+        const uint64_t last = (precision > 0) ? fraction : leading;
+        if (remainder > half || (remainder == half && (last & 1))) {
+            ++fraction;
+            if (fraction >> (precision * 4)) {
+                fraction = 0;
+                ++leading;
+            }
+        }
+    }
+
+    const int significant_digits = (fraction_digits < mantissa_digits) ? fraction_digits : mantissa_digits;
+    const uint32_t abs_exponent = (uint32_t)((exponent < 0) ? -exponent : exponent);
+    char exponent_digits[20];
+    const int exponent_count = tmp_write_digits(exponent_digits, abs_exponent);
+    const tm_size_t size = (tm_size_t)parts.negative + 1 +
+                           ((fraction_digits > 0) ? (tm_size_t)fraction_digits + 1 : 0) + 2 +
+                           (tm_size_t)exponent_count;
+    if (size > maxlen) return {size, TM_ERANGE};
+
+    const char* hex_digits = (lowercase) ? "0123456789abcdef" : "0123456789ABCDEF";
+    char* p = dest;
+    if (parts.negative) *p++ = '-';
+    *p++ = hex_digits[leading];
+    if (fraction_digits > 0) {
+        *p++ = '.';
+        // Fraction is aligned to mantissa_digits digits unless it was rounded to fewer digits.
+        const int fraction_width = (precision >= 0 && precision < mantissa_digits) ? precision : mantissa_digits;
+        for (int i = 0; i < significant_digits; ++i) {
+            *p++ = hex_digits[(fraction >> ((fraction_width - i - 1) * 4)) & 0xF];
+        }
+        TM_MEMSET(p, '0', (size_t)(fraction_digits - significant_digits));
+        p += fraction_digits - significant_digits;
+    }
+    *p++ = (lowercase) ? 'p' : 'P';
+    *p++ = (exponent < 0) ? '-' : '+';
+    TM_MEMCPY(p, exponent_digits, (size_t)exponent_count);
+    p += exponent_count;
+    TM_ASSERT(p == dest + size);
+    return {size, TM_OK};
+}
+
+static PrintFormattedResult tmp_print_non_finite(char* dest, tm_size_t maxlen, const tmp_float_parts& parts,
+                                                 bool uppercase) {
+    const char* str = (parts.is_inf) ? ((uppercase) ? "INF" : "inf") : ((uppercase) ? "NAN" : "nan");
+    const tm_size_t size = (tm_size_t)parts.negative + 3;
+    if (size > maxlen) return {size, TM_ERANGE};
+    char* p = dest;
+    if (parts.negative) *p++ = '-';
+    TM_MEMCPY(p, str, 3);
+    return {size, TM_OK};
+}
+
+static bool tmp_is_hex_float_format(unsigned int flags) {
+    return (flags & PrintFlags::Hex) && !(flags & PrintFlags::Scientific);
+}
+
+static PrintFormattedResult tmp_print_float(char* dest, tm_size_t maxlen, const tmp_float_parts& parts,
+                                            const PrintFormat& format) {
+    TM_ASSERT(!dest || maxlen > 0);
+    TM_ASSERT_VALID_SIZE(maxlen);
+
+    const unsigned int flags = format.flags;
+    const bool lowercase = (flags & PrintFlags::Lowercase) != 0;
+    const bool general = (flags & PrintFlags::General) == PrintFlags::General;
+    const bool scientific = !general && (flags & PrintFlags::Scientific);
+    const bool hex = tmp_is_hex_float_format(flags);
+
+    if (parts.is_inf || parts.is_nan) {
+        const bool uppercase = !lowercase && (flags & (PrintFlags::Scientific | PrintFlags::Hex));
+        return tmp_print_non_finite(dest, maxlen, parts, uppercase);
+    }
+    if (hex) return tmp_print_hex_float(dest, maxlen, parts, format.precision, lowercase);
+
+    char digits[TMP_EXACT_DIGITS_CAPACITY];
+    tmp_decimal decimal = {digits, 0, 0};
+    const int precision = format.precision;
+    const bool trim_zeros = (general || (flags & PrintFlags::Shortest)) && !(flags & PrintFlags::TrailingZeroes);
+
+    bool use_scientific = scientific;
+    int fraction_digits = 0;
+    if (precision < 0) {
+        tmp_shortest_decimal(parts, &decimal);
+        if (general) {
+            // Same choice as printf %g with the default precision.
+            const int exponent = (decimal.count > 0) ? decimal.point - 1 : 0;
+            use_scientific = exponent < -4 || exponent >= 6;
+        }
+        if (!use_scientific && parts.exponent > 0) {
+            // Integers that are too big to be represented exactly print their exact value instead of trailing zeros,
+            // since it is the closest representation with the same length.
+            tmp_exact_decimal(parts.mantissa, parts.exponent, &decimal);
+        }
+        fraction_digits = (use_scientific) ? decimal.count - 1 : decimal.count - decimal.point;
+    } else if (general) {
+        const int significant_digits = (precision > 0) ? precision : 1;
+        tmp_round_to_significant_digits(parts, significant_digits, &decimal);
+        const int exponent = (decimal.count > 0) ? decimal.point - 1 : 0;
+        use_scientific = exponent < -4 || exponent >= significant_digits;
+        fraction_digits = (use_scientific) ? significant_digits - 1 : significant_digits - 1 - exponent;
+    } else if (scientific) {
+        tmp_round_to_significant_digits(parts, precision + 1, &decimal);
+        fraction_digits = precision;
+    } else {
+        tmp_round_to_fraction_digits(parts, precision, &decimal);
+        fraction_digits = precision;
+    }
+
+    if (trim_zeros) {
+        const int needed = (use_scientific) ? decimal.count - 1 : decimal.count - decimal.point;
+        if (fraction_digits > needed) fraction_digits = needed;
+    }
+    if (fraction_digits < 0) fraction_digits = 0;
+
+    if (use_scientific) {
+        return tmp_print_scientific(dest, maxlen, decimal, fraction_digits, parts.negative, lowercase);
+    }
+    return tmp_print_fixed(dest, maxlen, decimal, fraction_digits, parts.negative);
+}
+
+static PrintFormattedResult tmp_print_value(char* dest, tm_size_t maxlen, double value, const PrintFormat& format) {
+    return tmp_print_float(dest, maxlen, tmp_decompose_float(value), format);
+}
+static PrintFormattedResult tmp_print_value(char* dest, tm_size_t maxlen, float value, const PrintFormat& format) {
+    // Hexadecimal output of floats is the same as for doubles, like printf does after promoting float to double.
+    if (tmp_is_hex_float_format(format.flags)) {
+        return tmp_print_float(dest, maxlen, tmp_decompose_float((double)value), format);
+    }
+    return tmp_print_float(dest, maxlen, tmp_decompose_float(value), format);
+}
+
+#endif  // defined(TMP_FLOAT_BACKEND_BUILTIN)
+
+template <class T>
+static PrintFormattedResult tmp_print_formatted(char* dest, tm_size_t maxlen, const PrintFormat& format, T value) {
+    TM_ASSERT(dest || maxlen == 0);
+    TM_ASSERT_VALID_SIZE(maxlen);
+
+    if (maxlen <= 0) return {maxlen, TM_EOVERFLOW};
+    TM_ASSERT(dest);
+
+    auto pair = tmp_make_unsigned(value);
+    bool sign = pair.negative || ((format.flags & PrintFlags::Sign) != 0);
+    auto result = tmp_print_value(dest + sign, maxlen - sign, pair.value, format);
+    return tmp_move_printed_value_and_decorate(dest, maxlen, format, result, pair.negative);
+}
+
+struct tmp_reallocate_result {
+    char* ptr;
+    tm_size_t size;
+};
+
+struct tmp_allocator_context {
+    void* context;
+    tmp_reallocate_result (*reallocate)(void* context, char* old_ptr, tm_size_t old_size, tm_size_t new_size);
+    void (*destroy)(void* context, char* ptr, tm_size_t size);
+};
+
+static tmp_reallocate_result tmp_allocator_default_reallocate(void* /*context*/, char* old_ptr, tm_size_t old_size,
+                                                              tm_size_t new_size) {
+    TM_ASSERT_VALID_SIZE(new_size);
+
+    tmp_reallocate_result result = {nullptr, 0};
+    if (old_ptr && old_size > 0) {
+        result.ptr = (char*)TM_REALLOC(old_ptr, new_size * sizeof(char), sizeof(char));
+    } else {
+        result.ptr = (char*)TM_MALLOC(new_size * sizeof(char), sizeof(char));
+    }
+    result.size = (result.ptr) ? new_size : 0;
+    return result;
+}
+static void tmp_allocator_default_destroy(void* /*context*/, char* ptr, tm_size_t size) {
+    (void)size;
+    TM_FREE(ptr);
+}
+
+static tmp_allocator_context tmp_default_allocator() {
+    return {nullptr, tmp_allocator_default_reallocate, tmp_allocator_default_destroy};
+}
+
+#ifdef TMP_USE_STL
+static tmp_reallocate_result tmp_allocator_std_string_reallocate(void* context, char* /*old_ptr*/,
+                                                                 tm_size_t /*old_size*/, tm_size_t new_size) {
+    TM_ASSERT(context);
+    TM_ASSERT_VALID_SIZE(new_size);
+
+    auto str = static_cast<::std::string*>(context);
+#if 1
+    // We use two resizes, first to allocate memory, second to make use of all memory allocated.
+    str->resize((size_t)new_size);
+    str->resize(str->capacity());
+    // TODO: This requires C++17, maybe use &((*str)[0]) instead, which isn't guaranteed to be contiguous?
+    return {str->data(), (tm_size_t)str->size()};
+#else
+    str->resize((size_t)new_size);
+    return {str->data(), new_size};
+#endif
+}
+static void tmp_allocator_std_string_destroy(void* /*context*/, char* /*ptr*/, tm_size_t /*size*/) {}
+
+static tmp_allocator_context tmp_std_string_allocator(::std::string* out) {
+    return {static_cast<void*>(out), tmp_allocator_std_string_reallocate, tmp_allocator_std_string_destroy};
+}
+#endif /* defined(TMP_USE_STL) */
+/* See SWITCHES for how to redefine this. */
+#ifndef TMP_STRING_WIDTH
+#define TMP_STRING_WIDTH(str, str_len) (int)(str_len)
+#endif
+
+static PrintFormattedResult tmp_get_print_size(char*, tm_size_t, bool value, const PrintFormat& format) {
+    // '0' or '1' are just a single byte.
+    if (format.flags & PrintFlags::BoolAsNumber) return {1, TM_OK};
+    // The strings "true" and "false" are 4 and 5 bytes.
+    return {(tm_size_t)((value) ? 4 : 5), TM_OK};
+}
+
+template <class T>
+static PrintFormattedResult tmp_get_print_size(char* dest, tm_size_t maxlen, T value, const PrintFormat& format) {
+    // FIXME: This will fail for floating point numbers that need more than TMP_SBO_SIZE characters when supplied dest
+    // buffer isn't big enough. Should be very rare, but might be unexpected and lead to bugs.
+    // Should we allocate memory in that case?
+
+    char buffer[(TMP_SBO_SIZE)];
+    if (maxlen < (tm_size_t)(TMP_SBO_SIZE)) {
+        dest = buffer;
+        maxlen = (tm_size_t)(TMP_SBO_SIZE);
+    }
+    return tmp_print_formatted(dest, maxlen, format, value);
+}
+
+struct tmp_memory_printer {
+    char* data;
+    tm_size_t size = 0;
+    tm_size_t necessary = 0;
+    tm_size_t capacity;
+    bool can_grow;
+    bool owns = false;
+    tm_errc ec = TM_OK;
+
+    tmp_allocator_context allocator;
+
+    // When printing into a sink, the printer starts out with the buffer of the sink.
+    tmp_output_sink* sink = nullptr;
+    bool drained = false;
+
+    tmp_memory_printer(char* buffer, tm_size_t capacity, tmp_allocator_context allocator)
+        : data(buffer), capacity(capacity), can_grow(true), allocator(allocator) {
+        TM_ASSERT(allocator.reallocate);
+        TM_ASSERT(allocator.destroy);
+    }
+    tmp_memory_printer(char* buffer, tm_size_t capacity) : data(buffer), capacity(capacity), can_grow(false) {}
+    explicit tmp_memory_printer(tmp_output_sink* sink)
+        : data(sink->data),
+          size(sink->size),
+          capacity(sink->capacity),
+          can_grow(sink->write || sink->growable),
+          owns(sink->growable && sink->data),
+          allocator(tmp_default_allocator()),
+          sink(sink) {}
+    ~tmp_memory_printer() {
+        if (owns) allocator.destroy(allocator.context, data, capacity);
+    }
+    bool drain() {
+        TM_ASSERT(sink && sink->write);
+        if (size <= 0) return true;
+        tm_errc write_result = sink->write(sink->context, data, size);
+        if (write_result != TM_OK) {
+            ec = write_result;
+            return false;
+        }
+        size = 0;
+        drained = true;
+        return true;
+    }
+    bool grow(tm_size_t by_at_least = 0) {
+        TM_ASSERT(can_grow);
+        if (sink && sink->write && !owns) {
+            // Write out buffered output instead of growing. Only values that don't fit into the buffer of the sink
+            // at all fall back to allocating.
+            tm_size_t buffered = size;
+            if (!drain()) return false;
+            if (buffered > 0 && buffered >= by_at_least) return true;
+        }
+        tm_size_t new_capacity = 3 * ((capacity + 2) / 2);
+        if (new_capacity < capacity + by_at_least) new_capacity = capacity + by_at_least;
+
+        char* new_data = nullptr;
+        if (owns) {
+            auto reallocate_result = allocator.reallocate(allocator.context, data, capacity, new_capacity);
+            new_data = reallocate_result.ptr;
+            new_capacity = reallocate_result.size;
+        } else {
+            auto reallocate_result = allocator.reallocate(allocator.context, nullptr, 0, new_capacity);
+            new_data = reallocate_result.ptr;
+            new_capacity = reallocate_result.size;
+
+            if (new_data && data && size > 0) {
+                TM_MEMCPY(new_data, data, size * sizeof(char));
+            }
+        }
+        if (!new_data) {
+            ec = TM_ENOMEM;
+            return false;
+        }
+        data = new_data;
+        capacity = new_capacity;
+        owns = true;
+        return true;
+    }
+    tm_size_t remaining() {
+        TM_ASSERT(size <= capacity);
+        return capacity - size;
+    }
+    char* end() { return data + size; }
+
+    template <class T>
+    bool print_value(T value, PrintFormat& format) {
+        PrintFormattedResult result = {};
+        if (ec == TM_OK) {
             for (;;) {
                 result = tmp_print_formatted(end(), remaining(), format, value);
                 if (result.ec == TM_OK) break;
@@ -1832,7 +3555,7 @@ struct tmp_memory_printer {
     bool print_unsigned(T value, PrintFormat& format, bool negative) {
         auto sizes = tmp_get_print_sizes(value, format, negative);
         necessary += sizes.size;
-        if (sizes.size > remaining() && !(can_grow && grow(sizes.size))) {
+        if (sizes.size > remaining() && !(can_grow && grow(sizes.size - remaining()))) {
             if (!can_grow) {
                 ec = TM_ERANGE;
                 return true;
@@ -1929,7 +3652,7 @@ struct tmp_memory_printer {
                     return false;
                 }
                 if (can_grow && (tm_size_t)print_size > remaining()) {
-                    if (!grow(print_size)) return false;
+                    if (!grow((tm_size_t)print_size - remaining())) return false;
                     print_size = value.custom.customPrint(end(), remaining(), format, value.custom.data);
                 }
                 necessary += (tm_size_t)print_size;
@@ -1955,7 +3678,17 @@ struct tmp_memory_printer {
                 ec = TM_ERANGE;
                 return true;
             }
-            if (!grow(len)) return false;
+            if (sink && sink->write && !owns && len >= capacity) {
+                // Too big for the buffer of the sink, write it out directly instead of copying.
+                if (!drain()) return false;
+                tm_errc write_result = sink->write(sink->context, str, len);
+                if (write_result != TM_OK) {
+                    ec = write_result;
+                    return false;
+                }
+                return true;
+            }
+            if (!grow(len - remaining())) return false;
         }
         auto rem = remaining();
         auto print_size = TM_MIN(len, rem);
@@ -1967,32 +3700,259 @@ struct tmp_memory_printer {
         return true;
     }
 };
+#ifndef TMP_NO_CRT_FILE_PRINTING
+static tm_errc tmp_sink_write_file(void* context, const char* data, tm_size_t size) {
+    TM_ASSERT(context);
+    FILE* out = (FILE*)context;
+    if (fwrite(data, sizeof(char), (size_t)size, out) != (size_t)size) return TM_EIO;
+    return TM_OK;
+}
+#endif  // !defined(TMP_NO_CRT_FILE_PRINTING)
 
-static const char* tmp_find(const char* first, const char* last, char c) {
-    return (const char*)TM_MEMCHR(first, c, last - first);
+#ifndef TMP_NO_FD_SINK
+static tm_errc tmp_sink_write_fd(void* context, const char* data, tm_size_t size) {
+    int fd = (int)(intptr_t)context;
+    while (size > 0) {
+        errno = 0;
+        auto written = TMP_WRITE(fd, data, size);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return (errno != 0) ? errno : TM_EIO;
+        }
+        // Nothing was written without an error, retrying would loop forever.
+        if (written == 0) return TM_EIO;
+        data += written;
+        size -= (tm_size_t)written;
+    }
+    return TM_OK;
 }
+#endif  // !defined(TMP_NO_FD_SINK)
+
+// Hands the buffer of the printer back to the sink after printing.
+static tm_errc tmp_finish_sink_print(tmp_output_sink* sink, tmp_memory_printer& printer, tm_size_t original_size) {
+    if (printer.ec == TM_OK && printer.owns && sink->write) {
+        // Output didn't fit into the buffer of the sink and was printed into an allocated buffer instead.
+        // The buffer of the sink was already drained at that point, so it is safe to write out the allocation.
+        printer.drain();
+    }
+    if (sink->growable) {
+        // The printer took over the allocation of the sink, since it might have reallocated it.
+        sink->data = printer.data;
+        sink->capacity = printer.capacity;
+        printer.owns = false;
+    }
 
-static bool tmp_print_string_escaped(const char* first, const char* last, tmp_memory_printer& printout) {
-    const char* p = first;
-    while ((p = tmp_find(first, last, '}')) != nullptr) {
-        // Print string including '}'.
-        ++p;
-        if (!printout(first, (tm_size_t)(p - first))) return false;
+    if (printer.ec == TM_OK) {
+        sink->size = (printer.owns) ? 0 : printer.size;
+    } else if (!printer.drained) {
+        // Nothing was written out yet, so we can discard partial output.
+        sink->size = original_size;
+    } else {
+        sink->size = (printer.owns) ? 0 : printer.size;
+    }
+    return printer.ec;
+}
+
+// Rough estimate of how many bytes an argument prints, format is nullptr if the placeholder isn't known yet.
+static tm_size_t tmp_estimate_arg_size(uint64_t type, const PrintValue& value, const PrintFormat* format) {
+    tm_size_t result = 0;
+    bool small_base = format && format->base < 10;
+    switch (type) {
+        case PrintType::Char: {
+            result = 4;
+            break;
+        }
+        case PrintType::Bool: {
+            result = 5;
+            break;
+        }
+        case PrintType::Int32:
+        case PrintType::UInt32: {
+            // Base 2 with prefix and sign, otherwise the digits of INT32_MIN.
+            result = (small_base) ? 35 : 11;
+            break;
+        }
+        case PrintType::Int64:
+        case PrintType::UInt64: {
+            result = (small_base) ? 67 : 20;
+            break;
+        }
+        case PrintType::Float:
+        case PrintType::Double: {
+            // Enough for shortest and scientific output, fixed output of big values needs to grow.
+            result = 24;
+            if (format && format->precision > 0) result += (tm_size_t)format->precision;
+            break;
+        }
+        case PrintType::String: {
+            TM_ASSERT(value.s);
+            result = (tm_size_t)TM_STRLEN(value.s);
+            break;
+        }
+        case PrintType::StringView: {
+            result = (tm_size_t)value.v.size;
+            break;
+        }
+        default: {
+            result = 16;
+            break;
+        }
+    }
+    if (format && format->width > 0 && (tm_size_t)format->width > result) result = (tm_size_t)format->width;
+    return result;
+}
+
+// Widths of runtime format strings are only known while printing, only the argument types are taken into account.
+static tm_size_t tmp_estimate_print_size(size_t format_len, const PrintArgList& args) {
+    tm_size_t result = (tm_size_t)format_len;
+    for (unsigned int i = 0; i < args.size; ++i) {
+        result += tmp_estimate_arg_size(tmp_get_arg_type(args, i), args.args[i], nullptr);
+    }
+    return result;
+}
+
+static tm_size_t tmp_estimate_print_size(const tmp_format_segment* segments, tm_size_t segments_count,
+                                         const PrintArgList& args) {
+    tm_size_t result = 0;
+    for (tm_size_t i = 0; i < segments_count; ++i) {
+        const tmp_format_segment& segment = segments[i];
+        if (segment.arg_index < 0) {
+            result += segment.size;
+            continue;
+        }
+        TM_ASSERT((unsigned int)segment.arg_index < args.size);
+        result += tmp_estimate_arg_size(tmp_get_arg_type(args, (unsigned int)segment.arg_index),
+                                        args.args[segment.arg_index], &segment.format);
+    }
+    return result;
+}
+
+#ifdef TMP_SCRATCH_ARENA
+// Buffer that is kept between calls on the same thread, so that repeated printing doesn't need to allocate.
+struct tmp_scratch_arena {
+    char* data;
+    tm_size_t capacity;
+    bool in_use;  // Custom printers can print recursively, only the outermost call uses the arena.
+
+    ~tmp_scratch_arena() {
+        if (data) TM_FREE(data);
+    }
+};
+static TM_THREAD_LOCAL tmp_scratch_arena tmp_thread_scratch_arena;
+
+static tmp_reallocate_result tmp_allocator_scratch_reallocate(void* context, char* /*old_ptr*/,
+                                                              tm_size_t /*old_size*/, tm_size_t new_size) {
+    TM_ASSERT(context);
+    TM_ASSERT_VALID_SIZE(new_size);
+
+    auto arena = static_cast<tmp_scratch_arena*>(context);
+    char* ptr = nullptr;
+    if (arena->data) {
+        ptr = (char*)TM_REALLOC(arena->data, new_size * sizeof(char), sizeof(char));
+    } else {
+        ptr = (char*)TM_MALLOC(new_size * sizeof(char), sizeof(char));
+    }
+    if (!ptr) return {nullptr, 0};
+    arena->data = ptr;
+    arena->capacity = new_size;
+    return {ptr, new_size};
+}
+// The memory stays with the arena for the next call.
+static void tmp_allocator_scratch_destroy(void* /*context*/, char* /*ptr*/, tm_size_t /*size*/) {}
+
+static tmp_allocator_context tmp_scratch_allocator(tmp_scratch_arena* arena) {
+    return {static_cast<void*>(arena), tmp_allocator_scratch_reallocate, tmp_allocator_scratch_destroy};
+}
+#endif  // defined(TMP_SCRATCH_ARENA)
+
+/*
+Memory printer for output that is copied somewhere else after printing, like into a FILE* or a std::string.
+The buffer is picked before printing using the estimated size, so that most calls allocate at most once:
+The scratch arena of the thread if TMP_SCRATCH_ARENA is defined and no outer call is using it, otherwise
+sbo if the estimated size fits and memory of fallback_allocator sized for the estimate if it doesn't.
+*/
+struct tmp_scratch_printer {
+    tmp_memory_printer printer;
+#ifdef TMP_SCRATCH_ARENA
+    tmp_scratch_arena* arena = nullptr;
+#endif
+
+    tmp_scratch_printer(char* sbo, tm_size_t sbo_size, tmp_allocator_context fallback_allocator,
+                        tm_size_t estimated_size)
+        : printer(sbo, sbo_size, fallback_allocator) {
+#ifdef TMP_SCRATCH_ARENA
+        if (!tmp_thread_scratch_arena.in_use) {
+            arena = &tmp_thread_scratch_arena;
+            arena->in_use = true;
+            printer.data = arena->data;
+            printer.capacity = arena->capacity;
+            printer.owns = true;
+            printer.allocator = tmp_scratch_allocator(arena);
+        }
+#endif
+        if (estimated_size > printer.capacity) printer.grow(estimated_size - printer.capacity);
+    }
+    ~tmp_scratch_printer() {
+#ifdef TMP_SCRATCH_ARENA
+        if (arena) {
+            arena->in_use = false;
+            if (arena->capacity > (tm_size_t)(TMP_SCRATCH_ARENA_MAX_SIZE)) {
+                TM_FREE(arena->data);
+                arena->data = nullptr;
+                arena->capacity = 0;
+            }
+        }
+#endif
+    }
+
+    // Whether the output lives in memory of the fallback allocator.
+    bool in_fallback_memory() const {
+#ifdef TMP_SCRATCH_ARENA
+        if (arena) return false;
+#endif
+        return printer.owns;
+    }
+};
+
+#ifdef TMP_USE_STL
+static void tmp_finish_string_format(tmp_scratch_printer& scratch, ::std::string* result) {
+    const tmp_memory_printer& mem = scratch.printer;
+    if (mem.ec != TM_OK) {
+        result->clear();
+    } else if (scratch.in_fallback_memory()) {
+        // Output was printed into the string itself, trim the capacity the printer allocated in advance.
+        result->resize((size_t)mem.size);
+    } else {
+        result->assign(mem.data, (size_t)mem.size);
+    }
+}
+#endif /* defined(TMP_USE_STL) */
+
+
+static const char* tmp_find(const char* first, const char* last, char c) {
+    return (const char*)TM_MEMCHR(first, c, last - first);
+}
 
-        // Check for unescaped '}'.
-        if (p >= last || *p != '}') {
-            printout.ec = TM_EINVAL;
-            return false;
+// Finds the braces of a format string from left to right, every byte is scanned at most once for each brace.
+struct tmp_brace_finder {
+    const char* last;
+    const char* open = nullptr;  // The next '{' that was found, nullptr if there are none left.
+    bool open_valid = false;
+
+    explicit tmp_brace_finder(const char* last) : last(last) {}
+
+    // Finds the first '{' or '}' in [first, last), first must not be less than in previous calls.
+    const char* find(const char* first) {
+        // The position of the next '{' is remembered, so that literal runs with escaped '}}' in them aren't scanned
+        // for '{' again, '}' is only searched for up to that position.
+        if (!open_valid || (open && open < first)) {
+            open = tmp_find(first, last, '{');
+            open_valid = true;
         }
-        ++p;  // Skip escaped '}'.
-
-        first = p;
-    }
-    if (first < last) {
-        if (!printout(first, (tm_size_t)(last - first))) return false;
+        const char* close = tmp_find(first, (open) ? open : last, '}');
+        return (close) ? close : open;
     }
-    return true;
-}
+};
 
 static void tmp_print_impl(const char* format, size_t format_len, const PrintFormat& initial_formatting,
                            const PrintArgList& args, tmp_memory_printer& printout) {
@@ -2003,19 +3963,24 @@ static void tmp_print_impl(const char* format, size_t format_len, const PrintFor
     const char* format_last = format + format_len;
     auto index = 0u;
     const char* p = format_first;
-    uint64_t currentArgTypeFlags = args.flags;
-    while ((p = tmp_find(format_first, format_last, '{')) != nullptr) {
-        if (!tmp_print_string_escaped(format_first, p, printout)) return;
-        ++p;
-        if (*p == '{') {
-            if (!printout("{", 1)) return;
-            ++p;
+    tmp_brace_finder braces{format_last};
+    while ((p = braces.find(p)) != nullptr) {
+        if (p + 1 < format_last && p[1] == *p) {
+            // Escaped brace, print the literal run including one of the braces.
+            if (!printout(format_first, (tm_size_t)(p + 1 - format_first))) return;
+            p += 2;
             format_first = p;
             continue;
         }
+        if (*p == '}') {
+            printout.ec = TM_EINVAL;
+            return;
+        }
+        if (p > format_first && !printout(format_first, (tm_size_t)(p - format_first))) return;
+        ++p;
 
         // Parse until '}'.
-        auto next = tmp_find(format_first, format_last, '}');
+        auto next = tmp_find(p, format_last, '}');
         if (!next) {
             printout.ec = TM_EINVAL;
             return;
@@ -2024,7 +3989,6 @@ static void tmp_print_impl(const char* format, size_t format_len, const PrintFor
         PrintFormat print_format = initial_formatting;
         print_format.flags = format_flags;
         auto current_index = index;
-        auto current_arg_type = currentArgTypeFlags & PrintType::Mask;
         bool index_specified = tmp_parse_format_specifiers(p, (tm_size_t)(next - p), &print_format, &current_index);
         // Check whether specified index in format specifier is valid.
         if (current_index >= args.size) {
@@ -2032,13 +3996,10 @@ static void tmp_print_impl(const char* format, size_t format_len, const PrintFor
             return;
         }
 
-        if (!index_specified) {
-            ++index;
-            currentArgTypeFlags >>= PrintType::Bits;
-        } else {
-            current_arg_type = (args.flags >> (current_index * PrintType::Bits)) & PrintType::Mask;
-        }
-        format_first = next + 1;
+        if (!index_specified) ++index;
+        auto current_arg_type = tmp_get_arg_type(args, current_index);
+        p = next + 1;
+        format_first = p;
 
         // Check whether current arg type is a valid entry of PrintType.
         // This can happen if there are more unindexed '{}' placeholders than supplied arguments.
@@ -2049,180 +4010,59 @@ static void tmp_print_impl(const char* format, size_t format_len, const PrintFor
         if (!printout((int)current_arg_type, args.args[current_index], print_format)) return;
     }
     if (format_first < format_last) {
-        if (!tmp_print_string_escaped(format_first, format_last, printout)) return;
+        if (!printout(format_first, (tm_size_t)(format_last - format_first))) return;
     }
 }
 
-}  // anonymous namespace
-
-TMP_DEF tm_size_t tmp_parse_print_format(const char* format_specifiers, tm_size_t format_specifiers_len,
-                                         PrintFormat* out) {
-    TM_ASSERT(format_specifiers || format_specifiers_len == 0);
-    TM_ASSERT(out);
-    TM_ASSERT_VALID_SIZE(format_specifiers_len);
-
-    *out = default_print_format();
-    unsigned int flags = PrintFlags::Default;
-
-    // Pad with spaces by default.
-    flags |= PrintFlags::PadWithSpaces;
-
-    const char* p = format_specifiers;
-    const char* last = p + format_specifiers_len;
-
-    bool pound_specified = false;
-
-    for (bool parseFlags = true; p < last && parseFlags;) {
-        switch (*p) {
-            case '-': {
-                flags |= PrintFlags::LeftJustify;
-                ++p;
-                break;
-            }
-            case '+': {
-                flags |= PrintFlags::Sign;
-                ++p;
-                break;
-            }
-            case ' ': {
-                flags |= PrintFlags::PadWithSpaces;
-                ++p;
-                break;
-            }
-            case '#': {
-                pound_specified = true;
-                ++p;
-                break;
-            }
-            case '0': {
-                flags &= ~PrintFlags::PadWithSpaces;
-                ++p;
-                break;
-            }
-            default: {
-                parseFlags = false;
-                break;
-            }
+static void tmp_print_segments_impl(const char* format, const tmp_format_segment* segments, tm_size_t segments_count,
+                                    const PrintArgList& args, tmp_memory_printer& printout) {
+    for (tm_size_t i = 0; i < segments_count; ++i) {
+        const tmp_format_segment& segment = segments[i];
+        if (segment.arg_index < 0) {
+            if (!printout(format + segment.offset, segment.size)) return;
+            continue;
         }
-    }
-
-    // Parse width.
-    unsigned width = out->width;
-    auto scan_width_result = scan_u32_n(p, (tm_size_t)(last - p), &width, 10);
-    if (scan_width_result.ec == TM_OK) p += scan_width_result.size;
-    out->width = (int)width;
 
-    // Parse precision.
-    if (p < last && *p == '.') {
-        ++p;
-        unsigned precision = out->precision;
-        auto scan_precision_result = scan_u32_n(p, (tm_size_t)(last - p), &precision, 10);
-        if (scan_precision_result.ec == TM_OK) p += scan_precision_result.size;
-        out->precision = (int)precision;
+        // Segments were already validated against the arguments when they were made.
+        TM_ASSERT((unsigned int)segment.arg_index < args.size);
+        auto arg_type = tmp_get_arg_type(args, (unsigned int)segment.arg_index);
+        PrintFormat print_format = segment.format;
+        if (!printout((int)arg_type, args.args[segment.arg_index], print_format)) return;
     }
+}
 
-    if (p < last) {
-        switch (*p) {
-            case 'x': {
-                flags |= PrintFlags::Lowercase;
-                out->base = 16;
-                if (pound_specified) flags |= PrintFlags::PrependHex;
-                ++p;
-                break;
-            }
-            case 'X': {
-                out->base = 16;
-                if (pound_specified) flags |= PrintFlags::PrependHex;
-                ++p;
-                break;
-            }
-            case 'o': {
-                out->base = 8;
-                if (pound_specified) flags |= PrintFlags::PrependOctal;
-                ++p;
-                break;
-            }
-            case 'b': {
-                flags |= PrintFlags::Lowercase;
-                out->base = 2;
-                if (pound_specified) flags |= PrintFlags::PrependBinary;
-                ++p;
-                break;
-            }
-            case 'B': {
-                out->base = 2;
-                if (pound_specified) flags |= PrintFlags::PrependBinary;
-                ++p;
-                break;
-            }
-            case 'c': {
-                flags |= PrintFlags::Char;
-                ++p;
-                break;
-            }
-
-            // floating point
-            case 'e': {
-                flags |= PrintFlags::Lowercase;
-                flags |= PrintFlags::Scientific;
-                ++p;
-                break;
-            }
-            case 'E': {
-                flags |= PrintFlags::Scientific;
-                ++p;
-                break;
-            }
-            case 'f': {
-                flags |= PrintFlags::TrailingZeroes | PrintFlags::Fixed;
-                ++p;
-                break;
-            }
-            case 'g': {
-                flags |= PrintFlags::Lowercase;
-                flags |= PrintFlags::General;
-                flags |= PrintFlags::Shortest;
-                ++p;
-                break;
-            }
-            case 'G': {
-                flags |= PrintFlags::General;
-                flags |= PrintFlags::Shortest;
-                ++p;
-                break;
-            }
-            case 'a': {
-                flags |= PrintFlags::Lowercase;
-                flags |= PrintFlags::Hex;
-                if (pound_specified) flags |= PrintFlags::PrependHex;
-                ++p;
-                break;
-            }
-            case 'A': {
-                flags |= PrintFlags::Hex;
-                if (pound_specified) flags |= PrintFlags::PrependHex;
-                ++p;
-                break;
-            }
-
-            // Non printf.
-            case 'n': {
-                flags |= PrintFlags::BoolAsNumber;
-                ++p;
-                break;
-            }
+static int tmp_snprint_result(tmp_memory_printer& mem, char* dest, tm_size_t len) {
+    if (mem.ec == TM_OK) {
+        // Force null termination, overwriting last character if must be.
+        // This is also the behavior of snprintf, we want to imitate it to minimize surprises.
+        if (mem.remaining()) {
+            *mem.end() = 0;
+        } else {
+            if (dest && len > 0) dest[len - 1] = 0;
         }
+        return (int)mem.size;
     }
+    if (mem.ec == TM_ERANGE) return (int)mem.necessary;
+    return -1;
+}
 
-    out->flags = flags;
-    return (tm_size_t)(p - format_specifiers);
+}  // anonymous namespace
+
+TMP_DEF tm_size_t tmp_parse_print_format(const char* format_specifiers, tm_size_t format_specifiers_len,
+                                         PrintFormat* out) {
+    TM_ASSERT(format_specifiers || format_specifiers_len == 0);
+    TM_ASSERT(out);
+    TM_ASSERT_VALID_SIZE(format_specifiers_len);
+    return tmp_parse_print_format_internal(format_specifiers, format_specifiers_len, out);
 }
 
 #ifndef TMP_NO_CRT_FILE_PRINTING
 TMP_DEF tm_errc tmp_print(FILE* out, const char* format, size_t format_len, const PrintFormat& initial_formatting,
                           const PrintArgList& args) {
     char sbo[TMP_SBO_SIZE];
-    tmp_memory_printer printer = {sbo, TMP_SBO_SIZE, tmp_default_allocator()};
+    tmp_scratch_printer scratch = {sbo, TMP_SBO_SIZE, tmp_default_allocator(),
+                                   tmp_estimate_print_size(format_len, args)};
+    tmp_memory_printer& printer = scratch.printer;
 
     tmp_print_impl(format, format_len, initial_formatting, args, printer);
     fwrite(printer.data, sizeof(char), printer.size, out);
@@ -2236,33 +4076,175 @@ TMP_DEF int tmp_snprint(char* dest, tm_size_t len, const char* format, size_t fo
     TM_ASSERT(dest || len == 0);
     tmp_memory_printer mem{dest, len};
     tmp_print_impl(format, format_len, initial_formatting, args, mem);
-    if (mem.ec == TM_OK) {
-        // Force null termination, overwriting last character if must be.
-        // This is also the behavior of snprintf, we want to imitate it to minimize surprises.
-        if (mem.remaining()) {
-            *mem.end() = 0;
-        } else {
-            if (dest && len > 0) dest[len - 1] = 0;
-        }
-        return (int)mem.size;
+    return tmp_snprint_result(mem, dest, len);
+}
+
+#ifndef TMP_NO_CRT_FILE_PRINTING
+TMP_DEF tm_errc tmp_print_segments(FILE* out, const char* format, const tmp_format_segment* segments,
+                                   tm_size_t segments_count, const PrintArgList& args) {
+    TM_ASSERT(segments || segments_count == 0);
+    char sbo[TMP_SBO_SIZE];
+    tmp_scratch_printer scratch = {sbo, TMP_SBO_SIZE, tmp_default_allocator(),
+                                   tmp_estimate_print_size(segments, segments_count, args)};
+    tmp_memory_printer& printer = scratch.printer;
+
+    tmp_print_segments_impl(format, segments, segments_count, args, printer);
+    fwrite(printer.data, sizeof(char), printer.size, out);
+    return printer.ec;
+}
+#endif  // !defined(TMP_NO_CRT_FILE_PRINTING)
+
+TMP_DEF int tmp_snprint_segments(char* dest, tm_size_t len, const char* format, const tmp_format_segment* segments,
+                                 tm_size_t segments_count, const PrintArgList& args) {
+    TM_ASSERT_VALID_SIZE(len);
+    TM_ASSERT(dest || len == 0);
+    TM_ASSERT(segments || segments_count == 0);
+    tmp_memory_printer mem{dest, len};
+    tmp_print_segments_impl(format, segments, segments_count, args, mem);
+    return tmp_snprint_result(mem, dest, len);
+}
+
+TMP_DEF tm_errc tmp_print(tmp_output_sink* sink, const char* format, size_t format_len,
+                          const PrintFormat& initial_formatting, const PrintArgList& args) {
+    TM_ASSERT(sink);
+    tm_size_t original_size = sink->size;
+    tmp_memory_printer printer{sink};
+    tmp_print_impl(format, format_len, initial_formatting, args, printer);
+    return tmp_finish_sink_print(sink, printer, original_size);
+}
+
+TMP_DEF tm_errc tmp_print_segments(tmp_output_sink* sink, const char* format, const tmp_format_segment* segments,
+                                   tm_size_t segments_count, const PrintArgList& args) {
+    TM_ASSERT(sink);
+    TM_ASSERT(segments || segments_count == 0);
+    tm_size_t original_size = sink->size;
+    tmp_memory_printer printer{sink};
+    tmp_print_segments_impl(format, segments, segments_count, args, printer);
+    return tmp_finish_sink_print(sink, printer, original_size);
+}
+
+TMP_DEF tmp_compile_format_result tmp_compile_format(const char* format, tm_size_t format_len,
+                                                     const PrintFormat& initial_formatting, uint64_t types,
+                                                     const unsigned char* extended_types, unsigned int args_count) {
+    TM_ASSERT(format || format_len == 0);
+    TM_ASSERT_VALID_SIZE(format_len);
+    TM_ASSERT(extended_types || args_count <= PrintType::Count);
+
+    tmp_compile_format_result result = {{nullptr, nullptr, 0, types, nullptr, args_count}, TM_OK};
+    auto parsed = tmp_parse_format_segments(format, format_len, initial_formatting, nullptr, 0);
+    if (parsed.ec != TM_OK) {
+        result.ec = parsed.ec;
+        return result;
     }
-    if (mem.ec == TM_ERANGE) return (int)mem.necessary;
-    return -1;
+
+    // Segments, extended types and the copy of the format string share one allocation.
+    size_t segments_size = (size_t)parsed.count * sizeof(tmp_format_segment);
+    size_t extended_types_size = (extended_types) ? (size_t)args_count : 0;
+    char* block = (char*)TM_MALLOC(segments_size + extended_types_size + (size_t)format_len + 1,
+                                   alignof(tmp_format_segment));
+    if (!block) {
+        result.ec = TM_ENOMEM;
+        return result;
+    }
+    result.format.segments = (tmp_format_segment*)block;
+    if (extended_types) {
+        result.format.extended_types = (unsigned char*)(block + segments_size);
+        TM_MEMCPY(result.format.extended_types, extended_types, extended_types_size);
+    }
+    result.format.format = block + segments_size + extended_types_size;
+    if (format_len > 0) TM_MEMCPY(result.format.format, format, (size_t)format_len);
+    result.format.format[format_len] = 0;
+    result.format.segments_count = parsed.count;
+    tmp_parse_format_segments(result.format.format, format_len, initial_formatting, result.format.segments,
+                              parsed.count);
+
+    if (tmp_check_format_segments(result.format.segments, parsed.count, types, extended_types, args_count) !=
+        tmp_format_valid) {
+        tmp_destroy_compiled_format(&result.format);
+        result.ec = TM_EINVAL;
+    }
+    return result;
+}
+
+TMP_DEF void tmp_destroy_compiled_format(tmp_compiled_format* format) {
+    TM_ASSERT(format);
+    // Format string and segments are one allocation, segments is the start of it.
+    if (format->segments) TM_FREE(format->segments);
+    format->format = nullptr;
+    format->segments = nullptr;
+    format->extended_types = nullptr;
+    format->segments_count = 0;
+}
+
+TMP_DEF tmp_output_sink tmp_make_buffer_sink(char* buffer, tm_size_t capacity) {
+    TM_ASSERT(buffer || capacity == 0);
+    TM_ASSERT_VALID_SIZE(capacity);
+    return {buffer, 0, capacity, /*write=*/nullptr, /*context=*/nullptr, /*growable=*/false};
+}
+
+TMP_DEF tmp_output_sink tmp_make_growable_sink() {
+    return {/*data=*/nullptr, 0, 0, /*write=*/nullptr, /*context=*/nullptr, /*growable=*/true};
+}
+
+TMP_DEF tmp_output_sink tmp_make_writer_sink(char* buffer, tm_size_t capacity, tmp_sink_write_proc* write,
+                                             void* context) {
+    TM_ASSERT(buffer || capacity == 0);
+    TM_ASSERT_VALID_SIZE(capacity);
+    TM_ASSERT(write);
+    return {buffer, 0, capacity, write, context, /*growable=*/false};
+}
+
+#ifndef TMP_NO_CRT_FILE_PRINTING
+TMP_DEF tmp_output_sink tmp_make_file_sink(FILE* out, char* buffer, tm_size_t capacity) {
+    TM_ASSERT(out);
+    return tmp_make_writer_sink(buffer, capacity, tmp_sink_write_file, out);
+}
+#endif  // !defined(TMP_NO_CRT_FILE_PRINTING)
+
+#ifndef TMP_NO_FD_SINK
+TMP_DEF tmp_output_sink tmp_make_fd_sink(int fd, char* buffer, tm_size_t capacity) {
+    TM_ASSERT(fd >= 0);
+    return tmp_make_writer_sink(buffer, capacity, tmp_sink_write_fd, (void*)(intptr_t)fd);
+}
+#endif  // !defined(TMP_NO_FD_SINK)
+
+TMP_DEF tm_errc tmp_flush_sink(tmp_output_sink* sink) {
+    TM_ASSERT(sink);
+    if (!sink->write || sink->size <= 0) return TM_OK;
+    tm_errc result = sink->write(sink->context, sink->data, sink->size);
+    if (result == TM_OK) sink->size = 0;
+    return result;
+}
+
+TMP_DEF void tmp_destroy_sink(tmp_output_sink* sink) {
+    TM_ASSERT(sink);
+    if (sink->growable && sink->data) TM_FREE(sink->data);
+    sink->data = nullptr;
+    sink->size = 0;
+    sink->capacity = 0;
 }
 
 #ifdef TMP_USE_STL
 TMP_DEF ::std::string tmp_string_format(const char* format, size_t format_len, const PrintFormat& initial_formatting,
                                         const PrintArgList& args) {
     ::std::string result;
-    tmp_memory_printer mem{nullptr, 0, tmp_std_string_allocator(&result)};
-    tmp_print_impl(format, format_len, initial_formatting, args, mem);
-    if (mem.ec == TM_OK) {
-        // Resize resulting string to the actual size consumed by memory printer.
-        // Memory printer will allocate in advance and then might not use all of the capacity.
-        result.resize(mem.size);
-    } else {
-        result.clear();
-    }
+    char sbo[TMP_SBO_SIZE];
+    tmp_scratch_printer scratch = {sbo, TMP_SBO_SIZE, tmp_std_string_allocator(&result),
+                                   tmp_estimate_print_size(format_len, args)};
+    tmp_print_impl(format, format_len, initial_formatting, args, scratch.printer);
+    tmp_finish_string_format(scratch, &result);
+    return result;
+}
+
+TMP_DEF ::std::string tmp_string_format_segments(const char* format, const tmp_format_segment* segments,
+                                                 tm_size_t segments_count, const PrintArgList& args) {
+    TM_ASSERT(segments || segments_count == 0);
+    ::std::string result;
+    char sbo[TMP_SBO_SIZE];
+    tmp_scratch_printer scratch = {sbo, TMP_SBO_SIZE, tmp_std_string_allocator(&result),
+                                   tmp_estimate_print_size(segments, segments_count, args)};
+    tmp_print_segments_impl(format, segments, segments_count, args, scratch.printer);
+    tmp_finish_string_format(scratch, &result);
     return result;
 }
 #endif /* defined(TMP_USE_STL) */
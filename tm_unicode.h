@@ -1,5 +1,5 @@
 /*
-tm_unicode.h v0.9.4 - public domain - https://github.com/to-miz/tm
+tm_unicode.h v0.9.14 - public domain - https://github.com/to-miz/tm
 Author: Tolga Mizrak 2020
 
 No warranty; use at your own risk.
@@ -83,7 +83,7 @@ SWITCHES
 
 NOTES
     Compiling with -std=c99 on gcc/clang with file io:
-    You need to additionally pass in -D_XOPEN_SOURCE=500 -D_DEFAULT_SOURCE as options, so that some more advanced
+    You need to additionally pass in -D_XOPEN_SOURCE=700 -D_DEFAULT_SOURCE as options, so that some more advanced
     posix functions are defined in the headers, that are otherwise not defined because of c99.
 
 ISSUES
@@ -91,12 +91,29 @@ ISSUES
       like turkic languages with dotted uppercase I).
     - No conditional special casing support, like for instance FINAL SIGMA
       (sigma character at the end of a word has a different lowercase variant).
-    - tmu_atomic_write not implemented yet for CRT backend.
     - tmu_utf8_width not implemented properly yet, it calculates the width of all codepoints of a string instead of
       calculating the width of display glyphs.
     - Grapheme break detection not implemented yet.
 
 HISTORY    (DD.MM.YY)
+    v0.9.14 19.10.26 Added tmu_detect_encoding, tmu_encoding_unknown now also detects utf16 and utf32 without
+                     byte order mark.
+    v0.9.13 19.10.26 Added tmu_utf8_split_chunks, tmu_utf8_valid_range_parallel and
+                     tmu_utf8_count_codepoints_parallel for processing large buffers on a caller supplied thread pool.
+    v0.9.12 19.10.26 Added tmu_utf8_span_category and tmu_utf8_span_not_category.
+    v0.9.11 19.10.26 Added tmu_utf8_offset_index for codepoint index to byte offset conversions.
+                     Counting codepoints now counts valid ranges 8 octets at a time.
+    v0.9.10 19.10.26 Added tmu_utf8_transcoder for converting chunked input to utf8.
+                     Ascii runs are now validated and converted 8 octets at a time.
+    v0.9.9  19.10.26 Added tmu_utf8_make_sort_key and tmu_utf8_make_sort_key_simple.
+    v0.9.8  19.10.26 Added tmu_utf8_next_word_break and tmu_utf8_next_sentence_break (UAX #29) for Unicode data
+                     generated with the word_break and sentence_break flags.
+    v0.9.7  19.10.26 Added ASCII fast paths to lowercasing, case folding and case insensitive comparisons.
+                     Fixed case insensitive comparisons treating a string as equal to its prefix.
+    v0.9.6  19.10.26 Added tmu_read_directory_batch and tmu_walk_directory.
+                     Fixed tmu_read_directory reporting entries of unknown type as files on Unix.
+    v0.9.5  19.10.26 Added tmu_file_writer for buffered writing of files and tmu_sync_write.
+                     Implemented tmu_atomic_write for CRT backend.
     v0.9.4 19.11.20 Changed the signature of TM_MALLOC to be less restrictive.
     v0.9.3  12.08.20 Removed *_managed functions, use tm_resource_ptr instead for RAII.
     v0.9.2  08.08.20 Added tmu_printf, tmu_vprintf, tmu_fprintf, tmu_vfprintf.
@@ -304,6 +321,8 @@ TMU_UCD_DEF tmu_ucd_case_info_enum tmu_ucd_get_case_info(uint32_t codepoint);
 #define TMU_UCD_HAS_SIMPLE_CASE 0
 #define TMU_UCD_HAS_SIMPLE_CASE_FOLD 1
 #define TMU_UCD_HAS_SIMPLE_CASE_TOGGLE 0
+#define TMU_UCD_HAS_WORD_BREAK 0
+#define TMU_UCD_HAS_SENTENCE_BREAK 0
 
 #ifdef __cplusplus
 }
@@ -474,6 +493,28 @@ size.
 TMU_DEF tm_bool tmu_utf8_append(uint32_t codepoint, tmu_utf8_output_stream* stream);
 TMU_DEF tm_bool tmu_utf16_append(uint32_t codepoint, tmu_utf16_output_stream* stream);
 
+/* How many octets at the start of the input are sampled to detect the encoding. */
+#define TMU_DETECT_SAMPLE_SIZE 4096
+
+typedef struct {
+    tmu_encoding encoding;
+    int confidence; /* From 0 to 100. */
+} tmu_encoding_detection;
+
+/*
+Detect the encoding of raw bytes.
+A byte order mark is detected with a confidence of 100. Otherwise the first TMU_DETECT_SAMPLE_SIZE octets are
+sampled: zero octets are counted by position to detect utf16/utf32 text, and utf8 validity is checked.
+Input that can't be identified is reported as utf8 with low confidence.
+When converting with tmu_encoding_unknown, the detected encoding is used if the confidence is at least 50.
+Params:
+    input:     Raw input bytes. Can be NULL iff input_len == 0.
+    input_len: Length of the input in bytes.
+Returns:
+    Returns the detected encoding and a confidence score.
+*/
+TMU_DEF tmu_encoding_detection tmu_detect_encoding(const void* input, tm_size_t input_len);
+
 /*
 Convert raw bytes from an untrusted origin to utf8. This function may take ownership of the buffer pointed to
 in the input argument if it already is in utf8 encoding. In that case input will be zeroed out to denote a move
@@ -523,6 +564,94 @@ TMU_DEF tmu_conversion_result tmu_utf8_convert_from_bytes(const void* input, tm_
                                                           tm_size_t replace_str_len, tm_bool nullterminate, char* out,
                                                           tm_size_t out_len);
 
+/*
+Resumable transcoder from raw bytes to utf8, for input that arrives in chunks (files, sockets etc.).
+Partial sequences and byte order mark detection are carried across chunks in the transcoder, so that the
+output is the same as converting the whole input at once with tmu_utf8_convert_from_bytes.
+Memory usage is independent of the input size, output is written into a caller provided buffer.
+If the encoding has to be detected, the first TMU_DETECT_SAMPLE_SIZE octets of the input are buffered in the
+transcoder before any output is produced.
+Usage:
+    tmu_utf8_transcoder transcoder = tmu_utf8_make_transcoder(tmu_encoding_unknown, tmu_validate_replace,
+                                                              "\xEF\xBF\xBD", 3);
+    while ((chunk_len = read_chunk(chunk, sizeof(chunk))) != 0) {
+        const char* cur = chunk;
+        while (chunk_len) {
+            tmu_transcode_result r = tmu_utf8_transcode(&transcoder, cur, chunk_len, out, sizeof(out));
+            if (r.ec != TM_OK) return r.ec;
+            write_output(out, r.size);
+            cur += r.consumed;
+            chunk_len -= r.consumed;
+        }
+    }
+    for (;;) {
+        tmu_transcode_result r = tmu_utf8_transcode_finish(&transcoder, out, sizeof(out));
+        write_output(out, r.size);
+        if (r.ec != TM_ERANGE || r.size == 0) break;
+    }
+*/
+typedef struct {
+    tmu_encoding encoding;          /* Encoding of the input, resolved once the byte order mark was inspected. */
+    tmu_encoding original_encoding; /* Encoding of the input including whether it had a byte order mark. */
+    tmu_validate validate;
+    const char* replace_str;
+    tm_size_t replace_str_len;
+    char window[TMU_DETECT_SAMPLE_SIZE]; /* Start of the input, buffered until the encoding is resolved. */
+    tm_size_t window_size;
+    tm_size_t window_pos; /* How many octets of the window were converted already. */
+    char pending[4];      /* Input octets of an incomplete sequence, carried to the next chunk. */
+    tm_size_t pending_size;
+    tm_bool bom_checked;
+    tm_bool invalid_codepoints_encountered;
+} tmu_utf8_transcoder;
+
+typedef struct {
+    tm_size_t consumed; /* How many octets of the input were consumed, either converted or buffered. */
+    tm_size_t size;     /* How many octets were written to out. */
+    tm_errc ec;
+} tmu_transcode_result;
+
+/*
+Create a transcoder.
+Params:
+    encoding:        The encoding of the input. If the encoding is unknown and should be detected,
+                     pass tmu_encoding_unknown. Without a byte order mark, the encoding is then guessed from the
+                     first TMU_DETECT_SAMPLE_SIZE octets of the input, see tmu_detect_encoding.
+    validate:        How to handle invalid codepoints.
+    replace_str:     String to replace invalid codepoints with. Only used if validate == tmu_validate_replace.
+    replace_str_len: Length of replace_str.
+*/
+TMU_DEF tmu_utf8_transcoder tmu_utf8_make_transcoder(tmu_encoding encoding, tmu_validate validate,
+                                                     const char* replace_str, tm_size_t replace_str_len);
+
+/*
+Convert the next chunk of input to utf8. Output is never nullterminated.
+Params:
+    transcoder: Transcoder created by tmu_utf8_make_transcoder.
+    input:      Next chunk of raw input bytes. Can be NULL iff input_len == 0.
+    input_len:  Length of the input in bytes.
+    out:        Output buffer. Can be NULL iff out_len == 0.
+    out_len:    Length of the buffer specified by out parameter.
+Return:
+    Returns how much input was consumed, how much of out was written and an error code.
+    If out is full, consumed will be less than input_len and the call has to be repeated with the remaining input.
+    Returns TM_ERANGE if out is too small to make any progress.
+    Returns TM_EINVAL if validate == tmu_validate_error and invalid input was encountered or if a byte order mark was
+    expected but not found. The transcoder can't be used after TM_EINVAL was returned.
+*/
+TMU_DEF tmu_transcode_result tmu_utf8_transcode(tmu_utf8_transcoder* transcoder, const void* input,
+                                                tm_size_t input_len, char* out, tm_size_t out_len);
+
+/*
+Convert any remaining buffered input at the end of the input.
+Incomplete sequences are treated as invalid codepoints. Trailing octets that don't make up a whole code unit
+in utf16 or utf32 result in TM_EINVAL.
+Return:
+    Returns TM_ERANGE if out was not big enough to hold all remaining output, in which case the call has to be
+    repeated after consuming out.
+*/
+TMU_DEF tmu_transcode_result tmu_utf8_transcode_finish(tmu_utf8_transcoder* transcoder, char* out, tm_size_t out_len);
+
 TMU_DEF tmu_conversion_result tmu_utf8_from_utf16(tmu_utf16_stream stream, char* out, tm_size_t out_len);
 TMU_DEF tmu_conversion_result tmu_utf16_from_utf8(tmu_utf8_stream stream, tmu_char16* out, tm_size_t out_len);
 
@@ -561,6 +690,121 @@ TMU_DEF tm_size_t tmu_utf8_count_codepoints(const char* str);
 TMU_DEF tm_size_t tmu_utf8_count_codepoints_n(const char* str, tm_size_t str_len);
 TMU_DEF tm_size_t tmu_utf8_count_codepoints_stream(tmu_utf8_stream stream);
 
+/*
+Sparse index for converting between codepoint indices and byte offsets in large utf8 buffers.
+A checkpoint (codepoint index and byte offset) is stored at most every 'interval' codepoints, queries binary search
+the checkpoints and then scan at most one interval forward. The index doesn't keep a pointer to the buffer, the
+current buffer has to be passed to every call.
+The buffer is expected to be valid utf8. Every octet that isn't a continuation octet starts a codepoint.
+*/
+typedef struct {
+    tm_size_t index;  /* Codepoint index. */
+    tm_size_t offset; /* Byte offset of the codepoint. */
+} tmu_utf8_checkpoint;
+
+typedef struct {
+    tmu_utf8_checkpoint* checkpoints;
+    tm_size_t count;
+    tm_size_t capacity;
+    tm_size_t interval;
+    tm_size_t codepoints; /* Number of codepoints in the indexed buffer. */
+    tm_size_t size;       /* Size of the indexed buffer in bytes. */
+} tmu_utf8_offset_index;
+
+typedef struct {
+    tmu_utf8_offset_index index;
+    tm_errc ec;
+} tmu_utf8_offset_index_result;
+
+/*
+Build an index over a utf8 buffer.
+Params:
+    str:      The utf8 buffer. Can be NULL iff str_len == 0.
+    str_len:  Length of the buffer in bytes.
+    interval: Number of codepoints between checkpoints. Must be greater than zero.
+Returns:
+    Returns the index and TM_OK on success, TM_ENOMEM if the checkpoints couldn't be allocated.
+    The index must be destroyed with tmu_utf8_destroy_offset_index.
+*/
+TMU_DEF tmu_utf8_offset_index_result tmu_utf8_make_offset_index(const char* str, tm_size_t str_len,
+                                                                tm_size_t interval);
+TMU_DEF void tmu_utf8_destroy_offset_index(tmu_utf8_offset_index* index);
+
+/*
+Byte offset of the codepoint at codepoint_index. Returns index->size if codepoint_index >= index->codepoints.
+*/
+TMU_DEF tm_size_t tmu_utf8_offset_index_to_offset(const tmu_utf8_offset_index* index, const char* str,
+                                                  tm_size_t codepoint_index);
+/*
+Index of the codepoint that contains the octet at offset. Returns index->codepoints if offset >= index->size.
+*/
+TMU_DEF tm_size_t tmu_utf8_offset_index_to_codepoint(const tmu_utf8_offset_index* index, const char* str,
+                                                     tm_size_t offset);
+
+/*
+Update the index after an edit, without rescanning the whole buffer.
+Only the edited range and the checkpoints surrounding it are rescanned, later checkpoints are shifted.
+Params:
+    index:        The index to update.
+    str:          The buffer after the edit.
+    str_len:      Length of the buffer after the edit.
+    edit_offset:  Byte offset where the edit took place. Must be on a codepoint boundary.
+    removed_len:  How many bytes were removed at edit_offset.
+    inserted_len: How many bytes were inserted at edit_offset.
+Returns:
+    Returns TM_OK on success, TM_ENOMEM if the checkpoints couldn't be reallocated. In that case the index is
+    left unchanged.
+*/
+TMU_DEF tm_errc tmu_utf8_offset_index_update(tmu_utf8_offset_index* index, const char* str, tm_size_t str_len,
+                                             tm_size_t edit_offset, tm_size_t removed_len, tm_size_t inserted_len);
+
+/*
+Processing of large utf8 buffers in parallel.
+This library doesn't create threads itself. Instead the caller supplies a tmu_parallel_for_proc that calls
+task(task_data, i) for every i in [0, count) on its own worker pool and only returns once all tasks are finished.
+The tasks are independent of each other and can run in any order. A serial implementation looks like this:
+    void serial_for(void* user_data, tm_size_t count, tmu_task_proc* task, void* task_data) {
+        for (tm_size_t i = 0; i < count; ++i) task(task_data, i);
+    }
+*/
+typedef void tmu_task_proc(void* task_data, tm_size_t index);
+typedef void tmu_parallel_for_proc(void* user_data, tm_size_t count, tmu_task_proc* task, void* task_data);
+
+typedef struct {
+    tm_size_t offset;
+    tm_size_t size;
+} tmu_utf8_chunk;
+
+/*
+Split a buffer into consecutive chunks of about chunk_size bytes without splitting multibyte sequences.
+Chunks can then be processed independently, for instance by converting each chunk into its own output buffer.
+Params:
+    str:        The utf8 buffer. Can be NULL iff str_len == 0.
+    str_len:    Length of the buffer in bytes.
+    chunk_size: Size of the chunks in bytes. Values less than 16 are treated as 16.
+    out:        Output array of chunks. Can be NULL iff out_len == 0.
+    out_len:    Length of the output array.
+Returns:
+    Returns the number of chunks, of which the first out_len are written to out.
+*/
+TMU_DEF tm_size_t tmu_utf8_split_chunks(const char* str, tm_size_t str_len, tm_size_t chunk_size, tmu_utf8_chunk* out,
+                                        tm_size_t out_len);
+
+/*
+Parallel versions of tmu_utf8_valid_range and tmu_utf8_count_codepoints_n, the results are identical to the serial
+versions. The buffer is split with tmu_utf8_split_chunks, the chunks are processed by parallel_for and the results
+are merged afterwards.
+Params:
+    chunk_size:   Size of the chunks in bytes, pass 0 for a default of 1 MiB.
+    parallel_for: Runs the tasks on a worker pool, see tmu_parallel_for_proc.
+    user_data:    Passed through to parallel_for.
+If the chunk array can't be allocated, the buffer is processed serially on the calling thread.
+*/
+TMU_DEF tm_size_t tmu_utf8_valid_range_parallel(const char* str, tm_size_t str_len, tm_size_t chunk_size,
+                                                tmu_parallel_for_proc* parallel_for, void* user_data);
+TMU_DEF tm_size_t tmu_utf8_count_codepoints_parallel(const char* str, tm_size_t str_len, tm_size_t chunk_size,
+                                                     tmu_parallel_for_proc* parallel_for, void* user_data);
+
 /* The following functions depend on Unicode data being present.
    The default unicode data supplied with this library doesn't supply all of the data supported.
    If more functionality is needed (like transforming strings to uppercase/lowercase etc.), then a different set of
@@ -579,6 +823,31 @@ TMU_DEF tm_bool tmu_is_punctuation(uint32_t codepoint);
 TMU_DEF tm_bool tmu_is_symbol(uint32_t codepoint);
 TMU_DEF tm_bool tmu_is_separator(uint32_t codepoint);
 TMU_DEF tm_bool tmu_is_whitespace(uint32_t codepoint);
+
+/* Category masks for tmu_utf8_span_category. */
+enum {
+    tmu_category_control = (1u << tmu_ucd_category_control),
+    tmu_category_letter = (1u << tmu_ucd_category_letter),
+    tmu_category_mark = (1u << tmu_ucd_category_mark),
+    tmu_category_number = (1u << tmu_ucd_category_number),
+    tmu_category_punctuation = (1u << tmu_ucd_category_punctuation),
+    tmu_category_symbol = (1u << tmu_ucd_category_symbol),
+    tmu_category_separator = (1u << tmu_ucd_category_separator),
+    tmu_category_whitespace = (1u << 7) /* Matches if tmu_is_whitespace returns true. */
+};
+
+/*
+Span the run of codepoints at the start of the stream that match (or don't match) a category mask.
+Runs of ascii are classified 16 octets at a time using bitmaps, only non-ascii codepoints are looked up in the UCD.
+Params:
+    stream: Input stream.
+    mask:   Bitwise or of tmu_category_* values. A codepoint matches if its category or whitespace property is
+            in the mask.
+Returns:
+    Returns the length in bytes of the run. An invalid byte sequence ends the run.
+*/
+TMU_DEF tm_size_t tmu_utf8_span_category(tmu_utf8_stream stream, uint32_t mask);
+TMU_DEF tm_size_t tmu_utf8_span_not_category(tmu_utf8_stream stream, uint32_t mask);
 #endif /* TMU_UCD_HAS_CATEGORY */
 
 #if TMU_UCD_HAS_CASE_INFO
@@ -588,11 +857,40 @@ TMU_DEF tm_bool tmu_is_title(uint32_t codepoint);
 TMU_DEF tm_bool tmu_is_caseless(uint32_t codepoint);
 #endif /* TMU_UCD_HAS_CATEGORY */
 
+#if TMU_UCD_HAS_GRAPHEME_BREAK
+/*
+Like tmu_utf8_split_chunks, but chunks also don't split grapheme clusters.
+Chunks only end where a grapheme cluster boundary is certain without looking further back, i.e. between codepoints
+of the grapheme break classes Other, Control, CR, LF and Extended_Pictographic (except CR LF). If there is no
+such boundary within 32 codepoints of the intended end, the chunk ends at a codepoint boundary instead.
+*/
+TMU_DEF tm_size_t tmu_utf8_split_chunks_graphemes(const char* str, tm_size_t str_len, tm_size_t chunk_size,
+                                                  tmu_utf8_chunk* out, tm_size_t out_len);
+#endif
+
 #if TMU_UCD_HAS_WIDTH
 TMU_DEF int tmu_utf8_width(tmu_utf8_stream stream);
 TMU_DEF int tmu_utf8_width_n(const char* str, tm_size_t str_len);
 #endif
 
+/*
+Text segmentation according to Unicode Standard Annex #29 (https://www.unicode.org/reports/tr29/).
+These require Unicode data generated with the word_break/sentence_break flags of tools/unicode_gen.
+Params:
+    stream: Input stream to segment.
+Returns:
+    Returns a pointer to the next word/sentence boundary after stream.cur, or stream.end if there is none.
+    An invalid byte sequence is treated as a segment of its own.
+    To iterate over all segments, set stream.cur to the returned value until it is equal to stream.end.
+*/
+#if TMU_UCD_HAS_WORD_BREAK
+TMU_DEF const char* tmu_utf8_next_word_break(tmu_utf8_stream stream);
+#endif /* TMU_UCD_HAS_WORD_BREAK */
+
+#if TMU_UCD_HAS_SENTENCE_BREAK
+TMU_DEF const char* tmu_utf8_next_sentence_break(tmu_utf8_stream stream);
+#endif /* TMU_UCD_HAS_SENTENCE_BREAK */
+
 #if TMU_UCD_HAS_SIMPLE_CASE
 TMU_DEF tmu_transform_result tmu_utf8_to_upper_simple(const char* str, tm_size_t str_len, char* out, tm_size_t out_len);
 TMU_DEF tmu_transform_result tmu_utf8_to_title_simple(const char* str, tm_size_t str_len, char* out, tm_size_t out_len);
@@ -606,6 +904,8 @@ TMU_DEF tm_bool tmu_utf8_equals_ignore_case_simple(const char* a, tm_size_t a_le
 TMU_DEF int tmu_utf8_compare_ignore_case_simple(const char* a, tm_size_t a_len, const char* b, tm_size_t b_len);
 /* String comparison for humans. See http://stereopsis.com/strcmp4humans.html. */
 TMU_DEF int tmu_utf8_human_compare_simple(const char* a, tm_size_t a_len, const char* b, tm_size_t b_len);
+TMU_DEF tmu_transform_result tmu_utf8_make_sort_key_simple(const char* str, tm_size_t str_len, char* out,
+                                                           tm_size_t out_len);
 #endif /* TMU_UCD_HAS_SIMPLE_CASE_FOLD */
 
 #if TMU_UCD_HAS_SIMPLE_CASE_TOGGLE
@@ -629,6 +929,20 @@ TMU_DEF tm_bool tmu_utf8_equals_ignore_case(const char* a, tm_size_t a_len, cons
 TMU_DEF int tmu_utf8_compare_ignore_case(const char* a, tm_size_t a_len, const char* b, tm_size_t b_len);
 /* String comparison for humans. See http://stereopsis.com/strcmp4humans.html. */
 TMU_DEF int tmu_utf8_human_compare(const char* a, tm_size_t a_len, const char* b, tm_size_t b_len);
+
+/*
+Transforms a string into a sort key, so that sorting many strings doesn't need to case fold them on every comparison.
+Comparing two sort keys bytewise with tmu_utf8_compare (or any comparison that orders a prefix first) gives the same
+order as comparing the original strings with tmu_utf8_human_compare (tmu_utf8_human_compare_simple for
+tmu_utf8_make_sort_key_simple). Numbers are ordered by their value. Values of 2146369536 (2^31 - 0x110000) and
+above saturate and compare equal to each other, just like in tmu_utf8_human_compare.
+For the order of tmu_utf8_compare_ignore_case, the output of tmu_utf8_to_case_fold already is a valid sort key.
+Returns:
+    Returns the size of the key and TM_OK on success. The key is not nullterminated and not necessarily valid UTF-8.
+    Returns TM_ERANGE and the required size if out_len is too small.
+    Returns TM_EINVAL if str is not valid UTF-8.
+*/
+TMU_DEF tmu_transform_result tmu_utf8_make_sort_key(const char* str, tm_size_t str_len, char* out, tm_size_t out_len);
 #endif /* TMU_UCD_HAS_FULL_CASE_FOLD */
 
 #endif /* defined(TMU_UCD_HAS_CASE_INFO) */
@@ -676,11 +990,51 @@ enum {
 
     /* Write file by first writing to a temporary file, then move file into destination. */
     tmu_atomic_write = (1u << 4u),
+
+    /* Flush file contents to disk before closing. Always done for tmu_atomic_write before moving the file. */
+    tmu_sync_write = (1u << 5u),
 };
 TMU_DEF tmu_write_file_result tmu_write_file_ex(const char* filename, const void* data, tm_size_t size, uint32_t flags);
 TMU_DEF tmu_write_file_result tmu_write_file_as_utf8_ex(const char* filename, const char* data, tm_size_t size,
                                                         uint32_t flags);
 
+/*
+Buffered file writer for writing files in pieces without having to hold the whole contents in memory.
+Writes are collected in a buffer of buffer_capacity bytes and written to the file in large chunks.
+Writes that don't fit into the buffer are written directly. A buffer_capacity of 0 disables buffering.
+
+Flags are the same as for tmu_write_file_ex. With tmu_atomic_write, data is written into a newly created
+temporary file in the same directory as filename. On tmu_file_writer_close the temporary file is synced to disk
+and then moved into the destination, so the destination either has the old or the complete new contents.
+On POSIX the directory is synced after the move as well.
+
+The first error is stored in ec, all subsequent writes will return that error without writing anything.
+tmu_file_writer_close must be called to commit the file, tmu_file_writer_discard to abort.
+Both free all resources held by the writer.
+*/
+#ifndef TMU_FILE_WRITER_DEFAULT_BUFFER_SIZE
+    #define TMU_FILE_WRITER_DEFAULT_BUFFER_SIZE (64u * 1024u)
+#endif
+
+typedef struct {
+    tm_errc ec;
+    tm_size_t written; /* Number of bytes written so far, including bytes still in the buffer. */
+    uint32_t flags;
+
+    char* buffer;
+    tm_size_t buffer_size;
+    tm_size_t buffer_capacity;
+
+    void* internal_handle;
+    void* internal_paths; /* Destination and temporary filename when writing atomically. */
+} tmu_file_writer;
+
+TMU_DEF tmu_file_writer tmu_file_writer_open(const char* filename, uint32_t flags, tm_size_t buffer_capacity);
+TMU_DEF tm_errc tmu_file_writer_write(tmu_file_writer* writer, const void* data, tm_size_t size);
+TMU_DEF tm_errc tmu_file_writer_flush(tmu_file_writer* writer);
+TMU_DEF tmu_write_file_result tmu_file_writer_close(tmu_file_writer* writer);
+TMU_DEF void tmu_file_writer_discard(tmu_file_writer* writer);
+
 TMU_DEF tm_errc tmu_rename_file(const char* from, const char* to);
 TMU_DEF tm_errc tmu_rename_file_ex(const char* from, const char* to, uint32_t flags);
 
@@ -704,6 +1058,7 @@ typedef struct {
     tmu_read_directory_result internal_result;
 
     tmu_contents internal_buffer;
+    tmu_contents internal_names;
     void* internal;
 } tmu_opened_dir;
 
@@ -714,6 +1069,65 @@ TMU_DEF tmu_opened_dir tmu_open_directory(const char* dir);
 TMU_DEF void tmu_close_directory(tmu_opened_dir* dir);
 TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir);
 
+enum {
+    tmu_read_directory_stat = (1u << 0u), /* Also retrieve size and file_time of every entry. */
+};
+
+typedef struct {
+    const char* name;        /* Either filename or directory name. */
+    tm_bool is_file;         /* Whether entry is a file or a directory. */
+    tm_bool has_stat;        /* Whether size and file_time are valid. */
+    uint64_t size;           /* Size of the file in bytes. */
+    tmu_file_time file_time; /* Last write time, see tmu_file_timestamp. */
+} tmu_directory_entry;
+
+/*!
+ * @brief Reads up to entries_capacity entries of an opened directory at once.
+ * Names are stored in a buffer owned by dir and stay valid until the next call to tmu_read_directory_batch or
+ * tmu_close_directory. If entries_capacity is large enough, the amount of function call and allocation overhead per
+ * entry is much smaller than with tmu_read_directory.
+ * On Windows size and file_time are always retrieved, since they are part of the directory listing.
+ * On Unix they are only retrieved if tmu_read_directory_stat is passed, since they need an additional fstatat call
+ * per entry. Entries whose type can't be determined from the directory listing alone are always stat'ed.
+ * @param dir The opened directory.
+ * @param entries Output array of entries.
+ * @param entries_capacity Capacity of the entries array.
+ * @param flags Either 0 or tmu_read_directory_stat.
+ * @return The number of entries read. Returns 0 if there are no more entries or on error. Errors are reported in dir->ec.
+ */
+TMU_DEF tm_size_t tmu_read_directory_batch(tmu_opened_dir* dir, tmu_directory_entry* entries,
+                                           tm_size_t entries_capacity, uint32_t flags);
+
+typedef enum {
+    tmu_walk_continue, /* Continue walking, descends into the entry if it is a directory. */
+    tmu_walk_skip,     /* Do not descend into the entry. */
+    tmu_walk_stop,     /* Stop walking altogether. */
+} tmu_walk_action;
+
+/*!
+ * @brief Callback of tmu_walk_directory.
+ * @param user_data The user_data pointer passed to tmu_walk_directory.
+ * @param path The path of the entry, including the directory passed to tmu_walk_directory. Directory paths end in '/'.
+ * Only valid for the duration of the callback.
+ * @param entry The entry itself.
+ */
+typedef tmu_walk_action (*tmu_walk_directory_callback)(void* user_data, const char* path,
+                                                        const tmu_directory_entry* entry);
+
+/*!
+ * @brief Recursively walks a directory tree, depth first, and calls callback for every entry.
+ * Directories are passed to callback before their contents. Returning tmu_walk_skip from callback for a
+ * directory skips its contents. This can be used to distribute work, i.e. pushing the directory path to a work queue
+ * and calling tmu_walk_directory on it from a different thread.
+ * @param dir The directory to walk.
+ * @param flags Either 0 or tmu_read_directory_stat, see tmu_read_directory_batch.
+ * @param callback The callback to invoke for every entry.
+ * @param user_data Passed through to callback.
+ * @return TM_OK on success, TM_ECANCELED if callback returned tmu_walk_stop, otherwise the first error encountered.
+ */
+TMU_DEF tm_errc tmu_walk_directory(const char* dir, uint32_t flags, tmu_walk_directory_callback callback,
+                                   void* user_data);
+
 #if 0
 typedef enum {
     tmu_path_is_file,
@@ -858,6 +1272,7 @@ TMU_DEF tmu_utf8_contents_result tmu_read_file_as_utf8_ex(TM_STRING_VIEW filenam
 TMU_DEF tmu_write_file_result tmu_write_file_as_utf8(TM_STRING_VIEW filename, const char* data, tm_size_t size);
 TMU_DEF tmu_write_file_result tmu_write_file_as_utf8_ex(TM_STRING_VIEW filename, const char* data, tm_size_t size,
                                                         uint32_t flags);
+TMU_DEF tmu_file_writer tmu_file_writer_open(TM_STRING_VIEW filename, uint32_t flags, tm_size_t buffer_capacity);
 
 TMU_DEF tm_errc tmu_rename_file(TM_STRING_VIEW from, TM_STRING_VIEW to);
 TMU_DEF tm_errc tmu_rename_file_ex(TM_STRING_VIEW from, TM_STRING_VIEW to, uint32_t flags);
@@ -3547,6 +3962,16 @@ TMU_UCD_DEF tmu_ucd_case_info_enum tmu_ucd_get_case_info(uint32_t codepoint) {
 #define TMU_TRAILING_SURROGATE_MAX 0xDFFFu
 #define TMU_SURROGATE_OFFSET (0x10000u - (0xD800u << 10u) - 0xDC00u)
 #define TMU_INVALID_CODEPOINT 0xFFFFFFFFu
+#define TMU_DETECT_MIN_CONFIDENCE 50
+#define TMU_ASCII_ONES 0x0101010101010101ull
+#define TMU_ASCII_HIGH_BITS (TMU_ASCII_ONES * 0x80)
+
+/* Loads 8 bytes in little endian order, so that str[i] ends up in bits [i * 8, i * 8 + 8). */
+static uint64_t tmu_ascii_load(const char* str) {
+    const uint8_t* p = (const uint8_t*)str;
+    return (uint64_t)p[0] | ((uint64_t)p[1] << 8) | ((uint64_t)p[2] << 16) | ((uint64_t)p[3] << 24) |
+           ((uint64_t)p[4] << 32) | ((uint64_t)p[5] << 40) | ((uint64_t)p[6] << 48) | ((uint64_t)p[7] << 56);
+}
 
 /* Byte order marks for all encodings we can decode. */
 static const unsigned char tmu_utf8_bom[3] = {0xEF, 0xBB, 0xBF};
@@ -4114,6 +4539,187 @@ static tm_bool tmu_has_utf16_le_bom(tmu_byte_stream stream) {
            (unsigned char)stream.cur[1] == tmu_utf16_le_bom[1];
 }
 
+/*
+Counts zero octets by their position modulo 4 in the first len octets of str.
+Zero octets are found 8 at a time: adding 0x7F to the low 7 bits of an octet sets its high bit unless all bits are
+zero. The resulting flags are accumulated per octet lane and added up every 255 words before the lanes overflow.
+*/
+static void tmu_count_zero_octets(const char* str, tm_size_t len, tm_size_t zeros[4]) {
+    const uint64_t low_bits = TMU_ASCII_ONES * 0x7F;
+    zeros[0] = zeros[1] = zeros[2] = zeros[3] = 0;
+    tm_size_t i = 0;
+    while (len - i >= 8) {
+        uint64_t lanes = 0;
+        for (int words = 0; words < 255 && len - i >= 8; ++words, i += 8) {
+            uint64_t octets = tmu_ascii_load(str + i);
+            lanes += (~(((octets & low_bits) + low_bits) | octets | low_bits)) >> 7;
+        }
+        for (int lane = 0; lane < 8; ++lane) {
+            zeros[lane & 3] += (tm_size_t)((lanes >> (lane * 8)) & 0xFFu);
+        }
+    }
+    for (; i < len; ++i) {
+        if (str[i] == 0) ++zeros[i & 3];
+    }
+}
+
+/* Whether the units are valid utf16, a lead surrogate at the very end is allowed if the sample is partial. */
+static tm_bool tmu_utf16_sample_valid(const char* str, tm_size_t len, uint16_t (*extract)(tmu_byte_stream*),
+                                      tm_bool partial) {
+    tmu_byte_stream bytes = {TM_NULL, TM_NULL};
+    bytes.cur = str;
+    bytes.end = str + len;
+    while (bytes.end - bytes.cur >= 2) {
+        uint32_t unit = extract(&bytes);
+        if (unit >= TMU_TRAILING_SURROGATE_MIN && unit <= TMU_TRAILING_SURROGATE_MAX) return TM_FALSE;
+        if (unit >= TMU_LEAD_SURROGATE_MIN && unit <= TMU_LEAD_SURROGATE_MAX) {
+            if (bytes.end - bytes.cur < 2) return partial;
+            uint32_t trail = extract(&bytes);
+            if (trail < TMU_TRAILING_SURROGATE_MIN || trail > TMU_TRAILING_SURROGATE_MAX) return TM_FALSE;
+        }
+    }
+    return TM_TRUE;
+}
+
+static tm_bool tmu_utf32_sample_valid(const char* str, tm_size_t len, uint32_t (*extract)(tmu_byte_stream*)) {
+    tmu_byte_stream bytes = {TM_NULL, TM_NULL};
+    bytes.cur = str;
+    bytes.end = str + len;
+    while (bytes.end - bytes.cur >= 4) {
+        if (!tmu_is_valid_codepoint(extract(&bytes))) return TM_FALSE;
+    }
+    return TM_TRUE;
+}
+
+static tm_bool tmu_bytes_start_with(const char* str, tm_size_t len, const unsigned char* prefix, tm_size_t prefix_len) {
+    if (len < prefix_len) return TM_FALSE;
+    for (tm_size_t i = 0; i < prefix_len; ++i) {
+        if ((unsigned char)str[i] != prefix[i]) return TM_FALSE;
+    }
+    return TM_TRUE;
+}
+
+/* Partial means that str is only the start of the input, so its length says nothing about the code unit size. */
+static tmu_encoding_detection tmu_detect_encoding_internal(const char* str, tm_size_t len, tm_bool partial) {
+    TM_ASSERT(str || len == 0);
+
+    tmu_encoding_detection result = {tmu_encoding_utf8, 0};
+
+    /* Byte order marks, the utf32le byte order mark starts with the utf16le byte order mark. */
+    if (tmu_bytes_start_with(str, len, tmu_utf8_bom, 3)) {
+        result.encoding = tmu_encoding_utf8_bom;
+        result.confidence = 100;
+        return result;
+    }
+    if (tmu_bytes_start_with(str, len, tmu_utf32_be_bom, 4) || tmu_bytes_start_with(str, len, tmu_utf32_le_bom, 4)) {
+        result.encoding = ((unsigned char)str[0] == 0) ? tmu_encoding_utf32be_bom : tmu_encoding_utf32le_bom;
+        result.confidence = 100;
+        return result;
+    }
+    if (tmu_bytes_start_with(str, len, tmu_utf16_be_bom, 2) || tmu_bytes_start_with(str, len, tmu_utf16_le_bom, 2)) {
+        result.encoding = ((unsigned char)str[0] == 0xFE) ? tmu_encoding_utf16be_bom : tmu_encoding_utf16le_bom;
+        result.confidence = 100;
+        return result;
+    }
+
+    /* Only a sample of the input is inspected, aligned to whole utf32 units. */
+    tm_size_t sample_len = len;
+    if (sample_len > TMU_DETECT_SAMPLE_SIZE) {
+        sample_len = TMU_DETECT_SAMPLE_SIZE;
+        partial = TM_TRUE;
+    }
+    if (partial) sample_len -= sample_len % 4;
+    if (sample_len < 4) return result;
+
+    tm_size_t zeros[4];
+    tmu_count_zero_octets(str, sample_len, zeros);
+
+    /* Utf32: the highest octet of every unit is zero and the second highest mostly is. */
+    tm_size_t units32 = sample_len / 4;
+    if (partial || len % 4 == 0) {
+        if (zeros[3] == units32 && zeros[0] < units32 && zeros[2] * 2 >= units32 &&
+            tmu_utf32_sample_valid(str, sample_len, tmu_extract_u32_le)) {
+            result.encoding = tmu_encoding_utf32le;
+            result.confidence = (int)(50 + (49 * zeros[2]) / units32);
+            return result;
+        }
+        if (zeros[0] == units32 && zeros[3] < units32 && zeros[1] * 2 >= units32 &&
+            tmu_utf32_sample_valid(str, sample_len, tmu_extract_u32_be)) {
+            result.encoding = tmu_encoding_utf32be;
+            result.confidence = (int)(50 + (49 * zeros[1]) / units32);
+            return result;
+        }
+    }
+
+    /* Utf16: ascii and latin text has zero high octets, which are at odd positions for le and even ones for be. */
+    tm_size_t units16 = sample_len / 2;
+    tm_size_t zeros_even = zeros[0] + zeros[2];
+    tm_size_t zeros_odd = zeros[1] + zeros[3];
+    tm_bool utf16_possible = partial || len % 2 == 0;
+    if (utf16_possible) {
+        if (zeros_odd * 4 >= units16 && zeros_even * 16 <= zeros_odd &&
+            tmu_utf16_sample_valid(str, sample_len, tmu_extract_u16_le, partial)) {
+            result.encoding = tmu_encoding_utf16le;
+            result.confidence = (int)(50 + (49 * (zeros_odd - zeros_even)) / units16);
+            return result;
+        }
+        if (zeros_even * 4 >= units16 && zeros_odd * 16 <= zeros_even &&
+            tmu_utf16_sample_valid(str, sample_len, tmu_extract_u16_be, partial)) {
+            result.encoding = tmu_encoding_utf16be;
+            result.confidence = (int)(50 + (49 * (zeros_even - zeros_odd)) / units16);
+            return result;
+        }
+    }
+
+    /* Utf8, the sample may end in the middle of a sequence. */
+    tm_size_t valid = tmu_utf8_valid_range(str, sample_len);
+    if (valid < sample_len && partial && sample_len - valid < 4) {
+        uint32_t c0 = TMU_WIDEN(str[valid]);
+        tm_size_t sequence_size = 0;
+        if ((c0 & 0xE0u) == 0xC0u) {
+            sequence_size = 2;
+        } else if ((c0 & 0xF0u) == 0xE0u) {
+            sequence_size = 3;
+        } else if ((c0 & 0xF8u) == 0xF0u) {
+            sequence_size = 4;
+        }
+        if (sequence_size > sample_len - valid) valid = sample_len;
+    }
+    if (valid == sample_len) {
+        tm_bool has_multibyte = TM_FALSE;
+        tm_size_t i = 0;
+        for (; i + 8 <= sample_len && !has_multibyte; i += 8) {
+            has_multibyte = (tmu_ascii_load(str + i) & TMU_ASCII_HIGH_BITS) != 0;
+        }
+        for (; i < sample_len && !has_multibyte; ++i) {
+            has_multibyte = TMU_WIDEN(str[i]) >= 0x80u;
+        }
+        tm_bool has_zeros = (zeros_even + zeros_odd) != 0;
+        /* Multibyte sequences are unlikely to be valid by accident, pure ascii is also valid in other encodings. */
+        result.confidence = (has_multibyte) ? 100 : 90;
+        if (has_zeros) result.confidence -= 40;
+        return result;
+    }
+
+    /* Not utf8 and no zero octets, might be utf16 text without ascii (cjk for instance). */
+    if (utf16_possible) {
+        tm_bool le = tmu_utf16_sample_valid(str, sample_len, tmu_extract_u16_le, partial);
+        tm_bool be = tmu_utf16_sample_valid(str, sample_len, tmu_extract_u16_be, partial);
+        if (le != be) {
+            result.encoding = (le) ? tmu_encoding_utf16le : tmu_encoding_utf16be;
+            result.confidence = 40;
+            return result;
+        }
+    }
+    return result;
+}
+
+TMU_DEF tmu_encoding_detection tmu_detect_encoding(const void* input, tm_size_t input_len) {
+    TM_ASSERT(input || input_len == 0);
+    TM_ASSERT_VALID_SIZE(input_len);
+    return tmu_detect_encoding_internal((const char*)input, input_len, /*partial=*/TM_FALSE);
+}
+
 static void tmu_output_replace_invalid_utf8(tmu_conversion_output_stream* stream, const char* replace_str,
                                             tm_size_t replace_str_len) {
     tm_size_t cur = 0;
@@ -4223,9 +4829,38 @@ static tm_bool tmu_convert_bytes_to_utf8_internal(const void* input, tm_size_t i
             tmu_convert_bytes_from_utf16(bytes, tmu_extract_u16_le, validate, replace_str, replace_str_len,
                                          nullterminate, out_stream);
         } else {
-            /* No encoding detected, assume utf8. */
-            out_stream->conversion.original_encoding = tmu_encoding_utf8;
-            converted = TM_FALSE;
+            /* No byte order mark, guess the encoding from the contents and fall back to utf8 if unsure. */
+            tmu_encoding_detection detected =
+                tmu_detect_encoding_internal(bytes.cur, (tm_size_t)(bytes.end - bytes.cur), /*partial=*/TM_FALSE);
+            if (detected.confidence < TMU_DETECT_MIN_CONFIDENCE) detected.encoding = tmu_encoding_utf8;
+            out_stream->conversion.original_encoding = detected.encoding;
+            switch (detected.encoding) {
+                case tmu_encoding_utf32be: {
+                    tmu_convert_bytes_from_utf32(bytes, tmu_extract_u32_be, validate, replace_str, replace_str_len,
+                                                 nullterminate, out_stream);
+                    break;
+                }
+                case tmu_encoding_utf32le: {
+                    tmu_convert_bytes_from_utf32(bytes, tmu_extract_u32_le, validate, replace_str, replace_str_len,
+                                                 nullterminate, out_stream);
+                    break;
+                }
+                case tmu_encoding_utf16be: {
+                    tmu_convert_bytes_from_utf16(bytes, tmu_extract_u16_be, validate, replace_str, replace_str_len,
+                                                 nullterminate, out_stream);
+                    break;
+                }
+                case tmu_encoding_utf16le: {
+                    tmu_convert_bytes_from_utf16(bytes, tmu_extract_u16_le, validate, replace_str, replace_str_len,
+                                                 nullterminate, out_stream);
+                    break;
+                }
+                default: {
+                    out_stream->conversion.original_encoding = tmu_encoding_utf8;
+                    converted = TM_FALSE;
+                    break;
+                }
+            }
         }
 
         return converted;
@@ -4467,39 +5102,545 @@ TMU_DEF tmu_conversion_result tmu_utf8_convert_from_bytes(const void* input, tm_
     return out_stream.conversion;
 }
 
-TMU_DEF tm_size_t tmu_utf8_valid_range(const char* str, tm_size_t len) {
-    /* Checking for legal utf-8 byte sequences according to
-       https://www.unicode.org/versions/Unicode11.0.0/ch03.pdf
-       Table 3-7.  Well-Formed UTF-8 Byte Sequences */
+TMU_DEF tmu_utf8_transcoder tmu_utf8_make_transcoder(tmu_encoding encoding, tmu_validate validate,
+                                                     const char* replace_str, tm_size_t replace_str_len) {
+    TM_ASSERT(validate != tmu_validate_replace || (replace_str && replace_str_len > 0));
+    TM_ASSERT(encoding >= tmu_encoding_unknown && encoding <= tmu_encoding_utf32le_bom);
+
+    tmu_utf8_transcoder result;
+    result.encoding = encoding;
+    result.original_encoding = encoding;
+    result.validate = validate;
+    result.replace_str = replace_str;
+    result.replace_str_len = replace_str_len;
+    result.window_size = 0;
+    result.window_pos = 0;
+    result.pending_size = 0;
+    result.bom_checked = TM_FALSE;
+    result.invalid_codepoints_encountered = TM_FALSE;
+    return result;
+}
 
-    tm_size_t remaining = len;
-    while (remaining) {
-        tm_size_t i = len - remaining;
-        uint32_t c0 = (uint32_t)((uint8_t)str[i]);
-        if (c0 < 0x80u) {
-            /* Codepoint: 00000000 0xxxxxxx
-               Utf-8:              0xxxxxxx */
-            --remaining;
-        } else if ((c0 & 0xE0u) == 0xC0u) {
-            /* Codepoint: 00000yyy yyxxxxxx
-               Utf-8:     110yyyyy 10xxxxxx
-               Overlong:  1100000y 10xxxxxx */
+static tm_bool tmu_transcoder_has_bom(const tmu_utf8_transcoder* transcoder, const unsigned char* bom,
+                                      tm_size_t bom_size) {
+    if (transcoder->window_size < bom_size) return TM_FALSE;
+    for (tm_size_t i = 0; i < bom_size; ++i) {
+        if ((unsigned char)transcoder->window[i] != bom[i]) return TM_FALSE;
+    }
+    return TM_TRUE;
+}
 
-            if (remaining < 2) return i;
+/* How many octets need to be buffered before the byte order mark can be inspected. */
+static tm_size_t tmu_transcoder_bom_size(tmu_encoding encoding) {
+    switch (encoding) {
+        case tmu_encoding_utf8:
+        case tmu_encoding_utf8_bom: {
+            return 3;
+        }
+        case tmu_encoding_utf16be:
+        case tmu_encoding_utf16be_bom:
+        case tmu_encoding_utf16le:
+        case tmu_encoding_utf16le_bom: {
+            return 2;
+        }
+        case tmu_encoding_unknown:
+        case tmu_encoding_utf32be:
+        case tmu_encoding_utf32be_bom:
+        case tmu_encoding_utf32le:
+        case tmu_encoding_utf32le_bom:
+        default: {
+            return 4;
+        }
+    }
+}
 
-            uint32_t c1 = (uint32_t)((uint8_t)str[i + 1]);
-            if ((c1 & 0xC0u) != 0x80u) return i; /* Invalid trail. */
-            if ((c0 & 0xFEu) == 0xC0u) return i; /* Overlong. */
-            remaining -= 2;
-        } else if ((c0 & 0xF0u) == 0xE0u) {
-            /* Codepoint: 00000000 zzzzyyyy yyxxxxxx
-               Utf-8:     1110zzzz 10yyyyyy 10xxxxxx
-               Overlong:  11100000 100yyyyy 10xxxxxx
-               Surrogate: 11101101 101yyyyy 10xxxxxx */
-            if (remaining < 3) return i;
+/* Inspects the window for a byte order mark, resolves the encoding and skips the byte order mark. */
+static tm_errc tmu_transcoder_check_bom(tmu_utf8_transcoder* transcoder) {
+    typedef struct {
+        tmu_encoding encoding;
+        tmu_encoding encoding_bom;
+        const unsigned char* bom;
+        tm_size_t bom_size;
+    } bom_entry;
 
-            uint32_t c1 = (uint32_t)((uint8_t)str[i + 1]);
-            uint32_t c2 = (uint32_t)((uint8_t)str[i + 2]);
+    /* Order matters, the utf32le byte order mark starts with the utf16le byte order mark. */
+    static const bom_entry entries[] = {
+        {tmu_encoding_utf8, tmu_encoding_utf8_bom, tmu_utf8_bom, 3},
+        {tmu_encoding_utf32be, tmu_encoding_utf32be_bom, tmu_utf32_be_bom, 4},
+        {tmu_encoding_utf32le, tmu_encoding_utf32le_bom, tmu_utf32_le_bom, 4},
+        {tmu_encoding_utf16be, tmu_encoding_utf16be_bom, tmu_utf16_be_bom, 2},
+        {tmu_encoding_utf16le, tmu_encoding_utf16le_bom, tmu_utf16_le_bom, 2},
+    };
+
+    transcoder->bom_checked = TM_TRUE;
+    if (transcoder->window_size == 0) {
+        /* Empty input, nothing to detect. */
+        transcoder->encoding = tmu_encoding_utf8;
+        if (transcoder->original_encoding == tmu_encoding_unknown) transcoder->original_encoding = tmu_encoding_utf8;
+        return TM_OK;
+    }
+
+    const bom_entry* found = TM_NULL;
+    tm_size_t count = (tm_size_t)(sizeof(entries) / sizeof(entries[0]));
+    for (tm_size_t i = 0; i < count; ++i) {
+        const bom_entry* entry = &entries[i];
+        if (transcoder->encoding == tmu_encoding_unknown) {
+            if (tmu_transcoder_has_bom(transcoder, entry->bom, entry->bom_size)) {
+                found = entry;
+                break;
+            }
+        } else if (transcoder->encoding == entry->encoding || transcoder->encoding == entry->encoding_bom) {
+            if (tmu_transcoder_has_bom(transcoder, entry->bom, entry->bom_size)) {
+                found = entry;
+                break;
+            }
+            if (transcoder->encoding == entry->encoding_bom) {
+                /* Byte order mark expected but not found, error out. */
+                return TM_EINVAL;
+            }
+            transcoder->encoding = entry->encoding;
+            transcoder->original_encoding = entry->encoding;
+            return TM_OK;
+        }
+    }
+
+    if (!found) {
+        /* No encoding detected, assume utf8. */
+        transcoder->encoding = tmu_encoding_utf8;
+        transcoder->original_encoding = tmu_encoding_utf8;
+        return TM_OK;
+    }
+
+    transcoder->encoding = found->encoding;
+    transcoder->original_encoding = found->encoding_bom;
+    transcoder->window_pos = found->bom_size;
+    return TM_OK;
+}
+
+typedef enum {
+    tmu_transcode_ok,
+    tmu_transcode_invalid,
+    tmu_transcode_incomplete, /* More input is needed to decode the sequence. */
+    tmu_transcode_truncated   /* Input ended in the middle of a code unit. */
+} tmu_transcode_status;
+
+typedef struct {
+    tmu_transcode_status status;
+    tm_size_t consumed;
+    uint32_t codepoint;
+} tmu_transcode_decoded;
+
+/* Decodes a single sequence using the same rules as tmu_utf8_convert_from_bytes. */
+static tmu_transcode_decoded tmu_transcode_decode(tmu_encoding encoding, const char* in, tm_size_t in_len,
+                                                  tm_bool final) {
+    TM_ASSERT(in_len > 0);
+
+    tmu_transcode_decoded result = {tmu_transcode_ok, 0, TMU_INVALID_CODEPOINT};
+    switch (encoding) {
+        case tmu_encoding_utf8: {
+            /* Invalid octets are consumed one at a time, same as in tmu_utf8_convert_from_bytes. */
+            result.status = tmu_transcode_invalid;
+            result.consumed = 1;
+
+            uint32_t c0 = TMU_WIDEN(in[0]);
+            tm_size_t sequence_size = 0;
+            if (c0 < 0x80u) {
+                sequence_size = 1;
+            } else if ((c0 & 0xE0u) == 0xC0u) {
+                sequence_size = 2;
+            } else if ((c0 & 0xF0u) == 0xE0u) {
+                sequence_size = 3;
+            } else if ((c0 & 0xF8u) == 0xF0u) {
+                sequence_size = 4;
+            }
+            if (sequence_size == 0 || (c0 & 0xFEu) == 0xC0u || c0 > 0xF4u) break;
+
+            if (in_len >= sequence_size) {
+                if (tmu_utf8_valid_range(in, sequence_size) == sequence_size) {
+                    result.status = tmu_transcode_ok;
+                    result.consumed = sequence_size;
+                }
+                break;
+            }
+
+            /* Sequence continues in the next chunk, only wait for it if the octets so far are well formed. */
+            for (tm_size_t i = 1; i < in_len; ++i) {
+                if ((TMU_WIDEN(in[i]) & 0xC0u) != 0x80u) return result;
+            }
+            if (in_len >= 2) {
+                uint32_t c1 = TMU_WIDEN(in[1]);
+                if (c0 == 0xE0u && c1 < 0xA0u) break; /* Overlong. */
+                if (c0 == 0xEDu && c1 > 0x9Fu) break; /* Surrogate. */
+                if (c0 == 0xF0u && c1 < 0x90u) break; /* Overlong. */
+                if (c0 == 0xF4u && c1 > 0x8Fu) break; /* Invalid codepoints. */
+            }
+            if (!final) result.status = tmu_transcode_incomplete;
+            break;
+        }
+        case tmu_encoding_utf16be:
+        case tmu_encoding_utf16le: {
+            uint16_t (*extract)(tmu_byte_stream*) =
+                (encoding == tmu_encoding_utf16be) ? tmu_extract_u16_be : tmu_extract_u16_le;
+            tmu_byte_stream bytes = {TM_NULL, TM_NULL};
+            bytes.cur = in;
+            bytes.end = in + in_len;
+
+            if (in_len < 2) {
+                result.status = (final) ? tmu_transcode_truncated : tmu_transcode_incomplete;
+                break;
+            }
+
+            uint32_t lead = extract(&bytes);
+            result.consumed = 2;
+            if (lead >= TMU_LEAD_SURROGATE_MIN && lead <= TMU_LEAD_SURROGATE_MAX) {
+                if (in_len < 4) {
+                    result.status = (final) ? tmu_transcode_invalid : tmu_transcode_incomplete;
+                    break;
+                }
+                /* Like tmu_utf8_convert_from_bytes, an unpaired lead surrogate swallows the following code unit. */
+                uint32_t trail = extract(&bytes);
+                result.consumed = 4;
+                if (trail >= TMU_TRAILING_SURROGATE_MIN && trail <= TMU_TRAILING_SURROGATE_MAX) {
+                    result.codepoint = (lead << 10) + trail + TMU_SURROGATE_OFFSET;
+                }
+            } else {
+                result.codepoint = lead;
+            }
+            result.status = (tmu_is_valid_codepoint(result.codepoint)) ? tmu_transcode_ok : tmu_transcode_invalid;
+            break;
+        }
+        case tmu_encoding_utf32be:
+        case tmu_encoding_utf32le: {
+            if (in_len < 4) {
+                result.status = (final) ? tmu_transcode_truncated : tmu_transcode_incomplete;
+                break;
+            }
+            tmu_byte_stream bytes = {TM_NULL, TM_NULL};
+            bytes.cur = in;
+            bytes.end = in + in_len;
+            result.codepoint = (encoding == tmu_encoding_utf32be) ? tmu_extract_u32_be(&bytes)
+                                                                  : tmu_extract_u32_le(&bytes);
+            result.consumed = 4;
+            result.status = (tmu_is_valid_codepoint(result.codepoint)) ? tmu_transcode_ok : tmu_transcode_invalid;
+            break;
+        }
+        default: {
+            TM_ASSERT(0 && "Invalid encoding.");
+            result.status = tmu_transcode_truncated;
+            break;
+        }
+    }
+    return result;
+}
+
+/* Writes the output of a decoded sequence. Returns TM_ERANGE without writing anything if out is too small. */
+static tm_errc tmu_transcode_emit(tmu_utf8_transcoder* transcoder, const tmu_transcode_decoded* decoded,
+                                  const char* in, char* out, tm_size_t out_len, tm_size_t* size) {
+    TM_ASSERT(*size <= out_len);
+    tm_size_t remaining = out_len - *size;
+
+    if (decoded->status == tmu_transcode_ok) {
+        if (transcoder->encoding == tmu_encoding_utf8) {
+            if (decoded->consumed > remaining) return TM_ERANGE;
+            TMU_MEMCPY(out + *size, in, decoded->consumed * sizeof(char));
+            *size += decoded->consumed;
+        } else {
+            tm_size_t write_size = tmu_utf8_encode(decoded->codepoint, out + *size, remaining);
+            if (write_size > remaining) return TM_ERANGE;
+            *size += write_size;
+        }
+        return TM_OK;
+    }
+
+    TM_ASSERT(decoded->status == tmu_transcode_invalid);
+    switch (transcoder->validate) {
+        case tmu_validate_skip: {
+            break;
+        }
+        case tmu_validate_replace: {
+            if (transcoder->replace_str_len > remaining) return TM_ERANGE;
+            TMU_MEMCPY(out + *size, transcoder->replace_str, transcoder->replace_str_len * sizeof(char));
+            *size += transcoder->replace_str_len;
+            break;
+        }
+        case tmu_validate_error:
+        default: {
+            transcoder->invalid_codepoints_encountered = TM_TRUE;
+            return TM_EINVAL;
+        }
+    }
+    transcoder->invalid_codepoints_encountered = TM_TRUE;
+    return TM_OK;
+}
+
+/*
+Converts runs of ascii without decoding. Ascii is detected 8 octets at a time by masking the high bits of every
+code unit, for utf16 that means 4 code units and for utf32 2 code units per 8 octets.
+Returns the number of octets consumed, the number of octets written is derived from the code unit size.
+*/
+static tm_size_t tmu_transcode_ascii(tmu_encoding encoding, const char* in, tm_size_t in_len, char* out,
+                                     tm_size_t out_len) {
+    tm_size_t consumed = 0;
+    switch (encoding) {
+        case tmu_encoding_utf8: {
+            tm_size_t len = (in_len < out_len) ? in_len : out_len;
+            consumed = tmu_utf8_valid_range(in, len);
+            if (consumed) TMU_MEMCPY(out, in, consumed * sizeof(char));
+            break;
+        }
+        case tmu_encoding_utf16be:
+        case tmu_encoding_utf16le: {
+            uint64_t mask = (encoding == tmu_encoding_utf16le) ? 0xFF80FF80FF80FF80ull : 0x80FF80FF80FF80FFull;
+            int shift = (encoding == tmu_encoding_utf16le) ? 0 : 8;
+            tm_size_t written = 0;
+            while (in_len - consumed >= 8 && out_len - written >= 4) {
+                uint64_t units = tmu_ascii_load(in + consumed);
+                if (units & mask) break;
+                for (int i = 0; i < 4; ++i) {
+                    out[written + i] = (char)(uint8_t)(units >> (i * 16 + shift));
+                }
+                consumed += 8;
+                written += 4;
+            }
+            break;
+        }
+        case tmu_encoding_utf32be:
+        case tmu_encoding_utf32le: {
+            uint64_t mask = (encoding == tmu_encoding_utf32le) ? 0xFFFFFF80FFFFFF80ull : 0x80FFFFFF80FFFFFFull;
+            int shift = (encoding == tmu_encoding_utf32le) ? 0 : 24;
+            tm_size_t written = 0;
+            while (in_len - consumed >= 8 && out_len - written >= 2) {
+                uint64_t units = tmu_ascii_load(in + consumed);
+                if (units & mask) break;
+                out[written] = (char)(uint8_t)(units >> shift);
+                out[written + 1] = (char)(uint8_t)(units >> (32 + shift));
+                consumed += 8;
+                written += 2;
+            }
+            break;
+        }
+        default: {
+            TM_ASSERT(0 && "Invalid encoding.");
+            break;
+        }
+    }
+    return consumed;
+}
+
+static tm_size_t tmu_transcode_ascii_written(tmu_encoding encoding, tm_size_t consumed) {
+    switch (encoding) {
+        case tmu_encoding_utf16be:
+        case tmu_encoding_utf16le: {
+            return consumed / 2;
+        }
+        case tmu_encoding_utf32be:
+        case tmu_encoding_utf32le: {
+            return consumed / 4;
+        }
+        default: {
+            return consumed;
+        }
+    }
+}
+
+/*
+Converts in to out, an incomplete sequence at the end is buffered in pending unless final is set.
+Returns the number of octets consumed, ec is set to TM_ERANGE if out is full.
+*/
+static tm_size_t tmu_transcode_run(tmu_utf8_transcoder* transcoder, const char* in, tm_size_t in_len, tm_bool final,
+                                   char* out, tm_size_t out_len, tm_size_t* size, tm_errc* ec) {
+    tm_size_t consumed = 0;
+    while (consumed < in_len) {
+        tm_size_t ascii = tmu_transcode_ascii(transcoder->encoding, in + consumed, in_len - consumed, out + *size,
+                                              out_len - *size);
+        consumed += ascii;
+        *size += tmu_transcode_ascii_written(transcoder->encoding, ascii);
+        if (consumed == in_len) break;
+
+        const char* cur = in + consumed;
+        tm_size_t remaining = in_len - consumed;
+        tmu_transcode_decoded decoded = tmu_transcode_decode(transcoder->encoding, cur, remaining, final);
+        if (decoded.status == tmu_transcode_incomplete) {
+            TM_ASSERT(transcoder->pending_size == 0);
+            TM_ASSERT(remaining < (tm_size_t)sizeof(transcoder->pending));
+            TMU_MEMCPY(transcoder->pending, cur, remaining * sizeof(char));
+            transcoder->pending_size = remaining;
+            consumed = in_len;
+            break;
+        }
+        if (decoded.status == tmu_transcode_truncated) {
+            *ec = TM_EINVAL;
+            break;
+        }
+
+        *ec = tmu_transcode_emit(transcoder, &decoded, cur, out, out_len, size);
+        if (*ec != TM_OK) break;
+        consumed += decoded.consumed;
+    }
+    return consumed;
+}
+
+static tmu_transcode_result tmu_utf8_transcode_internal(tmu_utf8_transcoder* transcoder, const char* in,
+                                                        tm_size_t in_len, tm_bool final, char* out,
+                                                        tm_size_t out_len) {
+    TM_ASSERT(transcoder);
+    TM_ASSERT(in || in_len == 0);
+    TM_ASSERT(out || out_len == 0);
+    TM_ASSERT_VALID_SIZE(in_len);
+    TM_ASSERT_VALID_SIZE(out_len);
+    TM_ASSERT(transcoder->pending_size <= (tm_size_t)sizeof(transcoder->pending));
+    TM_ASSERT(transcoder->window_pos <= transcoder->window_size);
+
+    tmu_transcode_result result = {0, 0, TM_OK};
+
+    if (!transcoder->bom_checked) {
+        /* Buffer enough octets to be able to detect the encoding or the byte order mark. */
+        tm_size_t needed = (transcoder->encoding == tmu_encoding_unknown)
+                               ? (tm_size_t)sizeof(transcoder->window)
+                               : tmu_transcoder_bom_size(transcoder->encoding);
+        TM_ASSERT(transcoder->window_size <= needed);
+        tm_size_t take = needed - transcoder->window_size;
+        if (take > in_len) take = in_len;
+        if (take) TMU_MEMCPY(transcoder->window + transcoder->window_size, in, take * sizeof(char));
+        transcoder->window_size += take;
+        result.consumed = take;
+        if (transcoder->window_size < needed && !final) return result;
+
+        if (transcoder->encoding == tmu_encoding_unknown) {
+            /* A full window is only a partial sample of the input if more input follows, wait until that is known,
+               so that the same encoding is detected as by tmu_utf8_convert_from_bytes. */
+            tm_bool partial = result.consumed < in_len;
+            if (!partial && !final) return result;
+            tmu_encoding_detection detected =
+                tmu_detect_encoding_internal(transcoder->window, transcoder->window_size, partial);
+            transcoder->encoding =
+                (detected.confidence >= TMU_DETECT_MIN_CONFIDENCE) ? detected.encoding : tmu_encoding_utf8;
+        }
+
+        result.ec = tmu_transcoder_check_bom(transcoder);
+        if (result.ec != TM_OK) return result;
+    }
+
+    /* Convert the buffered start of the input first, an incomplete sequence at its end is moved to pending. */
+    if (transcoder->window_pos < transcoder->window_size) {
+        tm_bool at_end = final && result.consumed == in_len;
+        tm_errc ec = TM_OK;
+        tm_size_t consumed = tmu_transcode_run(transcoder, transcoder->window + transcoder->window_pos,
+                                               transcoder->window_size - transcoder->window_pos, at_end, out, out_len,
+                                               &result.size, &ec);
+        transcoder->window_pos += consumed;
+        if (ec != TM_OK) {
+            if (ec == TM_ERANGE) ec = (result.size == 0 && result.consumed == 0 && consumed == 0) ? TM_ERANGE : TM_OK;
+            result.ec = ec;
+            return result;
+        }
+        TM_ASSERT(transcoder->window_pos == transcoder->window_size);
+    }
+
+    /* Convert buffered octets from the previous chunk, topping them up with octets from the input. */
+    while (transcoder->pending_size > 0) {
+        char buffer[sizeof(transcoder->pending)];
+        tm_size_t pending_size = transcoder->pending_size;
+        tm_size_t take = (tm_size_t)sizeof(buffer) - pending_size;
+        if (take > in_len - result.consumed) take = in_len - result.consumed;
+        TMU_MEMCPY(buffer, transcoder->pending, pending_size * sizeof(char));
+        if (take) TMU_MEMCPY(buffer + pending_size, in + result.consumed, take * sizeof(char));
+
+        tm_bool at_end = final && result.consumed + take == in_len;
+        tmu_transcode_decoded decoded = tmu_transcode_decode(transcoder->encoding, buffer, pending_size + take, at_end);
+        if (decoded.status == tmu_transcode_incomplete) {
+            /* All available input is buffered, wait for the next chunk. */
+            TM_ASSERT(result.consumed + take == in_len);
+            TMU_MEMCPY(transcoder->pending, buffer, (pending_size + take) * sizeof(char));
+            transcoder->pending_size = pending_size + take;
+            result.consumed = in_len;
+            return result;
+        }
+        if (decoded.status == tmu_transcode_truncated) {
+            /* There are remaining bytes in the byte stream that we couldn't convert. */
+            result.ec = TM_EINVAL;
+            return result;
+        }
+
+        tm_errc ec = tmu_transcode_emit(transcoder, &decoded, buffer, out, out_len, &result.size);
+        if (ec != TM_OK) {
+            if (ec == TM_ERANGE) ec = (result.size == 0 && result.consumed == 0) ? TM_ERANGE : TM_OK;
+            result.ec = ec;
+            return result;
+        }
+
+        if (decoded.consumed >= pending_size) {
+            result.consumed += decoded.consumed - pending_size;
+            transcoder->pending_size = 0;
+        } else {
+            transcoder->pending_size = pending_size - decoded.consumed;
+            TMU_MEMMOVE(transcoder->pending, transcoder->pending + decoded.consumed,
+                        transcoder->pending_size * sizeof(char));
+        }
+    }
+
+    if (result.consumed < in_len) {
+        tm_errc ec = TM_OK;
+        result.consumed += tmu_transcode_run(transcoder, in + result.consumed, in_len - result.consumed, final, out,
+                                             out_len, &result.size, &ec);
+        if (ec == TM_ERANGE) ec = (result.size == 0 && result.consumed == 0) ? TM_ERANGE : TM_OK;
+        result.ec = ec;
+    }
+    return result;
+}
+
+TMU_DEF tmu_transcode_result tmu_utf8_transcode(tmu_utf8_transcoder* transcoder, const void* input,
+                                                tm_size_t input_len, char* out, tm_size_t out_len) {
+    return tmu_utf8_transcode_internal(transcoder, (const char*)input, input_len, /*final=*/TM_FALSE, out, out_len);
+}
+
+TMU_DEF tmu_transcode_result tmu_utf8_transcode_finish(tmu_utf8_transcoder* transcoder, char* out, tm_size_t out_len) {
+    tmu_transcode_result result =
+        tmu_utf8_transcode_internal(transcoder, /*in=*/TM_NULL, /*in_len=*/0, /*final=*/TM_TRUE, out, out_len);
+    if (result.ec == TM_OK && (transcoder->pending_size > 0 || transcoder->window_pos < transcoder->window_size)) {
+        result.ec = TM_ERANGE;
+    }
+    return result;
+}
+
+TMU_DEF tm_size_t tmu_utf8_valid_range(const char* str, tm_size_t len) {
+    /* Checking for legal utf-8 byte sequences according to
+       https://www.unicode.org/versions/Unicode11.0.0/ch03.pdf
+       Table 3-7.  Well-Formed UTF-8 Byte Sequences */
+
+    tm_size_t remaining = len;
+    while (remaining) {
+        tm_size_t i = len - remaining;
+        /* Skip runs of ascii 8 octets at a time. */
+        if (remaining >= 8 && !(tmu_ascii_load(str + i) & TMU_ASCII_HIGH_BITS)) {
+            remaining -= 8;
+            continue;
+        }
+        uint32_t c0 = (uint32_t)((uint8_t)str[i]);
+        if (c0 < 0x80u) {
+            /* Codepoint: 00000000 0xxxxxxx
+               Utf-8:              0xxxxxxx */
+            --remaining;
+        } else if ((c0 & 0xE0u) == 0xC0u) {
+            /* Codepoint: 00000yyy yyxxxxxx
+               Utf-8:     110yyyyy 10xxxxxx
+               Overlong:  1100000y 10xxxxxx */
+
+            if (remaining < 2) return i;
+
+            uint32_t c1 = (uint32_t)((uint8_t)str[i + 1]);
+            if ((c1 & 0xC0u) != 0x80u) return i; /* Invalid trail. */
+            if ((c0 & 0xFEu) == 0xC0u) return i; /* Overlong. */
+            remaining -= 2;
+        } else if ((c0 & 0xF0u) == 0xE0u) {
+            /* Codepoint: 00000000 zzzzyyyy yyxxxxxx
+               Utf-8:     1110zzzz 10yyyyyy 10xxxxxx
+               Overlong:  11100000 100yyyyy 10xxxxxx
+               Surrogate: 11101101 101yyyyy 10xxxxxx */
+            if (remaining < 3) return i;
+
+            uint32_t c1 = (uint32_t)((uint8_t)str[i + 1]);
+            uint32_t c2 = (uint32_t)((uint8_t)str[i + 2]);
             if ((c1 & 0xC0u) != 0x80u) return i;                /* Invalid trail. */
             if ((c2 & 0xC0u) != 0x80u) return i;                /* Invalid trail. */
             if (c0 == 0xE0u && (c1 & 0xE0u) == 0x80u) return i; /* Overlong. */
@@ -4828,6 +5969,49 @@ TMU_DEF int tmu_utf8_compare(const char* a, tm_size_t a_len, const char* b, tm_s
     return 0;
 }
 
+/*
+Counts the octets that start a codepoint, which are all octets that aren't of the form 10xxxxxx.
+The octets are checked 8 at a time: an octet starts a codepoint if bit 7 is clear or bit 6 is set. The resulting
+flags are accumulated per octet lane and summed horizontally every 255 words before the lanes could overflow.
+*/
+static tm_size_t tmu_utf8_count_lead_octets(const char* str, tm_size_t len) {
+    tm_size_t result = 0;
+    tm_size_t i = 0;
+    while (len - i >= 8) {
+        uint64_t lanes = 0;
+        for (int words = 0; words < 255 && len - i >= 8; ++words, i += 8) {
+            uint64_t octets = tmu_ascii_load(str + i);
+            lanes += ((~octets | (octets << 1)) & TMU_ASCII_HIGH_BITS) >> 7;
+        }
+        lanes = (lanes & 0x00FF00FF00FF00FFull) + ((lanes >> 8) & 0x00FF00FF00FF00FFull);
+        result += (tm_size_t)((lanes * 0x0001000100010001ull) >> 48);
+    }
+    for (; i < len; ++i) {
+        if ((TMU_WIDEN(str[i]) & 0xC0u) != 0x80u) ++result;
+    }
+    return result;
+}
+
+/* Returns the offset of the codepoint that comes count codepoints after str[0], or len if there aren't enough. */
+static tm_size_t tmu_utf8_skip_lead_octets(const char* str, tm_size_t len, tm_size_t count) {
+    tm_size_t i = 0;
+    while (len - i >= 8) {
+        uint64_t octets = tmu_ascii_load(str + i);
+        uint64_t lanes = ((~octets | (octets << 1)) & TMU_ASCII_HIGH_BITS) >> 7;
+        tm_size_t leads = (tm_size_t)((lanes * TMU_ASCII_ONES) >> 56);
+        if (leads > count) break;
+        count -= leads;
+        i += 8;
+    }
+    for (; i < len; ++i) {
+        if ((TMU_WIDEN(str[i]) & 0xC0u) != 0x80u) {
+            if (count == 0) return i;
+            --count;
+        }
+    }
+    return len;
+}
+
 TMU_DEF tm_size_t tmu_utf8_count_codepoints(const char* str) {
     return tmu_utf8_count_codepoints_stream(tmu_utf8_make_stream(str));
 }
@@ -4837,8 +6021,332 @@ TMU_DEF tm_size_t tmu_utf8_count_codepoints_n(const char* str, tm_size_t str_len
 TMU_DEF tm_size_t tmu_utf8_count_codepoints_stream(tmu_utf8_stream stream) {
     TM_ASSERT(stream.cur <= stream.end);
     tm_size_t result = 0;
-    uint32_t codepoint = TMU_INVALID_CODEPOINT;
-    while (tmu_utf8_extract(&stream, &codepoint)) ++result;
+    while (stream.cur != stream.end) {
+        /* Valid ranges can be counted without decoding. */
+        tm_size_t remaining = (tm_size_t)(stream.end - stream.cur);
+        tm_size_t valid = tmu_utf8_valid_range(stream.cur, remaining);
+        result += tmu_utf8_count_lead_octets(stream.cur, valid);
+        stream.cur += valid;
+        if (valid == remaining) break;
+
+        /* tmu_utf8_extract is more lenient than tmu_utf8_valid_range, count for as long as it accepts the input. */
+        uint32_t codepoint = TMU_INVALID_CODEPOINT;
+        if (!tmu_utf8_extract(&stream, &codepoint)) break;
+        ++result;
+    }
+    return result;
+}
+
+/*
+Writes checkpoints for every interval-th codepoint in [begin, end), not including the one at begin.
+Returns the number of checkpoints written.
+*/
+static tm_size_t tmu_offset_index_fill(const char* str, tm_size_t begin, tm_size_t end, tm_size_t begin_index,
+                                       tm_size_t interval, tmu_utf8_checkpoint* out) {
+    tm_size_t count = 0;
+    tm_size_t offset = begin;
+    tm_size_t codepoint_index = begin_index;
+    for (;;) {
+        offset += tmu_utf8_skip_lead_octets(str + offset, end - offset, interval);
+        if (offset >= end) break;
+        codepoint_index += interval;
+        out[count].index = codepoint_index;
+        out[count].offset = offset;
+        ++count;
+    }
+    return count;
+}
+
+/* Number of checkpoints that tmu_offset_index_fill writes for a range of codepoint_count codepoints. */
+static tm_size_t tmu_offset_index_fill_count(tm_size_t codepoint_count, tm_size_t interval) {
+    return (codepoint_count > 0) ? ((codepoint_count - 1) / interval) : 0;
+}
+
+/* Index of the last checkpoint with offset <= offset. */
+static tm_size_t tmu_offset_index_find_offset(const tmu_utf8_offset_index* index, tm_size_t offset) {
+    TM_ASSERT(index->count > 0);
+    tm_size_t first = 0;
+    tm_size_t last = index->count;
+    while (last - first > 1) {
+        tm_size_t mid = first + (last - first) / 2;
+        if (index->checkpoints[mid].offset <= offset) {
+            first = mid;
+        } else {
+            last = mid;
+        }
+    }
+    return first;
+}
+
+/* Index of the last checkpoint with index <= codepoint_index. */
+static tm_size_t tmu_offset_index_find_codepoint(const tmu_utf8_offset_index* index, tm_size_t codepoint_index) {
+    TM_ASSERT(index->count > 0);
+    tm_size_t first = 0;
+    tm_size_t last = index->count;
+    while (last - first > 1) {
+        tm_size_t mid = first + (last - first) / 2;
+        if (index->checkpoints[mid].index <= codepoint_index) {
+            first = mid;
+        } else {
+            last = mid;
+        }
+    }
+    return first;
+}
+
+TMU_DEF tmu_utf8_offset_index_result tmu_utf8_make_offset_index(const char* str, tm_size_t str_len,
+                                                                tm_size_t interval) {
+    TM_ASSERT(str || str_len == 0);
+    TM_ASSERT_VALID_SIZE(str_len);
+    TM_ASSERT(interval > 0);
+
+    tmu_utf8_offset_index_result result = {{TM_NULL, 0, 0, 0, 0, 0}, TM_OK};
+
+    tm_size_t codepoints = tmu_utf8_count_lead_octets(str, str_len);
+    tm_size_t capacity = 1 + tmu_offset_index_fill_count(codepoints, interval);
+    tmu_utf8_checkpoint* checkpoints =
+        (tmu_utf8_checkpoint*)TMU_MALLOC(capacity * sizeof(tmu_utf8_checkpoint), sizeof(tm_size_t));
+    if (!checkpoints) {
+        result.ec = TM_ENOMEM;
+        return result;
+    }
+
+    checkpoints[0].index = 0;
+    checkpoints[0].offset = 0;
+    tm_size_t count = 1 + tmu_offset_index_fill(str, 0, str_len, 0, interval, checkpoints + 1);
+    TM_ASSERT(count == capacity);
+
+    result.index.checkpoints = checkpoints;
+    result.index.count = count;
+    result.index.capacity = capacity;
+    result.index.interval = interval;
+    result.index.codepoints = codepoints;
+    result.index.size = str_len;
+    return result;
+}
+
+TMU_DEF void tmu_utf8_destroy_offset_index(tmu_utf8_offset_index* index) {
+    TM_ASSERT(index);
+    if (index->checkpoints) TMU_FREE(index->checkpoints);
+    index->checkpoints = TM_NULL;
+    index->count = 0;
+    index->capacity = 0;
+    index->codepoints = 0;
+    index->size = 0;
+}
+
+TMU_DEF tm_size_t tmu_utf8_offset_index_to_offset(const tmu_utf8_offset_index* index, const char* str,
+                                                  tm_size_t codepoint_index) {
+    TM_ASSERT(index);
+    TM_ASSERT(str || index->size == 0);
+
+    if (codepoint_index >= index->codepoints) return index->size;
+
+    tm_size_t found = tmu_offset_index_find_codepoint(index, codepoint_index);
+    const tmu_utf8_checkpoint* checkpoint = &index->checkpoints[found];
+    return checkpoint->offset + tmu_utf8_skip_lead_octets(str + checkpoint->offset, index->size - checkpoint->offset,
+                                                          codepoint_index - checkpoint->index);
+}
+
+TMU_DEF tm_size_t tmu_utf8_offset_index_to_codepoint(const tmu_utf8_offset_index* index, const char* str,
+                                                     tm_size_t offset) {
+    TM_ASSERT(index);
+    TM_ASSERT(str || index->size == 0);
+
+    if (offset >= index->size) return index->codepoints;
+
+    const tmu_utf8_checkpoint* checkpoint = &index->checkpoints[tmu_offset_index_find_offset(index, offset)];
+    tm_size_t leads = tmu_utf8_count_lead_octets(str + checkpoint->offset, offset + 1 - checkpoint->offset);
+    TM_ASSERT(leads > 0);
+    return checkpoint->index + leads - 1;
+}
+
+TMU_DEF tm_errc tmu_utf8_offset_index_update(tmu_utf8_offset_index* index, const char* str, tm_size_t str_len,
+                                             tm_size_t edit_offset, tm_size_t removed_len, tm_size_t inserted_len) {
+    TM_ASSERT(index);
+    TM_ASSERT(index->count > 0);
+    TM_ASSERT(str || str_len == 0);
+    TM_ASSERT(edit_offset + removed_len <= index->size);
+    TM_ASSERT(str_len == index->size - removed_len + inserted_len);
+
+    /* Checkpoints in [lo + 1, hi) are inside the edited range and get replaced. Checkpoints from hi on are shifted. */
+    tm_size_t edit_end = edit_offset + removed_len;
+    tm_size_t lo = tmu_offset_index_find_offset(index, edit_offset);
+    tm_size_t hi = tmu_offset_index_find_offset(index, (edit_end > edit_offset) ? (edit_end - 1) : edit_offset) + 1;
+    TM_ASSERT(hi > lo);
+
+    tmu_utf8_checkpoint lo_checkpoint = index->checkpoints[lo];
+    tm_size_t region_end = str_len;
+    if (hi < index->count) region_end = index->checkpoints[hi].offset - removed_len + inserted_len;
+
+    tm_size_t region_codepoints = tmu_utf8_count_lead_octets(str + lo_checkpoint.offset,
+                                                             region_end - lo_checkpoint.offset);
+    tm_size_t fill_count = tmu_offset_index_fill_count(region_codepoints, index->interval);
+    tm_size_t new_count = index->count - (hi - lo - 1) + fill_count;
+
+    if (new_count > index->capacity) {
+        tm_size_t new_capacity = index->capacity * 2;
+        if (new_capacity < new_count) new_capacity = new_count;
+        tmu_utf8_checkpoint* new_checkpoints = (tmu_utf8_checkpoint*)TMU_REALLOC(
+            index->checkpoints, new_capacity * sizeof(tmu_utf8_checkpoint), sizeof(tm_size_t));
+        if (!new_checkpoints) return TM_ENOMEM;
+        index->checkpoints = new_checkpoints;
+        index->capacity = new_capacity;
+    }
+
+    tm_size_t new_codepoints = lo_checkpoint.index + region_codepoints;
+    if (hi < index->count) {
+        /* Shift checkpoints after the edit, both their codepoint indices and offsets are relative to hi. */
+        tm_size_t hi_index = index->checkpoints[hi].index;
+        tm_size_t hi_offset = index->checkpoints[hi].offset;
+        tm_size_t tail_count = index->count - hi;
+        TMU_MEMMOVE(index->checkpoints + lo + 1 + fill_count, index->checkpoints + hi,
+                    tail_count * sizeof(tmu_utf8_checkpoint));
+        for (tm_size_t i = lo + 1 + fill_count; i < new_count; ++i) {
+            index->checkpoints[i].index = index->checkpoints[i].index - hi_index + new_codepoints;
+            index->checkpoints[i].offset = index->checkpoints[i].offset - hi_offset + region_end;
+        }
+        new_codepoints = index->codepoints - hi_index + new_codepoints;
+    }
+
+    tm_size_t filled = tmu_offset_index_fill(str, lo_checkpoint.offset, region_end, lo_checkpoint.index,
+                                             index->interval, index->checkpoints + lo + 1);
+    TM_ASSERT(filled == fill_count);
+    TM_UNREFERENCED(filled);
+
+    index->count = new_count;
+    index->codepoints = new_codepoints;
+    index->size = str_len;
+    return TM_OK;
+}
+
+typedef tm_size_t tmu_chunk_end_proc(const char* str, tm_size_t str_len, tm_size_t begin, tm_size_t end);
+
+/* Moves end back to the start of the sequence it points into. */
+static tm_size_t tmu_utf8_codepoint_chunk_end(const char* str, tm_size_t str_len, tm_size_t begin, tm_size_t end) {
+    TM_ASSERT(end < str_len);
+    TM_UNREFERENCED_PARAM(str_len);
+    tm_size_t original_end = end;
+    for (int i = 0; i < 3 && end > begin + 1 && (TMU_WIDEN(str[end]) & 0xC0u) == 0x80u; ++i) --end;
+    /* More than three continuation octets in a row, the octet at original_end is invalid no matter where the chunk
+       starts. Splitting there keeps the preceding codepoint intact, just like in the serial versions. */
+    if ((TMU_WIDEN(str[end]) & 0xC0u) == 0x80u) return original_end;
+    return end;
+}
+
+static tm_size_t tmu_utf8_split_chunks_internal(const char* str, tm_size_t str_len, tm_size_t chunk_size,
+                                                tmu_chunk_end_proc* chunk_end, tmu_utf8_chunk* out,
+                                                tm_size_t out_len) {
+    TM_ASSERT(str || str_len == 0);
+    TM_ASSERT(out || out_len == 0);
+    TM_ASSERT_VALID_SIZE(str_len);
+
+    if (chunk_size < 16) chunk_size = 16;
+
+    tm_size_t count = 0;
+    tm_size_t begin = 0;
+    while (begin < str_len) {
+        tm_size_t end = str_len;
+        if (str_len - begin > chunk_size) end = chunk_end(str, str_len, begin, begin + chunk_size);
+        TM_ASSERT(end > begin);
+        if (count < out_len) {
+            out[count].offset = begin;
+            out[count].size = end - begin;
+        }
+        ++count;
+        begin = end;
+    }
+    return count;
+}
+
+TMU_DEF tm_size_t tmu_utf8_split_chunks(const char* str, tm_size_t str_len, tm_size_t chunk_size, tmu_utf8_chunk* out,
+                                        tm_size_t out_len) {
+    return tmu_utf8_split_chunks_internal(str, str_len, chunk_size, tmu_utf8_codepoint_chunk_end, out, out_len);
+}
+
+typedef struct {
+    const char* str;
+    const tmu_utf8_chunk* chunks;
+    tm_size_t* valid;  /* Valid range of each chunk. */
+    tm_size_t* counts; /* Codepoints in the valid range of each chunk. */
+} tmu_parallel_task_data;
+
+static void tmu_valid_range_task(void* task_data, tm_size_t index) {
+    tmu_parallel_task_data* data = (tmu_parallel_task_data*)task_data;
+    const tmu_utf8_chunk* chunk = &data->chunks[index];
+    data->valid[index] = tmu_utf8_valid_range(data->str + chunk->offset, chunk->size);
+}
+
+static void tmu_count_codepoints_task(void* task_data, tm_size_t index) {
+    tmu_parallel_task_data* data = (tmu_parallel_task_data*)task_data;
+    const tmu_utf8_chunk* chunk = &data->chunks[index];
+    const char* str = data->str + chunk->offset;
+    data->valid[index] = tmu_utf8_valid_range(str, chunk->size);
+    data->counts[index] = tmu_utf8_count_lead_octets(str, data->valid[index]);
+}
+
+/* Splits str into chunks and runs task on every chunk. Returns the number of chunks or 0 on allocation failure. */
+static tm_size_t tmu_utf8_run_parallel(const char* str, tm_size_t str_len, tm_size_t chunk_size,
+                                       tmu_parallel_for_proc* parallel_for, void* user_data, tmu_task_proc* task,
+                                       tmu_parallel_task_data* data) {
+    TM_ASSERT(str || str_len == 0);
+    TM_ASSERT(parallel_for);
+
+    if (chunk_size == 0) chunk_size = 1024 * 1024;
+    tm_size_t count = tmu_utf8_split_chunks(str, str_len, chunk_size, TM_NULL, 0);
+    if (count <= 1) return 0;
+
+    /* Chunks and per chunk results are allocated in a single block, they all consist of tm_size_t members. */
+    tm_size_t element_size = sizeof(tmu_utf8_chunk) + 2 * sizeof(tm_size_t);
+    tmu_utf8_chunk* chunks = (tmu_utf8_chunk*)TMU_MALLOC(count * element_size, sizeof(tm_size_t));
+    if (!chunks) return 0;
+    tmu_utf8_split_chunks(str, str_len, chunk_size, chunks, count);
+
+    data->str = str;
+    data->chunks = chunks;
+    data->valid = (tm_size_t*)(chunks + count);
+    data->counts = data->valid + count;
+    parallel_for(user_data, count, task, data);
+    return count;
+}
+
+TMU_DEF tm_size_t tmu_utf8_valid_range_parallel(const char* str, tm_size_t str_len, tm_size_t chunk_size,
+                                                tmu_parallel_for_proc* parallel_for, void* user_data) {
+    tmu_parallel_task_data data = {TM_NULL, TM_NULL, TM_NULL, TM_NULL};
+    tm_size_t count =
+        tmu_utf8_run_parallel(str, str_len, chunk_size, parallel_for, user_data, tmu_valid_range_task, &data);
+    if (!count) return tmu_utf8_valid_range(str, str_len);
+
+    /* Chunks start on sequence boundaries, so the first chunk that isn't valid contains the first invalid octet. */
+    tm_size_t result = str_len;
+    for (tm_size_t i = 0; i < count; ++i) {
+        if (data.valid[i] != data.chunks[i].size) {
+            result = data.chunks[i].offset + data.valid[i];
+            break;
+        }
+    }
+    TMU_FREE((void*)data.chunks);
+    return result;
+}
+
+TMU_DEF tm_size_t tmu_utf8_count_codepoints_parallel(const char* str, tm_size_t str_len, tm_size_t chunk_size,
+                                                     tmu_parallel_for_proc* parallel_for, void* user_data) {
+    tmu_parallel_task_data data = {TM_NULL, TM_NULL, TM_NULL, TM_NULL};
+    tm_size_t count =
+        tmu_utf8_run_parallel(str, str_len, chunk_size, parallel_for, user_data, tmu_count_codepoints_task, &data);
+    if (!count) return tmu_utf8_count_codepoints_n(str, str_len);
+
+    tm_size_t result = 0;
+    for (tm_size_t i = 0; i < count; ++i) {
+        const tmu_utf8_chunk* chunk = &data.chunks[i];
+        if (data.valid[i] != chunk->size) {
+            /* Invalid input is rare, count the rest serially to get the same result as the serial version. */
+            result += tmu_utf8_count_codepoints_n(str + chunk->offset, str_len - chunk->offset);
+            break;
+        }
+        result += data.counts[i];
+    }
+    TMU_FREE((void*)data.chunks);
     return result;
 }
 
@@ -4859,6 +6367,76 @@ TMU_DEF tm_bool tmu_is_separator(uint32_t codepoint) {
     return tmu_ucd_get_category(codepoint) == tmu_ucd_category_separator;
 }
 TMU_DEF tm_bool tmu_is_whitespace(uint32_t codepoint) { return tmu_ucd_is_whitespace(codepoint) == 1; }
+
+/* Bitmaps of the ascii codepoints belonging to each bit of the tmu_category_* masks, indexed by bit. */
+static const uint64_t tmu_ascii_category_bitmaps[8][2] = {
+    {0x00000000FFFFFFFFull, 0x8000000000000000ull}, /* control */
+    {0x0000000000000000ull, 0x07FFFFFE07FFFFFEull}, /* letter */
+    {0x0000000000000000ull, 0x0000000000000000ull}, /* mark */
+    {0x03FF000000000000ull, 0x0000000000000000ull}, /* number */
+    {0x8C00F7EE00000000ull, 0x28000000B8000001ull}, /* punctuation */
+    {0x7000081000000000ull, 0x5000000140000000ull}, /* symbol */
+    {0x0000000100000000ull, 0x0000000000000000ull}, /* separator */
+    {0x0000000100001000ull, 0x0000000000000000ull}, /* whitespace */
+};
+
+static tm_bool tmu_category_matches(uint32_t codepoint, uint32_t mask) {
+    if (mask & (1u << (uint32_t)tmu_ucd_get_category(codepoint))) return TM_TRUE;
+    return (mask & tmu_category_whitespace) && tmu_ucd_is_whitespace(codepoint);
+}
+
+static tm_size_t tmu_utf8_span_category_internal(tmu_utf8_stream stream, uint32_t mask, tm_bool negate) {
+    TM_ASSERT(stream.cur <= stream.end);
+
+    uint64_t bitmap[2] = {0, 0};
+    for (uint32_t i = 0; i < 8; ++i) {
+        if (mask & (1u << i)) {
+            bitmap[0] |= tmu_ascii_category_bitmaps[i][0];
+            bitmap[1] |= tmu_ascii_category_bitmaps[i][1];
+        }
+    }
+    if (negate) {
+        bitmap[0] = ~bitmap[0];
+        bitmap[1] = ~bitmap[1];
+    }
+
+    const char* start = stream.cur;
+    while (stream.cur != stream.end) {
+        if (stream.end - stream.cur >= 16) {
+            /* Check 16 octets at once, if they are all ascii they can be classified using only the bitmap. */
+            uint64_t high_bits = (tmu_ascii_load(stream.cur) | tmu_ascii_load(stream.cur + 8)) & TMU_ASCII_HIGH_BITS;
+            if (!high_bits) {
+                for (int i = 0; i < 16; ++i) {
+                    uint32_t c = TMU_WIDEN(stream.cur[i]);
+                    if (!((bitmap[c >> 6] >> (c & 63u)) & 1u)) return (tm_size_t)(stream.cur + i - start);
+                }
+                stream.cur += 16;
+                continue;
+            }
+        }
+
+        uint32_t c = TMU_WIDEN(*stream.cur);
+        if (c < 0x80u) {
+            if (!((bitmap[c >> 6] >> (c & 63u)) & 1u)) break;
+            ++stream.cur;
+            continue;
+        }
+
+        tmu_utf8_stream next = stream;
+        uint32_t codepoint = TMU_INVALID_CODEPOINT;
+        if (!tmu_utf8_extract(&next, &codepoint)) break;
+        if (tmu_category_matches(codepoint, mask) == negate) break;
+        stream.cur = next.cur;
+    }
+    return (tm_size_t)(stream.cur - start);
+}
+
+TMU_DEF tm_size_t tmu_utf8_span_category(tmu_utf8_stream stream, uint32_t mask) {
+    return tmu_utf8_span_category_internal(stream, mask, /*negate=*/TM_FALSE);
+}
+TMU_DEF tm_size_t tmu_utf8_span_not_category(tmu_utf8_stream stream, uint32_t mask) {
+    return tmu_utf8_span_category_internal(stream, mask, /*negate=*/TM_TRUE);
+}
 #endif /* TMU_UCD_HAS_CATEGORY */
 
 #if TMU_UCD_HAS_CASE_INFO
@@ -4870,6 +6448,43 @@ TMU_DEF tm_bool tmu_is_caseless(uint32_t codepoint) {
 }
 #endif /* TMU_UCD_HAS_CATEGORY */
 
+#if TMU_UCD_HAS_GRAPHEME_BREAK
+/* Grapheme break classes between which there is always a boundary, regardless of the preceding codepoints. */
+static tm_bool tmu_grapheme_break_is_isolated(tmu_ucd_grapheme_break_enum gb) {
+    return gb == tmu_grapheme_break_other || gb == tmu_grapheme_break_control || gb == tmu_grapheme_break_cr ||
+           gb == tmu_grapheme_break_lf || gb == tmu_grapheme_break_extended_pictographic;
+}
+
+static tm_size_t tmu_utf8_grapheme_chunk_end(const char* str, tm_size_t str_len, tm_size_t begin, tm_size_t end) {
+    tm_size_t fallback = tmu_utf8_codepoint_chunk_end(str, str_len, begin, end);
+    tm_size_t cur = fallback;
+    for (int i = 0; i < 32 && cur > begin + 1; ++i) {
+        tm_size_t prev = tmu_utf8_codepoint_chunk_end(str, str_len, begin, cur - 1);
+
+        uint32_t next_codepoint = TMU_INVALID_CODEPOINT;
+        uint32_t prev_codepoint = TMU_INVALID_CODEPOINT;
+        tmu_utf8_stream next_stream = tmu_utf8_make_stream_n(str + cur, str_len - cur);
+        tmu_utf8_stream prev_stream = tmu_utf8_make_stream_n(str + prev, cur - prev);
+        if (tmu_utf8_extract(&next_stream, &next_codepoint) && tmu_utf8_extract(&prev_stream, &prev_codepoint)) {
+            tmu_ucd_grapheme_break_enum next = tmu_ucd_get_entry(next_codepoint).grapheme_break;
+            tmu_ucd_grapheme_break_enum prev_gb = tmu_ucd_get_entry(prev_codepoint).grapheme_break;
+            /* GB3: CR x LF, every other pair of these classes is a boundary (GB4, GB5, GB999). */
+            if (tmu_grapheme_break_is_isolated(prev_gb) && tmu_grapheme_break_is_isolated(next) &&
+                !(prev_gb == tmu_grapheme_break_cr && next == tmu_grapheme_break_lf)) {
+                return cur;
+            }
+        }
+        cur = prev;
+    }
+    return fallback;
+}
+
+TMU_DEF tm_size_t tmu_utf8_split_chunks_graphemes(const char* str, tm_size_t str_len, tm_size_t chunk_size,
+                                                  tmu_utf8_chunk* out, tm_size_t out_len) {
+    return tmu_utf8_split_chunks_internal(str, str_len, chunk_size, tmu_utf8_grapheme_chunk_end, out, out_len);
+}
+#endif /* TMU_UCD_HAS_GRAPHEME_BREAK */
+
 #if TMU_UCD_HAS_WIDTH
 TMU_DEF int tmu_utf8_width(tmu_utf8_stream stream) {
     TM_ASSERT(stream.cur <= stream.end);
@@ -4891,6 +6506,226 @@ TMU_DEF int tmu_utf8_width_n(const char* str, tm_size_t str_len) {
 }
 #endif
 
+#if TMU_UCD_HAS_WORD_BREAK
+/* Rules are numbered as in UAX #29, "x" means no break and "|" means break. */
+static tm_bool tmu_word_break_is_ignorable(tmu_ucd_word_break_enum wb) {
+    return wb == tmu_word_break_extend || wb == tmu_word_break_format || wb == tmu_word_break_zwj;
+}
+static tm_bool tmu_word_break_is_newline(tmu_ucd_word_break_enum wb) {
+    return wb == tmu_word_break_cr || wb == tmu_word_break_lf || wb == tmu_word_break_newline;
+}
+static tm_bool tmu_word_break_is_ahletter(tmu_ucd_word_break_enum wb) {
+    return wb == tmu_word_break_aletter || wb == tmu_word_break_hebrew_letter;
+}
+static tm_bool tmu_word_break_is_midnumletq(tmu_ucd_word_break_enum wb) {
+    return wb == tmu_word_break_midnumlet || wb == tmu_word_break_single_quote;
+}
+
+/* Returns the next word break property skipping Extend, Format and ZWJ (rule WB4).
+   Returns tmu_word_break_count if there is no next codepoint. */
+static tmu_ucd_word_break_enum tmu_word_break_peek(tmu_utf8_stream stream) {
+    uint32_t codepoint = TMU_INVALID_CODEPOINT;
+    while (tmu_utf8_extract(&stream, &codepoint)) {
+        tmu_ucd_word_break_enum wb = tmu_ucd_get_word_break(codepoint);
+        if (!tmu_word_break_is_ignorable(wb)) return wb;
+    }
+    return tmu_word_break_count;
+}
+
+TMU_DEF const char* tmu_utf8_next_word_break(tmu_utf8_stream stream) {
+    TM_ASSERT(stream.cur <= stream.end);
+
+    uint32_t codepoint = TMU_INVALID_CODEPOINT;
+    if (stream.cur == stream.end) return stream.end;
+    if (!tmu_utf8_extract(&stream, &codepoint)) return stream.cur + 1;
+
+    /* raw is the property of the previous codepoint, last and before_last are the properties of the previous
+       codepoints with Extend, Format and ZWJ skipped. */
+    tmu_ucd_word_break_enum raw = tmu_ucd_get_word_break(codepoint);
+    tmu_ucd_word_break_enum last = raw;
+    tmu_ucd_word_break_enum before_last = tmu_word_break_count;
+    tm_size_t regional_indicators = (raw == tmu_word_break_regional_indicator);
+
+    for (;;) {
+        const char* boundary = stream.cur;
+        if (!tmu_utf8_extract(&stream, &codepoint)) return boundary;
+        tmu_ucd_word_break_enum cur = tmu_ucd_get_word_break(codepoint);
+
+        if (raw == tmu_word_break_cr && cur == tmu_word_break_lf) {
+            /* WB3: CR x LF */
+        } else if (tmu_word_break_is_newline(raw) || tmu_word_break_is_newline(cur)) {
+            /* WB3a, WB3b: Break before and after newlines. */
+            return boundary;
+        } else if (raw == tmu_word_break_zwj && cur == tmu_word_break_extended_pictographic) {
+            /* WB3c: ZWJ x \p{Extended_Pictographic} */
+        } else if (raw == tmu_word_break_wsegspace && cur == tmu_word_break_wsegspace) {
+            /* WB3d: WSegSpace x WSegSpace */
+        } else if (tmu_word_break_is_ignorable(cur)) {
+            /* WB4: X (Extend | Format | ZWJ)* -> X */
+            raw = cur;
+            continue;
+        } else {
+            tm_bool no_break = TM_FALSE;
+            if (tmu_word_break_is_ahletter(last)) {
+                /* WB5, WB9 */
+                no_break = tmu_word_break_is_ahletter(cur) || cur == tmu_word_break_numeric;
+                /* WB6: AHLetter x (MidLetter | MidNumLetQ) AHLetter */
+                if (!no_break && (cur == tmu_word_break_midletter || tmu_word_break_is_midnumletq(cur))) {
+                    no_break = tmu_word_break_is_ahletter(tmu_word_break_peek(stream));
+                }
+                if (!no_break && last == tmu_word_break_hebrew_letter) {
+                    /* WB7a: Hebrew_Letter x Single_Quote */
+                    no_break = (cur == tmu_word_break_single_quote);
+                    /* WB7b: Hebrew_Letter x Double_Quote Hebrew_Letter */
+                    if (cur == tmu_word_break_double_quote) {
+                        no_break = (tmu_word_break_peek(stream) == tmu_word_break_hebrew_letter);
+                    }
+                }
+            } else if (last == tmu_word_break_numeric) {
+                /* WB8, WB10 */
+                no_break = cur == tmu_word_break_numeric || tmu_word_break_is_ahletter(cur);
+                /* WB12: Numeric x (MidNum | MidNumLetQ) Numeric */
+                if (!no_break && (cur == tmu_word_break_midnum || tmu_word_break_is_midnumletq(cur))) {
+                    no_break = (tmu_word_break_peek(stream) == tmu_word_break_numeric);
+                }
+            } else if (last == tmu_word_break_midletter || tmu_word_break_is_midnumletq(last)) {
+                /* WB7: AHLetter (MidLetter | MidNumLetQ) x AHLetter */
+                no_break = tmu_word_break_is_ahletter(before_last) && tmu_word_break_is_ahletter(cur);
+                /* WB11: Numeric (MidNum | MidNumLetQ) x Numeric */
+                if (!no_break && last != tmu_word_break_midletter) {
+                    no_break = before_last == tmu_word_break_numeric && cur == tmu_word_break_numeric;
+                }
+            } else if (last == tmu_word_break_midnum) {
+                /* WB11 */
+                no_break = before_last == tmu_word_break_numeric && cur == tmu_word_break_numeric;
+            } else if (last == tmu_word_break_double_quote) {
+                /* WB7c: Hebrew_Letter Double_Quote x Hebrew_Letter */
+                no_break = before_last == tmu_word_break_hebrew_letter && cur == tmu_word_break_hebrew_letter;
+            } else if (last == tmu_word_break_katakana) {
+                /* WB13 */
+                no_break = (cur == tmu_word_break_katakana);
+            } else if (last == tmu_word_break_extendnumlet) {
+                /* WB13b */
+                no_break = tmu_word_break_is_ahletter(cur) || cur == tmu_word_break_numeric ||
+                           cur == tmu_word_break_katakana;
+            } else if (last == tmu_word_break_regional_indicator) {
+                /* WB15, WB16: Do not break within pairs of regional indicators. */
+                no_break = (cur == tmu_word_break_regional_indicator) && (regional_indicators % 2) == 1;
+            }
+
+            /* WB13a: (AHLetter | Numeric | Katakana | ExtendNumLet) x ExtendNumLet */
+            if (!no_break && cur == tmu_word_break_extendnumlet) {
+                no_break = tmu_word_break_is_ahletter(last) || last == tmu_word_break_numeric ||
+                           last == tmu_word_break_katakana || last == tmu_word_break_extendnumlet;
+            }
+
+            /* WB999: Any | Any */
+            if (!no_break) return boundary;
+        }
+
+        regional_indicators = (cur == tmu_word_break_regional_indicator) ? (regional_indicators + 1) : 0;
+        before_last = last;
+        last = cur;
+        raw = cur;
+    }
+}
+#endif /* TMU_UCD_HAS_WORD_BREAK */
+
+#if TMU_UCD_HAS_SENTENCE_BREAK
+static tm_bool tmu_sentence_break_is_ignorable(tmu_ucd_sentence_break_enum sb) {
+    return sb == tmu_sentence_break_extend || sb == tmu_sentence_break_format;
+}
+static tm_bool tmu_sentence_break_is_para_sep(tmu_ucd_sentence_break_enum sb) {
+    return sb == tmu_sentence_break_sep || sb == tmu_sentence_break_cr || sb == tmu_sentence_break_lf;
+}
+static tm_bool tmu_sentence_break_is_saterm(tmu_ucd_sentence_break_enum sb) {
+    return sb == tmu_sentence_break_sterm || sb == tmu_sentence_break_aterm;
+}
+
+/* SB8: ATerm Close* Sp* x ( !(OLetter | Upper | Lower | ParaSep | SATerm) )* Lower
+   Scans forward starting with current, skipping Extend and Format (rule SB5). */
+static tm_bool tmu_sentence_break_lower_follows(tmu_ucd_sentence_break_enum current, tmu_utf8_stream stream) {
+    uint32_t codepoint = TMU_INVALID_CODEPOINT;
+    for (;;) {
+        if (current == tmu_sentence_break_lower) return TM_TRUE;
+        if (current == tmu_sentence_break_oletter || current == tmu_sentence_break_upper ||
+            tmu_sentence_break_is_para_sep(current) || tmu_sentence_break_is_saterm(current)) {
+            return TM_FALSE;
+        }
+        do {
+            if (!tmu_utf8_extract(&stream, &codepoint)) return TM_FALSE;
+            current = tmu_ucd_get_sentence_break(codepoint);
+        } while (tmu_sentence_break_is_ignorable(current));
+    }
+}
+
+TMU_DEF const char* tmu_utf8_next_sentence_break(tmu_utf8_stream stream) {
+    TM_ASSERT(stream.cur <= stream.end);
+
+    /* States after a sentence terminator, needed for rules SB8 to SB11. */
+    enum { after_none, after_saterm_close, after_saterm_close_sp };
+
+    uint32_t codepoint = TMU_INVALID_CODEPOINT;
+    if (stream.cur == stream.end) return stream.end;
+    if (!tmu_utf8_extract(&stream, &codepoint)) return stream.cur + 1;
+
+    /* raw is the property of the previous codepoint, last and before_last are the properties of the previous
+       codepoints with Extend and Format skipped. */
+    tmu_ucd_sentence_break_enum raw = tmu_ucd_get_sentence_break(codepoint);
+    tmu_ucd_sentence_break_enum last = raw;
+    tmu_ucd_sentence_break_enum before_last = tmu_sentence_break_count;
+    int state = tmu_sentence_break_is_saterm(raw) ? after_saterm_close : after_none;
+    tm_bool is_aterm = (raw == tmu_sentence_break_aterm);
+
+    for (;;) {
+        const char* boundary = stream.cur;
+        if (!tmu_utf8_extract(&stream, &codepoint)) return boundary;
+        tmu_ucd_sentence_break_enum cur = tmu_ucd_get_sentence_break(codepoint);
+
+        if (raw == tmu_sentence_break_cr && cur == tmu_sentence_break_lf) {
+            /* SB3: CR x LF */
+        } else if (tmu_sentence_break_is_para_sep(raw)) {
+            /* SB4: ParaSep | */
+            return boundary;
+        } else if (tmu_sentence_break_is_ignorable(cur)) {
+            /* SB5: X (Extend | Format)* -> X */
+            raw = cur;
+            continue;
+        } else if (last == tmu_sentence_break_aterm && cur == tmu_sentence_break_numeric) {
+            /* SB6: ATerm x Numeric */
+        } else if (last == tmu_sentence_break_aterm && cur == tmu_sentence_break_upper &&
+                   (before_last == tmu_sentence_break_upper || before_last == tmu_sentence_break_lower)) {
+            /* SB7: (Upper | Lower) ATerm x Upper */
+        } else if (state != after_none) {
+            tm_bool no_break = is_aterm && tmu_sentence_break_lower_follows(cur, stream); /* SB8 */
+            /* SB8a: SATerm Close* Sp* x (SContinue | SATerm) */
+            no_break = no_break || cur == tmu_sentence_break_scontinue || tmu_sentence_break_is_saterm(cur);
+            /* SB9: SATerm Close* x (Close | Sp | ParaSep) */
+            no_break = no_break || (state == after_saterm_close && cur == tmu_sentence_break_close);
+            /* SB10: SATerm Close* Sp* x (Sp | ParaSep) */
+            no_break = no_break || cur == tmu_sentence_break_sp || tmu_sentence_break_is_para_sep(cur);
+            /* SB11: SATerm Close* Sp* ParaSep? | */
+            if (!no_break) return boundary;
+        }
+        /* SB998: Any x Any */
+
+        if (tmu_sentence_break_is_saterm(cur)) {
+            state = after_saterm_close;
+            is_aterm = (cur == tmu_sentence_break_aterm);
+        } else if (cur == tmu_sentence_break_close && state == after_saterm_close) {
+            state = after_saterm_close;
+        } else if (cur == tmu_sentence_break_sp && state != after_none) {
+            state = after_saterm_close_sp;
+        } else {
+            state = after_none;
+        }
+        before_last = last;
+        last = cur;
+        raw = cur;
+    }
+}
+#endif /* TMU_UCD_HAS_SENTENCE_BREAK */
+
 typedef struct {
     char* data;
     tm_size_t size;
@@ -4913,6 +6748,143 @@ static void tmu_transform_output_append_codepoint(uint32_t codepoint, tmu_transf
     }
 }
 
+#if TMU_UCD_HAS_SIMPLE_CASE || TMU_UCD_HAS_SIMPLE_CASE_FOLD || TMU_UCD_HAS_FULL_CASE || TMU_UCD_HAS_FULL_CASE_FOLD
+/*
+ASCII fast paths.
+Lowercasing and case folding map exactly 'A'-'Z' to 'a'-'z' in the ASCII range, both for the simple and full variants.
+Runs of ASCII are therefore transformed and compared 8 bytes at a time without decoding or looking up the UCD.
+*/
+static void tmu_ascii_store(uint64_t value, char* out) {
+    for (int i = 0; i < 8; ++i) {
+        out[i] = (char)(uint8_t)(value >> (i * 8));
+    }
+}
+
+/* All bytes of value must be ASCII, so that no addition can carry into the next byte. */
+static uint64_t tmu_ascii_to_lower(uint64_t value) {
+    uint64_t at_least_a = value + TMU_ASCII_ONES * (0x80 - 'A');
+    uint64_t above_z = value + TMU_ASCII_ONES * (0x7F - 'Z');
+    uint64_t is_upper = (at_least_a ^ above_z) & TMU_ASCII_HIGH_BITS;
+    return value | (is_upper >> 2);
+}
+
+static char tmu_ascii_char_to_lower(char c) { return (c >= 'A' && c <= 'Z') ? (char)(c + ('a' - 'A')) : c; }
+
+static tm_size_t tmu_ascii_run_length(const char* cur, const char* end) {
+    const char* first = cur;
+    while (end - cur >= 8 && !(tmu_ascii_load(cur) & TMU_ASCII_HIGH_BITS)) cur += 8;
+    while (cur != end && (uint8_t)*cur < 0x80) ++cur;
+    return (tm_size_t)(cur - first);
+}
+
+/* Consumes the ASCII run at the start of stream and appends it lowercased to out. */
+static void tmu_transform_output_append_ascii_lower(tmu_utf8_stream* stream, tmu_transform_output_stream* out) {
+    const char* cur = stream->cur;
+    const char* end = stream->end;
+    char* data = out->data + out->size;
+    tm_size_t remaining = out->capacity - out->size;
+
+    while (end - cur >= 8 && remaining >= 8) {
+        uint64_t value = tmu_ascii_load(cur);
+        if (value & TMU_ASCII_HIGH_BITS) break;
+        tmu_ascii_store(tmu_ascii_to_lower(value), data);
+        cur += 8;
+        data += 8;
+        remaining -= 8;
+    }
+    while (cur != end && (uint8_t)*cur < 0x80 && remaining > 0) {
+        *data++ = tmu_ascii_char_to_lower(*cur++);
+        --remaining;
+    }
+
+    tm_size_t written = (tm_size_t)(cur - stream->cur);
+    out->size += written;
+    out->result.size += written;
+
+    tm_size_t rest = tmu_ascii_run_length(cur, end);
+    if (rest > 0) {
+        /* Output is full, only count the required size from here on. */
+        out->result.size += rest;
+        out->result.ec = TM_ERANGE;
+        out->data = TM_NULL;
+        out->size = 0;
+        out->capacity = 0;
+        cur += rest;
+    }
+    stream->cur = cur;
+}
+
+/* Skips the common prefix of both streams that is ASCII and equal ignoring case. */
+static void tmu_utf8_skip_ascii_equal_ignore_case(tmu_utf8_stream* a, tmu_utf8_stream* b) {
+    const char* a_cur = a->cur;
+    const char* b_cur = b->cur;
+    const char* a_end = a->end;
+    const char* b_end = b->end;
+
+    while (a_end - a_cur >= 8 && b_end - b_cur >= 8) {
+        uint64_t a_value = tmu_ascii_load(a_cur);
+        uint64_t b_value = tmu_ascii_load(b_cur);
+        if ((a_value | b_value) & TMU_ASCII_HIGH_BITS) break;
+        if (tmu_ascii_to_lower(a_value) != tmu_ascii_to_lower(b_value)) break;
+        a_cur += 8;
+        b_cur += 8;
+    }
+    while (a_cur != a_end && b_cur != b_end && (uint8_t)*a_cur < 0x80 && (uint8_t)*b_cur < 0x80 &&
+           tmu_ascii_char_to_lower(*a_cur) == tmu_ascii_char_to_lower(*b_cur)) {
+        ++a_cur;
+        ++b_cur;
+    }
+    a->cur = a_cur;
+    b->cur = b_cur;
+}
+
+#endif
+
+#if TMU_UCD_HAS_SIMPLE_CASE_FOLD || TMU_UCD_HAS_FULL_CASE_FOLD
+/*
+Numbers in human comparisons saturate at TMU_HUMAN_NUMBER_MAX instead of wrapping around, so that long digit runs
+still order after shorter ones and value + TMU_MAX_UTF32 still fits into an int.
+*/
+#define TMU_HUMAN_NUMBER_MAX (0x7FFFFFFFu - TMU_MAX_UTF32)
+static uint32_t tmu_human_number_append_digit(uint32_t value, uint32_t digit) {
+    TM_ASSERT(digit <= 9);
+    if (value > (TMU_HUMAN_NUMBER_MAX - digit) / 10) return TMU_HUMAN_NUMBER_MAX;
+    return (value * 10) + digit;
+}
+
+/*
+Appends a value returned by tmu_utf8_extract_human(_simple) to a sort key.
+Codepoints are appended as UTF-8, since bytewise order of UTF-8 is the same as codepoint order.
+Numbers are appended as 0xF8 followed by the value in big endian. 0xF8 never appears in UTF-8, so numbers order
+after all codepoints, just like in tmu_utf8_human_compare.
+*/
+static void tmu_sort_key_append(uint32_t value, tmu_transform_output_stream* out) {
+    if (value < TMU_MAX_UTF32 && tmu_is_valid_codepoint(value)) {
+        tmu_transform_output_append_codepoint(value, out);
+        return;
+    }
+
+    value -= TMU_MAX_UTF32;
+    tm_size_t out_size = out->size;
+    tm_size_t remaining = out->capacity - out_size;
+    out->result.size += 5;
+    if (remaining < 5) {
+        out->result.ec = TM_ERANGE;
+        out->data = TM_NULL;
+        out->size = 0;
+        out->capacity = 0;
+    } else {
+        char* p = out->data + out_size;
+        p[0] = (char)0xF8;
+        p[1] = (char)(uint8_t)(value >> 24);
+        p[2] = (char)(uint8_t)(value >> 16);
+        p[3] = (char)(uint8_t)(value >> 8);
+        p[4] = (char)(uint8_t)value;
+        out->size += 5;
+    }
+}
+#endif
+
 #if TMU_UCD_HAS_SIMPLE_CASE
 TMU_DEF tmu_transform_result tmu_utf8_to_upper_simple(const char* str, tm_size_t str_len, char* out,
                                                       tm_size_t out_len) {
@@ -4955,10 +6927,12 @@ TMU_DEF tmu_transform_result tmu_utf8_to_lower_simple(const char* str, tm_size_t
     out_stream.capacity = out_len;
     tmu_utf8_stream stream = tmu_utf8_make_stream_n(str, str_len);
     uint32_t codepoint = TMU_INVALID_CODEPOINT;
+    tmu_transform_output_append_ascii_lower(&stream, &out_stream);
     while (tmu_utf8_extract(&stream, &codepoint)) {
         const tmu_ucd_internal* internal = tmu_get_ucd_internal(codepoint);
         uint32_t transformed = codepoint + internal->simple_lower_offset;
         tmu_transform_output_append_codepoint(transformed, &out_stream);
+        tmu_transform_output_append_ascii_lower(&stream, &out_stream);
     }
     if (out_stream.result.ec == TM_OK && stream.cur != stream.end) {
         out_stream.result.ec = TM_EINVAL;
@@ -4975,10 +6949,12 @@ TMU_DEF tmu_transform_result tmu_utf8_to_case_fold_simple(const char* str, tm_si
     out_stream.capacity = out_len;
     tmu_utf8_stream stream = tmu_utf8_make_stream_n(str, str_len);
     uint32_t codepoint = TMU_INVALID_CODEPOINT;
+    tmu_transform_output_append_ascii_lower(&stream, &out_stream);
     while (tmu_utf8_extract(&stream, &codepoint)) {
         const tmu_ucd_internal* internal = tmu_get_ucd_internal(codepoint);
         uint32_t transformed = codepoint + internal->simple_case_fold_offset;
         tmu_transform_output_append_codepoint(transformed, &out_stream);
+        tmu_transform_output_append_ascii_lower(&stream, &out_stream);
     }
     if (out_stream.result.ec == TM_OK && stream.cur != stream.end) {
         out_stream.result.ec = TM_EINVAL;
@@ -5001,7 +6977,15 @@ TMU_DEF tm_bool tmu_utf8_equals_ignore_case_simple(const char* a, tm_size_t a_le
 
     uint32_t a_cp = TMU_INVALID_CODEPOINT;
     uint32_t b_cp = TMU_INVALID_CODEPOINT;
-    while (tmu_utf8_extract(&a_stream, &a_cp) && tmu_utf8_extract(&b_stream, &b_cp)) {
+    tmu_utf8_skip_ascii_equal_ignore_case(&a_stream, &b_stream);
+    tm_bool a_extracted = TM_FALSE;
+    tm_bool b_extracted = TM_FALSE;
+    for (;;) {
+        /* Extract from both streams unconditionally, so that we can tell whether only one of them ran out. */
+        a_extracted = tmu_utf8_extract(&a_stream, &a_cp);
+        b_extracted = tmu_utf8_extract(&b_stream, &b_cp);
+        if (!a_extracted || !b_extracted) break;
+
         const tmu_ucd_internal* a_internal = tmu_get_ucd_internal(a_cp);
         const tmu_ucd_internal* b_internal = tmu_get_ucd_internal(b_cp);
 
@@ -5009,8 +6993,9 @@ TMU_DEF tm_bool tmu_utf8_equals_ignore_case_simple(const char* a, tm_size_t a_le
         uint32_t b_case_folded = b_cp + b_internal->simple_case_fold_offset;
 
         if (a_case_folded != b_case_folded) return TM_FALSE;
+        tmu_utf8_skip_ascii_equal_ignore_case(&a_stream, &b_stream);
     }
-    return (a_stream.cur == a_stream.end) && (b_stream.cur == b_stream.end);
+    return !a_extracted && !b_extracted && (a_stream.cur == a_stream.end) && (b_stream.cur == b_stream.end);
 }
 
 TMU_DEF int tmu_utf8_compare_ignore_case_simple(const char* a, tm_size_t a_len, const char* b, tm_size_t b_len) {
@@ -5029,7 +7014,14 @@ TMU_DEF int tmu_utf8_compare_ignore_case_simple(const char* a, tm_size_t a_len,
 
     uint32_t a_cp = TMU_INVALID_CODEPOINT;
     uint32_t b_cp = TMU_INVALID_CODEPOINT;
-    while (tmu_utf8_extract(&a_stream, &a_cp) && tmu_utf8_extract(&b_stream, &b_cp)) {
+    tmu_utf8_skip_ascii_equal_ignore_case(&a_stream, &b_stream);
+    tm_bool a_extracted = TM_FALSE;
+    tm_bool b_extracted = TM_FALSE;
+    for (;;) {
+        a_extracted = tmu_utf8_extract(&a_stream, &a_cp);
+        b_extracted = tmu_utf8_extract(&b_stream, &b_cp);
+        if (!a_extracted || !b_extracted) break;
+
         const tmu_ucd_internal* a_internal = tmu_get_ucd_internal(a_cp);
         const tmu_ucd_internal* b_internal = tmu_get_ucd_internal(b_cp);
 
@@ -5038,10 +7030,11 @@ TMU_DEF int tmu_utf8_compare_ignore_case_simple(const char* a, tm_size_t a_len,
 
         int diff = (int)a_case_folded - (int)b_case_folded;
         if (diff != 0) return (diff < 0) ? -1 : 1;
+        tmu_utf8_skip_ascii_equal_ignore_case(&a_stream, &b_stream);
     }
 
-    tm_bool a_is_empty = (a_stream.cur == a_stream.end);
-    tm_bool b_is_empty = (b_stream.cur == b_stream.end);
+    tm_bool a_is_empty = !a_extracted && (a_stream.cur == a_stream.end);
+    tm_bool b_is_empty = !b_extracted && (b_stream.cur == b_stream.end);
     return b_is_empty - a_is_empty;
 }
 
@@ -5064,7 +7057,7 @@ static tm_bool tmu_utf8_extract_human_simple(tmu_utf8_stream* stream, uint32_t*
     /* We can treat the utf8 stream as an ascii stream and go byte by byte, since we are comparing ascii values. */
     uint32_t value = 0;
     while (cur != end && *cur >= '0' && *cur <= '9') {
-        value = (value * 10) + (*cur - '0');
+        value = tmu_human_number_append_digit(value, (uint32_t)(*cur - '0'));
         ++cur;
     }
     stream->cur = cur;
@@ -5091,15 +7084,37 @@ TMU_DEF int tmu_utf8_human_compare_simple(const char* a, tm_size_t a_len, const
 
     uint32_t a_cp = TMU_INVALID_CODEPOINT;
     uint32_t b_cp = TMU_INVALID_CODEPOINT;
-    while (tmu_utf8_extract_human_simple(&a_stream, &a_cp) && tmu_utf8_extract_human_simple(&b_stream, &b_cp)) {
+    tm_bool a_extracted = TM_FALSE;
+    tm_bool b_extracted = TM_FALSE;
+    for (;;) {
+        a_extracted = tmu_utf8_extract_human_simple(&a_stream, &a_cp);
+        b_extracted = tmu_utf8_extract_human_simple(&b_stream, &b_cp);
+        if (!a_extracted || !b_extracted) break;
+
         int diff = (int)a_cp - (int)b_cp;
         if (diff != 0) return (diff < 0) ? -1 : 1;
     }
 
-    tm_bool a_is_empty = (a_stream.cur == a_stream.end);
-    tm_bool b_is_empty = (b_stream.cur == b_stream.end);
+    tm_bool a_is_empty = !a_extracted && (a_stream.cur == a_stream.end);
+    tm_bool b_is_empty = !b_extracted && (b_stream.cur == b_stream.end);
     return b_is_empty - a_is_empty;
 }
+
+TMU_DEF tmu_transform_result tmu_utf8_make_sort_key_simple(const char* str, tm_size_t str_len, char* out,
+                                                           tm_size_t out_len) {
+    tmu_transform_output_stream out_stream = {TM_NULL, 0, 0, {0, TM_OK}};
+    out_stream.data = out;
+    out_stream.capacity = out_len;
+    tmu_utf8_stream stream = tmu_utf8_make_stream_n(str, str_len);
+    uint32_t value = TMU_INVALID_CODEPOINT;
+    while (tmu_utf8_extract_human_simple(&stream, &value)) {
+        tmu_sort_key_append(value, &out_stream);
+    }
+    if (out_stream.result.ec == TM_OK && stream.cur != stream.end) {
+        out_stream.result.ec = TM_EINVAL;
+    }
+    return out_stream.result;
+}
 #endif /* TMU_UCD_HAS_SIMPLE_CASE_FOLD */
 
 #if TMU_UCD_HAS_SIMPLE_CASE_TOGGLE
@@ -5177,6 +7192,7 @@ TMU_DEF tmu_transform_result tmu_utf8_to_lower(const char* str, tm_size_t str_le
     out_stream.capacity = out_len;
     tmu_utf8_stream stream = tmu_utf8_make_stream_n(str, str_len);
     uint32_t codepoint = TMU_INVALID_CODEPOINT;
+    tmu_transform_output_append_ascii_lower(&stream, &out_stream);
     while (tmu_utf8_extract(&stream, &codepoint)) {
         const tmu_ucd_internal* internal = tmu_get_ucd_internal(codepoint);
         if (internal->full_lower_index) {
@@ -5189,6 +7205,7 @@ TMU_DEF tmu_transform_result tmu_utf8_to_lower(const char* str, tm_size_t str_le
             uint32_t transformed = codepoint + internal->simple_lower_offset;
             tmu_transform_output_append_codepoint(transformed, &out_stream);
         }
+        tmu_transform_output_append_ascii_lower(&stream, &out_stream);
     }
     if (out_stream.result.ec == TM_OK && stream.cur != stream.end) {
         out_stream.result.ec = TM_EINVAL;
@@ -5231,6 +7248,7 @@ TMU_DEF tmu_transform_result tmu_utf8_to_case_fold(const char* str, tm_size_t st
     out_stream.capacity = out_len;
     tmu_utf8_stream stream = tmu_utf8_make_stream_n(str, str_len);
     uint32_t codepoint = TMU_INVALID_CODEPOINT;
+    tmu_transform_output_append_ascii_lower(&stream, &out_stream);
     while (tmu_utf8_extract(&stream, &codepoint)) {
         const tmu_ucd_internal* internal = tmu_get_ucd_internal(codepoint);
         if (internal->full_case_fold_index) {
@@ -5243,6 +7261,7 @@ TMU_DEF tmu_transform_result tmu_utf8_to_case_fold(const char* str, tm_size_t st
             uint32_t transformed = codepoint + internal->simple_case_fold_offset;
             tmu_transform_output_append_codepoint(transformed, &out_stream);
         }
+        tmu_transform_output_append_ascii_lower(&stream, &out_stream);
     }
     if (out_stream.result.ec == TM_OK && stream.cur != stream.end) {
         out_stream.result.ec = TM_EINVAL;
@@ -5269,6 +7288,10 @@ static tm_bool tmu_utf8_extract_case_folded(tmu_utf8_case_fold_stream* stream, u
     }
     uint32_t base_codepoint = TMU_INVALID_CODEPOINT;
     if (!tmu_utf8_extract(&stream->base, &base_codepoint)) return TM_FALSE;
+    if (base_codepoint < 0x80) {
+        *codepoint = (uint32_t)(uint8_t)tmu_ascii_char_to_lower((char)base_codepoint);
+        return TM_TRUE;
+    }
     const tmu_ucd_internal* internal = tmu_get_ucd_internal(base_codepoint);
     if (internal->full_case_fold_index) {
         stream->full_case_fold = tmu_codepoint_runs + tmu_full_case_fold_offset + internal->full_case_fold_index;
@@ -5301,11 +7324,19 @@ TMU_DEF tm_bool tmu_utf8_equals_ignore_case(const char* a, tm_size_t a_len, cons
 
     uint32_t a_cp = TMU_INVALID_CODEPOINT;
     uint32_t b_cp = TMU_INVALID_CODEPOINT;
-    while (tmu_utf8_extract_case_folded(&a_cf, &a_cp) && tmu_utf8_extract_case_folded(&b_cf, &b_cp)) {
+    tmu_utf8_skip_ascii_equal_ignore_case(&a_cf.base, &b_cf.base);
+    tm_bool a_extracted = TM_FALSE;
+    tm_bool b_extracted = TM_FALSE;
+    for (;;) {
+        a_extracted = tmu_utf8_extract_case_folded(&a_cf, &a_cp);
+        b_extracted = tmu_utf8_extract_case_folded(&b_cf, &b_cp);
+        if (!a_extracted || !b_extracted) break;
+
         if (a_cp != b_cp) return TM_FALSE;
+        if (!a_cf.full_case_fold && !b_cf.full_case_fold) tmu_utf8_skip_ascii_equal_ignore_case(&a_cf.base, &b_cf.base);
     }
-    return (a_cf.base.cur == a_cf.base.end) && (!a_cf.full_case_fold) && (b_cf.base.cur == b_cf.base.end) &&
-           (!b_cf.full_case_fold);
+    return !a_extracted && !b_extracted && (a_cf.base.cur == a_cf.base.end) && (!a_cf.full_case_fold) &&
+           (b_cf.base.cur == b_cf.base.end) && (!b_cf.full_case_fold);
 }
 
 TMU_DEF int tmu_utf8_compare_ignore_case(const char* a, tm_size_t a_len, const char* b, tm_size_t b_len) {
@@ -5327,13 +7358,21 @@ TMU_DEF int tmu_utf8_compare_ignore_case(const char* a, tm_size_t a_len, const c
 
     uint32_t a_cp = 0;
     uint32_t b_cp = 0;
-    while (tmu_utf8_extract_case_folded(&a_cf, &a_cp) && tmu_utf8_extract_case_folded(&b_cf, &b_cp)) {
+    tmu_utf8_skip_ascii_equal_ignore_case(&a_cf.base, &b_cf.base);
+    tm_bool a_extracted = TM_FALSE;
+    tm_bool b_extracted = TM_FALSE;
+    for (;;) {
+        a_extracted = tmu_utf8_extract_case_folded(&a_cf, &a_cp);
+        b_extracted = tmu_utf8_extract_case_folded(&b_cf, &b_cp);
+        if (!a_extracted || !b_extracted) break;
+
         int diff = (int)a_cp - (int)b_cp;
         if (diff != 0) return (diff < 0) ? -1 : 1;
+        if (!a_cf.full_case_fold && !b_cf.full_case_fold) tmu_utf8_skip_ascii_equal_ignore_case(&a_cf.base, &b_cf.base);
     }
 
-    tm_bool a_is_empty = (a_cf.base.cur == a_cf.base.end) && (!a_cf.full_case_fold);
-    tm_bool b_is_empty = (b_cf.base.cur == b_cf.base.end) && (!b_cf.full_case_fold);
+    tm_bool a_is_empty = !a_extracted && (a_cf.base.cur == a_cf.base.end) && (!a_cf.full_case_fold);
+    tm_bool b_is_empty = !b_extracted && (b_cf.base.cur == b_cf.base.end) && (!b_cf.full_case_fold);
     return b_is_empty - a_is_empty;
 }
 
@@ -5355,7 +7394,7 @@ static tm_bool tmu_utf8_extract_human(tmu_utf8_case_fold_stream* stream, uint32_
     /* We can treat the utf8 stream as an ascii stream and go byte by byte, since we are comparing ascii values. */
     uint32_t value = 0;
     while (cur != end && *cur >= '0' && *cur <= '9') {
-        value = (value * 10) + (*cur - '0');
+        value = tmu_human_number_append_digit(value, (uint32_t)(*cur - '0'));
         ++cur;
     }
     stream->base.cur = cur;
@@ -5385,15 +7424,37 @@ TMU_DEF int tmu_utf8_human_compare(const char* a, tm_size_t a_len, const char* b
 
     uint32_t a_cp = TMU_INVALID_CODEPOINT;
     uint32_t b_cp = TMU_INVALID_CODEPOINT;
-    while (tmu_utf8_extract_human(&a_cf, &a_cp) && tmu_utf8_extract_human(&b_cf, &b_cp)) {
+    tm_bool a_extracted = TM_FALSE;
+    tm_bool b_extracted = TM_FALSE;
+    for (;;) {
+        a_extracted = tmu_utf8_extract_human(&a_cf, &a_cp);
+        b_extracted = tmu_utf8_extract_human(&b_cf, &b_cp);
+        if (!a_extracted || !b_extracted) break;
+
         int diff = (int)a_cp - (int)b_cp;
         if (diff != 0) return (diff < 0) ? -1 : 1;
     }
 
-    tm_bool a_is_empty = (a_cf.base.cur == a_cf.base.end) && (!a_cf.full_case_fold);
-    tm_bool b_is_empty = (b_cf.base.cur == b_cf.base.end) && (!b_cf.full_case_fold);
+    tm_bool a_is_empty = !a_extracted && (a_cf.base.cur == a_cf.base.end) && (!a_cf.full_case_fold);
+    tm_bool b_is_empty = !b_extracted && (b_cf.base.cur == b_cf.base.end) && (!b_cf.full_case_fold);
     return b_is_empty - a_is_empty;
 }
+
+TMU_DEF tmu_transform_result tmu_utf8_make_sort_key(const char* str, tm_size_t str_len, char* out, tm_size_t out_len) {
+    tmu_transform_output_stream out_stream = {TM_NULL, 0, 0, {0, TM_OK}};
+    out_stream.data = out;
+    out_stream.capacity = out_len;
+    tmu_utf8_case_fold_stream cf = {{TM_NULL, TM_NULL}, TM_NULL};
+    cf.base = tmu_utf8_make_stream_n(str, str_len);
+    uint32_t value = TMU_INVALID_CODEPOINT;
+    while (tmu_utf8_extract_human(&cf, &value)) {
+        tmu_sort_key_append(value, &out_stream);
+    }
+    if (out_stream.result.ec == TM_OK && cf.base.cur != cf.base.end) {
+        out_stream.result.ec = TM_EINVAL;
+    }
+    return out_stream.result;
+}
 #endif /* TMU_UCD_HAS_FULL_CASE_FOLD */
 
 #endif /* defined(TMU_UCD_HAS_CASE_INFO) */
@@ -5472,26 +7533,31 @@ int main(int argc, char const* argv[]) {
 	#define TMU_REMOVE _wremove
 	#define TMU_RENAME _wrename
 	#define TMU_GETCWD _wgetcwd
+	#define TMU_FSYNC(file) _commit(_fileno(file))
+	#if (defined(_MSC_VER) && _MSC_VER < 1900 && !defined(__clang__)) || defined(TMU_TESTING_OLD_MSC)
+		#define TMU_NO_EXCLUSIVE_FOPEN /* Old msvc runtimes don't support the "x" mode of fopen. */
+	#endif
 
 #elif defined(TMU_PLATFORM_UNIX)
 	#ifndef TMU_TESTING
-		#if !defined(_XOPEN_SOURCE) || _XOPEN_SOURCE < 500
+		#if !defined(_XOPEN_SOURCE) || _XOPEN_SOURCE < 700
             #ifdef _XOPEN_SOURCE
                 #undef _XOPEN_SOURCE
             #endif
-            #define _XOPEN_SOURCE 500
+            #define _XOPEN_SOURCE 700
         #endif
-        #if !defined(_POSIX_C_SOURCE) || _POSIX_C_SOURCE < 200112L
+        #if !defined(_POSIX_C_SOURCE) || _POSIX_C_SOURCE < 200809L
             #ifdef _POSIX_C_SOURCE
                 #undef _POSIX_C_SOURCE
             #endif
-            #define _POSIX_C_SOURCE 200112L
+            #define _POSIX_C_SOURCE 200809L
         #endif
         #ifndef _BSD_SOURCE
             #define _BSD_SOURCE
         #endif
-	    #include <unistd.h> /* getcwd */
+	    #include <unistd.h> /* getcwd, fsync */
 		#include <dirent.h> /* Directory reading. */
+		#include <fcntl.h> /* fstatat flags and open. */
 	#endif /* !defined(TMU_TESTING) */
 	#ifdef TMU_USE_CONSOLE
 		#include<stdarg.h> /* Needed for tmu_printf and tmu_fprintf */
@@ -5515,6 +7581,7 @@ int main(int argc, char const* argv[]) {
 	#define TMU_REMOVE remove
 	#define TMU_RENAME rename
 	#define TMU_GETCWD getcwd
+	#define TMU_FSYNC(file) fsync(fileno(file))
 
 #endif /* defined(__GNUC__) || defined(__clang__) || defined(__linux__) || defined(TMU_TESTING_UNIX) */
 /* clang-format on */
@@ -5525,6 +7592,8 @@ static tm_size_t tmu_get_path_len_internal(const tmu_tchar* filename, tm_size_t
 struct tmu_contents_struct;
 static void tmu_to_tmu_path(struct tmu_contents_struct* path, tm_bool is_dir);
 TMU_DEF tm_bool tmu_grow_by(struct tmu_contents_struct* contents, tm_size_t amount);
+static tmu_file_writer tmu_file_writer_open_internal(const tmu_tchar* filename, uint32_t flags,
+                                                    tm_size_t buffer_capacity);
 
 #if defined(_WIN32) && !defined(TMU_TESTING_UNIX)
 struct tmu_platform_path_struct;
@@ -5877,69 +7946,50 @@ static tmu_write_file_result tmu_write_file_ex_t(const WCHAR* filename, const vo
         return tmu_write_file_ex_internal(filename, data, size, flags);
     }
 
-    tmu_write_file_result result = {0, TM_OK};
-
-    tm_size_t filename_len = (tm_size_t)lstrlenW(filename);
-    tm_size_t dir_len = tmu_get_path_len_internal(filename, filename_len);
-    if (flags & tmu_create_directory_tree) {
-        tm_errc ec = tmu_create_directory_internal(filename, dir_len);
-        if (ec != TM_OK) {
-            result.ec = ec;
-            return result;
-        }
-    }
-
-    WCHAR* temp_file = TM_NULL;
-    WCHAR temp_file_buffer[MAX_PATH];
-    const tm_size_t temp_file_len = filename_len + 9;
-
-    /* Limitation of GetTempFileNameW, dir_len cannot be bigger than MAX_PATH - 14. */
-    if (dir_len < MAX_PATH - 14) {
-        WCHAR temp_dir[MAX_PATH];
-        TMU_MEMCPY(temp_dir, filename, dir_len * sizeof(WCHAR));
-        temp_dir[dir_len] = 0;
-        if (GetTempFileNameW(temp_dir, TMU_TEXT("tmf"), 0, temp_file_buffer) == 0) {
-            result.ec = TM_EIO;
-            return result;
-        }
+    tmu_file_writer writer = tmu_file_writer_open_internal(filename, flags, /*buffer_capacity=*/0);
+    tmu_file_writer_write(&writer, data, size);
+    return tmu_file_writer_close(&writer);
+}
 
-        temp_file = temp_file_buffer;
-    } else {
-        /* Fallback to using a simple temp_file. */
-        temp_file = (WCHAR*)TMU_MALLOC(temp_file_len * sizeof(WCHAR), sizeof(WCHAR));
-        if (!temp_file) {
-            result.ec = TM_ENOMEM;
-            return result;
-        }
-        TMU_MEMCPY(temp_file, filename, filename_len * sizeof(WCHAR));
-        /* Copy filename ending + null terminator. */
-        TMU_MEMCPY(temp_file + filename_len, TMU_TEXT(".tmu_tmp"), sizeof(WCHAR) * 9);
-    }
+static tm_errc tmu_file_writer_open_t(const WCHAR* filename, tm_bool exclusive, void** out) {
+    TM_ASSERT(out);
 
-    TM_ASSERT(temp_file);
+    DWORD creation_flags = (exclusive) ? CREATE_NEW : CREATE_ALWAYS;
+    HANDLE file = CreateFileW(filename, GENERIC_WRITE, 0, TM_NULL, creation_flags, FILE_ATTRIBUTE_NORMAL, TM_NULL);
+    if (file == INVALID_HANDLE_VALUE) return tmu_winerror_to_errc(GetLastError(), TM_EIO);
+    *out = (void*)file;
+    return TM_OK;
+}
 
-    tmu_write_file_result temp_write_result = tmu_write_file_ex_internal(temp_file, data, size, 0);
-    if (temp_write_result.ec != TM_OK) {
-        result.ec = temp_write_result.ec;
-        if (temp_file != temp_file_buffer) {
-            TMU_FREE(temp_file);
-        }
-        return result;
-    }
+static tm_errc tmu_file_writer_write_t(void* handle, const void* data, tm_size_t size) {
+    TM_ASSERT(handle);
+    TM_ASSERT(data || size == 0);
 
-    DWORD move_flags = MOVEFILE_COPY_ALLOWED;
-    if (flags & tmu_overwrite) move_flags |= MOVEFILE_REPLACE_EXISTING;
-    if (!MoveFileExW(temp_file, filename, move_flags)) {
-        result.ec = tmu_winerror_to_errc(GetLastError(), TM_EIO);
-        if (temp_file != temp_file_buffer) {
-            TMU_FREE(temp_file);
+    const char* cur = (const char*)data;
+    while (size > 0) {
+        /* WriteFile takes a DWORD as size, write in chunks so that there is no UINT32_MAX limit. */
+        DWORD chunk_size = ((size_t)size > (size_t)0x40000000u) ? (DWORD)0x40000000u : (DWORD)size;
+        DWORD bytes_written = 0;
+        if (!WriteFile((HANDLE)handle, cur, chunk_size, &bytes_written, TM_NULL)) {
+            return tmu_winerror_to_errc(GetLastError(), TM_EIO);
         }
-        return result;
-    }
-    if (temp_file != temp_file_buffer) {
-        TMU_FREE(temp_file);
+        if (bytes_written != chunk_size) return TM_EIO;
+        cur += bytes_written;
+        size -= (tm_size_t)bytes_written;
     }
-    return result;
+    return TM_OK;
+}
+
+static tm_errc tmu_file_writer_sync_t(void* handle) {
+    TM_ASSERT(handle);
+    if (!FlushFileBuffers((HANDLE)handle)) return tmu_winerror_to_errc(GetLastError(), TM_EIO);
+    return TM_OK;
+}
+
+static tm_errc tmu_file_writer_close_t(void* handle) {
+    TM_ASSERT(handle);
+    if (!CloseHandle((HANDLE)handle)) return tmu_winerror_to_errc(GetLastError(), TM_EIO);
+    return TM_OK;
 }
 
 static tm_errc tmu_rename_file_ex_t(const WCHAR* from, const WCHAR* to, uint32_t flags) {
@@ -5954,6 +8004,12 @@ static tm_errc tmu_rename_file_ex_t(const WCHAR* from, const WCHAR* to, uint32_t
     return TM_OK;
 }
 
+/* Directories can't be synced on Windows, renames are only as durable as the file system makes them. */
+static tm_errc tmu_sync_parent_directory_t(const WCHAR* filename) {
+    TM_UNREFERENCED_PARAM(filename);
+    return TM_OK;
+}
+
 static tm_errc tmu_delete_file_t(const WCHAR* filename) {
     if (!DeleteFileW(filename)) return tmu_winerror_to_errc(GetLastError(), TM_EIO);
     return TM_OK;
@@ -6130,22 +8186,25 @@ TMU_DEF void tmu_close_directory(tmu_opened_dir* dir) {
         TMU_FREE(find_data);
     }
     tmu_destroy_contents(&dir->internal_buffer);
+    tmu_destroy_contents(&dir->internal_names);
     ZeroMemory(dir, sizeof(tmu_opened_dir));
 }
 
-TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir) {
-    if (!dir) return TM_NULL;
-    if (dir->ec != TM_OK) return TM_NULL;
-    if (!dir->internal) return TM_NULL;
+static tm_bool tmu_read_directory_internal(tmu_opened_dir* dir, uint32_t flags, tmu_directory_entry* out) {
+    TM_ASSERT(dir);
+    TM_ASSERT(out);
+    TM_UNREFERENCED_PARAM(flags);
+    if (dir->ec != TM_OK) return TM_FALSE;
+    if (!dir->internal) return TM_FALSE;
 
     struct tmu_internal_find_data* find_data = (struct tmu_internal_find_data*)dir->internal;
     if (find_data->handle == INVALID_HANDLE_VALUE) {
         dir->ec = TM_EPERM;
-        return TM_NULL;
+        return TM_FALSE;
     }
     if (!find_data->has_data) {
         dir->ec = find_data->next_ec;
-        return TM_NULL;
+        return TM_FALSE;
     }
 
     /* Skip "." and ".." entries. */
@@ -6157,16 +8216,15 @@ TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir)
         if (!find_data->has_data) {
             DWORD last_error = GetLastError();
             if (last_error != ERROR_NO_MORE_FILES) dir->ec = tmu_winerror_to_errc(last_error, TM_EPERM);
-            return TM_NULL;
+            return TM_FALSE;
         }
     }
 
-    ZeroMemory(&dir->internal_result, sizeof(tmu_read_directory_result));
     int required_size = WideCharToMultiByte(CP_UTF8, TMU_TO_UTF8_FLAGS, find_data->data.cFileName, -1, TM_NULL, 0,
                                             TM_NULL, TM_NULL);
     if (required_size <= 0) {
         dir->ec = tmu_winerror_to_errc(GetLastError(), TM_EPERM);
-        return TM_NULL;
+        return TM_FALSE;
     }
 
     // Additional size for trailing slash and nullterminator.
@@ -6175,14 +8233,14 @@ TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir)
         dir->internal_buffer.data = (char*)TMU_MALLOC((size_t)required_size, sizeof(char));
         if (!dir->internal_buffer.data) {
             dir->ec = TM_ENOMEM;
-            return TM_NULL;
+            return TM_FALSE;
         }
         dir->internal_buffer.capacity = (tm_size_t)required_size;
     } else if (dir->internal_buffer.capacity < (tm_size_t)required_size) {
         dir->internal_buffer.size = 0;
         if (!tmu_grow_by(&dir->internal_buffer, (tm_size_t)required_size)) {
             dir->ec = TM_ENOMEM;
-            return TM_NULL;
+            return TM_FALSE;
         }
     }
     TM_ASSERT(dir->internal_buffer.data);
@@ -6190,7 +8248,7 @@ TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir)
                                         dir->internal_buffer.data, (int)dir->internal_buffer.capacity, TM_NULL, TM_NULL);
     if (real_size <= 0 || real_size >= required_size) {
         dir->ec = tmu_winerror_to_errc(GetLastError(), TM_EPERM);
-        return TM_NULL;
+        return TM_FALSE;
     }
 
     TM_ASSERT((tm_size_t)real_size < dir->internal_buffer.capacity);
@@ -6198,14 +8256,31 @@ TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir)
     dir->internal_buffer.size = (tm_size_t)real_size;
     tmu_to_tmu_path(&dir->internal_buffer, /*is_dir=*/((find_data->data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0));
 
-    dir->internal_result.is_file = (find_data->data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0;
-    dir->internal_result.name = dir->internal_buffer.data;
+    out->name = dir->internal_buffer.data;
+    out->is_file = (find_data->data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0;
+    out->has_stat = TM_TRUE;
+    out->size = ((uint64_t)find_data->data.nFileSizeHigh << 32u) | (uint64_t)find_data->data.nFileSizeLow;
+    TMU_MEMCPY(&out->file_time, &find_data->data.ftLastWriteTime, sizeof(find_data->data.ftLastWriteTime));
 
     find_data->has_data = FindNextFileW(find_data->handle, &find_data->data);
     if (!find_data->has_data) {
         DWORD last_error = GetLastError();
         if (last_error != ERROR_NO_MORE_FILES) find_data->next_ec = tmu_winerror_to_errc(last_error, TM_EPERM);
     }
+    return TM_TRUE;
+}
+
+TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir) {
+    if (!dir) return TM_NULL;
+
+    tmu_directory_entry entry;
+    if (!tmu_read_directory_internal(dir, /*flags=*/0, &entry)) {
+        ZeroMemory(&dir->internal_result, sizeof(tmu_read_directory_result));
+        return TM_NULL;
+    }
+
+    dir->internal_result.name = entry.name;
+    dir->internal_result.is_file = entry.is_file;
     return &dir->internal_result;
 }
 
@@ -6381,6 +8456,12 @@ static tm_bool tmu_to_platform_path_n(const char* path, tm_size_t size, tmu_plat
 }
 #endif
 
+/* Directories can't be synced on Windows, renames are only as durable as the file system makes them. */
+static tm_errc tmu_sync_parent_directory_t(const tmu_tchar* filename) {
+    TM_UNREFERENCED_PARAM(filename);
+    return TM_OK;
+}
+
 TMU_DEF tmu_contents_result tmu_current_working_directory(tm_size_t extra_size) {
     TM_UNREFERENCED_PARAM(extra_size);
     TM_ASSERT_VALID_SIZE(extra_size);
@@ -6469,22 +8550,25 @@ TMU_DEF void tmu_close_directory(tmu_opened_dir* dir) {
         TMU_FREE(find_data);
     }
     tmu_destroy_contents(&dir->internal_buffer);
+    tmu_destroy_contents(&dir->internal_names);
     memset(dir, 0, sizeof(tmu_opened_dir));
 }
 
-TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir) {
-    if (!dir) return TM_NULL;
-    if (dir->ec != TM_OK) return TM_NULL;
-    if (!dir->internal) return TM_NULL;
+static tm_bool tmu_read_directory_internal(tmu_opened_dir* dir, uint32_t flags, tmu_directory_entry* out) {
+    TM_ASSERT(dir);
+    TM_ASSERT(out);
+    TM_UNREFERENCED_PARAM(flags);
+    if (dir->ec != TM_OK) return TM_FALSE;
+    if (!dir->internal) return TM_FALSE;
 
     struct tmu_internal_find_data* find_data = (struct tmu_internal_find_data*)dir->internal;
     if (find_data->handle == -1) {
         dir->ec = TM_EPERM;
-        return TM_NULL;
+        return TM_FALSE;
     }
     if (!find_data->has_data) {
         dir->ec = find_data->next_ec;
-        return TM_NULL;
+        return TM_FALSE;
     }
 
     /* Skip "." and ".." entries. */
@@ -6495,11 +8579,10 @@ TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir)
         if (!find_data->has_data) {
             int last_error = errno;
             if (last_error != ENOENT) dir->ec = (tm_errc)last_error;
-            return TM_NULL;
+            return TM_FALSE;
         }
     }
 
-    memset(&dir->internal_result, 0, sizeof(tmu_read_directory_result));
     tmu_utf16_stream stream = tmu_utf16_make_stream(find_data->data.name);
     tmu_conversion_result conv_result
         = tmu_utf8_from_utf16_ex(stream, tmu_validate_error, /*replace_str=*/TM_NULL, 0, /*nullterminate=*/TM_TRUE,
@@ -6510,14 +8593,14 @@ TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir)
             dir->internal_buffer.data = (char*)TMU_MALLOC((size_t)conv_result.size, sizeof(char));
             if (!dir->internal_buffer.data) {
                 dir->ec = TM_ENOMEM;
-                return TM_NULL;
+                return TM_FALSE;
             }
             dir->internal_buffer.capacity = conv_result.size;
         } else if (dir->internal_buffer.capacity < conv_result.size) {
             dir->internal_buffer.size = 0;
             if (!tmu_grow_by(&dir->internal_buffer, conv_result.size)) {
                 dir->ec = TM_ENOMEM;
-                return TM_NULL;
+                return TM_FALSE;
             }
         }
         TM_ASSERT(dir->internal_buffer.data);
@@ -6527,21 +8610,38 @@ TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir)
     }
     if (conv_result.ec != TM_OK) {
         dir->ec = conv_result.ec;
-        return TM_NULL;
+        return TM_FALSE;
     }
 
     TM_ASSERT(conv_result.size < dir->internal_buffer.capacity);
     dir->internal_buffer.data[conv_result.size] = 0; /* Always nullterminate. */
     dir->internal_buffer.size = conv_result.size;
 
-    dir->internal_result.is_file = (find_data->data.attrib & _A_SUBDIR) == 0;
-    dir->internal_result.name = dir->internal_buffer.data;
+    out->name = dir->internal_buffer.data;
+    out->is_file = (find_data->data.attrib & _A_SUBDIR) == 0;
+    out->has_stat = TM_TRUE;
+    out->size = (uint64_t)find_data->data.size;
+    out->file_time = (tmu_file_time)find_data->data.time_write;
 
     find_data->has_data = (_wfindnext64(find_data->handle, &find_data->data) == 0);
     if (!find_data->has_data) {
         int last_error = errno;
         if (last_error != ENOENT) find_data->next_ec = (tm_errc)last_error;
     }
+    return TM_TRUE;
+}
+
+TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir) {
+    if (!dir) return TM_NULL;
+
+    tmu_directory_entry entry;
+    if (!tmu_read_directory_internal(dir, /*flags=*/0, &entry)) {
+        memset(&dir->internal_result, 0, sizeof(tmu_read_directory_result));
+        return TM_NULL;
+    }
+
+    dir->internal_result.name = entry.name;
+    dir->internal_result.is_file = entry.is_file;
     return &dir->internal_result;
 }
 
@@ -6727,6 +8827,35 @@ static FILE* tmu_freopen_t(const tmu_tchar* filename, const tmu_tchar* mode, FIL
     return freopen(filename, mode, current);
 }
 
+static void tmu_destroy_platform_path(tmu_platform_path* path);
+
+/* Syncs the directory containing filename, so that a file that was just moved into it survives a crash. */
+static tm_errc tmu_sync_parent_directory_t(const tmu_tchar* filename) {
+    tm_size_t dir_len = tmu_get_path_len_internal(filename, /*filename_len=*/0);
+    if (dir_len == 0 && filename[0] == TMU_DIR_DELIM) dir_len = 1;
+
+    tmu_platform_path platform_dir;
+    const tmu_tchar* dir = TMU_TEXT(".");
+    if (dir_len > 0) {
+        dir = tmu_to_platform_path_t(filename, dir_len, &platform_dir);
+        if (!dir) return TM_ENOMEM;
+    }
+
+    tm_errc result = TM_OK;
+    errno = 0;
+    int fd = open(dir, O_RDONLY);
+    if (fd < 0) {
+        result = (errno != 0) ? errno : TM_EIO;
+    } else {
+        /* Some file systems can't sync directories and report EINVAL, there is nothing more we can do there. */
+        if (fsync(fd) != 0 && errno != EINVAL) result = (errno != 0) ? errno : TM_EIO;
+        close(fd);
+    }
+
+    if (dir_len > 0) tmu_destroy_platform_path(&platform_dir);
+    return result;
+}
+
 TMU_DEF tmu_contents_result tmu_current_working_directory(tm_size_t extra_size) {
     TM_ASSERT_VALID_SIZE(extra_size);
 
@@ -6876,12 +9005,15 @@ TMU_DEF void tmu_close_directory(tmu_opened_dir* dir) {
     if (dir->internal) {
         closedir((DIR*)dir->internal);
     }
+    tmu_destroy_contents(&dir->internal_names);
     memset(dir, 0, sizeof(tmu_opened_dir));
 }
 
-TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir) {
-    if (!dir) return TM_NULL;
-    if (!dir->internal) return TM_NULL;
+static tm_bool tmu_read_directory_internal(tmu_opened_dir* dir, uint32_t flags, tmu_directory_entry* out) {
+    TM_ASSERT(dir);
+    TM_ASSERT(out);
+    if (dir->ec != TM_OK) return TM_FALSE;
+    if (!dir->internal) return TM_FALSE;
     DIR* handle = (DIR*)dir->internal;
 
     struct dirent* entry = TM_NULL;
@@ -6891,19 +9023,51 @@ TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir)
         if (!entry) {
             int last_error = errno;
             if (last_error != 0) dir->ec = last_error;
-            memset(&dir->internal_result, 0, sizeof(tmu_read_directory_result));
-            return TM_NULL;
+            return TM_FALSE;
         }
 
         /* Skip "." and ".." entries. */
         if ((entry->d_name[0] == '.' && entry->d_name[1] == 0)
             || (entry->d_name[0] == '.' && entry->d_name[1] == '.' && entry->d_name[2] == 0))
             continue;
+
+        out->name = entry->d_name;
+        out->is_file = (entry->d_type != DT_DIR);
+        out->has_stat = TM_FALSE;
+        out->size = 0;
+        out->file_time = 0;
+
+        /* Some filesystems don't fill out d_type, we need to query the type ourselves in that case. */
+        if ((flags & tmu_read_directory_stat) || entry->d_type == DT_UNKNOWN) {
+            TMU_STRUCT_STAT info;
+            errno = 0;
+            if (fstatat(dirfd(handle), entry->d_name, &info, AT_SYMLINK_NOFOLLOW) != 0) {
+                /* Entry was removed between readdir and fstatat. */
+                if (errno == ENOENT) continue;
+                dir->ec = (errno != 0) ? errno : TM_EIO;
+                return TM_FALSE;
+            }
+            out->is_file = !TMU_S_ISDIR(info.st_mode);
+            out->has_stat = TM_TRUE;
+            out->size = (uint64_t)info.st_size;
+            out->file_time = (tmu_file_time)info.st_mtime;
+        }
         break;
     }
+    return TM_TRUE;
+}
+
+TMU_DEF const tmu_read_directory_result* tmu_read_directory(tmu_opened_dir* dir) {
+    if (!dir) return TM_NULL;
+
+    tmu_directory_entry entry;
+    if (!tmu_read_directory_internal(dir, /*flags=*/0, &entry)) {
+        memset(&dir->internal_result, 0, sizeof(tmu_read_directory_result));
+        return TM_NULL;
+    }
 
-    dir->internal_result.name = entry->d_name;
-    dir->internal_result.is_file = ((entry->d_type & DT_DIR) == 0);
+    dir->internal_result.name = entry.name;
+    dir->internal_result.is_file = entry.is_file;
     return &dir->internal_result;
 }
 
@@ -7082,6 +9246,57 @@ static tmu_write_file_result tmu_write_file_ex_internal(const tmu_tchar* filenam
     return result;
 }
 
+static tm_errc tmu_file_writer_open_t(const tmu_tchar* filename, tm_bool exclusive, void** out) {
+    TM_ASSERT(out);
+
+    const tmu_tchar* mode = TMU_TEXT("wb");
+    if (exclusive) {
+#if defined(TMU_NO_EXCLUSIVE_FOPEN)
+        /* The runtime doesn't know the "x" mode, checking for existence beforehand is the best we can do. */
+        tmu_exists_result exists = tmu_file_exists_t(filename);
+        if (exists.ec != TM_OK) return exists.ec;
+        if (exists.exists) return TM_EEXIST;
+#else
+        mode = TMU_TEXT("wbx");
+#endif
+    }
+
+    errno = 0;
+    FILE* f = tmu_fopen_t(filename, mode);
+    if (!f) return (errno != 0) ? errno : TM_EIO;
+
+    /* Writes are already buffered by tmu_file_writer, no need to buffer them a second time. */
+    setvbuf(f, TM_NULL, _IONBF, 0);
+    *out = f;
+    return TM_OK;
+}
+
+static tm_errc tmu_file_writer_write_t(void* handle, const void* data, tm_size_t size) {
+    TM_ASSERT(handle);
+    FILE* f = (FILE*)handle;
+
+    errno = 0;
+    size_t written = fwrite(data, 1, (size_t)size, f);
+    if (written != (size_t)size || errno != 0 || ferror(f)) return (errno != 0) ? errno : TM_EIO;
+    return TM_OK;
+}
+
+static tm_errc tmu_file_writer_sync_t(void* handle) {
+    TM_ASSERT(handle);
+
+    errno = 0;
+    if (TMU_FSYNC((FILE*)handle) != 0) return (errno != 0) ? errno : TM_EIO;
+    return TM_OK;
+}
+
+static tm_errc tmu_file_writer_close_t(void* handle) {
+    TM_ASSERT(handle);
+
+    errno = 0;
+    if (fclose((FILE*)handle) != 0) return (errno != 0) ? errno : TM_EIO;
+    return TM_OK;
+}
+
 static tm_errc tmu_delete_file_t(const tmu_tchar* filename) {
     tm_errc result = TM_OK;
     if (TMU_REMOVE(filename) != 0) result = (errno != 0) ? errno : TM_EIO;
@@ -7125,33 +9340,9 @@ static tmu_write_file_result tmu_write_file_ex_t(const tmu_tchar* filename, cons
         return tmu_write_file_ex_internal(filename, data, size, flags);
     }
 
-    tmu_write_file_result result = {0, TM_EIO};
-
-#if 0
-    /* FIXME: Not implemented. */
-    /* Get a temp filename*/
-    char temp_filename_buffer[L_tmpnam + 1];
-    char* temp_filename = TM_NULL;
-    for (int attempts = 0; attempts < 10; ++attempts) {
-        // Try to open up a temporary file. If filename was not unique or another process got it, try again.
-        temp_filename = tmpnam(temp_filename_buffer);
-        if (!temp_filename) {
-            result.ec = TM_EEXIST;
-            break;
-        }
-        result = tmu_write_file_ex_internal(temp_filename, data, size, 0);
-        if (result.ec == TM_EEXIST) {
-            continue;
-        } else {
-            break;
-        }
-    }
-    if (result.ec == TM_OK) {
-        TM_ASSERT(temp_filename);
-        result.ec = tmu_rename_file_ex_t(temp_filename, filename, flags);
-    }
-#endif
-    return result;
+    tmu_file_writer writer = tmu_file_writer_open_internal(filename, flags, /*buffer_capacity=*/0);
+    tmu_file_writer_write(&writer, data, size);
+    return tmu_file_writer_close(&writer);
 }
 
 static tmu_file_timestamp_result tmu_file_timestamp_t(const tmu_tchar* dir) {
@@ -7202,6 +9393,7 @@ static tm_errc tmu_delete_directory_t(const tmu_tchar* dir) {
 #undef TMU_REMOVE
 #undef TMU_RENAME
 #undef TMU_GETCWD
+#undef TMU_FSYNC
 #undef TMU_FOPEN_READ
 #undef TMU_FOPEN_WRITE
 
@@ -7580,6 +9772,198 @@ TMU_DEF void tmu_destroy_contents(tmu_contents* contents) {
     }
 }
 
+static void tmu_file_writer_free_internal(tmu_file_writer* writer) {
+    TM_ASSERT(writer);
+    if (writer->buffer) {
+        TM_ASSERT(writer->buffer_capacity > 0);
+        TMU_FREE(writer->buffer);
+    }
+    if (writer->internal_paths) TMU_FREE(writer->internal_paths);
+    writer->buffer = TM_NULL;
+    writer->buffer_size = 0;
+    writer->buffer_capacity = 0;
+    writer->internal_handle = TM_NULL;
+    writer->internal_paths = TM_NULL;
+}
+
+static tmu_file_writer tmu_file_writer_open_internal(const tmu_tchar* filename, uint32_t flags,
+                                                    tm_size_t buffer_capacity) {
+    TM_ASSERT(filename);
+    TM_ASSERT_VALID_SIZE(buffer_capacity);
+
+    tmu_file_writer result = {TM_OK, 0, flags, TM_NULL, 0, 0, TM_NULL, TM_NULL};
+
+    tm_size_t filename_len = (tm_size_t)TMU_TEXTLEN(filename);
+    if (flags & tmu_create_directory_tree) {
+        result.ec = tmu_create_directory_internal(filename, tmu_get_path_len_internal(filename, filename_len));
+        if (result.ec != TM_OK) return result;
+    }
+
+    if (!(flags & tmu_overwrite)) {
+        tmu_exists_result exists = tmu_file_exists_t(filename);
+        if (exists.ec != TM_OK || exists.exists) {
+            result.ec = (exists.ec != TM_OK) ? exists.ec : TM_EEXIST;
+            return result;
+        }
+    }
+
+    if (buffer_capacity > 0) {
+        result.buffer = (char*)TMU_MALLOC(buffer_capacity * sizeof(char), sizeof(char));
+        if (!result.buffer) {
+            result.ec = TM_ENOMEM;
+            return result;
+        }
+        result.buffer_capacity = buffer_capacity;
+    }
+
+    if (flags & tmu_atomic_write) {
+        /* The temporary file is put next to the destination, so that it can be moved without copying.
+           Layout of internal_paths is "<filename>\0<filename>.tmu_tmpXX\0". */
+        static const char temp_suffix[] = ".tmu_tmp";
+        const tm_size_t temp_suffix_len = (tm_size_t)(sizeof(temp_suffix) - 1);
+        const tm_size_t paths_len = filename_len + 1 + filename_len + temp_suffix_len + 2 + 1;
+
+        tmu_tchar* paths = (tmu_tchar*)TMU_MALLOC(paths_len * sizeof(tmu_tchar), sizeof(tmu_tchar));
+        if (!paths) {
+            tmu_file_writer_free_internal(&result);
+            result.ec = TM_ENOMEM;
+            return result;
+        }
+        result.internal_paths = paths;
+
+        TMU_MEMCPY(paths, filename, (filename_len + 1) * sizeof(tmu_tchar));
+        tmu_tchar* temp_filename = paths + filename_len + 1;
+        TMU_MEMCPY(temp_filename, filename, filename_len * sizeof(tmu_tchar));
+        for (tm_size_t i = 0; i < temp_suffix_len; ++i) {
+            temp_filename[filename_len + i] = (tmu_tchar)temp_suffix[i];
+        }
+        tmu_tchar* digits = temp_filename + filename_len + temp_suffix_len;
+        digits[2] = 0;
+
+        /* Take the first temporary filename that isn't taken yet. The temporary file is created exclusively,
+           so that a file that pops up under the same name concurrently is never clobbered. */
+        result.ec = TM_EEXIST;
+        for (int attempt = 0; attempt < 100 && result.ec == TM_EEXIST; ++attempt) {
+            digits[0] = (tmu_tchar)('0' + attempt / 10);
+            digits[1] = (tmu_tchar)('0' + attempt % 10);
+            result.ec = tmu_file_writer_open_t(temp_filename, /*exclusive=*/TM_TRUE, &result.internal_handle);
+        }
+    } else {
+        result.ec = tmu_file_writer_open_t(filename, /*exclusive=*/!(flags & tmu_overwrite), &result.internal_handle);
+    }
+
+    if (result.ec != TM_OK) {
+        tmu_file_writer_free_internal(&result);
+        return result;
+    }
+
+    if (flags & tmu_write_byte_order_mark) tmu_file_writer_write(&result, tmu_utf8_bom, sizeof(tmu_utf8_bom));
+    return result;
+}
+
+TMU_DEF tmu_file_writer tmu_file_writer_open(const char* filename, uint32_t flags, tm_size_t buffer_capacity) {
+    tmu_file_writer result = {TM_ENOMEM, 0, flags, TM_NULL, 0, 0, TM_NULL, TM_NULL};
+    tmu_platform_path platform_filename;
+    if (tmu_to_platform_path(filename, &platform_filename)) {
+        result = tmu_file_writer_open_internal(platform_filename.path, flags, buffer_capacity);
+        tmu_destroy_platform_path(&platform_filename);
+    }
+    return result;
+}
+
+TMU_DEF tm_errc tmu_file_writer_flush(tmu_file_writer* writer) {
+    TM_ASSERT(writer);
+    if (writer->ec != TM_OK) return writer->ec;
+    if (!writer->internal_handle) return TM_EINVAL;
+
+    if (writer->buffer_size > 0) {
+        writer->ec = tmu_file_writer_write_t(writer->internal_handle, writer->buffer, writer->buffer_size);
+        writer->buffer_size = 0;
+    }
+    return writer->ec;
+}
+
+TMU_DEF tm_errc tmu_file_writer_write(tmu_file_writer* writer, const void* data, tm_size_t size) {
+    TM_ASSERT(writer);
+    TM_ASSERT(data || size == 0);
+    TM_ASSERT_VALID_SIZE(size);
+    TM_ASSERT(writer->buffer_size <= writer->buffer_capacity);
+
+    if (writer->ec != TM_OK) return writer->ec;
+    if (!writer->internal_handle) return TM_EINVAL;
+
+    if (size <= writer->buffer_capacity - writer->buffer_size) {
+        TMU_MEMCPY(writer->buffer + writer->buffer_size, data, size * sizeof(char));
+        writer->buffer_size += size;
+        writer->written += size;
+        return TM_OK;
+    }
+
+    if (tmu_file_writer_flush(writer) != TM_OK) return writer->ec;
+    if (size < writer->buffer_capacity) {
+        TMU_MEMCPY(writer->buffer, data, size * sizeof(char));
+        writer->buffer_size = size;
+    } else {
+        /* Big writes go straight to the file instead of being copied into the buffer first. */
+        writer->ec = tmu_file_writer_write_t(writer->internal_handle, data, size);
+        if (writer->ec != TM_OK) return writer->ec;
+    }
+    writer->written += size;
+    return TM_OK;
+}
+
+TMU_DEF tmu_write_file_result tmu_file_writer_close(tmu_file_writer* writer) {
+    TM_ASSERT(writer);
+
+    tmu_write_file_result result = {0, TM_EINVAL};
+    if (!writer->internal_handle) {
+        if (writer->ec != TM_OK) result.ec = writer->ec;
+        tmu_file_writer_free_internal(writer);
+        return result;
+    }
+
+    result.ec = tmu_file_writer_flush(writer);
+    if (result.ec == TM_OK && (writer->flags & (tmu_atomic_write | tmu_sync_write))) {
+        result.ec = tmu_file_writer_sync_t(writer->internal_handle);
+    }
+    tm_errc close_ec = tmu_file_writer_close_t(writer->internal_handle);
+    if (result.ec == TM_OK) result.ec = close_ec;
+
+    if (writer->internal_paths) {
+        TM_ASSERT(writer->flags & tmu_atomic_write);
+        const tmu_tchar* filename = (const tmu_tchar*)writer->internal_paths;
+        const tmu_tchar* temp_filename = filename + TMU_TEXTLEN(filename) + 1;
+        if (result.ec == TM_OK) {
+            result.ec = tmu_rename_file_ex_t(temp_filename, filename, writer->flags & tmu_overwrite);
+            /* The rename itself is only durable once the directory entry is synced too. */
+            if (result.ec == TM_OK) {
+                result.ec = tmu_sync_parent_directory_t(filename);
+            } else {
+                tmu_delete_file_t(temp_filename);
+            }
+        } else {
+            tmu_delete_file_t(temp_filename);
+        }
+    }
+
+    if (result.ec == TM_OK) result.written = writer->written;
+    writer->ec = result.ec;
+    tmu_file_writer_free_internal(writer);
+    return result;
+}
+
+TMU_DEF void tmu_file_writer_discard(tmu_file_writer* writer) {
+    if (!writer) return;
+    if (writer->internal_handle) {
+        tmu_file_writer_close_t(writer->internal_handle);
+        if (writer->internal_paths) {
+            const tmu_tchar* filename = (const tmu_tchar*)writer->internal_paths;
+            tmu_delete_file_t(filename + TMU_TEXTLEN(filename) + 1);
+        }
+    }
+    tmu_file_writer_free_internal(writer);
+}
+
 TMU_DEF tmu_exists_result tmu_file_exists(const char* filename) {
     tmu_exists_result result = {TM_FALSE, TM_ENOMEM};
     tmu_platform_path platform_filename;
@@ -7837,7 +10221,7 @@ TMU_DEF void tmu_utf8_destroy_command_line(tmu_utf8_command_line* command_line)
 }
 
 TMU_DEF tmu_opened_dir tmu_open_directory(const char* dir) {
-    tmu_opened_dir result = {TM_ENOMEM, {TM_NULL, TM_FALSE}, {TM_NULL, 0, 0}, TM_NULL};
+    tmu_opened_dir result = {TM_ENOMEM, {TM_NULL, TM_FALSE}, {TM_NULL, 0, 0}, {TM_NULL, 0, 0}, TM_NULL};
     if (!dir) dir = "";
     tmu_platform_path platform_dir;
     if (tmu_to_platform_path(dir, &platform_dir)) {
@@ -7847,6 +10231,125 @@ TMU_DEF tmu_opened_dir tmu_open_directory(const char* dir) {
     return result;
 }
 
+/* Like tmu_grow_by, but also allocates the initial buffer, since not all TMU_REALLOC implementations accept null. */
+static tm_bool tmu_reserve_by_internal(tmu_contents* contents, tm_size_t amount, tm_size_t min_capacity) {
+    TM_ASSERT(contents);
+    if (!contents->data) {
+        tm_size_t capacity = (amount < min_capacity) ? min_capacity : amount;
+        contents->data = (char*)TMU_MALLOC((size_t)capacity * sizeof(char), sizeof(char));
+        if (!contents->data) return TM_FALSE;
+        contents->size = 0;
+        contents->capacity = capacity;
+        return TM_TRUE;
+    }
+    return tmu_grow_by(contents, amount);
+}
+
+TMU_DEF tm_size_t tmu_read_directory_batch(tmu_opened_dir* dir, tmu_directory_entry* entries,
+                                           tm_size_t entries_capacity, uint32_t flags) {
+    TM_ASSERT(entries || entries_capacity == 0);
+    if (!dir) return 0;
+
+    tmu_contents* names = &dir->internal_names;
+    names->size = 0;
+
+    tm_size_t count = 0;
+    while (count < entries_capacity) {
+        tmu_directory_entry* entry = &entries[count];
+        if (!tmu_read_directory_internal(dir, flags, entry)) break;
+
+        /* Entry names are only valid until the next read, so we copy them into a buffer that lives as long as dir. */
+        tm_size_t name_size = (tm_size_t)TMU_STRLEN(entry->name) + 1;
+        if (!tmu_reserve_by_internal(names, name_size, /*min_capacity=*/entries_capacity * 32)) {
+            dir->ec = TM_ENOMEM;
+            break;
+        }
+        TMU_MEMCPY(names->data + names->size, entry->name, (size_t)name_size * sizeof(char));
+        names->size += name_size;
+        ++count;
+    }
+
+    /* Names buffer might have been reallocated while reading, assign the name pointers only once we are done. */
+    const char* name = names->data;
+    for (tm_size_t i = 0; i < count; ++i) {
+        entries[i].name = name;
+        name += TMU_STRLEN(name) + 1;
+    }
+    return count;
+}
+
+static tm_errc tmu_walk_directory_internal(tmu_contents* path, uint32_t flags, tmu_walk_directory_callback callback,
+                                           void* user_data) {
+    TM_ASSERT(path);
+    TM_ASSERT(path->data);
+
+    tmu_opened_dir dir = tmu_open_directory(path->data);
+    if (dir.ec != TM_OK) {
+        tm_errc ec = dir.ec;
+        tmu_close_directory(&dir);
+        return ec;
+    }
+
+    tm_size_t path_size = path->size;
+    tm_errc ec = TM_OK;
+
+    enum { ENTRIES_CAPACITY = 64 };
+    tmu_directory_entry entries[ENTRIES_CAPACITY];
+    tm_size_t count = 0;
+    while (ec == TM_OK && (count = tmu_read_directory_batch(&dir, entries, ENTRIES_CAPACITY, flags)) != 0) {
+        for (tm_size_t i = 0; i < count; ++i) {
+            const tmu_directory_entry* entry = &entries[i];
+
+            /* Append entry name to path, directories get a trailing slash, if they don't have one already. */
+            tm_size_t name_len = (tm_size_t)TMU_STRLEN(entry->name);
+            path->size = path_size;
+            if (!tmu_grow_by(path, name_len + 2)) {
+                ec = TM_ENOMEM;
+                break;
+            }
+            TMU_MEMCPY(path->data + path->size, entry->name, (size_t)name_len * sizeof(char));
+            path->size += name_len;
+            if (!entry->is_file && (name_len == 0 || entry->name[name_len - 1] != '/')) path->data[path->size++] = '/';
+            path->data[path->size] = 0;
+
+            tmu_walk_action action = callback(user_data, path->data, entry);
+            if (action == tmu_walk_stop) {
+                ec = TM_ECANCELED;
+                break;
+            }
+            if (action == tmu_walk_continue && !entry->is_file) {
+                ec = tmu_walk_directory_internal(path, flags, callback, user_data);
+                if (ec != TM_OK) break;
+            }
+        }
+    }
+    if (ec == TM_OK) ec = dir.ec;
+    tmu_close_directory(&dir);
+
+    path->size = path_size;
+    path->data[path_size] = 0;
+    return ec;
+}
+
+TMU_DEF tm_errc tmu_walk_directory(const char* dir, uint32_t flags, tmu_walk_directory_callback callback,
+                                   void* user_data) {
+    TM_ASSERT(callback);
+    if (!dir) dir = "";
+
+    tm_size_t dir_len = (tm_size_t)TMU_STRLEN(dir);
+    tmu_contents path = {TM_NULL, 0, 0};
+    if (!tmu_reserve_by_internal(&path, dir_len + 2, /*min_capacity=*/260)) return TM_ENOMEM;
+
+    TMU_MEMCPY(path.data, dir, (size_t)dir_len * sizeof(char));
+    path.size = dir_len;
+    if (dir_len > 0 && dir[dir_len - 1] != '/' && dir[dir_len - 1] != '\\') path.data[path.size++] = '/';
+    path.data[path.size] = 0;
+
+    tm_errc ec = tmu_walk_directory_internal(&path, flags, callback, user_data);
+    tmu_destroy_contents(&path);
+    return ec;
+}
+
 #if defined(__cplusplus) && defined(TM_STRING_VIEW)
 
 TMU_DEF tmu_exists_result tmu_file_exists(TM_STRING_VIEW filename) {
@@ -7934,6 +10437,16 @@ TMU_DEF tmu_write_file_result tmu_write_file_as_utf8_ex(TM_STRING_VIEW filename,
     return result;
 }
 
+TMU_DEF tmu_file_writer tmu_file_writer_open(TM_STRING_VIEW filename, uint32_t flags, tm_size_t buffer_capacity) {
+    tmu_file_writer result = {TM_ENOMEM, 0, flags, TM_NULL, 0, 0, TM_NULL, TM_NULL};
+    tmu_platform_path platform_filename;
+    if (tmu_to_platform_path(filename, &platform_filename)) {
+        result = tmu_file_writer_open_internal(platform_filename.path, flags, buffer_capacity);
+        tmu_destroy_platform_path(&platform_filename);
+    }
+    return result;
+}
+
 TMU_DEF tm_errc tmu_rename_file(TM_STRING_VIEW from, TM_STRING_VIEW to) { return tmu_rename_file_ex(from, to, 0); }
 TMU_DEF tm_errc tmu_rename_file_ex(TM_STRING_VIEW from, TM_STRING_VIEW to, uint32_t flags) {
     tm_errc result = TM_ENOMEM;
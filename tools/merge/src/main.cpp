@@ -257,13 +257,17 @@ void erase_undef_statements(std::vector<char>& data, const std::vector<merge_def
                 continue;
             }
 
-            // Extend range to beginning of line.
-            while (pos != data.begin() && *pos != '\n') --pos;
-            if (pos != data.begin() && *pos == '\r') --pos;
-
             // Extend range to end of line.
             last = std::find(last, data.end(), '\n');
-            if (last != data.end()) ++last;
+            if (last != data.end()) {
+                // Erase the whole line including its line ending.
+                ++last;
+                while (pos != data.begin() && *(pos - 1) != '\n') --pos;
+            } else {
+                // Last line, erase the line ending of the previous line instead.
+                while (pos != data.begin() && *pos != '\n') --pos;
+                if (pos != data.begin() && *(pos - 1) == '\r') --pos;
+            }
             pos = data.erase(pos, last);
         }
     }
@@ -365,9 +369,27 @@ void process_definitions(std::vector<char>& data, const std::vector<merge_defini
     }
 }
 
+// Merged files take on the line endings of the file they are merged into.
+void convert_line_endings(std::vector<char>& data, bool crlf) {
+    std::vector<char> result;
+    result.reserve(data.size());
+    for (size_t i = 0, count = data.size(); i < count; ++i) {
+        if (data[i] == '\r' && i + 1 < count && data[i + 1] == '\n') continue;
+        if (data[i] == '\n' && crlf) result.push_back('\r');
+        result.push_back(data[i]);
+    }
+    data = std::move(result);
+}
+
+bool uses_crlf(const char* first, const char* last) {
+    auto newline = std::find(first, last, '\n');
+    return newline != last && newline != first && *(newline - 1) == '\r';
+}
+
 merge_error_t merge_include_statement(stream_t* stream, const char* dir, size_t dir_len,
                                       const std::vector<merge_definition>& definitions,
-                                      const std::vector<std::string>& already_included, merge_result& out) {
+                                      const std::vector<std::string>& already_included, bool crlf,
+                                      merge_result& out) {
     stream_guard guard(stream);
 
     auto token = next_token(stream);
@@ -400,6 +422,7 @@ merge_error_t merge_include_statement(stream_t* stream, const char* dir, size_t
 
     erase_undef_statements(file.data, definitions);
     process_definitions(file.data, definitions);
+    convert_line_endings(file.data, crlf);
 
     if (std::find(out.merged_files.begin(), out.merged_files.end(), name) == out.merged_files.end()) {
         out.merged_files.emplace_back(std::move(name));
@@ -417,6 +440,7 @@ merge_result merge(const std::vector<char>& in, const char* dir, const std::vect
 
     auto stream = stream_t{in.data(), in.data() + in.size()};
     const auto dir_len = strlen(dir);
+    const auto crlf = uses_crlf(stream.p, stream.end);
 
     merge_result result = {};
     if (dir_len > 260) {
@@ -454,7 +478,7 @@ merge_result merge(const std::vector<char>& in, const char* dir, const std::vect
                 return result;
             }
             case tok_hash: {
-                switch (merge_include_statement(&stream, dir, dir_len, definitions, already_included, result)) {
+                switch (merge_include_statement(&stream, dir, dir_len, definitions, already_included, crlf, result)) {
                     case merge_ok:
                         result.changed = true;
                         definitions.resize(1);
@@ -100,6 +100,9 @@ void print_cli_command_error(const tchar* command, const tchar* app) {
     TEXT("                                prune_stage_one\n")                                                   \
     TEXT("                                prune_stage_two\n")                                                   \
     TEXT("                                handle_invalid_codepoints\n")                                         \
+    TEXT("                                per_property_tables\n")                                               \
+    TEXT("                                word_break\n")                                                        \
+    TEXT("                                sentence_break\n")                                                    \
     TEXT("                                default\n")
 
 #define GENERIC_OPTIONS_TEXT                                                                                         \
@@ -109,6 +112,9 @@ void print_cli_command_error(const tchar* command, const tchar* app) {
     TEXT("  -o --output               Path to generated output source file. If not specified, outputs to stdout.\n") \
     TEXT("  --header                  Path to generated output header file. If not specified, outputs to stdout.\n") \
     TEXT("  --no-header-guard         Do not generate header guard.\n")                                              \
+    TEXT("  --stage-two-bits          Log2 of the stage two block size of per-property tables (default 5).\n")       \
+    TEXT("  --stage-three-bits        Log2 of the stage three block size of per-property tables (default 5).\n")     \
+    TEXT("  --report-sizes            Print the sizes of the generated tables to stderr.\n")                         \
     TEXT("  -h --help                 Show this screen.\n")
 
 // clang-format off
@@ -120,7 +126,10 @@ void print_cli_command_error(const tchar* command, const tchar* app) {
     {TEXT("f"), TEXT("flags"), CLI_REQUIRED_ARGUMENT, CLI_OPTIONAL_OPTION}, \
     {TEXT("p"), TEXT("prefix"), CLI_REQUIRED_ARGUMENT},                     \
     {nullptr, TEXT("assert"), CLI_REQUIRED_ARGUMENT},                       \
-    {nullptr, TEXT("no-assert"), CLI_NO_ARGUMENT},
+    {nullptr, TEXT("no-assert"), CLI_NO_ARGUMENT},                          \
+    {nullptr, TEXT("stage-two-bits"), CLI_REQUIRED_ARGUMENT},               \
+    {nullptr, TEXT("stage-three-bits"), CLI_REQUIRED_ARGUMENT},             \
+    {nullptr, TEXT("report-sizes"), CLI_NO_ARGUMENT},
 // clang-format on
 
 void print_usage(const tchar* app) {
@@ -155,7 +164,8 @@ void print_files_usage() {
         TEXT("  ") TSTRF TEXT(" files -u<path_to/UnicodeData.txt> -c<path_to/CaseFolding.txt>\n")
         TEXT("           -s<path_to/SpecialCasing.txt> -g<path_to/GraphemeBreakProperty.txt>\n")
         TEXT("           -a<path_to/EastAsianWidth.txt> -e<path_to/emoji-data.txt>\n")
-        TEXT("           [-t<path_to/GraphemeBreakTest.txt>] [-f<flags>] [-o<out_file>]\n")
+        TEXT("           [-t<path_to/GraphemeBreakTest.txt>] [--word_break=<path_to/WordBreakProperty.txt>]\n")
+        TEXT("           [--sentence_break=<path_to/SentenceBreakProperty.txt>] [-f<flags>] [-o<out_file>]\n")
         TEXT("  ") TSTRF TEXT(" files -h | --help\n")
         TEXT("\n")
         TEXT("Options:\n")
@@ -166,6 +176,8 @@ void print_files_usage() {
         TEXT("  -a --east_asian_width     Path to EastAsianWidth.txt.\n")
         TEXT("  -e --emoji_data           Path to emoji_data.txt.\n")
         TEXT("  -t --grapheme_break_test  Path to GraphemeBreakTest.txt. Optional.\n")
+        TEXT("  --word_break              Path to WordBreakProperty.txt. Required by the word_break flag.\n")
+        TEXT("  --sentence_break          Path to SentenceBreakProperty.txt. Required by the sentence_break flag.\n")
         FLAGS_TEXT
         GENERIC_OPTIONS_TEXT
         TEXT("\n")
@@ -185,6 +197,8 @@ void print_dir_usage() {
         TEXT("  root_dir                  Directory in which to look for UnicodeData.txt, CaseFolding.txt,\n")
         TEXT("                            SpecialCasing.txt, EastAsianWidth.txt and GraphemeBreakProperty.txt.\n")
         TEXT("                            If GraphemeBreakTest.txt also exists, it will be automatically used.\n")
+        TEXT("                            WordBreakProperty.txt and SentenceBreakProperty.txt are read when the\n")
+        TEXT("                            word_break and sentence_break flags are specified.\n")
         TEXT("Options:\n")
         FLAGS_TEXT
         GENERIC_OPTIONS_TEXT
@@ -216,12 +230,15 @@ struct parsed_options {
     TSTRING emoji_data_filename;
     TSTRING east_asian_width_filename;
     TSTRING grapheme_break_test_filename;
+    TSTRING word_break_filename;
+    TSTRING sentence_break_filename;
     const tchar* out_filename = nullptr;
     const tchar* header_filename = nullptr;
 
     uint32_t flags = generate_flags_default;
 
     option_strings strings;
+    property_table_settings property_settings;
 };
 
 TSTRING concat_path(const tchar* path, const tchar* filename) {
@@ -289,6 +306,9 @@ bool to_generate_flags(const tchar* str, uint32_t* out) {
         {TEXT("prune_stage_one"), generate_flags_prune_stage_one},
         {TEXT("prune_stage_two"), generate_flags_prune_stage_two},
         {TEXT("handle_invalid_codepoints"), generate_flags_handle_invalid_codepoints},
+        {TEXT("per_property_tables"), generate_flags_per_property_tables},
+        {TEXT("word_break"), generate_flags_word_break},
+        {TEXT("sentence_break"), generate_flags_sentence_break},
         {TEXT("default"), generate_flags_default},
     };
 
@@ -378,6 +398,29 @@ void handle_generic_options(const tchar* command, const tmcli_parsed_option& opt
             out->flags |= generate_flags_no_assert;
             break;
         }
+        case 8:
+        case 9: {
+            const tchar* first = option.argument;
+            int32_t bits = 0;
+            while (*first >= TEXT('0') && *first <= TEXT('9') && bits < 100) bits = bits * 10 + (*first++ - TEXT('0'));
+            // Stage three blocks need to be at least a byte big, even with 1 bit values.
+            int32_t min_bits = (option.option_index == 8) ? 0 : 3;
+            if (*first || first == option.argument || bits < min_bits || bits > 12) {
+                FPRINTF(stderr, TEXT("Block size bits must be between %d and 12.\n"), min_bits);
+                print_cli_command_error(command, app_name);
+                exit(-1);
+            }
+            if (option.option_index == 8) {
+                out->property_settings.stage_two_bits = bits;
+            } else {
+                out->property_settings.stage_three_bits = bits;
+            }
+            break;
+        }
+        case 10: {
+            out->property_settings.report_sizes = true;
+            break;
+        }
     }
 }
 
@@ -406,6 +449,8 @@ parsed_options parse_dir(int argc, tchar const* argv[]) {
             result.emoji_data_filename = concat_path(root_dir, TEXT("emoji-data.txt"));
             result.east_asian_width_filename = concat_path(root_dir, TEXT("EastAsianWidth.txt"));
             result.grapheme_break_test_filename = concat_path(root_dir, TEXT("GraphemeBreakTest.txt"));
+            result.word_break_filename = concat_path(root_dir, TEXT("WordBreakProperty.txt"));
+            result.sentence_break_filename = concat_path(root_dir, TEXT("SentenceBreakProperty.txt"));
             dir_specified = true;
             continue;
         }
@@ -434,6 +479,8 @@ parsed_options parse_files(int argc, tchar const* argv[]) {
         {TEXT("e"), TEXT("emoji_data"), CLI_REQUIRED_ARGUMENT, CLI_REQUIRED_OPTION},
 
         {nullptr, TEXT("grapheme_break_test"), CLI_REQUIRED_ARGUMENT},
+        {nullptr, TEXT("word_break"), CLI_REQUIRED_ARGUMENT},
+        {nullptr, TEXT("sentence_break"), CLI_REQUIRED_ARGUMENT},
         GENERIC_OPTIONS};
 
     parsed_options result = {};
@@ -474,11 +521,15 @@ parsed_options parse_files(int argc, tchar const* argv[]) {
                 break;
             }
             case 7: {
-                result.out_filename = parsed_option.argument;
+                result.word_break_filename = parsed_option.argument;
+                break;
+            }
+            case 8: {
+                result.sentence_break_filename = parsed_option.argument;
                 break;
             }
             default: {
-                parsed_option.option_index -= 7;
+                parsed_option.option_index -= 9;
                 handle_generic_options(TEXT("files"), parsed_option, print_files_usage, &result);
                 break;
             }
@@ -174,138 +174,10 @@ void generate_binary_search_based(const vector<data_entry>& raw, const unique_uc
 }
 #endif
 
-void generate_source_file(const parsed_data& parsed, const unique_ucd& ucd, const option_strings& strings, FILE* f) {
-    assert(f);
-    MAYBE_UNUSED(parsed);
-
+static void generate_ucd_entries(const unique_ucd& ucd, size_t full_lower_offset, const char* prefix, FILE* f) {
     auto flags = ucd.flags;
-    auto uppercase_prefix = strings.uppercase_prefix;
-    auto prefix = strings.prefix;
-    auto assert_name = strings.assert_name;
-
-    auto count_codepoints = [](const vector<codepoint_run>& runs) {
-        size_t count = 0;
-        if (runs.size() > 1) {
-            /* We only output data if there is more than just the default entry. */
-            for (auto& run : runs) {
-                count += (size_t)run.count + 1;  // + 1 Null terminator.
-            }
-        }
-        return count;
-    };
-
-    auto default_block_pos = (flags & generate_flags_prune_stage_two) ? (int32_t)ucd.pruned_stage_two_start : 0;
-    size_t pruned_stage_one_size = ucd.pruned_stage_one_size;
-
-    size_t full_upper_offset = 0;
-    size_t full_lower_offset = full_upper_offset + count_codepoints(ucd.full_upper);
-    size_t full_title_offset = full_lower_offset + count_codepoints(ucd.full_lower);
-    size_t full_case_fold_offset = full_title_offset + count_codepoints(ucd.full_title);
-    size_t canonical_offset = full_case_fold_offset + count_codepoints(ucd.full_case_fold);
-    size_t compatibility_offset = canonical_offset + count_codepoints(ucd.canonical);
-    size_t codepoints_count = compatibility_offset + count_codepoints(ucd.compatibility);
-
-    size_t stage_one_size = ucd.stage_one.size();
-    if (flags & generate_flags_prune_stage_one) stage_one_size = pruned_stage_one_size;
-    size_t stage_two_size = ucd.stage_two.size() * block_size;
-    if (flags & generate_flags_prune_stage_two) {
-        stage_two_size = ucd.pruned_stage_two_start * block_size;
-    }
-    size_t grapheme_break_transitions_size = 0;
-    if (flags & generate_flags_grapheme_break) {
-        grapheme_break_transitions_size = sizeof(grapheme_break_transitions) / sizeof(grapheme_break_transitions[0][0]);
-    }
-
     auto ucd_entry_size = ucd.min_sizes.ucd_entry_size(flags);
-
-    size_t overall_size = codepoints_count * (ucd.min_sizes.all_arrays.size / 8) + ucd.entries.size() * ucd_entry_size +
-                          grapheme_break_transitions_size + stage_one_size * (ucd.min_sizes.stage_one_table.size / 8) +
-                          stage_two_size * (ucd.min_sizes.stage_two.size / 8);
-    fprintf(f,
-            "/* This file was generated using tools/unicode_gen from\n"
-            "   https://github.com/to-miz/tm. Do not modify by hand.\n"
-            "   Around %zu bytes (%.2f kilobytes) of data for lookup tables\n"
-            "   are generated. ",
-            overall_size, overall_size / 1024.0);
-
-    if (parsed.version.first < parsed.version.last) {
-        fprintf(f, "It was generated using version %.*s of Unicode.", (int)(parsed.version.last - parsed.version.first),
-                parsed.version.first);
-    }
-
-    fprintf(f,
-            "*/\n\n"
-            "#ifdef __cplusplus\n"
-            "extern \"C\" {\n"
-            "#endif\n\n");
-
-    // Generate full uppercase, titlecase, lowercase, canonical and compatibility mapping array.
-    auto print_runs = [](FILE* f, const char* name, const vector<codepoint_run>& runs, bool first) {
-        if (runs.size() <= 1) return;
-
-        fprintf(f, "%s    /* %s */", (first) ? "" : ",\n\n", name);
-        for (size_t run_index = 0, runs_count = runs.size(); run_index < runs_count; run_index++) {
-            auto& run = runs[run_index];
-            int32_t count = run.count;
-            if (count > 0) {
-                fprintf(f, "\n    ");
-                for (int32_t i = 0; i < count; i++) {
-                    fprintf(f, "%d, ", run.codepoints[i]);
-                }
-                fprintf(f, "0%s", (run_index + 1 == runs_count) ? "" : ",");
-            } else {
-                fprintf(f, "\n    0%s", (run_index + 1 == runs_count) ? "" : ",");
-            }
-        }
-    };
-
-    auto stage_one_function_type = get_type_from_size(ucd.min_sizes.stage_one_function);
-    auto stage_two_type = get_type_from_size(ucd.min_sizes.stage_two);
-
-    if (ucd.min_sizes.all_arrays.size > 0) {
-        fprintf(f, "/* Codepoint runs: %zu bytes. */\n", codepoints_count * (ucd.min_sizes.all_arrays.size / 8));
-
-        if ((flags & generate_flags_full_case) || (flags & generate_flags_full_case_toggle)) {
-            fprintf(f, "static const size_t %sfull_upper_offset = %zu;\n", prefix, full_upper_offset);
-            fprintf(f, "static const size_t %sfull_lower_offset = %zu;\n", prefix, full_lower_offset);
-            fprintf(f, "static const size_t %sfull_title_offset = %zu;\n", prefix, full_title_offset);
-        }
-        if (flags & generate_flags_full_case_fold) {
-            fprintf(f, "static const size_t %sfull_case_fold_offset = %zu;\n", prefix, full_case_fold_offset);
-        }
-        if (flags & generate_flags_canonical) {
-            fprintf(f, "static const size_t %scanonical_offset = %zu;\n", prefix, canonical_offset);
-        }
-        if (flags & generate_flags_compatibility) {
-            fprintf(f, "static const size_t %scompatibility_offset = %zu;\n", prefix, compatibility_offset);
-        }
-
-        auto all_arrays_type = get_type_from_size(ucd.min_sizes.all_arrays);
-        fprintf(f,
-                "static const size_t %scodepoint_runs_size = %zu;\n"
-                "static const %s %scodepoint_runs[%zu] = {\n",
-                prefix, codepoints_count, all_arrays_type.data, prefix, codepoints_count);
-        bool first = true;
-        if ((flags & generate_flags_full_case) || (flags & generate_flags_full_case_toggle)) {
-            print_runs(f, "Full uppercase entries.", ucd.full_upper, first);
-            first = false;
-            print_runs(f, "Full lowercase entries.", ucd.full_lower, false);
-            print_runs(f, "Full titlecase entries.", ucd.full_title, false);
-        }
-        if (flags & generate_flags_full_case_fold) {
-            print_runs(f, "Full case fold entries.", ucd.full_case_fold, first);
-            first = false;
-        }
-        if (flags & generate_flags_canonical) {
-            print_runs(f, "Canonical mapping entries.", ucd.canonical, first);
-            first = false;
-        }
-        if (flags & generate_flags_compatibility) {
-            print_runs(f, "Compatibility mapping entries.", ucd.compatibility, first);
-            first = false;
-        }
-        fprintf(f, "\n};\n\n");
-    }
+    size_t pruned_stage_one_size = ucd.pruned_stage_one_size;
 
     // Generate ucd entry struct.
     fprintf(f, "typedef struct {\n");
@@ -384,8 +256,9 @@ void generate_source_file(const parsed_data& parsed, const unique_ucd& ucd, cons
             fprintf(f, "%s%d", (first) ? empty : comma, entry.data.flags);
             first = false;
         }
-        if (flags & generate_flags_grapheme_break) {
-            fprintf(f, "%s%d", (first) ? empty : comma, (int32_t)entry.data.grapheme_break);
+        if ((flags & generate_flags_grapheme_break) || (flags & generate_flags_width)) {
+            fprintf(f, "%s%d", (first) ? empty : comma,
+                    (int32_t)to_grapheme_break_and_width_bits(flags, entry.data.grapheme_break, entry.data.width));
             first = false;
         }
         if (flags & generate_flags_full_case) {
@@ -447,36 +320,16 @@ void generate_source_file(const parsed_data& parsed, const unique_ucd& ucd, cons
         generate_binary_search_based(raw, ucd, f);
     } else*/
     { generate_multistage_table_based(ucd, pruned_stage_one_size, prefix, f); }
+}
 
-    // Generate grapheme break transition table.
-    if (flags & generate_flags_grapheme_break) {
-        assert(grapheme_break_transitions_size > 0);
-        fprintf(f,
-                "/*\nGrapheme cluster break transition table.\n"
-                "The grapheme cluster break rules are embedded in a 16x16 state machine\n"
-                "transition table, denoting whether we can break when going from one grapheme\n"
-                "break type to another. The values are made up of a MUST_BREAK bit (highest bit)\n"
-                "and the state to which the state machine transitions to in case no break is\n"
-                "allowed. The state machine will consume codepoints, until a grapheme cluster\n"
-                "break is found.\n"
-                "See https://unicode.org/reports/tr29/#Grapheme_Cluster_Boundary_Rules\n"
-                "for more information.\n*/\n");
-        fprintf(f,
-                "/* Unicode grapheme cluster break transition table: %zu bytes. */\n"
-                "static const size_t %sgrapheme_break_transitions_size = %zu;\n"
-                "static const uint8_t %sgrapheme_break_transitions[%zu] = {\n",
-                sizeof(grapheme_break_transitions), prefix, grapheme_break_transitions_size, prefix,
-                grapheme_break_transitions_size);
-        for (int32_t from = 0; from < grapheme_entries; from++) {
-            fprintf(f, "    ");
-            for (int32_t to = 0; to < grapheme_entries - 1; to++) {
-                fprintf(f, "%3u,", grapheme_break_transitions[from][to]);
-            }
-            fprintf(f, "%3u%s\n", grapheme_break_transitions[from][grapheme_entries - 1],
-                    (from + 1 == grapheme_entries) ? "" : ", ");
-        }
-        fprintf(f, "};\n\n");
-    }
+static void generate_ucd_internal_accessor(const unique_ucd& ucd, const option_strings& strings, FILE* f) {
+    auto flags = ucd.flags;
+    auto prefix = strings.prefix;
+    auto assert_name = strings.assert_name;
+    auto default_block_pos = (flags & generate_flags_prune_stage_two) ? (int32_t)ucd.pruned_stage_two_start : 0;
+    size_t pruned_stage_one_size = ucd.pruned_stage_one_size;
+    auto stage_one_function_type = get_type_from_size(ucd.min_sizes.stage_one_function);
+    auto stage_two_type = get_type_from_size(ucd.min_sizes.stage_two);
 
     // Generate stage one accessor function.
     fprintf(f, "static %s %sget_stage_one_value_internal(uint32_t index) {\n", stage_one_function_type.data, prefix);
@@ -701,28 +554,273 @@ void generate_source_file(const parsed_data& parsed, const unique_ucd& ucd, cons
 
     if (assert_name) fprintf(f, "    %s(entry_index < %sucd_entries_size);\n", assert_name, prefix);
     fprintf(f, "    return &%sucd_entries[entry_index];\n}\n\n", prefix);
+}
 
-    // Generate unpacked ucd entry getter.
+static void generate_property_table(const property_table& table, uint32_t flags, const option_strings& strings,
+                                    FILE* f) {
+    auto prefix = strings.prefix;
+    auto assert_name = strings.assert_name;
+
+    auto print_values = [f](const char* type, const char* prefix, const char* name, const char* stage, auto& values) {
+        fprintf(f, "static const %s %s%s_%s[%zu] = {", type, prefix, name, stage, values.size());
+        for (size_t i = 0, count = values.size(); i < count; i++) {
+            if (i % 16 == 0) fprintf(f, "\n    ");
+            fprintf(f, "%d%s", (int32_t)values[i], (i + 1 == count) ? "" : ", ");
+        }
+        fprintf(f, "\n};\n");
+    };
+
+    fprintf(f, "/* Per-property table for %s: %zu bytes. */\n", table.name, table.size_in_bytes());
+    print_values(get_type_from_size(table.stage_one_type).data, prefix, table.name, "stage_one", table.stage_one);
+    print_values(get_type_from_size(table.stage_two_type).data, prefix, table.name, "stage_two", table.stage_two);
+    print_values("uint8_t", prefix, table.name, "stage_three", table.stage_three);
+    fprintf(f, "\n");
+
+    // Generate accessor, same lookup as property_table::lookup.
+    int32_t values_per_byte_bits = 0;
+    while ((table.value_bits << values_per_byte_bits) < 8) values_per_byte_bits++;
+
+    fprintf(f, "static uint32_t %sget_%s_property_internal(uint32_t cp) {\n", prefix, table.name);
+    if (flags & generate_flags_handle_invalid_codepoints) {
+        fprintf(f, "    if (cp > 0x10FFFF) return %d;\n", table.default_value);
+    } else if (assert_name) {
+        fprintf(f, "    %s(cp <= 0x10FFFF);\n", assert_name);
+    }
     fprintf(f,
-            "%sUCD_DEF %sucd_entry %sucd_get_entry(uint32_t codepoint) {\n"
-            "    const %sucd_internal* internal = %sget_ucd_internal(codepoint);\n"
-            "    %sucd_entry result;\n",
-            uppercase_prefix, prefix, prefix, prefix, prefix, prefix);
-    if (flags & generate_flags_category) {
+            "    uint32_t block_index = ((uint32_t)%s%s_stage_one[cp >> %d] << %d) + ((cp >> %d) & %d);\n"
+            "    uint32_t offset = cp & %d;\n",
+            prefix, table.name, table.stage_two_bits + table.stage_three_bits, table.stage_two_bits,
+            table.stage_three_bits, (1 << table.stage_two_bits) - 1, (1 << table.stage_three_bits) - 1);
+    if (values_per_byte_bits == 0) {
+        fprintf(f, "    return %s%s_stage_three[(uint32_t)%s%s_stage_two[block_index] * %d + offset];\n", prefix,
+                table.name, prefix, table.name, table.stage_three_block_bytes());
+    } else {
+        fprintf(f,
+                "    uint32_t value = %s%s_stage_three[(uint32_t)%s%s_stage_two[block_index] * %d + (offset >> %d)];\n"
+                "    return (value >> ((offset & %d) * %d)) & %d;\n",
+                prefix, table.name, prefix, table.name, table.stage_three_block_bytes(), values_per_byte_bits,
+                (1 << values_per_byte_bits) - 1, table.value_bits, (1 << table.value_bits) - 1);
+    }
+    fprintf(f, "}\n\n");
+}
+
+static bool has_property_table(const vector<property_table>& property_tables, const char* name) {
+    for (auto& table : property_tables) {
+        if (strcmp(table.name, name) == 0) return true;
+    }
+    return false;
+}
+
+void generate_source_file(const parsed_data& parsed, const unique_ucd& ucd,
+                          const vector<property_table>& property_tables, const option_strings& strings, FILE* f) {
+    assert(f);
+    MAYBE_UNUSED(parsed);
+
+    auto flags = ucd.flags;
+    auto uppercase_prefix = strings.uppercase_prefix;
+    auto prefix = strings.prefix;
+
+    // The main tables are only needed if there are properties that aren't stored in per-property tables.
+    const uint32_t main_table_flags = generate_flags_canonical | generate_flags_compatibility |
+                                      generate_flags_full_case | generate_flags_full_case_fold |
+                                      generate_flags_full_case_toggle | generate_flags_simple_case |
+                                      generate_flags_simple_case_fold | generate_flags_simple_case_toggle;
+    bool main_tables = !(flags & generate_flags_per_property_tables) || (flags & main_table_flags);
+    bool category_table = has_property_table(property_tables, "category");
+    bool case_info_table = has_property_table(property_tables, "case_info");
+    bool grapheme_break_table = has_property_table(property_tables, "grapheme_break");
+    bool width_table = has_property_table(property_tables, "width");
+
+    auto count_codepoints = [](const vector<codepoint_run>& runs) {
+        size_t count = 0;
+        if (runs.size() > 1) {
+            /* We only output data if there is more than just the default entry. */
+            for (auto& run : runs) {
+                count += (size_t)run.count + 1;  // + 1 Null terminator.
+            }
+        }
+        return count;
+    };
+
+    size_t pruned_stage_one_size = ucd.pruned_stage_one_size;
+
+    size_t full_upper_offset = 0;
+    size_t full_lower_offset = full_upper_offset + count_codepoints(ucd.full_upper);
+    size_t full_title_offset = full_lower_offset + count_codepoints(ucd.full_lower);
+    size_t full_case_fold_offset = full_title_offset + count_codepoints(ucd.full_title);
+    size_t canonical_offset = full_case_fold_offset + count_codepoints(ucd.full_case_fold);
+    size_t compatibility_offset = canonical_offset + count_codepoints(ucd.canonical);
+    size_t codepoints_count = compatibility_offset + count_codepoints(ucd.compatibility);
+
+    size_t stage_one_size = ucd.stage_one.size();
+    if (flags & generate_flags_prune_stage_one) stage_one_size = pruned_stage_one_size;
+    size_t stage_two_size = ucd.stage_two.size() * block_size;
+    if (flags & generate_flags_prune_stage_two) {
+        stage_two_size = ucd.pruned_stage_two_start * block_size;
+    }
+    size_t grapheme_break_transitions_size = 0;
+    if (flags & generate_flags_grapheme_break) {
+        grapheme_break_transitions_size = sizeof(grapheme_break_transitions) / sizeof(grapheme_break_transitions[0][0]);
+    }
+
+    auto ucd_entry_size = ucd.min_sizes.ucd_entry_size(flags);
+
+    size_t overall_size = codepoints_count * (ucd.min_sizes.all_arrays.size / 8) + grapheme_break_transitions_size;
+    if (main_tables) {
+        overall_size += ucd.entries.size() * ucd_entry_size + stage_one_size * (ucd.min_sizes.stage_one_table.size / 8) +
+                        stage_two_size * (ucd.min_sizes.stage_two.size / 8);
+    }
+    for (auto& table : property_tables) overall_size += table.size_in_bytes();
+    fprintf(f,
+            "/* This file was generated using tools/unicode_gen from\n"
+            "   https://github.com/to-miz/tm. Do not modify by hand.\n"
+            "   Around %zu bytes (%.2f kilobytes) of data for lookup tables\n"
+            "   are generated. ",
+            overall_size, overall_size / 1024.0);
+
+    if (parsed.version.first < parsed.version.last) {
+        fprintf(f, "It was generated using version %.*s of Unicode.", (int)(parsed.version.last - parsed.version.first),
+                parsed.version.first);
+    }
+
+    fprintf(f,
+            "*/\n\n"
+            "#ifdef __cplusplus\n"
+            "extern \"C\" {\n"
+            "#endif\n\n");
+
+    // Generate full uppercase, titlecase, lowercase, canonical and compatibility mapping array.
+    auto print_runs = [](FILE* f, const char* name, const vector<codepoint_run>& runs, bool first) {
+        if (runs.size() <= 1) return;
+
+        fprintf(f, "%s    /* %s */", (first) ? "" : ",\n\n", name);
+        for (size_t run_index = 0, runs_count = runs.size(); run_index < runs_count; run_index++) {
+            auto& run = runs[run_index];
+            int32_t count = run.count;
+            if (count > 0) {
+                fprintf(f, "\n    ");
+                for (int32_t i = 0; i < count; i++) {
+                    fprintf(f, "%d, ", run.codepoints[i]);
+                }
+                fprintf(f, "0%s", (run_index + 1 == runs_count) ? "" : ",");
+            } else {
+                fprintf(f, "\n    0%s", (run_index + 1 == runs_count) ? "" : ",");
+            }
+        }
+    };
+
+    if (ucd.min_sizes.all_arrays.size > 0) {
+        fprintf(f, "/* Codepoint runs: %zu bytes. */\n", codepoints_count * (ucd.min_sizes.all_arrays.size / 8));
+
+        if ((flags & generate_flags_full_case) || (flags & generate_flags_full_case_toggle)) {
+            fprintf(f, "static const size_t %sfull_upper_offset = %zu;\n", prefix, full_upper_offset);
+            fprintf(f, "static const size_t %sfull_lower_offset = %zu;\n", prefix, full_lower_offset);
+            fprintf(f, "static const size_t %sfull_title_offset = %zu;\n", prefix, full_title_offset);
+        }
+        if (flags & generate_flags_full_case_fold) {
+            fprintf(f, "static const size_t %sfull_case_fold_offset = %zu;\n", prefix, full_case_fold_offset);
+        }
+        if (flags & generate_flags_canonical) {
+            fprintf(f, "static const size_t %scanonical_offset = %zu;\n", prefix, canonical_offset);
+        }
+        if (flags & generate_flags_compatibility) {
+            fprintf(f, "static const size_t %scompatibility_offset = %zu;\n", prefix, compatibility_offset);
+        }
+
+        auto all_arrays_type = get_type_from_size(ucd.min_sizes.all_arrays);
+        fprintf(f,
+                "static const size_t %scodepoint_runs_size = %zu;\n"
+                "static const %s %scodepoint_runs[%zu] = {\n",
+                prefix, codepoints_count, all_arrays_type.data, prefix, codepoints_count);
+        bool first = true;
+        if ((flags & generate_flags_full_case) || (flags & generate_flags_full_case_toggle)) {
+            print_runs(f, "Full uppercase entries.", ucd.full_upper, first);
+            first = false;
+            print_runs(f, "Full lowercase entries.", ucd.full_lower, false);
+            print_runs(f, "Full titlecase entries.", ucd.full_title, false);
+        }
+        if (flags & generate_flags_full_case_fold) {
+            print_runs(f, "Full case fold entries.", ucd.full_case_fold, first);
+            first = false;
+        }
+        if (flags & generate_flags_canonical) {
+            print_runs(f, "Canonical mapping entries.", ucd.canonical, first);
+            first = false;
+        }
+        if (flags & generate_flags_compatibility) {
+            print_runs(f, "Compatibility mapping entries.", ucd.compatibility, first);
+            first = false;
+        }
+        fprintf(f, "\n};\n\n");
+    }
+
+    if (main_tables) generate_ucd_entries(ucd, full_lower_offset, prefix, f);
+
+    // Generate grapheme break transition table.
+    if (flags & generate_flags_grapheme_break) {
+        assert(grapheme_break_transitions_size > 0);
+        fprintf(f,
+                "/*\nGrapheme cluster break transition table.\n"
+                "The grapheme cluster break rules are embedded in a 16x16 state machine\n"
+                "transition table, denoting whether we can break when going from one grapheme\n"
+                "break type to another. The values are made up of a MUST_BREAK bit (highest bit)\n"
+                "and the state to which the state machine transitions to in case no break is\n"
+                "allowed. The state machine will consume codepoints, until a grapheme cluster\n"
+                "break is found.\n"
+                "See https://unicode.org/reports/tr29/#Grapheme_Cluster_Boundary_Rules\n"
+                "for more information.\n*/\n");
+        fprintf(f,
+                "/* Unicode grapheme cluster break transition table: %zu bytes. */\n"
+                "static const size_t %sgrapheme_break_transitions_size = %zu;\n"
+                "static const uint8_t %sgrapheme_break_transitions[%zu] = {\n",
+                sizeof(grapheme_break_transitions), prefix, grapheme_break_transitions_size, prefix,
+                grapheme_break_transitions_size);
+        for (int32_t from = 0; from < grapheme_entries; from++) {
+            fprintf(f, "    ");
+            for (int32_t to = 0; to < grapheme_entries - 1; to++) {
+                fprintf(f, "%3u,", grapheme_break_transitions[from][to]);
+            }
+            fprintf(f, "%3u%s\n", grapheme_break_transitions[from][grapheme_entries - 1],
+                    (from + 1 == grapheme_entries) ? "" : ", ");
+        }
+        fprintf(f, "};\n\n");
+    }
+
+    if (main_tables) generate_ucd_internal_accessor(ucd, strings, f);
+    for (auto& table : property_tables) generate_property_table(table, flags, strings, f);
+
+    // Generate unpacked ucd entry getter.
+    fprintf(f, "%sUCD_DEF %sucd_entry %sucd_get_entry(uint32_t codepoint) {\n", uppercase_prefix, prefix, prefix);
+    if (main_tables) fprintf(f, "    const %sucd_internal* internal = %sget_ucd_internal(codepoint);\n", prefix, prefix);
+    fprintf(f, "    %sucd_entry result;\n", prefix);
+    if (category_table) {
+        fprintf(f, "    result.category = (%sucd_category_enum)%sget_category_property_internal(codepoint);\n", prefix,
+                prefix);
+    } else if (flags & generate_flags_category) {
         fprintf(f, "    result.category = (%sucd_category_enum)((internal->bits0 >> %d) & %d);\n", prefix,
                 ucd_category_shift, ucd_category_mask);
     }
-    if (flags & generate_flags_case_info) {
+    if (case_info_table) {
+        fprintf(f, "    result.case_info = (%sucd_case_info_enum)%sget_case_info_property_internal(codepoint);\n",
+                prefix, prefix);
+    } else if (flags & generate_flags_case_info) {
         fprintf(f, "    result.case_info = (%sucd_case_info_enum)((internal->bits0 >> %d) & %d);\n", prefix,
                 ucd_case_shift, ucd_case_mask);
     }
-    if (flags & generate_flags_grapheme_break) {
+    if (grapheme_break_table) {
+        fprintf(f,
+                "    result.grapheme_break =\n"
+                "        (%sucd_grapheme_break_enum)%sget_grapheme_break_property_internal(codepoint);\n",
+                prefix, prefix);
+    } else if (flags & generate_flags_grapheme_break) {
         fprintf(f,
                 "    result.grapheme_break =\n"
                 "        (%sucd_grapheme_break_enum)((internal->bits1 >> %d) & %d);\n",
                 prefix, grapheme_break_shift, grapheme_break_mask);
     }
-    if (flags & generate_flags_width) {
+    if (width_table) {
+        fprintf(f, "    result.width = (int8_t)%sget_width_property_internal(codepoint);\n", prefix);
+    } else if (flags & generate_flags_width) {
         fprintf(f, "    result.width = (int8_t)((internal->bits1 >> %d) & %d);\n", width_shift, width_mask);
     }
     if (flags & generate_flags_simple_case) {
@@ -780,7 +878,19 @@ void generate_source_file(const parsed_data& parsed, const unique_ucd& ucd, cons
     fprintf(f, "    return result;\n}\n\n");
 
     // Generate individual getters.
-    if (flags & generate_flags_category) {
+    if (category_table) {
+        fprintf(f,
+                "%sUCD_DEF %sucd_category_enum %sucd_get_category(uint32_t codepoint) {\n"
+                "    return (%sucd_category_enum)%sget_category_property_internal(codepoint);\n"
+                "}\n\n",
+                uppercase_prefix, prefix, prefix, prefix, prefix);
+
+        fprintf(f,
+                "%sUCD_DEF int %sucd_is_whitespace(uint32_t codepoint) {\n"
+                "    return %sget_whitespace_property_internal(codepoint) != 0;\n"
+                "}\n\n",
+                uppercase_prefix, prefix, prefix);
+    } else if (flags & generate_flags_category) {
         fprintf(f,
                 "%sUCD_DEF %sucd_category_enum %sucd_get_category(uint32_t codepoint) {\n"
                 "    const %sucd_internal* internal = %sget_ucd_internal(codepoint);\n"
@@ -795,7 +905,13 @@ void generate_source_file(const parsed_data& parsed, const unique_ucd& ucd, cons
                 "}\n\n",
                 uppercase_prefix, prefix, prefix, prefix, ucd_whitespace_flag);
     }
-    if (flags & generate_flags_case_info) {
+    if (case_info_table) {
+        fprintf(f,
+                "%sUCD_DEF %sucd_case_info_enum %sucd_get_case_info(uint32_t codepoint) {\n"
+                "    return (%sucd_case_info_enum)%sget_case_info_property_internal(codepoint);\n"
+                "}\n\n",
+                uppercase_prefix, prefix, prefix, prefix, prefix);
+    } else if (flags & generate_flags_case_info) {
         fprintf(f,
                 "%sUCD_DEF %sucd_case_info_enum %sucd_get_case_info(uint32_t codepoint) {\n"
                 "    const %sucd_internal* internal = %sget_ucd_internal(codepoint);\n"
@@ -803,7 +919,20 @@ void generate_source_file(const parsed_data& parsed, const unique_ucd& ucd, cons
                 "}\n\n",
                 uppercase_prefix, prefix, prefix, prefix, prefix, prefix, ucd_case_shift, ucd_case_mask);
     }
-    if (flags & generate_flags_width) {
+    if (grapheme_break_table) {
+        fprintf(f,
+                "%sUCD_DEF %sucd_grapheme_break_enum %sucd_get_grapheme_break(uint32_t codepoint) {\n"
+                "    return (%sucd_grapheme_break_enum)%sget_grapheme_break_property_internal(codepoint);\n"
+                "}\n\n",
+                uppercase_prefix, prefix, prefix, prefix, prefix);
+    }
+    if (width_table) {
+        fprintf(f,
+                "%sUCD_DEF int %sucd_get_width(uint32_t codepoint) {\n"
+                "    return (int)%sget_width_property_internal(codepoint);\n"
+                "}\n\n",
+                uppercase_prefix, prefix, prefix);
+    } else if (flags & generate_flags_width) {
         fprintf(f,
                 "%sUCD_DEF int %sucd_get_width(uint32_t codepoint) {\n"
                 "    const %sucd_internal* internal = %sget_ucd_internal(codepoint);\n"
@@ -811,6 +940,20 @@ void generate_source_file(const parsed_data& parsed, const unique_ucd& ucd, cons
                 "}\n\n",
                 uppercase_prefix, prefix, prefix, prefix, width_shift, width_mask);
     }
+    if (flags & generate_flags_word_break) {
+        fprintf(f,
+                "%sUCD_DEF %sucd_word_break_enum %sucd_get_word_break(uint32_t codepoint) {\n"
+                "    return (%sucd_word_break_enum)%sget_word_break_property_internal(codepoint);\n"
+                "}\n\n",
+                uppercase_prefix, prefix, prefix, prefix, prefix);
+    }
+    if (flags & generate_flags_sentence_break) {
+        fprintf(f,
+                "%sUCD_DEF %sucd_sentence_break_enum %sucd_get_sentence_break(uint32_t codepoint) {\n"
+                "    return (%sucd_sentence_break_enum)%sget_sentence_break_property_internal(codepoint);\n"
+                "}\n\n",
+                uppercase_prefix, prefix, prefix, prefix, prefix);
+    }
 
     fprintf(f,
             "#ifdef __cplusplus\n"
@@ -850,6 +993,24 @@ void generate_header_file(const ucd_min_sizes& min_sizes, uint32_t flags, const
         fprintf(f, "\n    %sgrapheme_break_count\n} %sucd_grapheme_break_enum;\n\n", prefix, prefix);
     }
 
+    if (flags & generate_flags_word_break) {
+        // Print word break enum.
+        fprintf(f, "typedef enum {\n");
+        for (auto i = 0; i < word_break_count; i++) {
+            fprintf(f, "    %s%s,\n", prefix, to_string((word_break_enum)i));
+        }
+        fprintf(f, "\n    %sword_break_count\n} %sucd_word_break_enum;\n\n", prefix, prefix);
+    }
+
+    if (flags & generate_flags_sentence_break) {
+        // Print sentence break enum.
+        fprintf(f, "typedef enum {\n");
+        for (auto i = 0; i < sentence_break_count; i++) {
+            fprintf(f, "    %s%s,\n", prefix, to_string((sentence_break_enum)i));
+        }
+        fprintf(f, "\n    %ssentence_break_count\n} %sucd_sentence_break_enum;\n\n", prefix, prefix);
+    }
+
     if (flags & generate_flags_case_info) {
         fprintf(f,
                 "typedef enum {\n"
@@ -927,6 +1088,18 @@ void generate_header_file(const ucd_min_sizes& min_sizes, uint32_t flags, const
     if (flags & generate_flags_width) {
         fprintf(f, "%sUCD_DEF int %sucd_get_width(uint32_t codepoint);\n", uppercase_prefix, prefix);
     }
+    if ((flags & generate_flags_per_property_tables) && (flags & generate_flags_grapheme_break)) {
+        fprintf(f, "%sUCD_DEF %sucd_grapheme_break_enum %sucd_get_grapheme_break(uint32_t codepoint);\n",
+                uppercase_prefix, prefix, prefix);
+    }
+    if (flags & generate_flags_word_break) {
+        fprintf(f, "%sUCD_DEF %sucd_word_break_enum %sucd_get_word_break(uint32_t codepoint);\n", uppercase_prefix,
+                prefix, prefix);
+    }
+    if (flags & generate_flags_sentence_break) {
+        fprintf(f, "%sUCD_DEF %sucd_sentence_break_enum %sucd_get_sentence_break(uint32_t codepoint);\n",
+                uppercase_prefix, prefix, prefix);
+    }
 
     // Generate feature query defines.
     fprintf(f,
@@ -942,7 +1115,9 @@ void generate_header_file(const ucd_min_sizes& min_sizes, uint32_t flags, const
             "#define %sUCD_HAS_FULL_CASE_TOGGLE %d\n"
             "#define %sUCD_HAS_SIMPLE_CASE %d\n"
             "#define %sUCD_HAS_SIMPLE_CASE_FOLD %d\n"
-            "#define %sUCD_HAS_SIMPLE_CASE_TOGGLE %d\n",
+            "#define %sUCD_HAS_SIMPLE_CASE_TOGGLE %d\n"
+            "#define %sUCD_HAS_WORD_BREAK %d\n"
+            "#define %sUCD_HAS_SENTENCE_BREAK %d\n",
             uppercase_prefix, (flags & generate_flags_case_info) != 0, uppercase_prefix,
             (flags & generate_flags_category) != 0, uppercase_prefix, (flags & generate_flags_grapheme_break) != 0,
             uppercase_prefix, (flags & generate_flags_width) != 0, uppercase_prefix,
@@ -951,7 +1126,8 @@ void generate_header_file(const ucd_min_sizes& min_sizes, uint32_t flags, const
             (flags & generate_flags_full_case_fold) != 0, uppercase_prefix,
             (flags & generate_flags_full_case_toggle) != 0, uppercase_prefix, (flags & generate_flags_simple_case) != 0,
             uppercase_prefix, (flags & generate_flags_simple_case_fold) != 0, uppercase_prefix,
-            (flags & generate_flags_simple_case_toggle) != 0);
+            (flags & generate_flags_simple_case_toggle) != 0, uppercase_prefix,
+            (flags & generate_flags_word_break) != 0, uppercase_prefix, (flags & generate_flags_sentence_break) != 0);
 
     fprintf(f,
             "\n#ifdef __cplusplus\n"
@@ -961,4 +1137,23 @@ void generate_header_file(const ucd_min_sizes& min_sizes, uint32_t flags, const
     if (!(flags & generate_flags_no_header_guard)) {
         fprintf(f, "\n#endif // %sUCD_HEADER_INCLUDED_35E987C3_3323_4E66_9755_AE71CB1FE19E\n", uppercase_prefix);
     }
-}
\ No newline at end of file
+}
+
+void report_sizes(const unique_ucd& ucd, const vector<property_table>& property_tables) {
+    auto flags = ucd.flags;
+    size_t stage_one_size = ucd.stage_one.size();
+    if (flags & generate_flags_prune_stage_one) stage_one_size = ucd.pruned_stage_one_size;
+    size_t stage_two_size = ucd.stage_two.size() * block_size;
+    if (flags & generate_flags_prune_stage_two) stage_two_size = ucd.pruned_stage_two_start * block_size;
+
+    size_t entries_bytes = ucd.entries.size() * ucd.min_sizes.ucd_entry_size(flags);
+    size_t stage_one_bytes = stage_one_size * (ucd.min_sizes.stage_one_table.size / 8);
+    size_t stage_two_bytes = stage_two_size * (ucd.min_sizes.stage_two.size / 8);
+    fprintf(stderr, "%-16s %10s %10s %10s %10s\n", "table", "stage one", "stage two", "entries", "total");
+    fprintf(stderr, "%-16s %10zu %10zu %10zu %10zu\n", "ucd_entries", stage_one_bytes, stage_two_bytes, entries_bytes,
+            stage_one_bytes + stage_two_bytes + entries_bytes);
+    for (auto& table : property_tables) {
+        fprintf(stderr, "%-16s %10zu %10zu %10zu %10zu\n", table.name, table.stage_one_bytes(), table.stage_two_bytes(),
+                table.stage_three_bytes(), table.size_in_bytes());
+    }
+}
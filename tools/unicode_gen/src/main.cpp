@@ -1,6 +1,6 @@
 // Tool to generate unicode data lookup tables for C/C++.
 
-#define VERSION 0x00000200u
+#define VERSION 0x00000300u
 #define VERSION_MAJOR (VERSION >> 16u)
 #define VERSION_MINOR ((VERSION >> 8u) & 0xFFu)
 #define VERSION_PATCH (VERSION & 0xFFu)
@@ -22,6 +22,7 @@
 #include <stdexcept>
 #include <algorithm>
 #include <string>
+#include <map>
 
 // This is a simple tool, this is fine.
 using namespace std;
@@ -91,6 +92,9 @@ enum generate_flags_enum : uint32_t {
     generate_flags_prune_stage_one = (1 << 12),
     generate_flags_prune_stage_two = (1 << 13),
     generate_flags_handle_invalid_codepoints = (1 << 14),
+    generate_flags_per_property_tables = (1 << 15),
+    generate_flags_word_break = (1 << 16),
+    generate_flags_sentence_break = (1 << 17),
 
     generate_flags_named_flags_mask = (1 << 20) - 1,
 
@@ -113,6 +117,16 @@ enum generate_flags_enum : uint32_t {
                              generate_flags_handle_invalid_codepoints
 };
 
+// Block sizes of the per-property three-stage tables.
+// A codepoint is looked up by (cp >> (stage_two_bits + stage_three_bits)) in stage one, which yields a block in stage
+// two. The block in stage two is indexed by the next stage_two_bits of cp and yields a block of packed values in stage
+// three, which is indexed by the lowest stage_three_bits of cp.
+struct property_table_settings {
+    int32_t stage_two_bits = 5;
+    int32_t stage_three_bits = 5;
+    bool report_sizes = false;
+};
+
 #include "cli.cpp"
 
 void fatal_error_impl(const tchar* msg) {
@@ -368,6 +382,119 @@ const char* to_string(grapheme_break_enum gb) {
     return strings[gb];
 }
 
+enum word_break_enum : int8_t {
+    word_break_other,
+    word_break_cr,
+    word_break_lf,
+    word_break_newline,
+    word_break_extend,
+    word_break_zwj,
+    word_break_regional_indicator,
+    word_break_format,
+    word_break_katakana,
+    word_break_hebrew_letter,
+    word_break_aletter,
+    word_break_single_quote,
+    word_break_double_quote,
+    word_break_midnumlet,
+    word_break_midletter,
+    word_break_midnum,
+    word_break_numeric,
+    word_break_extendnumlet,
+    word_break_wsegspace,
+
+    // Not a Word_Break value, set for Extended_Pictographic codepoints that are otherwise Other (rule WB3c).
+    word_break_extended_pictographic,
+
+    word_break_count
+};
+char const* const word_break_enum_strings[] = {
+    "Other",     "CR",          "LF",           "Newline",      "Extend",       "ZWJ",       "Regional_Indicator",
+    "Format",    "Katakana",    "Hebrew_Letter", "ALetter",     "Single_Quote", "Double_Quote", "MidNumLet",
+    "MidLetter", "MidNum",      "Numeric",      "ExtendNumLet", "WSegSpace",    "Extended_Pictographic"};
+static_assert(size(word_break_enum_strings) == word_break_count, "");
+word_break_enum to_word_break_enum(string_segment str) {
+    for (size_t i = 0; i < size(word_break_enum_strings); ++i) {
+        if (str == word_break_enum_strings[i]) return (word_break_enum)i;
+    }
+    return (word_break_enum)-1;
+}
+const char* to_string(word_break_enum wb) {
+    static char const* const strings[] = {"word_break_other",
+                                          "word_break_cr",
+                                          "word_break_lf",
+                                          "word_break_newline",
+                                          "word_break_extend",
+                                          "word_break_zwj",
+                                          "word_break_regional_indicator",
+                                          "word_break_format",
+                                          "word_break_katakana",
+                                          "word_break_hebrew_letter",
+                                          "word_break_aletter",
+                                          "word_break_single_quote",
+                                          "word_break_double_quote",
+                                          "word_break_midnumlet",
+                                          "word_break_midletter",
+                                          "word_break_midnum",
+                                          "word_break_numeric",
+                                          "word_break_extendnumlet",
+                                          "word_break_wsegspace",
+                                          "word_break_extended_pictographic"};
+    static_assert(size(strings) == word_break_count, "");
+    if (wb < word_break_other || wb >= word_break_count) fatal_error("Internal error.");
+    return strings[wb];
+}
+
+enum sentence_break_enum : int8_t {
+    sentence_break_other,
+    sentence_break_cr,
+    sentence_break_lf,
+    sentence_break_extend,
+    sentence_break_sep,
+    sentence_break_format,
+    sentence_break_sp,
+    sentence_break_lower,
+    sentence_break_upper,
+    sentence_break_oletter,
+    sentence_break_numeric,
+    sentence_break_aterm,
+    sentence_break_scontinue,
+    sentence_break_sterm,
+    sentence_break_close,
+
+    sentence_break_count
+};
+char const* const sentence_break_enum_strings[] = {"Other",   "CR",      "LF",    "Extend",    "Sep",
+                                                   "Format",  "Sp",      "Lower", "Upper",     "OLetter",
+                                                   "Numeric", "ATerm",   "SContinue", "STerm", "Close"};
+static_assert(size(sentence_break_enum_strings) == sentence_break_count, "");
+sentence_break_enum to_sentence_break_enum(string_segment str) {
+    for (size_t i = 0; i < size(sentence_break_enum_strings); ++i) {
+        if (str == sentence_break_enum_strings[i]) return (sentence_break_enum)i;
+    }
+    return (sentence_break_enum)-1;
+}
+const char* to_string(sentence_break_enum sb) {
+    static char const* const strings[] = {"sentence_break_other",
+                                          "sentence_break_cr",
+                                          "sentence_break_lf",
+                                          "sentence_break_extend",
+                                          "sentence_break_sep",
+                                          "sentence_break_format",
+                                          "sentence_break_sp",
+                                          "sentence_break_lower",
+                                          "sentence_break_upper",
+                                          "sentence_break_oletter",
+                                          "sentence_break_numeric",
+                                          "sentence_break_aterm",
+                                          "sentence_break_scontinue",
+                                          "sentence_break_sterm",
+                                          "sentence_break_close"};
+    static_assert(size(strings) == sentence_break_count, "");
+    if (sb < sentence_break_other || sb >= sentence_break_count) fatal_error("Internal error.");
+    return strings[sb];
+}
+
 enum tag_enum : int8_t {
     tag_canonical,  // Canonical form.
     tag_font,       // Font variant (for example, a blackletter form).
@@ -462,6 +589,8 @@ struct unicode_data {
     category_enum category;
     bidirectional_category_enum bidirectional_category;
     grapheme_break_enum grapheme_break;
+    word_break_enum word_break;
+    sentence_break_enum sentence_break;
     simple_case* simple;
     full_case* full;
     conditional_case* conditionals[3];
@@ -993,6 +1122,50 @@ void parse_emoji_data(const char* emoji_data_contents, vector<char>* buffer, vec
     }
 }
 
+void parse_word_break(const char* word_break_contents, vector<char>* buffer, vector<data_entry>* out) {
+    assert(word_break_contents);
+
+    string_segment line = {};
+    while (get_line(&word_break_contents, &line)) {
+        auto cp_segment = extract_next(&line);
+        if (cp_segment.empty()) continue;
+
+        auto range = extract_codepoint_range(cp_segment, buffer);
+
+        auto word_break = to_word_break_enum(extract_next(&line));
+        if (word_break < 0 || word_break == word_break_extended_pictographic) fatal_error("Invalid word break.");
+
+        for (uint32_t cp = range.first; cp < range.last; ++cp) {
+            auto index = find_or_add(out, cp);
+            auto data = out->at(index).data;
+            assert(data->word_break == word_break_other);
+            data->word_break = word_break;
+        }
+    }
+}
+
+void parse_sentence_break(const char* sentence_break_contents, vector<char>* buffer, vector<data_entry>* out) {
+    assert(sentence_break_contents);
+
+    string_segment line = {};
+    while (get_line(&sentence_break_contents, &line)) {
+        auto cp_segment = extract_next(&line);
+        if (cp_segment.empty()) continue;
+
+        auto range = extract_codepoint_range(cp_segment, buffer);
+
+        auto sentence_break = to_sentence_break_enum(extract_next(&line));
+        if (sentence_break < 0) fatal_error("Invalid sentence break.");
+
+        for (uint32_t cp = range.first; cp < range.last; ++cp) {
+            auto index = find_or_add(out, cp);
+            auto data = out->at(index).data;
+            assert(data->sentence_break == sentence_break_other);
+            data->sentence_break = sentence_break;
+        }
+    }
+}
+
 static void append_range(vector<codepoint_range>* ranges, codepoint_range range) {
     if (!ranges->empty() && ranges->back().last == range.first) {
         ranges->back().last = range.last;
@@ -1051,7 +1224,8 @@ void parse_east_asian_width(const char* east_asian_width_contents, vector<char>*
 
 parsed_data parse_all(uint32_t flags, const char* unicode_data_contents, const char* case_folding_contents,
                       const char* special_casing_contents, const char* grapheme_break_contents,
-                      const char* east_asian_width_contents, const char* emoji_data_contents) {
+                      const char* east_asian_width_contents, const char* emoji_data_contents,
+                      const char* word_break_contents, const char* sentence_break_contents) {
     assert(unicode_data_contents);
     assert(special_casing_contents);
     assert(case_folding_contents);
@@ -1064,6 +1238,10 @@ parsed_data parse_all(uint32_t flags, const char* unicode_data_contents, const c
     parse_grapheme_break(grapheme_break_contents, &buffer, &result.data_entries);
     if (flags & generate_flags_width) parse_east_asian_width(east_asian_width_contents, &buffer, &result);
     parse_emoji_data(emoji_data_contents, &buffer, &result.data_entries);
+    if (flags & generate_flags_word_break) parse_word_break(word_break_contents, &buffer, &result.data_entries);
+    if (flags & generate_flags_sentence_break) {
+        parse_sentence_break(sentence_break_contents, &buffer, &result.data_entries);
+    }
 
 #ifdef _DEBUG
     printf("%zu bytes of monotonic space used (%.2f megabytes).\n", global_allocator.size(),
@@ -1244,6 +1422,8 @@ struct ucd_entry {
         uint8_t flags;
         grapheme_break_enum grapheme_break = grapheme_break_other;
         int8_t width;
+        word_break_enum word_break = word_break_other;
+        sentence_break_enum sentence_break = sentence_break_other;
 
         int32_t canonical_index;
         int32_t simple_canonical_offset;
@@ -1890,6 +2070,154 @@ const ucd_entry& get_ucd_entry(const unique_ucd& ucd, uint32_t cp) {
     return ucd.entries[entry_index];
 }
 
+// Compact per-property three-stage lookup table, see property_table_settings.
+struct property_table {
+    const char* name = nullptr;
+    int32_t value_bits = 0;  // Bits per value in stage three, either 1, 2, 4 or 8.
+    int32_t stage_two_bits = 0;
+    int32_t stage_three_bits = 0;
+    int32_t default_value = 0;  // Value returned for invalid codepoints.
+
+    vector<int32_t> stage_one;
+    vector<int32_t> stage_two;
+    vector<uint8_t> stage_three;
+    ucd_min_sizes::pair stage_one_type = {};
+    ucd_min_sizes::pair stage_two_type = {};
+
+    int32_t stage_three_block_bytes() const { return ((1 << stage_three_bits) * value_bits) / 8; }
+    size_t stage_one_bytes() const { return stage_one.size() * (stage_one_type.size / 8); }
+    size_t stage_two_bytes() const { return stage_two.size() * (stage_two_type.size / 8); }
+    size_t stage_three_bytes() const { return stage_three.size(); }
+    size_t size_in_bytes() const { return stage_one_bytes() + stage_two_bytes() + stage_three_bytes(); }
+
+    // Same lookup as the one that gets generated.
+    int32_t lookup(uint32_t cp) const {
+        uint32_t stage_two_index = ((uint32_t)stage_one[cp >> (stage_two_bits + stage_three_bits)] << stage_two_bits) +
+                                   ((cp >> stage_three_bits) & ((1u << stage_two_bits) - 1));
+        uint32_t offset = cp & ((1u << stage_three_bits) - 1);
+        uint32_t values_per_byte = 8 / value_bits;
+        uint8_t byte =
+            stage_three[stage_two[stage_two_index] * stage_three_block_bytes() + offset / values_per_byte];
+        return (byte >> ((offset % values_per_byte) * value_bits)) & ((1u << value_bits) - 1);
+    }
+};
+
+static ucd_min_sizes::pair get_index_type(size_t max_index) {
+    if (max_index <= UINT8_MAX) return {false, 8};
+    if (max_index <= UINT16_MAX) return {false, 16};
+    return {false, 32};
+}
+
+template <class Getter>
+property_table build_property_table(const unique_ucd& ucd, const char* name, int32_t max_value,
+                                    const property_table_settings& settings, Getter get_value) {
+    property_table result;
+    result.name = name;
+    result.stage_two_bits = settings.stage_two_bits;
+    result.stage_three_bits = settings.stage_three_bits;
+    result.default_value = get_value(ucd.entries[0]);
+
+    result.value_bits = 1;
+    while (result.value_bits < 8 && (1 << result.value_bits) <= max_value) result.value_bits *= 2;
+    if ((1 << result.value_bits) <= max_value) fatal_error("Property values do not fit into 8 bits.");
+
+    const uint32_t codepoints_count = 0x110000;
+    const uint32_t stage_three_block_size = 1u << result.stage_three_bits;
+    const uint32_t stage_two_block_size = 1u << result.stage_two_bits;
+    const uint32_t values_per_byte = 8 / result.value_bits;
+    const uint32_t codepoints_per_stage_one =
+        stage_two_block_size * stage_three_block_size;
+
+    map<vector<uint8_t>, int32_t> unique_stage_three;
+    map<vector<int32_t>, int32_t> unique_stage_two;
+    vector<uint8_t> stage_three_block(result.stage_three_block_bytes());
+    vector<int32_t> stage_two_block(stage_two_block_size);
+
+    for (uint32_t first = 0; first < codepoints_count; first += codepoints_per_stage_one) {
+        for (uint32_t i = 0; i < stage_two_block_size; ++i) {
+            fill(stage_three_block.begin(), stage_three_block.end(), (uint8_t)0);
+            for (uint32_t j = 0; j < stage_three_block_size; ++j) {
+                uint32_t cp = first + i * stage_three_block_size + j;
+                int32_t value = (cp < codepoints_count) ? get_value(get_ucd_entry(ucd, cp)) : 0;
+                assert(value >= 0 && value <= max_value);
+                stage_three_block[j / values_per_byte] |= (uint8_t)(value << ((j % values_per_byte) * result.value_bits));
+            }
+
+            auto inserted = unique_stage_three.insert({stage_three_block, (int32_t)unique_stage_three.size()});
+            if (inserted.second) {
+                result.stage_three.insert(result.stage_three.end(), stage_three_block.begin(), stage_three_block.end());
+            }
+            stage_two_block[i] = inserted.first->second;
+        }
+
+        auto inserted = unique_stage_two.insert({stage_two_block, (int32_t)unique_stage_two.size()});
+        if (inserted.second) {
+            result.stage_two.insert(result.stage_two.end(), stage_two_block.begin(), stage_two_block.end());
+        }
+        result.stage_one.push_back(inserted.first->second);
+    }
+
+    result.stage_one_type = get_index_type(unique_stage_two.size() - 1);
+    result.stage_two_type = get_index_type(unique_stage_three.size() - 1);
+
+    // Test that the table returns the same values as the ucd entries.
+    for (uint32_t cp = 0; cp < codepoints_count; ++cp) {
+        if (result.lookup(cp) != get_value(get_ucd_entry(ucd, cp))) {
+            fatal_error("Per-property table generator is wrong.");
+        }
+    }
+    return result;
+}
+
+vector<property_table> generate_property_tables(const unique_ucd& ucd, const property_table_settings& settings) {
+    vector<property_table> result;
+    auto flags = ucd.flags;
+
+    // Word and sentence break properties are only used by the segmentation iterators, so they always get their own
+    // tables instead of widening the main table entries.
+    if (flags & generate_flags_word_break) {
+        result.push_back(build_property_table(ucd, "word_break", word_break_count - 1, settings,
+                                              [](const ucd_entry& entry) -> int32_t {
+                                                  return (int32_t)entry.data.word_break;
+                                              }));
+    }
+    if (flags & generate_flags_sentence_break) {
+        result.push_back(build_property_table(ucd, "sentence_break", sentence_break_count - 1, settings,
+                                              [](const ucd_entry& entry) -> int32_t {
+                                                  return (int32_t)entry.data.sentence_break;
+                                              }));
+    }
+    if (!(flags & generate_flags_per_property_tables)) return result;
+
+    if (flags & generate_flags_category) {
+        result.push_back(build_property_table(ucd, "category", ucd_category_count - 1, settings,
+                                              [](const ucd_entry& entry) -> int32_t {
+                                                  return get_ucd_category(entry.data.flags);
+                                              }));
+        result.push_back(build_property_table(ucd, "whitespace", 1, settings, [](const ucd_entry& entry) -> int32_t {
+            return (entry.data.flags & ucd_whitespace_flag) != 0;
+        }));
+    }
+    if (flags & generate_flags_case_info) {
+        result.push_back(build_property_table(ucd, "case_info", ucd_case_count - 1, settings,
+                                              [](const ucd_entry& entry) -> int32_t {
+                                                  return get_ucd_case(entry.data.flags);
+                                              }));
+    }
+    if (flags & generate_flags_grapheme_break) {
+        result.push_back(build_property_table(ucd, "grapheme_break", grapheme_break_count - 1, settings,
+                                              [](const ucd_entry& entry) -> int32_t {
+                                                  return (int32_t)entry.data.grapheme_break;
+                                              }));
+    }
+    if (flags & generate_flags_width) {
+        result.push_back(build_property_table(ucd, "width", 2, settings, [](const ucd_entry& entry) -> int32_t {
+            return (int32_t)entry.data.width;
+        }));
+    }
+    return result;
+}
+
 void generate_tables(const vector<data_entry> data_entries, unique_ucd* out) {
     struct cp_entry_pair {
         uint32_t cp;
@@ -1912,6 +2240,13 @@ void generate_tables(const vector<data_entry> data_entries, unique_ucd* out) {
         ucd.data.flags = to_flags(flags, data->category, data->bidirectional_category);
         ucd.data.grapheme_break = (flags & generate_flags_grapheme_break) ? data->grapheme_break : grapheme_break_other;
         ucd.data.width = 0;
+        if (flags & generate_flags_word_break) {
+            ucd.data.word_break = data->word_break;
+            if (data->word_break == word_break_other && data->grapheme_break == grapheme_break_extended_pictographic) {
+                ucd.data.word_break = word_break_extended_pictographic;
+            }
+        }
+        if (flags & generate_flags_sentence_break) ucd.data.sentence_break = data->sentence_break;
         if (flags & generate_flags_width) {
             ucd.data.width = 1;
             if (data->grapheme_break == grapheme_break_extend || data->grapheme_break == grapheme_break_prepend ||
@@ -2284,9 +2619,14 @@ extern "C" int MAIN(int argc, tchar const* argv[]) {
     auto grapheme_break = read_file(cli.grapheme_break_filename.c_str());
     auto emoji_data = read_file(cli.emoji_data_filename.c_str());
     auto east_asian_width = read_file(cli.east_asian_width_filename.c_str());
+    vector<char> word_break;
+    if (cli.flags & generate_flags_word_break) word_break = read_file(cli.word_break_filename.c_str());
+    vector<char> sentence_break;
+    if (cli.flags & generate_flags_sentence_break) sentence_break = read_file(cli.sentence_break_filename.c_str());
 
     auto parsed_data = parse_all(cli.flags, unicode_data.data(), case_folding.data(), special_casing.data(),
-                                 grapheme_break.data(), east_asian_width.data(), emoji_data.data());
+                                 grapheme_break.data(), east_asian_width.data(), emoji_data.data(), word_break.data(),
+                                 sentence_break.data());
 
     unique_ucd db;
     db.flags = cli.flags;
@@ -2294,6 +2634,8 @@ extern "C" int MAIN(int argc, tchar const* argv[]) {
 
     test_grapheme_break(db, cli.grapheme_break_test_filename);
 
+    auto property_tables = generate_property_tables(db, cli.property_settings);
+
     FILE* out_file = stdout;
     if (cli.out_filename) {
         errno = 0;
@@ -2326,7 +2668,8 @@ extern "C" int MAIN(int argc, tchar const* argv[]) {
     }
 
     generate_header_file(db.min_sizes, cli.flags, cli.strings, header_out_file);
-    generate_source_file(parsed_data, db, cli.strings, out_file);
+    generate_source_file(parsed_data, db, property_tables, cli.strings, out_file);
+    if (cli.property_settings.report_sizes) report_sizes(db, property_tables);
 #ifdef _DEBUG
     FPRINTF(stdout, TEXT("Successfully parsed unicode data and generated source file.\n"));
 #endif